@@ -203,6 +203,10 @@ public:
 
     template<class T>
     AnyValue& operator=(const std::vector<T>& value);
+    //! Take ownership of the buffer of *value* instead of copying it; large
+    //! numeric sequences parsed from YAML are stored through this overload
+    template<class T>
+    AnyValue& operator=(std::vector<T>&& value);
     //! Return the held value, if it is a vector of type `T`. If called with one
     //! argument, requires the vector to be of the specified size. If called
     //! with two arguments, requires the vector to be within the range specified
@@ -413,6 +417,20 @@ public:
     static AnyMap fromYamlFile(const std::string& name,
                                const std::string& parent_name="");
 
+    //! Get a shared, immutable view of a YAML file parsed by fromYamlFile().
+    /*!
+     *  Unlike fromYamlFile(), which returns a deep copy of the cached
+     *  document on every call, this method returns shared ownership of the
+     *  cached document itself, so repeated loads of a large mechanism file
+     *  (for example, once for each phase and once for the kinetics setup)
+     *  cost a single parse and no per-call copies. Callers needing a
+     *  mutable section should copy just that section. The returned document
+     *  remains valid even if the file changes on disk and the cache entry
+     *  is replaced.
+     */
+    static std::shared_ptr<const AnyMap> fromYamlFileShared(
+        const std::string& name, const std::string& parent_name="");
+
     //! Create an AnyMap from a string containing a YAML document
     static AnyMap fromYamlString(const std::string& yaml);
 
@@ -669,7 +687,8 @@ private:
     //! Cache for previously-parsed input (YAML) files. The key is the full path
     //! to the file, and the second element of the value is the last-modified
     //! time for the file, which is used to enable change detection.
-    static std::unordered_map<std::string, std::pair<AnyMap, int>> s_cache;
+    static std::unordered_map<std::string,
+                              std::pair<std::shared_ptr<AnyMap>, int>> s_cache;
 
     //! Information about fields that should appear first when outputting to
     //! YAML. Keys in this map are matched to `__type__` keys in AnyMap
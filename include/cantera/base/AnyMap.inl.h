@@ -66,6 +66,13 @@ AnyValue &AnyValue::operator=(const std::vector<T> &value) {
     return *this;
 }
 
+template<class T>
+AnyValue &AnyValue::operator=(std::vector<T> &&value) {
+    *m_value = std::move(value);
+    m_equals = eq_comparer<std::vector<T>>;
+    return *this;
+}
+
 template<class T>
 const std::vector<T> &AnyValue::asVector(size_t nMin, size_t nMax) const {
     const auto& v = as<std::vector<T>>();
@@ -72,10 +72,16 @@ public:
 
     Array2D(const Array2D& y);
 
+    //! Move constructor. The moved-from array is left empty.
+    Array2D(Array2D&& y) noexcept;
+
     virtual ~Array2D() {}
 
     Array2D& operator=(const Array2D& y);
 
+    //! Move assignment. The moved-from array is left empty.
+    Array2D& operator=(Array2D&& y) noexcept;
+
     //! Resize the array, and fill the new entries with 'v'
     /*!
      * @param n  This is the number of rows
@@ -84,6 +90,26 @@ public:
      */
     void resize(size_t n, size_t m, double v=0.0);
 
+    //! Reserve storage for at least *n* by *m* entries without changing the
+    //! size or contents of the array. Subsequent resize() calls within the
+    //! reserved capacity do not reallocate.
+    void reserve(size_t n, size_t m) {
+        m_data.reserve(n*m);
+    }
+
+    //! Resize the array without preserving its contents
+    /*!
+     * All data is lost; every entry of the resized array is set to \c v.
+     * Unlike resize(), the existing entries are not copied into any newly
+     * allocated storage, so this is the cheaper call when the contents are
+     * about to be overwritten anyway.
+     *
+     * @param n  This is the number of rows
+     * @param m  This is the number of columns in the new matrix
+     * @param v  Fill value -> defaults to zero.
+     */
+    void resizeDiscard(size_t n, size_t m, double v=0.0);
+
     //! Append a column to the existing matrix using a std vector
     /*!
      * This operation will add a column onto the existing matrix.
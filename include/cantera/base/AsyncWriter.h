@@ -0,0 +1,157 @@
+/**
+ * @file AsyncWriter.h
+ *  Declarations for the asynchronous snapshot writer
+ *  (see \link Cantera::AsyncWriter AsyncWriter \endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_ASYNCWRITER_H
+#define CT_ASYNCWRITER_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Cantera
+{
+
+//! Background writer for solution time series.
+/*!
+ * Writing output synchronously from the solver thread stalls integration for
+ * the duration of the serialization and disk I/O. This class decouples the
+ * two: the solver deposits state snapshots into a ring of preallocated
+ * buffers with write(), and a background thread drains the ring, passing each
+ * snapshot to a user-supplied sink function that performs the actual
+ * serialization and I/O. The solver only blocks if every buffer in the ring
+ * is full, in which case it waits for the sink to catch up rather than
+ * dropping data.
+ *
+ * The ring is single-producer/single-consumer: all calls to write() and
+ * flush() must come from one thread (normally the solver thread). Snapshots
+ * are copied into the ring, so the caller's buffer can be reused immediately.
+ * The sink runs only on the background thread and therefore does not need
+ * any locking of its own, but it must not touch objects the solver is
+ * concurrently mutating; capture the file handle and any formatting state in
+ * the sink instead.
+ *
+ * Typical use, saving the state vector of a solver every few steps:
+ * \code
+ * std::ofstream out("states.bin", std::ios::binary);
+ * AsyncWriter writer([&out](double t, const vector_fp& x) {
+ *     out.write(reinterpret_cast<const char*>(&t), sizeof(t));
+ *     out.write(reinterpret_cast<const char*>(x.data()),
+ *               x.size() * sizeof(double));
+ * });
+ * ...
+ * writer.write(net.time(), x.data(), x.size()); // from the solver loop
+ * ...
+ * writer.flush(); // before closing the file
+ * \endcode
+ *
+ * Errors thrown by the sink are captured on the background thread and
+ * rethrown from the next call to write() or flush() on the solver thread.
+ */
+class AsyncWriter
+{
+public:
+    //! Constructor; starts the background thread.
+    /*!
+     * @param sink      Function called on the background thread for each
+     *                  snapshot, with the time stamp and the snapshot data
+     * @param nBuffers  Number of snapshot buffers in the ring. Two is enough
+     *                  when the sink is consistently faster than the
+     *                  interval between snapshots; a deeper ring absorbs
+     *                  bursts of slow writes.
+     * @param bufferSize  If nonzero, preallocate each buffer to this many
+     *                  doubles so that no allocation happens on the first
+     *                  pass through the ring.
+     */
+    AsyncWriter(std::function<void(double time, const vector_fp& data)> sink,
+                size_t nBuffers = 4, size_t bufferSize = 0);
+
+    //! Destructor. Drains any queued snapshots and joins the background
+    //! thread. Sink errors still pending at this point are logged rather
+    //! than thrown.
+    ~AsyncWriter();
+
+    AsyncWriter(const AsyncWriter&) = delete;
+    AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+    //! Queue a snapshot for writing
+    /*!
+     * Copies the snapshot into the next free ring buffer and returns without
+     * waiting for it to be written. If every buffer is in use, blocks until
+     * the background thread frees one.
+     *
+     * @param time  time stamp passed through to the sink
+     * @param data  snapshot data, copied into the ring
+     * @param n     number of entries in `data`
+     */
+    void write(double time, const double* data, size_t n);
+
+    //! Block until every queued snapshot has been passed to the sink
+    void flush();
+
+    //! Number of snapshots handed to the sink so far
+    size_t nWritten() const {
+        return m_written;
+    }
+
+    //! Number of write() calls that blocked waiting for a free buffer
+    /*!
+     * A nonzero value means the sink cannot keep up with the snapshot rate;
+     * deepen the ring or reduce the output frequency.
+     */
+    size_t nBlocked() const {
+        return m_blocked;
+    }
+
+private:
+    //! A ring slot: one snapshot and its time stamp
+    struct Slot {
+        double time;
+        vector_fp data;
+    };
+
+    //! Body of the background thread
+    void run();
+
+    //! Rethrow an error captured from the sink, if there is one
+    void checkError();
+
+    std::function<void(double time, const vector_fp& data)> m_sink;
+    std::vector<Slot> m_ring;
+
+    //! Index of the next slot the producer will fill. Written only by the
+    //! solver thread, read by the background thread.
+    std::atomic<size_t> m_head;
+
+    //! Index of the next slot the consumer will drain. Written only by the
+    //! background thread, read by the solver thread.
+    std::atomic<size_t> m_tail;
+
+    std::atomic<bool> m_running;
+    std::atomic<size_t> m_written;
+    size_t m_blocked;
+
+    //! Mutex and condition variables used only to sleep and wake the two
+    //! threads; the ring indices themselves are synchronized by the atomics.
+    std::mutex m_mutex;
+    std::condition_variable m_notEmpty; //!< signaled when a slot is filled
+    std::condition_variable m_notFull; //!< signaled when a slot is drained
+
+    std::string m_errorMsg; //!< first error captured from the sink
+    std::atomic<bool> m_errorPending;
+
+    std::thread m_thread;
+};
+
+}
+
+#endif
@@ -0,0 +1,119 @@
+/**
+ * @file BinaryTable.h
+ * Binary columnar table output for solution snapshots and reactor
+ * time series (see \link Cantera::BinaryTableWriter BinaryTableWriter\endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_BINARYTABLE_H
+#define CT_BINARYTABLE_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <fstream>
+
+namespace Cantera
+{
+
+class Array2D;
+
+//! Append-mode writer for binary columnar tables
+/*!
+ * Writes a table of named double-precision columns to a simple chunked
+ * binary format, avoiding the text formatting cost and file-size overhead
+ * of the CSV and TECPLOT writers. The layout is:
+ *
+ *     uint32  magic ("CTTB")
+ *     uint32  format version
+ *     uint64  number of columns
+ *     for each column: uint64 name length, followed by the name
+ *     zero or more chunks, each consisting of:
+ *         uint64  number of rows in the chunk
+ *         for each column: the rows of that column, as contiguous doubles
+ *
+ * Because the data within each chunk is stored column by column, a reader
+ * can skip over columns it does not need without touching them (see the
+ * selected-column overload of readBinaryTable()).
+ *
+ * Rows passed to append() are buffered and written out one chunk at a time,
+ * so the writer is suitable for recording reactor network histories
+ * incrementally as the integration proceeds. Opening an existing table file
+ * with matching column names appends new chunks to it.
+ */
+class BinaryTableWriter
+{
+public:
+    //! Open the table file *fname* for writing rows with the given column
+    //! *names*. If *append* is true and the file already exists, its header
+    //! is checked against *names* and new rows are added after the existing
+    //! ones; otherwise the file is replaced. Buffered rows are written to
+    //! the file in chunks of *chunkSize* rows.
+    BinaryTableWriter(const std::string& fname,
+                      const std::vector<std::string>& names,
+                      bool append=true, size_t chunkSize=512);
+
+    //! Destructor. Flushes any buffered rows.
+    ~BinaryTableWriter();
+
+    BinaryTableWriter(const BinaryTableWriter&) = delete;
+    BinaryTableWriter& operator=(const BinaryTableWriter&) = delete;
+
+    //! Number of columns in the table
+    size_t nColumns() const {
+        return m_names.size();
+    }
+
+    //! Append one row of nColumns() values to the table
+    void append(const double* row);
+
+    //! Append one row to the table. The length of *row* must equal
+    //! nColumns().
+    void append(const vector_fp& row);
+
+    //! Write any buffered rows to the file as a chunk and flush the stream
+    void flush();
+
+protected:
+    std::fstream m_file;
+    std::string m_fname;
+    std::vector<std::string> m_names;
+    size_t m_chunkSize;
+
+    //! Number of complete rows currently buffered
+    size_t m_bufRows;
+
+    //! Row-major buffer of rows not yet written, transposed into columns
+    //! when a chunk is emitted
+    vector_fp m_buffer;
+};
+
+//! Write the full table *data* to *fname* in the binary columnar format
+//! described for BinaryTableWriter, replacing any existing file.
+/*!
+ * The data are arranged as in writePlotFile(): `data(j,i)` is the value of
+ * the variable `names[j]` at point *i*, so each point becomes one row of
+ * the table.
+ */
+void writeBinaryTable(const std::string& fname,
+                      const std::vector<std::string>& names,
+                      const Array2D& data);
+
+//! Read all columns of the binary table in *fname*. On return, `data(j,i)`
+//! is the value of the variable `names[j]` at row *i*, matching the
+//! arrangement used by writeBinaryTable().
+void readBinaryTable(const std::string& fname,
+                     std::vector<std::string>& names, Array2D& data);
+
+//! Read only the named *columns* of the binary table in *fname*. Columns
+//! not requested are skipped without being read, so extracting a few
+//! species profiles from a large solution file touches only a fraction of
+//! the data. On return, `data(j,i)` is the value of `columns[j]` at row
+//! *i*. Throws CanteraError if a requested column is not in the file.
+void readBinaryTable(const std::string& fname,
+                     const std::vector<std::string>& columns, Array2D& data);
+
+}
+
+#endif
@@ -0,0 +1,117 @@
+/**
+ * @file Profiler.h
+ * Declarations for a lightweight scoped wall-clock profiler that emits
+ * Chrome trace-event JSON (see \ref Cantera::Profiler).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_PROFILER_H
+#define CT_PROFILER_H
+
+#include "ct_defs.h"
+
+#include <atomic>
+
+namespace Cantera
+{
+
+//! Lightweight global profiler that emits Chrome trace-event JSON
+/*!
+ * Scopes are recorded with the CT_PROFILE_SCOPE macro, which is placed at
+ * subsystem boundaries (rate-of-progress updates, transport property
+ * updates, Jacobian evaluation, factorization and back-substitution, and
+ * integrator callbacks) so that the wall time of a Sim1D or ReactorNet run
+ * can be broken down without an external profiler. While the profiler is
+ * disabled (the default) an instrumented scope costs a single relaxed
+ * atomic load, so the instrumentation can stay in production builds.
+ *
+ * Each thread records into its own buffer, so instrumented code running in
+ * worker threads never contends with other threads; the buffers are merged
+ * when the trace is written. The resulting file can be viewed with
+ * chrome://tracing or Perfetto.
+ *
+ * @code
+ * Profiler::enable();
+ * sim.solve(loglevel, true);
+ * Profiler::disable();
+ * Profiler::saveTrace("flame.trace.json");
+ * @endcode
+ *
+ * clear() and traceJson() walk the per-thread buffers without stopping
+ * writers, so they should only be called while no instrumented code is
+ * running (for example, after disable() once worker threads are idle).
+ */
+class Profiler
+{
+public:
+    //! Start recording profiled scopes
+    static void enable();
+
+    //! Stop recording. Events recorded so far are retained.
+    static void disable();
+
+    //! Returns `true` while the profiler is recording
+    static bool enabled() {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    //! Discard all recorded events
+    static void clear();
+
+    //! Return all recorded events as a Chrome trace-event JSON document
+    static std::string traceJson();
+
+    //! Write the Chrome trace-event JSON document to *filename*
+    static void saveTrace(const std::string& filename);
+
+    //! @internal Record one completed scope; called by ScopedProfile. The
+    //! name must point to storage that outlives the profiler (in practice,
+    //! a string literal).
+    static void record(const char* name, int64_t t0_ns, int64_t t1_ns);
+
+    //! @internal Current monotonic timestamp [ns]
+    static int64_t now();
+
+private:
+    static std::atomic<bool> s_enabled;
+};
+
+//! RAII helper that records the lifetime of one scope in the Profiler.
+//! Use through the CT_PROFILE_SCOPE macro.
+class ScopedProfile
+{
+public:
+    explicit ScopedProfile(const char* name)
+        : m_name(0)
+        , m_t0(0)
+    {
+        if (Profiler::enabled()) {
+            m_name = name;
+            m_t0 = Profiler::now();
+        }
+    }
+
+    ~ScopedProfile() {
+        if (m_name) {
+            Profiler::record(m_name, m_t0, Profiler::now());
+        }
+    }
+
+    ScopedProfile(const ScopedProfile&) = delete;
+    ScopedProfile& operator=(const ScopedProfile&) = delete;
+
+private:
+    const char* m_name;
+    int64_t m_t0;
+};
+
+}
+
+//! Record the enclosing scope in the Profiler under *name*, which must be a
+//! string literal (the pointer is stored, not the contents)
+#define CT_PROFILE_SCOPE(name) \
+    Cantera::ScopedProfile ctScopedProfile_(name)
+
+#endif
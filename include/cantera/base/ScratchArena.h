@@ -0,0 +1,176 @@
+/**
+ * @file ScratchArena.h
+ *  Pooled storage for the scratch work arrays of the kinetics and thermo
+ *  managers.
+ *
+ *  The work arrays used while evaluating reaction rates (rate constants,
+ *  rates of progress, concentrations, ...) are ordinary std::vector members
+ *  that would otherwise each obtain their own heap block, scattering data
+ *  that is accessed together across the address space. Class ScratchArena is
+ *  a simple monotonic pool of doubles, and ArenaAllocator is a standard
+ *  allocator that carves vector storage from such a pool, falling back to
+ *  the heap when the pool is exhausted or no pool has been attached. All
+ *  storage handed out by an ArenaAllocator is aligned to
+ *  ScratchArena::Alignment (64) bytes, whether it comes from the pool or
+ *  from the heap fallback, so the vectorized kernels in utilities.h can use
+ *  full-width aligned loads on these arrays. A
+ *  manager packs its work arrays by rebuilding each vector with an
+ *  ArenaAllocator once the mechanism is fully set up and the sizes are
+ *  final, in the order the arrays are visited by the evaluation loop (see
+ *  GasKinetics::packScratch()).
+ *
+ *  The pool is monotonic: storage returned to an ArenaAllocator is only
+ *  reclaimed when the pool itself is destroyed. The allocators hold the
+ *  pool through a shared_ptr, so vectors with pooled storage remain valid
+ *  regardless of destruction order.
+ *
+ *  When the CANTERA_HUGE_PAGES environment variable is set, the pool is an
+ *  anonymous memory mapping rounded up to a multiple of 2 MiB and marked
+ *  with MADV_HUGEPAGE, so the kernel can back it with transparent huge
+ *  pages and the hot evaluation loops take fewer TLB misses on large
+ *  mechanisms. Every page of the pool is touched when it is created;
+ *  since the managers build their pools lazily from the evaluation path
+ *  (see GasKinetics::packScratch()), first-touch placement puts each pool
+ *  on the NUMA node of the thread that evaluates with it, which is the
+ *  desired layout when worker threads hold their own clones.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_SCRATCHARENA_H
+#define CT_SCRATCHARENA_H
+
+#include <memory>
+#include <vector>
+
+namespace Cantera
+{
+
+//! A monotonic pool of doubles backing the scratch vectors of a kinetics or
+//! thermo manager. See the file description for usage.
+class ScratchArena
+{
+public:
+    //! Alignment in bytes of all storage handed out by the pool and by the
+    //! heap fallback of ArenaAllocator; matches the widest vector registers
+    //! in current use (AVX-512) and the usual cache line size
+    static const size_t Alignment = 64;
+
+    //! Create a pool holding at least *capacity* doubles. The storage is
+    //! zeroed, which also binds its pages to the NUMA node of the calling
+    //! thread on first-touch systems.
+    explicit ScratchArena(size_t capacity);
+
+    ~ScratchArena();
+
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    //! True if pools are backed by transparent huge pages, enabled by
+    //! setting the CANTERA_HUGE_PAGES environment variable
+    static bool hugePagesEnabled();
+
+    //! Carve *n* doubles from the pool, or return the null pointer if fewer
+    //! than *n* doubles remain. Requests are rounded up to a multiple of
+    //! #Alignment bytes so that every block handed out is aligned.
+    double* tryAlloc(size_t n) {
+        size_t unit = Alignment / sizeof(double);
+        n = (n + unit - 1) / unit * unit;
+        if (m_pos + n > m_capacity) {
+            return nullptr;
+        }
+        double* p = m_base + m_pos;
+        m_pos += n;
+        return p;
+    }
+
+    //! True if *p* points into the pool
+    bool owns(const double* p) const {
+        return m_capacity != 0 && p >= m_base && p < m_base + m_capacity;
+    }
+
+private:
+    std::vector<double> m_heap_pool; //!< pool storage when not memory-mapped
+    double* m_base; //!< start of the pool storage
+    size_t m_capacity; //!< number of doubles in the pool
+    size_t m_mapped_bytes; //!< mapping size; nonzero when memory-mapped
+    size_t m_pos; //!< index of the first unallocated pool element
+};
+
+//! Standard allocator carving storage from a ScratchArena, with the heap as
+//! fallback. See the file description.
+template <class T>
+class ArenaAllocator
+{
+public:
+    typedef T value_type;
+    typedef std::true_type propagate_on_container_copy_assignment;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    //! An allocator without a pool; all storage comes from the heap
+    ArenaAllocator() {}
+
+    //! An allocator carving storage from *arena*
+    explicit ArenaAllocator(std::shared_ptr<ScratchArena> arena)
+        : m_arena(arena)
+    {
+    }
+
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U>& other)
+        : m_arena(other.arena())
+    {
+    }
+
+    T* allocate(size_t n) {
+        if (m_arena) {
+            size_t nd = (n * sizeof(T) + sizeof(double) - 1) / sizeof(double);
+            if (double* p = m_arena->tryAlloc(nd)) {
+                return reinterpret_cast<T*>(p);
+            }
+        }
+        // Over-allocate and stash the start of the heap block just before the
+        // aligned region, so deallocate() can recover it
+        size_t bytes = n * sizeof(T) + ScratchArena::Alignment + sizeof(void*);
+        char* raw = static_cast<char*>(::operator new(bytes));
+        size_t addr = reinterpret_cast<size_t>(raw + sizeof(void*));
+        char* aligned = reinterpret_cast<char*>(
+            (addr + ScratchArena::Alignment - 1)
+            & ~(size_t(ScratchArena::Alignment) - 1));
+        reinterpret_cast<void**>(aligned)[-1] = raw;
+        return reinterpret_cast<T*>(aligned);
+    }
+
+    void deallocate(T* p, size_t n) {
+        if (!m_arena || !m_arena->owns(reinterpret_cast<double*>(p))) {
+            ::operator delete(reinterpret_cast<void**>(p)[-1]);
+        }
+        // pooled storage is reclaimed only when the arena is destroyed
+    }
+
+    std::shared_ptr<ScratchArena> arena() const {
+        return m_arena;
+    }
+
+private:
+    std::shared_ptr<ScratchArena> m_arena;
+};
+
+template <class T, class U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.arena() == b.arena();
+}
+
+template <class T, class U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return !(a == b);
+}
+
+//! A vector of doubles whose storage may be pooled in a ScratchArena
+typedef std::vector<double, ArenaAllocator<double>> scratch_fp;
+
+}
+
+#endif
@@ -0,0 +1,79 @@
+/**
+ * @file SharedMemTables.h
+ *  Named tables of doubles published in a shared memory segment.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_SHAREDMEMTABLES_H
+#define CT_SHAREDMEMTABLES_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+//! Immutable, named tables of doubles shared between processes on one node.
+/*!
+ * When many ranks of an MPI job run on the same node, each process builds its
+ * own copy of the mechanism-sized constant tables. This class lets one
+ * process publish such tables into a POSIX shared memory segment so that the
+ * other processes can map them read-only instead of rebuilding and storing
+ * them, e.g. the transport property fits shared through
+ * GasTransport::publishFitTables() and GasTransport::attachFitTables().
+ *
+ * A segment holds a set of flat double arrays, each identified by a short
+ * name. Publication writes the whole segment at once; mapped tables are
+ * strictly read-only, so no synchronization is needed once the segment
+ * exists. The application is responsible for ordering publication before
+ * attachment (e.g. with an MPI barrier) and for calling remove() when the
+ * tables are no longer needed; like any POSIX shared memory object, a
+ * segment that is never removed persists until the node is rebooted.
+ *
+ * Only available on POSIX systems; all methods throw NotImplementedError on
+ * Windows.
+ */
+class SharedMemTables
+{
+public:
+    //! Create the segment *segment* and publish the given tables into it.
+    //! An existing segment with the same name is replaced. Table names are
+    //! limited to 55 characters.
+    static void publish(const std::string& segment,
+        const std::vector<std::pair<std::string, const vector_fp*>>& tables);
+
+    //! True if a segment named *segment* has been published and not removed
+    static bool exists(const std::string& segment);
+
+    //! Remove the segment name from the system. Existing mappings remain
+    //! valid until the objects holding them are destroyed.
+    static void remove(const std::string& segment);
+
+    //! Map the published segment *segment* read-only. Throws a CanteraError
+    //! if the segment does not exist or was not written by publish().
+    explicit SharedMemTables(const std::string& segment);
+
+    //! Unmap the segment. The data published in it remains available to
+    //! other processes until remove() is called.
+    ~SharedMemTables();
+
+    SharedMemTables(const SharedMemTables&) = delete;
+    SharedMemTables& operator=(const SharedMemTables&) = delete;
+
+    //! True if the segment contains a table named *name*
+    bool hasTable(const std::string& name) const;
+
+    //! Pointer to the read-only data of table *name*, whose length in
+    //! doubles is stored in *length*. The pointer is valid for the lifetime
+    //! of this object.
+    const double* table(const std::string& name, size_t& length) const;
+
+private:
+    void* m_base; //!< base address of the mapped segment
+    size_t m_size; //!< size of the mapped segment in bytes
+};
+
+}
+
+#endif
@@ -64,6 +64,33 @@ public:
 
     AnyMap parameters(bool withInput=false) const;
 
+    //! Report the heap memory held by the ThermoPhase, Kinetics and
+    //! Transport managers of this Solution
+    /*!
+     * Returns an AnyMap with one sub-map per manager (see the managers'
+     * memoryReport() methods), so the per-instance cost of a mechanism --
+     * and the savings from sharing species and reaction definitions between
+     * instances -- can be inspected. Intended for capacity planning, not
+     * exact accounting.
+     */
+    AnyMap memoryReport() const;
+
+    //! Create an independent copy of this Solution for use by another thread
+    /*!
+     * The clone has its own ThermoPhase, Kinetics and Transport managers, and
+     * therefore its own state and property caches, so it can be used
+     * concurrently with this object without locking. The immutable mechanism
+     * data -- the Species objects (including their thermo parameterizations)
+     * and the Reaction objects -- are shared with this object rather than
+     * re-created, so cloning costs a small fraction of building a Solution
+     * from an input file. A typical use is creating one clone per worker
+     * thread before entering a parallel loop.
+     *
+     * The clone's thermodynamic state is copied from this object. Only
+     * homogeneous (single-phase) kinetics managers can be cloned.
+     */
+    shared_ptr<Solution> threadClone() const;
+
 protected:
     shared_ptr<ThermoPhase> m_thermo;  //!< ThermoPhase manager
     shared_ptr<Kinetics> m_kinetics;  //!< Kinetics manager
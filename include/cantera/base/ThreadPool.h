@@ -0,0 +1,230 @@
+/**
+ * @file ThreadPool.h
+ *  Declarations for the shared worker thread pool
+ *  (see \link Cantera::ThreadPool ThreadPool \endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_THREADPOOL_H
+#define CT_THREADPOOL_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace Cantera
+{
+
+//! Process-wide pool of worker threads shared by all parallel code paths.
+/*!
+ * The parallel features of the library (residual evaluation and grid
+ * refinement in the 1D solver, reactor network state updates, transport fit
+ * generation, norm reductions) each need worker threads. Spawning a fresh
+ * set of threads at every call site both pays the thread startup cost on
+ * every evaluation and oversubscribes the machine when several subsystems
+ * run in parallel at once. This class provides one long-lived set of workers
+ * that all of them share: tasks submitted beyond the number of workers queue
+ * up and run as workers become free, so the number of running threads never
+ * exceeds the pool size no matter how many subsystems submit work.
+ *
+ * Each worker owns a task queue; submitted tasks are distributed over the
+ * queues round-robin, a worker prefers its own queue, and an idle worker
+ * steals from the others, so uneven task lengths do not leave workers idle
+ * while work remains. Tasks are submitted in groups through TaskGroup or the
+ * run() convenience wrapper, both of which rethrow the first exception
+ * raised by any task on the submitting thread, following the error handling
+ * convention of the call sites they replace.
+ *
+ * Submitting work from inside a task is safe: a worker waiting on a nested
+ * TaskGroup executes queued tasks itself instead of blocking, so nested
+ * parallelism cannot deadlock the pool even when every worker is busy.
+ *
+ * The library accesses the pool through shared(), which builds a default
+ * pool sized to the hardware concurrency on first use. Host applications
+ * that manage their own threads can either resize the shared pool, pin its
+ * workers to cores with setAffinity(), or install a pool of their own with
+ * setShared() — including a subclass that overrides enqueue() to forward
+ * tasks into the application's scheduler, so embedded use composes with the
+ * host's threading.
+ */
+class ThreadPool
+{
+public:
+    //! Constructor; starts the worker threads.
+    /*!
+     * @param nThreads  Number of worker threads. The default of 0 starts one
+     *     worker less than the hardware concurrency, since the thread
+     *     calling run() or TaskGroup::wait() also executes tasks. A pool
+     *     with zero workers is valid; all tasks then run on the submitting
+     *     thread.
+     */
+    explicit ThreadPool(size_t nThreads = 0);
+
+    //! Destructor. Waits for queued tasks to finish and joins the workers.
+    virtual ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    //! Submit a task for execution on some worker thread.
+    /*!
+     * Virtual so that a host application can install (via setShared()) a
+     * subclass forwarding tasks into its own scheduler. Completion and error
+     * propagation are handled by TaskGroup, not by the pool.
+     */
+    virtual void enqueue(std::function<void()> task);
+
+    //! Number of threads that can execute tasks concurrently: the workers
+    //! plus the submitting thread, which participates in run() and in
+    //! TaskGroup::wait(). Call sites use this to decide how finely to
+    //! partition their work.
+    virtual size_t width() const {
+        return m_workers.size() + 1;
+    }
+
+    //! Change the number of worker threads.
+    /*!
+     * Must not be called while tasks are queued or running. The same
+     * interpretation of *nThreads* as in the constructor applies.
+     */
+    void resize(size_t nThreads);
+
+    //! Pin each worker thread to a fixed processor.
+    /*!
+     * Workers are distributed round-robin over the available processors,
+     * which keeps each worker's cache and (through first-touch allocation)
+     * its memory on one node of a NUMA machine. Only implemented on Linux;
+     * elsewhere this is a no-op. Pinning persists across resize().
+     *
+     * @param pin  If true, pin the workers; if false, restore the default of
+     *     letting the operating system migrate them freely.
+     */
+    void setAffinity(bool pin);
+
+    //! Execute `func(i)` for each *i* in `[0, nTasks)` and wait for all of
+    //! them to finish.
+    /*!
+     * Task 0 runs on the calling thread; the rest are submitted to the
+     * workers, and the caller helps execute them while it waits. The first
+     * exception thrown by any task is rethrown on the calling thread after
+     * all tasks have finished. With fewer than two tasks, or on a pool with
+     * no workers, the tasks simply run in order on the calling thread.
+     */
+    void run(size_t nTasks, const std::function<void(size_t)>& func);
+
+    //! True if the calling thread is one of this pool's workers
+    bool isWorkerThread() const;
+
+    //! Pop one queued task and execute it on the calling thread.
+    /*!
+     * Used by TaskGroup::wait() to make waiting threads productive, which
+     * is also what makes nested submission deadlock-free. Returns false if
+     * no task was queued.
+     */
+    bool tryRunTask();
+
+    //! The process-wide pool shared by all library subsystems, created on
+    //! first use with the default size.
+    static ThreadPool& shared();
+
+    //! Replace the process-wide pool.
+    /*!
+     * Intended for host applications embedding the library that already run
+     * a scheduler of their own: install a ThreadPool subclass whose
+     * enqueue() forwards into it, and every parallel code path in the
+     * library uses the host's threads. Must not be called while tasks are
+     * running. Passing an empty pointer restores the default pool on next
+     * use of shared().
+     */
+    static void setShared(std::shared_ptr<ThreadPool> pool);
+
+protected:
+    //! One worker's task queue. The owner pops from the front, thieves steal
+    //! from the back, so an owner working through a burst of its own tasks
+    //! rarely contends with the stealers.
+    struct WorkQueue {
+        std::deque<std::function<void()>> tasks;
+        std::mutex mutex;
+    };
+
+    //! Main loop of worker *i*: run tasks while any are queued, sleep
+    //! otherwise.
+    void workerLoop(size_t i);
+
+    //! Start *nThreads* workers. The caller must hold no pool locks and the
+    //! pool must have no workers running.
+    void start(size_t nThreads);
+
+    //! Signal shutdown, wake all workers, and join them.
+    void stop();
+
+    //! Pin worker *i* to a processor chosen round-robin (Linux only).
+    void pinWorker(size_t i);
+
+    std::vector<std::thread> m_workers;
+    std::vector<std::unique_ptr<WorkQueue>> m_queues;
+
+    //! Queue index for the next externally submitted task
+    std::atomic<size_t> m_nextQueue;
+
+    //! Number of queued, unclaimed tasks across all queues
+    std::atomic<size_t> m_numTasks;
+
+    std::atomic<bool> m_shutdown;
+    bool m_pinned = false;
+
+    //! Lock and signal for sleeping idle workers
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wake;
+};
+
+//! A group of tasks submitted together to a ThreadPool and waited on as one.
+/*!
+ * Each task passed to run() is submitted to the pool immediately; wait()
+ * blocks until all of them have finished and rethrows the first exception
+ * any of them raised. When wait() is called from one of the pool's own
+ * worker threads — that is, from inside another task — the waiting worker
+ * executes queued tasks instead of sleeping, so nested groups make progress
+ * even when every worker is occupied.
+ *
+ * The destructor waits for any tasks still outstanding, discarding their
+ * errors, so a group abandoned during exception propagation cannot leave
+ * tasks referencing destroyed state.
+ */
+class TaskGroup
+{
+public:
+    //! Create a group submitting to *pool*, by default the shared pool.
+    explicit TaskGroup(ThreadPool& pool = ThreadPool::shared());
+
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    //! Submit a task to the pool as part of this group.
+    void run(std::function<void()> task);
+
+    //! Wait for every task submitted so far to finish, then rethrow the
+    //! first error any of them raised.
+    void wait();
+
+private:
+    ThreadPool& m_pool;
+    std::atomic<size_t> m_pending;
+    std::mutex m_mutex;
+    std::condition_variable m_done;
+    std::exception_ptr m_error;
+};
+
+}
+
+#endif
@@ -79,6 +79,11 @@ struct CachedValue {
     //! Check whether the currently cached value is valid based on
     //! stateNum. If it is not valid it updates the stored
     //! state to the new state in addition to returning false.
+    //!
+    //! Validating against a single integer epoch counter such as
+    //! Phase::stateEpoch() is the cheapest way to detect a change in the full
+    //! thermodynamic state, since the setters bump the counter and no state
+    //! variables need to be compared here.
     bool validate(int stateNumNew) {
       if(stateNum == stateNumNew) {
         return true;
@@ -111,7 +116,9 @@ struct CachedValue {
     double state2;
 
     //! A surrogate for the composition. For cached properties of Phase,
-    //! this should be set to Phase::stateMFNumber()
+    //! this should be set to Phase::stateMFNumber(). For values that depend
+    //! on the full state, the epoch counter Phase::stateEpoch() can be used
+    //! instead, in which case no double state variables need to be stored.
     int stateNum;
 
     //! The value of the cached property
@@ -12,6 +12,7 @@
 namespace Cantera
 {
 
+class AnyMap;
 class Solution;
 class ThermoPhase;
 class Kinetics;
@@ -39,6 +40,33 @@ public:
     //! the specified file.
     void toYamlFile(const std::string& filename) const;
 
+    //! Write the definitions to the specified file, serializing incrementally
+    /*!
+     * Produces the same document as toYamlFile(), but emits it section by
+     * section in fixed-size batches of entries through a preallocated stream
+     * buffer instead of building the whole document in memory and
+     * serializing it in one pass. This bounds the peak memory footprint and
+     * the per-node allocation traffic of the emitter, which matters when
+     * dumping many large phases (e.g. ensembles of solution states).
+     *
+     * If a binary array threshold has been set (see
+     * setBinaryArrayThreshold()), numeric arrays with at least that many
+     * entries are appended to the file '<filename>.bin' as raw doubles in
+     * Cantera's native (SI + kmol) units, and are replaced in the YAML
+     * document by a mapping of the form
+     * `{binary-data: {file: ..., offset: ..., length: ..., dtype: float64}}`.
+     * The appendix is intended for post-processing tools; Cantera's YAML
+     * reader does not resolve such references.
+     */
+    void toYamlFileStreaming(const std::string& filename) const;
+
+    //! Emit numeric arrays with at least *n* entries to the binary appendix
+    //! when writing through toYamlFileStreaming(). The default of 0 disables
+    //! the appendix and keeps all arrays inline.
+    void setBinaryArrayThreshold(size_t n) {
+        m_binary_threshold = n;
+    }
+
     //! For output floating point values, set the maximum number of digits to
     //! the right of the decimal point. The default is 15 digits.
     void setPrecision(long int n) {
@@ -60,6 +88,15 @@ public:
     void setUnits(const std::map<std::string, std::string>& units={});
 
 protected:
+    //! Assemble the phase, species, and reaction definition sections shared
+    //! by toYamlString() and toYamlFileStreaming(). Reaction sections are
+    //! returned in emission order as (section name, definitions) pairs, and
+    //! the phase definitions are already patched with the names of shared
+    //! reaction sections where needed.
+    void buildDefinitionSections(std::vector<AnyMap>& phaseDefs,
+        std::vector<AnyMap>& speciesDefs,
+        std::vector<std::pair<std::string, std::vector<AnyMap>>>& reactionSections) const;
+
     std::vector<shared_ptr<Solution>> m_phases;
 
     //! @see setPrecision()
@@ -68,6 +105,9 @@ protected:
     //! @see skipUserDefined()
     bool m_skip_user_defined;
 
+    //! @see setBinaryArrayThreshold()
+    size_t m_binary_threshold;
+
     //! Top-level units directive for the output file. Defaults to Cantera's
     //! native SI+kmol system.
     UnitSystem m_output_units;
@@ -0,0 +1,69 @@
+/**
+ * @file ckimport.h
+ *  Native importer for Chemkin-format mechanism, thermodynamic, and
+ *  transport input files (see \ref Cantera::importChemkin).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_CKIMPORT_H
+#define CT_CKIMPORT_H
+
+#include "cantera/base/AnyMap.h"
+
+namespace Cantera
+{
+
+class Solution;
+
+//! Parse Chemkin-format input files directly into a YAML-equivalent AnyMap
+/*!
+ * Reads a CK-format mechanism file, together with optional separate
+ * thermodynamic and transport data files, and returns an AnyMap with the same
+ * layout as a Cantera YAML input file: a 'phases' list containing a single
+ * ideal-gas phase, plus 'species' and 'reactions' lists. The result can be
+ * passed to the AnyMap-based newPhase() and newKinetics() factory functions
+ * without round-tripping through an external conversion script.
+ *
+ * Supported mechanism features are ELEMENTS, SPECIES, an inline THERMO
+ * section or a separate fixed-format NASA-7 thermo database, and REACTIONS
+ * with reversible and irreversible reactions, third bodies, Lindemann, Troe,
+ * and SRI falloff and chemically-activated forms, PLOG rate tables, explicit
+ * reverse rate parameters (REV, emitted as a pair of irreversible reactions),
+ * duplicate declarations, modified reaction orders (FORD), third-body
+ * efficiencies, and the rate coefficient unit keywords on the REACTIONS
+ * line. Unsupported auxiliary keywords raise a CanteraError identifying the
+ * offending reaction and line.
+ *
+ * @param mechFile       Path to the CK mechanism file
+ * @param thermoFile     Optional path to a separate NASA-7 thermo database.
+ *                       Required if the mechanism file has no THERMO section.
+ * @param transportFile  Optional path to a transport database. When given,
+ *                       species transport entries are emitted and the phase
+ *                       uses the mixture-averaged transport model.
+ */
+AnyMap importChemkin(const std::string& mechFile,
+                     const std::string& thermoFile="",
+                     const std::string& transportFile="");
+
+//! Create and initialize a Solution directly from Chemkin-format input files
+/*!
+ * Convenience wrapper around importChemkin() which instantiates the thermo,
+ * kinetics, and transport managers in the same way as newSolution().
+ *
+ * @param mechFile       Path to the CK mechanism file
+ * @param thermoFile     Optional path to a separate NASA-7 thermo database
+ * @param transportFile  Optional path to a transport database
+ * @param transport      Name of the transport model to use. The default is
+ *                       the mixture-averaged model when a transport database
+ *                       was supplied and no transport manager otherwise.
+ */
+shared_ptr<Solution> newSolutionFromChemkin(const std::string& mechFile,
+                                            const std::string& thermoFile="",
+                                            const std::string& transportFile="",
+                                            const std::string& transport="");
+
+}
+
+#endif
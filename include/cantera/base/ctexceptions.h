@@ -268,8 +268,18 @@ public:
 #endif
 
 //! Throw an exception if the specified exception is not a finite number.
+/*!
+ * Compiled out entirely when the 'no_finite_checks' build option is enabled;
+ * hot loops that rely on this macro may then run an occasional batched scan
+ * instead (see checkFinite() and the CANTERA_FINITE_CHECK_INTERVAL
+ * environment variable).
+ */
 #ifndef AssertFinite
-#  define AssertFinite(expr, procedure, ...) AssertThrowMsg(expr < BigNumber && expr > -BigNumber, procedure, __VA_ARGS__)
+#  if CT_NO_FINITE_CHECKS
+#    define AssertFinite(expr, procedure, ...) ((void) (0))
+#  else
+#    define AssertFinite(expr, procedure, ...) AssertThrowMsg(expr < BigNumber && expr > -BigNumber, procedure, __VA_ARGS__)
+#  endif
 #endif
 
 }
@@ -0,0 +1,145 @@
+/**
+ * @file fastmath.h
+ *  Fast scalar exponential and logarithm kernels for the kinetics and
+ *  thermo hot loops.
+ *
+ *  The functions fast_exp(), fast_log() and fast_log10() are drop-in
+ *  replacements for the libm calls made while evaluating rate constants,
+ *  falloff functions and reference-state thermodynamic polynomials. They
+ *  are enabled by building with the 'fast_math' option; by default they
+ *  forward to the std:: functions, so there is no behavior change unless
+ *  the option is requested.
+ *
+ *  The fast versions use the rational approximations of the Cephes math
+ *  library (the same approximation used by the vectorized Arrhenius kernel
+ *  in ArrheniusTable.cpp). Over the arguments that occur in rate and
+ *  thermo evaluations the relative error is below 4 ulp (about 1e-15),
+ *  which is far smaller than the uncertainty of any rate parameterization.
+ *  They are branch-free over the normal range, so loops calling them can
+ *  be vectorized by the compiler, and out-of-range arguments (zero,
+ *  negative, denormal, non-finite) fall back to libm so the edge-case
+ *  behavior is unchanged.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_FASTMATH_H
+#define CT_FASTMATH_H
+
+#include "cantera/base/config.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace Cantera
+{
+
+#if CT_USE_FAST_MATH
+
+//! Fast exponential; see the file description for the accuracy contract
+inline double fast_exp(double x)
+{
+    if (!(x > -708.0 && x < 708.0)) {
+        // overflow, underflow and NaN handled by libm
+        return std::exp(x);
+    }
+
+    // reduce to r in [-ln(2)/2, ln(2)/2] with exp(x) = 2^n exp(r), using a
+    // two-term Cody-Waite representation of ln(2)
+    double n = std::floor(x * 1.4426950408889634074 + 0.5);
+    double r = x - n * 6.93145751953125e-1;
+    r -= n * 1.42860682030941723212e-6;
+
+    // exp(r) = 1 + 2r P(r^2) / (Q(r^2) - r P(r^2))
+    double r2 = r * r;
+    double P = r * ((1.26177193074810590878e-4 * r2
+                     + 3.02994407707441961300e-2) * r2
+                    + 9.99999999999999999910e-1);
+    double Q = ((3.00198505138664455042e-6 * r2
+                 + 2.52448340349684104192e-3) * r2
+                + 2.27265548208155028766e-1) * r2
+               + 2.00000000000000000005e0;
+    double er = 1.0 + 2.0 * P / (Q - P);
+
+    // multiply by 2^n by adding n to the exponent bits
+    int64_t bits;
+    std::memcpy(&bits, &er, sizeof(bits));
+    bits += static_cast<int64_t>(n) << 52;
+    std::memcpy(&er, &bits, sizeof(bits));
+    return er;
+}
+
+//! Fast natural logarithm; see the file description for the accuracy contract
+inline double fast_log(double x)
+{
+    if (!(x >= 2.2250738585072014e-308) || !(x < 1e308)) {
+        // zero, negative, denormal and non-finite arguments handled by libm
+        return std::log(x);
+    }
+
+    // decompose x = m * 2^e with m in [1/sqrt(2), sqrt(2))
+    int64_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    int e = static_cast<int>((bits >> 52) & 0x7ff) - 1022;
+    bits = (bits & 0x800fffffffffffffLL) | 0x3fe0000000000000LL;
+    double m;
+    std::memcpy(&m, &bits, sizeof(bits));
+    if (m < 7.07106781186547524401e-1) {
+        m += m;
+        e -= 1;
+    }
+    m -= 1.0;
+
+    // log(1 + m) = m + m^3 P(m)/Q(m) - m^2/2
+    double P = (((((1.01875663804580931796e-4 * m
+                    + 4.97494994976747001425e-1) * m
+                   + 4.70579119878881725854e0) * m
+                  + 1.44989225341610930846e1) * m
+                 + 1.79368678507819816313e1) * m
+                + 7.70838733755885391666e0);
+    double Q = (((((m + 1.12873587189167450590e1) * m
+                   + 4.52279145837532221105e1) * m
+                  + 8.29875266912776603211e1) * m
+                 + 7.11544750618563894466e1) * m
+                + 2.31251620126765340583e1);
+    double m2 = m * m;
+    double y = m * m2 * P / Q - 0.5 * m2;
+
+    // add e*ln(2) with a two-term Cody-Waite representation of ln(2)
+    y += e * -2.121944400546905827679e-4;
+    y += m;
+    y += e * 0.693359375;
+    return y;
+}
+
+//! Fast base-10 logarithm; see the file description for the accuracy contract
+inline double fast_log10(double x)
+{
+    return fast_log(x) * 4.34294481903251827651e-1;
+}
+
+#else
+
+// scalar libm fallbacks, used unless built with the 'fast_math' option
+
+inline double fast_exp(double x)
+{
+    return std::exp(x);
+}
+
+inline double fast_log(double x)
+{
+    return std::log(x);
+}
+
+inline double fast_log10(double x)
+{
+    return std::log10(x);
+}
+
+#endif
+
+}
+
+#endif
@@ -105,6 +105,54 @@ void appdelete();
 //! @copydoc Application::thread_complete
 void thread_complete();
 
+//! Increment the counter of hot-path buffer allocations
+/*!
+ * Called whenever a buffer that is meant to be allocated once and then reused,
+ * such as the saved-state vectors used by ReactorNet::eval(), has to be
+ * allocated or resized. See hotPathAllocationCount().
+ */
+void incrementHotPathAllocationCount();
+
+//! Number of times a reusable hot-path buffer has been allocated
+/*!
+ * Buffers on allocation-sensitive paths, such as the right-hand-side
+ * evaluation of a ReactorNet, are meant to be allocated once and reused on
+ * every subsequent evaluation. This counter is incremented each time such a
+ * buffer is allocated or grown, so it can be used to verify that a hot loop
+ * is allocation-free: record its value after a warm-up evaluation, and check
+ * that it has not changed at the end of the run.
+ */
+size_t hotPathAllocationCount();
+
+//! Record a data-buffer allocation attributed to a class
+/*!
+ * Called by container classes such as Array2D whenever their backing storage
+ * has to be allocated or grown. The per-class counts complement the single
+ * counter behind hotPathAllocationCount() and make it possible to pin an
+ * allocation regression to the class responsible. This is a no-op unless
+ * Cantera was compiled with the 'track_allocations' build option.
+ *
+ * @param className  name of the class that allocated, for example "Array2D"
+ */
+void incrementAllocationCount(const char* className);
+
+//! Number of data-buffer allocations recorded for a class
+/*!
+ * Returns 0 for classes that have not allocated, and for all classes unless
+ * Cantera was compiled with the 'track_allocations' build option.
+ *
+ * @param className  name of the class, as passed to
+ *     incrementAllocationCount()
+ */
+size_t allocationCount(const std::string& className);
+
+//! All per-class allocation counts recorded so far
+/*!
+ * The map is empty unless Cantera was compiled with the 'track_allocations'
+ * build option. See incrementAllocationCount().
+ */
+std::map<std::string, size_t> allocationCounts();
+
 //! Returns the hash of the git commit from which Cantera was compiled, if known
 std::string gitCommit();
 
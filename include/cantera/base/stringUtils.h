@@ -75,6 +75,42 @@ int intValue(const std::string& val);
  */
 doublereal fpValue(const std::string& val);
 
+//! Parse one doublereal value from a character range
+/*!
+ * Reads a number of the form `[+-]ddd[.ddd][eEdD[+-]ddd]` starting at
+ * *begin* (after any leading whitespace), without locale handling or
+ * intermediate strings. Values whose significand and decimal exponent can be
+ * represented exactly are converted with one correctly-rounded
+ * multiplication; all others fall back to the same C-locale stream
+ * conversion used before, so results are bit-identical to previous
+ * releases. Returns 0.0 if the range does not start with a number.
+ *
+ * This is the parser underneath fpValue(), fpValueCheck() and
+ * parseFloatArray(), where number conversion dominates the cost of importing
+ * large mechanism files.
+ *
+ * @param begin    first character of the range
+ * @param end      one past the last character of the range
+ * @param parsed   if non-null, set to one past the last character consumed
+ * @returns        the parsed value
+ */
+double fpValue(const char* begin, const char* end,
+               const char** parsed = nullptr);
+
+//! Parse whitespace- or comma-separated doubles from a raw buffer
+/*!
+ * Appends to *v* every number in the range, without tokenizing into
+ * intermediate strings. Throws a CanteraError if the range contains anything
+ * other than numbers and separators (spaces, tabs, newlines and commas), or
+ * if a number is malformed.
+ *
+ * @param begin  first character of the buffer
+ * @param end    one past the last character of the buffer
+ * @param v      vector the parsed values are appended to
+ * @returns      the number of values appended
+ */
+size_t parseFloatArray(const char* begin, const char* end, vector_fp& v);
+
 //! Translate a string into one doublereal value, with error checking
 /*!
  * fpValueCheck is a wrapper around the C++ stringstream double parser. It
@@ -104,6 +104,61 @@ inline void scale(InputIter begin, InputIter end,
         [scale_factor](double x) { return x * scale_factor; });
 }
 
+//! Non-aliasing qualifier for the raw-pointer kernels below
+#ifndef CT_RESTRICT
+#if defined(_MSC_VER)
+#define CT_RESTRICT __restrict
+#else
+#define CT_RESTRICT __restrict__
+#endif
+#endif
+
+/**
+ * @name Restrict-qualified vector kernels
+ *
+ * Raw-pointer forms of the iterator templates above for arrays that are known
+ * not to alias each other. The restrict qualification lets the compiler
+ * vectorize the loops without emitting runtime overlap checks, and arrays
+ * allocated through an ArenaAllocator (see ScratchArena.h) are 64-byte
+ * aligned, so the generated loads and stores can use full-width aligned
+ * vector instructions. The argument arrays of these functions must not
+ * overlap; use the iterator templates when they might.
+ * @{
+ */
+
+//! Inner product of the non-overlapping arrays *x* and *y* of length *n*
+inline doublereal dot(size_t n, const double* CT_RESTRICT x,
+                      const double* CT_RESTRICT y)
+{
+    doublereal sum = 0.0;
+    for (size_t k = 0; k < n; k++) {
+        sum += x[k] * y[k];
+    }
+    return sum;
+}
+
+//! Multiply the first *n* elements of *x* by *scale_factor*, storing the
+//! result in the non-overlapping array *y*
+inline void scale(size_t n, const double* CT_RESTRICT x,
+                  double* CT_RESTRICT y, doublereal scale_factor)
+{
+    for (size_t k = 0; k < n; k++) {
+        y[k] = x[k] * scale_factor;
+    }
+}
+
+//! Multiply each of the first *n* elements of *y* in place by the
+//! corresponding element of the non-overlapping array *x*
+inline void multiply_each(size_t n, const double* CT_RESTRICT x,
+                          double* CT_RESTRICT y)
+{
+    for (size_t k = 0; k < n; k++) {
+        y[k] *= x[k];
+    }
+}
+
+//@}
+
 //! Templated evaluation of a polynomial of order 6
 /*!
  * @param x   Value of the independent variable - First template parameter
@@ -177,6 +232,13 @@ void checkFinite(const double tmp);
  */
 void checkFinite(const std::string& name, double* values, size_t N);
 
+//! Number of bytes held by the heap buffer of a std::vector, counting
+//! reserved but unused capacity. Used by the memoryReport() methods.
+template <class T, class A>
+size_t vectorBytes(const std::vector<T, A>& v) {
+    return v.capacity() * sizeof(T);
+}
+
 //! Const accessor for a value in a std::map.
 /*
  * Similar to std::map.at(key), but returns *default_val* if the key is not
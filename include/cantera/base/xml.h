@@ -13,6 +13,8 @@
 
 #include "ct_defs.h"
 
+#include <unordered_map>
+
 //@{
 #define XML_INDENT 4
 //@}
@@ -662,6 +664,20 @@ protected:
      */
     std::multimap<std::string, XML_Node*> m_childindex;
 
+    //! Lazily-built index of the children of this node, keyed by the node
+    //! name and "id" attribute joined by a newline
+    /*!
+     * Built on the first findNameID() query with a nonempty id target, so
+     * that repeated lookups over large sections (for example, the
+     * speciesData section of a big mechanism) are constant time instead of
+     * linear scans. Invalidated whenever a child is added or removed, or a
+     * child's "id" attribute changes.
+     */
+    mutable std::unordered_map<std::string, XML_Node*> m_nameIdIndex;
+
+    //! True if m_nameIdIndex reflects the current set of children
+    mutable bool m_indexBuilt;
+
     //! Storage of attributes for a node
     /*!
      *  m_attribs[attribName] = attribValue
@@ -93,6 +93,10 @@ extern "C" {
     CANTERA_CAPI int thermo_equilibrate(int n, const char* XY, int solver,
                                         double rtol, int maxsteps, int maxiter,
                                         int loglevel);
+    CANTERA_CAPI int thermo_equilibrateBatch(int n, const char* XY,
+                                             size_t nStates, const double* T,
+                                             const double* P, const double* Y,
+                                             double* Teq, double* Yeq);
 
     CANTERA_CAPI double thermo_critTemperature(int n);
     CANTERA_CAPI double thermo_critPressure(int n);
@@ -129,6 +133,11 @@ extern "C" {
     CANTERA_CAPI int kin_getCreationRates(int n, size_t len, double* cdot);
     CANTERA_CAPI int kin_getDestructionRates(int n, size_t len, double* ddot);
     CANTERA_CAPI int kin_getNetProductionRates(int n, size_t len, double* wdot);
+    CANTERA_CAPI int kin_getNetProductionRatesBatch(int n, size_t nStates,
+                                                    const double* T,
+                                                    const double* P,
+                                                    const double* Y,
+                                                    double* wdot);
     CANTERA_CAPI int kin_getSourceTerms(int n, size_t len, double* ydot);
     CANTERA_CAPI double kin_multiplier(int n, int i);
     CANTERA_CAPI int kin_getReactionString(int n, int i, int len, char* buf);
@@ -140,6 +149,10 @@ extern "C" {
     CANTERA_CAPI size_t kin_speciesIndex(int n, const char* nm, const char* ph);
     CANTERA_CAPI int kin_advanceCoverages(int n, double tstep);
     CANTERA_CAPI size_t kin_phase(int n, size_t i);
+    CANTERA_CAPI int ct_batchStateEval(int nkin, const int* kin, size_t nstates,
+                                       size_t nsp, const double* T,
+                                       const double* rho, const double* y,
+                                       double* wdot);
 
     CANTERA_CAPI int trans_newDefault(int th, int loglevel);
     CANTERA_CAPI int trans_new(const char* model, int th, int loglevel);
@@ -122,6 +122,22 @@ public:
     int equilibrate(ThermoPhase& s, const char* XY, vector_fp& elMoles,
                     int loglevel = 0);
 
+    //! Enable or disable warm-started solves
+    /*!
+     * When enabled, each converged solve stores its element potentials and
+     * temperature, and the next solve starts from them instead of computing
+     * a fresh element-potential estimate. This is much faster for sweeps of
+     * smoothly varying (T, P, composition) points. If a warm-started solve
+     * fails to converge, the solve is automatically repeated from a cold
+     * start. Enabling or disabling warm starts discards any stored solution.
+     *
+     * @param enabled  true to reuse the previous solution as initial guess
+     */
+    void enableWarmStart(bool enabled) {
+        m_warmStart = enabled;
+        m_lambdaWarm.clear();
+    }
+
     /**
      * Options controlling how the calculation is carried out.
      * @see EquilOptions
@@ -301,6 +317,24 @@ protected:
     //! Verbosity of printed output. No messages when m_loglevel == 0. More
     //! output as level increases.
     int m_loglevel;
+
+private:
+    //! Main body of the equilibrium solve
+    /*!
+     * @param useWarmStart  If true, skip the element potential estimation
+     *     phase and start from the stored potentials of the previous
+     *     converged solve (#m_lambdaWarm).
+     */
+    int equilibrate_(ThermoPhase& s, const char* XYstr,
+                     vector_fp& elMolesGoal, int loglevel, bool useWarmStart);
+
+    //! If true, converged element potentials are saved and reused as the
+    //! initial guess for the next solve. See enableWarmStart().
+    bool m_warmStart;
+
+    //! Element potentials (and log T in the last entry) of the previous
+    //! converged solve. Empty if no converged solution is stored.
+    vector_fp m_lambdaWarm;
 };
 
 }
@@ -0,0 +1,110 @@
+//! @file EquilTableGenerator.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_EQUILTABLEGENERATOR_H
+#define CT_EQUILTABLEGENERATOR_H
+
+#include "MultiPhase.h"
+
+namespace Cantera
+{
+
+//! Generates chemical-equilibrium lookup tables on a structured (Z, T, P)
+//! grid using the VCS multiphase solver.
+/*!
+ * Equilibrium and flamelet tabulation loops that call the VCS solver once per
+ * grid point spend most of their time setting up a fresh equilibrium problem
+ * for every call. This driver instead keeps one vcs_MultiPhaseEquil alive per
+ * worker for an entire row of the grid, so problem setup is paid once per row
+ * and every subsequent cell starts from the converged composition of its
+ * neighbor. Rows (one row = one mixture fraction Z, marched over all T and P
+ * values) are handed to a pool of worker threads through a shared counter,
+ * and each worker operates on its own MultiPhase mixture, so no thermodynamic
+ * objects are shared between threads.
+ *
+ * The composition at mixture fraction Z is the linear mole blend
+ * \f$ n_k = Z\, n_k^{fuel} + (1-Z)\, n_k^{ox} \f$ of the two endpoint mole
+ * vectors, so element abundances vary linearly in Z.
+ *
+ * generate() writes a flat binary file: three 64-bit unsigned integers (nZ,
+ * nT, nP), the three axis vectors, and then the equilibrium mole fractions as
+ * IEEE doubles in [iZ][iT][iP][k] order. The same data remains available in
+ * memory through table() after the call.
+ */
+class EquilTableGenerator
+{
+public:
+    EquilTableGenerator();
+    virtual ~EquilTableGenerator() {}
+    EquilTableGenerator(const EquilTableGenerator&) = delete;
+    EquilTableGenerator& operator=(const EquilTableGenerator&) = delete;
+
+    //! Add a worker mixture. Each mixture processes one row of the grid at a
+    //! time, so adding N mixtures allows N rows in flight at once. The
+    //! mixtures must all contain the same phases in the same order, and must
+    //! not share ThermoPhase objects. The generator does not take ownership;
+    //! the mixtures must outlive this object.
+    void addMixture(MultiPhase& mix);
+
+    //! Number of worker mixtures
+    size_t nMixtures() const {
+        return m_mixtures.size();
+    }
+
+    //! Set the structured grid of mixture fractions, temperatures [K], and
+    //! pressures [Pa] to be tabulated.
+    void setGrid(const vector_fp& Z, const vector_fp& T, const vector_fp& P);
+
+    //! Set the endpoint mole vectors blended by the mixture fraction. Both
+    //! vectors are of length MultiPhase::nSpecies() and are in the global
+    //! species order of the worker mixtures.
+    /*!
+     * @param fuelMoles  species moles of the Z = 1 stream [kmol]
+     * @param oxidMoles  species moles of the Z = 0 stream [kmol]
+     */
+    void setEndpointMoles(const vector_fp& fuelMoles,
+                          const vector_fp& oxidMoles);
+
+    //! Equilibrate every grid point and stream the table to *fileName*.
+    /*!
+     * Rows are distributed over the worker mixtures dynamically. If any cell
+     * fails to converge, the remaining rows are still completed and the first
+     * exception is rethrown afterwards. Pass an empty file name to skip the
+     * file and only fill the in-memory table.
+     */
+    void generate(const std::string& fileName);
+
+    //! The generated table, laid out as [iZ][iT][iP][k]. Valid after a
+    //! successful call to generate().
+    const vector_fp& table() const {
+        return m_table;
+    }
+
+protected:
+    //! Equilibrate one row (all T and P points at mixture fraction
+    //! m_Z[iz]) on the given worker mixture, warm-starting each cell from
+    //! its predecessor.
+    void marchRow(MultiPhase& mix, size_t iz);
+
+    //! Worker mixtures, one per thread in flight
+    std::vector<MultiPhase*> m_mixtures;
+
+    vector_fp m_Z; //!< mixture fraction axis
+    vector_fp m_T; //!< temperature axis [K]
+    vector_fp m_P; //!< pressure axis [Pa]
+
+    //! Species moles of the Z = 1 endpoint stream
+    vector_fp m_fuelMoles;
+
+    //! Species moles of the Z = 0 endpoint stream
+    vector_fp m_oxidMoles;
+
+    //! Equilibrium mole fractions, [iZ][iT][iP][k]
+    vector_fp m_table;
+};
+
+}
+
+#endif
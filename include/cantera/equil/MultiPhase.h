@@ -642,6 +642,28 @@ private:
      */
     mutable std::vector<bool> m_temp_OK;
 
+    //! State epoch of each phase recorded after the last push in
+    //! updatePhases()
+    /*!
+     * If a phase's Phase::stateEpoch() still matches this value, and the
+     * stored temperature, pressure and mole fractions for the phase are
+     * unchanged, updatePhases() skips setting its state. Length = number
+     * of phases. A value of -1 forces the next update.
+     */
+    mutable vector_int m_phaseEpoch;
+
+    //! Temperature pushed into each phase at the last updatePhases() call.
+    //! Length = number of phases.
+    mutable vector_fp m_lastTemp;
+
+    //! Pressure pushed into each phase at the last updatePhases() call.
+    //! Length = number of phases.
+    mutable vector_fp m_lastPress;
+
+    //! Copy of #m_moleFractions as pushed into the phases at the last
+    //! updatePhases() call. Length = number of global species.
+    mutable vector_fp m_lastMoleFractions;
+
     //! Minimum temperature for which thermo parameterizations are valid.
     //! Stoichiometric phases are ignored in this determination. units Kelvin
     doublereal m_Tmin;
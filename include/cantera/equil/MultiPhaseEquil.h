@@ -175,6 +175,17 @@ protected:
     vector_fp m_work, m_work2, m_work3;
     vector_fp m_moles, m_lastmoles, m_dxi;
     vector_fp m_deltaG_RT, m_mu;
+
+    //! Chemical potentials gathered into component-sorted species order, so
+    //! that Delta G for all reactions is one matrix-vector product with m_N
+    vector_fp m_mu_sort;
+
+    //! Reciprocal component mole numbers and reciprocal solution-phase mole
+    //! totals, fetched once per call to computeReactionSteps()
+    vector_fp m_rmoles, m_rphmoles;
+
+    //! Per-phase accumulator for the quadratic stoichiometric sums
+    vector_fp m_phasework;
     std::vector<bool> m_majorsp;
     std::vector<size_t> m_sortindex;
     vector_int m_lastsort;
@@ -214,6 +214,21 @@ public:
                        int printLvl = 0, doublereal err = 1.0E-6,
                        int maxsteps = VCS_MAXSTEPS, int logLevel = -99);
 
+    //! Set the mole-number cutoff below which trace species are dropped from
+    //! the active set of the VCS iteration
+    /*!
+     * Species below the cutoff are deleted from the working problem and only
+     * reinserted when their estimated mole numbers cross back above it. This
+     * markedly reduces the per-iteration cost of problems with hundreds of
+     * species where most are trace. See VCS_SOLVE::setTraceSpeciesCutoff().
+     *
+     * @param cutoff Mole number below which a species is dropped from the
+     *     active set. Must be positive and no larger than 1.0E-10.
+     */
+    void setTraceSpeciesCutoff(double cutoff) {
+        m_vsolve.setTraceSpeciesCutoff(cutoff);
+    }
+
     //! Report the equilibrium answer in a comma separated table format
     /*!
      * This routine is used for in the test suite.
@@ -94,6 +94,18 @@ public:
      */
     int vcs_solve_TP(int print_lvl, int printDetails, int maxit);
 
+    //! Set the trace-species cutoff used for active-set reduction
+    /*!
+     * See #m_traceCutoff. For problems with many trace species, a cutoff
+     * well above the default (for example, 1.0E-32) keeps those species out
+     * of the iteration loops and the linear algebra until their estimated
+     * mole numbers cross the cutoff, at which point they are reinserted.
+     *
+     * @param cutoff  Mole number below which a species is dropped from the
+     *     active set. Must be positive and no larger than 1.0E-10.
+     */
+    void setTraceSpeciesCutoff(double cutoff);
+
     /*!
      * We make decisions on the initial mole number, and major-minor status
      * here. We also fix up the total moles in a phase.
@@ -1291,6 +1303,18 @@ public:
     //! Below this, minor species aren't refined any more
     double m_tolmin2;
 
+    //! Mole number below which a trace species is dropped from the active set
+    /*!
+     * Species whose mole numbers fall below this cutoff are deleted from the
+     * reduced species list and stop participating in the iteration loops and
+     * the linear algebra, until vcs_recheck_deleted() estimates that their
+     * mole numbers would cross back above it. The default value,
+     * #VCS_DELETE_MINORSPECIES_CUTOFF, keeps essentially every species
+     * active; raising it shrinks the working problem for mixtures dominated
+     * by trace species. Set with setTraceSpeciesCutoff().
+     */
+    double m_traceCutoff;
+
     //! Index vector that keeps track of the species vector rearrangement
     /*!
      * At the end of each run, the species vector and associated data gets put
@@ -0,0 +1,92 @@
+/**
+ *  @file ArrheniusTable.h
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_ARRHENIUSTABLE_H
+#define CT_ARRHENIUSTABLE_H
+
+#include "RxnRates.h"
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+//! Structure-of-arrays table of Arrhenius rate parameters
+/*!
+ * This class stores the parameters of a set of Arrhenius rate expressions as
+ * three contiguous arrays (pre-exponential factors, temperature exponents and
+ * activation temperatures), instead of the array-of-objects layout used by
+ * Rate1<Arrhenius>. The batched layout allows update() to compute all rate
+ * constants in one pass over dense data, using a vectorized exponential
+ * kernel where available, rather than calling scalar exp() per reaction.
+ *
+ * A table is kept alongside the Rate1<Arrhenius> manager by BulkKinetics and
+ * is used by GasKinetics::update_rates_T() when Cantera is compiled with the
+ * 'vectorize_rates' configuration option enabled.
+ */
+class ArrheniusTable
+{
+public:
+    ArrheniusTable() {}
+
+    //! Add the parameters of *rate* to the table.
+    /*!
+     * @param rxnNumber  the reaction number
+     * @param rate  rate coefficient specification for the reaction
+     */
+    void install(size_t rxnNumber, const Arrhenius& rate) {
+        m_rxn.push_back(rxnNumber);
+        m_indices[rxnNumber] = m_rxn.size() - 1;
+        m_A.push_back(rate.preExponentialFactor());
+        m_b.push_back(rate.temperatureExponent());
+        m_E.push_back(rate.activationEnergy_R());
+        m_arg.push_back(0.0);
+    }
+
+    //! Replace the parameters of an existing entry
+    void replace(size_t rxnNumber, const Arrhenius& rate) {
+        size_t i = m_indices.at(rxnNumber);
+        m_A[i] = rate.preExponentialFactor();
+        m_b[i] = rate.temperatureExponent();
+        m_E[i] = rate.activationEnergy_R();
+    }
+
+    size_t nReactions() const {
+        return m_rxn.size();
+    }
+
+    bool empty() const {
+        return m_rxn.empty();
+    }
+
+    //! Write the rate coefficients into array *values*.
+    /*!
+     * Each entry writes one element of *values*, at the location given by the
+     * reaction number specified when it was installed, exactly as done by
+     * Rate1<Arrhenius>::update().
+     */
+    void update(doublereal T, doublereal logT, doublereal* values);
+
+protected:
+    std::vector<size_t> m_rxn;
+    std::map<size_t, size_t> m_indices;
+
+    //! Pre-exponential factors
+    vector_fp m_A;
+
+    //! Temperature exponents
+    vector_fp m_b;
+
+    //! Activation temperatures (activation energy divided by gas constant)
+    vector_fp m_E;
+
+    //! Scratch array holding the exponential arguments \f$ b \ln T - E/RT \f$
+    vector_fp m_arg;
+};
+
+}
+
+#endif
@@ -11,6 +11,7 @@
 
 #include "Kinetics.h"
 #include "RateCoeffMgr.h"
+#include "ArrheniusTable.h"
 #include "cantera/kinetics/MultiRate.h"
 
 namespace Cantera
@@ -29,6 +30,8 @@ public:
     virtual void getDeltaGibbs(doublereal* deltaG);
     virtual void getDeltaEnthalpy(doublereal* deltaH);
     virtual void getDeltaEntropy(doublereal* deltaS);
+    virtual void getDeltaProperties(doublereal* deltaG, doublereal* deltaH,
+                                    doublereal* deltaS);
 
     virtual void getDeltaSSGibbs(doublereal* deltaG);
     virtual void getDeltaSSEnthalpy(doublereal* deltaH);
@@ -40,6 +43,10 @@ public:
     virtual bool addReaction(shared_ptr<Reaction> r);
     virtual void modifyReaction(size_t i, shared_ptr<Reaction> rNew);
 
+    virtual void beginRateUpdate();
+    virtual void setRateParameters(size_t i, double A, double b, double Ta);
+    virtual void commitRateUpdate();
+
     virtual void resizeSpecies();
 
     virtual void setMultiplier(size_t i, double f);
@@ -54,6 +61,10 @@ protected:
     std::map<std::string, size_t> m_bulk_types; //!< Mapping of rate handlers
 
     Rate1<Arrhenius> m_rates;
+
+    //! Structure-of-arrays mirror of #m_rates, used for batched rate-constant
+    //! updates when the 'vectorize_rates' configuration option is enabled
+    ArrheniusTable m_rates_soa;
     std::vector<size_t> m_revindex; //!< Indices of reversible reactions
     std::vector<size_t> m_irrev; //!< Indices of irreversible reactions
 
@@ -64,14 +75,16 @@ protected:
 
     //! Activity concentrations, as calculated by
     //! ThermoPhase::getActivityConcentrations
-    vector_fp m_act_conc;
+    scratch_fp m_act_conc;
 
-    //! Physical concentrations, as calculated by ThermoPhase::getConcentrations
-    vector_fp m_phys_conc;
-    vector_fp m_grt;
+    scratch_fp m_grt;
 
     bool m_ROP_ok;
     doublereal m_temp;
+
+    //! `true` while a rate parameter update transaction is open; see
+    //! beginRateUpdate()
+    bool m_rate_update_open = false;
 };
 
 }
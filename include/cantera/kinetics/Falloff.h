@@ -165,6 +165,16 @@ public:
 
     virtual void getParameters(AnyMap& reactionNode) const;
 
+    //! Sets params to contain, in order, \f[ (A, 1/T_3, 1/T_1, T_2) \f] as
+    //! stored internally, so that batched evaluation (see FalloffMgr) exactly
+    //! reproduces the results of updateTemp() and F().
+    void getInternalParameters(double* params) const {
+        params[0] = m_a;
+        params[1] = m_rt3;
+        params[2] = m_rt1;
+        params[3] = m_t2;
+    }
+
 protected:
     //! parameter a in the 4-parameter Troe falloff function. Dimensionless
     doublereal m_a;
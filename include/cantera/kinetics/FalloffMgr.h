@@ -47,6 +47,7 @@ public:
         m_falloff.push_back(f);
         m_isfalloff.push_back(reactionType == FALLOFF_RXN);
         m_indices[rxn] = m_falloff.size()-1;
+        m_groups_ok = false;
     }
 
     //! Install a new falloff function calculator.
@@ -63,6 +64,7 @@ public:
         m_falloff.push_back(f);
         m_isfalloff.push_back(type == "falloff");
         m_indices[rxn] = m_falloff.size()-1;
+        m_groups_ok = false;
     }
 
     /*!
@@ -73,6 +75,7 @@ public:
      */
     void replace(size_t rxn, shared_ptr<Falloff> f) {
         m_falloff[m_indices[rxn]] = f;
+        m_groups_ok = false;
     }
 
     //! Size of the work array required to store intermediate results.
@@ -87,7 +90,36 @@ public:
      * @param work Work array. Must be dimensioned at least workSize().
      */
     void updateTemp(doublereal t, doublereal* work) {
-        for (size_t i = 0; i < m_rxn.size(); i++) {
+        if (!m_groups_ok) {
+            buildGroups();
+        }
+
+        // Troe: the temperature-dependent part is log10(Fcent). The packed
+        // parameter array holds (A, 1/T3, 1/T1, T2) for each function, so
+        // this loop contains no virtual calls or pointer chasing.
+        for (size_t n = 0; n < m_troe.size(); n++) {
+            const double* p = &m_troe_params[4*n];
+            double Fcent = (1.0 - p[0]) * exp(-t*p[1]) + p[0] * exp(-t*p[2]);
+            if (p[3]) {
+                Fcent += exp(-p[3]/t);
+            }
+            work[m_offset[m_troe[n]]] = log10(std::max(Fcent, SmallNumber));
+        }
+
+        // SRI: packed parameters are (a, b, c, d, e)
+        for (size_t n = 0; n < m_sri.size(); n++) {
+            const double* p = &m_sri_params[5*n];
+            double* w = work + m_offset[m_sri[n]];
+            w[0] = p[0] * exp(-p[1]/t);
+            if (p[2] != 0.0) {
+                w[0] += exp(-t/p[2]);
+            }
+            w[1] = p[3] * pow(t, p[4]);
+        }
+
+        // remaining parameterizations, evaluated through the virtual
+        // interface
+        for (size_t i : m_generic) {
             m_falloff[i]->updateTemp(t, work + m_offset[i]);
         }
     }
@@ -97,27 +129,115 @@ public:
      * replace each entry by the value of the falloff function.
      */
     void pr_to_falloff(doublereal* values, const doublereal* work) {
-        for (size_t i = 0; i < m_rxn.size(); i++) {
+        if (!m_groups_ok) {
+            buildGroups();
+        }
+
+        // Lindemann: F = 1, so no function evaluation is needed at all
+        for (size_t i : m_lindemann) {
+            applyF(values, m_rxn[i], m_isfalloff[i], 1.0);
+        }
+
+        // Troe
+        for (size_t n = 0; n < m_troe.size(); n++) {
+            size_t i = m_troe[n];
             double pr = values[m_rxn[i]];
-            if (m_isfalloff[i]) {
-                // Pr / (1 + Pr) * F
-                values[m_rxn[i]] *=
-                    m_falloff[i]->F(pr, work + m_offset[i]) / (1.0 + pr);
+            double lf = work[m_offset[i]];
+            double lpr = log10(std::max(pr, SmallNumber));
+            double cc = -0.4 - 0.67 * lf;
+            double nn = 0.75 - 1.27 * lf;
+            double f1 = (lpr + cc) / (nn - 0.14 * (lpr + cc));
+            applyF(values, m_rxn[i], m_isfalloff[i],
+                   pow(10.0, lf / (1.0 + f1*f1)));
+        }
+
+        // SRI
+        for (size_t n = 0; n < m_sri.size(); n++) {
+            size_t i = m_sri[n];
+            double pr = values[m_rxn[i]];
+            const double* w = work + m_offset[i];
+            double lpr = log10(std::max(pr, SmallNumber));
+            double xx = 1.0 / (1.0 + lpr*lpr);
+            applyF(values, m_rxn[i], m_isfalloff[i], pow(w[0], xx) * w[1]);
+        }
+
+        // remaining parameterizations, evaluated through the virtual
+        // interface
+        for (size_t i : m_generic) {
+            double pr = values[m_rxn[i]];
+            applyF(values, m_rxn[i], m_isfalloff[i],
+                   m_falloff[i]->F(pr, work + m_offset[i]));
+        }
+    }
+
+protected:
+    //! Combine the reduced pressure already stored in *values* with the
+    //! falloff function value *F*, distinguishing between falloff and
+    //! chemically activated reactions.
+    void applyF(doublereal* values, size_t rxn, bool isfalloff, double F) {
+        if (isfalloff) {
+            // Pr / (1 + Pr) * F
+            values[rxn] *= F / (1.0 + values[rxn]);
+        } else {
+            // 1 / (1 + Pr) * F
+            values[rxn] = F / (1.0 + values[rxn]);
+        }
+    }
+
+    //! Group the installed falloff functions by concrete type, so that the
+    //! common parameterizations can be evaluated in flat loops over packed
+    //! parameter arrays instead of through one virtual call per reaction.
+    void buildGroups() {
+        m_lindemann.clear();
+        m_troe.clear();
+        m_sri.clear();
+        m_generic.clear();
+        m_troe_params.clear();
+        m_sri_params.clear();
+        for (size_t i = 0; i < m_falloff.size(); i++) {
+            std::string type = m_falloff[i]->type();
+            Troe* troe = dynamic_cast<Troe*>(m_falloff[i].get());
+            SRI* sri = dynamic_cast<SRI*>(m_falloff[i].get());
+            if (type == "Lindemann") {
+                m_lindemann.push_back(i);
+            } else if (type == "Troe" && troe) {
+                m_troe.push_back(i);
+                double p[4]; // (A, 1/T3, 1/T1, T2), as stored internally
+                troe->getInternalParameters(p);
+                m_troe_params.insert(m_troe_params.end(), p, p + 4);
+            } else if (type == "SRI" && sri) {
+                m_sri.push_back(i);
+                double p[5]; // (a, b, c, d, e)
+                sri->getParameters(p);
+                m_sri_params.insert(m_sri_params.end(), p, p + 5);
             } else {
-                // 1 / (1 + Pr) * F
-                values[m_rxn[i]] =
-                    m_falloff[i]->F(pr, work + m_offset[i]) / (1.0 + pr);
+                m_generic.push_back(i);
             }
         }
+        m_groups_ok = true;
     }
 
-protected:
     std::vector<size_t> m_rxn;
     std::vector<shared_ptr<Falloff> > m_falloff;
     vector_int m_loc;
     std::vector<vector_fp::difference_type> m_offset;
     size_t m_worksize;
 
+    //! @name Falloff functions grouped by concrete type
+    //! Local indices of the installed functions of each common type, with the
+    //! parameters of the Troe and SRI functions packed into flat arrays; see
+    //! buildGroups(). Rebuilt on the next evaluation after any install() or
+    //! replace() call.
+    //!@{
+    std::vector<size_t> m_lindemann;
+    std::vector<size_t> m_troe;
+    std::vector<size_t> m_sri;
+    std::vector<size_t> m_generic;
+    vector_fp m_troe_params;
+    vector_fp m_sri_params;
+    bool m_groups_ok = false;
+    //!@}
+
     //! Distinguish between falloff and chemically activated reactions
     std::vector<bool> m_isfalloff;
 
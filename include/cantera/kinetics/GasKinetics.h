@@ -46,6 +46,39 @@ public:
     virtual void getEquilibriumConstants(doublereal* kc);
     virtual void getFwdRateConstants(doublereal* kfwd);
 
+    //! @copydoc Kinetics::getRatesOfProgressSubset
+    /*!
+     * This implementation caches the effective rate coefficients (including
+     * third-body concentrations, falloff functions and equilibrium
+     * constants, but excluding the reaction multipliers) during the full
+     * rate update, and evaluates only the requested reactions from that
+     * cache. As long as the thermodynamic state is unchanged — in
+     * particular while only the reaction multipliers are varied — repeated
+     * subset queries avoid the pass over the full mechanism. When
+     * quasi-steady species are designated, the QSS adjustment couples all
+     * reactions and the base class path is used instead.
+     */
+    virtual void getRatesOfProgressSubset(const std::vector<size_t>& rxns,
+                                          doublereal* fwdROP,
+                                          doublereal* revROP=0,
+                                          doublereal* netROP=0);
+
+    //! @copydoc Kinetics::getNetProductionRateDerivatives
+    /*!
+     * The concentration derivatives are exact for mass-action kinetics, with
+     * the exception that derivatives of third-body collider concentrations
+     * and of falloff functions with respect to composition are neglected.
+     * The temperature derivatives are obtained by one-sided finite
+     * differencing at constant concentrations, since falloff, P-log and
+     * Chebyshev rates have no closed-form temperature derivative.
+     */
+    virtual void getNetProductionRateDerivatives(SparseRowMatrix& dwdotdC,
+                                                 doublereal* dwdotdT);
+
+    virtual bool netProductionRateDerivativesImplemented() const {
+        return true;
+    }
+
     //! @}
     //! @name Reaction Mechanism Setup Routines
     //! @{
@@ -67,7 +100,139 @@ public:
     //! reactions.
     virtual void update_rates_C();
 
+    //! @copydoc Kinetics::getNetProductionRatesBatch
+    /*!
+     * When a thread count greater than one has been set with
+     * setBatchNumThreads(), the states are distributed over a pool of worker
+     * threads, each evaluating rates with a private clone of the phase and of
+     * this kinetics manager (see Kinetics::threadClone()). Chunks of states
+     * are claimed from a shared counter, so the load balances dynamically.
+     */
+    virtual void getNetProductionRatesBatch(size_t nStates,
+                                            const doublereal* T,
+                                            const doublereal* P,
+                                            const doublereal* Y,
+                                            doublereal* wdot);
+
+    //! Set the number of worker threads used by getNetProductionRatesBatch().
+    /*!
+     * The default (1) evaluates all states serially on the calling thread;
+     * pass 0 to use the hardware concurrency. The thread-private phase and
+     * kinetics clones are built lazily on the next batched evaluation.
+     */
+    void setBatchNumThreads(size_t nThreads);
+
+    //! Enable interpolation of the equilibrium constants from a cached table
+    /*!
+     * When enabled with a positive relative temperature spacing *rtol*, the
+     * logarithms of the reciprocal equilibrium constants of the reversible
+     * reactions are stored each time they are computed exactly, keyed by the
+     * temperature. When the constants are later needed at a temperature that
+     * is bracketed by two stored entries closer together than `rtol * T`,
+     * they are interpolated linearly in 1/T instead of being recomputed from
+     * the standard-state chemical potentials. Since log(Kc) is very nearly
+     * linear in 1/T over small intervals, a spacing of 1e-3 typically
+     * reproduces the reverse rate constants to a relative accuracy better
+     * than 1e-8. The table is built lazily, so near-isothermal simulations
+     * only ever evaluate a handful of exact entries. Pass a value <= 0
+     * (the default) to disable interpolation and clear the table.
+     *
+     * @param rtol  maximum relative temperature spacing between the exactly
+     *     evaluated entries used for interpolation
+     */
+    void setKcInterpolationTolerance(double rtol);
+
+    //! Designate species to be treated with the quasi-steady-state (QSS)
+    //! approximation
+    /*!
+     * The designated species (typically fast-equilibrating radicals) are
+     * algebraically eliminated from the rate evaluation: whenever the rates
+     * of progress are updated, the concentrations of the QSS species are
+     * adjusted by a small local fixed-point solve so that their net
+     * production rates vanish, and the rates of progress of all reactions
+     * are evaluated at the adjusted concentrations. The net production
+     * rates reported for the QSS species themselves are then numerically
+     * zero, so the corresponding ODE components seen by the integrator
+     * become trivial and the stiffness associated with the fast radicals is
+     * removed from the system. The enhanced third-body and falloff collider
+     * concentrations are evaluated at the unmodified composition, which is
+     * a good approximation when the QSS species are present in trace
+     * amounts.
+     *
+     * The fixed-point update assumes each QSS species is destroyed by
+     * reactions that are first order in that species, which holds for
+     * radicals that do not react with themselves. Convergence is controlled
+     * by setQssSolverOptions().
+     *
+     * @param species  names of the QSS species; pass an empty vector to
+     *     disable the approximation
+     */
+    void setQuasiSteadySpecies(const std::vector<std::string>& species);
+
+    //! Set the convergence tolerance and iteration limit of the
+    //! quasi-steady-state fixed-point solve. The defaults are a relative
+    //! tolerance of 1e-6 on the QSS concentrations and 100 iterations.
+    //! @see setQuasiSteadySpecies()
+    void setQssSolverOptions(double rtol, size_t maxIter);
+
+    //! Enable collection of wall-clock timing for the rate update methods
+    /*!
+     * When enabled, updateROP(), update_rates_T() and update_rates_C() each
+     * accumulate their call count and elapsed time, which are reported by
+     * statistics(). The updateROP() section includes the time spent in the
+     * nested rate update calls. The overhead per instrumented call is two
+     * steady-clock reads; when disabled (the default) it is a single branch.
+     */
+    void enableTimingStats(bool enable) {
+        m_timing_enabled = enable;
+    }
+
+    //! Call count and accumulated wall-clock time of one instrumented
+    //! section. @see enableTimingStats()
+    struct TimingStats {
+        size_t calls = 0; //!< number of timed calls
+        double time = 0.0; //!< accumulated wall-clock time [s]
+    };
+
+    //! @copydoc Kinetics::statistics
+    /*!
+     * In addition to the base class entries, this reports the number of
+     * reference-state property evaluations made by the species thermo
+     * manager, and, when enabled with enableTimingStats(), a `timing` map
+     * with the call counts and accumulated seconds of updateROP(),
+     * update_rates_T() and update_rates_C().
+     */
+    virtual AnyMap statistics();
+
+    //! Report the heap memory held by this kinetics manager
+    /*!
+     * In addition to the base class entries, this reports the concentration
+     * and falloff work arrays and, when the corresponding features are in
+     * use, the staged rate coefficients, the quasi-steady-state solve data,
+     * and the equilibrium-constant interpolation table.
+     */
+    virtual AnyMap memoryReport() const;
+
 protected:
+    //! A thread-private phase/kinetics pair used by the parallel
+    //! implementation of getNetProductionRatesBatch()
+    struct BatchEvaluator {
+        std::unique_ptr<ThermoPhase> thermo;
+        std::unique_ptr<Kinetics> kin;
+    };
+
+    //! Build the thread-private evaluators used by
+    //! getNetProductionRatesBatch(), one fewer than the requested thread
+    //! count since the calling thread evaluates states as well.
+    void buildBatchEvaluators();
+
+    //! Fill #m_rkcn by interpolating between table entries bracketing
+    //! temperature *T*, if two entries closer together than the spacing
+    //! tolerance exist. Returns false if the table entries are missing or too
+    //! far apart, in which case an exact evaluation is required.
+    //! @see setKcInterpolationTolerance()
+    bool interpolateKc(double T);
+
     //! Reaction index of each falloff reaction
     std::vector<size_t> m_fallindx;
 
@@ -95,16 +260,138 @@ protected:
     doublereal m_logp_ref;
     doublereal m_logc_ref;
     doublereal m_logStandConc;
-    vector_fp m_rfn_low;
-    vector_fp m_rfn_high;
+    scratch_fp m_rfn_low;
+    scratch_fp m_rfn_high;
 
     doublereal m_pres; //!< Last pressure at which rates were evaluated
-    vector_fp falloff_work;
-    vector_fp concm_3b_values;
-    vector_fp concm_falloff_values;
+
+    //! Composition epoch (Phase::stateMFNumber) of the thermo object the last
+    //! time update_rates_C() was called. Together with #m_densEpoch_C, this
+    //! allows the concentration update to be skipped when only the
+    //! temperature has changed.
+    int m_mf_stateNum_C;
+
+    //! Density epoch (Phase::densityEpoch) of the thermo object the last time
+    //! update_rates_C() was called
+    int m_densEpoch_C;
+
+    //! Last pressure at which the P-log and Chebyshev rates were updated
+    doublereal m_pres_C;
+
+    //! Relative temperature spacing for equilibrium-constant interpolation;
+    //! interpolation is disabled when this is <= 0 (the default).
+    //! @see setKcInterpolationTolerance()
+    double m_kc_rtol;
+
+    //! Number of worker threads used by getNetProductionRatesBatch()
+    size_t m_batch_threads;
+
+    //! Thread-private evaluators for getNetProductionRatesBatch(), built
+    //! lazily by buildBatchEvaluators()
+    std::vector<BatchEvaluator> m_batch_evaluators;
+
+    //! Lazily built table for equilibrium-constant interpolation: maps 1/T to
+    //! the logarithms of the reciprocal equilibrium constants of the
+    //! reversible reactions (ordered as in #m_revindex) evaluated at that
+    //! temperature. These logarithms depend only on the temperature.
+    std::map<double, vector_fp> m_kc_table;
+
+    //! Adjust the concentrations of the quasi-steady species so that their
+    //! net production rates vanish, and re-evaluate the rates of progress at
+    //! the adjusted concentrations. Called from updateROP() when QSS species
+    //! have been designated. @see setQuasiSteadySpecies()
+    void applyQuasiSteadyState();
+
+    //! @name Quasi-steady-state solve data
+    //! @see setQuasiSteadySpecies()
+    //!@{
+
+    //! Global indices of the designated QSS species
+    std::vector<size_t> m_qss_species;
+
+    //! Concentration vector with the adjusted QSS entries
+    scratch_fp m_qss_conc;
+
+    //! Forward and reverse rate coefficients including the third-body,
+    //! falloff and perturbation factors, but excluding the concentration
+    //! products, saved by updateROP() so the concentration products can be
+    //! re-evaluated during the QSS iteration
+    scratch_fp m_qss_kf;
+    scratch_fp m_qss_kr; //!< see #m_qss_kf
+
+    vector_fp m_qss_cdot; //!< species creation rates during the QSS solve
+    vector_fp m_qss_ddot; //!< species destruction rates during the QSS solve
+
+    //! Relative convergence tolerance of the QSS fixed-point iteration
+    double m_qss_rtol;
+
+    //! Iteration limit of the QSS fixed-point iteration
+    size_t m_qss_maxiter;
 
     //!@}
 
+    //! Forward rate coefficients including the third-body, falloff and
+    //! pressure-dependence factors, but excluding the reaction multipliers
+    //! and concentration products, cached by updateROP() for
+    //! getRatesOfProgressSubset()
+    scratch_fp m_kf_stage;
+
+    //! True while #m_kf_stage and #m_rkcn are current for the present
+    //! thermodynamic state; cleared by the rate update methods whenever the
+    //! state changes, but not when only the reaction multipliers do
+    bool m_stage_ok;
+
+    //! True when timing of the rate update methods is enabled
+    //! @see enableTimingStats()
+    bool m_timing_enabled;
+
+    //! Evaluations since the last batched finite-value scan. Only used when
+    //! the per-reaction assertions are compiled out (build option
+    //! 'no_finite_checks') and a scan interval is configured through the
+    //! CANTERA_FINITE_CHECK_INTERVAL environment variable.
+    int m_finite_check_count;
+
+    //! Timing of updateROP() collected when enabled with enableTimingStats()
+    TimingStats m_timer_rop;
+
+    //! Timing of update_rates_T()
+    TimingStats m_timer_rates_T;
+
+    //! Timing of update_rates_C()
+    TimingStats m_timer_rates_C;
+
+    scratch_fp falloff_work;
+    scratch_fp concm_3b_values;
+    scratch_fp concm_falloff_values;
+
+    //! Move the scratch work arrays into one contiguous pool, ordered by the
+    //! access sequence of updateROP(). Called once the mechanism is complete,
+    //! on the first rate update; values are preserved. Arrays that grow
+    //! afterwards fall back to the heap, so packing is purely a locality
+    //! optimization.
+    void packScratch();
+
+    //! Pool backing the scratch arrays; see packScratch()
+    std::shared_ptr<ScratchArena> m_arena;
+
+    //! True once packScratch() has run
+    bool m_scratch_packed;
+
+    //!@}
+
+    //! @name Cached reaction stoichiometry for derivative evaluation
+    //! Per-reaction lists of (species index, exponent) pairs used by
+    //! getNetProductionRateDerivatives(), built on first use.
+    //!@{
+    std::vector<std::vector<std::pair<size_t, double>>> m_deriv_reac_orders;
+    std::vector<std::vector<std::pair<size_t, double>>> m_deriv_prod_orders;
+    std::vector<std::vector<std::pair<size_t, double>>> m_deriv_net_stoich;
+    //!@}
+
+    //! Build the cached stoichiometry lists used by
+    //! getNetProductionRateDerivatives()
+    void updateDerivativeCache();
+
     void processFalloffReactions();
 
     void addThreeBodyReaction(ThreeBodyReaction& r);
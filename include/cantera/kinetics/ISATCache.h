@@ -0,0 +1,170 @@
+/**
+ * @file ISATCache.h
+ *  Declarations for the in-situ adaptive tabulation cache for net
+ *  production rates (see \ref chemkinetics and \link Cantera::ISATCache
+ *  ISATCache \endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_ISATCACHE_H
+#define CT_ISATCACHE_H
+
+#include "cantera/base/ct_defs.h"
+#include "cantera/numerics/eigen_sparse.h"
+
+namespace Cantera
+{
+
+class Kinetics;
+class ThermoPhase;
+
+//! In-situ adaptive tabulation (ISAT) cache for net production rates.
+/*!
+ * Transported-PDF and particle solvers evaluate chemistry for very large
+ * numbers of nearly-repeating states. This class caches previously computed
+ * net production rates, together with their derivatives with respect to
+ * temperature and species concentrations, in a binary tree of tabulation
+ * points. A query inside the region of accuracy of a stored point is
+ * answered by linear extrapolation; otherwise the full kinetics evaluation
+ * is performed, and the table is grown online, either by enlarging the
+ * region of accuracy of the nearest point when the extrapolation proves
+ * accurate, or by adding a new tabulation point and splitting the tree leaf
+ * with a separating hyperplane.
+ *
+ * The tabulation coordinates are temperature and the species concentrations,
+ * and the region of accuracy is an axis-aligned ellipsoid in these
+ * coordinates, stored as a ball radius in per-point scaled space.
+ *
+ * Reference:
+ * S. B. Pope, "Computationally efficient implementation of combustion
+ * chemistry using in situ adaptive tabulation,"
+ * Combustion Theory and Modelling 1 (1997) 41-63.
+ *
+ * The wrapped kinetics manager must implement
+ * Kinetics::getNetProductionRateDerivatives() (as GasKinetics does). Queries
+ * overwrite the state of the attached thermo phase, and a cache instance is
+ * not safe for concurrent use; threaded solvers should pair one cache with
+ * one kinetics clone per thread (see Kinetics::threadClone()).
+ *
+ * @ingroup chemkinetics
+ */
+class ISATCache
+{
+public:
+    //! Constructor
+    /*!
+     * @param kin         Kinetics manager used for full evaluations. Must
+     *                    have exactly one phase and outlive this object.
+     * @param rtol        Relative tolerance on each net production rate
+     *                    within a region of accuracy
+     * @param atol        Absolute tolerance on each net production rate
+     *                    [kmol/m^3/s]
+     * @param maxEntries  Maximum number of tabulation points. When the table
+     *                    is full, queries outside every region of accuracy
+     *                    fall back to full evaluations without adding points.
+     */
+    ISATCache(Kinetics& kin, doublereal rtol = 1.0e-3,
+              doublereal atol = 1.0e-9, size_t maxEntries = 100000);
+
+    //! Get the net production rates for a state, from the table if possible
+    /*!
+     * @param T     temperature [K]
+     * @param rho   mass density [kg/m^3]
+     * @param y     mass fractions (length = number of species)
+     * @param wdot  output net production rates [kmol/m^3/s]
+     */
+    void getNetProductionRates(doublereal T, doublereal rho,
+                               const doublereal* y, doublereal* wdot);
+
+    //! Number of tabulation points currently stored
+    size_t nEntries() const {
+        return m_entries.size();
+    }
+
+    //! Number of queries answered by linear retrieval
+    size_t nRetrieved() const {
+        return m_retrieved;
+    }
+
+    //! Number of queries that enlarged a region of accuracy
+    size_t nGrown() const {
+        return m_grown;
+    }
+
+    //! Number of queries that added a tabulation point
+    size_t nAdded() const {
+        return m_added;
+    }
+
+    //! Discard all tabulation points and statistics
+    void clear();
+
+private:
+    //! A stored tabulation point
+    struct Entry {
+        vector_fp phi; //!< tabulation point, [T, c_1, ..., c_K]
+        vector_fp wdot; //!< net production rates at #phi
+        vector_fp scale; //!< per-coordinate scales of the accuracy region
+        doublereal radius; //!< accuracy-region radius in scaled coordinates
+        SparseRowMatrix dwdC; //!< rate derivatives w.r.t. concentrations
+        vector_fp dwdT; //!< rate derivatives w.r.t. temperature
+    };
+
+    //! A node of the binary search tree. Leaves reference a tabulation
+    //! point; internal nodes hold a separating hyperplane.
+    struct Node {
+        int left = -1; //!< child on the negative side; -1 for a leaf
+        int right = -1; //!< child on the positive side; -1 for a leaf
+        int entry = -1; //!< tabulation point index; -1 for internal nodes
+        vector_fp cut; //!< hyperplane normal
+        doublereal cutValue = 0.0; //!< hyperplane offset
+    };
+
+    //! Assemble the tabulation coordinates for a query state
+    void stateToPhi(doublereal T, doublereal rho, const doublereal* y,
+                    vector_fp& phi) const;
+
+    //! Descend the tree to the leaf holding the query point
+    int findLeaf(const vector_fp& phi) const;
+
+    //! Distance from a tabulation point in its scaled coordinates
+    doublereal scaledDistance(const Entry& e, const vector_fp& phi) const;
+
+    //! Evaluate the linear approximation of a tabulation point
+    void approximate(const Entry& e, const vector_fp& phi,
+                     doublereal* wdot);
+
+    //! Evaluate the full kinetics and store a new tabulation point.
+    /*!
+     * The phase state must already be set to the query state, and m_wexact
+     * must hold the exact rates for it.
+     */
+    size_t addEntry(const vector_fp& phi);
+
+    Kinetics& m_kin;
+    ThermoPhase& m_thermo;
+    size_t m_kk;
+    doublereal m_rtol;
+    doublereal m_atol;
+    doublereal m_r0; //!< initial accuracy-region radius (scaled coordinates)
+    size_t m_maxEntries;
+
+    std::vector<Entry> m_entries;
+    std::vector<Node> m_nodes;
+
+    vector_fp m_mw; //!< species molecular weights
+    vector_fp m_phi; //!< scratch query coordinates
+    vector_fp m_dphi; //!< scratch coordinate offsets
+    vector_fp m_wexact; //!< scratch exact rates
+    vector_fp m_wapprox; //!< scratch approximate rates
+
+    size_t m_retrieved;
+    size_t m_grown;
+    size_t m_added;
+};
+
+}
+
+#endif
@@ -123,6 +123,24 @@ public:
      */
     void integrate0(doublereal t0, doublereal t1);
 
+    //! Integrate a group of structurally identical surface problems from t0
+    //! to t1 using one shared integrator workspace
+    /*!
+     *  All problems must have the same number of unknowns (for example, one
+     *  ImplicitSurfChem per axial cell of a monolith discretized with the
+     *  same mechanism). Only the integrator belonging to the first problem
+     *  is ever initialized; the remaining problems are advanced by
+     *  reinitializing it in place, so no CVODES workspace is allocated for
+     *  them at all. Tolerances and step limits are taken from the first
+     *  problem.
+     *
+     *  @param cells  The problems to advance, in order
+     *  @param t0     Initial Time -> this is an input
+     *  @param t1     Final Time -> This is an input
+     */
+    static void integrateBatch(std::vector<ImplicitSurfChem*>& cells,
+                               doublereal t0, doublereal t1);
+
     //! Solve for the pseudo steady-state of the surface problem
     /*!
      * Solve for the steady state of the surface problem.
@@ -81,6 +81,22 @@ public:
      */
     void setElectricPotential(int n, doublereal V);
 
+    //! Set the tolerance used to skip coverage-dependent rate updates
+    /*!
+     * When the maximum absolute change in any surface coverage since the
+     * coverage-dependent rate corrections were last evaluated is at or below
+     * \c tol, updateROP() reuses the stored corrections instead of
+     * re-evaluating the coverage dependency expressions. The default of 0.0
+     * re-evaluates whenever any coverage has changed at all, which
+     * reproduces the exact rates.
+     *
+     * @param tol  Maximum coverage change that may be ignored
+     */
+    void setCoverageChangeTolerance(doublereal tol) {
+        m_coverageTol = tol;
+        m_cov_last.clear();
+    }
+
     //! @name Reaction Rates Of Progress
     //! @{
 
@@ -102,6 +118,8 @@ public:
     virtual void getDeltaElectrochemPotentials(doublereal* deltaM);
     virtual void getDeltaEnthalpy(doublereal* deltaH);
     virtual void getDeltaEntropy(doublereal* deltaS);
+    virtual void getDeltaProperties(doublereal* deltaG, doublereal* deltaH,
+                                    doublereal* deltaS);
 
     virtual void getDeltaSSGibbs(doublereal* deltaG);
     virtual void getDeltaSSEnthalpy(doublereal* deltaH);
@@ -422,6 +440,16 @@ protected:
 
     bool m_redo_rates;
 
+    //! Coverages at which the coverage-dependent rate corrections held by
+    //! #m_rates and #m_blowers_masel_rates were last evaluated; empty if
+    //! they have never been evaluated. Length: number of species in the
+    //! surface phase.
+    vector_fp m_cov_last;
+
+    //! Coverage change below which the coverage-dependent corrections are
+    //! not re-evaluated; see setCoverageChangeTolerance()
+    doublereal m_coverageTol;
+
     //! Vector of irreversible reaction numbers
     /*!
      * vector containing the reaction numbers of irreversible reactions.
@@ -539,6 +567,21 @@ protected:
      */
     std::vector<size_t> m_ctrxn;
 
+    //! Packed exponential arguments for the voltage corrections of the
+    //! charge transfer reactions. Scratch for applyVoltageKfwdCorrection().
+    vector_fp m_ctArg;
+
+    //! Cached voltage correction factors for the charge transfer reactions,
+    //! recomputed by applyVoltageKfwdCorrection() only when the phase
+    //! potentials or the temperature have changed
+    vector_fp m_ctFactors;
+
+    //! Phase potentials for which #m_ctFactors was computed
+    vector_fp m_ctPhi_last;
+
+    //! Value of RT for which #m_ctFactors was computed
+    doublereal m_ctRT_last = Undef;
+
     //! Vector of booleans indicating whether the charge transfer reaction rate constant
     //! is described by an exchange current density rate constant expression
     /*!
@@ -13,7 +13,9 @@
 
 #include "StoichManager.h"
 #include "cantera/base/ValueCache.h"
+#include "cantera/base/ScratchArena.h"
 #include "cantera/kinetics/ReactionFactory.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 namespace Cantera
 {
@@ -369,6 +371,29 @@ public:
      */
     virtual void getNetRatesOfProgress(doublereal* netROP);
 
+    //! Return the rates of progress of a subset of the reactions
+    /*!
+     * Writes the forward, reverse and net rates of progress of the reactions
+     * listed in *rxns* into the corresponding output arrays, each of length
+     * `rxns.size()`. A null pointer may be passed for any output that is not
+     * needed. The base class implementation performs a full rate update and
+     * copies out the requested entries; kinetics managers that can evaluate
+     * individual reactions cheaply override this method to skip the full
+     * pass (see GasKinetics), which lets workflows that repeatedly query a
+     * handful of reactions, such as reaction path diagrams and brute-force
+     * multiplier sensitivities, scale linearly instead of quadratically
+     * with the mechanism size.
+     *
+     * @param rxns    indices of the reactions to evaluate
+     * @param fwdROP  forward rates of progress [kmol/m^3/s], or null
+     * @param revROP  reverse rates of progress [kmol/m^3/s], or null
+     * @param netROP  net rates of progress [kmol/m^3/s], or null
+     */
+    virtual void getRatesOfProgressSubset(const std::vector<size_t>& rxns,
+                                          doublereal* fwdROP,
+                                          doublereal* revROP=0,
+                                          doublereal* netROP=0);
+
     //! Return a vector of Equilibrium constants.
     /*!
      *  Return the equilibrium constants of the reactions in concentration
@@ -470,6 +495,28 @@ public:
         throw NotImplementedError("Kinetics::getDeltaEntropy");
     }
 
+    /**
+     * Return the reaction Gibbs free energy, enthalpy and entropy changes
+     * in a single call. Post-processing that needs all three properties per
+     * state should prefer this to three separate calls; implementations
+     * gather the species enthalpies and entropies once and obtain deltaG
+     * from deltaH - T * deltaS. The default implementation falls back to
+     * the three individual methods.
+     *
+     * @param deltaG  Output vector of deltaG's for reactions.
+     *     units = J kmol-1. Length: nReactions().
+     * @param deltaH  Output vector of deltaH's for reactions.
+     *     units = J kmol-1. Length: nReactions().
+     * @param deltaS  Output vector of deltaS's for reactions.
+     *     units = J kmol-1 Kelvin-1. Length: nReactions().
+     */
+    virtual void getDeltaProperties(doublereal* deltaG, doublereal* deltaH,
+                                    doublereal* deltaS) {
+        getDeltaGibbs(deltaG);
+        getDeltaEnthalpy(deltaH);
+        getDeltaEntropy(deltaS);
+    }
+
     /**
      * Return the vector of values for the reaction standard state Gibbs free
      * energy change. These values don't depend upon the concentration of the
@@ -544,6 +591,130 @@ public:
      */
     virtual void getNetProductionRates(doublereal* wdot);
 
+    /**
+     * Species creation, destruction and net production rates in a single
+     * call [kmol/m^3/s or kmol/m^2/s]. The creation and destruction rates
+     * are accumulated with one set of passes over the stoichiometry lists
+     * and the net rates follow by subtraction, so diagnostics that need
+     * all three avoid the separate traversals made by getCreationRates(),
+     * getDestructionRates() and getNetProductionRates().
+     *
+     * @param cdot   Output vector of creation rates. Length: m_kk.
+     * @param ddot   Output vector of destruction rates. Length: m_kk.
+     * @param wdot   Output vector of net production rates. Length: m_kk.
+     */
+    virtual void getProductionRates(doublereal* cdot, doublereal* ddot,
+                                    doublereal* wdot);
+
+    //! Create a clone of this Kinetics object for use on another thread.
+    /*!
+     * The clone is a fully independent kinetics manager built from the same
+     * mechanism description: the Reaction objects themselves (rate
+     * parameterizations, falloff parameters, P-log and Chebyshev tables) are
+     * shared with this object through shared pointers, and only the
+     * per-object evaluator tables and scratch arrays are rebuilt. This makes
+     * the per-thread memory footprint a small fraction of a deep copy of the
+     * whole Solution, while allowing concurrent evaluation.
+     *
+     * @param phases  Per-thread ThermoPhase objects replacing each phase of
+     *     this kinetics manager, in the order used by this object. These must
+     *     be clones of the original phases, since species names, sizes, and
+     *     order must match.
+     */
+    virtual std::unique_ptr<Kinetics> threadClone(
+        const std::vector<ThermoPhase*>& phases);
+
+    //! Determine which species are reachable from a set of seed species.
+    /*!
+     * Starting from the species with nonzero concentrations in the attached
+     * phases plus any species named in *seeds*, repeatedly mark the products
+     * of each reaction whose reactants are all reachable (and, for
+     * reversible reactions, the reactants of each reaction whose products
+     * are all reachable) until no further species can be added. Species left
+     * unmarked belong to sub-networks that can never acquire nonzero
+     * production rates from the given starting compositions.
+     *
+     * @param seeds  Names of species to treat as present regardless of the
+     *     current composition, e.g. species introduced later through inlets
+     * @returns a flag for each species in the kinetics species list
+     *     indicating whether it is reachable
+     */
+    std::vector<bool> reachableSpecies(
+        const std::vector<std::string>& seeds) const;
+
+    //! Create a reduced kinetics manager containing only the reactions
+    //! reachable from a set of seed species.
+    /*!
+     * The reachable species are determined as in reachableSpecies(), and a
+     * new kinetics manager of the same type is built (sharing the Reaction
+     * objects with this one, as in threadClone()) that contains only the
+     * reactions whose participants are all reachable. The phases and species
+     * lists are unchanged, so state vectors keep their layout and
+     * unreachable species simply retain zero production rates; only the
+     * per-reaction evaluation work is eliminated. To re-activate a dormant
+     * sub-network -- for example after injecting a species not present
+     * initially -- call this method again on the full mechanism with the
+     * injected species added to *seeds*.
+     *
+     * @param phases  ThermoPhase objects for the reduced mechanism, replacing
+     *     each phase of this kinetics manager in order. Passing the phases of
+     *     this object transfers them; per-thread clones may also be used.
+     * @param seeds   Names of species to treat as present regardless of the
+     *     current composition
+     */
+    virtual std::unique_ptr<Kinetics> reducedMechanism(
+        const std::vector<ThermoPhase*>& phases,
+        const std::vector<std::string>& seeds = {});
+
+    //! Calculate net production rates for a batch of independent
+    //! thermochemical states.
+    /*!
+     * Evaluates getNetProductionRates() for *nStates* states sharing this
+     * mechanism, amortizing the per-call dispatch overhead of setting the
+     * phase state. The state of the phase object is saved on entry and
+     * restored on return. Only implemented for single-phase kinetics
+     * managers.
+     *
+     * @param nStates  Number of states to evaluate
+     * @param T     Array of temperatures. Length: nStates.
+     * @param P     Array of pressures. Length: nStates.
+     * @param Y     Array of mass fractions, stored contiguously per state.
+     *              Length: nStates * nTotalSpecies().
+     * @param wdot  Output array of net production rates, stored contiguously
+     *              per state. Length: nStates * nTotalSpecies().
+     */
+    virtual void getNetProductionRatesBatch(size_t nStates,
+                                            const doublereal* T,
+                                            const doublereal* P,
+                                            const doublereal* Y,
+                                            doublereal* wdot);
+
+    //! Calculate derivatives of the species net production rates with respect
+    //! to temperature and species concentrations.
+    /*!
+     * The concentration derivatives \f$ \partial \dot\omega_k / \partial c_j
+     * \f$ are assembled analytically from the mass-action rate expressions
+     * and the reaction stoichiometry, and returned in compressed sparse row
+     * (CSR) form with one row per species. The temperature derivatives are
+     * evaluated at constant species concentrations.
+     *
+     * @param[out] dwdotdC  Sparse matrix of derivatives of net production
+     *     rates with respect to species concentrations. Size: m_kk by m_kk.
+     * @param[out] dwdotdT  Output vector of derivatives of net production
+     *     rates with respect to temperature. Length: m_kk. May be omitted by
+     *     passing `nullptr`.
+     */
+    virtual void getNetProductionRateDerivatives(SparseRowMatrix& dwdotdC,
+                                                 doublereal* dwdotdT) {
+        throw NotImplementedError("Kinetics::getNetProductionRateDerivatives");
+    }
+
+    //! Returns true if getNetProductionRateDerivatives() is implemented by
+    //! this kinetics manager.
+    virtual bool netProductionRateDerivativesImplemented() const {
+        return false;
+    }
+
     //! @}
     //! @name Reaction Mechanism Informational Query Routines
     //! @{
@@ -709,6 +880,23 @@ public:
     //! excludes the reaction definitions, which are handled separately.
     AnyMap parameters();
 
+    //! Return diagnostic counters describing the work done by this kinetics
+    //! manager. The base class reports the manager type and the mechanism
+    //! size; derived classes may add counters and timing data collected while
+    //! evaluating rates (see GasKinetics::enableTimingStats()).
+    virtual AnyMap statistics();
+
+    //! Report the heap memory held by this kinetics manager
+    /*!
+     * Returns an AnyMap with byte counts for the rate-of-progress scratch
+     * arrays, plus the number of Reaction objects that are shared with other
+     * kinetics managers (see Kinetics::threadClone()) and therefore cost
+     * nothing extra per instance. Derived classes extend the map with their
+     * own rate data and work arrays. Intended for capacity planning, not
+     * exact accounting.
+     */
+    virtual AnyMap memoryReport() const;
+
     /**
      * Resize arrays with sizes that depend on the total number of species.
      * Automatically called before adding each Reaction and Phase.
@@ -724,6 +912,53 @@ public:
      */
     virtual bool addReaction(shared_ptr<Reaction> r);
 
+    /**
+     * Add a batch of reactions to the mechanism, grouped by type when
+     * enabled. Each reaction is installed through addReaction(); when
+     * setGroupReactionsByType() is active, the batch is first permuted with
+     * a stable sort on the reaction type (and, for elementary reactions,
+     * the reversibility), so that all reactions of the same kind occupy a
+     * contiguous index range. Errors raised while adding individual
+     * reactions are collected and reported together. Called by the
+     * mechanism loaders in place of one addReaction() call per reaction.
+     *
+     * @param rxns  the Reaction objects to be added, in input-file order
+     */
+    void addReactions(const std::vector<shared_ptr<Reaction>>& rxns);
+
+    //! Enable adding reactions in contiguous groups of like type
+    /*!
+     * Mechanisms list reversible and irreversible, three-body, falloff and
+     * pressure-dependent reactions interleaved in input-file order, which
+     * leaves the per-kind index lists used by the rate-of-progress update
+     * (such as the reversible-reaction and falloff indices) scattered
+     * across the full index range. When grouping is enabled before the
+     * mechanism is imported, addReactions() permutes the reactions so each
+     * kind occupies one contiguous, ascending index range, turning those
+     * phases into unit-stride sweeps that branch-predict and prefetch
+     * well. Reaction indices visible through this class then differ from
+     * the input-file order; use inputFileIndex() to map them back for
+     * reporting. For YAML input, the phase-entry field
+     * `group-reactions-by-type: true` sets this option before the
+     * reactions are added.
+     */
+    void setGroupReactionsByType(bool yes);
+
+    //! True if addReactions() installs reactions in type-grouped order
+    //! (see setGroupReactionsByType())
+    bool groupReactionsByType() const {
+        return m_groupByType;
+    }
+
+    //! Position of reaction *i* in the input data it was loaded from
+    /*!
+     * Identity unless setGroupReactionsByType() reordered the mechanism,
+     * in which case this returns the position the reaction held in the
+     * batches passed to addReactions(). Use for reporting results in
+     * input-file order.
+     */
+    size_t inputFileIndex(size_t i) const;
+
     /**
      * Modify the rate expression associated with a reaction. The
      * stoichiometric equation, type of the reaction, reaction orders, third
@@ -734,6 +969,53 @@ public:
      */
     virtual void modifyReaction(size_t i, shared_ptr<Reaction> rNew);
 
+    /**
+     * @name Transactional rate parameter updates
+     *
+     * Calibration and optimization loops that perturb the Arrhenius
+     * parameters of many reactions per iteration pay the full cost of
+     * modifyReaction() — constructing a replacement Reaction object and
+     * invalidating cached data — once per reaction. These methods instead
+     * write the new parameters directly into the packed rate coefficient
+     * tables and perform a single consolidated cache invalidation:
+     *
+     * \code
+     * kin.beginRateUpdate();
+     * for (size_t i : perturbed) {
+     *     kin.setRateParameters(i, A[i], b[i], Ta[i]);
+     * }
+     * kin.commitRateUpdate();
+     * \endcode
+     *
+     * The base class implementations throw NotImplementedError; kinetics
+     * managers storing their rates in Rate1<Arrhenius> tables provide them.
+     */
+    //@{
+
+    //! Open a rate parameter update transaction. Parameters written with
+    //! setRateParameters() take effect when commitRateUpdate() is called.
+    virtual void beginRateUpdate();
+
+    //! Set the Arrhenius parameters of reaction *i* within an open update
+    //! transaction. Only reactions whose rate constant is a plain Arrhenius
+    //! expression (elementary and three-body reactions) can be updated this
+    //! way; other reaction types must use modifyReaction().
+    /*!
+     * @param i   Index of the reaction to be modified
+     * @param A   Pre-exponential factor, in the native kmol/m/s units of the
+     *            rate expression
+     * @param b   Dimensionless temperature exponent
+     * @param Ta  Activation temperature, i.e. the activation energy divided
+     *            by the gas constant [K]
+     */
+    virtual void setRateParameters(size_t i, double A, double b, double Ta);
+
+    //! Close the update transaction opened with beginRateUpdate() and
+    //! invalidate cached rate data once for all modified reactions.
+    virtual void commitRateUpdate();
+
+    //@}
+
     /**
      * Return the Reaction object for reaction *i*. Changes to this object do
      * not affect the Kinetics object until the #modifyReaction function is
@@ -854,6 +1136,16 @@ protected:
     double checkDuplicateStoich(std::map<int, double>& r1,
                                 std::map<int, double>& r2) const;
 
+    //! Check whether some species in this mechanism has a non-zero third
+    //! body efficiency in both *tb1* and *tb2*.
+    /*!
+     * Used by checkDuplicates() to decide whether two reactions with the
+     * same stoichiometry are really duplicates. Runs in time proportional to
+     * the explicit efficiency lists of the two third bodies rather than the
+     * total number of species.
+     */
+    bool thirdBodiesOverlap(const ThirdBody& tb1, const ThirdBody& tb2) const;
+
     //! Check that the specified reaction is balanced (same number of atoms for
     //! each element in the reactants and products). Raises an exception if the
     //! reaction is not balanced.
@@ -887,11 +1179,19 @@ protected:
 
     /// Vector of perturbation factors for each reaction's rate of
     /// progress vector. It is initialized to one.
-    vector_fp m_perturb;
+    scratch_fp m_perturb;
 
     //! Vector of Reaction objects represented by this Kinetics manager
     std::vector<shared_ptr<Reaction> > m_reactions;
 
+    //! If true, addReactions() installs reactions grouped by type instead
+    //! of in input-file order (see setGroupReactionsByType())
+    bool m_groupByType = false;
+
+    //! Input-data position of each reaction when grouping reordered the
+    //! mechanism; empty when the order is unchanged (see inputFileIndex())
+    std::vector<size_t> m_inputOrder;
+
     //! m_thermo is a vector of pointers to ThermoPhase objects that are
     //! involved with this kinetics operator
     /*!
@@ -935,19 +1235,19 @@ protected:
     size_t m_mindim;
 
     //! Forward rate constant for each reaction
-    vector_fp m_rfn;
+    scratch_fp m_rfn;
 
     //! Reciprocal of the equilibrium constant in concentration units
-    vector_fp m_rkcn;
+    scratch_fp m_rkcn;
 
     //! Forward rate-of-progress for each reaction
-    vector_fp m_ropf;
+    scratch_fp m_ropf;
 
     //! Reverse rate-of-progress for each reaction
-    vector_fp m_ropr;
+    scratch_fp m_ropr;
 
     //! Net rate-of-progress for each reaction
-    vector_fp m_ropnet;
+    scratch_fp m_ropnet;
 
     //! The enthalpy change for each reaction to calculate Blowers-Masel rates
     vector_fp m_dH;
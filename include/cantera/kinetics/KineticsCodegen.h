@@ -0,0 +1,56 @@
+/**
+ * @file KineticsCodegen.h
+ *  Generation of mechanism-specialized kinetics source code (see
+ *  \ref chemkinetics and writeSpecializedKinetics()).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_KINETICSCODEGEN_H
+#define CT_KINETICSCODEGEN_H
+
+#include "cantera/base/ct_defs.h"
+#include <iosfwd>
+
+namespace Cantera
+{
+
+class GasKinetics;
+
+//! Write specialized C++ source code for a loaded gas-phase mechanism.
+/*!
+ * For a fixed production mechanism, the generic rate-constant evaluation
+ * pays for indirection that a mechanism-specific translation unit does not:
+ * the rate-coefficient managers loop over tables of parameters, while
+ * specialized code evaluates each rate constant with its coefficients as
+ * compile-time literals, letting the compiler fold, unroll, and vectorize
+ * across reactions.
+ *
+ * This function emits a complete C++ source file defining a subclass of
+ * GasKinetics named *className* whose update_rates_T() mirrors the generic
+ * implementation, but with the Arrhenius evaluation of every elementary and
+ * three-body reaction unrolled with literal coefficients. Falloff, P-log,
+ * Chebyshev and Blowers-Masel reactions keep their (much smaller) manager
+ * evaluations. The file ends with a static object that registers the class
+ * with KineticsFactory under the name *className*, so building it into a
+ * shared library and linking (or dlopen-ing) it makes the specialization
+ * available through newKinetics(phases, className) without any further
+ * changes; the mechanism itself is still loaded from its input file as
+ * usual.
+ *
+ * The generated code indexes the rate arrays by reaction number, so it must
+ * be used with exactly the mechanism it was generated from; a size check in
+ * the generated update_rates_T() catches gross mismatches.
+ *
+ * @param kin        loaded kinetics manager to specialize
+ * @param className  name of the emitted class, also used as the factory
+ *                   registration name. Must be a valid C++ identifier.
+ * @param out        stream receiving the generated source
+ */
+void writeSpecializedKinetics(GasKinetics& kin, const std::string& className,
+                              std::ostream& out);
+
+}
+
+#endif
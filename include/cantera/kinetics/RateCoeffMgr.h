@@ -41,6 +41,12 @@ public:
         m_rates[i] = rate;
     }
 
+    //! True if a rate coefficient calculator has been installed for reaction
+    //! *rxnNumber*
+    bool contains(size_t rxnNumber) const {
+        return m_indices.find(rxnNumber) != m_indices.end();
+    }
+
     /**
      * Update the concentration-dependent parts of the rate coefficient, if any.
      * Used by class SurfaceArrhenius to compute coverage-dependent
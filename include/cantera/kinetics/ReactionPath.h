@@ -71,6 +71,11 @@ public:
         return m_out - m_in;
     }
 
+    //! Recompute the total in- and outflow from the current flows of the
+    //! attached paths. Used after the path flows have been overwritten by
+    //! ReactionPathBuilder::updateFluxes().
+    void updateFlows();
+
     void printPaths();
 
 protected:
@@ -132,6 +137,19 @@ public:
         m_total = v;
     }
 
+    //! Zero the total flow and the per-reaction and per-label flows. The
+    //! entries themselves are kept, so re-accumulating the flows with
+    //! addReaction() does not allocate.
+    void resetFlows() {
+        m_total = 0.0;
+        for (auto& rxn : m_rxn) {
+            rxn.second = 0.0;
+        }
+        for (auto& label : m_label) {
+            label.second = 0.0;
+        }
+    }
+
     ///  Number of reactions contributing to this path
     int nReactions() {
         return static_cast<int>(m_rxn.size());
@@ -256,6 +274,13 @@ public:
     std::vector<size_t> species();
     vector_int reactions();
     void findMajorPaths(doublereal threshold, size_t lda, doublereal* a);
+
+    //! Recompute the node in- and outflows and the maximum path flow from
+    //! the current path flows. Called by
+    //! ReactionPathBuilder::updateFluxes() after it has overwritten the path
+    //! flows in place.
+    void updateFlows();
+
     void setFont(const std::string& font) {
         m_font = font;
     }
@@ -292,7 +317,7 @@ protected:
 class ReactionPathBuilder
 {
 public:
-    ReactionPathBuilder() {}
+    ReactionPathBuilder() : m_incrDiagram(0) {}
     virtual ~ReactionPathBuilder() {}
 
     int init(std::ostream& logfile, Kinetics& s);
@@ -300,6 +325,36 @@ public:
     int build(Kinetics& s, const std::string& element, std::ostream& output,
               ReactionPathDiagram& r, bool quiet=false);
 
+    //! Build the full flux-graph topology of diagram *r* for incremental
+    //! updates.
+    /*!
+     * The topology of a reaction path diagram, which species-pair edges each
+     * reaction contributes to and how many atoms of the element it
+     * transfers, is fixed by the mechanism; only the edge fluxes depend on
+     * the state. This method adds every structurally possible node and edge
+     * to *r* (with zero flux) and records a flat table of edge
+     * contributions, after which updateFluxes() refreshes all fluxes from
+     * the current rates of progress at a cost proportional to the number of
+     * contributions, with no per-call graph construction, label formatting
+     * or allocation. Useful when diagrams are generated every output step,
+     * for example for animations.
+     *
+     * Reactions for which the atom partitioning between reactants and
+     * products is indeterminate are skipped, as in build().
+     *
+     * @param s        kinetics manager; must be the one passed to init()
+     * @param element  element whose flux the diagram follows
+     * @param r        diagram to prepare; must outlive this builder or be
+     *                 used with another call to initIncremental()
+     * @returns 1 on success, -1 if the element is unknown
+     */
+    int initIncremental(Kinetics& s, const std::string& element,
+                        ReactionPathDiagram& r);
+
+    //! Refresh the edge fluxes of the diagram prepared by initIncremental()
+    //! from the current rates of progress of *s*.
+    void updateFluxes(Kinetics& s);
+
     //! Analyze a reaction to determine which reactants lead to which products.
     int findGroups(std::ostream& logfile, Kinetics& s);
 
@@ -327,6 +382,23 @@ protected:
     std::vector<bool> m_determinate;
     Array2D m_atoms;
     std::map<std::string, size_t> m_enamemap;
+
+    //! One precomputed edge contribution applied by updateFluxes()
+    struct FluxContribution {
+        size_t rxn; //!< reaction index
+        doublereal f; //!< atoms of the element transferred along this pair
+        Path* fwd; //!< path receiving the forward flux
+        Path* rev; //!< path receiving the reverse flux
+        std::string fwdlabel; //!< reaction label in the forward direction
+        std::string revlabel; //!< reaction label in the reverse direction
+    };
+
+    //! Edge contribution table built by initIncremental()
+    std::vector<FluxContribution> m_fluxTable;
+
+    //! The diagram the contribution table refers to; null until
+    //! initIncremental() has been called
+    ReactionPathDiagram* m_incrDiagram;
 };
 
 }
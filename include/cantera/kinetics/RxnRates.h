@@ -10,6 +10,7 @@
 
 #include "cantera/kinetics/reaction_defs.h"
 #include "cantera/base/ctexceptions.h"
+#include "cantera/base/fastmath.h"
 
 namespace Cantera
 {
@@ -71,7 +72,7 @@ public:
      * safely called for negative values of the pre-exponential factor.
      */
     doublereal updateRC(doublereal logT, doublereal recipT) const {
-        return m_A * std::exp(m_b*logT - m_E*recipT);
+        return m_A * fast_exp(m_b*logT - m_E*recipT);
     }
 
     //! Return the pre-exponential factor *A* (in m, kmol, s to powers depending
@@ -157,7 +158,7 @@ public:
      */
     doublereal updateRC(doublereal logT, doublereal recipT, doublereal deltaH) {
         double m_E = activationEnergy_R(deltaH);
-        return m_A * std::exp(m_b * logT - m_E * recipT);
+        return m_A * fast_exp(m_b * logT - m_E * recipT);
     }
 
     //! Return the pre-exponential factor *A* (in m, kmol, s to powers depending
@@ -265,8 +266,8 @@ public:
      * safely called for negative values of the pre-exponential factor.
      */
     doublereal updateRC(doublereal logT, doublereal recipT) const {
-        return m_A * std::exp(std::log(10.0)*m_acov + m_b*logT -
-                              (m_E + m_ecov)*recipT + m_mcov);
+        return m_A * fast_exp(std::log(10.0)*m_acov + m_b*logT -
+                             (m_E + m_ecov)*recipT + m_mcov);
     }
 
     //! Return the pre-exponential factor *A* (in m, kmol, s to powers depending
@@ -332,21 +333,36 @@ public:
             return;
         }
 
-        auto iter = pressures_.upper_bound(c[0]);
-        AssertThrowMsg(iter != pressures_.end(), "Plog::update_C",
-                       "Pressure out of range: {}", logP_);
-        AssertThrowMsg(iter != pressures_.begin(), "Plog::update_C",
-                       "Pressure out of range: {}", logP_);
+        AssertThrowMsg(logP_ > logPs_.front() && logP_ < logPs_.back(),
+                       "Plog::update_C", "Pressure out of range: {}", logP_);
+
+        // Locate the interpolation interval through the precomputed
+        // log-spaced lookup index instead of a tree search; the index maps
+        // the pressure directly to the containing interval, up to at most a
+        // couple of forward steps for unevenly spaced pressure groups.
+        size_t i;
+        if (logP_ < lookupBase_) {
+            i = 0; // below the lowest group: constant extrapolation interval
+        } else if (logP_ >= logPs_[logPs_.size() - 2]) {
+            i = logPs_.size() - 2; // above the highest group
+        } else {
+            size_t j = static_cast<size_t>((logP_ - lookupBase_)
+                                           * lookupScale_);
+            i = lookup_[std::min(j, lookup_.size() - 1)];
+            while (logP_ >= logPs_[i+1]) {
+                i++;
+            }
+        }
 
         // upper interpolation pressure
-        logP2_ = iter->first;
-        ihigh1_ = iter->second.first;
-        ihigh2_ = iter->second.second;
+        logP2_ = logPs_[i+1];
+        ihigh1_ = groups_[i+1].first;
+        ihigh2_ = groups_[i+1].second;
 
         // lower interpolation pressure
-        logP1_ = (--iter)->first;
-        ilow1_ = iter->second.first;
-        ilow2_ = iter->second.second;
+        logP1_ = logPs_[i];
+        ilow1_ = groups_[i].first;
+        ilow2_ = groups_[i].second;
 
         rDeltaP_ = 1.0 / (logP2_ - logP1_);
     }
@@ -378,7 +394,7 @@ public:
             log_k2 = std::log(k);
         }
 
-        return std::exp(log_k1 + (log_k2-log_k1) * (logP_-logP1_) * rDeltaP_);
+        return fast_exp(log_k1 + (log_k2-log_k1) * (logP_-logP1_) * rDeltaP_);
     }
 
     //! Check to make sure that the rate expression is finite over a range of
@@ -392,9 +408,28 @@ public:
     std::vector<std::pair<double, Arrhenius> > rates() const;
 
 protected:
+    //! Rebuild the flat interval table and the log-spaced lookup index from
+    //! #pressures_
+    void buildLookup();
+
     //! log(p) to (index range) in the rates_ vector
     std::map<double, std::pair<size_t, size_t> > pressures_;
 
+    //! Interval boundaries, log(p), including the extrapolation sentinels; a
+    //! flat mirror of the keys of #pressures_ used on the hot path
+    vector_fp logPs_;
+
+    //! Rate index range at each boundary in #logPs_
+    std::vector<std::pair<size_t, size_t> > groups_;
+
+    //! Log-spaced lookup index over the tabulated pressure range; entry j
+    //! holds the interval containing the start of bucket j, so update_C()
+    //! finds the interpolation interval without a tree search
+    std::vector<size_t> lookup_;
+
+    double lookupBase_; //!< log(p) of the lowest pressure group
+    double lookupScale_; //!< lookup buckets per unit log(p)
+
     // Rate expressions which are referenced by the indices stored in pressures_
     std::vector<Arrhenius> rates_;
 
@@ -443,7 +478,7 @@ class ChebyshevRate
 {
 public:
     //! Default constructor.
-    ChebyshevRate() {}
+    ChebyshevRate() : logPlast_(-BigNumber) {}
 
     //! Constructor directly from coefficient array
     /*
@@ -461,6 +496,14 @@ public:
     //! Update concentration-dependent parts of the rate coefficient.
     //! @param c base-10 logarithm of the pressure in Pa
     void update_C(const doublereal* c) {
+        if (c[0] == logPlast_) {
+            // the pressure basis and its dot products with the coefficient
+            // matrix are still valid; this makes the per-state cost O(nT)
+            // instead of O(nT*nP) whenever the pressure is unchanged, as in
+            // 1-D flame sweeps and constant-pressure reactors
+            return;
+        }
+        logPlast_ = c[0];
         double Pr = (2 * c[0] + PrNum_) * PrDen_;
         double Cnm1 = Pr;
         double Cn = 1;
@@ -547,6 +590,10 @@ protected:
     size_t nT_; //!< number of points in the temperature direction
     vector_fp chebCoeffs_; //!< Chebyshev coefficients, length nP * nT
     vector_fp dotProd_; //!< dot product of chebCoeffs with the reduced pressure polynomial
+
+    //! log10(p) for which #dotProd_ was last evaluated; used to skip the
+    //! pressure-basis recomputation when the pressure has not changed
+    double logPlast_;
 };
 
 /**
@@ -8,8 +8,12 @@
 #ifndef CT_STOICH_MGR_H
 #define CT_STOICH_MGR_H
 
+#include "cantera/base/ct_defs.h"
 #include "cantera/base/ctexceptions.h"
 
+#include <array>
+#include <algorithm>
+
 namespace Cantera
 {
 
@@ -533,9 +537,20 @@ public:
      * DGG - the problem is that the number of reactions and species are not
      * known initially.
      */
-    StoichManagerN() {
+    StoichManagerN() : m_sparseOk(false), m_orderOk(false) {
     }
 
+    //! Compressed storage of one orientation of the stoichiometric
+    //! coefficient matrix: row start offsets, column indices and coefficient
+    //! values. Used for the sparse matrix-vector backend enabled by the
+    //! 'sparse_stoich' configuration option, and for the reaction-major
+    //! order table returned by reactionOrders().
+    struct Compressed {
+        std::vector<size_t> start; //!< row start offsets (length nRows + 1)
+        std::vector<size_t> index; //!< column index of each entry
+        vector_fp value; //!< coefficient value of each entry
+    };
+
     /**
      * Add a single reaction to the list of reactions that this stoichiometric
      * manager object handles.
@@ -578,6 +593,12 @@ public:
         if (stoich.size() != k.size()) {
            throw CanteraError("StoichManagerN::add()", "size of stoich and species arrays differ");
         }
+        for (size_t n = 0; n < k.size(); n++) {
+            m_coeffs.push_back({double(k[n]), double(rxn), stoich[n]});
+            m_orderCoeffs.push_back({double(k[n]), double(rxn), order[n]});
+        }
+        m_sparseOk = false;
+        m_orderOk = false;
         bool frac = false;
         for (size_t n = 0; n < stoich.size(); n++) {
             if (fmod(stoich[n], 1.0) || stoich[n] != order[n]) {
@@ -615,6 +636,31 @@ public:
         }
     }
 
+    //! Reaction-major table of the reaction orders
+    /*!
+     * Row i of the returned structure lists, as (species index, order)
+     * pairs, the factors of reaction i's concentration product: entries
+     * [start[i], start[i+1]) hold the species index in `index` and the order
+     * in `value`. Repeated species are merged by summing their orders, and
+     * reactions with no entries (such as irreversible reactions in a
+     * reverse-product manager) have empty rows. This gives callers a
+     * per-reaction view of the same product that multiply() accumulates in
+     * pattern-grouped passes, so the rate of a single reaction can be
+     * assembled in one loop without sweeping the full rate arrays.
+     *
+     * The table is rebuilt on the first call after a reaction is added.
+     *
+     * @param nRxns  total number of reactions in the mechanism, which fixes
+     *     the number of rows
+     */
+    const Compressed& reactionOrders(size_t nRxns) const {
+        if (!m_orderOk || m_orderCsc.start.size() != nRxns + 1) {
+            compressOrders(nRxns);
+            m_orderOk = true;
+        }
+        return m_orderCsc;
+    }
+
     void multiply(const doublereal* input, doublereal* output) const {
         _multiply(m_c1_list.begin(), m_c1_list.end(), input, output);
         _multiply(m_c2_list.begin(), m_c2_list.end(), input, output);
@@ -623,38 +669,163 @@ public:
     }
 
     void incrementSpecies(const doublereal* input, doublereal* output) const {
+#if CT_SPARSE_STOICH
+        spGemv(m_csr, input, output, 1.0);
+#else
         _incrementSpecies(m_c1_list.begin(), m_c1_list.end(), input, output);
         _incrementSpecies(m_c2_list.begin(), m_c2_list.end(), input, output);
         _incrementSpecies(m_c3_list.begin(), m_c3_list.end(), input, output);
         _incrementSpecies(m_cn_list.begin(), m_cn_list.end(), input, output);
+#endif
     }
 
     void decrementSpecies(const doublereal* input, doublereal* output) const {
+#if CT_SPARSE_STOICH
+        spGemv(m_csr, input, output, -1.0);
+#else
         _decrementSpecies(m_c1_list.begin(), m_c1_list.end(), input, output);
         _decrementSpecies(m_c2_list.begin(), m_c2_list.end(), input, output);
         _decrementSpecies(m_c3_list.begin(), m_c3_list.end(), input, output);
         _decrementSpecies(m_cn_list.begin(), m_cn_list.end(), input, output);
+#endif
     }
 
     void incrementReactions(const doublereal* input, doublereal* output) const {
+#if CT_SPARSE_STOICH
+        spGemv(m_csc, input, output, 1.0);
+#else
         _incrementReactions(m_c1_list.begin(), m_c1_list.end(), input, output);
         _incrementReactions(m_c2_list.begin(), m_c2_list.end(), input, output);
         _incrementReactions(m_c3_list.begin(), m_c3_list.end(), input, output);
         _incrementReactions(m_cn_list.begin(), m_cn_list.end(), input, output);
+#endif
     }
 
     void decrementReactions(const doublereal* input, doublereal* output) const {
+#if CT_SPARSE_STOICH
+        spGemv(m_csc, input, output, -1.0);
+#else
         _decrementReactions(m_c1_list.begin(), m_c1_list.end(), input, output);
         _decrementReactions(m_c2_list.begin(), m_c2_list.end(), input, output);
         _decrementReactions(m_c3_list.begin(), m_c3_list.end(), input, output);
         _decrementReactions(m_cn_list.begin(), m_cn_list.end(), input, output);
+#endif
     }
 
 private:
+    //! Accumulate *coeffs*, sorted by (*major*, *minor*), into *mat*
+    void compress(Compressed& mat, size_t major, size_t minor) const {
+        auto coeffs = m_coeffs;
+        std::sort(coeffs.begin(), coeffs.end(),
+            [major, minor](const std::array<double, 3>& a,
+                           const std::array<double, 3>& b) {
+                return std::make_pair(a[major], a[minor])
+                    < std::make_pair(b[major], b[minor]);
+            });
+        size_t nRows = coeffs.empty() ? 0 : size_t(coeffs.back()[major]) + 1;
+        mat.start.assign(nRows + 1, 0);
+        mat.index.clear();
+        mat.value.clear();
+        size_t prevRow = npos;
+        size_t prevCol = npos;
+        for (const auto& c : coeffs) {
+            size_t row = size_t(c[major]);
+            size_t col = size_t(c[minor]);
+            if (row == prevRow && col == prevCol) {
+                // merge duplicate entries, such as both sides of M + M = M2
+                mat.value.back() += c[2];
+            } else {
+                mat.index.push_back(col);
+                mat.value.push_back(c[2]);
+                mat.start[row + 1]++;
+                prevRow = row;
+                prevCol = col;
+            }
+        }
+        for (size_t r = 0; r < nRows; r++) {
+            mat.start[r+1] += mat.start[r];
+        }
+    }
+
+    //! Accumulate `scale * M * input` into *output*, where `M` is the
+    //! compressed matrix *mat*. Each row reduction is a dense dot product
+    //! over that row's entries, which vectorizes and can be threaded.
+    void spGemv(const Compressed& mat, const doublereal* input,
+                doublereal* output, double scale) const {
+        if (!m_sparseOk) {
+            compress(m_csr, 0, 1);
+            compress(m_csc, 1, 0);
+            m_sparseOk = true;
+        }
+        for (size_t r = 0; r + 1 < mat.start.size(); r++) {
+            doublereal sum = 0.0;
+            for (size_t n = mat.start[r]; n < mat.start[r+1]; n++) {
+                sum += mat.value[n] * input[mat.index[n]];
+            }
+            output[r] += scale * sum;
+        }
+    }
+
     std::vector<C1> m_c1_list;
     std::vector<C2> m_c2_list;
     std::vector<C3> m_c3_list;
     std::vector<C_AnyN> m_cn_list;
+
+    //! (species, reaction, stoichiometric coefficient) triplets collected by
+    //! add(), from which the compressed matrices are (re)built on demand
+    std::vector<std::array<double, 3>> m_coeffs;
+
+    //! Rebuild the reaction-major order table; see reactionOrders()
+    void compressOrders(size_t nRxns) const {
+        auto coeffs = m_orderCoeffs;
+        std::sort(coeffs.begin(), coeffs.end(),
+            [](const std::array<double, 3>& a,
+               const std::array<double, 3>& b) {
+                return std::make_pair(a[1], a[0])
+                    < std::make_pair(b[1], b[0]);
+            });
+        m_orderCsc.start.assign(nRxns + 1, 0);
+        m_orderCsc.index.clear();
+        m_orderCsc.value.clear();
+        size_t prevRow = npos;
+        size_t prevCol = npos;
+        for (const auto& c : coeffs) {
+            size_t row = size_t(c[1]);
+            size_t col = size_t(c[0]);
+            if (row == prevRow && col == prevCol) {
+                // c^a * c^b = c^(a+b) for repeated species
+                m_orderCsc.value.back() += c[2];
+            } else {
+                m_orderCsc.index.push_back(col);
+                m_orderCsc.value.push_back(c[2]);
+                m_orderCsc.start[row + 1]++;
+                prevRow = row;
+                prevCol = col;
+            }
+        }
+        for (size_t r = 0; r < nRxns; r++) {
+            m_orderCsc.start[r+1] += m_orderCsc.start[r];
+        }
+    }
+
+    //! Species-major (CSR) form of the stoichiometric coefficient matrix
+    mutable Compressed m_csr;
+
+    //! Reaction-major (CSC) form of the stoichiometric coefficient matrix
+    mutable Compressed m_csc;
+
+    //! true if #m_csr and #m_csc are up to date with #m_coeffs
+    mutable bool m_sparseOk;
+
+    //! (species, reaction, order) triplets collected by add(), from which
+    //! the reaction-major order table is (re)built on demand
+    std::vector<std::array<double, 3>> m_orderCoeffs;
+
+    //! Reaction-major order table; see reactionOrders()
+    mutable Compressed m_orderCsc;
+
+    //! true if #m_orderCsc is up to date with #m_orderCoeffs
+    mutable bool m_orderOk;
 };
 
 }
@@ -24,22 +24,32 @@ public:
         m_reaction_index.push_back(rxnNumber);
         m_default.push_back(dflt);
 
-        m_species.emplace_back();
-        m_eff.emplace_back();
         for (const auto& eff : enhanced) {
             assert(eff.first != npos);
-            m_species.back().push_back(eff.first);
-            m_eff.back().push_back(eff.second - dflt);
+            m_species.push_back(eff.first);
+            m_eff.push_back(eff.second - dflt);
         }
+        m_offsets.push_back(m_eff.size());
     }
 
-    void update(const vector_fp& conc, double ctot, double* work) {
-        for (size_t i = 0; i < m_species.size(); i++) {
+    void update(const double* conc, double ctot, double* work) {
+        // Start from the default-efficiency contribution, which is the same
+        // for every species and only requires the total concentration. This
+        // loop vectorizes, and is all that is needed for reactions whose
+        // efficiencies are all equal to the default.
+        for (size_t i = 0; i < m_default.size(); i++) {
+            work[i] = m_default[i] * ctot;
+        }
+
+        // Apply the deviations from the default efficiency, which are stored
+        // in compressed sparse row form: the entries for reaction i occupy
+        // the range [m_offsets[i], m_offsets[i+1]) of the flat arrays.
+        for (size_t i = 0; i < m_default.size(); i++) {
             double sum = 0.0;
-            for (size_t j = 0; j < m_species[i].size(); j++) {
-                sum += m_eff[i][j] * conc[m_species[i][j]];
+            for (size_t n = m_offsets[i]; n < m_offsets[i+1]; n++) {
+                sum += m_eff[n] * conc[m_species[n]];
             }
-            work[i] = m_default[i] * ctot + sum;
+            work[i] += sum;
         }
     }
 
@@ -57,11 +67,17 @@ protected:
     //! Indices of third-body reactions within the full reaction array
     std::vector<size_t> m_reaction_index;
 
-    //! m_species[i][j] is the index of the j-th species in reaction i.
-    std::vector<std::vector<size_t> > m_species;
+    //! Offsets into #m_species and #m_eff for each reaction; the entries for
+    //! reaction i occupy the range [m_offsets[i], m_offsets[i+1]).
+    std::vector<size_t> m_offsets{0};
+
+    //! Flat array of the species indices with non-default efficiencies,
+    //! grouped by reaction
+    std::vector<size_t> m_species;
 
-    //! m_eff[i][j] is the efficiency of the j-th species in reaction i.
-    std::vector<vector_fp> m_eff;
+    //! Flat array of the deviations of the efficiencies from the default
+    //! efficiency of the corresponding reaction, grouped by reaction
+    vector_fp m_eff;
 
     //! The default efficiency for each reaction
     vector_fp m_default;
@@ -126,6 +126,11 @@ namespace Cantera
  *  Damping is based on a "delta damping" technique. The solution unknowns
  *  are not allowed to vary too much between iterations.
  *
+ *  The Jacobian is lagged: the finite-difference evaluation is reused over
+ *  several Newton iterations (with the pseudo-transient diagonal shifted to
+ *  the current time step) and only recomputed when it ages out or when the
+ *  damping coefficient indicates that convergence has slowed.
+ *
  *  `EXTRA_ACCURACY`: A constant that is the ratio of the required update norm
  *  in this Newton iteration compared to that in the nonlinear solver. A value
  *  of 0.1 is used so surface species are safely overconverged.
@@ -503,6 +508,30 @@ private:
     //! Newton's method.
     DenseMatrix m_Jac;
 
+    //! Unfactored copy of the most recently evaluated Jacobian
+    /*!
+     *  The linear solve factors #m_Jac in place, so this copy is kept so
+     *  that the finite-difference Jacobian evaluation can be lagged over
+     *  several Newton iterations. Restored into #m_Jac on iterations where
+     *  the Jacobian is reused.
+     */
+    DenseMatrix m_JacSave;
+
+    //! Number of Newton iterations the saved Jacobian has been reused for
+    int m_jacAge;
+
+    //! Maximum number of Newton iterations a Jacobian may be reused
+    //! before it is reevaluated
+    int m_jacMaxAge;
+
+    //! Value of 1/deltaT at which #m_JacSave was evaluated
+    /*!
+     *  Zero for a steady-state evaluation. Used to shift the
+     *  pseudo-transient contribution on the diagonal of a reused Jacobian
+     *  to the current value of the time step.
+     */
+    doublereal m_jacInvDt;
+
 public:
     int m_ioflag;
 };
@@ -142,14 +142,88 @@ public:
      */
     int factor();
 
+    //! Apply a rank-one update \f$ A \mathrel{+}= u v^T \f$ to the matrix and
+    //! its factorization.
+    /*!
+     * Instead of triggering a full O(N b^2) refactorization, the existing
+     * factorization is extended with a Sherman-Morrison correction that is
+     * applied during subsequent solves at O(N) cost. This is intended for
+     * Newton solvers that update a stale Jacobian at a few grid points. Both
+     * `u` and `v` are typically sparse; every nonzero product element
+     * u[i]*v[j] must lie within the bandwidth.
+     *
+     * The update is also folded into the stored matrix data, so mult() and a
+     * later full factor() see the updated matrix. If the correction is
+     * numerically singular, the matrix is instead marked unfactored and the
+     * next solve performs a full factorization.
+     *
+     * @param u  left update vector (length = nColumns())
+     * @param v  right update vector (length = nColumns())
+     * @returns 0 on success; 1 if the correction was singular and a full
+     *     refactorization was scheduled instead
+     */
+    int rankOneUpdate(const doublereal* u, const doublereal* v);
+
+    //! Apply a rank-k update \f$ A \mathrel{+}= U V^T \f$ as successive
+    //! rank-one updates.
+    /*!
+     * @param k  number of update columns
+     * @param u  matrix U, stored column-major (size = nColumns() * k)
+     * @param v  matrix V, stored column-major (size = nColumns() * k)
+     * @returns 0 on success; 1 if any correction was singular and a full
+     *     refactorization was scheduled instead
+     */
+    int rankUpdate(size_t k, const doublereal* u, const doublereal* v);
+
+    //! Enable or disable the mixed-precision factorization path
+    /*!
+     * When enabled, factor() computes the LU factorization in single
+     * precision (SGBTRF), halving the flops and memory traffic of the
+     * banded factor, and solve() recovers double accuracy with a few steps
+     * of iterative refinement against the double-precision matrix data.
+     * This is intended for damped Newton iterations and preconditioning,
+     * where the factorization only needs to be an approximate inverse; it
+     * is not appropriate for matrices with condition numbers approaching
+     * 1/FLT_EPSILON, for which the refinement may stall. Rank-one updated
+     * solves skip the refinement and return the plain Sherman-Morrison
+     * corrected solution. Only available when Cantera is built against
+     * LAPACK; otherwise the flag is ignored.
+     */
+    void setMixedPrecision(bool flag = true) {
+        if (flag != m_mixed_precision) {
+            m_mixed_precision = flag;
+            m_factored = false;
+        }
+    }
+
+    //! True if factor() uses the single-precision path.
+    //! @see setMixedPrecision()
+    bool mixedPrecision() const {
+        return m_mixed_precision;
+    }
+
+    //! Epoch counter for the factorization.
+    /*!
+     * Incremented whenever the factorization changes, either by a full
+     * factor() or by a rank update. Consumers holding data derived from a
+     * particular factorization can compare epochs to detect staleness.
+     */
+    size_t factorEpoch() const {
+        return m_factorEpoch;
+    }
+
     //! Solve the matrix problem Ax = b
     /*!
-     * @param b  INPUT RHS of the problem
-     * @param x  OUTPUT solution to the problem
+     * @param b     INPUT RHS of the problem, stored column-by-column when
+     *              *nrhs* > 1
+     * @param x     OUTPUT solution to the problem, same layout as `b`
+     * @param nrhs  Number of right hand sides to solve
+     * @param ldb   Leading dimension of `b` and `x`. Default is nColumns()
      * @return a success flag. 0 indicates a success; ~0 indicates some error
      *     occurred, see the LAPACK documentation
      */
-    int solve(const doublereal* const b, doublereal* const x);
+    int solve(const doublereal* const b, doublereal* const x,
+              size_t nrhs=1, size_t ldb=0);
 
     //! Solve the matrix problem Ax = b
     /*!
@@ -294,6 +368,37 @@ protected:
     //! Extra dp work array needed - size = 3n
     vector_fp work_;
 
+    //! A Sherman-Morrison correction from rankOneUpdate()
+    struct RankOneUpdate {
+        vector_fp w; //!< solution of the updated system for the left vector
+        vector_fp v; //!< right update vector
+        doublereal denom; //!< capacitance, \f$ 1 + v^T w \f$
+    };
+
+    //! Corrections applied on top of the stored factorization, in the order
+    //! they were added. Cleared by factor().
+    std::vector<RankOneUpdate> m_updates;
+
+    //! Epoch counter for the factorization. @see factorEpoch()
+    size_t m_factorEpoch;
+
+    //! If true, factor in single precision and refine on solve.
+    //! @see setMixedPrecision()
+    bool m_mixed_precision = false;
+
+    //! Single-precision factorization. @see setMixedPrecision()
+    std::vector<float> m_lu32;
+
+    //! Single-precision right-hand-side scratch for the mixed path
+    std::vector<float> m_b32;
+
+    //! Solution and residual scratch for the iterative refinement
+    vector_fp m_refine_x, m_refine_r;
+
+    //! Solve using the single-precision factors with iterative refinement.
+    //! Arguments are as for solve(). @see setMixedPrecision()
+    void solveMixed(doublereal* b, size_t nrhs, size_t ldb);
+
     int m_info;
 };
 
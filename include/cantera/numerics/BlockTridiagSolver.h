@@ -0,0 +1,91 @@
+//! @file BlockTridiagSolver.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_BLOCKTRIDIAGSOLVER_H
+#define CT_BLOCKTRIDIAGSOLVER_H
+
+#include "cantera/numerics/eigen_dense.h"
+
+namespace Cantera
+{
+
+class BandMatrix;
+
+//! Direct solver for block tridiagonal systems with dense blocks.
+/*!
+ * The Jacobian of a multi-domain 1D problem is block tridiagonal when the
+ * unknowns are grouped by grid point: the residual at a grid point depends
+ * only on the solution at that point and at its two neighbors. This class
+ * factors such a matrix with the block Thomas algorithm, treating each block
+ * as a dense matrix, so that the elimination proceeds through dense
+ * matrix-matrix products instead of the scalar operations of a general
+ * banded factorization. The blocks may have different sizes, as happens when
+ * domains with different numbers of solution components are linked together;
+ * blocks of size zero are permitted and simply skipped.
+ *
+ * The matrix is supplied in banded form (as assembled by MultiJac), and only
+ * the entries belonging to the block tridiagonal structure are referenced.
+ *
+ * @ingroup onedim
+ */
+class BlockTridiagSolver
+{
+public:
+    BlockTridiagSolver() {}
+
+    //! Set the sizes of the diagonal blocks. Row/column *i* of the full
+    //! matrix belongs to block *p* when it falls in the range covered by
+    //! `blockSizes[p]`. Invalidates any existing factorization.
+    void resize(const std::vector<size_t>& blockSizes);
+
+    //! Number of rows of the full matrix
+    size_t size() const {
+        return m_size;
+    }
+
+    //! Compute the block LU factorization of the block tridiagonal part of
+    //! *A*. Throws an exception if a pivot block is singular.
+    void factor(const BandMatrix& A);
+
+    //! Solve A x = b using the factorization computed by the last call to
+    //! factor(). The arrays *b* and *x* may refer to the same storage.
+    void solve(const double* b, double* x);
+
+    //! Returns true if a factorization from factor() is available
+    bool factored() const {
+        return m_factored;
+    }
+
+protected:
+    //! Sizes of the diagonal blocks
+    std::vector<size_t> m_blockSizes;
+
+    //! Row/column offset of the start of each block, length nBlocks() + 1
+    std::vector<size_t> m_offsets;
+
+    //! Number of rows of the full matrix
+    size_t m_size = 0;
+
+    //! Inverses of the pivot blocks produced by the block elimination
+    std::vector<Eigen::MatrixXd> m_Dinv;
+
+    //! Elimination multipliers: block *p* of the unit lower block bidiagonal
+    //! factor, coupling block *p* to block *p* - 1
+    std::vector<Eigen::MatrixXd> m_W;
+
+    //! Superdiagonal blocks of the matrix, coupling block *p* to block
+    //! *p* + 1
+    std::vector<Eigen::MatrixXd> m_U;
+
+    //! Work vector used by solve()
+    Eigen::VectorXd m_work;
+
+    //! True if a factorization is available
+    bool m_factored = false;
+};
+
+}
+
+#endif
@@ -42,11 +42,20 @@ public:
     virtual double& solution(size_t k);
     virtual double* solution();
     virtual double* derivative(double tout, int n);
+    virtual double time() const {
+        return m_time;
+    }
+    virtual bool stoppedAtRoot() const {
+        return m_stoppedAtRoot;
+    }
+    virtual void getRootInfo(std::vector<int>& roots);
     virtual int lastOrder() const;
     virtual int nEquations() const {
         return static_cast<int>(m_neq);
     }
     virtual int nEvals() const;
+    virtual AnyMap memoryReport() const;
+    virtual AnyMap solverStats() const;
     virtual void setMaxOrder(int n) {
         m_maxord = n;
     }
@@ -56,6 +65,7 @@ public:
     virtual void setMaxSteps(int nmax);
     virtual int maxSteps();
     virtual void setMaxErrTestFails(int n);
+    virtual void setMaxStepsBetweenJac(int nmax);
     virtual void setBandwidth(int N_Upper, int N_Lower) {
         m_mupper = N_Upper;
         m_mlower = N_Lower;
@@ -65,6 +75,46 @@ public:
     }
     virtual double sensitivity(size_t k, size_t p);
 
+    //! @copydoc Integrator::setAdjointMode
+    /*!
+     * Uses CVODES adjoint sensitivity analysis: the forward integration
+     * runs through CVodeF, which checkpoints the solution so the backward
+     * problem of integrateAdjoint() can reconstruct the forward states.
+     */
+    virtual void setAdjointMode(bool yes=true);
+
+    //! @copydoc Integrator::integrateAdjoint
+    /*!
+     * Integrates \f$ \dot{\lambda} = -J^T \lambda \f$ backward from the
+     * current time using the forward states checkpointed by CVodeF,
+     * accumulating the quadratures
+     * \f$ q_i = \int \lambda^T \partial f/\partial p_i \, dt \f$, which are
+     * the objective gradient for parameters that do not affect the initial
+     * state. The backward right-hand sides are supplied by
+     * FuncEval::evalAdjointRhs() and FuncEval::evalAdjointQuad(). The cost
+     * is roughly one additional forward-sized integration regardless of
+     * the number of parameters.
+     */
+    virtual void integrateAdjoint(double* lambda, double* grad);
+
+    //! @copydoc Integrator::saveCheckpoint
+    /*!
+     * The checkpoint stores the solution vector, the current time, the last
+     * step size and order, and the sensitivity solution vectors if
+     * sensitivity analysis is enabled. CVODES provides no public access to
+     * its internal Nordsieck history array, so the history itself cannot be
+     * serialized; instead, loadCheckpoint() reinitializes the integrator at
+     * the saved state and passes the saved step size back through
+     * CVodeSetInitStep, so that the method rebuilds its history within a few
+     * steps instead of re-doing the startup transient from a small initial
+     * step.
+     */
+    virtual void saveCheckpoint(std::vector<char>& data);
+
+    //! @copydoc Integrator::loadCheckpoint
+    virtual double loadCheckpoint(const std::vector<char>& data,
+                                  FuncEval& func);
+
     //! Returns a string listing the weighted error estimates associated
     //! with each solution component.
     //! This information can be used to identify which variables are
@@ -79,6 +129,13 @@ protected:
     //! during integrator initialization or reinitialization.
     void applyOptions();
 
+    //! Applies only the scalar solver options (maximum order, step limits,
+    //! and similar), leaving the current linear solver in place. Used by
+    //! reinitialize() for value-only changes, where the linear solver
+    //! workspace and Jacobian structure can be retained instead of being
+    //! torn down and rebuilt.
+    void applyScalarOptions();
+
 private:
     void sensInit(double t0, FuncEval& func);
 
@@ -86,9 +143,29 @@ private:
     void* m_cvode_mem;
     void* m_linsol; //!< Sundials linear solver object
     void* m_linsol_matrix; //!< matrix used by Sundials
+
+    //! Problem size and problem type for which the current linear solver
+    //! was created; reinitialize() retains the solver when neither has
+    //! changed
+    size_t m_linsol_neq;
+    int m_linsol_type;
+
+    //! If true, run the forward integration through CVodeF so the adjoint
+    //! problem of integrateAdjoint() can be solved (see setAdjointMode())
+    bool m_adjoint;
+    int m_whichB; //!< identifier of the CVODES backward problem
+    int m_ncheck; //!< number of checkpoints written by CVodeF
+    N_Vector m_yB; //!< adjoint variables of the backward problem
+    N_Vector m_qB; //!< adjoint quadratures (the parameter gradient)
+    void* m_linsolB; //!< linear solver for the backward problem
+    void* m_linsol_matrixB; //!< matrix used by the backward linear solver
     FuncEval* m_func;
     double m_t0;
     double m_time; //!< The current integrator time
+
+    //! True when the last CVode call returned at a located root instead of
+    //! the requested output time
+    bool m_stoppedAtRoot;
     N_Vector m_y, m_abstol;
     N_Vector m_dky;
     int m_type;
@@ -102,6 +179,7 @@ private:
     double m_hmax, m_hmin;
     int m_maxsteps;
     int m_maxErrTestFails;
+    int m_maxStepsBetweenJac;
     N_Vector* m_yS;
     size_t m_np;
     int m_mupper, m_mlower;
@@ -64,8 +64,15 @@ public:
     DenseMatrix(size_t n, size_t m, doublereal v = 0.0);
 
     DenseMatrix(const DenseMatrix& y);
+
+    //! Move constructor. The moved-from matrix is left empty.
+    DenseMatrix(DenseMatrix&& y) noexcept;
+
     DenseMatrix& operator=(const DenseMatrix& y);
 
+    //! Move assignment. The moved-from matrix is left empty.
+    DenseMatrix& operator=(DenseMatrix&& y) noexcept;
+
     //! Resize the matrix
     /*!
      * Resize the matrix to n rows by m cols.
@@ -76,6 +83,18 @@ public:
      */
     void resize(size_t n, size_t m, doublereal v = 0.0);
 
+    //! Resize the matrix without preserving its contents
+    /*!
+     * All data is lost; every element of the resized matrix is set to \c v.
+     * Cheaper than resize() when the matrix is about to be refilled anyway,
+     * since the old elements are not copied into any newly allocated storage.
+     *
+     * @param n  New number of rows
+     * @param m  New number of columns
+     * @param v  Fill value. defaults to zero.
+     */
+    void resizeDiscard(size_t n, size_t m, doublereal v = 0.0);
+
     virtual doublereal* const* colPts();
 
     //! Return a const vector of const pointers to the columns
@@ -0,0 +1,152 @@
+/**
+ *  @file ExpIntegrator.h
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_EXPINTEGRATOR_H
+#define CT_EXPINTEGRATOR_H
+
+#include "cantera/numerics/Integrator.h"
+#include "cantera/numerics/DenseMatrix.h"
+#include "cantera/base/ctexceptions.h"
+
+namespace Cantera
+{
+
+//! Adaptive exponential integrator for moderately stiff systems
+/*!
+ * Integrates the system with the exponential Rosenbrock-Euler method,
+ * \f[
+ *     y_{n+1} = y_n + h \, \varphi_1(h J) f(y_n),
+ * \f]
+ * where \f$ \varphi_1(z) = (e^z - 1)/z \f$ and \f$ J \f$ is the Jacobian at
+ * the current state. The action of \f$ \varphi_1(hJ) \f$ on the right-hand
+ * side is approximated in a Krylov subspace built by Arnoldi iteration, with
+ * the Jacobian-vector products formed matrix-free from finite differences of
+ * the right-hand side, so no Jacobian is ever stored or factored. The small
+ * projected \f$ \varphi_1 \f$ is evaluated exactly through the exponential
+ * of an augmented Hessenberg matrix.
+ *
+ * Because the linearized dynamics are integrated exactly, the step size is
+ * limited by the nonlinearity of the problem rather than by the stiff linear
+ * time scales that bound an explicit method, and there is no nonlinear
+ * solve as in BDF. An accepted step costs one right-hand-side evaluation
+ * plus one per Krylov vector. The step size is controlled from the Arnoldi
+ * residual error estimate using the same weighted RMS norm as CVODES.
+ *
+ * Root finding and sensitivity analysis are not supported. Type "EXP" in
+ * newIntegrator().
+ *
+ * @ingroup odeGroup
+ */
+class ExpIntegrator : public Integrator
+{
+public:
+    //! Constructor.
+    /*!
+     * @param maxKrylov  Maximum dimension of the Krylov subspace built for
+     *     each step
+     */
+    explicit ExpIntegrator(size_t maxKrylov=30);
+    virtual void setTolerances(double reltol, size_t n, double* abstol);
+    virtual void setTolerances(double reltol, double abstol);
+    virtual void initialize(double t0, FuncEval& func);
+    virtual void reinitialize(double t0, FuncEval& func);
+    virtual void integrate(double tout);
+    virtual doublereal step(double tout);
+    virtual double& solution(size_t k);
+    virtual double* solution();
+    virtual double time() const {
+        return m_time;
+    }
+    virtual int lastOrder() const {
+        return 2;
+    }
+    virtual int nEquations() const {
+        return static_cast<int>(m_neq);
+    }
+    virtual int nEvals() const {
+        return m_nevals;
+    }
+    virtual AnyMap memoryReport() const;
+    virtual void setMaxStepSize(double hmax);
+    virtual void setMinStepSize(double hmin);
+    virtual void setMaxSteps(int nmax);
+    virtual int maxSteps();
+    virtual void setMaxErrTestFails(int n) {
+        // failed error tests are retried with a reduced step inside
+        // oneStep(), with no limit short of the minimum step size
+    }
+
+    //! Number of steps taken since the last call to initialize()
+    int nSteps() const {
+        return m_nsteps;
+    }
+
+    //! Size of the last accepted step
+    double lastStep() const {
+        return m_hlast;
+    }
+
+protected:
+    //! Take one adaptive step, retrying with a smaller step size until the
+    //! Krylov error test passes. The step is clamped so that the current
+    //! time never passes *tmax*.
+    void oneStep(double tmax);
+
+    //! Build the Krylov basis #m_V and Hessenberg matrix #m_H for the
+    //! Jacobian at the current state, starting from the normalized
+    //! right-hand side. Returns the subspace dimension actually built,
+    //! which is smaller than the maximum on happy breakdown.
+    size_t arnoldi(double t, double beta);
+
+    //! Evaluate \f$ \varphi_1(h H) e_1 \f$ for the leading *m* by *m* block
+    //! of the Hessenberg matrix into *phi*, through the exponential of the
+    //! augmented matrix \f$ [\,hH, e_1; 0, 0\,] \f$ computed by scaling and
+    //! squaring of its Taylor series.
+    void phi1(double h, size_t m, vector_fp& phi);
+
+    //! Weighted RMS norm of the error estimate in #m_err, with weights
+    //! formed from the tolerances and the current and trial solutions
+    double errorNorm() const;
+
+    //! Evaluate the right-hand side into *ydot*
+    void evalRhs(double t, double* y, double* ydot);
+
+    FuncEval* m_func = nullptr;
+    size_t m_neq = 0;
+
+    //! Maximum Krylov subspace dimension per step
+    size_t m_krylovMax;
+
+    double m_time = 0.0;
+    double m_h = 0.0; //!< next step size to attempt; 0 until the first step
+    double m_hlast = 0.0;
+    double m_hmax = 0.0; //!< maximum step size; 0 means no limit
+    double m_hmin = 0.0;
+    double m_reltol = 1.0e-9;
+    double m_abstols = 1.0e-15; //!< scalar absolute tolerance
+    vector_fp m_abstol; //!< per-component tolerances; empty if scalar
+    int m_maxsteps = 20000;
+    int m_nevals = 0;
+    int m_nsteps = 0;
+
+    //! If true, #m_f holds the right-hand side at the current state
+    bool m_haveF = false;
+
+    vector_fp m_y, m_ynew, m_err, m_ytmp;
+    vector_fp m_f; //!< right-hand side at the current state
+
+    std::vector<vector_fp> m_V; //!< Krylov basis vectors, m_krylovMax + 1
+    DenseMatrix m_H; //!< Hessenberg projection of the Jacobian
+    vector_fp m_phi; //!< projected \f$ \varphi_1 \f$ vector
+
+    //! Work matrices for the scaled-and-squared augmented exponential
+    DenseMatrix m_expA, m_expT, m_expP;
+};
+
+}
+
+#endif
@@ -0,0 +1,105 @@
+/**
+ *  @file Func1Program.h
+ *  Flattened, linearized form of a Func1 expression tree
+ *  (see \link Cantera::Func1Program Func1Program\endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_FUNC1PROGRAM_H
+#define CT_FUNC1PROGRAM_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <vector>
+
+namespace Cantera
+{
+
+class Func1;
+
+//! A Func1 expression tree compiled to a linear sequence of stack operations
+/*!
+ * Evaluating a Func1 tree costs one virtual call per node plus the pointer
+ * chasing of the recursive descent, which adds up for the deep composite
+ * expressions used as time-dependent wall velocities, heat fluxes, and flow
+ * controller functions. This class lowers a tree once into a flat list of
+ * opcodes executed by a small stack machine, so repeated evaluation runs a
+ * single tight loop with no recursion and no virtual dispatch for the
+ * elementary node types. Subexpressions that do not depend on the argument
+ * are folded to constants during compilation.
+ *
+ * Node types without a dedicated opcode (tabulated data, Fourier series,
+ * and the like) are kept as direct calls to the corresponding node, so any
+ * tree can be compiled. The program holds plain pointers into the original
+ * tree for such nodes and therefore must not outlive it; this mirrors the
+ * lifetime contract of storing a `Func1*` directly.
+ */
+class Func1Program
+{
+public:
+    //! Create an empty program; compiled() returns false until compile() is
+    //! called.
+    Func1Program() {}
+
+    //! Create a program by compiling *f*
+    explicit Func1Program(const Func1& f) {
+        compile(f);
+    }
+
+    //! Compile *f*, replacing any previously compiled program
+    void compile(const Func1& f);
+
+    //! True when a program has been compiled
+    bool compiled() const {
+        return !m_ops.empty();
+    }
+
+    //! Evaluate the compiled function at *t*
+    double eval(double t) const;
+
+private:
+    enum OpCode {
+        OP_CONST, //!< push a constant
+        OP_SIN, //!< push sin(c * arg)
+        OP_COS, //!< push cos(c * arg)
+        OP_EXP, //!< push exp(c * arg)
+        OP_POW, //!< push pow(arg, c)
+        OP_CALL, //!< push f->eval(arg)
+        OP_ADD, OP_SUB, OP_MUL, OP_DIV, //!< binary operations on the stack
+        OP_TIMESC, //!< scale the top of the stack by a constant
+        OP_PLUSC, //!< shift the top of the stack by a constant
+        OP_SWAPARG, //!< exchange the top of the stack with the argument
+        OP_RESTOREARG //!< pop the saved argument from under the result
+    };
+
+    struct Op {
+        OpCode code;
+        double c;
+        const Func1* f;
+    };
+
+    //! Append the operations evaluating *f* to the program, folding
+    //! argument-independent subexpressions to OP_CONST
+    void emit(const Func1& f);
+
+    //! Append a single operation
+    void push(OpCode code, double c=0.0, const Func1* f=nullptr) {
+        m_ops.push_back({code, c, f});
+    }
+
+    //! True when the operations from *start* to the end of the program
+    //! reduce to a single constant push
+    bool isConstFrom(size_t start) const {
+        return m_ops.size() == start + 1 && m_ops[start].code == OP_CONST;
+    }
+
+    //! Maximum value-stack depth supported by eval()
+    static const size_t c_maxStack = 64;
+
+    std::vector<Op> m_ops;
+};
+
+}
+#endif
@@ -54,6 +54,215 @@ public:
         throw NotImplementedError("FuncEval::getState");
     }
 
+    //! Returns true if this evaluator supplies the preconditioner used by
+    //! iterative (Krylov) linear solvers, that is, if preconditionerSetup()
+    //! and preconditionerSolve() are implemented.
+    virtual bool preconditionerSupported() const {
+        return false;
+    }
+
+    //! Update the data used by the preconditioner.
+    /*!
+     * Called by the integrator before a sequence of calls to
+     * preconditionerSolve(), and only when the integrator determines that the
+     * current preconditioner is too old to be reused. The preconditioner
+     * should approximate \f$ M = I - \gamma J \f$, where
+     * \f$ J = \partial\dot{y}/\partial y\f$.
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[in] gamma the scaled timestep \f$ \gamma \f$
+     */
+    virtual void preconditionerSetup(double t, double* y, double gamma) {
+        throw NotImplementedError("FuncEval::preconditionerSetup");
+    }
+
+    //! Solve the linear system \f$ M z = r \f$, where *M* is the
+    //! preconditioner matrix formed by preconditionerSetup().
+    /*!
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[in] r right-hand side vector, length neq()
+     * @param[out] z output vector, length neq()
+     */
+    virtual void preconditionerSolve(double t, double* y, double* r,
+                                     double* z) {
+        throw NotImplementedError("FuncEval::preconditionerSolve");
+    }
+
+    //! Preconditioner setup using return code to indicate status, analogous
+    //! to eval_nothrow(). Called from C-based integrators such as CVODES.
+    //! @returns 0 for success; 1 after a potentially-recoverable error; -1
+    //!     after an unrecoverable error.
+    int preconditioner_setup_nothrow(double t, double* y, double gamma);
+
+    //! Preconditioner solve using return code to indicate status; see
+    //! preconditioner_setup_nothrow().
+    int preconditioner_solve_nothrow(double t, double* y, double* r,
+                                     double* z);
+
+    //! Returns true if this evaluator can compute the sensitivity equation
+    //! right-hand sides directly, that is, if evalSensRhs() is implemented.
+    virtual bool sensRhsSupported() const {
+        return false;
+    }
+
+    //! Evaluate the right-hand sides of all sensitivity equations at once.
+    /*!
+     * Computes \f$ \dot{s}_i = J s_i + \partial f/\partial p_i \f$ for all
+     * nparams() parameters, where \f$ J = \partial f/\partial y \f$.
+     * Batching the evaluation lets the Jacobian be formed once per step and
+     * reused for every parameter, instead of the full right-hand-side
+     * evaluation per parameter per step that the integrator's internal
+     * difference quotients cost.
+     * @param[in] t time
+     * @param[in] y solution vector, length neq()
+     * @param[in] ydot time derivative of *y*, length neq()
+     * @param[in] s array of nparams() sensitivity vectors, each length neq()
+     * @param[out] sdot array of nparams() sensitivity derivative vectors,
+     *     each length neq()
+     */
+    virtual void evalSensRhs(double t, double* y, double* ydot,
+                             double* const* s, double* const* sdot) {
+        throw NotImplementedError("FuncEval::evalSensRhs");
+    }
+
+    //! Sensitivity right-hand-side evaluation using return code to indicate
+    //! status, analogous to eval_nothrow(). Called from C-based integrators
+    //! such as CVODES.
+    //! @returns 0 for success; 1 after a potentially-recoverable error; -1
+    //!     after an unrecoverable error.
+    int eval_sens_rhs_nothrow(double t, double* y, double* ydot,
+                              double* const* s, double* const* sdot);
+
+    //! Returns true if this evaluator can compute the adjoint equation
+    //! right-hand sides, that is, if evalAdjointRhs() and evalAdjointQuad()
+    //! are implemented.
+    virtual bool adjointSupported() const {
+        return false;
+    }
+
+    //! Evaluate the right-hand side of the adjoint equation.
+    /*!
+     * Computes \f$ \dot{\lambda} = -J^T \lambda \f$, where
+     * \f$ J = \partial f/\partial y \f$ is evaluated at the forward
+     * solution *y*. Used by the backward integration of adjoint
+     * sensitivity analysis.
+     * @param[in] t time
+     * @param[in] y forward solution vector, length neq()
+     * @param[in] lambda adjoint variables, length neq()
+     * @param[out] lambdaDot time derivative of *lambda*, length neq()
+     */
+    virtual void evalAdjointRhs(double t, double* y, const double* lambda,
+                                double* lambdaDot) {
+        throw NotImplementedError("FuncEval::evalAdjointRhs");
+    }
+
+    //! Evaluate the adjoint quadrature integrands.
+    /*!
+     * Computes \f$ \dot{q}_i = \lambda^T \partial f/\partial p_i \f$ for
+     * all nparams() parameters; the backward integral of these quadratures
+     * is the parameter gradient of the objective.
+     * @param[in] t time
+     * @param[in] y forward solution vector, length neq()
+     * @param[in] lambda adjoint variables, length neq()
+     * @param[out] qdot quadrature integrands, length nparams()
+     */
+    virtual void evalAdjointQuad(double t, double* y, const double* lambda,
+                                 double* qdot) {
+        throw NotImplementedError("FuncEval::evalAdjointQuad");
+    }
+
+    //! Adjoint right-hand-side evaluation using return code to indicate
+    //! status, analogous to eval_nothrow(). Called from C-based integrators
+    //! such as CVODES.
+    //! @returns 0 for success; 1 after a potentially-recoverable error; -1
+    //!     after an unrecoverable error.
+    int eval_adjoint_rhs_nothrow(double t, double* y, const double* lambda,
+                                 double* lambdaDot);
+
+    //! Adjoint quadrature evaluation using return code to indicate status,
+    //! analogous to eval_nothrow().
+    //! @returns 0 for success; 1 after a potentially-recoverable error; -1
+    //!     after an unrecoverable error.
+    int eval_adjoint_quad_nothrow(double t, double* y, const double* lambda,
+                                  double* qdot);
+
+    //! Number of root (event) functions defined by this evaluator
+    /*!
+     * When nonzero, the integrator locates the times at which the functions
+     * evaluated by evalRoots() cross zero, landing on those times exactly
+     * instead of stepping over them.
+     */
+    virtual size_t nRoots() const {
+        return 0;
+    }
+
+    //! Evaluate the root functions.
+    /*!
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[out] gout values of the root functions, length nRoots()
+     */
+    virtual void evalRoots(double t, double* y, double* gout) {
+        throw NotImplementedError("FuncEval::evalRoots");
+    }
+
+    //! Root function evaluation using return code to indicate status,
+    //! analogous to eval_nothrow(). Called from C-based integrators such as
+    //! CVODES.
+    //! @returns 0 for success; -1 after an unrecoverable error.
+    int eval_roots_nothrow(double t, double* y, double* gout);
+
+    //! Returns true if this evaluator can report the sparsity pattern of
+    //! its Jacobian, that is, if getJacobianSparsity() is implemented.
+    virtual bool jacobianSparsitySupported() const {
+        return false;
+    }
+
+    //! Retrieve the Jacobian sparsity pattern.
+    /*!
+     * Appends to *pattern* the (row, column) index pairs of the structurally
+     * nonzero entries of \f$ \partial \dot{y}_i / \partial y_j \f$.
+     * Utilities such as JacobianColoring use the pattern to fill many
+     * columns of a finite-difference Jacobian per call to eval().
+     */
+    virtual void getJacobianSparsity(
+        std::vector<std::pair<size_t, size_t>>& pattern) {
+        throw NotImplementedError("FuncEval::getJacobianSparsity");
+    }
+
+    //! Returns true if this evaluator can assemble the Jacobian of its
+    //! governing equations analytically, that is, if evalDenseJacobian() is
+    //! implemented.
+    virtual bool denseJacobianSupported() const {
+        return false;
+    }
+
+    //! Evaluate the Jacobian of the governing equations.
+    /*!
+     * Fills the dense matrix \f$ J_{ij} = \partial \dot{y}_i / \partial y_j
+     * \f$ in column-major order. Integrators use this in place of their
+     * internal difference quotients, which cost neq() right-hand-side
+     * evaluations per Jacobian.
+     * @param[in] t time
+     * @param[in] y solution vector, length neq()
+     * @param[in] ydot time derivative of *y*, length neq()
+     * @param[out] jac Jacobian entries in column-major order, length
+     *     neq() * neq(), zeroed on entry
+     */
+    virtual void evalDenseJacobian(double t, double* y, double* ydot,
+                                   double* jac) {
+        throw NotImplementedError("FuncEval::evalDenseJacobian");
+    }
+
+    //! Dense Jacobian evaluation using return code to indicate status,
+    //! analogous to eval_nothrow(). Called from C-based integrators such as
+    //! CVODES.
+    //! @returns 0 for success; 1 after a potentially-recoverable error; -1
+    //!     after an unrecoverable error.
+    int eval_dense_jacobian_nothrow(double t, double* y, double* ydot,
+                                    double* jac);
+
     //! Number of equations.
     virtual size_t neq()=0;
 
@@ -68,6 +68,20 @@ public:
      */
     virtual void setBandedLinearSolver(int m_upper, int m_lower);
 
+    //! Set up the problem to use the sparse direct solver (KLU)
+    /*!
+     * The Jacobian is stored in compressed sparse column form and factored
+     * with KLU, so DAE networks with strong sparsity (for example,
+     * FlowReactor-style problems with surface chemistry) factor in O(nnz)
+     * instead of O(N^3). The residual evaluator must implement
+     * ResidJacEval::nJacNonzeros(), ResidJacEval::getJacobianPattern() and
+     * ResidJacEval::evalJacobianSparse(); because KLU has no difference
+     * quotient fallback, the analytical Jacobian formation method is
+     * implied. Requires SUNDIALS 3.0 or newer built with KLU support and
+     * the 'sundials_klu' build option.
+     */
+    virtual void setSparseLinearSolver();
+
     virtual void setMaxOrder(int n);
 
     //! Set the maximum number of time steps
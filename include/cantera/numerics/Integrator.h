@@ -14,6 +14,7 @@
 #include "FuncEval.h"
 
 #include "cantera/base/global.h"
+#include "cantera/base/AnyMap.h"
 
 namespace Cantera
 {
@@ -129,6 +130,29 @@ public:
         return 0.0;
     }
 
+    //! The current value of the independent variable (time). After a call to
+    //! integrate() or step() that stopped at a root of the evaluator's root
+    //! functions, this is the located root time rather than the requested
+    //! output time.
+    virtual double time() const {
+        warn("time");
+        return 0.0;
+    }
+
+    //! True when the last call to integrate() or step() stopped at a root of
+    //! the root functions defined by FuncEval::evalRoots() instead of
+    //! reaching the requested output time.
+    virtual bool stoppedAtRoot() const {
+        return false;
+    }
+
+    //! After stopping at a root, retrieve which root functions were found to
+    //! have crossed zero. On return, *roots* has length FuncEval::nRoots()
+    //! with nonzero entries for the functions with located roots.
+    virtual void getRootInfo(std::vector<int>& roots) {
+        warn("getRootInfo");
+    }
+
     //! The current value of the solution of equation k.
     virtual doublereal& solution(size_t k) {
         warn("solution");
@@ -165,6 +189,30 @@ public:
         return 0;
     }
 
+    //! Report the memory held by the integrator workspaces
+    /*!
+     * Returns an AnyMap with byte counts for the solver's real and integer
+     * work arrays, so the per-instance cost of an integrator can be included
+     * in capacity planning (see Solution::memoryReport()). The base class
+     * implementation returns an empty map.
+     */
+    virtual AnyMap memoryReport() const {
+        return AnyMap();
+    }
+
+    //! Report cumulative performance statistics of the solver
+    /*!
+     * Returns an AnyMap with the counters the solver maintains for the
+     * current problem — steps taken, right-hand-side evaluations, Jacobian
+     * evaluations and factorizations, error test and nonlinear convergence
+     * failures, and the last and average step sizes. The exact set of keys
+     * depends on the integrator; the counters reset when the problem is
+     * (re)initialized. The base class implementation returns an empty map.
+     */
+    virtual AnyMap solverStats() const {
+        return AnyMap();
+    }
+
     //! Set the maximum integration order that will be used.
     virtual void setMaxOrder(int n) {
         warn("setMaxorder");
@@ -205,6 +253,20 @@ public:
         return 0;
     }
 
+    //! Set the maximum number of time-steps the Jacobian used by the linear
+    //! solver may be reused before it is re-evaluated
+    /*!
+     *  Raising this value reduces the number of Jacobian evaluations and
+     *  factorizations at the cost of some extra nonlinear iterations, which
+     *  is usually a good trade for large systems where forming and factoring
+     *  the Jacobian dominates the cost per step.
+     *  @param nmax The maximum Jacobian age, setting this value to zero
+     *              restores the integrator's default heuristic.
+     */
+    virtual void setMaxStepsBetweenJac(int nmax) {
+        warn("setMaxStepsBetweenJac");
+    }
+
     virtual void setBandwidth(int N_Upper, int N_Lower) {
         warn("setBandwidth");
     }
@@ -219,6 +281,47 @@ public:
         return 0.0;
     }
 
+    //! Enable adjoint sensitivity analysis. Must be called before
+    //! initialize(), so the forward integration can checkpoint the states
+    //! that the backward integration interpolates between.
+    virtual void setAdjointMode(bool yes=true) {
+        warn("setAdjointMode");
+    }
+
+    //! Integrate the adjoint system backward from the current time to the
+    //! initial time.
+    /*!
+     * On entry, *lambda* holds the derivative of the objective with respect
+     * to the state at the current (final) time, length nEquations(); on
+     * return it holds the adjoint variables at the initial time. *grad* is
+     * filled with the gradient of the objective with respect to the
+     * sensitivity parameters, length FuncEval::nparams(). Requires
+     * setAdjointMode() to have been enabled before the forward integration.
+     */
+    virtual void integrateAdjoint(double* lambda, double* grad) {
+        warn("integrateAdjoint");
+    }
+
+    //! Serialize the current integrator state to a binary blob, so that a
+    //! later call to loadCheckpoint() can resume the integration.
+    virtual void saveCheckpoint(std::vector<char>& data) {
+        warn("saveCheckpoint");
+    }
+
+    //! Restore the integrator state from a blob written by saveCheckpoint().
+    /*!
+     * The integrator must already have been initialized for a problem of the
+     * same size as the one that wrote the checkpoint.
+     * @param data  checkpoint blob written by saveCheckpoint()
+     * @param func  RHS evaluator object for the system of equations
+     * @returns the simulation time stored in the checkpoint
+     */
+    virtual double loadCheckpoint(const std::vector<char>& data,
+                                  FuncEval& func) {
+        warn("loadCheckpoint");
+        return 0.0;
+    }
+
 private:
     doublereal m_dummy;
     void warn(const std::string& msg) const {
@@ -0,0 +1,106 @@
+/**
+ *  @file JacobianColoring.h
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_JACOBIANCOLORING_H
+#define CT_JACOBIANCOLORING_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class DenseMatrix;
+class FuncEval;
+
+//! Groups structurally independent Jacobian columns so that one perturbed
+//! residual evaluation fills many columns of a finite-difference Jacobian.
+/*!
+ * Two columns may share a perturbation (a "color") when no row of the
+ * Jacobian has a nonzero entry in both; the response of each row to the
+ * combined perturbation is then attributable to exactly one column. The
+ * columns are grouped with a greedy distance-2 coloring of the column
+ * intersection graph. For a banded pattern with lower and upper bandwidths
+ * *kl* and *ku*, this produces kl + ku + 1 groups, so a Jacobian that would
+ * take one residual evaluation per column takes only a bandwidth's worth.
+ *
+ * The sparsity pattern can be taken from FuncEval::getJacobianSparsity()
+ * via addPattern(), or assembled directly with addEntry() and addBanded().
+ */
+class JacobianColoring
+{
+public:
+    //! Construct for an nRows by nCols Jacobian with an empty pattern
+    JacobianColoring(size_t nRows, size_t nCols);
+
+    //! Mark entry (*i*, *j*), that is \f$ \partial F_i/\partial y_j \f$, as
+    //! structurally nonzero
+    void addEntry(size_t i, size_t j);
+
+    //! Mark all entries of a banded pattern with lower bandwidth *kl* and
+    //! upper bandwidth *ku* as structurally nonzero
+    void addBanded(size_t kl, size_t ku);
+
+    //! Add a pattern given as (row, column) index pairs, in the form
+    //! returned by FuncEval::getJacobianSparsity()
+    void addPattern(const std::vector<std::pair<size_t, size_t>>& pattern);
+
+    //! Group the columns into colors. Called automatically by eval() when
+    //! needed; call explicitly after modifying the pattern of a coloring
+    //! that has already been used.
+    void color();
+
+    //! Number of column groups found by color()
+    size_t nColors() const {
+        return m_columnsOfColor.size();
+    }
+
+    //! The columns belonging to each group
+    const std::vector<std::vector<size_t>>& columnsOfColor() const {
+        return m_columnsOfColor;
+    }
+
+    //! Fill *jac* with a finite-difference approximation of the Jacobian of
+    //! *func* at (*t*, *y*), using one call to FuncEval::eval() per column
+    //! group instead of one per column.
+    /*!
+     * Only the structurally nonzero entries of *jac* are written; callers
+     * should treat the rest as zero.
+     *
+     * @param func  evaluator; FuncEval::neq() must equal the number of rows
+     * @param t     time passed to FuncEval::eval()
+     * @param y     state vector, length nCols. Restored on return.
+     * @param ydot  unperturbed residual at (*t*, *y*), length nRows
+     * @param jac   output matrix, resized to nRows by nCols and zeroed
+     * @param rtol  relative component perturbation
+     * @param atol  perturbation floor for components near zero
+     */
+    void eval(FuncEval& func, double t, double* y, const double* ydot,
+              DenseMatrix& jac, double rtol=1.0e-7, double atol=1.0e-12);
+
+protected:
+    size_t m_nRows;
+    size_t m_nCols;
+
+    //! Rows with structurally nonzero entries, per column
+    std::vector<std::vector<size_t>> m_rowsOfColumn;
+
+    //! Color index assigned to each column by color()
+    std::vector<size_t> m_colorOfColumn;
+
+    //! Columns belonging to each color
+    std::vector<std::vector<size_t>> m_columnsOfColor;
+
+    //! True if color() has been run for the current pattern
+    bool m_colored;
+
+    //! Work vector holding the perturbed residual
+    vector_fp m_ydotPerturbed;
+};
+
+}
+
+#endif
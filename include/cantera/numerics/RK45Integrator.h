@@ -0,0 +1,137 @@
+/**
+ *  @file RK45Integrator.h
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_RK45INTEGRATOR_H
+#define CT_RK45INTEGRATOR_H
+
+#include "cantera/numerics/Integrator.h"
+#include "cantera/base/ctexceptions.h"
+
+namespace Cantera
+{
+
+//! Adaptive explicit Runge-Kutta integrator for non-stiff systems
+/*!
+ * Integrates the system with an embedded explicit Runge-Kutta pair: either
+ * the Dormand-Prince 5(4) pair (type "RK45" in newIntegrator()) or the
+ * Bogacki-Shampine 3(2) pair ("RK23"). Both pairs are first-same-as-last,
+ * so an accepted step costs six (respectively three) right-hand-side
+ * evaluations with no Jacobian or linear algebra, making each step roughly
+ * an order of magnitude cheaper than a BDF step on systems small enough
+ * for the dense CVODES solver.
+ *
+ * The step size is controlled from the embedded error estimate using the
+ * same weighted RMS norm as CVODES. On stiff problems the step size
+ * becomes stability-limited rather than accuracy-limited and collapses;
+ * ReactorNet::setAutomaticIntegratorSwitching() watches for that behavior
+ * and moves such problems back to the BDF integrator mid-run.
+ *
+ * Root finding and sensitivity analysis are not supported.
+ *
+ * @ingroup odeGroup
+ */
+class RK45Integrator : public Integrator
+{
+public:
+    //! Constructor.
+    /*!
+     * @param order  Order of the advancing formula: 5 selects the
+     *     Dormand-Prince 5(4) pair, 3 the Bogacki-Shampine 3(2) pair.
+     */
+    explicit RK45Integrator(int order=5);
+    virtual void setTolerances(double reltol, size_t n, double* abstol);
+    virtual void setTolerances(double reltol, double abstol);
+    virtual void initialize(double t0, FuncEval& func);
+    virtual void reinitialize(double t0, FuncEval& func);
+    virtual void integrate(double tout);
+    virtual doublereal step(double tout);
+    virtual double& solution(size_t k);
+    virtual double* solution();
+    virtual double time() const {
+        return m_time;
+    }
+    virtual int lastOrder() const {
+        return m_order;
+    }
+    virtual int nEquations() const {
+        return static_cast<int>(m_neq);
+    }
+    virtual int nEvals() const {
+        return m_nevals;
+    }
+    virtual AnyMap memoryReport() const;
+    virtual void setMaxStepSize(double hmax);
+    virtual void setMinStepSize(double hmin);
+    virtual void setMaxSteps(int nmax);
+    virtual int maxSteps();
+    virtual void setMaxErrTestFails(int n) {
+        // failed error tests are retried with a reduced step inside
+        // oneStep(), with no limit short of the minimum step size
+    }
+
+    //! Number of steps taken since the last call to initialize()
+    int nSteps() const {
+        return m_nsteps;
+    }
+
+    //! Size of the last accepted step
+    double lastStep() const {
+        return m_hlast;
+    }
+
+protected:
+    //! Take one adaptive step, retrying with a smaller step size until the
+    //! embedded error test passes. The step is clamped so that the current
+    //! time never passes *tmax*.
+    void oneStep(double tmax);
+
+    //! Weighted RMS norm of the embedded error estimate in #m_err, with
+    //! weights formed from the tolerances and the current and trial
+    //! solutions
+    double errorNorm() const;
+
+    //! Evaluate the right-hand side into *ydot*
+    void evalRhs(double t, double* y, double* ydot);
+
+    FuncEval* m_func = nullptr;
+    size_t m_neq = 0;
+
+    //! Order of the advancing formula: 5 (Dormand-Prince) or
+    //! 3 (Bogacki-Shampine)
+    int m_order;
+
+    //! Stage count of the selected pair
+    size_t m_stages;
+
+    //! Pointers into the Butcher tableau of the selected pair
+    const double* m_a; //!< stage coefficients, row by row
+    const double* m_c; //!< stage times
+    const double* m_e; //!< error estimate weights (b - bhat)
+
+    double m_time = 0.0;
+    double m_h = 0.0; //!< next step size to attempt; 0 until the first step
+    double m_hlast = 0.0;
+    double m_hmax = 0.0; //!< maximum step size; 0 means no limit
+    double m_hmin = 0.0;
+    double m_reltol = 1.0e-9;
+    double m_abstols = 1.0e-15; //!< scalar absolute tolerance
+    vector_fp m_abstol; //!< per-component tolerances; empty if scalar
+    int m_maxsteps = 20000;
+    int m_nevals = 0;
+    int m_nsteps = 0;
+
+    //! If true, the first stage of the next step can reuse the last stage
+    //! of the previous accepted step (both pairs are first-same-as-last)
+    bool m_haveFsal = false;
+
+    vector_fp m_y, m_ynew, m_err, m_ytmp;
+    std::vector<vector_fp> m_k; //!< stage derivatives
+};
+
+}
+
+#endif
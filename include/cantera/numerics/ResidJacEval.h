@@ -293,6 +293,52 @@ public:
                                doublereal* const* jacobianColPts,
                                doublereal* const resid);
 
+    //! Number of structurally nonzero entries in the Jacobian
+    /*!
+     *  Used by the sparse (KLU) linear solver to size the compressed
+     *  storage (see IDA_Solver::setSparseLinearSolver()). The base class
+     *  returns 0, meaning no sparsity pattern is available and the sparse
+     *  solver cannot be used with this problem.
+     */
+    virtual int nJacNonzeros() const;
+
+    //! Fill in the Jacobian sparsity pattern in compressed sparse column form
+    /*!
+     *  The pattern must not change between calls to evalJacobianSparse().
+     *
+     * @param jacColPtrs    Index into *jacRowVals* of the first entry of each
+     *                      column; length nEquations()+1, with the last entry
+     *                      equal to nJacNonzeros() (output)
+     * @param jacRowVals    Row index of each stored entry, column by column;
+     *                      length nJacNonzeros() (output)
+     */
+    virtual void getJacobianPattern(int* const jacColPtrs,
+                                    int* const jacRowVals) const;
+
+    //! Calculate an analytical Jacobian in compressed sparse column form
+    /*!
+     *  Only called if the jacFormation method is set to analytical and the
+     *  sparse linear solver has been selected. The entries must be ordered
+     *  as in the pattern returned by getJacobianPattern().
+     *
+     * @param t             Time                    (input)
+     * @param delta_t       The current value of the time step (input)
+     * @param cj            Coefficient of yprime used in the evaluation of the Jacobian
+     * @param y             Solution vector (input, do not modify)
+     * @param ydot          Rate of change of solution vector. (input, do not modify)
+     * @param jacValues     Values of the stored Jacobian entries (output)
+     * @param resid         Value of the residual that is computed (output)
+     * @returns a flag to indicate that operation is successful.
+     *            1  Means a successful operation
+     *           -0 or neg value Means an unsuccessful operation
+     */
+    virtual int evalJacobianSparse(const doublereal t, const doublereal delta_t,
+                                   doublereal cj,
+                                   const doublereal* const y,
+                                   const doublereal* const ydot,
+                                   doublereal* const jacValues,
+                                   doublereal* const resid);
+
 protected:
     //! constant value of atol
     doublereal m_atol;
@@ -22,6 +22,8 @@
 #define _DGBSV_   dgbsv
 #define _DGBTRF_  dgbtrf
 #define _DGBTRS_  dgbtrs
+#define _SGBTRF_  sgbtrf
+#define _SGBTRS_  sgbtrs
 #define _DGECON_  dgecon
 #define _DLANGE_  dlange
 #define _DSCAL_   dscal
@@ -43,6 +45,8 @@
 #define _DGBSV_   dgbsv_
 #define _DGBTRF_  dgbtrf_
 #define _DGBTRS_  dgbtrs_
+#define _SGBTRF_  sgbtrf_
+#define _SGBTRS_  sgbtrs_
 #define _DGECON_  dgecon_
 #define _DLANGE_  dlange_
 #define _DSCAL_   dscal_
@@ -125,6 +129,20 @@ extern "C" {
                  doublereal* b, integer* ldb, integer* info);
 #endif
 
+    int _SGBTRF_(integer* m, integer* n, integer* kl, integer* ku,
+                 float* a, integer* lda, integer* ipiv, integer* info);
+
+#ifdef LAPACK_FTN_STRING_LEN_AT_END
+    int _SGBTRS_(const char* trans, integer* n, integer* kl, integer* ku,
+                 integer* nrhs, float* a, integer* lda, integer* ipiv,
+                 float* b, integer* ldb, integer* info, ftnlen trsize);
+#else
+    int _SGBTRS_(const char* trans, ftnlen trsize,
+                 integer* n, integer* kl, integer* ku,
+                 integer* nrhs, float* a, integer* lda, integer* ipiv,
+                 float* b, integer* ldb, integer* info);
+#endif
+
     int _DSCAL_(integer* n, doublereal* da, doublereal* dx, integer* incx);
 
     int _DGEQRF_(const integer* m, const integer* n, doublereal* a, const integer* lda,
@@ -214,6 +232,63 @@ extern "C" {
 namespace Cantera
 {
 
+//! Dispatch table for the BLAS/LAPACK entry points used by Cantera
+/*!
+ * Each member is initialized to the symbol the library was linked against at
+ * build time, so by default the behavior is identical to calling the Fortran
+ * bindings directly. loadLapackLibrary() repoints the whole table at the
+ * corresponding symbols of another implementation (MKL, OpenBLAS, reference
+ * LAPACK, ...) loaded at run time, so a single binary can use whichever
+ * backend is fastest on the local machine.
+ */
+struct LapackFuncs
+{
+    decltype(&_DGEMV_) dgemv;
+    decltype(&_DGETRF_) dgetrf;
+    decltype(&_DGETRS_) dgetrs;
+    decltype(&_DGETRI_) dgetri;
+    decltype(&_DGELSS_) dgelss;
+    decltype(&_DGBCON_) dgbcon;
+    decltype(&_DGBSV_) dgbsv;
+    decltype(&_DGBTRF_) dgbtrf;
+    decltype(&_DGBTRS_) dgbtrs;
+    decltype(&_SGBTRF_) sgbtrf;
+    decltype(&_SGBTRS_) sgbtrs;
+    decltype(&_DGECON_) dgecon;
+    decltype(&_DLANGE_) dlange;
+    decltype(&_DSCAL_) dscal;
+    decltype(&_DGEQRF_) dgeqrf;
+    decltype(&_DORMQR_) dormqr;
+    decltype(&_DTRTRS_) dtrtrs;
+    decltype(&_DTRCON_) dtrcon;
+    decltype(&_DPOTRF_) dpotrf;
+    decltype(&_DPOTRS_) dpotrs;
+};
+
+//! Returns the active LAPACK dispatch table. All ct_* wrappers in this file
+//! call through this table.
+LapackFuncs& lapackFuncs();
+
+//! Select a different BLAS/LAPACK backend at run time
+/*!
+ * Opens the shared library *libName* with dlopen() and rebinds every entry of
+ * the table returned by lapackFuncs() to the symbols it exports, using the
+ * same symbol naming convention (trailing underscore or not) configured at
+ * build time. All entry points must resolve; otherwise a CanteraError is
+ * raised and the current backend remains active. The library handle is kept
+ * open for the remainder of the process. Should be called before any solvers
+ * are created; it is not safe to switch backends while a factorization is in
+ * use. Not supported on Windows.
+ *
+ * @param libName  name or path of the shared library, as understood by
+ *                 dlopen(), for example "libopenblas.so"
+ */
+void loadLapackLibrary(const std::string& libName);
+
+//! Name of the library loaded by loadLapackLibrary(), or "built-in" if the
+//! compile-time backend is active
+std::string lapackBackendName();
+
 inline void ct_dgemv(ctlapack::storage_t storage,
                      ctlapack::transpose_t trans,
                      int m, int n, doublereal alpha, const doublereal* a, int lda,
@@ -224,10 +299,10 @@ inline void ct_dgemv(ctlapack::storage_t storage,
     doublereal f_alpha = alpha, f_beta = beta;
     ftnlen trsize = 1;
 #ifdef LAPACK_FTN_STRING_LEN_AT_END
-    _DGEMV_(&no_yes[trans], &f_m, &f_n, &f_alpha, a,
+    lapackFuncs().dgemv(&no_yes[trans], &f_m, &f_n, &f_alpha, a,
             &f_lda, x, &f_incX, &f_beta, y, &f_incY, trsize);
 #else
-    _DGEMV_(&no_yes[trans], trsize, &f_m, &f_n, &f_alpha, a,
+    lapackFuncs().dgemv(&no_yes[trans], trsize, &f_m, &f_n, &f_alpha, a,
             &f_lda, x, &f_incX, &f_beta, y, &f_incY);
 #endif
 }
@@ -238,7 +313,7 @@ inline void ct_dgbsv(int n, int kl, int ku, int nrhs,
 {
     integer f_n = n, f_kl = kl, f_ku = ku, f_nrhs = nrhs, f_lda = lda,
             f_ldb = ldb, f_info = 0;
-    _DGBSV_(&f_n, &f_kl, &f_ku, &f_nrhs, a, &f_lda, ipiv,
+    lapackFuncs().dgbsv(&f_n, &f_kl, &f_ku, &f_nrhs, a, &f_lda, ipiv,
             b, &f_ldb, &f_info);
     info = f_info;
 }
@@ -256,7 +331,7 @@ inline void ct_dgelss(size_t m, size_t n, size_t nrhs, doublereal* a,
     integer f_lwork = static_cast<integer>(lwork);
     integer f_rank, f_info;
 
-    _DGELSS_(&f_m, &f_n, &f_nrhs, a, &f_lda, b, &f_ldb, s, &rcond, &f_rank,
+    lapackFuncs().dgelss(&f_m, &f_n, &f_nrhs, a, &f_lda, b, &f_ldb, s, &rcond, &f_rank,
             work, &f_lwork, &f_info);
 
     info = static_cast<int>(f_info);
@@ -273,7 +348,7 @@ inline void ct_dgbtrf(size_t m, size_t n, size_t kl, size_t ku,
     integer f_ku = (int) ku;
     integer f_lda = (int) lda;
     integer f_info = 0;
-    _DGBTRF_(&f_m, &f_n, &f_kl, &f_ku, a, &f_lda, ipiv, &f_info);
+    lapackFuncs().dgbtrf(&f_m, &f_n, &f_kl, &f_ku, a, &f_lda, ipiv, &f_info);
     info = f_info;
 }
 
@@ -291,10 +366,46 @@ inline void ct_dgbtrs(ctlapack::transpose_t trans, size_t n,
     char tr = no_yes[trans];
     ftnlen trsize = 1;
 #ifdef LAPACK_FTN_STRING_LEN_AT_END
-    _DGBTRS_(&tr, &f_n, &f_kl, &f_ku, &f_nrhs, a, &f_lda, ipiv,
+    lapackFuncs().dgbtrs(&tr, &f_n, &f_kl, &f_ku, &f_nrhs, a, &f_lda, ipiv,
+             b, &f_ldb, &f_info, trsize);
+#else
+    lapackFuncs().dgbtrs(&tr, trsize, &f_n, &f_kl, &f_ku, &f_nrhs, a, &f_lda, ipiv,
+             b, &f_ldb, &f_info);
+#endif
+    info = f_info;
+}
+
+inline void ct_sgbtrf(size_t m, size_t n, size_t kl, size_t ku,
+                      float* a, size_t lda, integer* ipiv, int& info)
+{
+    integer f_m = (int) m;
+    integer f_n = (int) n;
+    integer f_kl = (int) kl;
+    integer f_ku = (int) ku;
+    integer f_lda = (int) lda;
+    integer f_info = 0;
+    lapackFuncs().sgbtrf(&f_m, &f_n, &f_kl, &f_ku, a, &f_lda, ipiv, &f_info);
+    info = f_info;
+}
+
+inline void ct_sgbtrs(ctlapack::transpose_t trans, size_t n,
+                      size_t kl, size_t ku, size_t nrhs, float* a, size_t lda,
+                      integer* ipiv, float* b, size_t ldb, int& info)
+{
+    integer f_n = (int) n;
+    integer f_kl = (int) kl;
+    integer f_ku = (int) ku;
+    integer f_nrhs = (int) nrhs;
+    integer f_lda = (int) lda;
+    integer f_ldb = (int) ldb;
+    integer f_info = 0;
+    char tr = no_yes[trans];
+    ftnlen trsize = 1;
+#ifdef LAPACK_FTN_STRING_LEN_AT_END
+    lapackFuncs().sgbtrs(&tr, &f_n, &f_kl, &f_ku, &f_nrhs, a, &f_lda, ipiv,
              b, &f_ldb, &f_info, trsize);
 #else
-    _DGBTRS_(&tr, trsize, &f_n, &f_kl, &f_ku, &f_nrhs, a, &f_lda, ipiv,
+    lapackFuncs().sgbtrs(&tr, trsize, &f_n, &f_kl, &f_ku, &f_nrhs, a, &f_lda, ipiv,
              b, &f_ldb, &f_info);
 #endif
     info = f_info;
@@ -307,7 +418,7 @@ inline void ct_dgetrf(size_t m, size_t n,
     integer nn = (int) n;
     integer ldaa = (int) lda;
     integer infoo = 0;
-    _DGETRF_(&mm, &nn, a, &ldaa, ipiv, &infoo);
+    lapackFuncs().dgetrf(&mm, &nn, a, &ldaa, ipiv, &infoo);
     info = infoo;
 }
 
@@ -323,9 +434,9 @@ inline void ct_dgetrs(ctlapack::transpose_t trans, size_t n,
     char tr = no_yes[trans];
     ftnlen trsize = 1;
 #ifdef LAPACK_FTN_STRING_LEN_AT_END
-    _DGETRS_(&tr, &f_n, &f_nrhs, a, &f_lda, ipiv, b, &f_ldb, &f_info, trsize);
+    lapackFuncs().dgetrs(&tr, &f_n, &f_nrhs, a, &f_lda, ipiv, b, &f_ldb, &f_info, trsize);
 #else
-    _DGETRS_(&tr, trsize, &f_n, &f_nrhs, a, &f_lda, ipiv, b, &f_ldb, &f_info);
+    lapackFuncs().dgetrs(&tr, trsize, &f_n, &f_nrhs, a, &f_lda, ipiv, b, &f_ldb, &f_info);
 #endif
     info = f_info;
 }
@@ -334,13 +445,13 @@ inline void ct_dgetri(int n, doublereal* a, int lda, integer* ipiv,
                       doublereal* work, int lwork, int& info)
 {
     integer f_n = n, f_lda = lda, f_lwork = lwork, f_info = 0;
-    _DGETRI_(&f_n, a, &f_lda, ipiv, work, &f_lwork, &f_info);
+    lapackFuncs().dgetri(&f_n, a, &f_lda, ipiv, work, &f_lwork, &f_info);
 }
 
 inline void ct_dscal(int n, doublereal da, doublereal* dx, int incx)
 {
     integer f_n = n, f_incx = incx;
-    _DSCAL_(&f_n, &da, dx, &f_incx);
+    lapackFuncs().dscal(&f_n, &da, dx, &f_incx);
 }
 
 inline void ct_dgeqrf(size_t m, size_t n, doublereal* a, size_t lda, doublereal* tau,
@@ -351,7 +462,7 @@ inline void ct_dgeqrf(size_t m, size_t n, doublereal* a, size_t lda, doublereal*
     integer f_lda = static_cast<integer>(lda);
     integer f_lwork = static_cast<integer>(lwork);
     integer f_info = 0;
-    _DGEQRF_(&f_m, &f_n, a, &f_lda, tau, work, &f_lwork, &f_info);
+    lapackFuncs().dgeqrf(&f_m, &f_n, a, &f_lda, tau, work, &f_lwork, &f_info);
     info = f_info;
 }
 
@@ -370,9 +481,9 @@ inline void ct_dormqr(ctlapack::side_t rlside, ctlapack::transpose_t trans, size
     integer f_info = 0;
     ftnlen trsize = 1;
 #ifdef LAPACK_FTN_STRING_LEN_AT_END
-    _DORMQR_(&side, &tr, &f_m, &f_n, &f_k, a, &f_lda, tau, c, &f_ldc, work, &f_lwork, &f_info, trsize, trsize);
+    lapackFuncs().dormqr(&side, &tr, &f_m, &f_n, &f_k, a, &f_lda, tau, c, &f_ldc, work, &f_lwork, &f_info, trsize, trsize);
 #else
-    _DORMQR_(&side, trsize, &tr, trsize, &f_m, &f_n, &f_k, a, &f_lda, tau, c, &f_ldc, work, &f_lwork, &f_info);
+    lapackFuncs().dormqr(&side, trsize, &tr, trsize, &f_m, &f_n, &f_k, a, &f_lda, tau, c, &f_ldc, work, &f_lwork, &f_info);
 #endif
     info = f_info;
 }
@@ -393,9 +504,9 @@ inline void ct_dtrtrs(ctlapack::upperlower_t uplot, ctlapack::transpose_t trans,
     integer f_info = 0;
     ftnlen trsize = 1;
 #ifdef LAPACK_FTN_STRING_LEN_AT_END
-    _DTRTRS_(&uplo, &tr, &dd, &f_n, &f_nrhs, a, &f_lda, b, &f_ldb, &f_info, trsize, trsize, trsize);
+    lapackFuncs().dtrtrs(&uplo, &tr, &dd, &f_n, &f_nrhs, a, &f_lda, b, &f_ldb, &f_info, trsize, trsize, trsize);
 #else
-    _DTRTRS_(&uplo, trsize, &tr, trsize, &dd, trsize, &f_n, &f_nrhs, a, &f_lda, b, &f_ldb, &f_info);
+    lapackFuncs().dtrtrs(&uplo, trsize, &tr, trsize, &dd, trsize, &f_n, &f_nrhs, a, &f_lda, b, &f_ldb, &f_info);
 #endif
     info = f_info;
 }
@@ -422,9 +533,9 @@ inline doublereal ct_dtrcon(const char* norm, ctlapack::upperlower_t uplot, cons
     doublereal rcond = 0.0;
     ftnlen trsize = 1;
 #ifdef LAPACK_FTN_STRING_LEN_AT_END
-    _DTRCON_(&nn, &uplo, &dd, &f_n, a, &f_lda, &rcond, work, iwork, &f_info, trsize, trsize, trsize);
+    lapackFuncs().dtrcon(&nn, &uplo, &dd, &f_n, a, &f_lda, &rcond, work, iwork, &f_info, trsize, trsize, trsize);
 #else
-    _DTRCON_(&nn, trsize, &uplo, trsize, &dd, trsize, &f_n, a, &f_lda, &rcond, work, iwork, &f_info);
+    lapackFuncs().dtrcon(&nn, trsize, &uplo, trsize, &dd, trsize, &f_n, a, &f_lda, &rcond, work, iwork, &f_info);
 #endif
     info = f_info;
     return rcond;
@@ -438,9 +549,9 @@ inline void ct_dpotrf(ctlapack::upperlower_t uplot, size_t n, doublereal* a, siz
     integer f_info = 0;
     ftnlen trsize = 1;
 #ifdef LAPACK_FTN_STRING_LEN_AT_END
-    _DPOTRF_(&uplo, &f_n, a, &f_lda, &f_info, trsize);
+    lapackFuncs().dpotrf(&uplo, &f_n, a, &f_lda, &f_info, trsize);
 #else
-    _DPOTRF_(&uplo, trsize, &f_n, a, &f_lda, &f_info);
+    lapackFuncs().dpotrf(&uplo, trsize, &f_n, a, &f_lda, &f_info);
 #endif
     info = f_info;
     return;
@@ -457,9 +568,9 @@ inline void ct_dpotrs(ctlapack::upperlower_t uplot, size_t n, size_t nrhs, doubl
     integer f_info = 0;
     ftnlen trsize = 1;
 #ifdef LAPACK_FTN_STRING_LEN_AT_END
-    _DPOTRS_(&uplo, &f_n, &f_nrhs, a, &f_lda, b, &f_ldb, &f_info, trsize);
+    lapackFuncs().dpotrs(&uplo, &f_n, &f_nrhs, a, &f_lda, b, &f_ldb, &f_info, trsize);
 #else
-    _DPOTRS_(&uplo, trsize, &f_n, &f_nrhs, a, &f_lda, b, &f_ldb, &f_info);
+    lapackFuncs().dpotrs(&uplo, trsize, &f_n, &f_nrhs, a, &f_lda, b, &f_ldb, &f_info);
 #endif
     info = f_info;
     return;
@@ -478,9 +589,9 @@ inline doublereal ct_dgecon(const char norm, size_t n, doublereal* a, size_t lda
     doublereal rcond = 0.0;
     ftnlen trsize = 1;
 #ifdef LAPACK_FTN_STRING_LEN_AT_END
-    _DGECON_(&cnorm, &f_n, a, &f_lda, &anorm, &rcond, work, iwork, &f_info, trsize);
+    lapackFuncs().dgecon(&cnorm, &f_n, a, &f_lda, &anorm, &rcond, work, iwork, &f_info, trsize);
 #else
-    _DGECON_(&cnorm, trsize, &f_n, a, &f_lda, &anorm, &rcond, work, iwork, &f_info);
+    lapackFuncs().dgecon(&cnorm, trsize, &f_n, a, &f_lda, &anorm, &rcond, work, iwork, &f_info);
 #endif
     info = f_info;
     return rcond;
@@ -502,9 +613,9 @@ inline doublereal ct_dgbcon(const char norm, size_t n, size_t kl, size_t ku,
     doublereal rcond = 0.0;
     ftnlen trsize = 1;
 #ifdef LAPACK_FTN_STRING_LEN_AT_END
-    _DGBCON_(&cnorm, &f_n, &f_kl, &f_ku, a, &f_ldab, ipiv, &anorm, &rcond, work, iwork, &f_info, trsize);
+    lapackFuncs().dgbcon(&cnorm, &f_n, &f_kl, &f_ku, a, &f_ldab, ipiv, &anorm, &rcond, work, iwork, &f_info, trsize);
 #else
-    _DGBCON_(&cnorm, trsize, &f_n, &f_kl, &f_ku, a, &f_ldab, ipiv, &anorm, &rcond, work, iwork, &f_info);
+    lapackFuncs().dgbcon(&cnorm, trsize, &f_n, &f_kl, &f_ku, a, &f_ldab, ipiv, &anorm, &rcond, work, iwork, &f_info);
 #endif
     info = f_info;
     return rcond;
@@ -523,9 +634,9 @@ inline doublereal ct_dlange(const char norm, size_t m, size_t n, doublereal* a,
     doublereal anorm;
     ftnlen trsize = 1;
 #ifdef LAPACK_FTN_STRING_LEN_AT_END
-    anorm = _DLANGE_(&cnorm, &f_m, &f_n, a, &f_lda, work, trsize);
+    anorm = lapackFuncs().dlange(&cnorm, &f_m, &f_n, a, &f_lda, work, trsize);
 #else
-    anorm = _DLANGE_(&cnorm, trsize, &f_m, &f_n, a, &f_lda, work);
+    anorm = lapackFuncs().dlange(&cnorm, trsize, &f_m, &f_n, a, &f_lda, work);
 #endif
     return anorm;
 }
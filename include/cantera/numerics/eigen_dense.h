@@ -7,6 +7,7 @@
 
 namespace Cantera {
     typedef Eigen::Map<Eigen::MatrixXd> MappedMatrix;
+    typedef Eigen::Map<const Eigen::MatrixXd> ConstMappedMatrix;
     typedef Eigen::Map<Eigen::VectorXd> MappedVector;
     typedef Eigen::Map<const Eigen::VectorXd> ConstMappedVector;
 }
@@ -0,0 +1,22 @@
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_EIGEN_SPARSE_H
+#define CT_EIGEN_SPARSE_H
+
+#include "cantera/base/ct_defs.h"
+#if CT_USE_SYSTEM_EIGEN
+#include <Eigen/Sparse>
+#else
+#include "cantera/ext/Eigen/Sparse"
+#endif
+
+namespace Cantera
+{
+//! Sparse matrix in compressed sparse row (CSR) storage
+typedef Eigen::SparseMatrix<double, Eigen::RowMajor> SparseRowMatrix;
+
+typedef std::vector<Eigen::Triplet<double>> SparseTriplets;
+}
+
+#endif
@@ -32,5 +32,43 @@ namespace Cantera
 double polyfit(size_t n, size_t deg, const double* x, const double* y,
                const double* w, double* p);
 
+//! Fits several polynomials to data sets sharing the same points
+/*!
+ * Computes the unweighted least-squares polynomial fits of degree *deg* for
+ * *nfits* sets of function values, all evaluated at the same points *x*. The
+ * Vandermonde matrix is assembled and QR-factored only once for all of the
+ * fits, which is substantially cheaper than *nfits* calls to polyfit().
+ *
+ * @param n     The number of points at which each function is evaluated
+ * @param deg   The degree of the polynomial fits. deg <= n - 1.
+ * @param nfits The number of data sets to fit
+ * @param x     Array of points shared by all data sets. Length *n*.
+ * @param y     Function values, stored as *nfits* consecutive blocks of
+ *     length *n*.
+ * @param[out] p  Polynomial coefficients, stored as *nfits* consecutive
+ *     blocks of length *deg+1*, each starting with the constant term.
+ * @returns the largest root mean squared error among the fits.
+ */
+double polyfitShared(size_t n, size_t deg, size_t nfits, const double* x,
+                     const double* y, double* p);
+
+//! Evaluate one polynomial at many points
+/*!
+ * Computes \f$ y_i = p[0] + p[1] x_i + \cdots + p[deg] x_i^{deg} \f$ by
+ * Horner's scheme for each of the *n* points in *x*.
+ */
+void polyeval(size_t deg, const double* p, size_t n, const double* x,
+              double* y);
+
+//! Evaluate many polynomials of the same degree at one point
+/*!
+ * Computes \f$ y_i = p_i(x) \f$ for *npoly* polynomials whose coefficients
+ * are packed by degree: `p[d*npoly + i]` is the degree-*d* coefficient of
+ * polynomial *i*. The Horner recurrence then runs stride-one through the
+ * coefficient planes, so the loop over polynomials vectorizes.
+ */
+void polyevalBatch(size_t deg, size_t npoly, const double* p, double x,
+                   double* y);
+
 }
 #endif
@@ -0,0 +1,122 @@
+/**
+ * @file Continuation.h
+ * Warm-start continuation driver for one-dimensional flame simulations
+ * (see \link Cantera::Continuation Continuation\endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_CONTINUATION_H
+#define CT_CONTINUATION_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <functional>
+
+namespace Cantera
+{
+
+class Sim1D;
+
+//! Continuation driver that traces a family of flame solutions over a
+//! parameter such as strain rate or inlet velocity
+/*!
+ * Each continuation step changes the parameter by an adaptive increment and
+ * re-solves the steady problem starting from the previous converged
+ * solution, so the solver keeps the grid, Jacobian structure, and solution
+ * across steps instead of starting each curve point from scratch. Grid
+ * refinement is only performed when the solution has moved appreciably
+ * since the last refinement, which is where most of the per-point cost of
+ * scripted parameter sweeps goes.
+ *
+ * The step size grows while steps succeed and is cut back when the Newton
+ * and time-stepping solver fails, so the driver takes large steps along
+ * flat parts of the response curve and small ones as it steepens. When the
+ * step size cannot be reduced further (as happens at an ignition or
+ * extinction turning point), solve() stops and returns the points computed
+ * so far. The converged solutions are kept as a sequence of snapshots that
+ * can be retrieved for postprocessing or restarting.
+ *
+ * The caller provides a function that applies the parameter value to the
+ * simulation, for example by setting the mass flux of an inlet domain.
+ */
+class Continuation
+{
+public:
+    //! Create a continuation driver for *sim*. The function *setParameter*
+    //! is called with the new parameter value before each step.
+    Continuation(Sim1D& sim, std::function<void(double)> setParameter);
+
+    Continuation(const Continuation&) = delete;
+    Continuation& operator=(const Continuation&) = delete;
+
+    //! Set the smallest and largest allowed parameter increments. The
+    //! driver stops when a step of *dpMin* fails; *dpMax* limits how fast
+    //! the step size grows after successful steps.
+    void setStepLimits(double dpMin, double dpMax);
+
+    //! Set the solution movement threshold that triggers grid refinement
+    /*!
+     * After each converged step, the maximum change of any solution
+     * component relative to the solution at the last refinement is
+     * compared against *threshold* (a relative measure; the default is
+     * 0.05). The grid is re-refined only when the threshold is exceeded,
+     * so curve points where the solution barely moves skip the refinement
+     * cost entirely.
+     */
+    void setRefineThreshold(double threshold) {
+        m_refineThreshold = threshold;
+    }
+
+    //! Trace the solution family from parameter value *pStart* to *pEnd*,
+    //! beginning with increment *dp0*
+    /*!
+     * The current contents of the simulation are used as the starting
+     * solution; the first solve is performed at *pStart*. Returns the
+     * number of converged curve points, which may correspond to a final
+     * parameter value short of *pEnd* if a turning point stops the
+     * continuation.
+     */
+    size_t solve(double pStart, double pEnd, double dp0, int loglevel=0);
+
+    //! Number of converged curve points stored
+    size_t nPoints() const {
+        return m_params.size();
+    }
+
+    //! Parameter values of the stored curve points
+    const vector_fp& parameters() const {
+        return m_params;
+    }
+
+    //! Solution vector of curve point *n*, in the layout of
+    //! Sim1D::solution() at the time the point converged
+    const vector_fp& solution(size_t n) const {
+        return m_solutions.at(n);
+    }
+
+protected:
+    //! Solve at parameter value *p*, refining the grid only if the
+    //! solution has moved past the refinement threshold. Returns true on
+    //! convergence.
+    bool solvePoint(double p, int loglevel);
+
+    Sim1D& m_sim;
+    std::function<void(double)> m_setParameter;
+
+    double m_dpMin;
+    double m_dpMax;
+    double m_refineThreshold;
+
+    //! Solution at the last grid refinement, used to measure how far the
+    //! solution has moved since
+    vector_fp m_xRefined;
+
+    vector_fp m_params;
+    std::vector<vector_fp> m_solutions;
+};
+
+}
+
+#endif
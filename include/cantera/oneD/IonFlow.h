@@ -68,13 +68,30 @@ protected:
      */
     virtual void evalResidual(double* x, double* rsd, int* diag,
                               double rdt, size_t jmin, size_t jmax);
-    virtual void updateTransport(double* x, size_t j0, size_t j1);
+    //! Evaluate the ion mobilities at midpoint `j` within the batched
+    //! property loop of StFlow::updateTransport(), so they are only
+    //! recomputed for midpoints whose state has changed
+    virtual void updateTransportPoint(ThermoPhase& gas, Transport& trans,
+                                      size_t j);
     virtual void updateDiffFluxes(const double* x, size_t j0, size_t j1);
     //! Solving phase one: the fluxes of charged species are turned off
     virtual void frozenIonMethod(const double* x, size_t j0, size_t j1);
     //! Solving phase two: the electric field equation is added coupled
     //! by the electrical drift
     virtual void electricFieldMethod(const double* x, size_t j0, size_t j1);
+
+    //! Segregated solve of the electric field into #m_Efield
+    /*!
+     * The field equation discretized in evalResidual() forms a
+     * lower-bidiagonal linear system in E, so the Thomas elimination
+     * degenerates to a single forward-substitution sweep from the E = 0
+     * boundary condition at the left boundary. Solving it directly here,
+     * instead of through the coupled Newton iteration, reduces the residual
+     * of the field component to a diagonal tracking equation and keeps the
+     * charge-density coupling out of the global Jacobian band. The field is
+     * held fixed while a Jacobian is being evaluated.
+     */
+    void solveEfield(const double* x);
     //! flag for solving electric field or not
     std::vector<bool> m_do_electric_field;
 
@@ -97,6 +114,9 @@ protected:
     //! mobility
     vector_fp m_mobility;
 
+    //! electric field at the grid points, from the segregated field solve
+    vector_fp m_Efield;
+
     //! solving stage
     size_t m_stage;
 
@@ -118,7 +138,7 @@ protected:
     }
 
     //! total charge density
-    double rho_e(double* x, size_t j) const {
+    double rho_e(const double* x, size_t j) const {
         double chargeDensity = 0.0;
         for (size_t k : m_kCharge) {
             chargeDensity += m_speciesCharge[k] * ElectronCharge * ND(x,k,j);
@@ -54,6 +54,35 @@ public:
 
     void updateTransient(doublereal rdt, integer* mask);
 
+    //! Enable or disable partial Jacobian refresh.
+    /*!
+     * When enabled, eval() compares the current solution against the one for
+     * which each column was last computed, and recomputes only the columns
+     * belonging to grid points whose state has changed by more than *tol*
+     * (relative), plus their neighbors within the residual stencil. Columns
+     * away from an advancing front are numerically unchanged across many
+     * Newton iterations, so the grouped full-residual evaluations are
+     * replaced by a few single-point residual evaluations. The first
+     * evaluation after enabling, and any evaluation at a new time-step size,
+     * is always a full one.
+     *
+     * @param enable  Flag turning partial refresh on or off
+     * @param tol     Relative solution change above which a point's columns
+     *                are considered stale
+     */
+    void setPartialRefresh(bool enable, double tol=1.0e-3) {
+        m_partialRefresh = enable;
+        m_refreshTol = tol;
+    }
+
+    //! Serial number incremented every time the Jacobian entries change,
+    //! through eval(), updateTransient() or incrementDiagonal(). External
+    //! factorizations (see BlockTridiagSolver) compare this value against the
+    //! one seen at their last factorization to decide whether to refactor.
+    int changeCount() const {
+        return m_changeCount;
+    }
+
     //! Set the Jacobian age.
     void setAge(int age) {
         m_age = age;
@@ -80,8 +109,24 @@ protected:
     vector_int m_mask;
     int m_nevals;
     int m_age;
+
+    //! Serial number of the Jacobian entries; see changeCount()
+    int m_changeCount;
     size_t m_size;
     size_t m_points;
+
+    //! If true, eval() may refresh only the columns of points whose state
+    //! has changed; see setPartialRefresh()
+    bool m_partialRefresh;
+
+    //! Relative solution change above which a point's columns are stale
+    doublereal m_refreshTol;
+
+    //! Time-step reciprocal used for the last full evaluation
+    doublereal m_rdtlast;
+
+    //! Solution for which each point's columns were last computed
+    vector_fp m_xlast;
 };
 }
 
@@ -7,6 +7,7 @@
 #define CT_MULTINEWTON_H
 
 #include "MultiJac.h"
+#include "cantera/numerics/BlockTridiagSolver.h"
 
 namespace Cantera
 {
@@ -69,10 +70,83 @@ public:
         m_maxAge = maxJacAge;
     }
 
+    //! Select the linear solver used for the Newton steps.
+    /*!
+     * When *yes* is true, the Jacobian is factored with the block Thomas
+     * algorithm of class BlockTridiagSolver, which exploits the
+     * block tridiagonal structure of multi-domain 1D problems and factors
+     * each grid-point block as a dense matrix. The default (false) factors
+     * the Jacobian as a general banded matrix with dgbtrf.
+     */
+    void useBlockTridiagSolver(bool yes) {
+        m_blockSolve = yes;
+        m_solverExplicit = true;
+    }
+
+    //! Select the linear solver from the estimated factorization cost.
+    /*!
+     * Called by OneDim::resize() whenever the problem dimensions change.
+     * The banded factorization pays for the global maximum bandwidth on
+     * every row, so for multi-domain problems where one large domain sets
+     * the bandwidth, the points of the smaller domains are factored far
+     * more expensively than their own coupling requires. The block Thomas
+     * algorithm pays for each grid point only according to its own block
+     * size. This method compares flop estimates for the two factorizations
+     * and enables the block solver when the banded one is several times
+     * more expensive, keeping the default banded solver (which pivots
+     * across the whole band) whenever the advantage is small. It does
+     * nothing once a solver has been chosen explicitly with
+     * useBlockTridiagSolver() or useKrylovSolver().
+     *
+     * @param r  the problem whose dimensions determine the costs
+     */
+    void autoSelectLinearSolver(OneDim& r);
+
+    //! Solve the Newton steps with a Jacobian-free GMRES iteration
+    /*!
+     * When enabled, the Newton system is solved iteratively instead of by
+     * back substitution with the banded factorization: matrix-vector
+     * products with the Jacobian are formed from finite differences of the
+     * residual, and the banded factorization held by MultiJac is applied
+     * as a right preconditioner. Because the factorization only
+     * preconditions the iteration, it can be left stale for many more
+     * Newton iterations than in the direct method (see setOptions()), and
+     * each step sees the true current Jacobian through the matrix-free
+     * products. At most *maxKrylov* Krylov vectors are built per step; the
+     * iteration stops early once the linear residual has been reduced by
+     * the factor *tol*, which is sufficient for the damped Newton
+     * iteration wrapped around it.
+     */
+    void useKrylovSolver(bool yes, size_t maxKrylov=30, double tol=1.0e-3) {
+        m_krylovSolve = yes;
+        m_krylovMax = maxKrylov;
+        m_krylovTol = tol;
+        m_solverExplicit = true;
+    }
+
+    //! Factor the banded Jacobian in single precision
+    /*!
+     * Forwarded to BandMatrix::setMixedPrecision() on the Jacobian used in
+     * step(): the factorization runs in single precision and solves recover
+     * double accuracy by iterative refinement, roughly halving the cost of
+     * the memory-bandwidth-bound banded factor. The damped Newton iteration
+     * only needs the factorization as an approximate inverse, so the
+     * reduced factor precision does not change the converged solution. Has
+     * no effect on the block tridiagonal solver.
+     */
+    void useMixedPrecisionSolve(bool yes) {
+        m_mixedPrecision = yes;
+    }
+
     /// Change the problem size.
     void resize(size_t points);
 
 protected:
+    //! Solve the Newton system with preconditioned GMRES when enabled with
+    //! useKrylovSolver(). On entry, *step* holds the right-hand side
+    //! \f$ -F(x) \f$; on return it holds the computed Newton step.
+    void stepKrylov(doublereal* x, doublereal* step, OneDim& r, MultiJac& jac);
+
     //! Work arrays of size #m_n used in solve().
     vector_fp m_x, m_stp, m_stp1;
 
@@ -82,6 +156,39 @@ protected:
     size_t m_n;
 
     doublereal m_elapsed;
+
+    //! If true, solve the Newton steps with #m_blockSolver instead of the
+    //! banded factorization of the Jacobian itself
+    bool m_blockSolve = false;
+
+    //! True once a linear solver has been chosen explicitly, disabling the
+    //! automatic selection of autoSelectLinearSolver()
+    bool m_solverExplicit = false;
+
+    //! Block tridiagonal factorization used when enabled with
+    //! useBlockTridiagSolver()
+    BlockTridiagSolver m_blockSolver;
+
+    //! Value of MultiJac::changeCount() at the last block factorization
+    int m_jacChangeCount = -1;
+
+    //! If true, solve the Newton steps with the Jacobian-free GMRES
+    //! iteration of stepKrylov() (see useKrylovSolver())
+    bool m_krylovSolve = false;
+
+    //! If true, factor the banded Jacobian in single precision
+    //! (see useMixedPrecisionSolve())
+    bool m_mixedPrecision = false;
+
+    //! Maximum number of Krylov vectors per GMRES solve
+    size_t m_krylovMax = 30;
+
+    //! Relative residual reduction at which the GMRES iteration stops
+    double m_krylovTol = 1.0e-3;
+
+    //! Krylov basis vectors and scratch storage for stepKrylov()
+    std::vector<vector_fp> m_kryV;
+    vector_fp m_kryB, m_kryZ, m_xPert, m_fPert;
 };
 }
 
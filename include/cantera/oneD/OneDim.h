@@ -186,6 +186,44 @@ public:
     void eval(size_t j, double* x, double* r, doublereal rdt=-1.0,
               int count = 1);
 
+    //! Set the number of threads used to evaluate the bulk domains in
+    //! eval()
+    /*!
+     * The bulk domains write disjoint portions of the residual vector and
+     * only read neighboring portions of the solution, so a full residual
+     * evaluation can compute them concurrently; the connector domains are
+     * evaluated serially afterward to reconcile the boundary equations.
+     * This only pays off for configurations with several flow domains, and
+     * requires that each bulk domain use its own ThermoPhase, Kinetics,
+     * and Transport managers, since domain evaluation sets the state of
+     * those objects. Pass 0 to use one thread per hardware core. The
+     * default of 1 evaluates all domains serially.
+     */
+    void setEvalThreads(size_t nThreads) {
+        m_evalThreads = nThreads;
+    }
+
+    //! Returns the number of threads configured by setEvalThreads(). The
+    //! same setting controls the threaded norm and damping-bound
+    //! reductions used by the Newton solver.
+    size_t evalThreads() const {
+        return m_evalThreads;
+    }
+
+    //! Returns true while the Jacobian is being evaluated from perturbed
+    //! residual evaluations. Domains may use this to skip updating
+    //! properties (such as transport coefficients) that are held fixed
+    //! during Jacobian evaluation.
+    bool jacobianBeingEvaluated() const {
+        return m_jacEval;
+    }
+
+    //! Set the flag returned by jacobianBeingEvaluated(). Called by
+    //! MultiJac::eval().
+    void setJacobianBeingEvaluated(bool flag) {
+        m_jacEval = flag;
+    }
+
     //! Return a pointer to the domain global point *i* belongs to.
     /*!
      * The domains are scanned right-to-left, and the first one with starting
@@ -238,6 +276,23 @@ public:
         m_tfactor = tfactor;
     }
 
+    //! Enable or disable adaptive pseudo-transient step-size control in
+    //! timeStep()
+    /*!
+     * When enabled, timeStep() uses switched-evolution-relaxation: after
+     * each accepted implicit Euler step the step size is scaled by the
+     * ratio of the previous to the current steady-state residual norm, so
+     * the pseudo-transient takes growing steps as the residual falls
+     * instead of marching at the conservative initial size. The growth per
+     * step is limited to *maxGrowth*, and the step size stays within the
+     * bounds set by setMinTimeStep() and setMaxTimeStep(). Failed steps
+     * are still cut back by the factor set with setTimeStepFactor().
+     */
+    void setAdaptiveTimeStepping(bool enabled, double maxGrowth=3.0) {
+        m_ser = enabled;
+        m_serMaxGrowth = maxGrowth;
+    }
+
     //! Set the maximum number of timeteps allowed before successful
     //! steady-state solve
     void setMaxTimeStepCount(int nmax) {
@@ -335,6 +390,7 @@ protected:
     std::unique_ptr<MultiNewton> m_newt; //!< Newton iterator
     doublereal m_rdt; //!< reciprocal of time step
     bool m_jac_ok; //!< if true, Jacobian is current
+    bool m_jacEval; //!< if true, the Jacobian is currently being evaluated
 
     size_t m_bw; //!< Jacobian bandwidth
     size_t m_size; //!< solution vector size
@@ -363,6 +419,18 @@ protected:
     //! Maximum number of timesteps allowed per call to solve()
     int m_nsteps_max;
 
+    //! Number of threads used for bulk domain evaluation in eval(). A
+    //! value of 0 means one thread per hardware core. See setEvalThreads().
+    size_t m_evalThreads;
+
+    //! True if switched-evolution-relaxation step-size control is used in
+    //! timeStep(). See setAdaptiveTimeStepping().
+    bool m_ser;
+
+    //! Maximum factor by which one accepted time step may grow the step
+    //! size under switched-evolution-relaxation
+    double m_serMaxGrowth;
+
 private:
     // statistics
     int m_nevals;
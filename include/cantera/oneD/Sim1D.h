@@ -116,6 +116,25 @@ public:
 
     void solve(int loglevel = 0, bool refine_grid = true);
 
+    //! Enable a coarse-to-fine (nested iteration) startup for solve()
+    /*!
+     * When enabled, solve() first coarsens the grid of each domain by keeping
+     * only every *stride*-th point, converges the problem there, and then
+     * lets the ordinary refinement loop rebuild the resolution level by
+     * level. Since refine() interpolates the converged solution onto each new
+     * grid, every level starts from the interpolant of the level below it, so
+     * most Newton iterations and time steps happen on the cheap coarse grids
+     * instead of at full resolution. The coarsening is applied once per call
+     * to solve(), and only when grid refinement is enabled.
+     *
+     * @param enable  enable or disable the coarse startup
+     * @param stride  keep every *stride*-th grid point on the coarse level;
+     *                must be at least 2. The domain boundary points and the
+     *                fixed-temperature point of freely propagating flames
+     *                are always kept.
+     */
+    void setCoarseToFine(bool enable, size_t stride=4);
+
     void eval(doublereal rdt=-1.0, int count = 1) {
         OneDim::eval(npos, m_x.data(), m_xnew.data(), rdt, count);
     }
@@ -188,6 +207,49 @@ public:
     //! failure during grid refinement.
     void restoreSteadySolution();
 
+    //! @name Solution library
+    //!
+    //! A solution library is a directory of converged solutions stored in a
+    //! compact binary snapshot format and indexed by the domain/component
+    //! structure of the simulation together with user-supplied parameters
+    //! (pressure, equivalence ratio and strain rate). Warm-starting a new
+    //! case from the nearest library entry typically replaces the crude
+    //! linear initial profiles and saves most of the time-stepping cycles
+    //! when sweeping over flame conditions.
+    //@{
+
+    //! Add the current solution to the library in directory *dir*.
+    /*!
+     * The entry is tagged with a hash of the domain and component structure,
+     * so entries written for a different mechanism or configuration are
+     * never retrieved.
+     *
+     * @param dir       directory holding the library; must exist
+     * @param pressure  operating pressure [Pa] used as a lookup coordinate
+     * @param phi       equivalence ratio used as a lookup coordinate
+     * @param strain    strain rate [1/s] used as a lookup coordinate; pass 0
+     *                  for unstrained configurations
+     * @param loglevel  controls the amount of diagnostic output
+     */
+    void saveToLibrary(const std::string& dir, double pressure, double phi,
+                       double strain, int loglevel=0);
+
+    //! Initialize the solution from the nearest library entry, if one exists.
+    /*!
+     * Searches the library in directory *dir* for entries with a matching
+     * domain/component structure, picks the one closest to the requested
+     * (pressure, phi, strain) point, and interpolates its profiles onto the
+     * current grid of each domain in relative coordinates.
+     *
+     * @returns `true` if an entry was found and the solution was
+     *     initialized from it, `false` if the library does not exist or
+     *     contains no compatible entry.
+     */
+    bool restoreNearest(const std::string& dir, double pressure, double phi,
+                        double strain, int loglevel=0);
+
+    //@}
+
     void getInitialSoln();
 
     void setSolution(const doublereal* soln) {
@@ -217,6 +279,37 @@ public:
      */
     void solveAdjoint(const double* b, double* lambda);
 
+    //! Sensitivities of a scalar objective to reaction rate coefficients,
+    //! computed from the converged steady solution by the adjoint method.
+    /*!
+     * Solves the single adjoint system \f$ J^T \lambda = (\partial g/
+     * \partial x)^T \f$ against the current Jacobian (see solveAdjoint())
+     * and returns, for each reaction listed in *reactions*, the logarithmic
+     * sensitivity
+     * \f[
+     *     s_i = \left.\frac{dg}{d\ln k_i}\right|_{f=0}
+     *         = -\lambda^T \frac{\partial f}{\partial \ln k_i}
+     * \f]
+     * where the parameter derivatives of the residual are evaluated by
+     * perturbing the rate multiplier of reaction *i* in the kinetics
+     * managers of all flow domains. The cost is one banded solve plus one
+     * residual evaluation per reaction, independent of the grid-sized Newton
+     * iterations a re-solve per parameter would require. The current
+     * solution must be converged; the solution vector and the rate
+     * multipliers are unchanged on return.
+     *
+     * @param dgdx       gradient of the objective with respect to the
+     *                   solution vector, length size()
+     * @param reactions  indices of the reactions to compute sensitivities
+     *                   for
+     * @param loglevel   controls the amount of diagnostic output
+     * @returns a vector of sensitivities, one entry per element of
+     *     *reactions*
+     */
+    vector_fp adjointSensitivities(const double* dgdx,
+                                   const std::vector<size_t>& reactions,
+                                   int loglevel=0);
+
     virtual void resize();
 
     //! Set a function that will be called after each successful steady-state
@@ -254,15 +347,34 @@ protected:
     //! User-supplied function called after a successful steady-state solve.
     Func1* m_steady_callback;
 
+    //! If true, solve() starts from a coarsened grid and works its way up
+    //! through the refinement levels. @see setCoarseToFine()
+    bool m_coarse_to_fine;
+
+    //! Stride of the initial coarse grid. @see setCoarseToFine()
+    size_t m_coarse_stride;
+
 private:
     /// Calls method _finalize in each domain.
     void finalize();
 
+    //! Hash of the domain and component structure, used to tag solution
+    //! library entries. @see saveToLibrary()
+    size_t structureHash() const;
+
     //! Wrapper around the Newton solver
     /*!
      * @return 0 if successful, -1 on failure
      */
     int newtonSolve(int loglevel);
+
+    //! Replace the grid of each domain with a coarsened version, keeping
+    //! every m_coarse_stride-th point, and subsample the solution vector
+    //! accordingly. Domains that are already coarse are left alone.
+    /*!
+     * @returns the number of grid points removed. @see setCoarseToFine()
+     */
+    int coarsen(int loglevel);
 };
 
 }
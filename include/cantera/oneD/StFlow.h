@@ -11,6 +11,8 @@
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/kinetics/Kinetics.h"
 
+#include <functional>
+
 namespace Cantera
 {
 
@@ -52,6 +54,8 @@ public:
         StFlow(th.get(), nsp, points) {
     }
 
+    virtual ~StFlow();
+
     //! @name Problem Specification
     //! @{
 
@@ -76,27 +80,58 @@ public:
     }
 
     //! Set the kinetics manager. The kinetics manager must
-    void setKinetics(Kinetics& kin) {
-        m_kin = &kin;
-    }
+    void setKinetics(Kinetics& kin);
 
     //! set the transport manager
     void setTransport(Transport& trans);
 
+    //! Set the number of threads used to evaluate thermodynamic, transport,
+    //! and kinetic properties over the grid points.
+    /*!
+     * The property evaluations at different grid points are independent, so
+     * they are distributed over *nThreads* worker threads, each holding its
+     * own copies of the phase, kinetics, and transport objects. A value of 0
+     * uses the hardware concurrency reported by the system; the default of 1
+     * evaluates everything serially on the caller's thread.
+     */
+    void setNumThreads(size_t nThreads);
+
     //! Enable thermal diffusion, also known as Soret diffusion.
     //! Requires that multicomponent transport properties be
     //! enabled to carry out calculations.
     void enableSoret(bool withSoret) {
         m_do_soret = withSoret;
+        invalidateTransportCache();
     }
     bool withSoret() const {
         return m_do_soret;
     }
 
+    //! Treat species whose mass fraction stays below *threshold* at every
+    //! grid point as trace species in the diffusive transport calculation
+    /*!
+     * Trace species share one bundled diffusivity (the average of their
+     * mixture-averaged values at each midpoint), are excluded from the
+     * correction flux that enforces \f$ \sum_k Y_k V_k = 0 \f$, and do not
+     * invalidate the cached transport properties when perturbed, which
+     * skips most transport updates during Jacobian evaluation for
+     * mechanisms dominated by trace species. The classification is
+     * recomputed from the current solution on each full residual
+     * evaluation. The resulting error in the trace diffusion fluxes is of
+     * the order of *threshold*. Only the mixture-averaged transport model
+     * is affected. Pass 0 to disable (the default).
+     */
+    void setTraceTransportThreshold(double threshold) {
+        m_traceThreshold = threshold;
+        m_isTrace.clear();
+        invalidateTransportCache();
+    }
+
     //! Set the pressure. Since the flow equations are for the limit of small
     //! Mach number, the pressure is very nearly constant throughout the flow.
     void setPressure(doublereal p) {
         m_press = p;
+        invalidateTransportCache();
     }
 
     //! The current pressure [Pa].
@@ -161,6 +196,7 @@ public:
     void setFreeFlow() {
         m_type = cFreeFlow;
         m_dovisc = false;
+        invalidateTransportCache();
     }
 
     //! Set flow configuration for axisymmetric counterflow or burner-stabilized
@@ -168,6 +204,7 @@ public:
     void setAxisymmetricFlow() {
         m_type = cAxisymmetricStagnationFlow;
         m_dovisc = true;
+        invalidateTransportCache();
     }
 
     //! Return the type of flow domain being represented, either "Free Flame" or
@@ -232,10 +269,18 @@ public:
     //! Set the gas object state to be consistent with the solution at point j.
     void setGas(const doublereal* x, size_t j);
 
+    //! Set the state of *gas* to be consistent with the solution at point j.
+    void setGas(ThermoPhase& gas, const doublereal* x, size_t j);
+
     //! Set the gas state to be consistent with the solution at the midpoint
     //! between j and j + 1.
     void setGasAtMidpoint(const doublereal* x, size_t j);
 
+    //! Set the state of *gas* to be consistent with the solution at the
+    //! midpoint between j and j + 1, using *ybar* as scratch storage.
+    void setGasAtMidpoint(ThermoPhase& gas, vector_fp& ybar,
+                          const doublereal* x, size_t j);
+
     doublereal density(size_t j) const {
         return m_rho[j];
     }
@@ -245,6 +290,7 @@ public:
     }
     void setViscosityFlag(bool dovisc) {
         m_dovisc = dovisc;
+        invalidateTransportCache();
     }
 
     /*!
@@ -287,11 +333,55 @@ protected:
         m_kin->getNetProductionRates(&m_wdot(0,j));
     }
 
+    //! Thermo, kinetics, and transport objects owned by one worker thread,
+    //! used for parallel property evaluation (see setNumThreads())
+    struct PropertyEvaluator {
+        std::unique_ptr<IdealGasPhase> thermo;
+        std::unique_ptr<Kinetics> kin;
+        std::unique_ptr<Transport> trans;
+        vector_fp ybar; //!< scratch storage for midpoint compositions
+    };
+
+    //! Construct the per-thread property evaluators in #m_evaluators by
+    //! cloning the phase, kinetics, and transport objects of this domain
+    void buildPropertyEvaluators();
+
+    //! Discard cached transport properties, forcing a full update on the
+    //! next call to updateTransport()
+    void invalidateTransportCache() {
+        m_transKeys.clear();
+    }
+
+    //! Apply *func* to the grid points *j0* through *j1* (inclusive), split
+    //! into contiguous ranges run as tasks on the shared thread pool.
+    /*!
+     * *func* is called as `func(i, jFirst, jLast)`, where `i` selects the
+     * evaluator the task may use (`i == 0` refers to the objects owned by
+     * the domain, `i > 0` to `m_evaluators[i-1]`), and `jFirst` and `jLast`
+     * bound the range of points assigned to the task. Each evaluator index
+     * is used by exactly one task, so the evaluators need no locking. If
+     * fewer than two tasks are worthwhile, *func* is called directly on the
+     * caller's thread. The first exception raised by any task is rethrown
+     * after all tasks have finished.
+     */
+    void forPointsParallel(size_t j0, size_t j1,
+                           const std::function<void(size_t, size_t, size_t)>& func);
+
     //! Update the properties (thermo, transport, and diffusion flux).
     //! This function is called in eval after the points which need
     //! to be updated are defined.
     virtual void updateProperties(size_t jg, double* x, size_t jmin, size_t jmax);
 
+    //! Tabulate the Planck mean absorption coefficient fits for CO2 and H2O
+    //! on a uniform temperature grid. Called once from the constructor.
+    void buildRadiationTable();
+
+    //! Evaluate the radiative heat loss #m_qdotRadiation for grid points
+    //! [jmin, jmax) in a single pass, using the tabulated absorption
+    //! coefficients. Called from updateProperties() when radiation is
+    //! enabled.
+    void computeRadiation(double* x, size_t jmin, size_t jmax);
+
     //! Evaluate the residual function. This function is called in eval
     //! after updateProperties is called.
     virtual void evalResidual(double* x, double* rsd, int* diag,
@@ -455,6 +545,18 @@ protected:
     //! radiative heat loss vector
     vector_fp m_qdotRadiation;
 
+    //! Planck mean absorption coefficients of H2O and CO2, tabulated on the
+    //! uniform temperature grid built by buildRadiationTable(). Evaluating
+    //! the radiation term then reduces to one linear interpolation per
+    //! species and point instead of the RADCAL polynomial fits.
+    vector_fp m_kPlanckH2O;
+    vector_fp m_kPlanckCO2;
+
+    //! Lower bound and inverse spacing of the tabulated temperature grid
+    doublereal m_radTmin;
+    doublereal m_radTmax;
+    doublereal m_radInvDT;
+
     // fixed T and Y values
     vector_fp m_fixedtemp;
     vector_fp m_zfix;
@@ -472,6 +574,15 @@ protected:
     //! to `j1`, based on solution `x`.
     virtual void updateTransport(doublereal* x, size_t j0, size_t j1);
 
+    //! Called by updateTransport() for each midpoint `j` whose cached
+    //! properties are being recomputed, with `gas` already set to the
+    //! midpoint state. Derived classes can evaluate additional per-point
+    //! transport properties here (for example, IonFlow's ion mobilities)
+    //! so they share the staleness tracking and thread partitioning of the
+    //! main property loop.
+    virtual void updateTransportPoint(ThermoPhase& gas, Transport& trans,
+                                      size_t j) {}
+
 public:
     //! Location of the point where temperature is fixed
     double m_zfixed;
@@ -479,8 +590,49 @@ public:
     //! Temperature at the point used to fix the flame location
     double m_tfixed;
 
+protected:
+    //! Number of threads used for property evaluation (see setNumThreads())
+    size_t m_nThreads;
+
+    //! Property evaluators for worker threads 1 through #m_nThreads - 1
+    std::vector<PropertyEvaluator> m_evaluators;
+
+    //! true if updateProperties() already evaluated the net production rates
+    //! at all required grid points, so that evalResidual() does not need to
+    //! evaluate them point-by-point
+    bool m_wdotUpdated;
+
+    //! @name Transport property cache
+    //! The temperature and mass fractions at each grid point for which the
+    //! transport properties were last evaluated (#m_nsp + 1 entries per
+    //! point), and per-midpoint flags marking cached values as out of date.
+    //! updateTransport() recomputes only the midpoints adjacent to a grid
+    //! point whose state has changed.
+    //!@{
+    vector_fp m_transKeys;
+    vector_int m_transStale;
+    //!@}
+
+    //! Mass-fraction threshold below which a species is treated as a trace
+    //! species for diffusive transport; 0 disables the classification. See
+    //! setTraceTransportThreshold().
+    double m_traceThreshold;
+
+    //! Per-species trace classification (nonzero entries mark trace
+    //! species); empty until classified in updateTransport()
+    vector_int m_isTrace;
+
 private:
     vector_fp m_ybar;
+
+    //! Scratch storage holding the mole fractions at each grid point as
+    //! contiguous columns, so that the diffusion flux loops read
+    //! unit-stride data instead of converting from mass fractions on every
+    //! access
+    Array2D m_xMole;
+
+    //! Scratch accumulator for the multicomponent flux summation
+    vector_fp m_fluxAcc;
 };
 
 }
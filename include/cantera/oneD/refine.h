@@ -69,6 +69,15 @@ public:
         return m_gridmin;
     }
 
+    //! Set the number of threads used to evaluate the refinement criteria
+    /*!
+     * The slope and curvature criteria of different solution components are
+     * independent, so analyze() distributes them over *n* threads. Pass 0
+     * to use the hardware concurrency of the machine. The default is a
+     * single thread.
+     */
+    void setNumThreads(size_t n);
+
     int analyze(size_t n, const doublereal* z, const doublereal* x);
     int getNewGrid(int n, const doublereal* z, int nn, doublereal* znew);
     int nNewPoints() {
@@ -107,6 +116,7 @@ protected:
     size_t m_nv, m_npmax;
     doublereal m_thresh;
     doublereal m_gridmin; //!< minimum grid spacing [m]
+    size_t m_nThreads; //!< number of threads used by analyze()
 };
 
 }
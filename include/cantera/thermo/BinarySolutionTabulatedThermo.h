@@ -154,6 +154,10 @@ protected:
     //! Species thermodynamics interpolation functions
     std::pair<double,double> interpolate(double x) const;
 
+    //! Build the uniform-grid acceleration index for the mole-fraction
+    //! table. Called after the tabulated data have been sorted and stored.
+    void buildInterpolationIndex();
+
     //! Current tabulated species index
     size_t m_kk_tab;
 
@@ -171,6 +175,35 @@ protected:
     vector_fp m_enthalpy_tab;
     vector_fp m_entropy_tab;
 
+    //! Uniform-grid acceleration index for the mole-fraction table
+    /*!
+     * m_lookup[j] holds the bracketing table interval for the left edge of
+     * the j'th cell of a uniform grid spanning the tabulated composition
+     * range, so interpolate() finds its interval in O(1) instead of with a
+     * binary search per thermo update.
+     */
+    std::vector<size_t> m_lookup;
+
+    //! Left edge of the uniform lookup grid
+    double m_lookupXlo;
+
+    //! Inverse cell width of the uniform lookup grid; 0 when no index has
+    //! been built
+    double m_lookupInvDx;
+
+    //! Upper table index of the interpolation interval the composition was
+    //! last found in; npos when invalid. While the composition stays inside
+    //! this interval, the cached coefficients below are reused without any
+    //! table lookup.
+    mutable size_t m_interval;
+
+    //! Cached interpolation coefficients for #m_interval: the enthalpy and
+    //! entropy at the lower table point and the slopes across the interval
+    mutable double m_hIntercept;
+    mutable double m_dhdx;
+    mutable double m_sIntercept;
+    mutable double m_dsdx;
+
 private:
     virtual void _updateThermo() const;
 };
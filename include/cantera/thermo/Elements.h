@@ -114,6 +114,20 @@ double getElementWeight(const std::string& ename);
  */
 double getElementWeight(int atomicNumber);
 
+//! Get the standard entropy of an element at 298.15 K and 1 bar
+/*!
+ * Get the entropy of an element in its most stable standard state, defined in
+ * Cantera by its symbol or by its name. The values are taken from the
+ * NIST-JANAF Thermochemical Tables and are the same data previously
+ * distributed in the 'elements.xml' input file, so that element lookups do
+ * not require parsing an XML database.
+ *
+ * @param ename String, name or symbol of the element
+ * @return The standard entropy of the element in J/kmol/K, or
+ *     #ENTROPY298_UNKNOWN if no value is tabulated for the element
+ */
+double getElementEntropy298(const std::string& ename);
+
 //! Get the symbol for an element
 /*!
  * Get the symbol for an element defined in Cantera by its name. This
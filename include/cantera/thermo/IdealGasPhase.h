@@ -315,6 +315,8 @@ public:
         return "IdealGas";
     }
 
+    virtual AnyMap memoryReport() const;
+
     //! String indicating the mechanical phase of the matter in this Phase.
     /*!
      * For the `IdealGasPhase`, this string is always `gas`.
@@ -275,6 +275,12 @@ public:
     virtual void getParameters(AnyMap& phaseNode) const;
     virtual void setParametersFromXML(const XML_Node& thermoNode);
 
+    //! @internal Not implemented: initialization depends on the root node of
+    //! the input file, which the generic clone does not replay
+    virtual std::unique_ptr<ThermoPhase> clone() const {
+        throw NotImplementedError("IonsFromNeutralVPSSTP::clone");
+    }
+
 private:
     //! Update the activity coefficients
     /*!
@@ -475,6 +481,30 @@ private:
      *  - Length =  numNeutralMoleculeSpecies_
      */
     mutable Array2D dlnActCoeffdlnN_NeutralMolecule_;
+
+    //! Ion mole fractions at the last neutral-molecule composition mapping
+    /*!
+     *  Used by compositionChanged() to skip the recalculation of the neutral
+     *  molecule mole fractions, and the push of that composition into the
+     *  neutral molecule phase, when the ionic composition has not actually
+     *  changed. Empty until the first mapping.
+     */
+    mutable vector_fp moleFractionsLast_;
+
+    //! Composition epoch of the neutral molecule phase at the last mapping
+    /*!
+     *  Holds the value of Phase::stateMFNumber() for the neutral molecule
+     *  phase after the last composition push. If the neutral phase has been
+     *  modified behind our back, the epoch no longer matches and the push is
+     *  repeated even for an unchanged ionic composition.
+     */
+    mutable int neutralStateNum_;
+
+    //! Composition epoch at the last update of lnActCoeff_Scaled_
+    mutable int lnActCoeffStateNum_;
+
+    //! Temperature at the last update of lnActCoeff_Scaled_
+    mutable doublereal lnActCoeffTemp_;
 };
 
 }
@@ -440,6 +440,12 @@ public:
 
     virtual void setParametersFromXML(const XML_Node& eosdata);
 
+    //! @internal Not implemented: initialization depends on the root node of
+    //! the input file, which the generic clone does not replay
+    virtual std::unique_ptr<ThermoPhase> clone() const {
+        throw NotImplementedError("LatticeSolidPhase::clone");
+    }
+
     //! Set the Lattice mole fractions using a string
     /*!
      * @param n  Integer value of the lattice whose mole fractions are being set
@@ -450,6 +456,7 @@ public:
 
     virtual void modifyOneHf298SS(const size_t k, const doublereal Hf298New);
     virtual void resetHf298(const size_t k=npos);
+    virtual void invalidateCache();
 
 protected:
     //! Current value of the pressure
@@ -476,6 +483,25 @@ protected:
 
     std::vector<size_t> lkstart_;
 
+    //! State epoch (see Phase::stateEpoch()) of each sublattice as of the
+    //! last time its state was pushed down by _updateThermo(). A mismatch
+    //! means the lattice was modified directly and must be re-synced.
+    mutable vector_int m_latticeEpoch;
+
+    //! Value of stateMFNumber() the last time the overall composition was
+    //! distributed to the sublattices
+    mutable int m_mflast;
+
+    //! Molar enthalpy, entropy and heat capacity summed over the
+    //! sublattices in a single traversal by _aggregateThermo()
+    mutable doublereal m_h_mole;
+    mutable doublereal m_s_mole;
+    mutable doublereal m_cp_mole;
+
+    //! True while #m_h_mole, #m_s_mole and #m_cp_mole correspond to the
+    //! current state of all sublattices
+    mutable bool m_propsValid;
+
     //! Root node of the AnyMap which contains this phase definition.
     //! Used to look up the phase definitions for the constituent phases.
     AnyMap m_rootNode;
@@ -483,6 +509,10 @@ protected:
 private:
     //! Update the reference thermodynamic functions
     void _updateThermo() const;
+
+    //! Recompute the cached molar enthalpy, entropy and heat capacity in
+    //! one pass over the sublattices
+    void _aggregateThermo() const;
 };
 }
 
@@ -298,6 +298,26 @@ public:
     virtual void setState_TR(doublereal T, doublereal rho);
     virtual void setState_TPX(doublereal t, doublereal p, const doublereal* x);
 
+    //! Solve for the density and phase state at a series of pressures
+    //! along an isotherm
+    /*!
+     * Each solve is warm-started from the previous converged root, so
+     * ordering the pressures monotonically lets property-table generation
+     * skip the phase-stability test and multi-root search for all but the
+     * first point. The object is left at the state of the last pressure.
+     *
+     * @param T        Temperature (kelvin)
+     * @param nPoints  Number of pressures to evaluate
+     * @param presPa   Vector of pressures (Pa). Length: nPoints.
+     * @param rho      Output vector of converged densities (kg/m^3).
+     *                 Length: nPoints.
+     * @param phase    Output vector of phase states (FLUID_GAS,
+     *                 FLUID_LIQUID_0, ...). May be 0 if not needed.
+     *                 Length: nPoints.
+     */
+    void solveIsotherm(doublereal T, size_t nPoints, const doublereal* presPa,
+                       doublereal* rho, int* phase);
+
 protected:
     virtual void compositionChanged();
     void setMoleFractions_NoState(const doublereal* const x);
@@ -556,6 +576,25 @@ protected:
     //! Force the system to be on a particular side of the spinodal curve
     int forcedState_;
 
+    //! Temperature of the last converged setState_TP() root (kelvin).
+    //! Negative if no root has been cached yet.
+    doublereal m_lastSolnTemp;
+
+    //! Pressure of the last converged setState_TP() root (Pa)
+    doublereal m_lastSolnPres;
+
+    //! Density of the last converged setState_TP() root (kg/m^3)
+    /*!
+     * Together with the cached (T, P) and the mole fraction state number,
+     * this lets setState_TP() seed the density solve from the previous
+     * root and skip the phase-stability test when the new state is a
+     * small step away, as in a smooth isotherm traversal.
+     */
+    doublereal m_lastSolnRho;
+
+    //! Mole fraction state number at which the cached root was obtained
+    int m_lastSolnStateNum;
+
     //! The last temperature at which the reference state thermodynamic
     //! properties were calculated at.
     mutable doublereal m_Tlast_ref;
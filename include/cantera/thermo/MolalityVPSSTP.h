@@ -426,6 +426,25 @@ public:
      */
     virtual void getMolalityActivityCoefficients(doublereal* acMolality) const;
 
+    //! Compute molality-based activity coefficients for a batch of
+    //! compositions at the current temperature and pressure
+    /*!
+     * This is a driver for evaluating many grid cells that share T and P in
+     * one call. The standard state properties and the (T, P)-dependent
+     * interaction parameters are brought up to date once before the loop and
+     * stay cached across the composition-only updates inside it, so each
+     * point only pays for the composition-dependent activity sums. The
+     * composition of the phase is restored on return.
+     *
+     * @param nPts        Number of composition points to evaluate
+     * @param X           Array of mole fractions, point-major; length
+     *                    nPts * nSpecies()
+     * @param acMolality  Output array of molality based activity
+     *                    coefficients, point-major; length nPts * nSpecies()
+     */
+    void getMolalityActivityCoefficientsBatch(size_t nPts, const doublereal* X,
+                                              doublereal* acMolality);
+
     //! Calculate the osmotic coefficient
     /*!
      * \f[
@@ -188,6 +188,13 @@ public:
     //! Check if data for all species (0 through nSpecies-1) has been installed.
     bool ready(size_t nSpecies);
 
+    //! Number of calls made to update() and update_single() since this
+    //! manager was constructed. This cheap counter is always maintained and
+    //! is reported by Kinetics::statistics() for performance tracking.
+    size_t nUpdateCalls() const {
+        return m_nUpdates;
+    }
+
 private:
     //! Provide the SpeciesThermoInterpType object
     /*!
@@ -197,10 +204,25 @@ private:
     SpeciesThermoInterpType* provideSTIT(size_t k);
     const SpeciesThermoInterpType* provideSTIT(size_t k) const;
 
+    //! Provide the SpeciesThermoInterpType object for species *k*, replacing
+    //! it with a private copy first if it is shared with other managers (see
+    //! newSpeciesThermoShared), so that in-place modifications do not leak
+    //! into other phases built from the same species definitions.
+    SpeciesThermoInterpType* detachSTIT(size_t k);
+
 protected:
     //! Mark species *k* as having its thermodynamic data installed
     void markInstalled(size_t k);
 
+    //! Update properties for all species using the NASA2 parameterization,
+    //! evaluating the polynomials from the packed coefficient table
+    void updateNasa2(doublereal t, doublereal* cp_R, doublereal* h_RT,
+                     doublereal* s_R) const;
+
+    //! Rebuild the packed structure-of-arrays coefficient table for species
+    //! using the NASA2 parameterization
+    void buildNasa2Table() const;
+
     typedef std::pair<size_t, shared_ptr<SpeciesThermoInterpType> > index_STIT;
     typedef std::map<int, std::vector<index_STIT> > STIT_map;
     typedef std::map<int, vector_fp> tpoly_map;
@@ -228,6 +250,44 @@ protected:
     //! reference pressure (Pa)
     doublereal m_p0;
 
+    //! @name Packed NASA2 coefficient table
+    //! Coefficients for all species using the NASA2 parameterization, stored
+    //! as one contiguous block per temperature branch so that update() can
+    //! evaluate all of them in a single pass instead of dispatching through
+    //! the per-species NasaPoly2 objects. Built on demand by
+    //! buildNasa2Table(); invalidated whenever a parameterization is
+    //! installed or modified.
+    //!@{
+    mutable std::vector<size_t> m_nasa2_index; //!< species index of each row
+    mutable vector_fp m_nasa2_tmid; //!< midpoint temperature of each row
+    mutable vector_fp m_nasa2_clow; //!< low-T coefficients, 7 per row
+    mutable vector_fp m_nasa2_chigh; //!< high-T coefficients, 7 per row
+
+    //! True if every installed parameterization is NASA2, detected at
+    //! install time. update() then goes straight to the packed-table kernel
+    //! with no per-group dispatch at all.
+    bool m_allNasa2;
+    mutable bool m_nasa2_ok; //!< true if the table is up to date
+
+    //! Coefficients selected for the current temperature branch of each row.
+    //! Refreshed by selectNasa2Branches() only when the temperature crosses a
+    //! midpoint temperature, so the evaluation loop in updateNasa2() runs
+    //! without per-species branching.
+    mutable vector_fp m_nasa2_csel;
+
+    //! Temperature interval (#m_nasa2_tsel_low, #m_nasa2_tsel_high] over
+    //! which the branch selection in #m_nasa2_csel remains valid
+    mutable double m_nasa2_tsel_low;
+    mutable double m_nasa2_tsel_high; //!< see #m_nasa2_tsel_low
+    //!@}
+
+    //! Number of update() and update_single() calls; see nUpdateCalls()
+    mutable size_t m_nUpdates;
+
+    //! Copy the coefficients for the temperature branch containing *t* into
+    //! #m_nasa2_csel and update the selection's validity interval
+    void selectNasa2Branches(doublereal t) const;
+
     //! indicates if data for species has been installed
     std::vector<bool> m_installed;
 };
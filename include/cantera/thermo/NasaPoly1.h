@@ -17,6 +17,7 @@
 #include "SpeciesThermoInterpType.h"
 #include "cantera/thermo/speciesThermoTypes.h"
 #include "cantera/base/AnyMap.h"
+#include "cantera/base/fastmath.h"
 
 namespace Cantera
 {
@@ -86,7 +87,7 @@ public:
         T_poly[2] = T_poly[1] * T;
         T_poly[3] = T_poly[2] * T;
         T_poly[4] = 1.0 / T;
-        T_poly[5] = std::log(T);
+        T_poly[5] = fast_log(T);
     }
 
     /*!
@@ -232,6 +232,24 @@ private:
     doublereal gstar(const doublereal temp, const doublereal pres,
                      const int ifunc = 0) const;
 
+    //! Evaluate the relative dielectric constant of water, memoized
+    /*!
+     * Thin caching wrapper around WaterProps::relEpsilon(). The property
+     * methods each request several of the same solvent Born-term values
+     * per state, and every uncached call re-solves the water equation of
+     * state; the four ifunc variants are memoized until (T, P) changes.
+     *
+     * @param temp      Temperature kelvin
+     * @param pres      Pressure (pascal)
+     * @param ifunc     parameters specifying the desired information
+     *                 - 0 function value
+     *                 - 1 derivative wrt temperature
+     *                 - 2 2nd derivative wrt temperature
+     *                 - 3 derivative wrt pressure
+     */
+    doublereal relEpsilon(const doublereal temp, const doublereal pres,
+                          const int ifunc = 0) const;
+
     //! Function to look up Element Free Energies
     /*!
      * This function looks up the argument string in the element database and
@@ -264,6 +282,25 @@ private:
     //! density of standard-state water. internal temporary variable
     mutable doublereal m_densWaterSS;
 
+    //! Temperature and pressure of the cached gstar() and relEpsilon()
+    //! values. The g-function and the solvent Born terms depend only on
+    //! (T, P) through the water equation of state, so their four ifunc
+    //! variants are memoized until the state changes.
+    mutable doublereal m_solvCacheTemp;
+    mutable doublereal m_solvCachePres;
+
+    //! Cached gstar() values for ifunc = 0..3
+    mutable doublereal m_gstarCache[4];
+
+    //! Validity flags for #m_gstarCache
+    mutable bool m_gstarValid[4];
+
+    //! Cached relEpsilon() values for ifunc = 0..3
+    mutable doublereal m_relEpsCache[4];
+
+    //! Validity flags for #m_relEpsCache
+    mutable bool m_relEpsValid[4];
+
     //!  Pointer to the water property calculator
     std::unique_ptr<WaterProps> m_waterProps;
 
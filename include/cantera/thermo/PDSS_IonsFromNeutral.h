@@ -80,6 +80,7 @@ public:
     //! @{
 
     virtual void setState_TP(doublereal temp, doublereal pres);
+    virtual void setPressure(doublereal pres);
 
     //! @}
     //! @name Initialization of the Object
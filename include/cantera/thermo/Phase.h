@@ -13,9 +13,12 @@
 #include "cantera/thermo/Elements.h"
 #include "cantera/base/ValueCache.h"
 
+#include <unordered_map>
+
 namespace Cantera
 {
 
+class AnyMap;
 class Solution;
 class Species;
 class XML_Node;
@@ -113,13 +116,24 @@ public:
     //! Returns a const reference to the XML_Node that describes the phase.
     /*!
      *  The XML_Node for the phase contains all of the input data used to set up
-     *  the model for the phase during its initialization.
+     *  the model for the phase during its initialization. The tree is created
+     *  lazily on the first call, so phases built from YAML input never
+     *  allocate XML_Node objects; use hasXMLdata() to test for the presence
+     *  of XML input data without triggering the allocation.
      *
      * @deprecated The XML input format is deprecated and will be removed in
      *     Cantera 3.0.
      */
     XML_Node& xml() const;
 
+    //! Returns `true` if an XML tree has been created for this phase, either
+    //! by setXMLdata() or by a previous call to xml().
+    /*!
+     * @deprecated The XML input format is deprecated and will be removed in
+     *     Cantera 3.0.
+     */
+    bool hasXMLdata() const;
+
     //! Stores the XML tree information for the current phase
     /*!
      *  This function now stores the complete XML_Node tree as read into the
@@ -308,6 +322,12 @@ public:
     //! and restoreState().
     virtual std::map<std::string, size_t> nativeState() const;
 
+    //! Return a cached copy of the map returned by nativeState(). The native
+    //! state definition is fixed once a phase has been constructed, while
+    //! nativeState() builds its map on every call, so allocation-sensitive
+    //! callers such as saveState() and restoreState() use this cache instead.
+    const std::map<std::string, size_t>& nativeStateCache() const;
+
     //! Return a vector containing full states defining a phase.
     //! Full states list combinations of properties that allow for the
     //! specification of a thermodynamic state based on user input.
@@ -357,6 +377,77 @@ public:
     //!     @param state      Vector of state conditions.
     virtual void restoreState(size_t lenstate, const doublereal* state);
 
+    //! Length of the raw state vector used by saveStateRaw() and
+    //! restoreStateRaw(): temperature, density and mean molecular weight,
+    //! followed by the mass fractions and the mole fraction / mean molecular
+    //! weight ratios, each of length nSpecies().
+    size_t rawStateSize() const {
+        return 3 + 2 * m_kk;
+    }
+
+    //! Save the internal state of the phase in raw form.
+    /*!
+     * Writes the internally stored representation of the state, including
+     * the derived composition arrays, to *state* without any conversion.
+     * Together with restoreStateRaw() this gives the cheapest possible state
+     * interchange between two phases of the same mechanism -- a straight
+     * copy with no normalization and no recomputation of the mean molecular
+     * weight -- as needed when an operator-split solver shuttles every cell
+     * of a large grid through a working phase on each step. The layout is an
+     * implementation detail and should only be consumed by restoreStateRaw()
+     * of a compatible phase; use saveState() for a stable representation.
+     *     @param state  output array, of length rawStateSize() or greater
+     */
+    void saveStateRaw(doublereal* state) const;
+
+    //! Variant of saveStateRaw() writing entry *iState* of a packed array of
+    //! raw states, each of length rawStateSize(), as used when the states of
+    //! many cells are stored contiguously.
+    void saveStateRaw(size_t iState, doublereal* states) const {
+        saveStateRaw(states + iState * rawStateSize());
+    }
+
+    //! Restore a state written by saveStateRaw() of a compatible phase.
+    /*!
+     * No validation or normalization is performed beyond invalidating the
+     * cached properties. The caller is responsible for establishing
+     * compatibility once per source/destination pair with
+     * checkRawStateCompatibility(); after that, states may be exchanged
+     * freely in either direction.
+     *     @param state  array written by saveStateRaw()
+     */
+    void restoreStateRaw(const doublereal* state);
+
+    //! Variant of restoreStateRaw() reading entry *iState* of a packed array
+    //! of raw states, each of length rawStateSize().
+    void restoreStateRaw(size_t iState, const doublereal* states) {
+        restoreStateRaw(states + iState * rawStateSize());
+    }
+
+    //! Check that raw states are interchangeable between this phase and
+    //! *other*.
+    /*!
+     * Throws a CanteraError if the two phases do not have identical species
+     * lists. The verdict is cached, so repeating the call before every
+     * restoreStateRaw() -- the natural pattern in a per-cell loop -- costs a
+     * pointer comparison after the first check; the full check is redone if
+     * either phase's species list has changed since it was last accepted.
+     *     @param other  phase whose raw states are to be exchanged with this
+     *                   one's
+     */
+    void checkRawStateCompatibility(const Phase& other) const;
+
+    //! Copy the internal state of this phase directly into *dest*.
+    /*!
+     * Equivalent to calling dest.restoreStateRaw() on the output of
+     * saveStateRaw(), without the intermediate buffer. Compatibility is
+     * established with checkRawStateCompatibility() on the first call for
+     * each destination; subsequent calls are a straight copy.
+     *     @param dest  phase receiving the state. Must describe the same
+     *                  species, in the same order.
+     */
+    void copyStateTo(Phase& dest) const;
+
     /*! @name Set thermodynamic state
      * Set the internal thermodynamic state by setting the internally stored
      * temperature, density and species composition. Note that the composition
@@ -414,6 +505,28 @@ public:
     //!                  a zero mass fraction.
     void setState_TRY(doublereal t, doublereal dens, const compositionMap& y);
 
+    //! Fast setState_TRY() variant for trusted, already-valid input
+    /*!
+     * Copies the mass fractions without the normalization and clamping of
+     * negative values done by setMassFractions(), recomputes the cached mean
+     * molecular weight in the same pass, and updates the temperature,
+     * density and state epochs directly. This is intended for callers that
+     * restore a state vector the phase itself produced — ReactorNet and the
+     * 1D solver update the state this way millions of times per run with
+     * data that is valid by construction. In debug builds (without NDEBUG)
+     * the input is validated; release builds trust the caller.
+     *
+     * The temperature is stored without calling the virtual
+     * setTemperature(), so this method must not be used with phases that
+     * override it to update auxiliary state (for example the
+     * VPStandardStateTP family).
+     *
+     *     @param t     Temperature in kelvin
+     *     @param dens  Density (kg/m^3)
+     *     @param y     vector of valid species mass fractions, length m_kk
+     */
+    void setState_TRY_raw(doublereal t, doublereal dens, const doublereal* y);
+
     //! Set the internally stored temperature (K), molar density (kmol/m^3), and
     //! mole fractions.
     //!     @param t     Temperature in kelvin
@@ -509,6 +622,14 @@ public:
     //!          length greater than or equal to the number of species.
     void getMoleFractions(double* const x) const;
 
+    //! Return a reference to an internally cached mole fraction vector.
+    //! The cache is refreshed lazily, at most once per composition change
+    //! (see stateMFNumber()), so transport and kinetics updates evaluating
+    //! the same state share a single conversion from the stored mass
+    //! fractions. The reference remains valid until the composition or the
+    //! number of species changes.
+    const vector_fp& moleFractions() const;
+
     //! Set the mole fractions to the specified values.
     //! There is no restriction on the sum of the mole fraction vector.
     //! Internally, the Phase object will normalize this vector before storing
@@ -547,6 +668,15 @@ public:
     //!     @param y  Input vector of mass fractions. Length is m_kk.
     virtual void setMassFractions_NoNorm(const double* const y);
 
+    //! Set the mass fractions of a subset of the species, specified by index.
+    //! Species not listed are set to zero, and the resulting composition is
+    //! normalized. This is equivalent to setMassFractionsByName(), but avoids
+    //! any string handling, for callers that update the composition repeatedly.
+    //!     @param n   Number of species being set
+    //!     @param ks  Array of n species indices
+    //!     @param ys  Array of n unnormalized mass fraction values
+    void setMassFractionsByIndex(size_t n, const size_t* ks, const double* ys);
+
     //! Get the species concentrations (kmol/m^3).
     /*!
      *    @param[out] c The vector of species concentrations. Units are
@@ -555,6 +685,12 @@ public:
      */
     void getConcentrations(double* const c) const;
 
+    //! Return a reference to an internally cached concentration vector
+    //! (kmol/m^3). Like moleFractions(), the cache is refreshed at most once
+    //! per change of composition or density, so repeated calls within one
+    //! state evaluation do not repeat the conversion.
+    const vector_fp& concentrations() const;
+
     //! Concentration of species k.
     //! If k is outside the valid range, an exception will be thrown.
     /*!
@@ -711,6 +847,9 @@ public:
     //!     @param temp Temperature in Kelvin
     virtual void setTemperature(const doublereal temp) {
         if (temp > 0) {
+            if (temp != m_temp) {
+                m_tempEpoch++;
+            }
             m_temp = temp;
         } else {
             throw CanteraError("Phase::setTemperature",
@@ -779,6 +918,21 @@ public:
     //! @see ignoreUndefinedElements addUndefinedElements throwUndefinedElements
     virtual bool addSpecies(shared_ptr<Species> spec);
 
+    //! Add all species in *species* to the phase in one pass
+    /*!
+     * Equivalent to calling addSpecies() for each entry in order, but faster
+     * for large mechanisms: storage for the per-species tables is reserved
+     * once, and any elements the compositions would add implicitly (see
+     * addUndefinedElements()) are added up front, so the element composition
+     * table is laid out once instead of being rebuilt every time a species
+     * introduces a new element.
+     *
+     * @returns the number of species actually added. As for addSpecies(),
+     *     species containing undefined elements are skipped when the phase
+     *     ignores undefined elements.
+     */
+    virtual size_t addSpeciesBulk(const std::vector<shared_ptr<Species>>& species);
+
     //! Modify the thermodynamic data associated with a species.
     /*!
      * The species name, elemental composition, and type of thermo
@@ -845,10 +999,48 @@ public:
         return m_stateNum;
     }
 
+    //! Return the temperature epoch counter, which is incremented every time
+    //! the temperature of the phase is changed. Cached values that depend
+    //! only on the temperature can be validated by comparing this single
+    //! integer instead of the temperature itself.
+    int temperatureEpoch() const {
+        return m_tempEpoch;
+    }
+
+    //! Return the density epoch counter, which is incremented every time the
+    //! density of the phase is changed
+    int densityEpoch() const {
+        return m_densEpoch;
+    }
+
+    //! Return the epoch counter for the full thermodynamic state
+    /*!
+     * Every change to the temperature, density, or composition of the phase
+     * increments this counter, so a cached value that depends on the full
+     * state can be validated by comparing a single integer, e.g. with
+     * CachedValue::validate(int). The individual counters only increase, so
+     * their sum does as well, and no combination of changes can return it to
+     * a previous value.
+     */
+    int stateEpoch() const {
+        return m_tempEpoch + m_densEpoch + m_stateNum;
+    }
+
     //! Invalidate any cached values which are normally updated only when a
     //! change in state is detected
     virtual void invalidateCache();
 
+    //! Report the heap memory held by this object's data tables
+    /*!
+     * Returns an AnyMap with byte counts for the species and element tables
+     * and the state vectors, plus the number of Species definition objects
+     * that are shared with other phases (and therefore cost nothing extra
+     * per instance). Derived classes extend the map with their own caches.
+     * The counts cover the containers owned directly by this object; they
+     * are intended for capacity planning, not exact accounting.
+     */
+    virtual AnyMap memoryReport() const;
+
     //! Returns `true` if case sensitive species names are enforced
     bool caseSensitiveSpecies() const {
         return m_caseSensitiveSpecies;
@@ -907,6 +1099,10 @@ protected:
      */
     mutable ValueCache m_cache;
 
+    //! Cached copy of the nativeState() map, built on first use; see
+    //! nativeStateCache()
+    mutable std::map<std::string, size_t> m_nativeState;
+
     //! Set the molecular weight of a single species to a given value.
     //!
     //! Used by phases where the equation of state is defined for a specific
@@ -952,7 +1148,9 @@ private:
     //! species name. Raise exception if lowercase name is not unique.
     size_t findSpeciesLower(const std::string& nameStr) const;
 
-    XML_Node* m_xml; //!< XML node containing the XML info for this phase
+    //! XML node containing the XML info for this phase. Null until XML data
+    //! is stored or requested; see xml().
+    mutable XML_Node* m_xml;
 
     //! ID of the phase. This is the value of the ID attribute of the XML
     //! phase node. The field will stay that way even if the name is changed.
@@ -993,14 +1191,38 @@ private:
     //! this int is incremented.
     int m_stateNum;
 
+    //! Incremented every time the temperature is changed. @see stateEpoch()
+    int m_tempEpoch;
+
+    //! Incremented every time the density is changed. @see stateEpoch()
+    int m_densEpoch;
+
+    //! Cached mole fraction vector returned by moleFractions(), with the
+    //! value of m_stateNum at which it was last refreshed
+    mutable vector_fp m_x_cache;
+    mutable int m_x_cacheNum;
+
+    //! Cached concentration vector returned by concentrations(), with the
+    //! composition and density epochs at which it was last refreshed
+    mutable vector_fp m_conc_cache;
+    mutable int m_conc_cacheNum;
+    mutable int m_conc_cacheDens;
+
+    //! Peer accepted by the last checkRawStateCompatibility() call, together
+    //! with the species counts of both phases at the time of the check
+    mutable const Phase* m_rawPeer;
+    mutable size_t m_rawPeerKK; //!< species count of m_rawPeer when checked
+    mutable size_t m_rawSelfKK; //!< species count of this phase when checked
+
     //! Vector of the species names
     std::vector<std::string> m_speciesNames;
 
-    //! Map of species names to indices
-    std::map<std::string, size_t> m_speciesIndices;
+    //! Hash map of species names to indices, giving constant average-time
+    //! lookups in speciesIndex()
+    std::unordered_map<std::string, size_t> m_speciesIndices;
 
-    //! Map of lower-case species names to indices
-    std::map<std::string, size_t> m_speciesLower;
+    //! Hash map of lower-case species names to indices
+    std::unordered_map<std::string, size_t> m_speciesLower;
 
     size_t m_mm; //!< Number of elements.
     vector_fp m_atomicWeights; //!< element atomic weights (kg kmol-1)
@@ -60,6 +60,14 @@ public:
         m_tpx_name = name;
     }
 
+    //! Replace the exact tpx substance with a tabulated wrapper. Property
+    //! evaluations then use second-order Taylor expansions about the nodes of
+    //! a precomputed (T, rho) table, which is much faster than iterating the
+    //! full equation of state; states outside the table fall back to exact
+    //! evaluation. Must be called after initThermo(). @param np number of
+    //! table nodes per dimension.
+    void useTabulatedEOS(size_t np = 120);
+
     virtual bool isPure() const {
         return true;
     }
@@ -301,6 +301,31 @@ public:
     int NicholsSolve(double TKelvin, double pres, doublereal a, doublereal b,
                      doublereal Vroot[3]) const;
 
+    //! Solve the equation of state for a batch of (T, P) points at the current
+    //! composition
+    /*!
+     * The mixing rules are aggregated once, so the per-point cost is
+     * independent of the number of species, and each point is solved with the
+     * analytic cubic solution rather than the iterative density solve used by
+     * setState_TP(). The object state is not modified. This is intended for
+     * generating property tables over many states at a fixed composition.
+     *
+     * @param n          Number of states to evaluate
+     * @param TKelvin    Array of n temperatures (K)
+     * @param presPa     Array of n pressures (Pa)
+     * @param phase      Phase branch to select where the cubic has multiple
+     *                   real roots; one of the FLUID_* constants. FLUID_GAS
+     *                   selects the largest root and FLUID_LIQUID_0 the
+     *                   smallest.
+     * @param molarVols  Output array of n molar volumes (m^3/kmol)
+     * @param fugCoeffs  If non-null, output array of n mixture fugacity
+     *                   coefficients
+     */
+    void getMolarVolumesAndFugacities(size_t n, const doublereal* TKelvin,
+                                      const doublereal* presPa, int phase,
+                                      doublereal* molarVols,
+                                      doublereal* fugCoeffs=0) const;
+
 protected:
     //! Form of the temperature parameterization
     /*!
@@ -61,6 +61,24 @@ SpeciesThermoInterpType* newSpeciesThermoInterpType(const XML_Node& thermoNode);
  */
 unique_ptr<SpeciesThermoInterpType> newSpeciesThermo(const AnyMap& thermo_node);
 
+//! Create a new SpeciesThermoInterpType object using the specified parameters,
+//! sharing a single immutable object among all species whose parameterizations
+//! are identical
+/*!
+ * The same species definitions are frequently imported many times over the
+ * lifetime of a process, for example when a large ensemble of phases is built
+ * from one mechanism. This function maintains a pool of previously-created
+ * parameterizations and returns the pooled object when the model type,
+ * temperature bounds, reference pressure, coefficients, and input data all
+ * match, so each distinct coefficient table is stored only once. Managers
+ * that need to modify a shared parameterization make a private copy first;
+ * see MultiSpeciesThermo::modifyOneHf298().
+ *
+ * @param thermo_node  An AnyMap specifying the model type (e.g. "NASA") and any
+ *                     model parameters necessary to instantiate the object
+ */
+shared_ptr<SpeciesThermoInterpType> newSpeciesThermoShared(const AnyMap& thermo_node);
+
 }
 
 #endif
@@ -386,9 +386,39 @@ public:
      *
      * @param theta    This is the surface site fraction for the kth species in
      *                 the surface phase. This is a dimensionless quantity.
+     *
+     * If the given coverages are identical to the ones most recently applied
+     * through this method and the phase state has not been changed since (as
+     * determined by Phase::stateEpoch()), the call is a no-op, so caches
+     * downstream of the phase (e.g. in InterfaceKinetics) stay valid.
      */
     void setCoveragesNoNorm(const doublereal* theta);
 
+    //! Evaluate the chemical potentials for an array of coverage vectors in
+    //! one pass
+    /*!
+     * Equivalent to calling setTemperature(), setCoverages(), and
+     * getChemPotentials() for each state in turn, but without modifying the
+     * composition of the phase and without re-evaluating the standard-state
+     * thermo for states that share a temperature. Intended for spatially
+     * discretized surfaces (e.g. washcoat cells) that query many coverage
+     * states on the same phase object.
+     *
+     * The temperature of the phase is restored on return; the coverages of
+     * the phase are never modified.
+     *
+     * @param[in] nStates  Number of states to evaluate
+     * @param[in] T        Temperatures. Length nStates.
+     * @param[in] theta    Surface site fractions, stored contiguously per
+     *                     state. Each state's coverages are normalized to
+     *                     sum to one, as in setCoverages(). Length
+     *                     nStates * nSpecies().
+     * @param[out] mu      Chemical potentials (J/kmol), stored contiguously
+     *                     per state. Length nStates * nSpecies().
+     */
+    void getChemPotentialsBatch(size_t nStates, const doublereal* T,
+                                const doublereal* theta, doublereal* mu);
+
     //! Set the coverages from a string of colon-separated name:value pairs.
     /*!
      *  @param cov  String containing colon-separated name:value pairs
@@ -448,6 +478,14 @@ protected:
      */
     mutable vector_fp m_logsize;
 
+    //! Raw coverages most recently applied by setCoveragesNoNorm(), used
+    //! with #m_covEpoch to turn repeated identical updates into no-ops
+    vector_fp m_covLast;
+
+    //! Value of Phase::stateEpoch() just after #m_covLast was applied, or
+    //! -1 if the state has not been set through setCoveragesNoNorm()
+    int m_covEpoch = -1;
+
 private:
     //! Update the species reference state thermodynamic functions
     /*!
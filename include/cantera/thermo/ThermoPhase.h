@@ -1582,6 +1582,14 @@ public:
 
     virtual bool addSpecies(shared_ptr<Species> spec);
 
+    //! @copydoc Phase::addSpeciesBulk
+    /*!
+     * The thermo data of every species is checked for presence before any
+     * species is installed, so a missing parameterization does not leave the
+     * phase partially constructed.
+     */
+    virtual size_t addSpeciesBulk(const std::vector<shared_ptr<Species>>& species);
+
     virtual void modifySpecies(size_t k, shared_ptr<Species> spec);
 
     //! Store a reference pointer to the XML tree containing the species data
@@ -1683,6 +1691,25 @@ public:
      */
     virtual void initThermo();
 
+    //! Create a new ThermoPhase initialized as a copy of this one.
+    /*!
+     * The clone is built by instantiating a fresh phase of the same model,
+     * sharing the immutable element and Species data of this phase instead
+     * of re-parsing it, replaying the stored input() data through
+     * setParameters()/initThermo() for model-specific configuration, and
+     * copying the thermodynamic state. This is orders of magnitude faster
+     * than re-importing the phase from an input file, and is used by
+     * newPhase() when the same phase definition is constructed repeatedly,
+     * as ensemble drivers do.
+     *
+     * The base implementation covers phases fully described by their
+     * elements, species and input() data, including the standard-state
+     * models of VPStandardStateTP phases. Models holding configuration that
+     * is not recoverable this way (e.g. data read from the root of the
+     * input file) need to override this method.
+     */
+    virtual std::unique_ptr<ThermoPhase> clone() const;
+
     //! Set the equation of state parameters
     /*!
      * @internal The number and meaning of these depends on the subclass.
@@ -1716,6 +1743,8 @@ public:
     //!   file, as returned by the input() method.
     AnyMap parameters(bool withInput=true) const;
 
+    virtual AnyMap memoryReport() const;
+
     //! Get phase-specific parameters of a Species object such that an
     //! identical one could be reconstructed and added to this phase.
     /*!
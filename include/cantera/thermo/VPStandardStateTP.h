@@ -216,6 +216,21 @@ protected:
      */
     virtual void _updateStandardStateThermo() const;
 
+    //! Updates the standard state thermodynamic functions for a change in
+    //! pressure at constant temperature.
+    /*!
+     * @internal
+     *
+     * This is the inexpensive half of _updateStandardStateThermo(). It may
+     * only be called when the reference-state (temperature-dependent)
+     * properties held by the PDSS objects are already current, and propagates
+     * the pressure change through PDSS::setPressure() without re-evaluating
+     * the species thermo polynomials. It updates the same standard-state
+     * members as _updateStandardStateThermo(), but not the reference-state
+     * members.
+     */
+    virtual void _updateStandardStatePressure() const;
+
 public:
     /// @name Thermodynamic Values for the Species Reference States
     /*!
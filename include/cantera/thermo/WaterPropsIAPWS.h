@@ -12,6 +12,7 @@
 #define WATERPROPSIAPWS_H
 
 #include "WaterPropsIAPWSphi.h"
+#include "cantera/base/ct_defs.h"
 
 namespace Cantera
 {
@@ -266,6 +267,33 @@ public:
      */
     doublereal density_const(doublereal pressure, int phase = -1, doublereal rhoguess = -1.0) const;
 
+    //! Build a tabulated fast path for the liquid-branch density solve
+    /*!
+     * Precomputes liquid (or supercritical) densities on a regular (T, P)
+     * grid covering the given operating window. Subsequent calls to density()
+     * or density_const() with a liquid or supercritical phase guess and a
+     * state inside the window start the iterative solve from a bicubic
+     * interpolation of the table instead of the generic initial guess, which
+     * typically converges in a single evaluation of the IAPWS-95
+     * formulation. States outside the window, and phase guesses the table
+     * does not cover, proceed exactly as before, and the converged result is
+     * always that of the exact formulation, so building a table does not
+     * alter any computed property.
+     *
+     * @param Tmin   Lower temperature bound of the window (Kelvin)
+     * @param Tmax   Upper temperature bound of the window (Kelvin)
+     * @param Pmin   Lower pressure bound of the window (Pascals)
+     * @param Pmax   Upper pressure bound of the window (Pascals)
+     * @param nT     Number of temperature grid points (at least 4)
+     * @param nP     Number of pressure grid points (at least 4)
+     */
+    void setupDensityTable(doublereal Tmin, doublereal Tmax,
+                           doublereal Pmin, doublereal Pmax,
+                           size_t nT = 25, size_t nP = 25);
+
+    //! Remove the table built by setupDensityTable()
+    void clearDensityTable();
+
     //! Returns the density (kg m-3)
     /*!
      * The density is an independent variable in the underlying equation of state
@@ -429,6 +457,32 @@ private:
     void corr1(doublereal temperature, doublereal pressure, doublereal& densLiq,
                doublereal& densGas, doublereal& pcorr);
 
+    //! Interpolate the density table built by setupDensityTable()
+    /*!
+     * @param temperature   temperature (kelvin)
+     * @param pressure      pressure (Pascal)
+     * @returns the bicubically interpolated density, or -1.0 if the state is
+     *     outside the tabulated window or no usable table entries cover it
+     */
+    doublereal tableDensityGuess(doublereal temperature, doublereal pressure) const;
+
+    //! Liquid-branch densities on the grid built by setupDensityTable();
+    //! empty if no table has been built. Entries are -1.0 where the density
+    //! solve failed during the table fill.
+    vector_fp m_rhoTable;
+
+    //! Number of temperature points in #m_rhoTable
+    size_t m_nTab_T;
+
+    //! Number of pressure points in #m_rhoTable
+    size_t m_nTab_P;
+
+    //! Temperature bounds of the tabulated window (Kelvin)
+    doublereal m_tabTmin, m_tabTmax;
+
+    //! Pressure bounds of the tabulated window (Pascals)
+    doublereal m_tabPmin, m_tabPmax;
+
     //! pointer to the underlying object that does the calculations.
     mutable WaterPropsIAPWSphi m_phi;
 
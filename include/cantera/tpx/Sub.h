@@ -130,6 +130,17 @@ public:
 
     virtual double isothermalCompressibility();
 
+    //! Partial derivative of pressure with respect to temperature at
+    //! constant density [Pa/K]. The base class evaluates a centered
+    //! difference of the single-phase pressure, which requires no nonlinear
+    //! solves; derived substances may override this with the analytic
+    //! derivative of their equation of state.
+    virtual double dPdT();
+
+    //! Partial derivative of pressure with respect to density at constant
+    //! temperature [Pa m^3/kg]. See dPdT() for the default implementation.
+    virtual double dPdrho();
+
     //! @}
     //! @name Saturation Properties
     //! @{
@@ -175,11 +186,19 @@ public:
     void Set(PropertyPair::type XY, double x0, double y0);
 
 protected:
+    //! The tabulated wrapper samples the protected single-phase and
+    //! saturation functions of the substance it wraps
+    friend class TabulatedSubstance;
+
     double T, Rho;
     double Tslast, Rhf, Rhv;
     double Pst;
     double m_energy_offset;
     double m_entropy_offset;
+
+    //! Last converged (pressure, temperature) pair from Tsat(), used to warm
+    //! start the saturation temperature solve for nearby queries
+    double m_lastTsatP, m_lastTsatT;
     std::string m_name;
     std::string m_formula;
 
@@ -207,7 +226,7 @@ protected:
     int Lever(int itp, double sat, double val, propertyFlag::type ifunc);
 
     //! Update saturated liquid and vapor densities and saturation pressure
-    void update_sat();
+    virtual void update_sat();
 
 private:
     void set_Rho(double r0);
@@ -23,6 +23,12 @@ Substance* GetSub(int isub);
  */
 Substance* newSubstance(const std::string& name);
 
+//! Wrap *sub* in a TabulatedSubstance, which replaces most equation-of-state
+//! evaluations with second-order Taylor expansions about the nodes of a
+//! precomputed (T, rho) table. Takes ownership of *sub*. Any standard-state
+//! offsets already applied to *sub* are baked into the tables.
+Substance* newTabulatedSubstance(Substance* sub, size_t np = 120);
+
 }
 
 #endif
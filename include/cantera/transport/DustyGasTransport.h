@@ -95,6 +95,38 @@ public:
                                 const doublereal* const state2, const doublereal delta,
                                 doublereal* const fluxes);
 
+    //! Compute the molar fluxes for a batch of faces
+    /*!
+     * Equivalent to calling getMolarFluxes() once per face, but the inverted
+     * H matrix, Knudsen coefficients and gas viscosity are reused for
+     * consecutive faces whose mean temperature, pressure and composition
+     * agree within a relative tolerance `rtol`. Since the states along a
+     * porous-media profile vary slowly, most faces then cost only two
+     * matrix-vector products instead of a matrix inversion.
+     *
+     * This method uses no mutable state beyond this object, so concurrent
+     * evaluation over disjoint face ranges is safe provided each thread uses
+     * its own DustyGasTransport instance.
+     *
+     * @param nFaces   Number of faces in the batch
+     * @param states1  Array of states on the first side of each face, stored
+     *                 contiguously as nFaces blocks of temperature, density,
+     *                 and mass fractions (block length = nSpecies() + 2)
+     * @param states2  Array of states on the second side of each face, with
+     *                 the same layout as `states1`
+     * @param deltas   Distances from state 1 to state 2 for each face (m).
+     *                 (length = nFaces)
+     * @param fluxes   Output species molar fluxes, stored as nFaces blocks
+     *                 of length nSpecies()
+     * @param rtol     Relative tolerance within which the matrix inverse from
+     *                 the previous face is reused
+     */
+    void getMolarFluxesBatch(size_t nFaces, const doublereal* const states1,
+                             const doublereal* const states2,
+                             const doublereal* const deltas,
+                             doublereal* const fluxes,
+                             doublereal rtol = 1.0e-5);
+
     // new methods added in this class
 
     //! Set the porosity (dimensionless)
@@ -10,12 +10,43 @@
 
 #include "TransportBase.h"
 #include "cantera/numerics/DenseMatrix.h"
+#include "cantera/base/SharedMemTables.h"
+
+#include <cstdint>
 
 namespace Cantera
 {
 
 class MMCollisionInt;
 
+//! Immutable transport property fits shared by all transport managers built
+//! from identical fit inputs
+/*!
+ * A MixTransport and a MultiTransport instance constructed for the same
+ * phase generate identical viscosity, conductivity, and binary diffusivity
+ * fits, since the fitting procedure depends only on the species data and fit
+ * mode. The first manager to generate (or load) the fits publishes them in a
+ * process-wide registry keyed by GasTransport::fitInputHash(); subsequent
+ * managers with matching inputs reference the same tables instead of
+ * repeating the fits and storing a second copy of the pair table.
+ */
+struct GasTransportFits
+{
+    //! Per-species viscosity fits in the layout of GasTransport::m_visccoeffs
+    std::vector<vector_fp> visccoeffs;
+
+    //! Per-species conductivity fits in the layout of
+    //! GasTransport::m_condcoeffs
+    std::vector<vector_fp> condcoeffs;
+
+    //! Binary diffusivity fits in the degree-plane layout of
+    //! GasTransport::m_diffcoeffs_flat
+    vector_fp diffcoeffs_flat;
+
+    size_t npairs; //!< number of species pairs in #diffcoeffs_flat
+    size_t np; //!< coefficients per pair in #diffcoeffs_flat
+};
+
 //! Class GasTransport implements some functions and properties that are
 //! shared by the MixTransport and MultiTransport classes.
 //!
@@ -127,8 +158,70 @@ public:
     //! @see fitDiffCoeffs()
     virtual void getBinDiffusivityPolynomials(size_t i, size_t j, double* coeffs) const;
 
+    //! Set the relative temperature tolerance within which cached binary
+    //! diffusion coefficients are reused.
+    /*!
+     * When *rtol* is nonzero, updateDiff_T() reuses the coefficients last
+     * evaluated at temperature \f$ T_0 \f$ as long as
+     * \f$ |T - T_0| \le rtol \cdot T_0 \f$, rather than re-evaluating the
+     * polynomial fits for all K(K+1)/2 species pairs. This trades a small,
+     * controlled error in the diffusion coefficients for a large reduction
+     * in cost when the temperature changes only slightly between calls, as
+     * is typical within one iteration of a flame solve. The default of 0
+     * recomputes whenever the temperature changes.
+     */
+    void setBinDiffTemperatureTolerance(double rtol) {
+        m_bdiff_rtol = rtol;
+        m_bdiff_temp = 0.0;
+    }
+
     virtual void init(ThermoPhase* thermo, int mode=0, int log_level=0);
 
+    //! Report the heap memory held by this transport manager
+    /*!
+     * In addition to the base class entries, this reports the property fit
+     * coefficients, the species collision-parameter matrices, and the
+     * per-evaluation work arrays.
+     */
+    virtual AnyMap memoryReport() const;
+
+    //! Publish the transport property fits into the named shared memory
+    //! segment, so that other processes on the same node can attach them
+    //! with attachFitTables() instead of generating and storing their own
+    //! copies.
+    /*!
+     * The segment records a hash of all of the inputs to the fits (see
+     * fitCacheFile()), which attachFitTables() verifies, so fits published
+     * for one mechanism are never attached to another. The segment persists
+     * until SharedMemTables::remove() is called.
+     *
+     * @param segment  name of the shared memory segment to create
+     */
+    void publishFitTables(const std::string& segment);
+
+    //! Use the property fits published by another process on this node
+    //! instead of this object's own.
+    /*!
+     * The viscosity and conductivity fits, a few coefficients per species,
+     * are copied out of the segment. The binary diffusivity fits, which
+     * dominate the fit storage with K(K+1)/2 species pairs, are evaluated
+     * directly from the read-only mapping, and any private copies are
+     * released.
+     *
+     * Rather than calling publishFitTables() and attachFitTables() directly,
+     * the CANTERA_TRANSPORT_SHM environment variable can be set to a segment
+     * name before the transport manager is constructed. The first process to
+     * initialize then generates and publishes the fits, and processes
+     * initializing after that attach them, skipping the fit generation
+     * entirely; the application is responsible for ordering the first
+     * initialization before the others, e.g. with an MPI barrier after
+     * constructing the transport manager on rank 0 of each node.
+     *
+     * @param segment  name of a segment written by publishFitTables() for
+     *     the same mechanism, transport model and fit mode
+     */
+    void attachFitTables(const std::string& segment);
+
 protected:
     GasTransport(ThermoPhase* thermo=0);
 
@@ -212,6 +305,11 @@ protected:
      *      \eta(i)/sqrt(k_BT) = \sum_{n = 0}^4 a_n(i) (\log T)^n
      * \f]
      *
+     * The fits for the individual species are independent of one another and
+     * are generated on multiple worker threads unless log output is enabled.
+     * The number of threads defaults to the hardware concurrency, and can be
+     * overridden with the CANTERA_TRANSPORT_FIT_THREADS environment variable.
+     *
      * @param integrals interpolator for the collision integrals
      */
     virtual void fitProperties(MMCollisionInt& integrals);
@@ -231,6 +329,57 @@ protected:
      */
     virtual void fitDiffCoeffs(MMCollisionInt& integrals);
 
+    //! Name of the on-disk cache file for the property fits, or an empty
+    //! string if caching is disabled
+    /*!
+     * Caching is enabled by setting the CANTERA_TRANSPORT_FIT_CACHE
+     * environment variable to the directory where cache files should be kept.
+     * The file name encodes a hash of all of the inputs to the fits (the
+     * fit mode and temperature range, and the species names,
+     * molecular weights, charges, Lennard-Jones parameters and reference heat
+     * capacities sampled over the fit temperature range), so a cache file is
+     * never reused for a different mechanism.
+     */
+    std::string fitCacheFile();
+
+    //! Hash of all of the inputs to the property fits, used to key the
+    //! on-disk fit cache and the in-process fit registry, and to validate
+    //! shared memory fit tables. The transport model name is deliberately
+    //! not part of the hash, since the fits are identical for every model
+    //! derived from this class.
+    //! @see fitCacheFile()
+    uint64_t fitInputHash();
+
+    //! Adopt property fits published by another transport manager with
+    //! identical fit inputs, if any exist in the in-process registry
+    /*!
+     * The per-species fits are copied; the (much larger) per-pair binary
+     * diffusivity table is referenced in place, so managers sharing a
+     * mechanism store it only once.
+     *
+     * @returns false if no manager with matching fit inputs has published
+     *     its fits yet, in which case they need to be generated.
+     */
+    bool adoptSharedFits();
+
+    //! Publish the fits generated by fitProperties() and fitDiffCoeffs() in
+    //! the in-process registry, and switch this manager over to the shared
+    //! copy of the binary diffusivity table
+    void publishSharedFits();
+
+    //! Restore the fits generated by fitProperties() and fitDiffCoeffs() from
+    //! the on-disk cache
+    /*!
+     * @returns false if caching is disabled or if no usable cache file exists
+     *     for this mechanism, in which case the fits need to be generated.
+     */
+    bool loadFitCache();
+
+    //! Write the fits generated by fitProperties() and fitDiffCoeffs() to the
+    //! on-disk cache, if caching is enabled. I/O errors are ignored; the
+    //! cache is only ever an optimization.
+    void saveFitCache();
+
     //! Second-order correction to the binary diffusion coefficients
     /*!
      * Calculate second-order corrections to binary diffusion coefficient pair
@@ -309,6 +458,21 @@ protected:
      */
     DenseMatrix m_wratjk;
 
+    //! Composition- and temperature-independent pair factors of the Wilke
+    //! viscosity mixing rule, packed so that updateViscosity_T() needs no
+    //! square roots or divisions:
+    /*!
+     *  `m_viscwtfac(k,j) = 1/(sqrt(8)*sqrt(1 + mw[k]/mw[j]))   k >= j`
+     *  `m_viscwtfac(j,k) = mw[k]/mw[j]                         k > j`
+     */
+    DenseMatrix m_viscwtfac;
+
+    //! Reciprocals of the pure species viscosities #m_visc
+    vector_fp m_rvisc;
+
+    //! Reciprocals of #m_sqvisc
+    vector_fp m_rsqvisc;
+
     //! Holds square roots of molecular weight ratios
     /*!
      *  `m_wratjk1(j,k)  = sqrt(1.0 + mw[k]/mw[j])        j < k`
@@ -361,6 +525,43 @@ protected:
      */
     std::vector<vector_fp> m_diffcoeffs;
 
+    //! The binary diffusivity fits of #m_diffcoeffs repacked into one
+    //! contiguous plane per polynomial degree: entry `d*npairs + ic` holds
+    //! coefficient *d* of species pair *ic*. This layout lets updateDiff_T()
+    //! evaluate the fits for all pairs with stride-one (vectorizable) loops.
+    //! Rebuilt on demand; cleared when the fits change.
+    vector_fp m_diffcoeffs_flat;
+
+    //! Scratch storage for the polynomial evaluation in updateDiff_T(),
+    //! with one entry per species pair
+    vector_fp m_diffwork;
+
+    //! Mapping of the shared memory segment attached by attachFitTables(),
+    //! or empty when this object owns its property fits
+    std::unique_ptr<SharedMemTables> m_shmFits;
+
+    //! Property fits shared with other transport managers in this process
+    //! (see adoptSharedFits()), or empty when this object owns its fits or
+    //! attached them from shared memory. When set, #m_shmDiffcoeffs points
+    //! into the shared pair table.
+    shared_ptr<const GasTransportFits> m_procFits;
+
+    //! Shared binary diffusivity fits in the layout of #m_diffcoeffs_flat,
+    //! read-only and owned by #m_shmFits or #m_procFits, or null when this
+    //! object owns its fits
+    const double* m_shmDiffcoeffs;
+
+    size_t m_shmNpairs; //!< number of species pairs in #m_shmDiffcoeffs
+    size_t m_shmNp; //!< coefficients per pair in #m_shmDiffcoeffs
+
+    //! Temperature at which the coefficients in #m_bdiff were last
+    //! evaluated, used with #m_bdiff_rtol to decide whether they can be
+    //! reused (see setBinDiffTemperatureTolerance())
+    double m_bdiff_temp;
+
+    //! Relative temperature tolerance within which #m_bdiff is reused
+    double m_bdiff_rtol;
+
     //! Matrix of binary diffusion coefficients at the reference pressure and
     //! the current temperature Size is nsp x nsp.
     DenseMatrix m_bdiff;
@@ -511,6 +712,11 @@ protected:
     //! Quadrupole polarizability
     vector_fp m_quad_polar;
 
+    //! Composition epoch (Phase::stateMFNumber) of the thermo object the
+    //! last time update_C() was called, used by the subclasses to skip the
+    //! update when the composition has not changed
+    int m_mf_stateNum;
+
     //! Level of verbose printing during initialization
     int m_log_level;
 };
@@ -86,6 +86,39 @@ protected:
     virtual doublereal FQ_i(doublereal Q, doublereal Tr, doublereal MW);
 
     virtual doublereal setPcorr(doublereal Pr, doublereal Tr);
+
+    //! Fill the cached pure-species critical property vectors, if they have
+    //! not been computed yet.
+    /*!
+     * The critical properties are composition-independent, but evaluating
+     * them requires setting the phase composition to each pure species in
+     * turn, which is far too expensive to repeat on every property call.
+     * This routine performs one sweep over the species and stores Tc, Pc,
+     * Vc and Zc (and the quantum-correction parameter used by the Lucas
+     * viscosity model), so the per-call loops reduce to table lookups.
+     */
+    void updateCritProperties();
+
+    //! Cached pure-species critical temperatures, filled by
+    //! updateCritProperties()
+    vector_fp m_Tcrit;
+
+    //! Cached pure-species critical pressures
+    vector_fp m_Pcrit;
+
+    //! Cached pure-species critical volumes
+    vector_fp m_Vcrit;
+
+    //! Cached pure-species critical compressibilities
+    vector_fp m_Zcrit;
+
+    //! Quantum-correction parameter Q of the Lucas model for each species;
+    //! 0 for species without a quantum correction (only He, H2 and D2 have
+    //! nonzero entries)
+    vector_fp m_FQ_param;
+
+    //! True when the cached critical property vectors are valid
+    bool m_crit_ok;
 };
 }
 #endif
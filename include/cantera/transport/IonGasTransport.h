@@ -114,6 +114,13 @@ protected:
 
     //! polynomial of the collision integral for O2/O2-
     vector_fp m_om11_O2;
+
+    //! composition-independent reciprocal ion/neutral binary mobilities,
+    //! flattened over (m_kIon, m_kNeutral) and keyed by #m_invBmobi_temp
+    vector_fp m_invBmobi;
+
+    //! temperature at which #m_invBmobi was evaluated
+    double m_invBmobi_temp;
 };
 
 }
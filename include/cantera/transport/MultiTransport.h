@@ -12,6 +12,8 @@
 // Cantera includes
 #include "GasTransport.h"
 
+#include <map>
+
 namespace Cantera
 {
 //! Class MultiTransport implements multicomponent transport properties for
@@ -32,6 +34,8 @@ public:
      */
     MultiTransport(ThermoPhase* thermo=0);
 
+    virtual ~MultiTransport();
+
     virtual std::string transportType() const {
         return (m_mode == CK_Mode) ? "CK_Multi" : "Multi";
     }
@@ -109,6 +113,64 @@ public:
 
     virtual void init(ThermoPhase* thermo, int mode=0, int log_level=0);
 
+    //! Enable or disable the iterative L-matrix solve.
+    /*!
+     * When enabled, solveLMatrixEquation() reuses the LU factorization from a
+     * previous state as a preconditioner and applies iterative refinement,
+     * warm-started from the previous solution vector. Since the L matrix
+     * varies slowly with temperature and composition, a few refinement sweeps
+     * usually suffice, replacing the \f$ O(n^3) \f$ factorization with
+     * \f$ O(n^2) \f$ triangular solves for most evaluations. A fresh
+     * factorization is computed automatically whenever refinement stalls, so
+     * results agree with the direct solve to solver tolerance. Disabled by
+     * default.
+     *
+     * @param enable  flag turning the iterative solve on or off
+     */
+    void setIterativeLMatrixSolve(bool enable) {
+        m_iterative_solve = enable;
+    }
+
+    //! Identify the grid point for subsequent property evaluations.
+    /*!
+     * One-dimensional solvers evaluate transport properties at the same grid
+     * points repeatedly as a solution converges, so the L-matrix solution
+     * from the previous visit to a point is usually a better starting guess
+     * than the solution from a neighboring point. When a point identity is
+     * supplied, solveLMatrixEquation() keeps a per-point cache of the last
+     * converged solution, warm-starts the iterative solve from it, and skips
+     * the solve entirely when the local state has moved by less than the
+     * tolerance set with setThermalDiffTolerance(). Pass npos (the default
+     * state) to disable per-point caching.
+     *
+     * Cache entries are validated against the current temperature and
+     * composition before use, so stale entries left behind by grid
+     * refinement are simply recomputed.
+     *
+     * @param j  grid point index for subsequent evaluations
+     */
+    void setGridPoint(size_t j) {
+        m_gridPoint = j;
+    }
+
+    //! Set the relative tolerance for reusing a cached L-matrix solution.
+    /*!
+     * When a grid point identity has been set with setGridPoint() and the
+     * temperature and each mole fraction have moved by less than *rtol*
+     * (relative for T, absolute for the mole fractions) since the point was
+     * last solved, the cached solution vector is reused without rebuilding
+     * or solving the L-matrix system. The thermal diffusion coefficients and
+     * thermal conductivity then carry an error of the same order as the
+     * state change. The default of zero disables reuse, so every evaluation
+     * is solved to solver tolerance.
+     *
+     * @param rtol  state-change tolerance below which cached solutions are
+     *              reused
+     */
+    void setThermalDiffTolerance(double rtol) {
+        m_soret_rtol = rtol;
+    }
+
 protected:
     //! Update basic temperature-dependent quantities if the temperature has
     //! changed.
@@ -151,6 +213,48 @@ protected:
     vector_fp m_a;
     vector_fp m_b;
 
+    //! Reciprocal binary diffusion coefficients, 1/m_bdiff(i,j). Precomputed
+    //! in updateThermal_T() so that the composition-dependent eval_L kernels
+    //! reduce to multiply-add operations over these pair tables.
+    DenseMatrix m_invbdiff;
+
+    //! Composition-independent pair factor appearing in eval_L0010(),
+    //! \f$ m_i (1.2 C^*_{ji} - 1) / ((m_i + m_j) \mathcal{D}_{ji}) \f$
+    DenseMatrix m_fac0010;
+
+    //! Composition-independent pair factor appearing in eval_L1010(),
+    //! \f$ 1 / (\mathcal{D}_{ij} (m_i + m_j)^2) \f$
+    DenseMatrix m_fac1010;
+
+    //! Stored LU factorization and work arrays for the iterative L-matrix
+    //! solve; defined in MultiTransport.cpp to keep Eigen types out of the
+    //! public headers
+    struct LFactorization;
+    std::unique_ptr<LFactorization> m_Lfact;
+
+    //! Flag enabling the iterative L-matrix solve. See
+    //! setIterativeLMatrixSolve().
+    bool m_iterative_solve;
+
+    //! Saved L-matrix solution for one grid point, together with the state
+    //! at which it was computed
+    struct GridPointCache {
+        doublereal temp;
+        vector_fp molefracs;
+        vector_fp a;
+    };
+
+    //! Per-point solution cache, keyed by the index set with setGridPoint()
+    std::map<size_t, GridPointCache> m_pointCache;
+
+    //! Grid point identity for the next evaluation; npos when no caller-
+    //! supplied identity is active
+    size_t m_gridPoint;
+
+    //! State-change tolerance for reusing cached solutions. See
+    //! setThermalDiffTolerance().
+    double m_soret_rtol;
+
     // work space
     vector_fp m_spwork1, m_spwork2, m_spwork3;
 
@@ -608,6 +608,14 @@ public:
     //! separately.
     AnyMap parameters() const;
 
+    //! Report the heap memory held by this transport manager
+    /*!
+     * The base class reports only the model type; derived classes extend
+     * the map with byte counts for their fit coefficients and work arrays.
+     * Intended for capacity planning, not exact accounting.
+     */
+    virtual AnyMap memoryReport() const;
+
     //! Sets the velocity basis
     /*!
      * What the transport object does with this parameter is up to the
@@ -69,7 +69,73 @@ public:
      */
     virtual doublereal thermalConductivity();
 
+    //! Build a tabulated fast path for the viscosity and thermal conductivity
+    /*!
+     * Precomputes both properties on a regular (T, rho) grid covering the
+     * given operating window. Subsequent property calls with a state inside
+     * the window return a bicubic interpolation of the tables instead of
+     * evaluating the nested power series of the correlations, which is the
+     * analogue of the density tabulation provided by
+     * WaterPropsIAPWS::setupDensityTable(). States outside the window, and
+     * states in the near-critical region where the critical enhancements
+     * vary too sharply for the table spacing, fall back to the full
+     * correlations, so the tables never replace them.
+     *
+     * @param Tmin    Lower temperature bound of the window (Kelvin)
+     * @param Tmax    Upper temperature bound of the window (Kelvin)
+     * @param rhoMin  Lower density bound of the window (kg/m^3)
+     * @param rhoMax  Upper density bound of the window (kg/m^3)
+     * @param nT      Number of temperature grid points (at least 4)
+     * @param nRho    Number of density grid points (at least 4)
+     */
+    void setupPropertyTable(doublereal Tmin, doublereal Tmax,
+                            doublereal rhoMin, doublereal rhoMax,
+                            size_t nT = 25, size_t nRho = 25);
+
+    //! Remove the tables built by setupPropertyTable()
+    void clearPropertyTable();
+
     virtual void init(ThermoPhase* thermo, int mode=0, int log_level=0);
+
+private:
+    //! Evaluate the Sengers & Watson viscosity correlation at the current
+    //! state of the phase
+    doublereal viscosityCorrelation();
+
+    //! Evaluate the Sengers & Watson thermal conductivity correlation at the
+    //! current state of the phase
+    doublereal thermalConductivityCorrelation();
+
+    //! Interpolate one of the tables built by setupPropertyTable()
+    /*!
+     * @param table        #m_viscTable or #m_condTable
+     * @param temperature  temperature (Kelvin)
+     * @param dens         density (kg/m^3)
+     * @returns the bicubically interpolated property, or -1.0 if the state
+     *     is outside the tabulated window or in the near-critical region
+     */
+    doublereal tablePropertyValue(const vector_fp& table,
+                                  doublereal temperature,
+                                  doublereal dens) const;
+
+    //! Viscosities on the grid built by setupPropertyTable(); empty if no
+    //! table has been built
+    vector_fp m_viscTable;
+
+    //! Thermal conductivities on the grid built by setupPropertyTable()
+    vector_fp m_condTable;
+
+    //! Number of temperature points in the property tables
+    size_t m_nTab_T;
+
+    //! Number of density points in the property tables
+    size_t m_nTab_rho;
+
+    //! Temperature bounds of the tabulated window (Kelvin)
+    doublereal m_tabTmin, m_tabTmax;
+
+    //! Density bounds of the tabulated window (kg/m^3)
+    doublereal m_tabRhoMin, m_tabRhoMax;
 };
 }
 #endif
@@ -42,6 +42,8 @@ public:
 
     virtual void updateState(doublereal* y);
 
+    virtual void addSensParamDerivs(double* const* dfdp, size_t offset);
+
     //! Return the index in the solution vector for this reactor of the
     //! component named *nm*. Possible values for *nm* are "mass", "enthalpy",
     //! the name of a homogeneous phase species, or the name of a surface
@@ -9,6 +9,7 @@
 #include "cantera/base/ct_defs.h"
 #include "cantera/base/global.h"
 #include "cantera/base/ctexceptions.h"
+#include "cantera/numerics/Func1Program.h"
 
 namespace Cantera
 {
@@ -96,6 +97,24 @@ public:
     //! depends on the derived flow device class.
     virtual void setTimeFunction(Func1* g);
 
+    //! Set the device coefficient
+    /*!
+     * Sets the coefficient used by updateMassFlowRate(): the fixed mass
+     * flow rate, pressure coefficient, or valve coefficient of the derived
+     * class. The flow rate enters the network equations only through the
+     * right-hand side, so a controller can adjust the coefficient between
+     * advances with no integrator reinitialization; the next residual
+     * evaluation simply sees the new value.
+     */
+    void setCoefficient(double c) {
+        m_coeff = c;
+    }
+
+    //! The device coefficient (see setCoefficient())
+    double coefficient() const {
+        return m_coeff;
+    }
+
 protected:
     double m_mdot;
 
@@ -105,6 +124,11 @@ protected:
     //! Function set by setTimeFunction; used by updateMassFlowRate
     Func1* m_tfunc;
 
+    //! Compiled forms of #m_pfunc and #m_tfunc, evaluated in place of the
+    //! trees
+    Func1Program m_pprog;
+    Func1Program m_tprog;
+
     //! Coefficient set by derived classes; used by updateMassFlowRate
     double m_coeff;
 
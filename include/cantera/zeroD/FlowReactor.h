@@ -34,6 +34,12 @@ public:
                          doublereal* ydot, doublereal* params);
     virtual void updateState(doublereal* y);
 
+    //! The distance-based governing equations do not have the simple
+    //! production-rate structure the analytic derivatives rely on
+    virtual bool sensParamDerivSupported() const {
+        return false;
+    }
+
     void setMassFlowRate(double mdot);
 
     void setTimeConstant(doublereal tau) {
@@ -40,8 +40,17 @@ public:
     virtual void evalEqs(doublereal t, doublereal* y,
                          doublereal* ydot, doublereal* params);
 
+    //! Returns true unless surface chemistry is present or the kinetics
+    //! manager cannot provide analytic production rate derivatives.
+    virtual bool jacEqsSupported() const;
+
+    virtual void evalJacEqs(doublereal t, doublereal* y, doublereal* ydot,
+                            doublereal* params, Array2D& jac);
+
     virtual void updateState(doublereal* y);
 
+    virtual void addSensParamDerivs(double* const* dfdp, size_t offset);
+
     //! Return the index in the solution vector for this reactor of the
     //! component named *nm*. Possible values for *nm* are "mass",
     //! "volume", "temperature", the name of a homogeneous phase species, or the
@@ -0,0 +1,95 @@
+//! @file PartitionedReactorNet.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_PARTITIONEDREACTORNET_H
+#define CT_PARTITIONEDREACTORNET_H
+
+#include "ReactorNet.h"
+
+namespace Cantera
+{
+
+//! A reactor network integrated as loosely coupled partitions.
+/*!
+ * A large interconnected reactor graph integrated as one monolithic system
+ * couples every reactor through the shared CVODES state vector, so the
+ * integrator workspace and the Jacobian grow with the whole graph even when
+ * most of the coupling is weak. This driver splits the graph into
+ * partitions, each integrated by its own ReactorNet with its own much
+ * smaller CVODES system, and couples them by operator splitting: within each
+ * coupling interval every partition advances with the state of the reactors
+ * in the other partitions frozen at the partition boundaries.
+ *
+ * No changes to the connecting FlowDevice and Wall objects are needed:
+ * a device bridging two partitions reads the neighboring reactor's thermo
+ * state directly, which between synchronizations simply holds the value from
+ * the end of that partition's last coupling step. Partitions are advanced in
+ * the order they were created, so within one interval later partitions see
+ * the already-updated states of earlier ones (Gauss-Seidel ordering), which
+ * converges at least as fast as a Jacobi exchange as the coupling interval
+ * is refined.
+ *
+ * The splitting error is first order in the coupling interval, so the
+ * interval must be chosen small compared to the time scale of the exchanged
+ * flows. Partition boundaries should cut weak connections (small mass flows,
+ * large downstream volumes); stiffly coupled reactors belong in the same
+ * partition.
+ */
+class PartitionedReactorNet
+{
+public:
+    PartitionedReactorNet();
+    virtual ~PartitionedReactorNet() {}
+    PartitionedReactorNet(const PartitionedReactorNet&) = delete;
+    PartitionedReactorNet& operator=(const PartitionedReactorNet&) = delete;
+
+    //! Add a reactor to partition *part*, creating the partition (and any
+    //! with a lower index) if it does not exist yet.
+    void addReactor(Reactor& r, size_t part);
+
+    //! Number of partitions
+    size_t nPartitions() const {
+        return m_nets.size();
+    }
+
+    //! Access the ReactorNet integrating partition *n*, for example to set
+    //! per-partition integrator options.
+    ReactorNet& partition(size_t n);
+
+    //! Set the coupling interval [s] at which the partitions exchange their
+    //! boundary states. Must be positive.
+    void setCouplingInterval(double dt);
+
+    //! The coupling interval [s]
+    double couplingInterval() const {
+        return m_dtCouple;
+    }
+
+    //! Set the relative and absolute integration tolerances of every
+    //! partition.
+    void setTolerances(double rtol, double atol);
+
+    //! Set the initial time of every partition. Restarts integration from
+    //! this time using the current reactor states as the initial condition.
+    void setInitialTime(double time);
+
+    //! Current value of the simulation time [s]
+    double time() const {
+        return m_time;
+    }
+
+    //! Advance all partitions to time *t* [s], synchronizing the boundary
+    //! states every coupling interval.
+    void advance(double t);
+
+protected:
+    std::vector<std::unique_ptr<ReactorNet>> m_nets;
+    double m_time;
+    double m_dtCouple;
+};
+
+}
+
+#endif
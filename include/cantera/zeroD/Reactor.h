@@ -12,6 +12,7 @@ namespace Cantera
 {
 
 class Solution;
+class Array2D;
 
 /**
  * Class Reactor is a general-purpose class for stirred reactors. The reactor
@@ -112,6 +113,32 @@ public:
     virtual void evalEqs(doublereal t, doublereal* y,
                          doublereal* ydot, doublereal* params);
 
+    //! Returns true if this reactor can assemble the Jacobian of its
+    //! governing equations analytically, that is, if evalJacEqs() is
+    //! implemented for this reactor type and its current configuration.
+    virtual bool jacEqsSupported() const {
+        return false;
+    }
+
+    //! Evaluate the Jacobian of the reactor governing equations.
+    /*!
+     * Fills *jac*, a matrix of size neq() by neq() zeroed by the caller,
+     * with \f$ \partial \dot{y}_i / \partial y_j \f$ for this reactor's
+     * equation block. The chemical source terms are assembled from
+     * Kinetics::getNetProductionRateDerivatives(); wall heat fluxes, wall
+     * velocities and flow device mass flow rates are treated as externally
+     * imposed, so their dependence on the reactor state is not included.
+     * The reactor state must be current (see updateState()).
+     * @param[in] t time
+     * @param[in] y reactor solution vector, length neq()
+     * @param[in] ydot rate of change of the solution vector, length neq()
+     * @param[in] params sensitivity parameter vector, length
+     *     ReactorNet::nparams()
+     * @param[out] jac Jacobian of the reactor equations
+     */
+    virtual void evalJacEqs(doublereal t, doublereal* y, doublereal* ydot,
+                            doublereal* params, Array2D& jac);
+
     virtual void syncState();
 
     //! Set the state of the reactor to correspond to the state vector *y*.
@@ -129,6 +156,27 @@ public:
     //! species *k* (in the homogeneous phase)
     virtual void addSensitivitySpeciesEnthalpy(size_t k);
 
+    //! Returns true if this reactor can compute the analytic derivatives of
+    //! its governing equations with respect to its registered sensitivity
+    //! parameters, that is, if addSensParamDerivs() is implemented and all
+    //! registered parameters are reaction rate multipliers.
+    virtual bool sensParamDerivSupported() const;
+
+    //! Add the derivatives of this reactor's governing equations with
+    //! respect to its registered sensitivity parameters
+    /*!
+     * A rate-multiplier parameter on reaction *r* only enters the governing
+     * equations through that reaction's contribution to the net production
+     * rates, so the derivative follows directly from the reaction's
+     * stoichiometry row and its net rate of progress; no additional residual
+     * evaluations are needed. For each registered parameter *p*, the
+     * derivative of this reactor's equation block is added to
+     * `dfdp[p.global] + offset`, where *offset* is the start of this
+     * reactor's block in the global state vector. The reactor states must be
+     * current (see ReactorNet::updateState()).
+     */
+    virtual void addSensParamDerivs(double* const* dfdp, size_t offset);
+
     //! Return the index in the solution vector for this reactor of the
     //! component named *nm*. Possible values for *nm* are "mass", "volume",
     //! "int_energy", the name of a homogeneous phase species, or the name of a
@@ -160,6 +208,17 @@ public:
     void setAdvanceLimit(const std::string& nm, const double limit);
 
 protected:
+    //! Add the species-equation part of the sensitivity parameter
+    //! derivatives; used to implement addSensParamDerivs() for reactor types
+    //! whose species equations start at index *speciesStart* of the
+    //! reactor-local state vector.
+    void addSpeciesSensDerivs(double* const* dfdp, size_t offset,
+                              size_t speciesStart);
+
+    //! Species indices and net stoichiometric coefficients of reaction
+    //! *rxn*, cached for addSensParamDerivs()
+    const std::vector<std::pair<size_t, double>>& stoichRow(size_t rxn);
+
     //! Set reaction rate multipliers based on the sensitivity variables in
     //! *params*.
     virtual void applySensitivity(double* params);
@@ -211,6 +270,15 @@ protected:
 
     vector_fp m_wdot; //!< Species net molar production rates
     vector_fp m_uk; //!< Species molar internal energies
+
+    //! Index of the first surface species of each surface mechanism within
+    //! its full species array, cached by initialize() so that evalSurfaces()
+    //! does not repeat the lookup on every right-hand-side evaluation
+    std::vector<size_t> m_surfloc;
+
+    //! Index of the first gas-phase species of each surface mechanism within
+    //! its full species array, cached by initialize()
+    std::vector<size_t> m_bulkloc;
     bool m_chem;
     bool m_energy;
     size_t m_nv;
@@ -219,6 +287,12 @@ protected:
 
     // Data associated each sensitivity parameter
     std::vector<SensitivityParameter> m_sensParams;
+
+    //! Net rates of progress, scratch storage for addSensParamDerivs()
+    vector_fp m_ropnet;
+
+    //! Cache for stoichRow()
+    std::map<size_t, std::vector<std::pair<size_t, double>>> m_stoichRows;
 };
 }
 
@@ -141,6 +141,11 @@ public:
 
     void addSurface(ReactorSurface* surf);
 
+    //! Return the number of ReactorSurface objects connected to this reactor.
+    size_t nSurfaces() {
+        return m_surfaces.size();
+    }
+
     //! Return a reference to the *n*-th ReactorSurface connected to this
     //! reactor
     ReactorSurface* surface(size_t n);
@@ -8,12 +8,21 @@
 
 #include "Reactor.h"
 #include "cantera/numerics/FuncEval.h"
+#include "cantera/numerics/DenseMatrix.h"
+#include "cantera/base/Array.h"
+
+#include <functional>
 
 namespace Cantera
 {
 
-class Array2D;
+class AnyMap;
 class Integrator;
+class FlowDevice;
+class MassFlowController;
+class PressureController;
+class Valve;
+class WallBase;
 
 //! A class representing a network of connected reactors.
 /*!
@@ -51,6 +60,35 @@ public:
     //! Set the relative and absolute tolerances for the integrator.
     void setTolerances(double rtol, double atol);
 
+    //! Set a separate absolute tolerance for each component of the global
+    //! state vector.
+    /*!
+     * CVODES uses vector absolute tolerances directly, so components that
+     * only ever hold trace values (radicals, soot precursors) can be given
+     * a looser tolerance than the major species, letting the integrator
+     * take substantially larger steps without accuracy loss in the majors.
+     * The vector must have length neq(), using the same component ordering
+     * as the global solution vector; it replaces both the scalar tolerance
+     * of setTolerances() and the molecular-weight scaling of
+     * scaleAtolByMolecularWeight().
+     */
+    void setAbsoluteTolerances(const vector_fp& abstol);
+
+    //! Scale the scalar absolute tolerance by species molecular weight
+    /*!
+     * When enabled, the absolute tolerance applied to each species mass
+     * fraction is the scalar tolerance of setTolerances() multiplied by
+     * \f$ W_k / \bar{W} \f$, where \f$ \bar{W} \f$ is the unweighted mean
+     * of the species molecular weights in that reactor. A given mass
+     * fraction of a heavy trace species represents fewer moles than the
+     * same mass fraction of a light one, so this weights the error test
+     * toward equal mole-number precision and stops heavy trace species
+     * from forcing tiny steps to resolve physically meaningless digits.
+     * Non-species components keep the unscaled tolerance. Ignored when a
+     * full tolerance vector has been given with setAbsoluteTolerances().
+     */
+    void scaleAtolByMolecularWeight(bool yes=true);
+
     //! Set the relative and absolute tolerances for integrating the
     //! sensitivity equations.
     void setSensitivityTolerances(double rtol, double atol);
@@ -101,6 +139,77 @@ public:
     //! Advance the state of all reactors in time.
     double step();
 
+    //! Interpolate the global state vector at time *t*
+    /*!
+     * Uses the integrator's dense output (CVodeGetDky) to evaluate the
+     * state within the last internal step, so high-rate output sampling
+     * does not constrain the integrator step sizes the way stopping
+     * advance() at each output time does. *t* must lie within the span of
+     * the last step taken; *state* must have length neq(). The reactor
+     * objects are not updated.
+     */
+    void sample(double t, double* state);
+
+    //! Record the state on an entire output grid in one integration pass
+    /*!
+     * Integrates with internal integrator steps, interpolating the state
+     * at each time in *times* (which must be increasing) as soon as it is
+     * passed, so the step sizes are never constrained by the output grid.
+     * On return, *states* has neq() rows and one column per output time.
+     * Because the grid times are interpolated rather than landed on, the
+     * integrator finishes at the end of the internal step containing the
+     * last grid time, slightly past times.back(); the reactors are updated
+     * to that final state.
+     */
+    void sampleHistory(const vector_fp& times, Array2D& states);
+
+    //! Add an event function whose zero crossings the integrator locates.
+    /*!
+     * The function *g* is called with the current time; the reactor states
+     * are updated before each call, so *g* can capture reactor or network
+     * objects and evaluate conditions such as a temperature threshold or a
+     * pressure difference. The integrator uses its native rootfinding to
+     * land exactly on the times where *g* crosses zero, which are recorded
+     * and available from eventTimes(); output intervals can therefore stay
+     * large without stepping over the crossing. Returns the index of the
+     * event, used with eventTimes().
+     */
+    size_t addEvent(std::function<double(double)> g);
+
+    //! Number of event functions added with addEvent()
+    size_t nEvents() const {
+        return m_events.size();
+    }
+
+    //! Times at which event *i* crossed zero during integration, in the
+    //! order they were located
+    const vector_fp& eventTimes(size_t i) const {
+        return m_eventTimes.at(i);
+    }
+
+    //! Discard the recorded event times
+    void clearEventTimes();
+
+    //! Save a checkpoint of the current integration state to a binary blob.
+    /*!
+     * The checkpoint contains the full global state vector, the current
+     * time, the integrator step size information and, if sensitivity
+     * analysis is enabled, the sensitivity solution. Writing the blob to a
+     * file allows a long transient run to be resumed after a crash by
+     * calling loadCheckpoint() on an identically configured network,
+     * without re-doing the startup transient.
+     */
+    void saveCheckpoint(std::vector<char>& data);
+
+    //! Resume an integration from a checkpoint written by saveCheckpoint().
+    /*!
+     * The network must contain the same reactors, mechanisms and sensitivity
+     * parameters as the one that wrote the checkpoint; the total number of
+     * equations and sensitivity parameters is verified before any state is
+     * modified. The network is initialized first if necessary.
+     */
+    void loadCheckpoint(const std::vector<char>& data);
+
     //@}
 
     //! Add the reactor *r* to this reactor network.
@@ -130,10 +239,151 @@ public:
         return *m_integ;
     }
 
+    //! Enable automatic switching between explicit and implicit integration
+    /*!
+     * When enabled, advance() monitors the step-size behavior of the
+     * current integrator and switches the network between the explicit
+     * RK45 integrator and the CVODES BDF integrator mid-run. Integration
+     * starts in explicit mode, where a step costs a handful of
+     * right-hand-side evaluations and no linear algebra. Stiffness shows
+     * up as stability-limited explicit steps: the evaluation rate climbs
+     * well above what BDF needs over the same interval, or the step size
+     * collapses outright, and either symptom moves the network to BDF
+     * mode. After *probeInterval* further calls to advance() the explicit
+     * integrator is tried again, so a problem that leaves its stiff
+     * transient (for example, an ensemble particle after ignition)
+     * recovers the cheaper integrator.
+     *
+     * Root finding (addEvent()), sensitivity analysis, and advance limits
+     * all require CVODES, so automatic switching cannot be combined with
+     * them.
+     */
+    void setAutomaticIntegratorSwitching(bool yes, int probeInterval=10);
+
+    //! True if the network is currently integrating in explicit (RK) mode
+    //! (see setAutomaticIntegratorSwitching())
+    bool explicitModeActive() const {
+        return m_explicitMode;
+    }
+
+    //! Select the integrator used in the non-BDF mode of the automatic
+    //! switching machinery
+    /*!
+     * Accepts any non-stiff engine known to newIntegrator(): "RK45" (the
+     * default), "RK23", or "EXP", the Krylov exponential integrator, which
+     * tolerates moderately stiff kinetics without the nonlinear-solve
+     * overhead of BDF. Takes effect the next time the network switches out
+     * of BDF mode, or immediately if it is already out.
+     *
+     * @param itype  integrator type passed to newIntegrator()
+     */
+    void setExplicitIntegratorType(const std::string& itype);
+
+    //! Report the heap memory held by this reactor network
+    /*!
+     * Includes the state and scratch vectors owned by the network and the
+     * integrator workspaces (see Integrator::memoryReport()). The mechanism
+     * data of the reactor contents is reported separately through
+     * Solution::memoryReport().
+     */
+    AnyMap memoryReport() const;
+
+    //! Report performance statistics of the underlying integrator
+    /*!
+     * Returns the cumulative counters maintained by the time integrator for
+     * the current problem (see Integrator::solverStats()) — steps, right-
+     * hand-side evaluations, Jacobian evaluations, error-test and nonlinear
+     * convergence failures, and last/average step sizes — plus the current
+     * network time and integration mode. The counters reset when the network
+     * is reinitialized. Schedulers integrating ensembles of networks can use
+     * these to detect pathological cases and route them to different
+     * tolerances or integrators.
+     */
+    AnyMap solverStats() const;
+
+    //! Integrate with a gas--surface split preconditioner and GMRES
+    /*!
+     * Networks coupling gas-phase reactors to ReactorSurface coverages
+     * produce Jacobians in which a small, very stiff coverage block is
+     * attached to each reactor's larger gas block; the dense direct solver
+     * factors the whole system monolithically. When this option is enabled,
+     * the network integrates with preconditioned GMRES instead: for each
+     * reactor, the preconditioner \f$ M = I - \gamma J \f$ is partitioned
+     * into gas and coverage blocks, the coverage block is factored
+     * independently, and the gas block is solved through its Schur
+     * complement, so the factorization cost scales with the individual
+     * block sizes rather than the full network. Coupling between reactors
+     * is left to the Krylov iteration. Cannot be combined with automatic
+     * integrator switching. Must be called before the first call to
+     * advance() or step().
+     */
+    void setGasSurfacePreconditioner(bool enable);
+
+    //! @name Preconditioner interface used by CVODES
+    //!
+    //! Implementation of the FuncEval preconditioner hooks for the
+    //! gas--surface split preconditioner.
+    //! @see setGasSurfacePreconditioner()
+    //! @{
+    virtual bool preconditionerSupported() const {
+        return m_gsPrecon;
+    }
+    virtual void preconditionerSetup(double t, double* y, double gamma);
+    virtual void preconditionerSolve(double t, double* y, double* r,
+                                     double* z);
+    //! @}
+
     //! Update the state of all the reactors in the network to correspond to
     //! the values in the solution vector *y*.
     void updateState(doublereal* y);
 
+    //! Update the state of all the reactors and evaluate all connected flow
+    //! devices and walls at time *t* (see updateDevices()).
+    void updateState(doublereal* y, double t);
+
+    //! Evaluate all flow devices and walls of the network at time *t*.
+    /*!
+     * The devices are updated in type-homogeneous batches, one loop per
+     * concrete device class, so that the per-device virtual dispatch of the
+     * reactors' inlet/outlet and wall walks is replaced by direct calls and
+     * each shared device is evaluated once per residual evaluation instead
+     * of once per connected reactor. The reactors then read the cached
+     * rates. The lists are built by initialize().
+     */
+    void updateDevices(double t);
+
+    //! Returns true once initialize() has built the type-segregated device
+    //! lists, so that the reactors can rely on updateDevices() and skip
+    //! their own per-device updates.
+    bool batchedDevicesActive() const {
+        return m_batchedDevices;
+    }
+
+    //! Set the number of threads used to evaluate the reactors within one
+    //! right-hand-side evaluation
+    /*!
+     * The default of 1 applies the per-reactor work serially. A value of 0
+     * means use std::thread::hardware_concurrency(). Two stages use the
+     * threads: the state scatter in updateState(), which is threaded when
+     * initialize() has verified that every reactor holds its own contents
+     * object, and the derivative evaluation in eval(), which is threaded
+     * across the independent reactor groups found by initialize(). Reactors
+     * that share a contents object or are joined by a flow device (whose
+     * inlet terms read the upstream state during Reactor::evalEqs()) are
+     * placed in the same group and always evaluated serially relative to
+     * each other, so threading pays off in proportion to the number of
+     * independent groups in the network.
+     */
+    void setUpdateThreads(size_t nThreads) {
+        m_updateThreads = nThreads;
+    }
+
+    //! Number of threads used by updateState() and eval().
+    //! @see setUpdateThreads()
+    size_t updateThreads() const {
+        return m_updateThreads;
+    }
+
     //! Return the sensitivity of the *k*-th solution component with respect to
     //! the *p*-th sensitivity parameter.
     /*!
@@ -161,6 +411,39 @@ public:
         return sensitivity(k, p);
     }
 
+    //! Enable adjoint sensitivity analysis for the next integration
+    /*!
+     * Must be called before the first advance() so the forward integration
+     * can checkpoint its states for the backward problem; takes effect when
+     * the network is (re)initialized. See solveAdjoint().
+     */
+    void enableAdjoint(bool yes=true);
+
+    //! Gradient of a terminal objective with respect to all sensitivity
+    //! parameters, computed with the adjoint method
+    /*!
+     * For an objective \f$ G = g(y(t_f)) \f$ of the state at the current
+     * time — a peak temperature, an ignition criterion, or any other scalar
+     * — forward sensitivity analysis costs one sensitivity system per
+     * parameter, which is prohibitive for thousands of rate parameters.
+     * The adjoint method instead integrates a single system of neq()
+     * adjoint variables backward through the checkpointed forward states,
+     * accumulating \f$ dG/dp_i = \int \lambda^T \partial f/\partial p_i\,dt
+     * \f$ for every registered parameter at once, at a cost of roughly two
+     * forward integrations regardless of the parameter count.
+     *
+     * Requires enableAdjoint() before the forward integration, sensitivity
+     * parameters registered with Reactor::addSensitivityReaction(), and
+     * reactors that support analytic parameter derivatives (see
+     * sensRhsSupported()).
+     *
+     * @param dgdy  derivative of the objective with respect to the global
+     *     state vector at the current time, length neq()
+     * @returns the gradient \f$ dG/dp \f$, one entry per sensitivity
+     *     parameter. Unlike sensitivity(), the entries are not normalized.
+     */
+    vector_fp solveAdjoint(const double* dgdy);
+
     //! Evaluate the Jacobian matrix for the reactor network.
     /*!
      *  @param[in] t Time at which to evaluate the Jacobian
@@ -176,6 +459,11 @@ public:
     virtual size_t neq() {
         return m_nv;
     }
+
+    //! Evaluate the right-hand-side function. This function works entirely on
+    //! buffers preallocated by initialize(), so that repeated evaluations
+    //! within a time step generate no allocator traffic; this can be verified
+    //! with hotPathAllocationCount().
     virtual void eval(doublereal t, doublereal* y,
                       doublereal* ydot, doublereal* p);
 
@@ -188,6 +476,60 @@ public:
         return m_sens_params.size();
     }
 
+    virtual size_t nRoots() const {
+        return m_events.size();
+    }
+
+    //! Evaluate the event functions added with addEvent(). The reactor
+    //! states are updated to *y* before the functions are called.
+    virtual void evalRoots(double t, double* y, double* gout);
+
+    //! Returns true if every reactor in the network can supply analytic
+    //! parameter derivatives for its sensitivity parameters, so that the
+    //! batched sensitivity RHS can be used in place of the integrator's
+    //! per-parameter difference quotients.
+    virtual bool sensRhsSupported() const;
+
+    //! Evaluate the sensitivity equations for all parameters at once. The
+    //! Jacobian-vector products J*s_i are formed from a single
+    //! finite-difference Jacobian shared by all parameters, and the
+    //! partial derivatives with respect to the rate multipliers are
+    //! assembled analytically by the reactors.
+    virtual void evalSensRhs(double t, double* y, double* ydot,
+                             double* const* s, double* const* sdot);
+
+    //! Returns true when the adjoint right-hand sides can be evaluated,
+    //! which requires the same analytic parameter derivatives as
+    //! sensRhsSupported().
+    virtual bool adjointSupported() const;
+
+    //! Evaluate the adjoint equation \f$ \dot\lambda = -J^T \lambda \f$,
+    //! using the same shared finite-difference Jacobian as evalSensRhs().
+    virtual void evalAdjointRhs(double t, double* y, const double* lambda,
+                                double* lambdaDot);
+
+    //! Evaluate the adjoint quadrature integrands
+    //! \f$ \lambda^T \partial f/\partial p_i \f$ for all sensitivity
+    //! parameters, using the analytic parameter derivatives assembled by
+    //! the reactors.
+    virtual void evalAdjointQuad(double t, double* y, const double* lambda,
+                                 double* qdot);
+
+    //! Returns true if every reactor in the network can assemble the
+    //! Jacobian of its governing equations analytically (see
+    //! Reactor::jacEqsSupported()), so that the integrator can use the
+    //! analytic Jacobian in place of its internal difference quotients.
+    virtual bool denseJacobianSupported() const;
+
+    //! Assemble the analytic Jacobian of the reactor network. Each reactor
+    //! fills its diagonal block through Reactor::evalJacEqs(); the
+    //! dependence of one reactor's equations on the state of its neighbors
+    //! (through flow devices and walls) is not included, which leaves the
+    //! Jacobian approximate but still effective for the integrator's Newton
+    //! iteration.
+    virtual void evalDenseJacobian(double t, double* y, double* ydot,
+                                   double* jac);
+
     //! Return the index corresponding to the component named *component* in the
     //! reactor with index *reactor* in the global state vector for the
     //! reactor network.
@@ -263,6 +605,20 @@ protected:
     //! and deliberately not exposed in external interfaces.
     virtual int lastOrder();
 
+    //! Record the event times located by the integrator after it stopped at
+    //! a root. Used by advance() and step().
+    void recordEvents();
+
+    //! Replace the integrator with the explicit RK45 integrator (*toExplicit*
+    //! true) or the CVODES BDF integrator (false). The network is
+    //! re-initialized from the current reactor states on the next advance().
+    void switchIntegrator(bool toExplicit);
+
+    //! Decide whether to switch integration modes after an advance() over
+    //! [*t0*, *t1*] during which the right-hand side was evaluated
+    //! nEvals() - *evals0* times. See setAutomaticIntegratorSwitching().
+    void checkStiffnessSwitch(double t0, double t1, int evals0);
+
     std::vector<Reactor*> m_reactors;
     std::unique_ptr<Integrator> m_integ;
     doublereal m_time;
@@ -274,6 +630,15 @@ protected:
     std::vector<size_t> m_start;
 
     vector_fp m_atol;
+
+    //! User-supplied per-component absolute tolerances; empty unless
+    //! setAbsoluteTolerances() has been called
+    vector_fp m_userAtol;
+
+    //! If true, scale the species absolute tolerances by molecular weight
+    //! (see scaleAtolByMolecularWeight())
+    bool m_atolByMolWt = false;
+
     doublereal m_rtol, m_rtolsens;
     doublereal m_atols, m_atolsens;
 
@@ -283,12 +648,115 @@ protected:
     int m_maxErrTestFails;
     bool m_verbose;
 
+    //! If true, advance() switches between explicit RK and BDF integration
+    //! based on step-size behavior (see setAutomaticIntegratorSwitching())
+    bool m_autoSwitch = false;
+
+    //! True while the explicit integrator is active
+    bool m_explicitMode = false;
+
+    //! Number of advance() calls in BDF mode between explicit probes
+    int m_probeInterval = 10;
+
+    //! Integrator type used in the non-BDF mode
+    //! (see setExplicitIntegratorType())
+    std::string m_explicitType = "RK45";
+
+    //! advance() calls since the last switch to BDF mode
+    int m_advancesSinceSwitch = 0;
+
+    //! Right-hand-side evaluations per unit simulated time measured over
+    //! the most recent BDF-mode advance() interval
+    double m_bdfEvalRate = 0.0;
+
     //! Names corresponding to each sensitivity parameter
     std::vector<std::string> m_paramNames;
 
     vector_fp m_ydot;
     vector_fp m_yest;
     vector_fp m_advancelimits;
+
+    //! Event functions registered with addEvent()
+    std::vector<std::function<double(double)>> m_events;
+
+    //! Located zero-crossing times for each event function
+    std::vector<vector_fp> m_eventTimes;
+
+    //! Scratch vector for Integrator::getRootInfo()
+    std::vector<int> m_rootsFound;
+
+    //! Build the shared column-major finite-difference Jacobian #m_sensJac
+    //! at the state *y*, given the unperturbed derivative *ydot*. Used by
+    //! evalSensRhs() and evalAdjointRhs().
+    void buildSensJacobian(double t, double* y, const double* ydot);
+
+    //! Column-major finite-difference Jacobian used by evalSensRhs()
+    vector_fp m_sensJac;
+
+    //! Scratch state and derivative vectors for evalSensRhs()
+    vector_fp m_ytmp, m_ftmp;
+
+    //! If true, the forward integration records the checkpoints needed by
+    //! solveAdjoint() (see enableAdjoint())
+    bool m_adjoint = false;
+
+    //! Scratch derivative vector for evalAdjointRhs()
+    vector_fp m_fadj;
+
+    //! Parameter-derivative columns and pointer table for evalAdjointQuad()
+    vector_fp m_fp;
+    std::vector<double*> m_fpPtrs;
+
+    //! Per-reactor scratch blocks for evalDenseJacobian()
+    std::vector<Array2D> m_jacBlocks;
+
+    //! Per-reactor factorization data for the gas--surface split
+    //! preconditioner (see setGasSurfacePreconditioner()). The stored
+    //! matrices are the inverted coverage block and gas-block Schur
+    //! complement of \f$ M = I - \gamma J \f$, plus the coupling blocks
+    //! needed to reconstruct the coverage part of the solution.
+    struct GasSurfBlock {
+        size_t ng; //!< number of gas (bulk) components
+        size_t ns; //!< number of surface coverage components
+        DenseMatrix Sinv; //!< inverse of the gas-block Schur complement
+        DenseMatrix Dinv; //!< inverse of the coverage--coverage block
+        DenseMatrix B; //!< gas--coverage coupling block of M
+        DenseMatrix C; //!< coverage--gas coupling block of M
+        vector_fp ts; //!< coverage-sized scratch for preconditionerSolve()
+        vector_fp tg; //!< gas-sized scratch for preconditionerSolve()
+    };
+    std::vector<GasSurfBlock> m_gsBlocks;
+
+    //! True if the gas--surface split preconditioner is enabled
+    //! (see setGasSurfacePreconditioner())
+    bool m_gsPrecon = false;
+
+    //! @name Type-segregated device lists for updateDevices()
+    //! @{
+    std::vector<MassFlowController*> m_mfcs;
+    std::vector<PressureController*> m_pressureControllers;
+    std::vector<Valve*> m_valves;
+    std::vector<FlowDevice*> m_otherFlowDevices;
+    std::vector<WallBase*> m_walls;
+    //! @}
+
+    //! True once initialize() has built the device lists
+    bool m_batchedDevices = false;
+
+    //! Number of threads for the state scatter in updateState()
+    //! (see setUpdateThreads())
+    size_t m_updateThreads = 1;
+
+    //! True if initialize() found every reactor holding a distinct contents
+    //! object, making the threaded state scatter safe
+    bool m_distinctContents = false;
+
+    //! Groups of reactor indices built by initialize(). Reactors in the same
+    //! group share a contents or surface object or are joined by a flow
+    //! device; distinct groups touch disjoint objects once the batched
+    //! device pass has cached the coupling rates, so eval() may process
+    //! them concurrently.
+    std::vector<std::vector<size_t>> m_evalGroups;
 };
 }
 
@@ -0,0 +1,72 @@
+//! @file ReactorNetEnsemble.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_REACTORNETENSEMBLE_H
+#define CT_REACTORNETENSEMBLE_H
+
+#include "ReactorNet.h"
+
+namespace Cantera
+{
+
+//! A driver that integrates many independent reactor networks in parallel.
+/*!
+ * Ensemble simulations (for example, the particle ensembles of transported
+ * PDF methods) integrate large numbers of independent 0-D states to a common
+ * end time each outer timestep. The integration cost per network can vary by
+ * orders of magnitude depending on the stiffness of each state, so this
+ * driver hands networks to a pool of worker threads through a shared work
+ * queue: each thread pulls the next unprocessed network as soon as it
+ * finishes its current one, which keeps all cores busy without static
+ * partitioning.
+ *
+ * Each ReactorNet retains its own integrator, so CVODES workspaces are reused
+ * across successive calls to advanceAll() rather than reallocated. Note that
+ * the networks must not share ThermoPhase or Kinetics objects; use
+ * Kinetics::threadClone() and separate phase objects when constructing them.
+ */
+class ReactorNetEnsemble
+{
+public:
+    ReactorNetEnsemble();
+    virtual ~ReactorNetEnsemble() {}
+    ReactorNetEnsemble(const ReactorNetEnsemble&) = delete;
+    ReactorNetEnsemble& operator=(const ReactorNetEnsemble&) = delete;
+
+    //! Add a reactor network to the ensemble. The ensemble does not take
+    //! ownership; the network must outlive this object.
+    void addNet(ReactorNet& net);
+
+    //! Number of networks in the ensemble
+    size_t nNets() const {
+        return m_nets.size();
+    }
+
+    //! Access the n-th network
+    ReactorNet& net(size_t n);
+
+    //! Set the number of worker threads used by advanceAll(). A value of 0
+    //! (the default) uses the hardware concurrency reported by the system.
+    void setNumThreads(size_t nThreads) {
+        m_nThreads = nThreads;
+    }
+
+    //! Advance all networks in the ensemble to time *t* [s].
+    /*!
+     * Networks are distributed over the worker threads dynamically, so slow
+     * (stiff) networks do not hold up progress on the others. If any network
+     * raises an exception, the remaining networks are still advanced and the
+     * first exception is rethrown to the caller afterwards.
+     */
+    void advanceAll(double t);
+
+protected:
+    std::vector<ReactorNet*> m_nets;
+    size_t m_nThreads;
+};
+
+}
+
+#endif
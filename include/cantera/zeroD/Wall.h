@@ -7,6 +7,7 @@
 #define CT_WALL_H
 
 #include "cantera/base/ctexceptions.h"
+#include "cantera/numerics/Func1Program.h"
 #include "cantera/zeroD/ReactorSurface.h"
 #include "cantera/zeroD/ReactorBase.h"
 
@@ -83,6 +84,28 @@ public:
         return *m_right;
     }
 
+    //! Evaluate and cache vdot() and Q() at time *t*.
+    /*!
+     * A reactor network updates every wall once per residual evaluation and
+     * the two connected reactors read the cached values, instead of each
+     * side re-evaluating the virtual rate functions
+     * (see ReactorNet::updateDevices()).
+     */
+    void updateRates(double t) {
+        m_vdot_cached = vdot(t);
+        m_Q_cached = Q(t);
+    }
+
+    //! The rate of volume change cached by updateRates()
+    double cachedVdot() const {
+        return m_vdot_cached;
+    }
+
+    //! The heat flow rate cached by updateRates()
+    double cachedQ() const {
+        return m_Q_cached;
+    }
+
 protected:
     ReactorBase* m_left;
     ReactorBase* m_right;
@@ -90,6 +113,10 @@ protected:
     std::vector<ReactorSurface> m_surf;
 
     double m_area;
+
+    //! Rates cached by updateRates()
+    double m_vdot_cached = 0.0;
+    double m_Q_cached = 0.0;
 };
 
 //! Represents a wall between between two ReactorBase objects.
@@ -112,6 +139,7 @@ public:
     void setVelocity(Func1* f=0) {
         if (f) {
             m_vf = f;
+            m_vfProg.compile(*f);
         }
     }
 
@@ -131,6 +159,9 @@ public:
     //! Specify the heat flux function \f$ q_0(t) \f$.
     void setHeatFlux(Func1* q) {
         m_qf = q;
+        if (q) {
+            m_qfProg.compile(*q);
+        }
     }
 
     //! Heat flow rate through the wall (W).
@@ -199,6 +230,10 @@ protected:
 
     //! Heat flux function
     Func1* m_qf;
+
+    //! Compiled forms of #m_vf and #m_qf, evaluated in place of the trees
+    Func1Program m_vfProg;
+    Func1Program m_qfProg;
 };
 
 }
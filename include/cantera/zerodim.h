@@ -8,6 +8,7 @@
 
 // reactor network
 #include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/ReactorNetEnsemble.h"
 
 // reactors
 #include "cantera/zeroD/Reservoir.h"
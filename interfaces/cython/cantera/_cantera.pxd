@@ -279,6 +279,7 @@ cdef extern from "cantera/thermo/ThermoPhase.h" namespace "Cantera":
         void setState_VH(double, double) except +translate_exception
         void setState_TH(double, double) except +translate_exception
         void setState_SH(double, double) except +translate_exception
+        void setState_TPY(double, double, double*) nogil except +translate_exception
 
         # molar thermodynamic properties:
         double enthalpy_mole() except +translate_exception
@@ -531,6 +532,9 @@ cdef extern from "cantera/kinetics/Kinetics.h" namespace "Cantera":
         double multiplier(int)
         void setMultiplier(int, double)
 
+        void getNetProductionRatesBatch(size_t, double*, double*, double*,
+                                        double*) nogil except +translate_exception
+
 
 cdef extern from "cantera/kinetics/InterfaceKinetics.h":
     cdef cppclass CxxInterfaceKinetics "Cantera::InterfaceKinetics":
@@ -542,8 +546,8 @@ cdef extern from "cantera/transport/TransportBase.h" namespace "Cantera":
     cdef cppclass CxxTransport "Cantera::Transport":
         CxxTransport(CxxThermoPhase*)
         string transportType()
-        double viscosity() except +translate_exception
-        double thermalConductivity() except +translate_exception
+        double viscosity() nogil except +translate_exception
+        double thermalConductivity() nogil except +translate_exception
         double electricalConductivity() except +translate_exception
         void getSpeciesViscosities(double*) except +translate_exception
 
@@ -1046,7 +1050,7 @@ cdef extern from "cantera/cython/wrappers.h":
     cdef void kin_getNetProductionRates(CxxKinetics*, double*) except +translate_exception
 
     # Transport properties
-    cdef void tran_getMixDiffCoeffs(CxxTransport*, double*) except +translate_exception
+    cdef void tran_getMixDiffCoeffs(CxxTransport*, double*) nogil except +translate_exception
     cdef void tran_getMixDiffCoeffsMass(CxxTransport*, double*) except +translate_exception
     cdef void tran_getMixDiffCoeffsMole(CxxTransport*, double*) except +translate_exception
     cdef void tran_getThermalDiffCoeffs(CxxTransport*, double*) except +translate_exception
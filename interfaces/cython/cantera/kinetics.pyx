@@ -339,6 +339,47 @@ cdef class Kinetics(_SolutionBase):
         def __get__(self):
             return get_species_array(self, kin_getNetProductionRates)
 
+    def net_production_rates_batch(self, T, P, Y):
+        """
+        Net production rates [kmol/m^3/s] for a batch of states, evaluated in
+        a single call. The GIL is released while the states are processed, so
+        batches can be evaluated concurrently from Python threads using
+        independent `Solution` objects, and the per-call Python overhead is
+        paid once per batch rather than once per state.
+
+        :param T: Temperatures [K]. Length: number of states.
+        :param P: Pressures [Pa]. Length: number of states.
+        :param Y: Mass fractions, one row per state.
+            Shape: ``(number of states, n_total_species)``.
+
+        Returns an array of net production rates with one row per state. The
+        thermodynamic state of the object is modified by this call.
+        """
+        cdef np.ndarray[np.double_t, ndim=1] TT = \
+            np.ascontiguousarray(T, dtype=np.double)
+        cdef np.ndarray[np.double_t, ndim=1] PP = \
+            np.ascontiguousarray(P, dtype=np.double)
+        cdef np.ndarray[np.double_t, ndim=2] YY = \
+            np.ascontiguousarray(np.atleast_2d(Y), dtype=np.double)
+        cdef size_t nStates = TT.shape[0]
+        if (<size_t>PP.shape[0] != nStates or <size_t>YY.shape[0] != nStates
+                or YY.shape[1] != self.n_total_species):
+            raise ValueError('Inconsistent array dimensions')
+        cdef np.ndarray[np.double_t, ndim=2] wdot = \
+            np.empty((nStates, self.n_total_species))
+        if nStates == 0:
+            return wdot
+        cdef CxxKinetics* kin = self.kinetics
+        # raw pointers are taken before releasing the GIL, since indexing the
+        # buffers inside the nogil block would require bounds checks
+        cdef double* Tp = &TT[0]
+        cdef double* Pp = &PP[0]
+        cdef double* Yp = &YY[0,0]
+        cdef double* wp = &wdot[0,0]
+        with nogil:
+            kin.getNetProductionRatesBatch(nStates, Tp, Pp, Yp, wp)
+        return wdot
+
     property delta_enthalpy:
         """Change in enthalpy for each reaction [J/kmol]."""
         def __get__(self):
@@ -199,6 +199,61 @@ cdef class Transport(_SolutionBase):
         def __get__(self):
             return get_transport_1d(self, tran_getMixDiffCoeffs)
 
+    def mixture_properties_batch(self, T, P, Y):
+        """
+        Mixture-averaged transport properties for a batch of states,
+        evaluated in a single call. For each state, the phase is set to the
+        given temperature, pressure, and mass fractions, and the viscosity
+        [Pa-s], thermal conductivity [W/m/K], and mixture-averaged diffusion
+        coefficients [m^2/s] are computed. The GIL is released while the
+        states are processed, so batches can be evaluated concurrently from
+        Python threads using independent `Solution` objects.
+
+        :param T: Temperatures [K]. Length: number of states.
+        :param P: Pressures [Pa]. Length: number of states.
+        :param Y: Mass fractions, one row per state.
+            Shape: ``(number of states, n_species)``.
+
+        Returns the tuple ``(viscosity, thermal_conductivity,
+        mix_diff_coeffs)``, where the diffusion coefficients have one row per
+        state. The thermodynamic state of the object is modified by this
+        call.
+        """
+        cdef np.ndarray[np.double_t, ndim=1] TT = \
+            np.ascontiguousarray(T, dtype=np.double)
+        cdef np.ndarray[np.double_t, ndim=1] PP = \
+            np.ascontiguousarray(P, dtype=np.double)
+        cdef np.ndarray[np.double_t, ndim=2] YY = \
+            np.ascontiguousarray(np.atleast_2d(Y), dtype=np.double)
+        cdef size_t nStates = TT.shape[0]
+        cdef size_t kk = self.thermo.nSpecies()
+        if (<size_t>PP.shape[0] != nStates or <size_t>YY.shape[0] != nStates
+                or <size_t>YY.shape[1] != kk):
+            raise ValueError('Inconsistent array dimensions')
+        cdef np.ndarray[np.double_t, ndim=1] visc = np.empty(nStates)
+        cdef np.ndarray[np.double_t, ndim=1] cond = np.empty(nStates)
+        cdef np.ndarray[np.double_t, ndim=2] diff = np.empty((nStates, kk))
+        if nStates == 0:
+            return visc, cond, diff
+        cdef CxxThermoPhase* th = self.thermo
+        cdef CxxTransport* tr = self.transport
+        # raw pointers are taken before releasing the GIL, since indexing the
+        # buffers inside the nogil block would require bounds checks
+        cdef double* Tp = &TT[0]
+        cdef double* Pp = &PP[0]
+        cdef double* Yp = &YY[0,0]
+        cdef double* viscp = &visc[0]
+        cdef double* condp = &cond[0]
+        cdef double* diffp = &diff[0,0]
+        cdef size_t i
+        with nogil:
+            for i in range(nStates):
+                th.setState_TPY(Tp[i], Pp[i], Yp + i*kk)
+                viscp[i] = tr.viscosity()
+                condp[i] = tr.thermalConductivity()
+                tran_getMixDiffCoeffs(tr, diffp + i*kk)
+        return visc, cond, diff
+
     property mix_diff_coeffs_mass:
         """
         Mixture-averaged diffusion coefficients [m^2/s] relating the
@@ -0,0 +1,29 @@
+function wdot = netProdRatesBatch(a, t, p, y)
+% NETPRODRATESBATCH  Get net production rates for an array of states.
+% wdot = netProdRatesBatch(a, t, p, y)
+%
+% Evaluates the net chemical production rates for many states in a
+% single call, looping over the states inside the Cantera kernel
+% instead of crossing the mex interface once per state. This is much
+% faster than calling :mat:func:`netProdRates` in a loop when scanning
+% large parameter sets.
+%
+% See also: :mat:func:`netProdRates`
+%
+% :param a:
+%     Instance of class :mat:func:`Kinetics` (or another
+%     object deriving from Kinetics)
+%     for which net production rates are desired.
+% :param t:
+%     Vector of temperatures [K], one entry per state.
+% :param p:
+%     Vector of pressures [Pa], one entry per state.
+% :param y:
+%     Matrix of mass fractions with one column per state. The number
+%     of rows must equal the number of species.
+% :return:
+%     Returns a matrix of the net production (creation - destruction)
+%     rates of all species, with one column per state.
+%
+
+wdot = kinetics_get(a.id, 25, t, p, y);
@@ -0,0 +1,36 @@
+function [teq, yeq] = equilibrateBatch(tp, xy, t, p, y)
+% EQUILIBRATEBATCH  Equilibrate an array of states in a single call.
+% [teq, yeq] = equilibrateBatch(tp, xy, t, p, y)
+%
+% Sets the phase to each of the given states in turn, equilibrates it
+% holding the property pair *xy* constant, and collects the equilibrium
+% temperatures and compositions. The loop over states runs inside the
+% Cantera kernel, so only one mex crossing is paid for the whole array,
+% which is much faster than calling :mat:func:`equilibrate` per state
+% in parameter sweeps.
+%
+% See also: :mat:func:`equilibrate`
+%
+% :param tp:
+%     Instance of class :mat:func:`ThermoPhase` (or another
+%     object that derives from ThermoPhase).
+% :param xy:
+%     A two-letter string indicating which pair of properties should
+%     be held constant; see :mat:func:`equilibrate`.
+% :param t:
+%     Vector of initial temperatures [K], one entry per state.
+% :param p:
+%     Vector of initial pressures [Pa], one entry per state.
+% :param y:
+%     Matrix of initial mass fractions with one column per state. The
+%     number of rows must equal the number of species.
+% :return:
+%     ``teq`` is a vector of the equilibrium temperatures [K], and
+%     ``yeq`` is a matrix of the equilibrium mass fractions with one
+%     column per state. The phase is left at the last state in the
+%     array.
+%
+
+v = thermo_get(tp.tp_id, 52, xy, t, p, y);
+teq = v(1, :);
+yeq = v(2:end, :);
@@ -1,8 +1,12 @@
-function i = thermo_get(n, job, a, b)
+function i = thermo_get(n, job, a, b, c, d)
 if nargin == 2
     i = ctmethods(20, n, job);
 elseif nargin == 3
     i = ctmethods(20, n, job, a);
-else
+elseif nargin == 4
     i = ctmethods(20, n, job, a, b);
+elseif nargin == 5
+    i = ctmethods(20, n, job, a, b, c);
+else
+    i = ctmethods(20, n, job, a, b, c, d);
 end
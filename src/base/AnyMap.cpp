@@ -14,6 +14,9 @@
 #endif
 
 #include <boost/algorithm/string.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <fstream>
 #include <mutex>
 #include <unordered_set>
@@ -130,7 +133,7 @@ Type elementTypes(const YAML::Node& node)
         } else if (el.IsSequence()) {
             types = types | Type::Sequence;
         } else if (el.IsScalar()) {
-            std::string nodestr = el.as<std::string>();
+            const std::string& nodestr = el.Scalar();
             if (isInt(nodestr)) {
                 types = types | Type::Integer;
             } else if (isFloat(nodestr)) {
@@ -404,6 +407,37 @@ YAML::Emitter& operator<<(YAML::Emitter& out, const AnyValue& rhs)
 }
 
 
+//! Convert sequences of numbers with Cantera's parser instead of yaml-cpp's
+//! stringstream-based one; the coefficient arrays of a large mechanism make
+//! this one of the hottest paths of YAML input
+template<>
+struct convert<Cantera::vector_fp> {
+    static Node encode(const Cantera::vector_fp& rhs) {
+        Node node;
+        for (double x : rhs) {
+            node.push_back(x);
+        }
+        return node;
+    }
+
+    static bool decode(const Node& node, Cantera::vector_fp& target) {
+        if (!node.IsSequence()) {
+            return false;
+        }
+        target.clear();
+        target.reserve(node.size());
+        for (const auto& el : node) {
+            if (!el.IsScalar()) {
+                return false;
+            }
+            const std::string& str = el.Scalar();
+            target.push_back(Cantera::fpValue(str.data(),
+                                              str.data() + str.size()));
+        }
+        return true;
+    }
+};
+
 template<>
 struct convert<Cantera::AnyValue> {
     static Node encode(const Cantera::AnyValue& rhs) {
@@ -504,7 +538,8 @@ std::map<std::string, std::string> AnyValue::s_typenames = {
     {typeid(AnyMap).name(), "AnyMap"},
 };
 
-std::unordered_map<std::string, std::pair<AnyMap, int>> AnyMap::s_cache;
+std::unordered_map<std::string,
+                   std::pair<std::shared_ptr<AnyMap>, int>> AnyMap::s_cache;
 
 std::unordered_map<std::string, std::vector<std::string>> AnyMap::s_headFields;
 std::unordered_map<std::string, std::vector<std::string>> AnyMap::s_tailFields;
@@ -1197,10 +1232,11 @@ const std::vector<double>& AnyValue::asVector<double>(size_t nMin, size_t nMax)
 {
     if (is<std::vector<long int>>()) {
         std::vector<double> v;
+        v.reserve(asVector<long int>().size());
         for (const auto& el : asVector<long int>()) {
             v.push_back(el);
         }
-        *m_value = v;
+        *m_value = std::move(v);
     }
     const auto& vv = as<std::vector<double>>();
     m_equals = eq_comparer<std::vector<double>>;
@@ -1213,10 +1249,11 @@ std::vector<double>& AnyValue::asVector<double>(size_t nMin, size_t nMax)
 {
     if (is<std::vector<long int>>()) {
         std::vector<double> v;
+        v.reserve(asVector<long int>().size());
         for (const auto& el : asVector<long int>()) {
             v.push_back(el);
         }
-        *m_value = v;
+        *m_value = std::move(v);
     }
     auto& vv = as<std::vector<double>>();
     m_equals = eq_comparer<std::vector<double>>;
@@ -1671,8 +1708,352 @@ AnyMap AnyMap::fromYamlString(const std::string& yaml) {
     return amap;
 }
 
+namespace { // helpers for the persistent binary input-file cache
+
+// Identifies the file format; bumped whenever the layout of the serialized
+// data changes, which invalidates caches written by other Cantera versions.
+const uint32_t BinCacheMagic = 0x43544243; // "CTBC"
+const int32_t BinCacheVersion = 1;
+
+// Type tags for serialized AnyValue contents
+enum class BinType : uint8_t {
+    Empty, Bool, Int, Double, String, Map, List,
+    DoubleVec, IntVec, BoolVec, StringVec, MapVec,
+    DoubleMat, IntMat, BoolMat, StringMat
+};
+
+template <class T>
+void binWrite(std::ostream& out, const T& v)
+{
+    out.write(reinterpret_cast<const char*>(&v), sizeof(T));
+}
+
+template <class T>
+bool binRead(std::istream& in, T& v)
+{
+    in.read(reinterpret_cast<char*>(&v), sizeof(T));
+    return in.good();
+}
+
+void binWriteString(std::ostream& out, const std::string& s)
+{
+    binWrite<uint64_t>(out, s.size());
+    out.write(s.data(), s.size());
+}
+
+bool binReadString(std::istream& in, std::string& s)
+{
+    uint64_t n;
+    if (!binRead(in, n) || n > 1e9) {
+        return false;
+    }
+    s.resize(static_cast<size_t>(n));
+    in.read(&s[0], n);
+    return in.good();
+}
+
+template <class T>
+void binWriteVector(std::ostream& out, const std::vector<T>& v)
+{
+    binWrite<uint64_t>(out, v.size());
+    for (const T& x : v) {
+        binWrite(out, x);
+    }
+}
+
+template <class T>
+bool binReadVector(std::istream& in, std::vector<T>& v)
+{
+    uint64_t n;
+    if (!binRead(in, n) || n > 1e9) {
+        return false;
+    }
+    v.resize(static_cast<size_t>(n));
+    for (uint64_t i = 0; i < n; i++) {
+        T x;
+        if (!binRead(in, x)) {
+            return false;
+        }
+        v[i] = x;
+    }
+    return true;
+}
+
+void binWriteMap(std::ostream& out, const AnyMap& m);
+bool binReadMap(std::istream& in, AnyMap& m);
+
+void binWriteValue(std::ostream& out, const AnyValue& v)
+{
+    if (v.is<bool>()) {
+        binWrite(out, BinType::Bool);
+        binWrite<uint8_t>(out, v.asBool());
+    } else if (v.is<long int>()) {
+        binWrite(out, BinType::Int);
+        binWrite<int64_t>(out, v.asInt());
+    } else if (v.is<double>()) {
+        binWrite(out, BinType::Double);
+        binWrite(out, v.asDouble());
+    } else if (v.is<string>()) {
+        binWrite(out, BinType::String);
+        binWriteString(out, v.asString());
+    } else if (v.is<AnyMap>()) {
+        binWrite(out, BinType::Map);
+        binWriteMap(out, v.as<AnyMap>());
+    } else if (v.is<vector<AnyValue>>()) {
+        binWrite(out, BinType::List);
+        const auto& items = v.asVector<AnyValue>();
+        binWrite<uint64_t>(out, items.size());
+        for (const auto& item : items) {
+            binWriteValue(out, item);
+        }
+    } else if (v.is<vector<double>>()) {
+        binWrite(out, BinType::DoubleVec);
+        binWriteVector(out, v.asVector<double>());
+    } else if (v.is<vector<long int>>()) {
+        binWrite(out, BinType::IntVec);
+        binWriteVector(out, v.asVector<long int>());
+    } else if (v.is<vector<bool>>()) {
+        binWrite(out, BinType::BoolVec);
+        const auto& items = v.asVector<bool>();
+        binWrite<uint64_t>(out, items.size());
+        for (bool b : items) {
+            binWrite<uint8_t>(out, b);
+        }
+    } else if (v.is<vector<string>>()) {
+        binWrite(out, BinType::StringVec);
+        const auto& items = v.asVector<string>();
+        binWrite<uint64_t>(out, items.size());
+        for (const auto& s : items) {
+            binWriteString(out, s);
+        }
+    } else if (v.is<vector<AnyMap>>()) {
+        binWrite(out, BinType::MapVec);
+        const auto& items = v.asVector<AnyMap>();
+        binWrite<uint64_t>(out, items.size());
+        for (const auto& m : items) {
+            binWriteMap(out, m);
+        }
+    } else if (v.is<vector<vector<double>>>()) {
+        binWrite(out, BinType::DoubleMat);
+        const auto& rows = v.asVector<vector<double>>();
+        binWrite<uint64_t>(out, rows.size());
+        for (const auto& row : rows) {
+            binWriteVector(out, row);
+        }
+    } else {
+        // Types not produced when reading YAML input files
+        throw CanteraError("binWriteValue",
+            "Cannot serialize value of held type '{}'", v.type_str());
+    }
+}
+
+bool binReadValue(std::istream& in, AnyValue& v)
+{
+    BinType tag;
+    if (!binRead(in, tag)) {
+        return false;
+    }
+    switch (tag) {
+    case BinType::Empty:
+        v = Empty;
+        return true;
+    case BinType::Bool: {
+        uint8_t b;
+        if (!binRead(in, b)) return false;
+        v = static_cast<bool>(b);
+        return true;
+    }
+    case BinType::Int: {
+        int64_t i;
+        if (!binRead(in, i)) return false;
+        v = static_cast<long int>(i);
+        return true;
+    }
+    case BinType::Double: {
+        double d;
+        if (!binRead(in, d)) return false;
+        v = d;
+        return true;
+    }
+    case BinType::String: {
+        string s;
+        if (!binReadString(in, s)) return false;
+        v = s;
+        return true;
+    }
+    case BinType::Map: {
+        AnyMap m;
+        if (!binReadMap(in, m)) return false;
+        v = std::move(m);
+        return true;
+    }
+    case BinType::List: {
+        uint64_t n;
+        if (!binRead(in, n) || n > 1e9) return false;
+        vector<AnyValue> items(static_cast<size_t>(n));
+        for (auto& item : items) {
+            if (!binReadValue(in, item)) return false;
+        }
+        v = std::move(items);
+        return true;
+    }
+    case BinType::DoubleVec: {
+        vector<double> items;
+        if (!binReadVector(in, items)) return false;
+        v = std::move(items);
+        return true;
+    }
+    case BinType::IntVec: {
+        vector<long int> items;
+        if (!binReadVector(in, items)) return false;
+        v = std::move(items);
+        return true;
+    }
+    case BinType::BoolVec: {
+        uint64_t n;
+        if (!binRead(in, n) || n > 1e9) return false;
+        vector<bool> items(static_cast<size_t>(n));
+        for (uint64_t i = 0; i < n; i++) {
+            uint8_t b;
+            if (!binRead(in, b)) return false;
+            items[i] = b;
+        }
+        v = std::move(items);
+        return true;
+    }
+    case BinType::StringVec: {
+        uint64_t n;
+        if (!binRead(in, n) || n > 1e9) return false;
+        vector<string> items(static_cast<size_t>(n));
+        for (auto& s : items) {
+            if (!binReadString(in, s)) return false;
+        }
+        v = std::move(items);
+        return true;
+    }
+    case BinType::MapVec: {
+        uint64_t n;
+        if (!binRead(in, n) || n > 1e9) return false;
+        vector<AnyMap> items(static_cast<size_t>(n));
+        for (auto& m : items) {
+            if (!binReadMap(in, m)) return false;
+        }
+        v = std::move(items);
+        return true;
+    }
+    case BinType::DoubleMat: {
+        uint64_t n;
+        if (!binRead(in, n) || n > 1e9) return false;
+        vector<vector<double>> rows(static_cast<size_t>(n));
+        for (auto& row : rows) {
+            if (!binReadVector(in, row)) return false;
+        }
+        v = std::move(rows);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+void binWriteMap(std::ostream& out, const AnyMap& m)
+{
+    uint64_t n = 0;
+    for (const auto& item : m) {
+        (void) item;
+        n++;
+    }
+    binWrite(out, n);
+    for (const auto& item : m) {
+        binWriteString(out, item.first);
+        binWriteValue(out, item.second);
+    }
+}
+
+bool binReadMap(std::istream& in, AnyMap& m)
+{
+    uint64_t n;
+    if (!binRead(in, n) || n > 1e9) {
+        return false;
+    }
+    for (uint64_t i = 0; i < n; i++) {
+        string key;
+        AnyValue value;
+        if (!binReadString(in, key) || !binReadValue(in, value)) {
+            return false;
+        }
+        m[key] = std::move(value);
+    }
+    return true;
+}
+
+//! Returns true if the persistent binary input-file cache is enabled via the
+//! CANTERA_BINARY_YAML_CACHE environment variable
+bool binCacheEnabled()
+{
+    const char* flag = std::getenv("CANTERA_BINARY_YAML_CACHE");
+    return flag != nullptr && flag[0] != '\0' && string(flag) != "0";
+}
+
+//! Try to load the parsed, unit-converted contents of an input file from the
+//! binary cache file *cachePath*. Returns false if the cache is missing,
+//! stale, corrupt, or written by a different Cantera version.
+bool binReadCacheFile(const string& cachePath, int mtime, AnyMap& m)
+{
+    std::ifstream in(cachePath, std::ios::binary);
+    if (!in.good()) {
+        return false;
+    }
+    uint32_t magic;
+    int32_t version;
+    int64_t srcTime;
+    string version_str;
+    if (!binRead(in, magic) || magic != BinCacheMagic
+        || !binRead(in, version) || version != BinCacheVersion
+        || !binReadString(in, version_str) || version_str != CANTERA_VERSION
+        || !binRead(in, srcTime) || srcTime != mtime) {
+        return false;
+    }
+    return binReadMap(in, m);
+}
+
+//! Write the parsed, unit-converted contents of an input file to the binary
+//! cache file *cachePath*. Failures are silent; the cache is an optimization
+//! and the YAML file remains authoritative.
+void binWriteCacheFile(const string& cachePath, int mtime, const AnyMap& m)
+{
+    {
+        std::ofstream out(cachePath, std::ios::binary);
+        if (!out.good()) {
+            return;
+        }
+        try {
+            binWrite(out, BinCacheMagic);
+            binWrite(out, BinCacheVersion);
+            binWriteString(out, CANTERA_VERSION);
+            binWrite<int64_t>(out, mtime);
+            binWriteMap(out, m);
+            if (out.good()) {
+                return;
+            }
+        } catch (CanteraError&) {
+            // fall through and remove the partial file
+        }
+    }
+    std::remove(cachePath.c_str());
+}
+
+} // end anonymous namespace
+
 AnyMap AnyMap::fromYamlFile(const std::string& name,
                             const std::string& parent_name)
+{
+    // Return a copy of the shared cached document
+    return *fromYamlFileShared(name, parent_name);
+}
+
+std::shared_ptr<const AnyMap> AnyMap::fromYamlFileShared(
+    const std::string& name, const std::string& parent_name)
 {
     std::string fullName;
     // See if a file with this name exists in a path relative to the parent file
@@ -1704,12 +2085,26 @@ AnyMap AnyMap::fromYamlFile(const std::string& name,
 
     // Generate an AnyMap from the YAML file and store it in the cache
     auto& cache_item = s_cache[fullName];
+    cache_item.first = std::make_shared<AnyMap>();
     cache_item.second = mtime;
+    AnyMap& doc = *cache_item.first;
+
+    // Check for a persistent binary copy of the parsed file, which avoids
+    // the cost of YAML parsing entirely (for example, when many MPI ranks
+    // load the same mechanism)
+    bool binCache = binCacheEnabled();
+    std::string binName = fullName + ".ctcache";
+    if (binCache && binReadCacheFile(binName, mtime, doc)) {
+        doc.setMetadata("filename", AnyValue(fullName));
+        doc["__file__"] = fullName;
+        return cache_item.first;
+    }
+
     try {
         YAML::Node node = YAML::LoadFile(fullName);
-        cache_item.first = node.as<AnyMap>();
-        cache_item.first.setMetadata("filename", AnyValue(fullName));
-        cache_item.first.applyUnits();
+        doc = node.as<AnyMap>();
+        doc.setMetadata("filename", AnyValue(fullName));
+        doc.applyUnits();
     } catch (YAML::Exception& err) {
         s_cache.erase(fullName);
         AnyMap fake;
@@ -1720,13 +2115,16 @@ AnyMap AnyMap::fromYamlFile(const std::string& name,
         s_cache.erase(fullName);
         throw;
     }
-    cache_item.first["__file__"] = fullName;
+    doc["__file__"] = fullName;
+
+    if (binCache) {
+        binWriteCacheFile(binName, mtime, doc);
+    }
 
-    if (cache_item.first.hasKey("deprecated")) {
-        warn_deprecated(fullName, cache_item.first["deprecated"].asString());
+    if (doc.hasKey("deprecated")) {
+        warn_deprecated(fullName, doc["deprecated"].asString());
     }
 
-    // Return a copy of the AnyMap
     return cache_item.first;
 }
 
@@ -7,6 +7,7 @@
 
 #include "cantera/base/Array.h"
 #include "cantera/base/utilities.h"
+#include "cantera/base/global.h"
 
 namespace Cantera
 {
@@ -38,6 +39,15 @@ Array2D::Array2D(const Array2D& y)
 {
 }
 
+Array2D::Array2D(Array2D&& y) noexcept
+    : m_data(std::move(y.m_data))
+    , m_nrows(y.m_nrows)
+    , m_ncols(y.m_ncols)
+{
+    y.m_nrows = 0;
+    y.m_ncols = 0;
+}
+
 Array2D& Array2D::operator=(const Array2D& y)
 {
     if (&y == this) {
@@ -49,10 +59,38 @@ Array2D& Array2D::operator=(const Array2D& y)
     return *this;
 }
 
+Array2D& Array2D::operator=(Array2D&& y) noexcept
+{
+    if (&y == this) {
+        return *this;
+    }
+    m_data = std::move(y.m_data);
+    m_nrows = y.m_nrows;
+    m_ncols = y.m_ncols;
+    y.m_nrows = 0;
+    y.m_ncols = 0;
+    return *this;
+}
+
 void Array2D::resize(size_t n, size_t m, double v)
 {
+    if (n*m > m_data.capacity()) {
+        incrementAllocationCount("Array2D");
+    }
+    m_nrows = n;
+    m_ncols = m;
+    m_data.resize(n*m, v);
+}
+
+void Array2D::resizeDiscard(size_t n, size_t m, double v)
+{
+    if (n*m > m_data.capacity()) {
+        incrementAllocationCount("Array2D");
+    }
     m_nrows = n;
     m_ncols = m;
+    // clear first so that a reallocation does not copy the old contents
+    m_data.clear();
     m_data.resize(n*m, v);
 }
 
@@ -0,0 +1,137 @@
+/**
+ *  @file AsyncWriter.cpp Background writer for solution time series.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/AsyncWriter.h"
+#include "cantera/base/global.h"
+#include "cantera/base/ctexceptions.h"
+
+namespace Cantera
+{
+
+AsyncWriter::AsyncWriter(
+    std::function<void(double time, const vector_fp& data)> sink,
+    size_t nBuffers, size_t bufferSize) :
+    m_sink(sink),
+    m_head(0),
+    m_tail(0),
+    m_running(true),
+    m_written(0),
+    m_blocked(0),
+    m_errorPending(false)
+{
+    if (!m_sink) {
+        throw CanteraError("AsyncWriter::AsyncWriter",
+                           "A sink function is required.");
+    }
+    // One slot of the ring is kept empty to distinguish a full ring from an
+    // empty one, so allocate one more than the requested depth.
+    m_ring.resize(std::max<size_t>(nBuffers, 1) + 1);
+    for (auto& slot : m_ring) {
+        slot.data.reserve(bufferSize);
+    }
+    m_thread = std::thread(&AsyncWriter::run, this);
+}
+
+AsyncWriter::~AsyncWriter()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_running = false;
+    }
+    m_notEmpty.notify_one();
+    m_thread.join();
+    if (m_errorPending) {
+        // Destructors must not throw; the error was already missed by every
+        // write()/flush() call, so logging it is all that is left to do.
+        writelog("AsyncWriter: error from output sink: " + m_errorMsg + "\n");
+    }
+}
+
+void AsyncWriter::checkError()
+{
+    if (m_errorPending) {
+        m_errorPending = false;
+        throw CanteraError("AsyncWriter", "Error from output sink: {}",
+                           m_errorMsg);
+    }
+}
+
+void AsyncWriter::write(double time, const double* data, size_t n)
+{
+    checkError();
+    size_t head = m_head.load(std::memory_order_relaxed);
+    size_t next = (head + 1) % m_ring.size();
+    if (next == m_tail.load(std::memory_order_acquire)) {
+        // Ring is full; wait for the background thread to drain a slot
+        // rather than dropping the snapshot.
+        m_blocked++;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_notFull.wait(lock, [this, next] {
+            return next != m_tail.load(std::memory_order_acquire);
+        });
+    }
+    Slot& slot = m_ring[head];
+    slot.time = time;
+    slot.data.assign(data, data + n);
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_head.store(next, std::memory_order_release);
+    }
+    m_notEmpty.notify_one();
+}
+
+void AsyncWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_notFull.wait(lock, [this] {
+        return m_tail.load(std::memory_order_acquire)
+            == m_head.load(std::memory_order_acquire);
+    });
+    lock.unlock();
+    checkError();
+}
+
+void AsyncWriter::run()
+{
+    while (true) {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_head.load(std::memory_order_acquire)) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (!m_running && tail == m_head.load(std::memory_order_acquire)) {
+                return;
+            }
+            m_notEmpty.wait(lock, [this, tail] {
+                return !m_running
+                    || tail != m_head.load(std::memory_order_acquire);
+            });
+            continue;
+        }
+        Slot& slot = m_ring[tail];
+        try {
+            m_sink(slot.time, slot.data);
+        } catch (std::exception& err) {
+            if (!m_errorPending) {
+                m_errorMsg = err.what();
+                m_errorPending = true;
+            }
+        } catch (...) {
+            if (!m_errorPending) {
+                m_errorMsg = "unknown error";
+                m_errorPending = true;
+            }
+        }
+        m_written++;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_tail.store((tail + 1) % m_ring.size(),
+                         std::memory_order_release);
+        }
+        m_notFull.notify_one();
+    }
+}
+
+}
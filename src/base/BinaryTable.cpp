@@ -0,0 +1,287 @@
+/**
+ * @file BinaryTable.cpp
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/BinaryTable.h"
+#include "cantera/base/Array.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <cstdint>
+
+namespace {
+
+const uint32_t TableMagic = 0x42545443; // "CTTB"
+const uint32_t TableVersion = 1;
+
+template <class T>
+void binWrite(std::ostream& out, const T& val)
+{
+    out.write(reinterpret_cast<const char*>(&val), sizeof(T));
+}
+
+template <class T>
+bool binRead(std::istream& in, T& val)
+{
+    in.read(reinterpret_cast<char*>(&val), sizeof(T));
+    return in.good();
+}
+
+void binWriteString(std::ostream& out, const std::string& val)
+{
+    binWrite<uint64_t>(out, val.size());
+    out.write(val.data(), val.size());
+}
+
+bool binReadString(std::istream& in, std::string& val)
+{
+    uint64_t size;
+    if (!binRead(in, size) || size > 1e7) {
+        return false;
+    }
+    val.resize(size);
+    in.read(&val[0], size);
+    return in.good();
+}
+
+//! Read and validate the fixed header of a table file, leaving the stream
+//! positioned at the first chunk. Returns false if the header is not a
+//! valid table header.
+bool readTableHeader(std::istream& in, std::vector<std::string>& names)
+{
+    uint32_t magic, version;
+    uint64_t ncols;
+    if (!binRead(in, magic) || magic != TableMagic
+        || !binRead(in, version) || version != TableVersion
+        || !binRead(in, ncols) || ncols > 1e7) {
+        return false;
+    }
+    names.resize(ncols);
+    for (uint64_t i = 0; i < ncols; i++) {
+        if (!binReadString(in, names[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}
+
+namespace Cantera
+{
+
+BinaryTableWriter::BinaryTableWriter(const std::string& fname,
+                                     const std::vector<std::string>& names,
+                                     bool append, size_t chunkSize)
+    : m_fname(fname)
+    , m_names(names)
+    , m_chunkSize(std::max<size_t>(chunkSize, 1))
+    , m_bufRows(0)
+{
+    if (m_names.empty()) {
+        throw CanteraError("BinaryTableWriter::BinaryTableWriter",
+                           "Table must have at least one column");
+    }
+    if (append) {
+        // If a valid table with the same columns already exists, new chunks
+        // are added after the existing ones
+        std::ifstream existing(fname, std::ios::binary);
+        std::vector<std::string> existingNames;
+        if (existing.good() && readTableHeader(existing, existingNames)) {
+            if (existingNames != m_names) {
+                throw CanteraError("BinaryTableWriter::BinaryTableWriter",
+                    "Column names do not match the existing table in '{}'",
+                    fname);
+            }
+            existing.close();
+            m_file.open(fname, std::ios::in | std::ios::out
+                               | std::ios::binary | std::ios::ate);
+            if (!m_file) {
+                throw CanteraError("BinaryTableWriter::BinaryTableWriter",
+                    "Could not open file '{}' for writing", fname);
+            }
+            m_buffer.resize(m_chunkSize * m_names.size());
+            return;
+        }
+    }
+    m_file.open(fname, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!m_file) {
+        throw CanteraError("BinaryTableWriter::BinaryTableWriter",
+            "Could not open file '{}' for writing", fname);
+    }
+    binWrite(m_file, TableMagic);
+    binWrite(m_file, TableVersion);
+    binWrite<uint64_t>(m_file, m_names.size());
+    for (const auto& name : m_names) {
+        binWriteString(m_file, name);
+    }
+    m_buffer.resize(m_chunkSize * m_names.size());
+}
+
+BinaryTableWriter::~BinaryTableWriter()
+{
+    try {
+        flush();
+    } catch (...) {
+        // Destructors must not throw
+    }
+}
+
+void BinaryTableWriter::append(const double* row)
+{
+    std::copy(row, row + m_names.size(),
+              m_buffer.begin() + m_bufRows * m_names.size());
+    m_bufRows++;
+    if (m_bufRows == m_chunkSize) {
+        flush();
+    }
+}
+
+void BinaryTableWriter::append(const vector_fp& row)
+{
+    if (row.size() != m_names.size()) {
+        throw CanteraError("BinaryTableWriter::append",
+            "Expected a row of {} values, but got {}",
+            m_names.size(), row.size());
+    }
+    append(row.data());
+}
+
+void BinaryTableWriter::flush()
+{
+    if (m_bufRows > 0) {
+        binWrite<uint64_t>(m_file, m_bufRows);
+        // Transpose the row-major buffer into one contiguous run per column
+        vector_fp column(m_bufRows);
+        for (size_t j = 0; j < m_names.size(); j++) {
+            for (size_t i = 0; i < m_bufRows; i++) {
+                column[i] = m_buffer[i * m_names.size() + j];
+            }
+            m_file.write(reinterpret_cast<const char*>(column.data()),
+                         m_bufRows * sizeof(double));
+        }
+        m_bufRows = 0;
+    }
+    m_file.flush();
+    if (!m_file) {
+        throw CanteraError("BinaryTableWriter::flush",
+                           "Error writing to file '{}'", m_fname);
+    }
+}
+
+void writeBinaryTable(const std::string& fname,
+                      const std::vector<std::string>& names,
+                      const Array2D& data)
+{
+    if (names.size() != data.nRows()) {
+        throw CanteraError("writeBinaryTable",
+            "Got {} column names for data with {} variables",
+            names.size(), data.nRows());
+    }
+    BinaryTableWriter writer(fname, names, false);
+    for (size_t i = 0; i < data.nColumns(); i++) {
+        // Each point of the profile becomes one row of the table. The
+        // columns of the column-major Array2D are already contiguous.
+        writer.append(data.ptrColumn(i));
+    }
+    writer.flush();
+}
+
+void readBinaryTable(const std::string& fname,
+                     std::vector<std::string>& names, Array2D& data)
+{
+    std::ifstream in(fname, std::ios::binary);
+    if (!in) {
+        throw CanteraError("readBinaryTable",
+                           "Could not open file '{}' for reading", fname);
+    }
+    if (!readTableHeader(in, names)) {
+        throw CanteraError("readBinaryTable",
+            "File '{}' is not a valid binary table file", fname);
+    }
+    size_t ncols = names.size();
+    if (ncols == 0) {
+        data.resize(0, 0);
+        return;
+    }
+    std::vector<vector_fp> columns(ncols);
+    uint64_t nrows;
+    while (binRead(in, nrows)) {
+        for (size_t j = 0; j < ncols; j++) {
+            size_t offset = columns[j].size();
+            columns[j].resize(offset + nrows);
+            in.read(reinterpret_cast<char*>(columns[j].data() + offset),
+                    nrows * sizeof(double));
+        }
+        if (!in.good()) {
+            throw CanteraError("readBinaryTable",
+                "Unexpected end of data in table file '{}'", fname);
+        }
+    }
+    data.resize(ncols, columns[0].size());
+    for (size_t j = 0; j < ncols; j++) {
+        for (size_t i = 0; i < columns[j].size(); i++) {
+            data(j, i) = columns[j][i];
+        }
+    }
+}
+
+void readBinaryTable(const std::string& fname,
+                     const std::vector<std::string>& columns, Array2D& data)
+{
+    std::ifstream in(fname, std::ios::binary);
+    if (!in) {
+        throw CanteraError("readBinaryTable",
+                           "Could not open file '{}' for reading", fname);
+    }
+    std::vector<std::string> names;
+    if (!readTableHeader(in, names)) {
+        throw CanteraError("readBinaryTable",
+            "File '{}' is not a valid binary table file", fname);
+    }
+
+    // Map each column in the file to its position in the output, or npos
+    // for columns that should be skipped
+    std::vector<size_t> outputIndex(names.size(), npos);
+    for (size_t j = 0; j < columns.size(); j++) {
+        auto iter = std::find(names.begin(), names.end(), columns[j]);
+        if (iter == names.end()) {
+            throw CanteraError("readBinaryTable",
+                "Table file '{}' has no column named '{}'",
+                fname, columns[j]);
+        }
+        outputIndex[iter - names.begin()] = j;
+    }
+
+    std::vector<vector_fp> selected(columns.size());
+    uint64_t nrows;
+    while (binRead(in, nrows)) {
+        for (size_t j = 0; j < names.size(); j++) {
+            if (outputIndex[j] == npos) {
+                // Skip this column without reading it
+                in.seekg(nrows * sizeof(double), std::ios::cur);
+            } else {
+                vector_fp& col = selected[outputIndex[j]];
+                size_t offset = col.size();
+                col.resize(offset + nrows);
+                in.read(reinterpret_cast<char*>(col.data() + offset),
+                        nrows * sizeof(double));
+            }
+        }
+        if (!in.good()) {
+            throw CanteraError("readBinaryTable",
+                "Unexpected end of data in table file '{}'", fname);
+        }
+    }
+    size_t totalRows = columns.empty() ? 0 : selected[0].size();
+    data.resize(columns.size(), totalRows);
+    for (size_t j = 0; j < columns.size(); j++) {
+        for (size_t i = 0; i < totalRows; i++) {
+            data(j, i) = selected[j][i];
+        }
+    }
+}
+
+}
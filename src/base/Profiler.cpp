@@ -0,0 +1,128 @@
+/**
+ * @file Profiler.cpp Scoped wall-clock profiler emitting Chrome trace-event
+ *     JSON (see \ref Cantera::Profiler).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/Profiler.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Cantera
+{
+
+std::atomic<bool> Profiler::s_enabled(false);
+
+namespace {
+
+//! One completed scope
+struct TraceEvent {
+    const char* name; //!< scope name (a string literal)
+    int64_t t0; //!< start timestamp [ns]
+    int64_t t1; //!< end timestamp [ns]
+};
+
+//! Per-thread event buffer. Owned jointly by the recording thread (through a
+//! thread_local shared_ptr) and the global registry, so events recorded by a
+//! worker thread survive its exit.
+struct TraceBuffer {
+    int tid; //!< sequential thread number used in the trace output
+    std::vector<TraceEvent> events;
+};
+
+std::mutex& traceMutex()
+{
+    static std::mutex m;
+    return m;
+}
+
+std::vector<std::shared_ptr<TraceBuffer>>& traceRegistry()
+{
+    static std::vector<std::shared_ptr<TraceBuffer>> registry;
+    return registry;
+}
+
+TraceBuffer& threadBuffer()
+{
+    static thread_local std::shared_ptr<TraceBuffer> buf;
+    if (!buf) {
+        buf = std::make_shared<TraceBuffer>();
+        std::lock_guard<std::mutex> lock(traceMutex());
+        auto& registry = traceRegistry();
+        buf->tid = static_cast<int>(registry.size()) + 1;
+        registry.push_back(buf);
+    }
+    return *buf;
+}
+
+} // anonymous namespace
+
+void Profiler::enable()
+{
+    s_enabled.store(true, std::memory_order_relaxed);
+}
+
+void Profiler::disable()
+{
+    s_enabled.store(false, std::memory_order_relaxed);
+}
+
+void Profiler::clear()
+{
+    std::lock_guard<std::mutex> lock(traceMutex());
+    for (auto& buf : traceRegistry()) {
+        buf->events.clear();
+    }
+}
+
+int64_t Profiler::now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Profiler::record(const char* name, int64_t t0_ns, int64_t t1_ns)
+{
+    threadBuffer().events.push_back(TraceEvent{name, t0_ns, t1_ns});
+}
+
+std::string Profiler::traceJson()
+{
+    fmt::memory_buffer out;
+    format_to(out, "{{\"traceEvents\":[");
+    bool first = true;
+    std::lock_guard<std::mutex> lock(traceMutex());
+    for (const auto& buf : traceRegistry()) {
+        for (const auto& ev : buf->events) {
+            // Complete ("X") events with timestamps and durations in
+            // microseconds, the unit the trace-event format specifies
+            format_to(out,
+                "{}\n{{\"name\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},"
+                "\"dur\":{:.3f},\"pid\":1,\"tid\":{}}}",
+                first ? "" : ",", ev.name, ev.t0 * 1e-3,
+                (ev.t1 - ev.t0) * 1e-3, buf->tid);
+            first = false;
+        }
+    }
+    format_to(out, "\n]}}\n");
+    return to_string(out);
+}
+
+void Profiler::saveTrace(const std::string& filename)
+{
+    std::ofstream f(filename);
+    if (!f) {
+        throw CanteraError("Profiler::saveTrace",
+                           "Could not open file '{}' for writing", filename);
+    }
+    f << traceJson();
+}
+
+}
@@ -0,0 +1,76 @@
+/**
+ * @file ScratchArena.cpp Pool storage for the scratch work arrays of the
+ *     kinetics and thermo managers (see \ref Cantera::ScratchArena).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/ScratchArena.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace Cantera
+{
+
+bool ScratchArena::hugePagesEnabled()
+{
+    static const char* flag = getenv("CANTERA_HUGE_PAGES");
+    return flag != nullptr && flag[0] != '\0' && flag[0] != '0';
+}
+
+ScratchArena::ScratchArena(size_t capacity)
+    : m_base(nullptr)
+    , m_capacity(0)
+    , m_mapped_bytes(0)
+    , m_pos(0)
+{
+#ifdef __linux__
+    if (capacity > 0 && hugePagesEnabled()) {
+        // Round the mapping up to a multiple of 2 MiB so the kernel can use
+        // huge pages for the whole range; the slack is handed out normally
+        size_t hugePage = size_t(2) << 20;
+        size_t bytes = capacity * sizeof(double);
+        bytes = (bytes + hugePage - 1) / hugePage * hugePage;
+        void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p != MAP_FAILED) {
+#ifdef MADV_HUGEPAGE
+            madvise(p, bytes, MADV_HUGEPAGE);
+#endif
+            // Touch every page now, from the thread building the pool, so
+            // first-touch NUMA placement follows the evaluating thread
+            memset(p, 0, bytes);
+            m_base = static_cast<double*>(p);
+            m_capacity = bytes / sizeof(double);
+            m_mapped_bytes = bytes;
+            return;
+        }
+        // fall through to the heap if the mapping was refused
+    }
+#endif
+    // Round the heap pool base up to the pool alignment; memory mappings are
+    // page-aligned and need no adjustment
+    size_t pad = Alignment / sizeof(double);
+    m_heap_pool.assign(capacity + pad, 0.0);
+    size_t addr = reinterpret_cast<size_t>(m_heap_pool.data());
+    size_t aligned = (addr + Alignment - 1) & ~(size_t(Alignment) - 1);
+    m_base = reinterpret_cast<double*>(aligned);
+    m_capacity = capacity;
+}
+
+ScratchArena::~ScratchArena()
+{
+#ifdef __linux__
+    if (m_mapped_bytes) {
+        munmap(m_base, m_mapped_bytes);
+    }
+#endif
+}
+
+}
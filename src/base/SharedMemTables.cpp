@@ -0,0 +1,246 @@
+//! @file SharedMemTables.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/SharedMemTables.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <cstring>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace Cantera
+{
+
+namespace {
+
+const uint64_t ShmTablesMagic = 0x4354534d54423101ULL; // "CTSMTB1" + 0x01
+
+//! Fixed-size directory entry preceding the table data in a segment
+struct ShmTableEntry {
+    char name[56]; //!< null-terminated table name
+    uint64_t offset; //!< offset of the table data from the segment start, bytes
+    uint64_t length; //!< table length in doubles
+};
+
+//! Header at the start of a segment
+struct ShmTablesHeader {
+    uint64_t magic;
+    uint64_t nTables;
+};
+
+#ifndef _WIN32
+//! POSIX shared memory object names consist of a leading slash followed by
+//! slash-free characters; accept segment names with or without the slash.
+std::string shmName(const std::string& segment)
+{
+    std::string name = (segment.empty() || segment[0] != '/')
+                       ? "/" + segment : segment;
+    if (name.size() < 2 || name.find('/', 1) != std::string::npos) {
+        throw CanteraError("SharedMemTables",
+            "Invalid segment name '{}': must be non-empty and contain no "
+            "'/' characters.", segment);
+    }
+    return name;
+}
+#endif
+
+}
+
+#ifndef _WIN32
+
+void SharedMemTables::publish(const std::string& segment,
+    const std::vector<std::pair<std::string, const vector_fp*>>& tables)
+{
+    size_t size = sizeof(ShmTablesHeader)
+                  + tables.size() * sizeof(ShmTableEntry);
+    for (const auto& t : tables) {
+        if (t.first.size() >= sizeof(ShmTableEntry::name)) {
+            throw CanteraError("SharedMemTables::publish",
+                "Table name '{}' is too long (limit is {} characters).",
+                t.first, sizeof(ShmTableEntry::name) - 1);
+        }
+        size += t.second->size() * sizeof(double);
+    }
+
+    std::string name = shmName(segment);
+    shm_unlink(name.c_str()); // replace any previous segment
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        throw CanteraError("SharedMemTables::publish",
+            "Unable to create shared memory segment '{}': {}",
+            segment, strerror(errno));
+    }
+    if (ftruncate(fd, size) != 0) {
+        close(fd);
+        shm_unlink(name.c_str());
+        throw CanteraError("SharedMemTables::publish",
+            "Unable to size shared memory segment '{}' to {} bytes: {}",
+            segment, size, strerror(errno));
+    }
+    void* base = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        shm_unlink(name.c_str());
+        throw CanteraError("SharedMemTables::publish",
+            "Unable to map shared memory segment '{}': {}",
+            segment, strerror(errno));
+    }
+
+    auto* header = static_cast<ShmTablesHeader*>(base);
+    auto* entries = reinterpret_cast<ShmTableEntry*>(header + 1);
+    uint64_t offset = sizeof(ShmTablesHeader)
+                      + tables.size() * sizeof(ShmTableEntry);
+    for (size_t n = 0; n < tables.size(); n++) {
+        memset(entries[n].name, 0, sizeof(entries[n].name));
+        strcpy(entries[n].name, tables[n].first.c_str());
+        entries[n].offset = offset;
+        entries[n].length = tables[n].second->size();
+        memcpy(static_cast<char*>(base) + offset, tables[n].second->data(),
+               entries[n].length * sizeof(double));
+        offset += entries[n].length * sizeof(double);
+    }
+    // write the magic number last, so that an attaching process never sees
+    // a valid header on a partially written segment
+    header->nTables = tables.size();
+    header->magic = ShmTablesMagic;
+    munmap(base, size);
+}
+
+bool SharedMemTables::exists(const std::string& segment)
+{
+    int fd = shm_open(shmName(segment).c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return false;
+    }
+    close(fd);
+    return true;
+}
+
+void SharedMemTables::remove(const std::string& segment)
+{
+    shm_unlink(shmName(segment).c_str());
+}
+
+SharedMemTables::SharedMemTables(const std::string& segment) :
+    m_base(0),
+    m_size(0)
+{
+    std::string name = shmName(segment);
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        throw CanteraError("SharedMemTables::SharedMemTables",
+            "Shared memory segment '{}' does not exist: {}",
+            segment, strerror(errno));
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        throw CanteraError("SharedMemTables::SharedMemTables",
+            "Unable to determine the size of shared memory segment '{}': {}",
+            segment, strerror(errno));
+    }
+    m_size = st.st_size;
+    m_base = mmap(0, m_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (m_base == MAP_FAILED) {
+        m_base = 0;
+        throw CanteraError("SharedMemTables::SharedMemTables",
+            "Unable to map shared memory segment '{}': {}",
+            segment, strerror(errno));
+    }
+    if (m_size < sizeof(ShmTablesHeader)
+        || static_cast<const ShmTablesHeader*>(m_base)->magic
+           != ShmTablesMagic) {
+        munmap(m_base, m_size);
+        m_base = 0;
+        throw CanteraError("SharedMemTables::SharedMemTables",
+            "Shared memory segment '{}' was not written by "
+            "SharedMemTables::publish().", segment);
+    }
+}
+
+SharedMemTables::~SharedMemTables()
+{
+    if (m_base) {
+        munmap(m_base, m_size);
+    }
+}
+
+const double* SharedMemTables::table(const std::string& name,
+                                     size_t& length) const
+{
+    const auto* header = static_cast<const ShmTablesHeader*>(m_base);
+    const auto* entries = reinterpret_cast<const ShmTableEntry*>(header + 1);
+    for (uint64_t n = 0; n < header->nTables; n++) {
+        if (name == entries[n].name) {
+            length = entries[n].length;
+            return reinterpret_cast<const double*>(
+                static_cast<const char*>(m_base) + entries[n].offset);
+        }
+    }
+    throw CanteraError("SharedMemTables::table",
+        "Segment contains no table named '{}'.", name);
+}
+
+bool SharedMemTables::hasTable(const std::string& name) const
+{
+    const auto* header = static_cast<const ShmTablesHeader*>(m_base);
+    const auto* entries = reinterpret_cast<const ShmTableEntry*>(header + 1);
+    for (uint64_t n = 0; n < header->nTables; n++) {
+        if (name == entries[n].name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#else // _WIN32
+
+void SharedMemTables::publish(const std::string& segment,
+    const std::vector<std::pair<std::string, const vector_fp*>>& tables)
+{
+    throw NotImplementedError("SharedMemTables::publish");
+}
+
+bool SharedMemTables::exists(const std::string& segment)
+{
+    return false;
+}
+
+void SharedMemTables::remove(const std::string& segment)
+{
+}
+
+SharedMemTables::SharedMemTables(const std::string& segment) :
+    m_base(0),
+    m_size(0)
+{
+    throw NotImplementedError("SharedMemTables::SharedMemTables");
+}
+
+SharedMemTables::~SharedMemTables()
+{
+}
+
+const double* SharedMemTables::table(const std::string& name,
+                                     size_t& length) const
+{
+    throw NotImplementedError("SharedMemTables::table");
+}
+
+bool SharedMemTables::hasTable(const std::string& name) const
+{
+    return false;
+}
+
+#endif
+
+}
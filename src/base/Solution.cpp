@@ -73,6 +73,64 @@ AnyMap Solution::parameters(bool withInput) const
     return out;
 }
 
+AnyMap Solution::memoryReport() const
+{
+    AnyMap report;
+    report["name"] = name();
+    if (m_thermo) {
+        report["thermo"] = m_thermo->memoryReport();
+    }
+    if (m_kinetics) {
+        report["kinetics"] = m_kinetics->memoryReport();
+    }
+    if (m_transport) {
+        report["transport"] = m_transport->memoryReport();
+    }
+    return report;
+}
+
+shared_ptr<Solution> Solution::threadClone() const
+{
+    if (!m_thermo) {
+        throw CanteraError("Solution::threadClone",
+                           "Requires associated 'ThermoPhase'");
+    }
+    auto sol = Solution::create();
+
+    // Build a phase of the same type holding the same elements and species.
+    // The Species objects are shared with this object; they hold only
+    // immutable setup data and are never written during property evaluation.
+    shared_ptr<ThermoPhase> thermo(newThermoPhase(m_thermo->type()));
+    thermo->setName(m_thermo->name());
+    for (size_t m = 0; m < m_thermo->nElements(); m++) {
+        thermo->addElement(m_thermo->elementName(m),
+                           m_thermo->atomicWeight(m));
+    }
+    for (size_t k = 0; k < m_thermo->nSpecies(); k++) {
+        thermo->addSpecies(m_thermo->species(k));
+    }
+    thermo->initThermo();
+    vector_fp state;
+    m_thermo->saveState(state);
+    thermo->restoreState(state);
+    sol->setThermo(thermo);
+
+    if (m_kinetics) {
+        if (m_kinetics->nPhases() > 1) {
+            throw CanteraError("Solution::threadClone",
+                "Cloning is only supported for homogeneous kinetics");
+        }
+        sol->setKinetics(shared_ptr<Kinetics>(
+            m_kinetics->threadClone({thermo.get()})));
+    }
+
+    if (m_transport) {
+        sol->setTransport(shared_ptr<Transport>(
+            newTransportMgr(m_transport->transportType(), thermo.get())));
+    }
+    return sol;
+}
+
 shared_ptr<Solution> newSolution(const std::string& infile,
                                  const std::string& name,
                                  const std::string& transport,
@@ -0,0 +1,303 @@
+//! @file ThreadPool.cpp Shared worker thread pool
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/ThreadPool.h"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace Cantera
+{
+
+namespace { // helpers
+
+//! Pool whose worker is executing on this thread, or null on threads the
+//! pool does not own. Used to recognize nested submission.
+thread_local const ThreadPool* t_pool = nullptr;
+
+//! Index of this thread's own queue within t_pool
+thread_local size_t t_worker = 0;
+
+//! Resolve a constructor or resize() thread count: 0 means one worker less
+//! than the hardware concurrency, because the submitting thread also
+//! executes tasks.
+size_t resolveThreadCount(size_t nThreads)
+{
+    if (nThreads == 0) {
+        nThreads = std::max(1u, std::thread::hardware_concurrency()) - 1;
+    }
+    return nThreads;
+}
+
+} // anonymous namespace
+
+ThreadPool::ThreadPool(size_t nThreads) :
+    m_nextQueue(0),
+    m_numTasks(0),
+    m_shutdown(false)
+{
+    start(resolveThreadCount(nThreads));
+}
+
+ThreadPool::~ThreadPool()
+{
+    stop();
+}
+
+void ThreadPool::start(size_t nThreads)
+{
+    m_shutdown = false;
+    m_queues.clear();
+    for (size_t i = 0; i < nThreads; i++) {
+        m_queues.emplace_back(new WorkQueue());
+    }
+    for (size_t i = 0; i < nThreads; i++) {
+        m_workers.emplace_back(&ThreadPool::workerLoop, this, i);
+        if (m_pinned) {
+            pinWorker(i);
+        }
+    }
+}
+
+void ThreadPool::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_shutdown = true;
+    }
+    m_wake.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+    m_workers.clear();
+    m_queues.clear();
+}
+
+void ThreadPool::resize(size_t nThreads)
+{
+    stop();
+    start(resolveThreadCount(nThreads));
+}
+
+void ThreadPool::enqueue(std::function<void()> task)
+{
+    if (m_queues.empty()) {
+        // no workers; run on the submitting thread
+        task();
+        return;
+    }
+    size_t i = m_nextQueue.fetch_add(1) % m_queues.size();
+    {
+        std::lock_guard<std::mutex> lock(m_queues[i]->mutex);
+        m_queues[i]->tasks.push_back(std::move(task));
+    }
+    m_numTasks.fetch_add(1);
+    {
+        // taking the sleep lock orders the notification after any worker's
+        // decision to wait, so no wakeup is lost
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+    }
+    m_wake.notify_one();
+}
+
+bool ThreadPool::isWorkerThread() const
+{
+    return t_pool == this;
+}
+
+bool ThreadPool::tryRunTask()
+{
+    size_t n = m_queues.size();
+    if (n == 0 || m_numTasks.load() == 0) {
+        return false;
+    }
+    // start at this worker's own queue; threads the pool does not own start
+    // at a rotating position so concurrent helpers spread out
+    bool owner = (t_pool == this);
+    size_t self = owner ? t_worker : m_nextQueue.load() % n;
+    for (size_t k = 0; k < n; k++) {
+        size_t i = (self + k) % n;
+        WorkQueue& q = *m_queues[i];
+        std::function<void()> task;
+        {
+            std::lock_guard<std::mutex> lock(q.mutex);
+            if (q.tasks.empty()) {
+                continue;
+            }
+            if (owner && i == self) {
+                task = std::move(q.tasks.front());
+                q.tasks.pop_front();
+            } else {
+                task = std::move(q.tasks.back());
+                q.tasks.pop_back();
+            }
+        }
+        m_numTasks.fetch_sub(1);
+        task();
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(size_t i)
+{
+    t_pool = this;
+    t_worker = i;
+    while (true) {
+        if (tryRunTask()) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_wake.wait(lock, [this]() {
+            return m_shutdown.load() || m_numTasks.load() > 0;
+        });
+        if (m_shutdown.load() && m_numTasks.load() == 0) {
+            return;
+        }
+    }
+}
+
+void ThreadPool::pinWorker(size_t i)
+{
+#if defined(__linux__)
+    size_t nCpu = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    if (m_pinned) {
+        CPU_SET(i % nCpu, &cpuset);
+    } else {
+        for (size_t c = 0; c < nCpu; c++) {
+            CPU_SET(c, &cpuset);
+        }
+    }
+    pthread_setaffinity_np(m_workers[i].native_handle(),
+                           sizeof(cpu_set_t), &cpuset);
+#endif
+}
+
+void ThreadPool::setAffinity(bool pin)
+{
+    m_pinned = pin;
+    for (size_t i = 0; i < m_workers.size(); i++) {
+        pinWorker(i);
+    }
+}
+
+void ThreadPool::run(size_t nTasks, const std::function<void(size_t)>& func)
+{
+    if (nTasks == 0) {
+        return;
+    }
+    if (nTasks == 1 || m_queues.empty()) {
+        for (size_t t = 0; t < nTasks; t++) {
+            func(t);
+        }
+        return;
+    }
+    TaskGroup group(*this);
+    for (size_t t = 1; t < nTasks; t++) {
+        group.run([&func, t]() {
+            func(t);
+        });
+    }
+    std::exception_ptr firstError;
+    try {
+        func(0);
+    } catch (...) {
+        firstError = std::current_exception();
+    }
+    try {
+        group.wait();
+    } catch (...) {
+        if (!firstError) {
+            firstError = std::current_exception();
+        }
+    }
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+}
+
+namespace { // storage for the process-wide shared pool
+
+std::mutex shared_pool_mutex;
+std::shared_ptr<ThreadPool> shared_pool;
+
+} // anonymous namespace
+
+ThreadPool& ThreadPool::shared()
+{
+    std::lock_guard<std::mutex> lock(shared_pool_mutex);
+    if (!shared_pool) {
+        shared_pool.reset(new ThreadPool());
+    }
+    return *shared_pool;
+}
+
+void ThreadPool::setShared(std::shared_ptr<ThreadPool> pool)
+{
+    std::lock_guard<std::mutex> lock(shared_pool_mutex);
+    shared_pool = pool;
+}
+
+TaskGroup::TaskGroup(ThreadPool& pool) :
+    m_pool(pool),
+    m_pending(0)
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+    try {
+        wait();
+    } catch (...) {
+        // tasks have finished; their errors have nowhere to go
+    }
+}
+
+void TaskGroup::run(std::function<void()> task)
+{
+    m_pending.fetch_add(1);
+    m_pool.enqueue([this, task]() {
+        try {
+            task();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_error) {
+                m_error = std::current_exception();
+            }
+        }
+        if (m_pending.fetch_sub(1) == 1) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_done.notify_all();
+        }
+    });
+}
+
+void TaskGroup::wait()
+{
+    // Execute queued tasks — this group's or anyone's — while waiting, so a
+    // task waiting on a nested group keeps its worker productive; sleep only
+    // once every queue is empty, which means the remaining tasks of this
+    // group are already running on other threads.
+    while (m_pending.load() > 0) {
+        if (!m_pool.tryRunTask()) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done.wait(lock, [this]() {
+                return m_pending.load() == 0;
+            });
+        }
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_error) {
+        std::exception_ptr err = m_error;
+        m_error = nullptr;
+        std::rethrow_exception(err);
+    }
+}
+
+}
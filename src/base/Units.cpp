@@ -10,6 +10,9 @@
 #include "cantera/base/AnyMap.h"
 #include "cantera/base/utilities.h"
 
+#include <mutex>
+#include <unordered_map>
+
 namespace {
 using namespace Cantera;
 
@@ -100,6 +103,25 @@ const std::map<std::string, double> prefixes{
     {"z", 1e-21},
     {"y", 1e-24}
 };
+
+//! Return a cached copy of the Units object parsed from *name*
+/*!
+ * Mechanism input draws its unit strings from a small fixed set (for
+ * example "cal/mol" or "cm^3/mol/s"), but reaction setup converts thousands
+ * of rate parameters, so each distinct string is parsed once and the result
+ * reused for every later conversion.
+ */
+const Units& cachedUnits(const std::string& name)
+{
+    static std::mutex units_cache_mutex;
+    static std::unordered_map<std::string, Units> parsed_units;
+    std::unique_lock<std::mutex> lock(units_cache_mutex);
+    auto iter = parsed_units.find(name);
+    if (iter == parsed_units.end()) {
+        iter = parsed_units.emplace(name, Units(name)).first;
+    }
+    return iter->second;
+}
 }
 
 namespace Cantera
@@ -349,7 +371,7 @@ void UnitSystem::setDefaultActivationEnergy(const std::string& e_units)
 double UnitSystem::convert(double value, const std::string& src,
                            const std::string& dest) const
 {
-    return convert(value, Units(src), Units(dest));
+    return convert(value, cachedUnits(src), cachedUnits(dest));
 }
 
 double UnitSystem::convert(double value, const Units& src,
@@ -364,7 +386,7 @@ double UnitSystem::convert(double value, const Units& src,
 
 double UnitSystem::convertTo(double value, const std::string& dest) const
 {
-    return convertTo(value, Units(dest));
+    return convertTo(value, cachedUnits(dest));
 }
 
 double UnitSystem::convertTo(double value, const Units& dest) const
@@ -380,7 +402,7 @@ double UnitSystem::convertTo(double value, const Units& dest) const
 
 double UnitSystem::convertFrom(double value, const std::string& dest) const
 {
-    return convertFrom(value, Units(dest));
+    return convertFrom(value, cachedUnits(dest));
 }
 
 double UnitSystem::convertFrom(double value, const Units& src) const
@@ -414,7 +436,7 @@ static std::pair<double, std::string> split_unit(const AnyValue& v) {
 
 double UnitSystem::convert(const AnyValue& v, const std::string& dest) const
 {
-    return convert(v, Units(dest));
+    return convert(v, cachedUnits(dest));
 }
 
 double UnitSystem::convert(const AnyValue& v, const Units& dest) const
@@ -425,14 +447,14 @@ double UnitSystem::convert(const AnyValue& v, const Units& dest) const
         return convertTo(val_units.first, dest);
     } else {
         // Both source and destination units are explicit
-        return convert(val_units.first, Units(val_units.second), dest);
+        return convert(val_units.first, cachedUnits(val_units.second), dest);
     }
 }
 
 vector_fp UnitSystem::convert(const std::vector<AnyValue>& vals,
                               const std::string& dest) const
 {
-    return convert(vals, Units(dest));
+    return convert(vals, cachedUnits(dest));
 }
 
 vector_fp UnitSystem::convert(const std::vector<AnyValue>& vals,
@@ -449,12 +471,12 @@ double UnitSystem::convertActivationEnergy(double value, const std::string& src,
                                            const std::string& dest) const
 {
     // Convert to J/kmol
-    Units usrc(src);
-    if (usrc.convertible(Units("J/kmol"))) {
+    const Units& usrc = cachedUnits(src);
+    if (usrc.convertible(knownUnits.at("J/kmol"))) {
         value *= usrc.factor();
-    } else if (usrc.convertible(Units("K"))) {
+    } else if (usrc.convertible(knownUnits.at("K"))) {
         value *= GasConstant * usrc.factor();
-    } else if (usrc.convertible(Units("eV"))) {
+    } else if (usrc.convertible(knownUnits.at("eV"))) {
         value *= Avogadro * usrc.factor();
     } else {
         throw CanteraError("UnitSystem::convertActivationEnergy",
@@ -462,12 +484,12 @@ double UnitSystem::convertActivationEnergy(double value, const std::string& src,
     }
 
     // Convert from J/kmol
-    Units udest(dest);
-    if (udest.convertible(Units("J/kmol"))) {
+    const Units& udest = cachedUnits(dest);
+    if (udest.convertible(knownUnits.at("J/kmol"))) {
         value /= udest.factor();
-    } else if (udest.convertible(Units("K"))) {
+    } else if (udest.convertible(knownUnits.at("K"))) {
         value /= GasConstant * udest.factor();
-    } else if (udest.convertible(Units("eV"))) {
+    } else if (udest.convertible(knownUnits.at("eV"))) {
         value /= Avogadro * udest.factor();
     } else {
         throw CanteraError("UnitSystem::convertActivationEnergy",
@@ -480,13 +502,13 @@ double UnitSystem::convertActivationEnergy(double value, const std::string& src,
 double UnitSystem::convertActivationEnergyTo(double value,
                                              const std::string& dest) const
 {
-    return convertActivationEnergyTo(value, Units(dest));
+    return convertActivationEnergyTo(value, cachedUnits(dest));
 }
 
 double UnitSystem::convertActivationEnergyTo(double value,
                                              const Units& dest) const
 {
-    if (dest.convertible(Units("J/kmol"))) {
+    if (dest.convertible(knownUnits.at("J/kmol"))) {
         return value * m_activation_energy_factor / dest.factor();
     } else if (dest.convertible(knownUnits.at("K"))) {
         return value * m_activation_energy_factor / GasConstant;
@@ -501,8 +523,8 @@ double UnitSystem::convertActivationEnergyTo(double value,
 double UnitSystem::convertActivationEnergyFrom(double value,
                                                const std::string& src) const
 {
-    Units usrc(src);
-    if (usrc.convertible(Units("J/kmol"))) {
+    const Units& usrc = cachedUnits(src);
+    if (usrc.convertible(knownUnits.at("J/kmol"))) {
         return value * usrc.factor() / m_activation_energy_factor;
     } else if (usrc.convertible(knownUnits.at("K"))) {
         return value * GasConstant / m_activation_energy_factor;
@@ -19,6 +19,7 @@ namespace Cantera {
 YamlWriter::YamlWriter()
     : m_float_precision(15)
     , m_skip_user_defined(false)
+    , m_binary_threshold(0)
 {
 }
 
@@ -42,25 +43,19 @@ void YamlWriter::addPhase(shared_ptr<ThermoPhase> thermo,
     addPhase(soln);
 }
 
-std::string YamlWriter::toYamlString() const
+void YamlWriter::buildDefinitionSections(std::vector<AnyMap>& phaseDefs,
+    std::vector<AnyMap>& speciesDefs,
+    std::vector<std::pair<std::string, std::vector<AnyMap>>>& reactionSections) const
 {
-    AnyMap output;
-    output["generator"] = "YamlWriter";
-    output["cantera-version"] = CANTERA_VERSION;
-    time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-    output["date"] = trimCopy(std::ctime(&now));
-
     // Build phase definitions
-    std::vector<AnyMap> phaseDefs(m_phases.size());
+    phaseDefs.resize(m_phases.size());
     size_t nspecies_total = 0;
     for (size_t i = 0; i < m_phases.size(); i++) {
         phaseDefs[i] = m_phases[i]->parameters(!m_skip_user_defined);
         nspecies_total += m_phases[i]->thermo()->nSpecies();
     }
-    output["phases"] = phaseDefs;
 
     // Build species definitions for all phases
-    std::vector<AnyMap> speciesDefs;
     speciesDefs.reserve(nspecies_total);
     std::unordered_map<std::string, size_t> speciesDefIndex;
     for (const auto& phase : m_phases) {
@@ -73,7 +68,7 @@ std::string YamlWriter::toYamlString() const
                 speciesDefs.emplace_back(speciesDef);
                 speciesDefIndex[name] = speciesDefs.size() - 1;
             } else if (speciesDefs[speciesDefIndex[name]] != speciesDef) {
-                throw CanteraError("YamlWriter::toYamlString",
+                throw CanteraError("YamlWriter::buildDefinitionSections",
                     "Multiple species with different definitions are not "
                     "supported:\n>>>>>>\n{}\n======\n{}\n<<<<<<\n",
                     speciesDef.toYamlString(),
@@ -81,7 +76,6 @@ std::string YamlWriter::toYamlString() const
             }
         }
     }
-    output["species"] = speciesDefs;
 
     // build reaction definitions for all phases
     std::map<std::string, std::vector<AnyMap>> allReactions;
@@ -126,7 +120,8 @@ std::string YamlWriter::toYamlString() const
 
     // Generate the reactions section(s) in the output file
     if (phaseGroups.size() == 1) {
-        output["reactions"] = std::move(allReactions[phaseGroups.begin()->first]);
+        reactionSections.emplace_back("reactions",
+            std::move(allReactions[phaseGroups.begin()->first]));
     } else {
         for (const auto& group : phaseGroups) {
             std::string groupName;
@@ -134,14 +129,38 @@ std::string YamlWriter::toYamlString() const
                 groupName += name + "-";
             }
             groupName += "reactions";
-            output[groupName] = std::move(allReactions[group.first]);
+            reactionSections.emplace_back(groupName,
+                std::move(allReactions[group.first]));
 
             for (auto& name : group.second) {
-                AnyMap& phaseDef = output["phases"].getMapWhere("name", name);
-                phaseDef["reactions"] = std::vector<std::string>{groupName};
+                for (auto& phaseDef : phaseDefs) {
+                    if (phaseDef.getString("name", "") == name) {
+                        phaseDef["reactions"] = std::vector<std::string>{groupName};
+                    }
+                }
             }
         }
     }
+}
+
+std::string YamlWriter::toYamlString() const
+{
+    AnyMap output;
+    output["generator"] = "YamlWriter";
+    output["cantera-version"] = CANTERA_VERSION;
+    time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    output["date"] = trimCopy(std::ctime(&now));
+
+    std::vector<AnyMap> phaseDefs;
+    std::vector<AnyMap> speciesDefs;
+    std::vector<std::pair<std::string, std::vector<AnyMap>>> reactionSections;
+    buildDefinitionSections(phaseDefs, speciesDefs, reactionSections);
+
+    output["phases"] = phaseDefs;
+    output["species"] = speciesDefs;
+    for (auto& section : reactionSections) {
+        output[section.first] = std::move(section.second);
+    }
 
     output.setMetadata("precision", AnyValue(m_float_precision));
     output.setUnits(m_output_units);
@@ -154,6 +173,145 @@ void YamlWriter::toYamlFile(const std::string& filename) const
     out << toYamlString();
 }
 
+namespace {
+
+//! Move large numeric arrays out of *node* into the binary appendix,
+//! replacing each with a 'binary-data' reference map. Arrays are written as
+//! raw doubles in Cantera's native units, before any output unit conversions
+//! are applied.
+void extractBinaryArrays(AnyMap& node, std::ofstream& bin,
+                         const std::string& binFile, size_t threshold,
+                         size_t& offset)
+{
+    std::vector<std::string> keys;
+    for (const auto& item : node) {
+        keys.push_back(item.first);
+    }
+    for (const auto& key : keys) {
+        AnyValue& value = node[key];
+        if (value.is<vector_fp>() && value.asVector<double>().size() >= threshold) {
+            const vector_fp& data = value.asVector<double>();
+            bin.write(reinterpret_cast<const char*>(data.data()),
+                      data.size() * sizeof(double));
+            AnyMap ref;
+            ref["file"] = binFile;
+            ref["offset"] = static_cast<long int>(offset);
+            ref["length"] = static_cast<long int>(data.size());
+            ref["dtype"] = "float64";
+            ref.setFlowStyle();
+            offset += data.size() * sizeof(double);
+            AnyMap wrapper;
+            wrapper["binary-data"] = std::move(ref);
+            value = std::move(wrapper);
+        } else if (value.is<AnyMap>()) {
+            extractBinaryArrays(value.as<AnyMap>(), bin, binFile, threshold,
+                                offset);
+        } else if (value.is<std::vector<AnyMap>>()) {
+            for (auto& item : value.asVector<AnyMap>()) {
+                extractBinaryArrays(item, bin, binFile, threshold, offset);
+            }
+        }
+    }
+}
+
+} // end unnamed namespace
+
+void YamlWriter::toYamlFileStreaming(const std::string& filename) const
+{
+    // A large stream buffer keeps the many small writes made while splicing
+    // section fragments from turning into individual filesystem operations
+    std::vector<char> iobuf(1 << 20);
+    std::ofstream out;
+    out.rdbuf()->pubsetbuf(iobuf.data(), iobuf.size());
+    out.open(filename);
+    if (!out) {
+        throw CanteraError("YamlWriter::toYamlFileStreaming",
+            "Could not open file '{}' for writing.", filename);
+    }
+
+    std::ofstream bin;
+    std::string binBase;
+    size_t binOffset = 0;
+    if (m_binary_threshold) {
+        std::string binName = filename + ".bin";
+        bin.open(binName, std::ios::binary | std::ios::trunc);
+        if (!bin) {
+            throw CanteraError("YamlWriter::toYamlFileStreaming",
+                "Could not open file '{}' for writing.", binName);
+        }
+        // References use the base name so the pair of files can be relocated
+        // together
+        size_t slash = binName.find_last_of("/\\");
+        binBase = (slash == npos) ? binName : binName.substr(slash + 1);
+    }
+
+    out << "generator: YamlWriter\n";
+    out << "cantera-version: " << CANTERA_VERSION << "\n";
+    time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    out << "date: " << trimCopy(std::ctime(&now)) << "\n";
+    AnyMap deltaUnits = m_output_units.getDelta(UnitSystem());
+    if (deltaUnits.size()) {
+        AnyMap units;
+        units["units"] = std::move(deltaUnits);
+        units["units"].setFlowStyle();
+        out << units.toYamlString();
+    }
+
+    std::vector<AnyMap> phaseDefs;
+    std::vector<AnyMap> speciesDefs;
+    std::vector<std::pair<std::string, std::vector<AnyMap>>> reactionSections;
+    buildDefinitionSections(phaseDefs, speciesDefs, reactionSections);
+
+    // Serialize one section in fixed-size batches of entries, so that only a
+    // small part of the document exists as emitter nodes at any time. Each
+    // batch is converted and formatted exactly as toYamlString() would do for
+    // the whole document; the leading section key (and the units line, which
+    // is already part of the file header) is stripped from all but the first
+    // batch before splicing the fragments together.
+    auto emitSection = [&](const std::string& key, std::vector<AnyMap>& defs) {
+        const size_t batchSize = 50;
+        if (defs.empty()) {
+            out << key << ": []\n";
+            return;
+        }
+        bool firstBatch = true;
+        for (size_t start = 0; start < defs.size(); start += batchSize) {
+            size_t stop = std::min(defs.size(), start + batchSize);
+            std::vector<AnyMap> batch(
+                std::make_move_iterator(defs.begin() + start),
+                std::make_move_iterator(defs.begin() + stop));
+            if (m_binary_threshold) {
+                for (auto& def : batch) {
+                    extractBinaryArrays(def, bin, binBase, m_binary_threshold,
+                                        binOffset);
+                }
+            }
+            AnyMap chunk;
+            chunk[key] = std::move(batch);
+            chunk.setMetadata("precision", AnyValue(m_float_precision));
+            chunk.setUnits(m_output_units);
+            std::string text = chunk.toYamlString();
+            size_t pos = text.find(key + ":\n");
+            if (pos == npos) {
+                throw CanteraError("YamlWriter::toYamlFileStreaming",
+                    "Serializing section '{}' produced unexpected output", key);
+            }
+            if (firstBatch) {
+                out << text.substr(pos);
+                firstBatch = false;
+            } else {
+                out << text.substr(pos + key.size() + 2);
+            }
+        }
+    };
+
+    emitSection("phases", phaseDefs);
+    emitSection("species", speciesDefs);
+    for (auto& section : reactionSections) {
+        emitSection(section.first, section.second);
+    }
+}
+
 void YamlWriter::setUnits(const std::map<std::string, std::string>& units)
 {
     m_output_units = UnitSystem();
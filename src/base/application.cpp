@@ -9,6 +9,8 @@
 #include "cantera/base/stringUtils.h"
 #include "units.h"
 
+#include <atomic>
+#include <chrono>
 #include <fstream>
 #include <sstream>
 #include <mutex>
@@ -56,7 +58,139 @@ int get_modified_time(const std::string& path) {
 #endif
 }
 
+//! Returns true if the persistent cache of CTML converted from CTI input is
+//! enabled via the CANTERA_CTML_CACHE environment variable
+static bool ctmlCacheEnabled()
+{
+    const char* flag = getenv("CANTERA_CTML_CACHE");
+    return flag != nullptr && flag[0] != '\0' && string(flag) != "0";
+}
+
+//! Returns true if log output through the default logger should be routed
+//! through the background writer thread (see AsyncLogSink), enabled via the
+//! CANTERA_ASYNC_LOG environment variable
+static bool asyncLogEnabled()
+{
+    static const char* flag = getenv("CANTERA_ASYNC_LOG");
+    return flag != nullptr && flag[0] != '\0' && string(flag) != "0";
+}
+
+namespace {
+
+//! Background writer for log messages
+/*!
+ * Messages are passed from the logging threads to a single consumer thread
+ * through a fixed-capacity multi-producer queue (Dmitry Vyukov's bounded
+ * MPMC algorithm), so threads that log concurrently never take a lock and
+ * never wait for the actual output device. When the queue is full, producers
+ * yield until the consumer catches up; memory use stays bounded and no
+ * messages are dropped.
+ */
+class AsyncLogSink
+{
+public:
+    AsyncLogSink()
+        : m_cells(capacity)
+        , m_push(0)
+        , m_pop(0)
+        , m_stop(false)
+    {
+        for (size_t i = 0; i < capacity; i++) {
+            m_cells[i].seq.store(i, std::memory_order_relaxed);
+        }
+        m_consumer = std::thread(&AsyncLogSink::run, this);
+    }
+
+    ~AsyncLogSink() {
+        m_stop.store(true, std::memory_order_release);
+        m_consumer.join(); // run() drains the queue before returning
+    }
+
+    //! The single sink instance, created on first use
+    static AsyncLogSink& sink() {
+        static AsyncLogSink s;
+        return s;
+    }
+
+    //! Enqueue a message for the consumer thread
+    void write(std::string msg) {
+        while (!tryPush(msg)) {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    static const size_t capacity = 1024; // must be a power of two
+
+    struct Cell {
+        std::atomic<size_t> seq;
+        std::string msg;
+    };
+
+    //! Claim a cell and move *msg* into it. Returns false (leaving *msg*
+    //! intact) if the queue is full.
+    bool tryPush(std::string& msg) {
+        size_t pos = m_push.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = m_cells[pos & (capacity - 1)];
+            size_t seq = cell.seq.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t) seq - (intptr_t) pos;
+            if (diff == 0) {
+                if (m_push.compare_exchange_weak(pos, pos + 1,
+                                                 std::memory_order_relaxed)) {
+                    cell.msg = std::move(msg);
+                    cell.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_push.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    //! Retrieve the next message, if any. Only called by the consumer.
+    bool tryPop(std::string& msg) {
+        size_t pos = m_pop.load(std::memory_order_relaxed);
+        Cell& cell = m_cells[pos & (capacity - 1)];
+        size_t seq = cell.seq.load(std::memory_order_acquire);
+        if ((intptr_t) seq - (intptr_t) (pos + 1) < 0) {
+            return false;
+        }
+        m_pop.store(pos + 1, std::memory_order_relaxed);
+        msg = std::move(cell.msg);
+        cell.seq.store(pos + capacity, std::memory_order_release);
+        return true;
+    }
+
+    void run() {
+        Logger out;
+        std::string msg;
+        while (true) {
+            if (tryPop(msg)) {
+                out.write(msg);
+            } else if (m_stop.load(std::memory_order_acquire)) {
+                std::cout.flush();
+                return;
+            } else {
+                std::cout.flush();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+
+    std::vector<Cell> m_cells;
+    std::atomic<size_t> m_push;
+    std::atomic<size_t> m_pop;
+    std::atomic<bool> m_stop;
+    std::thread m_consumer;
+};
+
+} // end unnamed namespace
+
 Application::Messages::Messages()
+    : usingDefaultLogger(true)
 {
     // install a default logwriter that writes to standard
     // output / standard error
@@ -85,42 +219,45 @@ int Application::Messages::getErrorCount()
 void Application::Messages::setLogger(Logger* _logwriter)
 {
     logwriter.reset(_logwriter);
+    usingDefaultLogger = false;
 }
 
 void Application::Messages::writelog(const std::string& msg)
 {
-    logwriter->write(msg);
+    if (usingDefaultLogger && asyncLogEnabled()) {
+        AsyncLogSink::sink().write(msg);
+    } else {
+        logwriter->write(msg);
+    }
 }
 
 void Application::Messages::writelogendl()
 {
-    logwriter->writeendl();
+    if (usingDefaultLogger && asyncLogEnabled()) {
+        AsyncLogSink::sink().write("\n");
+    } else {
+        logwriter->writeendl();
+    }
 }
 
-//! Mutex for access to string messages
-static std::mutex msg_mutex;
+Application::pMessages_t& Application::ThreadMessages::threadMessages()
+{
+    static thread_local pMessages_t pMsgs;
+    return pMsgs;
+}
 
 Application::Messages* Application::ThreadMessages::operator ->()
 {
-    std::unique_lock<std::mutex> msgLock(msg_mutex);
-    std::thread::id curId = std::this_thread::get_id();
-    auto iter = m_threadMsgMap.find(curId);
-    if (iter != m_threadMsgMap.end()) {
-        return iter->second.get();
-    }
-    pMessages_t pMsgs(new Messages());
-    m_threadMsgMap.insert({curId, pMsgs});
+    pMessages_t& pMsgs = threadMessages();
+    if (!pMsgs) {
+        pMsgs.reset(new Messages());
+    }
     return pMsgs.get();
 }
 
 void Application::ThreadMessages::removeThreadMessages()
 {
-    std::unique_lock<std::mutex> msgLock(msg_mutex);
-    std::thread::id curId = std::this_thread::get_id();
-    auto iter = m_threadMsgMap.find(curId);
-    if (iter != m_threadMsgMap.end()) {
-        m_threadMsgMap.erase(iter);
-    }
+    threadMessages().reset();
 }
 
 Application::Application() :
@@ -212,9 +349,40 @@ XML_Node* Application::get_XML_File(const std::string& file, int debug)
     }
     XML_Node* x = new XML_Node("doc");
     if (ext != ".xml" && ext != ".ctml") {
-        // Assume that we are trying to open a cti file. Do the conversion to XML.
-        std::stringstream phase_xml(ct2ctml_string(path));
-        x->build(phase_xml, path);
+        // Assume that we are trying to open a cti file. The conversion to XML
+        // spawns a Python interpreter, so when the CTML cache is enabled, keep
+        // a persistent copy of the converted file and reuse it on subsequent
+        // process starts as long as the source file is unchanged.
+        std::string cachePath = path + ".ctcache.xml";
+        std::string header = fmt::format("<!-- ctcache {} {} -->",
+                                         CANTERA_VERSION, mtime);
+        bool cached = false;
+        if (ctmlCacheEnabled()) {
+            std::ifstream cacheFile(cachePath);
+            std::string firstLine;
+            if (cacheFile.good() && std::getline(cacheFile, firstLine)
+                && firstLine == header) {
+                try {
+                    x->build(cacheFile, cachePath);
+                    cached = true;
+                } catch (CanteraError&) {
+                    // Corrupt cache file; fall through and reconvert
+                    delete x;
+                    x = new XML_Node("doc");
+                }
+            }
+        }
+        if (!cached) {
+            std::string converted = ct2ctml_string(path);
+            std::stringstream phase_xml(converted);
+            x->build(phase_xml, path);
+            if (ctmlCacheEnabled()) {
+                std::ofstream out(cachePath);
+                if (out.good()) {
+                    out << header << "\n" << converted;
+                }
+            }
+        }
     } else {
         x->build(path);
     }
@@ -154,13 +154,24 @@ protected:
 
         //! Current pointer to the logwriter
         std::unique_ptr<Logger> logwriter;
+
+        //! `true` while the default stdout logger is installed. Only output
+        //! through the default logger may be routed through the background
+        //! writer thread; a logger installed with setLogger() is always
+        //! called directly on the logging thread.
+        bool usingDefaultLogger;
     };
 
     //! Typedef for thread specific messages
     typedef shared_ptr<Messages> pMessages_t;
 
-    //! Class that stores thread messages for each thread, and retrieves them
-    //! based on the thread id.
+    //! Class that provides each thread with its own Messages instance
+    /*!
+     * Each thread owns its message stack outright (it is stored in a
+     * thread_local variable), so locating it involves no map lookup and no
+     * locking, and threads never contend with each other when errors or
+     * warnings are recorded.
+     */
     class ThreadMessages
     {
     public:
@@ -176,12 +187,10 @@ protected:
         //! Remove a local thread message
         void removeThreadMessages();
 
-        //! Typedef for map between a thread and the message
-        typedef std::map<std::thread::id, pMessages_t> threadMsgMap_t;
-
     private:
-        //! Thread Msg Map
-        threadMsgMap_t m_threadMsgMap;
+        //! The calling thread's message stack, created on first use and
+        //! released automatically when the thread exits
+        static pMessages_t& threadMessages();
     };
 
 protected:
@@ -27,6 +27,17 @@ void checkFinite(const double tmp)
 
 void checkFinite(const std::string& name, double* values, size_t N)
 {
+    // Branch-free pre-scan that the compiler can vectorize: the accumulator
+    // stays exactly zero for finite inputs and becomes NaN if any element is
+    // NaN or Inf, so the elementwise inspection below only runs when an
+    // error message needs to be built
+    double acc = 0.0;
+    for (size_t i = 0; i < N; i++) {
+        acc += values[i] * 0.0;
+    }
+    if (acc == 0.0) {
+        return;
+    }
     for (size_t i = 0; i < N; i++) {
         if (!std::isfinite(values[i])) {
             std::string message = name + " contains non-finite elements:\n\n";
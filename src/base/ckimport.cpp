@@ -0,0 +1,947 @@
+/**
+ *  @file ckimport.cpp
+ *   Native importer for Chemkin-format input files (see
+ *   \ref Cantera::importChemkin).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/ckimport.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/global.h"
+#include "cantera/base/stringUtils.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/KineticsFactory.h"
+#include "cantera/transport/TransportBase.h"
+#include "cantera/transport/TransportFactory.h"
+
+#include <boost/algorithm/string.hpp>
+
+#include <cstdlib>
+#include <fstream>
+
+namespace ba = boost::algorithm;
+
+namespace Cantera
+{
+
+namespace { // unnamed namespace for the parser internals
+
+//! An input line with its comment stripped, plus its position in the file
+//! for error messages. Column positions are preserved, since the thermo
+//! database format is fixed-column.
+struct CkLine
+{
+    std::string text;
+    int number;
+};
+
+std::string ckUpper(const std::string& s)
+{
+    std::string out = s;
+    for (char& c : out) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    return out;
+}
+
+//! Read a CK input file, dropping '!' comments and blank lines
+std::vector<CkLine> readCkLines(const std::string& filename)
+{
+    std::ifstream in(findInputFile(filename));
+    if (!in) {
+        throw CanteraError("importChemkin",
+                           "Could not open input file '{}'", filename);
+    }
+    std::vector<CkLine> lines;
+    std::string raw;
+    int number = 0;
+    while (std::getline(in, raw)) {
+        number++;
+        size_t bang = raw.find('!');
+        if (bang != npos) {
+            raw.erase(bang);
+        }
+        while (!raw.empty() && (raw.back() == '\r' || raw.back() == '\n')) {
+            raw.pop_back();
+        }
+        if (trimCopy(raw).empty()) {
+            continue;
+        }
+        lines.push_back({raw, number});
+    }
+    return lines;
+}
+
+//! Parse a CK numeric field, accepting Fortran 'D' exponents
+double ckValue(const std::string& val, const CkLine& line)
+{
+    std::string s = trimCopy(val);
+    for (char& c : s) {
+        if (c == 'd' || c == 'D') {
+            c = 'e';
+        }
+    }
+    try {
+        return fpValueCheck(s);
+    } catch (CanteraError&) {
+        throw CanteraError("importChemkin",
+            "Invalid number '{}' on line {}", trimCopy(val), line.number);
+    }
+}
+
+//! Check whether a token parses completely as a floating-point number
+bool looksLikeNumber(const std::string& tok)
+{
+    std::string s = trimCopy(tok);
+    for (char& c : s) {
+        if (c == 'd' || c == 'D') {
+            c = 'e';
+        }
+    }
+    if (s.empty()) {
+        return false;
+    }
+    char* end = nullptr;
+    std::strtod(s.c_str(), &end);
+    return end == s.c_str() + s.size();
+}
+
+//! Normalize a CK element name ('AR', 'ar') to the standard symbol ('Ar')
+std::string elementSymbol(const std::string& tok)
+{
+    std::string out = ckUpper(tok);
+    for (size_t i = 1; i < out.size(); i++) {
+        out[i] = static_cast<char>(std::tolower(
+            static_cast<unsigned char>(out[i])));
+    }
+    return out;
+}
+
+//! Case-insensitive species lookup built from the SPECIES section
+struct SpeciesTable
+{
+    void add(const std::string& name) {
+        names.push_back(name);
+        byUpper[ckUpper(name)] = name;
+    }
+
+    //! Return the declared name matching *tok*, or an empty string
+    std::string match(const std::string& tok) const {
+        auto iter = byUpper.find(ckUpper(tok));
+        return (iter == byUpper.end()) ? std::string() : iter->second;
+    }
+
+    std::vector<std::string> names;
+    std::map<std::string, std::string> byUpper;
+};
+
+//! Parse fixed-format NASA-7 thermo entries, starting at lines[i]. Entries
+//! for species not listed in *species* are skipped. Stops at an 'END' line
+//! or at the end of the input; *i* is left pointing past the consumed lines.
+void parseThermoEntries(const std::vector<CkLine>& lines, size_t& i,
+                        const SpeciesTable& species,
+                        std::map<std::string, AnyMap>& thermoOut,
+                        double* globalT)
+{
+    // An optional line giving the default low, common, and high temperatures
+    // may precede the first entry
+    if (i < lines.size()) {
+        std::vector<std::string> toks;
+        tokenizeString(lines[i].text, toks);
+        if (toks.size() == 3 && looksLikeNumber(toks[0])
+            && looksLikeNumber(toks[1]) && looksLikeNumber(toks[2])) {
+            globalT[0] = ckValue(toks[0], lines[i]);
+            globalT[1] = ckValue(toks[1], lines[i]);
+            globalT[2] = ckValue(toks[2], lines[i]);
+            i++;
+        }
+    }
+
+    while (i < lines.size()) {
+        std::vector<std::string> toks;
+        tokenizeString(lines[i].text, toks);
+        if (!toks.empty() && ckUpper(toks[0]) == "END") {
+            i++;
+            return;
+        }
+        std::string l1 = lines[i].text;
+        l1.resize(std::max<size_t>(l1.size(), 80), ' ');
+        if (l1[79] != '1') {
+            // not the first card of an entry; headers and stray text in
+            // thermo databases are common, so skip it
+            i++;
+            continue;
+        }
+        if (i + 3 >= lines.size()) {
+            throw CanteraError("importChemkin",
+                "Incomplete thermo entry starting on line {}",
+                lines[i].number);
+        }
+        std::vector<std::string> nameToks;
+        tokenizeString(l1.substr(0, 18), nameToks);
+        if (nameToks.empty()) {
+            throw CanteraError("importChemkin",
+                "Missing species name in thermo entry on line {}",
+                lines[i].number);
+        }
+        std::string name = species.match(nameToks[0]);
+        if (name.empty()) {
+            // entry for a species not declared in the mechanism
+            i += 4;
+            continue;
+        }
+
+        // elemental composition: four 5-column fields starting at column 25,
+        // plus an occasionally-used fifth field at column 74
+        AnyMap comp;
+        for (int f = 0; f < 5; f++) {
+            size_t start = (f < 4) ? 24 + 5*f : 73;
+            std::string sym = trimCopy(l1.substr(start, 2));
+            std::string cnt = trimCopy(l1.substr(start + 2, 3));
+            if (sym.empty() || sym == "0" || cnt.empty()) {
+                continue;
+            }
+            double value = ckValue(cnt, lines[i]);
+            if (value != 0.0) {
+                comp[elementSymbol(sym)] = value;
+            }
+        }
+
+        double Tlow = ckValue(l1.substr(45, 10), lines[i]);
+        double Thigh = ckValue(l1.substr(55, 10), lines[i]);
+        std::string midField = trimCopy(l1.substr(65, 8));
+        double Tmid = midField.empty() ? globalT[1] : ckValue(midField, lines[i]);
+
+        // three coefficient cards with five 15-column fields each; the high-T
+        // polynomial comes first
+        double c[15];
+        size_t nc = 0;
+        for (size_t card = 1; card <= 3; card++) {
+            std::string l = lines[i + card].text;
+            l.resize(std::max<size_t>(l.size(), 75), ' ');
+            size_t nf = (card == 3) ? 4 : 5;
+            for (size_t f = 0; f < nf; f++) {
+                c[nc++] = ckValue(l.substr(15*f, 15), lines[i + card]);
+            }
+        }
+        vector_fp high(c, c + 7);
+        vector_fp low(c + 7, c + 14);
+
+        AnyMap thermo;
+        thermo["model"] = "NASA7";
+        thermo["temperature-ranges"] = vector_fp{Tlow, Tmid, Thigh};
+        thermo["data"] = std::vector<vector_fp>{low, high};
+
+        AnyMap sp;
+        sp["name"] = name;
+        sp["composition"] = std::move(comp);
+        sp["thermo"] = std::move(thermo);
+        thermoOut[name] = std::move(sp);
+        i += 4;
+    }
+}
+
+//! Working representation of one reaction while its auxiliary lines are
+//! being collected
+struct CkReaction
+{
+    std::string lhs; //!< canonical left-hand side, including any '+ M'
+    std::string rhs; //!< canonical right-hand side
+    bool reversible = true;
+    bool thirdBody = false; //!< plain '+M' collider on both sides
+    std::string falloffPartner; //!< '(+M)' or '(+name)' collider, if any
+    vector_fp rate; //!< A, b, Ea from the reaction line
+    vector_fp low;
+    vector_fp high;
+    vector_fp troe;
+    vector_fp sri;
+    vector_fp rev;
+    bool duplicate = false;
+    AnyMap efficiencies;
+    AnyMap orders;
+    std::vector<AnyMap> plog;
+    int lineNumber = 0;
+};
+
+//! Split one side of a reaction equation into canonical '+'-separated terms.
+//! Species names are matched case-insensitively against the declared species
+//! so that names containing '+' (ions) are reassembled correctly.
+std::string parseReactionSide(std::string side, const SpeciesTable& species,
+                              CkReaction& R, const CkLine& line)
+{
+    // remove embedded whitespace
+    std::string compact;
+    for (char ch : side) {
+        if (!std::isspace(static_cast<unsigned char>(ch))) {
+            compact += ch;
+        }
+    }
+
+    // a trailing '(+M)' or '(+name)' marks the falloff collider
+    size_t paren = compact.rfind("(+");
+    if (paren != npos && !compact.empty() && compact.back() == ')') {
+        std::string inner = compact.substr(paren + 2,
+                                           compact.size() - paren - 3);
+        std::string partner;
+        if (ckUpper(inner) == "M") {
+            partner = "M";
+        } else {
+            partner = species.match(inner);
+            if (partner.empty()) {
+                throw CanteraError("importChemkin",
+                    "Unknown falloff collider '(+{})' on line {}",
+                    inner, line.number);
+            }
+        }
+        if (!R.falloffPartner.empty() && R.falloffPartner != partner) {
+            throw CanteraError("importChemkin",
+                "Mismatched falloff colliders on line {}", line.number);
+        }
+        R.falloffPartner = partner;
+        compact.erase(paren);
+    }
+
+    std::vector<std::string> pieces;
+    size_t start = 0;
+    while (start <= compact.size()) {
+        size_t plus = compact.find('+', start);
+        if (plus == npos) {
+            pieces.push_back(compact.substr(start));
+            break;
+        }
+        pieces.push_back(compact.substr(start, plus - start));
+        start = plus + 1;
+    }
+
+    // Resolve one term to a stoichiometric coefficient and species name.
+    // Returns false if the term is not a known species (with or without a
+    // leading numeric coefficient).
+    auto resolve = [&](const std::string& term, double& coef,
+                       std::string& name) {
+        name = species.match(term);
+        if (!name.empty()) {
+            coef = 1.0;
+            return true;
+        }
+        size_t nd = 0;
+        while (nd < term.size()
+               && (std::isdigit(static_cast<unsigned char>(term[nd]))
+                   || term[nd] == '.')) {
+            nd++;
+        }
+        for (size_t len = nd; len >= 1; len--) {
+            name = species.match(term.substr(len));
+            if (!name.empty() && looksLikeNumber(term.substr(0, len))) {
+                coef = fpValue(term.substr(0, len));
+                return true;
+            }
+        }
+        return false;
+    };
+
+    std::vector<std::string> terms;
+    bool sawM = false;
+    size_t k = 0;
+    while (k < pieces.size()) {
+        std::string term = pieces[k];
+        double coef;
+        std::string name;
+        // reassemble pieces of a species name that itself contains '+'
+        while (!resolve(term, coef, name) && ckUpper(term) != "M"
+               && k + 1 < pieces.size()) {
+            k++;
+            term += "+" + pieces[k];
+        }
+        if (resolve(term, coef, name)) {
+            if (coef == 1.0) {
+                terms.push_back(name);
+            } else {
+                terms.push_back(fmt::format("{} {}", coef, name));
+            }
+        } else if (ckUpper(term) == "M") {
+            sawM = true;
+        } else {
+            throw CanteraError("importChemkin",
+                "Undeclared species '{}' in reaction on line {}",
+                term, line.number);
+        }
+        k++;
+    }
+    if (terms.empty()) {
+        throw CanteraError("importChemkin",
+            "Empty reaction side on line {}", line.number);
+    }
+    if (sawM) {
+        R.thirdBody = true;
+    }
+
+    std::string out = terms[0];
+    for (size_t n = 1; n < terms.size(); n++) {
+        out += " + " + terms[n];
+    }
+    return out;
+}
+
+//! Parse a reaction line: an equation followed by the three Arrhenius
+//! parameters A, b, and Ea
+CkReaction parseReactionLine(const CkLine& line, const SpeciesTable& species)
+{
+    std::vector<std::string> toks;
+    tokenizeString(line.text, toks);
+    if (toks.size() < 4 || !looksLikeNumber(toks[toks.size() - 3])
+        || !looksLikeNumber(toks[toks.size() - 2])
+        || !looksLikeNumber(toks.back())) {
+        throw CanteraError("importChemkin",
+            "Expected an equation followed by A, b, and Ea on line {}",
+            line.number);
+    }
+
+    CkReaction R;
+    R.lineNumber = line.number;
+    R.rate = {ckValue(toks[toks.size() - 3], line),
+              ckValue(toks[toks.size() - 2], line),
+              ckValue(toks.back(), line)};
+
+    std::string eq;
+    for (size_t n = 0; n + 3 < toks.size(); n++) {
+        eq += toks[n];
+    }
+    size_t arrow = eq.find("<=>");
+    size_t arrowLen = 3;
+    if (arrow == npos) {
+        arrow = eq.find("=>");
+        arrowLen = 2;
+        if (arrow == npos) {
+            arrow = eq.find('=');
+            arrowLen = 1;
+        } else {
+            R.reversible = false;
+        }
+    }
+    if (arrow == npos) {
+        throw CanteraError("importChemkin",
+            "Missing '=' in reaction equation on line {}", line.number);
+    }
+    R.lhs = parseReactionSide(eq.substr(0, arrow), species, R, line);
+    R.rhs = parseReactionSide(eq.substr(arrow + arrowLen), species, R, line);
+    return R;
+}
+
+//! Parse one auxiliary line following a reaction (keywords with optional
+//! slash-delimited parameters, or third-body efficiency pairs)
+void parseAuxLine(const CkLine& line, CkReaction& R,
+                  const SpeciesTable& species)
+{
+    const std::string& text = line.text;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        while (pos < text.size()
+               && std::isspace(static_cast<unsigned char>(text[pos]))) {
+            pos++;
+        }
+        if (pos == text.size()) {
+            break;
+        }
+        size_t kw0 = pos;
+        while (pos < text.size() && text[pos] != '/'
+               && !std::isspace(static_cast<unsigned char>(text[pos]))) {
+            pos++;
+        }
+        std::string keyword = text.substr(kw0, pos - kw0);
+        while (pos < text.size()
+               && std::isspace(static_cast<unsigned char>(text[pos]))) {
+            pos++;
+        }
+        std::vector<std::string> params;
+        if (pos < text.size() && text[pos] == '/') {
+            size_t close = text.find('/', pos + 1);
+            if (close == npos) {
+                throw CanteraError("importChemkin",
+                    "Unterminated '/' parameter list on line {}",
+                    line.number);
+            }
+            tokenizeString(text.substr(pos + 1, close - pos - 1), params);
+            pos = close + 1;
+        }
+
+        auto values = [&](size_t nMin, size_t nMax) {
+            if (params.size() < nMin || params.size() > nMax) {
+                throw CanteraError("importChemkin",
+                    "Keyword '{}' on line {} takes {} to {} parameters",
+                    keyword, line.number, nMin, nMax);
+            }
+            vector_fp v;
+            for (auto& p : params) {
+                v.push_back(ckValue(p, line));
+            }
+            return v;
+        };
+
+        std::string KW = ckUpper(keyword);
+        if (KW == "DUP" || KW == "DUPLICATE") {
+            R.duplicate = true;
+        } else if (KW == "LOW") {
+            R.low = values(3, 3);
+        } else if (KW == "HIGH") {
+            R.high = values(3, 3);
+        } else if (KW == "REV") {
+            R.rev = values(3, 3);
+        } else if (KW == "TROE") {
+            R.troe = values(3, 4);
+        } else if (KW == "SRI") {
+            R.sri = values(3, 5);
+        } else if (KW == "PLOG") {
+            vector_fp v = values(4, 4);
+            AnyMap entry;
+            entry["P"] = fmt::format("{} atm", v[0]);
+            entry["A"] = v[1];
+            entry["b"] = v[2];
+            entry["Ea"] = v[3];
+            R.plog.push_back(std::move(entry));
+        } else if (KW == "FORD") {
+            if (params.size() != 2) {
+                throw CanteraError("importChemkin",
+                    "FORD on line {} takes a species name and an order",
+                    line.number);
+            }
+            std::string name = species.match(params[0]);
+            if (name.empty()) {
+                throw CanteraError("importChemkin",
+                    "Undeclared species '{}' in FORD on line {}",
+                    params[0], line.number);
+            }
+            R.orders[name] = ckValue(params[1], line);
+        } else if (!species.match(keyword).empty()) {
+            if (params.size() != 1) {
+                throw CanteraError("importChemkin",
+                    "Expected a single efficiency for species '{}' on "
+                    "line {}", keyword, line.number);
+            }
+            R.efficiencies[species.match(keyword)] = ckValue(params[0], line);
+        } else {
+            throw CanteraError("importChemkin",
+                "Unsupported auxiliary keyword '{}' on line {}",
+                keyword, line.number);
+        }
+    }
+}
+
+AnyMap arrheniusNode(const vector_fp& v)
+{
+    AnyMap node;
+    node["A"] = v[0];
+    node["b"] = v[1];
+    node["Ea"] = v[2];
+    return node;
+}
+
+//! Convert a completed CkReaction to its YAML-equivalent node(s) and append
+//! them to *out*. A reaction with explicit reverse parameters (REV) becomes
+//! a pair of irreversible reactions.
+void addReaction(std::vector<AnyMap>& out, CkReaction& R)
+{
+    std::string lhs = R.lhs;
+    std::string rhs = R.rhs;
+    if (!R.falloffPartner.empty()) {
+        std::string suffix = (R.falloffPartner == "M")
+            ? " (+M)" : fmt::format(" (+{})", R.falloffPartner);
+        lhs += suffix;
+        rhs += suffix;
+    } else if (R.thirdBody) {
+        lhs += " + M";
+        rhs += " + M";
+    }
+
+    AnyMap node;
+    bool reversible = R.reversible && R.rev.empty();
+    node["equation"] = lhs + (reversible ? " <=> " : " => ") + rhs;
+
+    if (!R.falloffPartner.empty()) {
+        if (!R.low.empty()) {
+            node["type"] = "falloff";
+            node["low-P-rate-constant"] = arrheniusNode(R.low);
+            node["high-P-rate-constant"] = arrheniusNode(R.rate);
+        } else if (!R.high.empty()) {
+            node["type"] = "chemically-activated";
+            node["low-P-rate-constant"] = arrheniusNode(R.rate);
+            node["high-P-rate-constant"] = arrheniusNode(R.high);
+        } else {
+            throw CanteraError("importChemkin",
+                "Falloff reaction on line {} has no LOW or HIGH line",
+                R.lineNumber);
+        }
+        if (!R.troe.empty()) {
+            AnyMap troe;
+            troe["A"] = R.troe[0];
+            troe["T3"] = R.troe[1];
+            troe["T1"] = R.troe[2];
+            if (R.troe.size() == 4) {
+                troe["T2"] = R.troe[3];
+            }
+            node["Troe"] = std::move(troe);
+        } else if (!R.sri.empty()) {
+            AnyMap sri;
+            sri["A"] = R.sri[0];
+            sri["B"] = R.sri[1];
+            sri["C"] = R.sri[2];
+            if (R.sri.size() == 5) {
+                sri["D"] = R.sri[3];
+                sri["E"] = R.sri[4];
+            }
+            node["SRI"] = std::move(sri);
+        }
+        if (R.falloffPartner != "M") {
+            // specific-collider form, e.g. 'H + O2 (+AR) = HO2 (+AR)'
+            R.efficiencies[R.falloffPartner] = 1.0;
+            node["default-efficiency"] = 0.0;
+        }
+    } else if (R.thirdBody) {
+        node["type"] = "three-body";
+        node["rate-constant"] = arrheniusNode(R.rate);
+    } else if (!R.plog.empty()) {
+        node["type"] = "pressure-dependent-Arrhenius";
+        node["rate-constants"] = R.plog;
+    } else {
+        node["rate-constant"] = arrheniusNode(R.rate);
+    }
+
+    if (!R.efficiencies.empty()) {
+        if (R.falloffPartner.empty() && !R.thirdBody) {
+            throw CanteraError("importChemkin",
+                "Third-body efficiencies given for reaction on line {}, "
+                "which has no 'M' collider", R.lineNumber);
+        }
+        node["efficiencies"] = R.efficiencies;
+    }
+    if (R.duplicate) {
+        node["duplicate"] = true;
+    }
+    if (!R.orders.empty()) {
+        node["orders"] = R.orders;
+    }
+
+    if (!R.rev.empty()) {
+        if (!R.falloffPartner.empty() || !R.plog.empty()) {
+            throw CanteraError("importChemkin",
+                "REV is not supported for the falloff or PLOG reaction on "
+                "line {}", R.lineNumber);
+        }
+        AnyMap reverse = node;
+        reverse["equation"] = rhs + " => " + lhs;
+        reverse["rate-constant"] = arrheniusNode(R.rev);
+        if (!R.orders.empty()) {
+            reverse.erase("orders");
+        }
+        out.push_back(std::move(node));
+        out.push_back(std::move(reverse));
+    } else {
+        out.push_back(std::move(node));
+    }
+}
+
+//! Map a unit keyword from the REACTIONS line onto the corresponding
+//! Cantera unit string. Returns true if the keyword was recognized.
+bool applyUnitKeyword(const std::string& keyword, std::string& eUnits,
+                      std::string& qUnits)
+{
+    std::string KW = ckUpper(keyword);
+    if (KW == "CAL/MOLE") {
+        eUnits = "cal/mol";
+    } else if (KW == "KCAL/MOLE") {
+        eUnits = "kcal/mol";
+    } else if (KW == "JOULES/MOLE") {
+        eUnits = "J/mol";
+    } else if (KW == "KJOULES/MOLE" || KW == "KJOU") {
+        eUnits = "kJ/mol";
+    } else if (KW == "KELVINS") {
+        eUnits = "K";
+    } else if (KW == "EVOLTS") {
+        eUnits = "eV";
+    } else if (KW == "MOLES") {
+        qUnits = "mol";
+    } else if (KW == "MOLECULES") {
+        qUnits = "molec";
+    } else {
+        return false;
+    }
+    return true;
+}
+
+//! Parse a transport database, attaching entries to the matching species
+//! nodes. Geometry flags 0/1/2 map to atom/linear/nonlinear; the remaining
+//! fields use the customary units of the YAML 'gas' transport model, so they
+//! pass through unchanged.
+void parseTransportFile(const std::string& filename,
+                        const SpeciesTable& species,
+                        std::map<std::string, AnyMap>& speciesData)
+{
+    static const char* geometries[] = {"atom", "linear", "nonlinear"};
+    for (const auto& line : readCkLines(filename)) {
+        std::vector<std::string> toks;
+        tokenizeString(line.text, toks);
+        if (!toks.empty() && ckUpper(toks[0]) == "END") {
+            break;
+        }
+        std::string name = species.match(toks[0]);
+        if (name.empty()) {
+            continue; // databases typically cover more species than needed
+        }
+        if (toks.size() < 7) {
+            throw CanteraError("importChemkin",
+                "Incomplete transport entry for species '{}' on line {} "
+                "of '{}'", name, line.number, filename);
+        }
+        int geom = intValue(toks[1]);
+        if (geom < 0 || geom > 2) {
+            throw CanteraError("importChemkin",
+                "Invalid geometry flag '{}' for species '{}' on line {} "
+                "of '{}'", toks[1], name, line.number, filename);
+        }
+        AnyMap tr;
+        tr["model"] = "gas";
+        tr["geometry"] = geometries[geom];
+        tr["well-depth"] = ckValue(toks[2], line);
+        tr["diameter"] = ckValue(toks[3], line);
+        double dipole = ckValue(toks[4], line);
+        if (dipole != 0.0) {
+            tr["dipole"] = dipole;
+        }
+        double polar = ckValue(toks[5], line);
+        if (polar != 0.0) {
+            tr["polarizability"] = polar;
+        }
+        double rot = ckValue(toks[6], line);
+        if (rot != 0.0) {
+            tr["rotational-relaxation"] = rot;
+        }
+        auto iter = speciesData.find(name);
+        if (iter != speciesData.end()) {
+            iter->second["transport"] = std::move(tr);
+        }
+    }
+}
+
+} // unnamed namespace
+
+AnyMap importChemkin(const std::string& mechFile,
+                     const std::string& thermoFile,
+                     const std::string& transportFile)
+{
+    auto lines = readCkLines(mechFile);
+
+    std::vector<std::string> elements;
+    SpeciesTable species;
+    std::map<std::string, AnyMap> speciesData;
+    std::vector<AnyMap> reactions;
+    double globalT[3] = {300.0, 1000.0, 5000.0};
+    std::string eUnits = "cal/mol";
+    std::string qUnits = "mol";
+    bool sawThermo = false;
+    bool sawReactions = false;
+
+    size_t i = 0;
+    while (i < lines.size()) {
+        std::vector<std::string> toks;
+        tokenizeString(lines[i].text, toks);
+        std::string section = ckUpper(toks[0]);
+
+        if (section == "ELEMENTS" || section == "ELEM") {
+            // element names follow on this line and subsequent lines, up to
+            // an END keyword
+            toks.erase(toks.begin());
+            i++;
+            bool done = false;
+            while (!done) {
+                for (auto& tok : toks) {
+                    if (ckUpper(tok) == "END") {
+                        done = true;
+                        break;
+                    }
+                    elements.push_back(elementSymbol(tok));
+                }
+                if (done || i == lines.size()) {
+                    break;
+                }
+                tokenizeString(lines[i].text, toks);
+                i++;
+            }
+        } else if (section == "SPECIES" || section == "SPEC") {
+            toks.erase(toks.begin());
+            i++;
+            bool done = false;
+            while (!done) {
+                for (auto& tok : toks) {
+                    if (ckUpper(tok) == "END") {
+                        done = true;
+                        break;
+                    }
+                    species.add(tok);
+                }
+                if (done || i == lines.size()) {
+                    break;
+                }
+                tokenizeString(lines[i].text, toks);
+                i++;
+            }
+        } else if (section == "THERMO") {
+            sawThermo = true;
+            i++;
+            parseThermoEntries(lines, i, species, speciesData, globalT);
+        } else if (section == "REACTIONS" || section == "REAC") {
+            sawReactions = true;
+            for (size_t n = 1; n < toks.size(); n++) {
+                if (!applyUnitKeyword(toks[n], eUnits, qUnits)) {
+                    throw CanteraError("importChemkin",
+                        "Unrecognized unit keyword '{}' on line {}",
+                        toks[n], lines[i].number);
+                }
+            }
+            i++;
+            bool havePending = false;
+            CkReaction pending;
+            while (i < lines.size()) {
+                std::vector<std::string> rtoks;
+                tokenizeString(lines[i].text, rtoks);
+                if (ckUpper(rtoks[0]) == "END") {
+                    i++;
+                    break;
+                }
+                if (lines[i].text.find('=') != npos) {
+                    if (havePending) {
+                        addReaction(reactions, pending);
+                    }
+                    pending = parseReactionLine(lines[i], species);
+                    havePending = true;
+                } else if (havePending) {
+                    parseAuxLine(lines[i], pending, species);
+                } else {
+                    throw CanteraError("importChemkin",
+                        "Auxiliary data on line {} precedes the first "
+                        "reaction", lines[i].number);
+                }
+                i++;
+            }
+            if (havePending) {
+                addReaction(reactions, pending);
+            }
+        } else {
+            throw CanteraError("importChemkin",
+                "Unrecognized section keyword '{}' on line {}",
+                toks[0], lines[i].number);
+        }
+    }
+
+    if (!thermoFile.empty()) {
+        auto tlines = readCkLines(thermoFile);
+        size_t t = 0;
+        if (!tlines.empty()) {
+            std::vector<std::string> toks;
+            tokenizeString(tlines[0].text, toks);
+            if (ckUpper(toks[0]) == "THERMO") {
+                t = 1;
+            }
+        }
+        parseThermoEntries(tlines, t, species, speciesData, globalT);
+    } else if (!sawThermo) {
+        throw CanteraError("importChemkin",
+            "Mechanism '{}' has no THERMO section and no separate thermo "
+            "file was given", mechFile);
+    }
+
+    std::vector<std::string> missing;
+    for (const auto& name : species.names) {
+        if (speciesData.find(name) == speciesData.end()) {
+            missing.push_back(name);
+        }
+    }
+    if (!missing.empty()) {
+        throw CanteraError("importChemkin",
+            "No thermo data found for species: {}",
+            ba::join(missing, ", "));
+    }
+
+    if (!transportFile.empty()) {
+        parseTransportFile(transportFile, species, speciesData);
+    }
+
+    AnyMap doc;
+    doc["generator"] = "Cantera importChemkin";
+    std::vector<std::string> inputs{mechFile};
+    if (!thermoFile.empty()) {
+        inputs.push_back(thermoFile);
+    }
+    if (!transportFile.empty()) {
+        inputs.push_back(transportFile);
+    }
+    doc["input-files"] = inputs;
+
+    // rate and thermo parameters are left in their CK-native units; the
+    // units directive converts them when the document is ingested, exactly
+    // as for a converted YAML mechanism
+    AnyMap units;
+    units["length"] = "cm";
+    units["time"] = "s";
+    units["quantity"] = qUnits;
+    units["activation-energy"] = eUnits;
+    doc["units"] = std::move(units);
+
+    AnyMap phase;
+    phase["name"] = "gas";
+    phase["thermo"] = "ideal-gas";
+    phase["elements"] = elements;
+    phase["species"] = species.names;
+    if (sawReactions) {
+        phase["kinetics"] = "gas";
+    }
+    if (!transportFile.empty()) {
+        phase["transport"] = "mixture-averaged";
+    }
+    AnyMap state;
+    state["T"] = 300.0;
+    state["P"] = "1 atm";
+    phase["state"] = std::move(state);
+    doc["phases"] = std::vector<AnyMap>{std::move(phase)};
+
+    std::vector<AnyMap> speciesList;
+    for (const auto& name : species.names) {
+        speciesList.push_back(std::move(speciesData[name]));
+    }
+    doc["species"] = std::move(speciesList);
+    if (sawReactions) {
+        doc["reactions"] = std::move(reactions);
+    }
+
+    doc.applyUnits();
+    return doc;
+}
+
+shared_ptr<Solution> newSolutionFromChemkin(const std::string& mechFile,
+                                            const std::string& thermoFile,
+                                            const std::string& transportFile,
+                                            const std::string& transport)
+{
+    AnyMap root = importChemkin(mechFile, thermoFile, transportFile);
+    AnyMap& phaseNode = root["phases"].asVector<AnyMap>()[0];
+
+    auto sol = Solution::create();
+    sol->setThermo(shared_ptr<ThermoPhase>(newPhase(phaseNode, root)));
+
+    std::vector<ThermoPhase*> phases{sol->thermo().get()};
+    sol->setKinetics(newKinetics(phases, phaseNode, root));
+
+    std::string model = transport;
+    if (model == "") {
+        model = phaseNode.hasKey("transport") ? "Mix" : "None";
+    }
+    if (model != "None") {
+        sol->setTransport(shared_ptr<Transport>(
+            newTransportMgr(model, sol->thermo().get())));
+    }
+    return sol;
+}
+
+} // namespace Cantera
@@ -296,31 +296,18 @@ size_t getFloatArray(const XML_Node& node, vector_fp & v,
         vmax = fpValueCheck(readNode->attrib("max"));
     }
 
-    std::string val = readNode->value();
-    while (true) {
-        size_t icom = val.find(',');
-        if (icom != string::npos) {
-            string numstr = val.substr(0,icom);
-            val = val.substr(icom+1,val.size());
-            v.push_back(fpValueCheck(numstr));
-        } else {
-            // This little bit of code is to allow for the possibility of a
-            // comma being the last item in the value text. This was allowed in
-            // previous versions of Cantera, even though it would appear to be
-            // odd. So, we keep the possibility in for backwards compatibility.
-            if (!val.empty()) {
-                v.push_back(fpValueCheck(val));
+    const std::string& val = readNode->value();
+    parseFloatArray(val.data(), val.data() + val.size(), v);
+    if (vmin != Undef || vmax != Undef) {
+        for (size_t n = 0; n < v.size(); n++) {
+            if (vmin != Undef && v[n] < vmin - Tiny) {
+                writelog("\nWarning: value {} is below lower limit of {}.\n",
+                         v[n], vmin);
+            }
+            if (vmax != Undef && v[n] > vmax + Tiny) {
+                writelog("\nWarning: value {} is above upper limit of {}.\n",
+                         v[n], vmax);
             }
-            break;
-        }
-        doublereal vv = v.back();
-        if (vmin != Undef && vv < vmin - Tiny) {
-            writelog("\nWarning: value {} is below lower limit of {}.\n",
-                     vv, vmin);
-        }
-        if (vmax != Undef && vv > vmax + Tiny) {
-            writelog("\nWarning: value {} is above upper limit of {}.\n",
-                     vv, vmax);
         }
     }
     for (size_t n = 0; n < v.size(); n++) {
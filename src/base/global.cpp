@@ -8,6 +8,9 @@
 #include "application.h"
 #include "units.h"
 
+#include <atomic>
+#include <mutex>
+
 using namespace std;
 
 namespace Cantera
@@ -98,6 +101,65 @@ void thread_complete()
     app()->thread_complete();
 }
 
+//! Counter of hot-path buffer allocations; see hotPathAllocationCount()
+static std::atomic<size_t> s_hotPathAllocCount(0);
+
+void incrementHotPathAllocationCount()
+{
+    s_hotPathAllocCount++;
+}
+
+size_t hotPathAllocationCount()
+{
+    return s_hotPathAllocCount;
+}
+
+#if CT_TRACK_ALLOCATIONS
+//! Per-class allocation counts and the mutex guarding them; see
+//! allocationCounts(). Function-local statics avoid any dependence on
+//! global initialization order.
+static std::map<std::string, size_t>& allocCountMap()
+{
+    static std::map<std::string, size_t> counts;
+    return counts;
+}
+
+static std::mutex& allocCountMutex()
+{
+    static std::mutex m;
+    return m;
+}
+#endif
+
+void incrementAllocationCount(const char* className)
+{
+#if CT_TRACK_ALLOCATIONS
+    std::lock_guard<std::mutex> lock(allocCountMutex());
+    allocCountMap()[className]++;
+#endif
+}
+
+size_t allocationCount(const std::string& className)
+{
+#if CT_TRACK_ALLOCATIONS
+    std::lock_guard<std::mutex> lock(allocCountMutex());
+    auto iter = allocCountMap().find(className);
+    return (iter == allocCountMap().end()) ? 0 : iter->second;
+#else
+    return 0;
+#endif
+}
+
+std::map<std::string, size_t> allocationCounts()
+{
+#if CT_TRACK_ALLOCATIONS
+    std::lock_guard<std::mutex> lock(allocCountMutex());
+    return allocCountMap();
+#else
+    return std::map<std::string, size_t>();
+#endif
+}
+
 std::string gitCommit()
 {
 #ifdef GIT_COMMIT
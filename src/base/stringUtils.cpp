@@ -23,6 +23,7 @@
 #include "cantera/base/global.h"
 
 #include <boost/algorithm/string.hpp>
+#include <cstdint>
 #include <sstream>
 
 namespace ba = boost::algorithm;
@@ -125,15 +126,154 @@ int intValue(const std::string& val)
     return std::atoi(ba::trim_copy(val).c_str());
 }
 
+//! Powers of ten that are exactly representable in a double
+static const double ExactPow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
 doublereal fpValue(const std::string& val)
 {
-    doublereal rval;
-    std::stringstream ss(val);
+    return fpValue(val.data(), val.data() + val.size());
+}
+
+double fpValue(const char* begin, const char* end, const char** parsed)
+{
+    const char* p = begin;
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) {
+        p++;
+    }
+    const char* numstart = p;
+    bool negative = false;
+    if (p < end && (*p == '+' || *p == '-')) {
+        negative = (*p == '-');
+        p++;
+    }
+
+    // accumulate the significand as an integer, tracking the power of ten
+    // it needs to be scaled by. Leading zeros are skipped so that they do
+    // not count against the 19-digit capacity of the accumulator; digits
+    // beyond that capacity only adjust the exponent.
+    uint64_t mant = 0;
+    int ndigits = 0;
+    int exp10 = 0;
+    bool anyDigits = false;
+    while (p < end && *p >= '0' && *p <= '9') {
+        anyDigits = true;
+        if (mant == 0 && *p == '0') {
+            p++;
+            continue;
+        }
+        if (ndigits < 19) {
+            mant = 10*mant + (*p - '0');
+            ndigits++;
+        } else {
+            exp10++;
+        }
+        p++;
+    }
+    if (p < end && *p == '.') {
+        p++;
+        while (p < end && *p >= '0' && *p <= '9') {
+            anyDigits = true;
+            if (mant == 0 && *p == '0') {
+                exp10--;
+            } else if (ndigits < 19) {
+                mant = 10*mant + (*p - '0');
+                ndigits++;
+                exp10--;
+            }
+            p++;
+        }
+    }
+    if (!anyDigits) {
+        if (parsed) {
+            *parsed = begin;
+        }
+        return 0.0;
+    }
+    if (p < end && (*p == 'e' || *p == 'E' || *p == 'd' || *p == 'D')) {
+        const char* q = p + 1;
+        bool eneg = false;
+        if (q < end && (*q == '+' || *q == '-')) {
+            eneg = (*q == '-');
+            q++;
+        }
+        int e = 0;
+        bool anyExp = false;
+        while (q < end && *q >= '0' && *q <= '9') {
+            anyExp = true;
+            if (e < 100000000) {
+                e = 10*e + (*q - '0');
+            }
+            q++;
+        }
+        if (anyExp) {
+            exp10 += eneg ? -e : e;
+            p = q;
+        }
+        // otherwise the number ends before the exponent character
+    }
+    if (parsed) {
+        *parsed = p;
+    }
+
+    // Multiplying or dividing an exactly representable integer by an exactly
+    // representable power of ten is a single correctly-rounded operation
+    // (Clinger, PLDI 1990), and covers essentially every number appearing in
+    // a mechanism file. Everything else takes the slow path below.
+    if (mant <= (1ULL << 53)) {
+        double value = negative ? -static_cast<double>(mant)
+                                : static_cast<double>(mant);
+        if (exp10 == 0) {
+            return value;
+        } else if (exp10 > 0 && exp10 <= 22) {
+            return value * ExactPow10[exp10];
+        } else if (exp10 < 0 && exp10 >= -22) {
+            return value / ExactPow10[-exp10];
+        }
+    }
+    std::string buf(numstart, p);
+    for (char& c : buf) {
+        if (c == 'd' || c == 'D') {
+            c = 'e';
+        }
+    }
+    doublereal rval = 0.0;
+    std::stringstream ss(buf);
     ss.imbue(std::locale("C"));
     ss >> rval;
     return rval;
 }
 
+size_t parseFloatArray(const char* begin, const char* end, vector_fp& v)
+{
+    size_t count = 0;
+    const char* p = begin;
+    while (p < end) {
+        char c = *p;
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == ',') {
+            p++;
+            continue;
+        }
+        const char* tokEnd = p;
+        while (tokEnd < end && *tokEnd != ' ' && *tokEnd != '\t'
+               && *tokEnd != '\n' && *tokEnd != '\r' && *tokEnd != ',') {
+            tokEnd++;
+        }
+        const char* next;
+        double value = fpValue(p, end, &next);
+        if (next != tokEnd) {
+            throw CanteraError("parseFloatArray",
+                "invalid number '{}'", std::string(p, tokEnd));
+        }
+        v.push_back(value);
+        count++;
+        p = tokEnd;
+    }
+    return count;
+}
+
 doublereal fpValueCheck(const std::string& val)
 {
     std::string str = ba::trim_copy(val);
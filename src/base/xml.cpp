@@ -309,6 +309,7 @@ std::string XML_Reader::readValue()
 
 XML_Node::XML_Node(const std::string& nm, XML_Node* const parent_) :
     m_name(nm),
+    m_indexBuilt(false),
     m_parent(parent_),
     m_root(0),
     m_locked(false),
@@ -323,6 +324,7 @@ XML_Node::XML_Node(const std::string& nm, XML_Node* const parent_) :
 }
 
 XML_Node::XML_Node(const XML_Node& right) :
+    m_indexBuilt(false),
     m_parent(0),
     m_root(0),
     m_locked(false),
@@ -373,6 +375,8 @@ void XML_Node::clear()
     }
     m_value.clear();
     m_childindex.clear();
+    m_nameIdIndex.clear();
+    m_indexBuilt = false;
     m_attribs.clear();
     m_children.clear();
 
@@ -384,6 +388,8 @@ XML_Node& XML_Node::mergeAsChild(XML_Node& node)
 {
     m_children.push_back(&node);
     m_childindex.insert({node.name(), m_children.back()});
+    m_nameIdIndex.clear();
+    m_indexBuilt = false;
     node.setRoot(root());
     node.setParent(this);
     return *m_children.back();
@@ -419,6 +425,8 @@ void XML_Node::removeChild(const XML_Node* const node)
     auto i = find(m_children.begin(), m_children.end(), node);
     m_children.erase(i);
     m_childindex.erase(node->name());
+    m_nameIdIndex.clear();
+    m_indexBuilt = false;
 }
 
 void XML_Node::addComment(const std::string& comment)
@@ -467,6 +475,11 @@ integer XML_Node::int_value() const
 void XML_Node::addAttribute(const std::string& attrib, const std::string& value)
 {
     m_attribs[attrib] = value;
+    if (attrib == "id" && m_parent) {
+        // The parent's (name, id) child index is keyed by this attribute
+        m_parent->m_nameIdIndex.clear();
+        m_parent->m_indexBuilt = false;
+    }
 }
 
 void XML_Node::addAttribute(const std::string& attrib,
@@ -592,16 +605,26 @@ XML_Node* XML_Node::findNameID(const std::string& nameTarget,
     if (name() == nameTarget && (idTarget == "" || idTarget == idattrib)) {
         return const_cast<XML_Node*>(this);
     }
-    for (size_t n = 0; n < m_children.size(); n++) {
-        XML_Node* sc = m_children[n];
-        if (sc->name() == nameTarget) {
-            if (idTarget == "") {
-                return sc;
-            }
-            idattrib = sc->id();
-            if (idTarget == idattrib) {
-                return sc;
+    if (idTarget == "") {
+        // The first child with a matching name satisfies the query
+        auto iloc = m_childindex.find(nameTarget);
+        if (iloc != m_childindex.end()) {
+            return iloc->second;
+        }
+    } else {
+        if (!m_indexBuilt) {
+            m_nameIdIndex.clear();
+            for (size_t n = 0; n < m_children.size(); n++) {
+                XML_Node* sc = m_children[n];
+                // emplace() keeps the first child on duplicate keys, which
+                // preserves the first-match semantics of the linear scan
+                m_nameIdIndex.emplace(sc->name() + '\n' + sc->id(), sc);
             }
+            m_indexBuilt = true;
+        }
+        auto iloc = m_nameIdIndex.find(nameTarget + '\n' + idTarget);
+        if (iloc != m_nameIdIndex.end()) {
+            return iloc->second;
         }
     }
     for (size_t n = 0; n < m_children.size(); n++) {
@@ -11,6 +11,10 @@
 #include "cantera/base/ctexceptions.h"
 #include "clib_utils.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 /**
  * Template for classes to hold pointers to objects. The Cabinet<M>
  * class maintains a list of pointers to objects of class M (or of
@@ -48,16 +52,27 @@
  * with a pointer to the first object. In this way, if it is deleted
  * again inadvertently nothing happens, and if an attempt is made to
  * reference the object by its index number, the base-class object
- * will be referenced instead, which will throw an exception.  If
- * instead the pointer were stored in the referring code, there would
- * always be the chance that
+ * will be referenced instead, which will throw an exception.
+ *
+ * The handle table itself may be used from multiple threads. Lookups
+ * (item(), get(), index()) never synchronize: they read an immutable
+ * snapshot of the pointer list published through an atomic pointer, so
+ * concurrent readers do not contend with each other. Mutations (add(),
+ * newCopy(), del(), clear()) are serialized by a mutex; each mutation
+ * copies the current snapshot, modifies the copy, and publishes it,
+ * retiring the previous snapshot. Retired snapshots are kept until the
+ * cabinet itself is destroyed so that readers holding them remain
+ * valid; their number is bounded by the number of mutations, which for
+ * the clib usage pattern (objects created during setup, used for the
+ * remainder of the run) is small. Note that this protects the table
+ * only: deleting an object while another thread is using it is as
+ * unsafe as it always was.
  *
  * The Cabinet<M> class is implemented as a singlet. The constructor
  * is never explicitly called; instead, static function
- * Cabinet<M>::cabinet() is called to obtain a pointer to the
- * instance. This function calls the constructor on the first call and
- * stores the pointer to this instance. Subsequent calls simply return
- * the already-created pointer.
+ * Cabinet<M>::storage() is called to obtain a reference to the
+ * instance, which is created on the first call and intentionally never
+ * destroyed so that handles stay valid during static destruction.
  *
  * Set canDelete to false if the 'clear' method should not delete the entries.
  */
@@ -66,21 +81,26 @@ template<class M, bool canDelete=true>
 class Cabinet
 {
 public:
-    typedef std::vector<M*>& dataRef;
+    typedef std::vector<M*> table_t;
+
     /**
      * Destructor. Delete all objects in the list.
      */
     virtual ~Cabinet() {
         clear();
+        delete m_current.load(std::memory_order_relaxed);
     }
 
     /**
      * Add a new object. The index of the object is returned.
      */
     static int add(M* ptr) {
-        dataRef data = getData();
-        data.push_back(ptr);
-        return static_cast<int>(data.size()) - 1;
+        Cabinet& c = storage();
+        std::unique_lock<std::mutex> lock(c.m_mutex);
+        table_t next = c.current();
+        next.push_back(ptr);
+        c.publish(std::move(next));
+        return static_cast<int>(c.current().size()) - 1;
     }
 
     /**
@@ -88,11 +108,14 @@ public:
      * object is returned.
      */
     static int newCopy(int i) {
-        dataRef data = getData();
+        Cabinet& c = storage();
+        std::unique_lock<std::mutex> lock(c.m_mutex);
         try {
-            M* old = data[i];
-            data.push_back(new M(*old));
-            return static_cast<int>(data.size()) - 1;
+            table_t next = c.current();
+            M* old = next[i];
+            next.push_back(new M(*old));
+            c.publish(std::move(next));
+            return static_cast<int>(c.current().size()) - 1;
         } catch (...) {
             return Cantera::handleAllExceptions(-1, -999);
         }
@@ -102,15 +125,18 @@ public:
      * Delete all objects but the first.
      */
     static int clear() {
-        dataRef data = getData();
-        for (size_t i = 1; i < data.size(); i++) {
-            del(i);
-        }
+        Cabinet& c = storage();
+        std::unique_lock<std::mutex> lock(c.m_mutex);
+        const table_t& data = c.current();
         if (canDelete) {
+            for (size_t i = 1; i < data.size(); i++) {
+                if (data[i] != data[0]) {
+                    delete data[i];
+                }
+            }
             delete data[0];
         }
-        data.clear();
-        add(new M);
+        c.publish(table_t{new M});
         return 0;
     }
 
@@ -120,15 +146,18 @@ public:
      * in the list.
      */
     static void del(size_t n) {
-        dataRef data = getData();
         if (n == 0) {
             return;
         }
-        if (data[n] != data[0]) {
+        Cabinet& c = storage();
+        std::unique_lock<std::mutex> lock(c.m_mutex);
+        table_t next = c.current();
+        if (next[n] != next[0]) {
             if (canDelete) {
-                delete data[n];
+                delete next[n];
             }
-            data[n] = data[0];
+            next[n] = next[0];
+            c.publish(std::move(next));
         } else {
             throw Cantera::CanteraError("Cabinet::del",
                                         "Attempt made to delete an already-deleted object.");
@@ -139,7 +168,7 @@ public:
      * Return a reference to object n.
      */
     static M& item(size_t n) {
-        dataRef data = getData();
+        const table_t& data = storage().snapshot();
         if (n < data.size()) {
             return *data[n];
         } else {
@@ -165,7 +194,7 @@ public:
      * if the object is not in the cabinet.
      */
     static int index(const M& obj) {
-        dataRef data = getData();
+        const table_t& data = storage().snapshot();
         auto loc = std::find(data.begin(), data.end(), &obj);
         if (loc != data.end()) {
             return static_cast<int>(loc-data.begin());
@@ -178,40 +207,49 @@ public:
      * Constructor.
      */
     Cabinet() {
-        m_table.push_back(new M);
+        m_current.store(new table_t{new M}, std::memory_order_release);
     }
 
 private:
     /**
-     * Static function that returns a pointer to the data member of
-     * the singleton Cabinet<M> instance. All member functions should
-     * access the data through this function.
+     * Static function that returns a reference to the singleton
+     * Cabinet<M> instance. The instance is created on the first call
+     * and never destroyed.
      */
-    static dataRef getData() {
-        if (s_storage == 0) {
-            s_storage = new Cabinet<M, canDelete>();
-        }
-        return s_storage->m_table;
+    static Cabinet& storage() {
+        static Cabinet<M, canDelete>* inst = new Cabinet<M, canDelete>();
+        return *inst;
     }
 
-    /**
-     * Pointer to the single instance of this class.
-     */
-    static Cabinet<M, canDelete>* s_storage;
+    //! Read-side access to the current snapshot of the pointer list.
+    //! The returned reference stays valid until the cabinet is destroyed,
+    //! even if a concurrent mutation publishes a newer snapshot.
+    const table_t& snapshot() const {
+        return *m_current.load(std::memory_order_acquire);
+    }
 
-    /**
-     * Vector to hold pointers to objects.
-     */
-    std::vector<M*> m_table;
-};
+    //! The current snapshot, for use by mutators holding #m_mutex
+    const table_t& current() const {
+        return *m_current.load(std::memory_order_relaxed);
+    }
 
-//! Declaration stating that the storage for the static member
-//! of each instantiated template will exist
-/*!
- *   The actual storage will be allocated in .cpp files
- */
-#ifdef NEEDS_GENERIC_TEMPL_STATIC_DECL
-template<class M, bool canDelete> Cabinet<M, canDelete>* Cabinet<M, canDelete>::s_storage;
-#endif
+    //! Publish a new snapshot of the pointer list and retire the previous
+    //! one. Must be called with #m_mutex held.
+    void publish(table_t next) {
+        const table_t* fresh = new table_t(std::move(next));
+        const table_t* old = m_current.exchange(fresh, std::memory_order_acq_rel);
+        m_retired.emplace_back(old);
+    }
+
+    //! Serializes object creation and deletion
+    std::mutex m_mutex;
+
+    //! Current snapshot of the pointer list, read without locking
+    std::atomic<const table_t*> m_current;
+
+    //! Snapshots replaced by mutations, kept alive for readers that may
+    //! still be traversing them
+    std::vector<std::unique_ptr<const table_t>> m_retired;
+};
 
 #endif
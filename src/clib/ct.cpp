@@ -25,6 +25,9 @@
 #include "cantera/kinetics/InterfaceKinetics.h"
 #include "cantera/thermo/PureFluidPhase.h"
 
+#include <mutex>
+#include <thread>
+
 using namespace std;
 using namespace Cantera;
 
@@ -33,10 +36,6 @@ typedef Cabinet<Kinetics> KineticsCabinet;
 typedef Cabinet<Transport> TransportCabinet;
 typedef Cabinet<XML_Node, false> XmlCabinet;
 
-template<> ThermoCabinet* ThermoCabinet::s_storage = 0;
-template<> KineticsCabinet* KineticsCabinet::s_storage = 0;
-template<> TransportCabinet* TransportCabinet::s_storage = 0;
-
 /**
  * Exported functions.
  */
@@ -334,7 +333,6 @@ extern "C" {
         }
     }
 
-
     doublereal thermo_nAtoms(int n, size_t k, size_t m)
     {
         try {
@@ -695,6 +693,25 @@ extern "C" {
         }
     }
 
+    int thermo_equilibrateBatch(int n, const char* XY, size_t nStates,
+                                const double* T, const double* P,
+                                const double* Y, double* Teq, double* Yeq)
+    {
+        try {
+            ThermoPhase& p = ThermoCabinet::item(n);
+            size_t nsp = p.nSpecies();
+            for (size_t i = 0; i < nStates; i++) {
+                p.setState_TPY(T[i], P[i], Y + i*nsp);
+                p.equilibrate(XY);
+                Teq[i] = p.temperature();
+                p.getMassFractions(Yeq + i*nsp);
+            }
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
     doublereal thermo_refPressure(int n)
     {
         try {
@@ -734,7 +751,6 @@ extern "C" {
         }
     }
 
-
     int thermo_getEnthalpies_RT(int n, size_t lenm, double* h_rt)
     {
         try {
@@ -1184,6 +1200,19 @@ extern "C" {
         }
     }
 
+    int kin_getNetProductionRatesBatch(int n, size_t nStates, const double* T,
+                                       const double* P, const double* Y,
+                                       double* wdot)
+    {
+        try {
+            Kinetics& k = KineticsCabinet::item(n);
+            k.getNetProductionRatesBatch(nStates, T, P, Y, wdot);
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
     int kin_getSourceTerms(int n, size_t len, double* ydot)
     {
         try {
@@ -1275,6 +1304,72 @@ extern "C" {
         }
     }
 
+    //! Evaluate net production rates for a batch of cell states with a single
+    //! call. The handle lookups and error handling are done once for the whole
+    //! batch rather than once per cell, and when more than one kinetics handle
+    //! is supplied the cells are partitioned over one thread per handle. Each
+    //! handle must refer to an independent kinetics manager for the same
+    //! mechanism (for example, created from clones of the same input file), so
+    //! that the threads never touch shared mutable state.
+    int ct_batchStateEval(int nkin, const int* kin, size_t nstates, size_t nsp,
+                          const double* T, const double* rho, const double* y,
+                          double* wdot)
+    {
+        try {
+            if (nkin < 1) {
+                throw CanteraError("ct_batchStateEval",
+                                   "at least one kinetics handle is required");
+            }
+            std::vector<Kinetics*> kins;
+            for (int i = 0; i < nkin; i++) {
+                Kinetics& k = KineticsCabinet::item(kin[i]);
+                k.checkSpeciesArraySize(nsp);
+                kins.push_back(&k);
+            }
+            auto evalRange = [nsp, T, rho, y, wdot](Kinetics* k,
+                                                    size_t begin, size_t end) {
+                ThermoPhase& th = k->thermo(0);
+                for (size_t i = begin; i < end; i++) {
+                    th.setMassFractions_NoNorm(y + i*nsp);
+                    th.setTemperature(T[i]);
+                    th.setDensity(rho[i]);
+                    k->getNetProductionRates(wdot + i*nsp);
+                }
+            };
+            if (nkin == 1 || nstates < 2) {
+                evalRange(kins[0], 0, nstates);
+            } else {
+                size_t nThreads = std::min<size_t>(nkin, nstates);
+                std::vector<std::thread> threads;
+                std::exception_ptr firstError;
+                std::mutex errMutex;
+                for (size_t n = 0; n < nThreads; n++) {
+                    size_t begin = n * nstates / nThreads;
+                    size_t end = (n + 1) * nstates / nThreads;
+                    threads.emplace_back([&, n, begin, end]() {
+                        try {
+                            evalRange(kins[n], begin, end);
+                        } catch (...) {
+                            std::lock_guard<std::mutex> lock(errMutex);
+                            if (!firstError) {
+                                firstError = std::current_exception();
+                            }
+                        }
+                    });
+                }
+                for (auto& t : threads) {
+                    t.join();
+                }
+                if (firstError) {
+                    std::rethrow_exception(firstError);
+                }
+            }
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
     //------------------- Transport ---------------------------
 
     int trans_newDefault(int ith, int loglevel)
@@ -21,8 +21,6 @@ using namespace std;
 typedef Func1 func_t;
 
 typedef Cabinet<Func1> FuncCabinet;
-// Assign storage to the Cabinet<Func1> static member
-template<> FuncCabinet* FuncCabinet::s_storage = 0;
 
 extern "C" {
 
@@ -17,7 +17,6 @@ using namespace std;
 using namespace Cantera;
 
 typedef Cabinet<MultiPhase> mixCabinet;
-template<> mixCabinet* mixCabinet::s_storage = 0;
 
 extern "C" {
 
@@ -180,7 +179,6 @@ extern "C" {
         }
     }
 
-
     int mix_setMolesByName(int i, const char* n)
     {
         try {
@@ -23,8 +23,6 @@ using namespace Cantera;
 
 typedef Cabinet<Sim1D> SimCabinet;
 typedef Cabinet<Domain1D> DomainCabinet;
-template<> SimCabinet* SimCabinet::s_storage = 0;
-template<> DomainCabinet* DomainCabinet::s_storage = 0;
 
 typedef Cabinet<ThermoPhase> ThermoCabinet;
 typedef Cabinet<Kinetics> KineticsCabinet;
@@ -387,7 +385,6 @@ extern "C" {
         }
     }
 
-
     int stflow_setTransport(int i, int itr)
     {
         try {
@@ -27,12 +27,6 @@ typedef Cabinet<ThermoPhase> ThermoCabinet;
 typedef Cabinet<Kinetics> KineticsCabinet;
 typedef Cabinet<ReactorSurface> ReactorSurfaceCabinet;
 
-template<> ReactorCabinet* ReactorCabinet::s_storage = 0;
-template<> NetworkCabinet* NetworkCabinet::s_storage = 0;
-template<> FlowDeviceCabinet* FlowDeviceCabinet::s_storage = 0;
-template<> WallCabinet* WallCabinet::s_storage = 0;
-template<> ReactorSurfaceCabinet* ReactorSurfaceCabinet::s_storage = 0;
-
 extern "C" {
 
     // reactor
@@ -19,8 +19,6 @@ using namespace std;
 
 typedef Cabinet<ReactionPathBuilder> BuilderCabinet;
 typedef Cabinet<ReactionPathDiagram> DiagramCabinet;
-template<> DiagramCabinet* DiagramCabinet::s_storage = 0;
-template<> BuilderCabinet* BuilderCabinet::s_storage = 0;
 
 typedef Cabinet<Kinetics> KineticsCabinet;
 
@@ -21,7 +21,6 @@ using namespace std;
 using namespace Cantera;
 
 typedef Cabinet<XML_Node, false> XmlCabinet;
-template<> XmlCabinet* XmlCabinet::s_storage = 0;
 
 extern "C" {
 
@@ -94,106 +94,114 @@ size_t BasisOptimize(int* usedZeroedSpecies, bool doFormRxn, MultiPhase* mphase,
 
     // For debugging purposes keep an unmodified copy of the array.
     vector_fp molNumBase = molNum;
-    double molSave = 0.0;
     size_t jr = 0;
 
-    // Top of a loop of some sort based on the index JR. JR is the current
-    // number of component species found.
-    while (jr < nComponents) {
-        // Top of another loop point based on finding a linearly independent
-        // species
-        size_t k = npos;
-        while (true) {
-            // Search the remaining part of the mole number vector, molNum for
-            // the largest remaining species. Return its identity. kk is the raw
-            // number. k is the orderVectorSpecies index.
-            size_t kk = max_element(molNum.begin(), molNum.end()) - molNum.begin();
-            size_t j;
-            for (j = 0; j < nspecies; j++) {
-                if (orderVectorSpecies[j] == kk) {
-                    k = j;
-                    break;
-                }
-            }
-            if (j == nspecies) {
-                throw CanteraError("BasisOptimize", "orderVectorSpecies contains an error");
-            }
-
-            if (molNum[kk] == 0.0) {
-                *usedZeroedSpecies = true;
-            }
-            // If the largest molNum is negative, then we are done.
-            if (molNum[kk] == USEDBEFORE) {
-                nComponents = jr;
-                nNonComponents = nspecies - nComponents;
-                break;
-            }
+    // Gather the formula matrix once, in the current element ordering.
+    // Column kk holds the formula vector of species kk. The repeated
+    // nAtoms() lookups inside the component search loop used to dominate
+    // the cost of this routine when it is called once per basis change.
+    DenseMatrix formula(ne, nspecies);
+    for (size_t kk = 0; kk < nspecies; kk++) {
+        for (size_t j = 0; j < ne; j++) {
+            formula(j, kk) = mphase->nAtoms(kk, orderVectorElements[j]);
+        }
+    }
 
-            // Assign a small negative number to the component that we have
-            // just found, in order to take it out of further consideration.
-            molSave = molNum[kk];
-            molNum[kk] = USEDBEFORE;
+    // Candidate species in order of decreasing mole number, computed once
+    // instead of rescanning molNum for the largest remaining entry for
+    // every candidate. The stable sort reproduces the first-maximum tie
+    // breaking of the previous max_element() search.
+    std::vector<size_t> candidates(nspecies);
+    iota(candidates.begin(), candidates.end(), 0);
+    stable_sort(candidates.begin(), candidates.end(),
+                [&molNum](size_t a, size_t b) {
+                    return molNum[a] > molNum[b];
+                });
+
+    // Walk down the candidate list, accepting a species as a component if
+    // its formula vector is linearly independent of the components already
+    // chosen. This is a QR factorization with the pivot order restricted
+    // to species abundance; a norm-pivoted QR would select components by
+    // atom count rather than mole number.
+    size_t next = 0;
+    while (jr < nComponents && next < nspecies) {
+        size_t kk = candidates[next++];
+        if (molNum[kk] == 0.0) {
+            *usedZeroedSpecies = true;
+        }
 
-            // CHECK LINEAR INDEPENDENCE WITH PREVIOUS SPECIES
+        // CHECK LINEAR INDEPENDENCE WITH PREVIOUS SPECIES
 
-            // Modified Gram-Schmidt Method, p. 202 Dalquist
-            // QR factorization of a matrix without row pivoting.
-            size_t jl = jr;
-            for (j = 0; j < ne; ++j) {
-                size_t jj = orderVectorElements[j];
-                sm(j, jr) = mphase->nAtoms(kk,jj);
-            }
-            if (jl > 0) {
-                // Compute the coefficients of JA column of the the upper
-                // triangular R matrix, SS(J) = R_J_JR (this is slightly
-                // different than Dalquist) R_JA_JA = 1
-                for (j = 0; j < jl; ++j) {
-                    ss[j] = 0.0;
-                    for (size_t i = 0; i < ne; ++i) {
-                        ss[j] += sm(i, jr) * sm(i, j);
-                    }
-                    ss[j] /= sa[j];
+        // Modified Gram-Schmidt Method, p. 202 Dalquist
+        // QR factorization of a matrix without row pivoting.
+        size_t jl = jr;
+        for (size_t j = 0; j < ne; ++j) {
+            sm(j, jr) = formula(j, kk);
+        }
+        if (jl > 0) {
+            // Compute the coefficients of JA column of the the upper
+            // triangular R matrix, SS(J) = R_J_JR (this is slightly
+            // different than Dalquist) R_JA_JA = 1
+            for (size_t j = 0; j < jl; ++j) {
+                ss[j] = 0.0;
+                for (size_t i = 0; i < ne; ++i) {
+                    ss[j] += sm(i, jr) * sm(i, j);
                 }
+                ss[j] /= sa[j];
+            }
 
-                // Now make the new column, (*,JR), orthogonal to the previous
-                // columns
-                for (j = 0; j < jl; ++j) {
-                    for (size_t i = 0; i < ne; ++i) {
-                        sm(i, jr) -= ss[j] * sm(i, j);
-                    }
+            // Now make the new column, (*,JR), orthogonal to the previous
+            // columns
+            for (size_t j = 0; j < jl; ++j) {
+                for (size_t i = 0; i < ne; ++i) {
+                    sm(i, jr) -= ss[j] * sm(i, j);
                 }
             }
+        }
 
-            // Find the new length of the new column in Q.
-            // It will be used in the denominator in future row calcs.
-            sa[jr] = 0.0;
-            for (size_t ml = 0; ml < ne; ++ml) {
-                sa[jr] += pow(sm(ml, jr), 2);
-            }
+        // Find the new length of the new column in Q.
+        // It will be used in the denominator in future row calcs.
+        sa[jr] = 0.0;
+        for (size_t ml = 0; ml < ne; ++ml) {
+            sa[jr] += pow(sm(ml, jr), 2);
+        }
 
-            // IF NORM OF NEW ROW  .LT. 1E-3 REJECT
-            if (sa[jr] > 1.0e-6) {
-                break;
-            }
+        // IF NORM OF NEW ROW  .LT. 1E-3 REJECT
+        if (sa[jr] <= 1.0e-6) {
+            continue;
         }
 
         // REARRANGE THE DATA
+        size_t k;
+        for (k = jr; k < nspecies; k++) {
+            if (orderVectorSpecies[k] == kk) {
+                break;
+            }
+        }
+        if (k == nspecies) {
+            throw CanteraError("BasisOptimize",
+                               "orderVectorSpecies contains an error");
+        }
         if (jr != k) {
             if (BasisOptimize_print_lvl >= 1) {
-                size_t kk = orderVectorSpecies[k];
                 writelogf("   ---   %-12.12s", mphase->speciesName(kk));
                 size_t jj = orderVectorSpecies[jr];
                 writelogf("(%9.2g) replaces %-12.12s",
-                          molSave, mphase->speciesName(jj));
-                writelogf("(%9.2g) as component %3d\n", molNum[jj], jr);
+                          molNumBase[kk], mphase->speciesName(jj));
+                writelogf("(%9.2g) as component %3d\n", molNumBase[jj], jr);
             }
             std::swap(orderVectorSpecies[jr], orderVectorSpecies[k]);
         }
-
-        // If we haven't found enough components, go back and find some more
         jr++;
     }
 
+    // If the candidate list ran out before enough independent species were
+    // found, the formula matrix is rank deficient.
+    if (jr < nComponents) {
+        nComponents = jr;
+        nNonComponents = nspecies - nComponents;
+    }
+
     if (! doFormRxn) {
         return nComponents;
     }
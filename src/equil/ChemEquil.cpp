@@ -45,7 +45,8 @@ int _equilflag(const char* xy)
 ChemEquil::ChemEquil() : m_skip(npos), m_elementTotalSum(1.0),
     m_p0(OneAtm), m_eloc(npos),
     m_elemFracCutoff(1.0E-100),
-    m_doResPerturb(false)
+    m_doResPerturb(false),
+    m_warmStart(false)
 {}
 
 ChemEquil::ChemEquil(ThermoPhase& s) :
@@ -53,7 +54,8 @@ ChemEquil::ChemEquil(ThermoPhase& s) :
     m_elementTotalSum(1.0),
     m_p0(OneAtm), m_eloc(npos),
     m_elemFracCutoff(1.0E-100),
-    m_doResPerturb(false)
+    m_doResPerturb(false),
+    m_warmStart(false)
 {
     initialize(s);
 }
@@ -316,6 +318,22 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XY, int loglevel)
 
 int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
                            vector_fp& elMolesGoal, int loglevel)
+{
+    // Try a warm-started solve first if a previous converged solution is
+    // available; any failure falls back to the usual cold start.
+    if (m_warmStart && m_lambdaWarm.size() == m_mm + 1) {
+        try {
+            return equilibrate_(s, XYstr, elMolesGoal, loglevel, true);
+        } catch (CanteraError&) {
+            m_lambdaWarm.clear();
+        }
+    }
+    return equilibrate_(s, XYstr, elMolesGoal, loglevel, false);
+}
+
+int ChemEquil::equilibrate_(ThermoPhase& s, const char* XYstr,
+                            vector_fp& elMolesGoal, int loglevel,
+                            bool useWarmStart)
 {
     int fail = 0;
     bool tempFixed = true;
@@ -426,7 +444,12 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
     doublereal tmaxPhase = s.maxTemp();
     doublereal tminPhase = s.minTemp();
     // loop to estimate T
-    if (!tempFixed) {
+    if (!tempFixed && useWarmStart) {
+        // Start from the converged temperature of the previous solve.
+        doublereal t0 = clip(exp(m_lambdaWarm[m_mm]),
+                             tminPhase + 1.0, tmaxPhase - 1.0);
+        s.setTemperature(t0);
+    } else if (!tempFixed) {
         doublereal tmin = std::max(s.temperature(), tminPhase);
         if (tmin > tmaxPhase) {
             tmin = tmaxPhase - 20;
@@ -497,24 +520,33 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
         }
     }
 
-    setInitialMoles(s, elMolesGoal,loglevel);
-
-    // Calculate initial estimates of the element potentials. This algorithm
-    // uses the MultiPhaseEquil object's initialization capabilities to
-    // calculate an initial estimate of the mole fractions for a set of linearly
-    // independent component species. Then, the element potentials are solved
-    // for based on the chemical potentials of the component species.
-    estimateElementPotentials(s, x, elMolesGoal);
-
-    // Do a better estimate of the element potentials. We have found that the
-    // current estimate may not be good enough to avoid drastic numerical issues
-    // associated with the use of a numerically generated Jacobian.
-    //
-    // The Brinkley algorithm assumes a constant T, P system and uses a
-    // linearized analytical Jacobian that turns out to be very stable.
-    int info = estimateEP_Brinkley(s, x, elMolesGoal);
-    if (info == 0) {
+    int info = 0;
+    if (useWarmStart) {
+        // Reuse the element potentials of the previous converged solve as the
+        // starting point for this nearby state, skipping the estimation phase
+        // entirely.
+        copy(m_lambdaWarm.begin(), m_lambdaWarm.end() - 1, x.begin());
         setToEquilState(s, x, s.temperature());
+    } else {
+        setInitialMoles(s, elMolesGoal,loglevel);
+
+        // Calculate initial estimates of the element potentials. This algorithm
+        // uses the MultiPhaseEquil object's initialization capabilities to
+        // calculate an initial estimate of the mole fractions for a set of linearly
+        // independent component species. Then, the element potentials are solved
+        // for based on the chemical potentials of the component species.
+        estimateElementPotentials(s, x, elMolesGoal);
+
+        // Do a better estimate of the element potentials. We have found that the
+        // current estimate may not be good enough to avoid drastic numerical issues
+        // associated with the use of a numerically generated Jacobian.
+        //
+        // The Brinkley algorithm assumes a constant T, P system and uses a
+        // linearized analytical Jacobian that turns out to be very stable.
+        info = estimateEP_Brinkley(s, x, elMolesGoal);
+        if (info == 0) {
+            setToEquilState(s, x, s.temperature());
+        }
     }
 
     // Install the log(temp) into the last solution unknown slot.
@@ -590,6 +622,10 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
                     "Temperature ({} K) outside valid range of {} K "
                     "to {} K", s.temperature(), s.minTemp(), s.maxTemp());
             }
+            if (m_warmStart) {
+                // Save the converged potentials (and log T) for the next solve
+                m_lambdaWarm.assign(x.begin(), x.end());
+            }
             return 0;
         }
         // compute the residual and the Jacobian using the current
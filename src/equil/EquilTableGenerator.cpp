@@ -0,0 +1,148 @@
+//! @file EquilTableGenerator.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/equil/EquilTableGenerator.h"
+#include "cantera/equil/vcs_MultiPhaseEquil.h"
+#include "cantera/base/ThreadPool.h"
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+
+namespace Cantera
+{
+
+EquilTableGenerator::EquilTableGenerator()
+{
+}
+
+void EquilTableGenerator::addMixture(MultiPhase& mix)
+{
+    if (!m_mixtures.empty()
+            && mix.nSpecies() != m_mixtures[0]->nSpecies()) {
+        throw CanteraError("EquilTableGenerator::addMixture",
+            "Mixture has {} species; previously added mixtures have {}",
+            mix.nSpecies(), m_mixtures[0]->nSpecies());
+    }
+    m_mixtures.push_back(&mix);
+}
+
+void EquilTableGenerator::setGrid(const vector_fp& Z, const vector_fp& T,
+                                  const vector_fp& P)
+{
+    if (Z.empty() || T.empty() || P.empty()) {
+        throw CanteraError("EquilTableGenerator::setGrid",
+                           "All three grid axes must be non-empty");
+    }
+    m_Z = Z;
+    m_T = T;
+    m_P = P;
+}
+
+void EquilTableGenerator::setEndpointMoles(const vector_fp& fuelMoles,
+                                           const vector_fp& oxidMoles)
+{
+    if (fuelMoles.size() != oxidMoles.size()) {
+        throw CanteraError("EquilTableGenerator::setEndpointMoles",
+            "Endpoint mole vectors have different lengths ({} and {})",
+            fuelMoles.size(), oxidMoles.size());
+    }
+    m_fuelMoles = fuelMoles;
+    m_oxidMoles = oxidMoles;
+}
+
+void EquilTableGenerator::marchRow(MultiPhase& mix, size_t iz)
+{
+    size_t nsp = mix.nSpecies();
+    vector_fp moles(nsp);
+    for (size_t k = 0; k < nsp; k++) {
+        moles[k] = m_Z[iz] * m_fuelMoles[k]
+                   + (1.0 - m_Z[iz]) * m_oxidMoles[k];
+    }
+    mix.setState_TPMoles(m_T[0], m_P[0], moles.data());
+
+    // One solver instance for the whole row, so the VCS problem setup is
+    // done once. The first cell lets the solver form its own composition
+    // estimate; every later cell starts from the converged composition of
+    // the previous one, which the solver left in the mixture.
+    vcs_MultiPhaseEquil solver(&mix, 0);
+    double* row = &m_table[iz * m_T.size() * m_P.size() * nsp];
+    bool first = true;
+    for (size_t it = 0; it < m_T.size(); it++) {
+        for (size_t ip = 0; ip < m_P.size(); ip++) {
+            mix.setState_TP(m_T[it], m_P[ip]);
+            int ret = solver.equilibrate_TP(first ? -1 : 0, 0);
+            if (ret != 0) {
+                throw CanteraError("EquilTableGenerator::marchRow",
+                    "VCS solver failed at Z = {}, T = {} K, P = {} Pa",
+                    m_Z[iz], m_T[it], m_P[ip]);
+            }
+            first = false;
+            double* cell = row + (it * m_P.size() + ip) * nsp;
+            for (size_t k = 0; k < nsp; k++) {
+                cell[k] = mix.moleFraction(k);
+            }
+        }
+    }
+}
+
+void EquilTableGenerator::generate(const std::string& fileName)
+{
+    if (m_mixtures.empty()) {
+        throw CanteraError("EquilTableGenerator::generate",
+                           "No worker mixtures have been added");
+    }
+    if (m_Z.empty()) {
+        throw CanteraError("EquilTableGenerator::generate",
+                           "No grid has been set");
+    }
+    size_t nsp = m_mixtures[0]->nSpecies();
+    if (m_fuelMoles.size() != nsp) {
+        throw CanteraError("EquilTableGenerator::generate",
+            "Endpoint mole vectors have length {}; expected {}",
+            m_fuelMoles.size(), nsp);
+    }
+    m_table.assign(m_Z.size() * m_T.size() * m_P.size() * nsp, 0.0);
+
+    // Shared counter from which each task claims the next unprocessed row;
+    // tasks are bound one-to-one to mixtures so no thermodynamic objects
+    // are touched by more than one thread.
+    std::atomic<size_t> nextRow(0);
+    size_t nThreads = std::min(m_mixtures.size(), m_Z.size());
+    ThreadPool::shared().run(nThreads, [&](size_t w) {
+        while (true) {
+            size_t iz = nextRow.fetch_add(1);
+            if (iz >= m_Z.size()) {
+                return;
+            }
+            marchRow(*m_mixtures[w], iz);
+        }
+    });
+
+    if (fileName.empty()) {
+        return;
+    }
+    std::ofstream out(fileName, std::ios::binary);
+    if (!out) {
+        throw CanteraError("EquilTableGenerator::generate",
+                           "Unable to open '{}' for writing", fileName);
+    }
+    std::uint64_t dims[3] = {m_Z.size(), m_T.size(), m_P.size()};
+    out.write(reinterpret_cast<const char*>(dims), sizeof(dims));
+    out.write(reinterpret_cast<const char*>(m_Z.data()),
+              m_Z.size() * sizeof(double));
+    out.write(reinterpret_cast<const char*>(m_T.data()),
+              m_T.size() * sizeof(double));
+    out.write(reinterpret_cast<const char*>(m_P.data()),
+              m_P.size() * sizeof(double));
+    out.write(reinterpret_cast<const char*>(m_table.data()),
+              m_table.size() * sizeof(double));
+    if (!out) {
+        throw CanteraError("EquilTableGenerator::generate",
+                           "Error writing table to '{}'", fileName);
+    }
+}
+
+}
@@ -66,6 +66,9 @@ void MultiPhase::addPhase(ThermoPhase* p, doublereal moles)
     // store its number of moles
     m_moles.push_back(moles);
     m_temp_OK.push_back(true);
+    m_phaseEpoch.push_back(-1);
+    m_lastTemp.push_back(Undef);
+    m_lastPress.push_back(Undef);
 
     // update the total number of species
     m_nsp += p->nSpecies();
@@ -124,6 +127,7 @@ void MultiPhase::init()
     // allocate space for the atomic composition matrix
     m_atoms.resize(m_nel, m_nsp, 0.0);
     m_moleFractions.resize(m_nsp, 0.0);
+    m_lastMoleFractions.resize(m_nsp, 0.0);
     m_elemAbundances.resize(m_nel, 0.0);
 
     // iterate over the elements
@@ -828,12 +832,34 @@ void MultiPhase::updatePhases() const
 {
     size_t loc = 0;
     for (size_t p = 0; p < nPhases(); p++) {
-        m_phase[p]->setState_TPX(m_temp, m_press, &m_moleFractions[loc]);
-        loc += m_phase[p]->nSpecies();
-        m_temp_OK[p] = true;
-        if (m_temp < m_phase[p]->minTemp() || m_temp > m_phase[p]->maxTemp()) {
-            m_temp_OK[p] = false;
+        size_t nsp = m_phase[p]->nSpecies();
+        // Only push the state into phases that are actually stale: either
+        // the stored T/P/composition differs from what was pushed last
+        // time, or the phase has been modified directly since then (its
+        // state epoch no longer matches the value recorded after the last
+        // push). Setting the state unconditionally would invalidate each
+        // phase's internal property caches on every property query.
+        bool stale = (m_phaseEpoch[p] != m_phase[p]->stateEpoch()
+                      || m_temp != m_lastTemp[p]
+                      || m_press != m_lastPress[p]
+                      || !equal(m_moleFractions.begin() + loc,
+                                m_moleFractions.begin() + loc + nsp,
+                                m_lastMoleFractions.begin() + loc));
+        if (stale) {
+            m_phase[p]->setState_TPX(m_temp, m_press, &m_moleFractions[loc]);
+            m_phaseEpoch[p] = m_phase[p]->stateEpoch();
+            m_lastTemp[p] = m_temp;
+            m_lastPress[p] = m_press;
+            copy(m_moleFractions.begin() + loc,
+                 m_moleFractions.begin() + loc + nsp,
+                 m_lastMoleFractions.begin() + loc);
+            m_temp_OK[p] = true;
+            if (m_temp < m_phase[p]->minTemp()
+                    || m_temp > m_phase[p]->maxTemp()) {
+                m_temp_OK[p] = false;
+            }
         }
+        loc += nsp;
     }
 }
 
@@ -515,32 +515,54 @@ doublereal MultiPhaseEquil::stepComposition(int loglevel)
 
 doublereal MultiPhaseEquil::computeReactionSteps(vector_fp& dxi)
 {
-    vector_fp nu;
     doublereal grad = 0.0;
     dxi.resize(nFree());
     computeN();
     doublereal not_mu = 1.0e12;
     m_mix->getValidChemPotentials(not_mu, m_mu.data());
+    if (!nFree()) {
+        return 0.0;
+    }
 
+    // Gather the chemical potentials into component-sorted species order
+    // once, then compute Delta G for every formation reaction with a single
+    // matrix-vector product, dg = N^T mu.
+    m_mu_sort.resize(m_nsp);
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_mu_sort[k] = m_mu[m_species[m_order[k]]];
+    }
+    m_N.leftMult(m_mu_sort.data(), m_deltaG_RT.data());
+    doublereal rrt = 1.0/(m_temp * GasConstant);
     for (size_t j = 0; j < nFree(); j++) {
-        // get stoichiometric vector
-        getStoichVector(j, nu);
+        m_deltaG_RT[j] *= rrt;
+    }
 
-        // compute Delta G
-        doublereal dg_rt = 0.0;
-        for (size_t k = 0; k < m_nsp; k++) {
-            dg_rt += m_mu[m_species[k]] * nu[k];
-        }
-        dg_rt /= (m_temp * GasConstant);
+    // The reciprocal component mole numbers and reciprocal solution-phase
+    // mole totals are the same for every reaction, so fetch them from the
+    // mixture once per call instead of once per reaction.
+    m_rmoles.resize(m_nel);
+    for (size_t m = 0; m < m_nel; m++) {
+        m_rmoles[m] = 1.0 /
+            (fabs(m_mix->speciesMoles(m_species[m_order[m]])) + Tiny);
+    }
+    size_t nph = m_mix->nPhases();
+    m_rphmoles.resize(nph);
+    for (size_t ip = 0; ip < nph; ip++) {
+        // single-species phases do not contribute to the phase sum
+        m_rphmoles[ip] = (m_mix->phase(ip).nSpecies() > 1)
+            ? 1.0/(fabs(m_mix->phaseMoles(ip)) + Tiny) : 0.0;
+    }
+    m_phasework.resize(nph);
 
-        m_deltaG_RT[j] = dg_rt;
+    for (size_t j = 0; j < nFree(); j++) {
+        doublereal dg_rt = m_deltaG_RT[j];
         double fctr = 1.0;
 
         // if this is a formation reaction for a single-component phase,
         // check whether reaction should be included
-        size_t k = m_order[j + m_nel];
-        if (!m_dsoln[k]) {
-            if (m_moles[k] <= 0.0 && dg_rt > 0.0) {
+        size_t kc = m_order[j + m_nel];
+        if (!m_dsoln[kc]) {
+            if (m_moles[kc] <= 0.0 && dg_rt > 0.0) {
                 fctr = 0.0;
             } else {
                 fctr = 0.5;
@@ -548,33 +570,29 @@ doublereal MultiPhaseEquil::computeReactionSteps(vector_fp& dxi)
         } else if (!m_solnrxn[j]) {
             fctr = 1.0;
         } else {
-            // component sum
+            // Each column of N has only m_nel + 1 nonzero entries: the
+            // component rows and the 1 on the identity row of this
+            // reaction's noncomponent species, so the quadratic sums need
+            // only visit those rows.
             double csum = 0.0;
-            for (k = 0; k < m_nel; k++) {
-                size_t kc = m_order[k];
-                double nmoles = fabs(m_mix->speciesMoles(m_species[kc])) + Tiny;
-                csum += pow(nu[kc], 2)*m_dsoln[kc]/nmoles;
+            fill(m_phasework.begin(), m_phasework.end(), 0.0);
+            for (size_t m = 0; m < m_nel; m++) {
+                size_t km = m_order[m];
+                double numn = m_N(m, j);
+                csum += numn*numn*m_dsoln[km]*m_rmoles[m];
+                m_phasework[m_mix->speciesPhaseIndex(m_species[km])]
+                    += numn*numn;
             }
 
-            // noncomponent term
-            size_t kc = m_order[j + m_nel];
+            // noncomponent term; N(m_nel + j, j) = 1
             double nmoles = fabs(m_mix->speciesMoles(m_species[kc])) + Tiny;
             double term1 = m_dsoln[kc]/nmoles;
+            m_phasework[m_mix->speciesPhaseIndex(m_species[kc])] += 1.0;
 
             // sum over solution phases
             doublereal sum = 0.0;
-            for (size_t ip = 0; ip < m_mix->nPhases(); ip++) {
-                ThermoPhase& p = m_mix->phase(ip);
-                if (p.nSpecies() > 1) {
-                    double psum = 0.0;
-                    for (k = 0; k < m_nsp; k++) {
-                        kc = m_species[k];
-                        if (m_mix->speciesPhaseIndex(kc) == ip) {
-                            psum += pow(nu[k], 2);
-                        }
-                    }
-                    sum -= psum / (fabs(m_mix->phaseMoles(ip)) + Tiny);
-                }
+            for (size_t ip = 0; ip < nph; ip++) {
+                sum -= m_phasework[ip]*m_rphmoles[ip];
             }
             double rfctr = term1 + csum + sum;
             if (fabs(rfctr) < Tiny) {
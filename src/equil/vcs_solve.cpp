@@ -59,6 +59,7 @@ VCS_SOLVE::VCS_SOLVE(MultiPhase* mphase, int printLvl) :
     m_tolmin(1.0E-6),
     m_tolmaj2(1.0E-10),
     m_tolmin2(1.0E-8),
+    m_traceCutoff(VCS_DELETE_MINORSPECIES_CUTOFF),
     m_useActCoeffJac(0),
     m_totalVol(mphase->volume()),
     m_Faraday_dim(Faraday / (m_temperature * GasConstant)),
@@ -492,6 +493,16 @@ VCS_SOLVE::~VCS_SOLVE()
     vcs_delete_memory();
 }
 
+void VCS_SOLVE::setTraceSpeciesCutoff(double cutoff)
+{
+    if (cutoff <= 0.0 || cutoff > 1.0E-10) {
+        throw CanteraError("VCS_SOLVE::setTraceSpeciesCutoff",
+            "Cutoff must be positive and no larger than 1.0E-10 ({} given)",
+            cutoff);
+    }
+    m_traceCutoff = cutoff;
+}
+
 int VCS_SOLVE::vcs(int ipr, int ip1, int maxit)
 {
     clockWC tickTock;
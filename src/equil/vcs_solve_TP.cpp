@@ -1361,7 +1361,7 @@ double VCS_SOLVE::vcs_minor_alt_calc(size_t kspec, size_t irxn, bool* do_delete,
     *do_delete = false;
     if (m_speciesUnknownType[kspec] != VCS_SPECIES_TYPE_INTERFACIALVOLTAGE) {
         if (w_kspec <= 0.0) {
-            w_kspec = VCS_DELETE_MINORSPECIES_CUTOFF;
+            w_kspec = m_traceCutoff;
         }
         dg_irxn = std::max(dg_irxn, -200.0);
         if (ANOTE) {
@@ -1369,7 +1369,7 @@ double VCS_SOLVE::vcs_minor_alt_calc(size_t kspec, size_t irxn, bool* do_delete,
         }
         if (dg_irxn >= 23.0) {
             double molNum_kspec_new = w_kspec * 1.0e-10;
-            if (w_kspec < VCS_DELETE_MINORSPECIES_CUTOFF) {
+            if (w_kspec < m_traceCutoff) {
                 // delete the species from the current list of active species,
                 // because its concentration has gotten too small.
                 *do_delete = true;
@@ -1415,7 +1415,7 @@ double VCS_SOLVE::vcs_minor_alt_calc(size_t kspec, size_t irxn, bool* do_delete,
             molNum_kspec_new = wTrial;
         }
 
-        if ((molNum_kspec_new) < VCS_DELETE_MINORSPECIES_CUTOFF) {
+        if ((molNum_kspec_new) < m_traceCutoff) {
             // delete the species from the current list of active species,
             // because its concentration has gotten too small.
             *do_delete = true;
@@ -1901,8 +1901,8 @@ size_t VCS_SOLVE::vcs_add_all_deleted()
         size_t iph = m_phaseID[kspec];
         if (m_tPhaseMoles_old[iph] > 0.0 && fabs(m_deltaGRxn_old[irxn]) > m_tolmin) {
             if (((m_molNumSpecies_old[kspec] * exp(-m_deltaGRxn_old[irxn])) >
-                    VCS_DELETE_MINORSPECIES_CUTOFF) ||
-                    (m_molNumSpecies_old[kspec] > VCS_DELETE_MINORSPECIES_CUTOFF)) {
+                    m_traceCutoff) ||
+                    (m_molNumSpecies_old[kspec] > m_traceCutoff)) {
                 retn++;
                 if (m_debug_print_lvl >= 2) {
                     plogf("  --- add_deleted():  species %s with mol number %g not converged: DG = %g\n",
@@ -247,4 +247,32 @@ module cantera_kinetics
       self%err = kin_advancecoverages(self%kin_id, tstep)
     end subroutine ctkin_advancecoverages
 
+! Register a caller-owned state block [T, rho, Y(1:nsp)] and production-rate
+! array with this phase. Both arrays are aliased (no copies): after
+! registration, updating the block and calling ctkin_evalState refreshes wdot
+! in place. The arrays must remain valid and at a fixed address until
+! ctkin_releaseState is called.
+    integer function ctkin_registerState(self, state, wdot)
+      implicit none
+      type(phase_t), intent(inout) :: self
+      double precision, intent(in) :: state(*)
+      double precision, intent(out) :: wdot(*)
+      ctkin_registerstate = ctstate_register(self%thermo_id, self%kin_id, &
+           state, wdot)
+    end function ctkin_registerstate
+
+    subroutine ctkin_evalState(self, handle)
+      implicit none
+      type(phase_t), intent(inout) :: self
+      integer, intent(in) :: handle
+      self%err = ctstate_eval(handle)
+    end subroutine ctkin_evalstate
+
+    subroutine ctkin_releaseState(self, handle)
+      implicit none
+      type(phase_t), intent(inout) :: self
+      integer, intent(in) :: handle
+      self%err = ctstate_release(handle)
+    end subroutine ctkin_releasestate
+
 end module cantera_kinetics
@@ -59,6 +59,18 @@ Transport* _ftrans(const integer* n)
     return &TransportCabinet::item(*n);
 }
 
+//! A Fortran-owned state block aliased by ctstate_register_. The pointers
+//! refer to memory owned by the Fortran caller.
+struct AliasedState {
+    AliasedState() : thermo(0), kin(0), state(0), wdot(0) {}
+    ThermoPhase* thermo;
+    Kinetics* kin;
+    doublereal* state; //!< layout [T, rho, Y(1:nsp)]
+    doublereal* wdot;
+};
+
+std::vector<AliasedState> s_aliasedStates;
+
 } // unnamed namespace
 
 std::string f2string(const char* s, ftnlen n)
@@ -940,6 +952,69 @@ extern "C" {
         return 0;
     }
 
+    //--------------- aliased state blocks ---------------------//
+
+    //! Register a Fortran-owned state block with a thermo/kinetics pair. The
+    //! block layout is [T, rho, Y(1:nsp)] and both arrays are aliased, not
+    //! copied: every subsequent ctstate_eval reads the current block contents
+    //! and writes the net production rates into *wdot* directly. The caller
+    //! must keep both arrays alive (and at a fixed address, e.g. module or
+    //! allocatable data) until ctstate_release is called.
+    integer ctstate_register_(const integer* nth, const integer* nkin,
+                              doublereal* state, doublereal* wdot)
+    {
+        try {
+            AliasedState block;
+            block.thermo = _fth(nth);
+            block.kin = _fkin(nkin);
+            block.state = state;
+            block.wdot = wdot;
+            for (size_t i = 0; i < s_aliasedStates.size(); i++) {
+                if (!s_aliasedStates[i].thermo) {
+                    s_aliasedStates[i] = block;
+                    return static_cast<integer>(i) + 1;
+                }
+            }
+            s_aliasedStates.push_back(block);
+            return static_cast<integer>(s_aliasedStates.size());
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
+    status_t ctstate_eval_(const integer* n)
+    {
+        try {
+            if (*n < 1 || *n > (integer) s_aliasedStates.size()
+                || !s_aliasedStates[*n-1].thermo) {
+                throw CanteraError("ctstate_eval",
+                                   "invalid state block handle");
+            }
+            AliasedState& b = s_aliasedStates[*n-1];
+            b.thermo->setMassFractions_NoNorm(b.state + 2);
+            b.thermo->setTemperature(b.state[0]);
+            b.thermo->setDensity(b.state[1]);
+            b.kin->getNetProductionRates(b.wdot);
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+        return 0;
+    }
+
+    status_t ctstate_release_(const integer* n)
+    {
+        try {
+            if (*n < 1 || *n > (integer) s_aliasedStates.size()) {
+                throw CanteraError("ctstate_release",
+                                   "invalid state block handle");
+            }
+            s_aliasedStates[*n-1] = AliasedState();
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+        return 0;
+    }
+
     //------------------- Transport ---------------------------
 
     integer newtransport_(char* model, integer* ith,
@@ -400,6 +400,21 @@ interface
         double precision, intent(in) :: tstep
     end function kin_advancecoverages
 
+    integer function ctstate_register(nth, nkin, state, wdot)
+        integer, intent(in) :: nth
+        integer, intent(in) :: nkin
+        double precision, intent(in) :: state(*)
+        double precision, intent(out) :: wdot(*)
+    end function ctstate_register
+
+    integer function ctstate_eval(n)
+        integer, intent(in) :: n
+    end function ctstate_eval
+
+    integer function ctstate_release(n)
+        integer, intent(in) :: n
+    end function ctstate_release
+
     integer function newtransport(model, ith, loglevel)
         character*(*), intent(in) :: model
         integer, intent(in) :: ith
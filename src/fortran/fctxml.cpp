@@ -21,7 +21,6 @@ using Cantera::handleAllExceptions;
 #include "clib/Cabinet.h"
 
 typedef Cabinet<XML_Node, false> XmlCabinet;
-template<> XmlCabinet* XmlCabinet::s_storage = 0;
 
 typedef integer status_t;
 
@@ -0,0 +1,42 @@
+/**
+ *  @file ArrheniusTable.cpp Batched evaluation of Arrhenius rate expressions
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/ArrheniusTable.h"
+#include "vec_exp.h"
+
+namespace Cantera
+{
+
+void ArrheniusTable::update(doublereal T, doublereal logT, doublereal* values)
+{
+    doublereal recipT = 1.0/T;
+    size_t n = m_rxn.size();
+
+    // compute all exponential arguments in one dense, branch-free pass
+    for (size_t i = 0; i < n; i++) {
+        m_arg[i] = m_b[i]*logT - m_E[i]*recipT;
+    }
+
+    size_t i = 0;
+#if CT_VECTORIZE_RATES && defined(__AVX2__)
+    for (; i + 4 <= n; i += 4) {
+        __m256d k = _mm256_mul_pd(_mm256_loadu_pd(&m_A[i]),
+                                  vec_exp(_mm256_loadu_pd(&m_arg[i])));
+        double kv[4];
+        _mm256_storeu_pd(kv, k);
+        values[m_rxn[i]] = kv[0];
+        values[m_rxn[i+1]] = kv[1];
+        values[m_rxn[i+2]] = kv[2];
+        values[m_rxn[i+3]] = kv[3];
+    }
+#endif
+    for (; i < n; i++) {
+        values[m_rxn[i]] = m_A[i] * std::exp(m_arg[i]);
+    }
+}
+
+}
@@ -45,6 +45,23 @@ void BulkKinetics::getDeltaEntropy(doublereal* deltaS)
     getReactionDelta(m_grt.data(), deltaS);
 }
 
+void BulkKinetics::getDeltaProperties(doublereal* deltaG, doublereal* deltaH,
+                                      doublereal* deltaS)
+{
+    // Gather the partial molar enthalpies and entropies once each; deltaG
+    // follows from deltaH - T * deltaS since the reaction delta is linear
+    // in the species properties. This halves the work relative to calling
+    // the three individual methods.
+    thermo().getPartialMolarEnthalpies(m_grt.data());
+    getReactionDelta(m_grt.data(), deltaH);
+    thermo().getPartialMolarEntropies(m_grt.data());
+    getReactionDelta(m_grt.data(), deltaS);
+    doublereal T = thermo().temperature();
+    for (size_t j = 0; j < nReactions(); ++j) {
+        deltaG[j] = deltaH[j] - T * deltaS[j];
+    }
+}
+
 void BulkKinetics::getDeltaSSGibbs(doublereal* deltaG)
 {
     // Get the standard state chemical potentials of the species. This is the
@@ -148,6 +165,7 @@ bool BulkKinetics::addReaction(shared_ptr<Reaction> r)
 void BulkKinetics::addElementaryReaction(ElementaryReaction& r)
 {
     m_rates.install(nReactions()-1, r.rate);
+    m_rates_soa.install(nReactions()-1, r.rate);
 }
 
 void BulkKinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
@@ -173,13 +191,52 @@ void BulkKinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
 void BulkKinetics::modifyElementaryReaction(size_t i, ElementaryReaction& rNew)
 {
     m_rates.replace(i, rNew.rate);
+    m_rates_soa.replace(i, rNew.rate);
+}
+
+void BulkKinetics::beginRateUpdate()
+{
+    if (m_rate_update_open) {
+        throw CanteraError("BulkKinetics::beginRateUpdate",
+            "A rate parameter update transaction is already open.");
+    }
+    m_rate_update_open = true;
+}
+
+void BulkKinetics::setRateParameters(size_t i, double A, double b, double Ta)
+{
+    if (!m_rate_update_open) {
+        throw CanteraError("BulkKinetics::setRateParameters",
+            "beginRateUpdate() must be called before setting parameters.");
+    }
+    checkReactionIndex(i);
+    if (!m_rates.contains(i)) {
+        throw CanteraError("BulkKinetics::setRateParameters",
+            "The rate constant of reaction {} is not a plain Arrhenius "
+            "expression; use modifyReaction() instead.", i);
+    }
+    Arrhenius rate(A, b, Ta);
+    m_rates.replace(i, rate);
+    m_rates_soa.replace(i, rate);
+    // Keep the stored Reaction object consistent, so that serialization and
+    // reaction() report the updated parameters
+    dynamic_cast<ElementaryReaction&>(*m_reactions[i]).rate = rate;
+}
+
+void BulkKinetics::commitRateUpdate()
+{
+    if (!m_rate_update_open) {
+        throw CanteraError("BulkKinetics::commitRateUpdate",
+            "No rate parameter update transaction is open.");
+    }
+    m_rate_update_open = false;
+    invalidateCache();
 }
 
 void BulkKinetics::resizeSpecies()
 {
     Kinetics::resizeSpecies();
     m_act_conc.resize(m_kk);
-    m_phys_conc.resize(m_kk);
     m_grt.resize(m_kk);
 }
 
@@ -10,6 +10,7 @@
 #include "cantera/base/ctexceptions.h"
 #include "cantera/base/global.h"
 #include "cantera/base/AnyMap.h"
+#include "cantera/base/fastmath.h"
 #include "cantera/kinetics/Falloff.h"
 
 namespace Cantera
@@ -60,21 +61,21 @@ void Troe::init(const vector_fp& c)
 
 void Troe::updateTemp(double T, double* work) const
 {
-    double Fcent = (1.0 - m_a) * exp(-T*m_rt3) + m_a * exp(-T*m_rt1);
+    double Fcent = (1.0 - m_a) * fast_exp(-T*m_rt3) + m_a * fast_exp(-T*m_rt1);
     if (m_t2) {
-        Fcent += exp(- m_t2 / T);
+        Fcent += fast_exp(- m_t2 / T);
     }
-    *work = log10(std::max(Fcent, SmallNumber));
+    *work = fast_log10(std::max(Fcent, SmallNumber));
 }
 
 double Troe::F(double pr, const double* work) const
 {
-    double lpr = log10(std::max(pr,SmallNumber));
+    double lpr = fast_log10(std::max(pr,SmallNumber));
     double cc = -0.4 - 0.67 * (*work);
     double nn = 0.75 - 1.27 * (*work);
     double f1 = (lpr + cc)/ (nn - 0.14 * (lpr + cc));
     double lgf = (*work) / (1.0 + f1 * f1);
-    return pow(10.0, lgf);
+    return fast_exp(2.302585092994046 * lgf); // 10^lgf
 }
 
 void Troe::getParameters(double* params) const {
@@ -128,16 +129,16 @@ void SRI::init(const vector_fp& c)
 
 void SRI::updateTemp(double T, double* work) const
 {
-    *work = m_a * exp(- m_b / T);
+    *work = m_a * fast_exp(- m_b / T);
     if (m_c != 0.0) {
-        *work += exp(- T/m_c);
+        *work += fast_exp(- T/m_c);
     }
     work[1] = m_d * pow(T,m_e);
 }
 
 double SRI::F(double pr, const double* work) const
 {
-    double lpr = log10(std::max(pr,SmallNumber));
+    double lpr = fast_log10(std::max(pr,SmallNumber));
     double xx = 1.0/(1.0 + lpr*lpr);
     return pow(*work, xx) * work[1];
 }
@@ -7,22 +7,75 @@
 
 #include "cantera/kinetics/GasKinetics.h"
 #include "cantera/thermo/ThermoPhase.h"
+#include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/base/utilities.h"
+#include "cantera/base/Profiler.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <thread>
 
 using namespace std;
 
 namespace Cantera
 {
+
+namespace { // anonymous
+
+//! Accumulate the wall-clock time of the enclosing scope into a
+//! GasKinetics::TimingStats counter. Does nothing when *enabled* is false.
+class ScopedTimer
+{
+public:
+    ScopedTimer(bool enabled, GasKinetics::TimingStats& stats)
+        : m_enabled(enabled)
+        , m_stats(stats)
+    {
+        if (m_enabled) {
+            m_t0 = std::chrono::steady_clock::now();
+        }
+    }
+    ~ScopedTimer() {
+        if (m_enabled) {
+            m_stats.calls++;
+            m_stats.time += std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - m_t0).count();
+        }
+    }
+private:
+    bool m_enabled;
+    GasKinetics::TimingStats& m_stats;
+    std::chrono::steady_clock::time_point m_t0;
+};
+
+} // anonymous namespace
+
 GasKinetics::GasKinetics(ThermoPhase* thermo) :
     BulkKinetics(thermo),
     m_logp_ref(0.0),
     m_logc_ref(0.0),
     m_logStandConc(0.0),
-    m_pres(0.0)
+    m_pres(0.0),
+    m_mf_stateNum_C(std::numeric_limits<int>::min()),
+    m_densEpoch_C(std::numeric_limits<int>::min()),
+    m_pres_C(0.0),
+    m_kc_rtol(0.0),
+    m_batch_threads(1),
+    m_qss_rtol(1e-6),
+    m_qss_maxiter(100),
+    m_stage_ok(false),
+    m_scratch_packed(false),
+    m_timing_enabled(false),
+    m_finite_check_count(0)
 {
 }
 
 void GasKinetics::update_rates_T()
 {
+    ScopedTimer timer(m_timing_enabled, m_timer_rates_T);
     double T = thermo().temperature();
     double P = thermo().pressure();
     m_logStandConc = log(thermo().standardConcentration());
@@ -30,7 +83,11 @@ void GasKinetics::update_rates_T()
 
     if (T != m_temp) {
         if (!m_rfn.empty()) {
+#if CT_VECTORIZE_RATES
+            m_rates_soa.update(T, logT, m_rfn.data());
+#else
             m_rates.update(T, logT, m_rfn.data());
+#endif
         }
 
         if (!m_rfn_low.empty()) {
@@ -42,6 +99,7 @@ void GasKinetics::update_rates_T()
         }
         updateKc();
         m_ROP_ok = false;
+        m_stage_ok = false;
         if (m_blowersmasel_rates.nReactions()) {
             thermo().getPartialMolarEnthalpies(m_grt.data());
             getReactionDelta(m_grt.data(), m_dH.data());
@@ -60,11 +118,13 @@ void GasKinetics::update_rates_T()
         if (m_plog_rates.nReactions()) {
             m_plog_rates.update(T, logT, m_rfn.data());
             m_ROP_ok = false;
+            m_stage_ok = false;
         }
 
         if (m_cheb_rates.nReactions()) {
             m_cheb_rates.update(T, logT, m_rfn.data());
             m_ROP_ok = false;
+            m_stage_ok = false;
         }
     }
     m_pres = P;
@@ -73,48 +133,88 @@ void GasKinetics::update_rates_T()
 
 void GasKinetics::update_rates_C()
 {
-    thermo().getActivityConcentrations(m_act_conc.data());
-    thermo().getConcentrations(m_phys_conc.data());
-    doublereal ctot = thermo().molarDensity();
-
-    // 3-body reactions
-    if (!concm_3b_values.empty()) {
-        m_3b_concm.update(m_phys_conc, ctot, concm_3b_values.data());
-    }
+    ScopedTimer timer(m_timing_enabled, m_timer_rates_C);
+    // The concentrations depend on the composition and density of the phase,
+    // but not directly on its temperature, so this part of the update can be
+    // skipped when only the temperature has changed since the last call.
+    if (m_mf_stateNum_C != thermo().stateMFNumber()
+        || m_densEpoch_C != thermo().densityEpoch()) {
+        thermo().getActivityConcentrations(m_act_conc.data());
+        const vector_fp& conc = thermo().concentrations();
+        doublereal ctot = thermo().molarDensity();
+
+        // 3-body reactions
+        if (!concm_3b_values.empty()) {
+            m_3b_concm.update(conc.data(), ctot, concm_3b_values.data());
+        }
 
-    // Falloff reactions
-    if (!concm_falloff_values.empty()) {
-        m_falloff_concm.update(m_phys_conc, ctot, concm_falloff_values.data());
-    }
+        // Falloff reactions
+        if (!concm_falloff_values.empty()) {
+            m_falloff_concm.update(conc.data(), ctot,
+                                   concm_falloff_values.data());
+        }
 
-    // P-log reactions
-    if (m_plog_rates.nReactions()) {
-        double logP = log(thermo().pressure());
-        m_plog_rates.update_C(&logP);
+        m_mf_stateNum_C = thermo().stateMFNumber();
+        m_densEpoch_C = thermo().densityEpoch();
+        m_ROP_ok = false;
+        m_stage_ok = false;
     }
 
-    // Chebyshev reactions
-    if (m_cheb_rates.nReactions()) {
-        double log10P = log10(thermo().pressure());
-        m_cheb_rates.update_C(&log10P);
+    // The P-log and Chebyshev parameterizations depend on the pressure, which
+    // changes whenever any of the state variables does
+    if (m_plog_rates.nReactions() || m_cheb_rates.nReactions()) {
+        double P = thermo().pressure();
+        if (P != m_pres_C) {
+            // P-log reactions
+            if (m_plog_rates.nReactions()) {
+                double logP = log(P);
+                m_plog_rates.update_C(&logP);
+            }
+
+            // Chebyshev reactions
+            if (m_cheb_rates.nReactions()) {
+                double log10P = log10(P);
+                m_cheb_rates.update_C(&log10P);
+            }
+
+            m_pres_C = P;
+            m_ROP_ok = false;
+            m_stage_ok = false;
+        }
     }
-
-    m_ROP_ok = false;
 }
 
 void GasKinetics::updateKc()
 {
+    double T = thermo().temperature();
+    if (m_kc_rtol > 0.0 && interpolateKc(T)) {
+        return;
+    }
+
     thermo().getStandardChemPotentials(m_grt.data());
     fill(m_rkcn.begin(), m_rkcn.end(), 0.0);
 
     // compute Delta G^0 for all reversible reactions
     getRevReactionDelta(m_grt.data(), m_rkcn.data());
 
+    // If interpolation is enabled, record log(1/Kc) for the reversible
+    // reactions at this temperature. The pressure dependence of the
+    // standard-state chemical potentials cancels against the standard
+    // concentration term, so these logarithms depend only on T.
+    vector_fp* logs = nullptr;
+    if (m_kc_rtol > 0.0) {
+        logs = &m_kc_table[1.0/T];
+        logs->resize(m_revindex.size());
+    }
+
     doublereal rrt = 1.0 / thermo().RT();
     for (size_t i = 0; i < m_revindex.size(); i++) {
         size_t irxn = m_revindex[i];
-        m_rkcn[irxn] = std::min(exp(m_rkcn[irxn]*rrt - m_dn[irxn]*m_logStandConc),
-                                BigNumber);
+        double logKc = m_rkcn[irxn]*rrt - m_dn[irxn]*m_logStandConc;
+        if (logs) {
+            (*logs)[i] = logKc;
+        }
+        m_rkcn[irxn] = std::min(exp(logKc), BigNumber);
     }
 
     for (size_t i = 0; i != m_irrev.size(); ++i) {
@@ -122,6 +222,264 @@ void GasKinetics::updateKc()
     }
 }
 
+bool GasKinetics::interpolateKc(double T)
+{
+    double x = 1.0/T;
+    auto hi = m_kc_table.lower_bound(x);
+    if (hi == m_kc_table.end() || hi == m_kc_table.begin()) {
+        return false;
+    }
+    auto lo = std::prev(hi);
+
+    // the bracketing entries must be spaced closely enough; note that the
+    // keys are reciprocal temperatures, so 'lo' is the higher temperature
+    if (1.0/lo->first - 1.0/hi->first > m_kc_rtol * T
+        || lo->second.size() != m_revindex.size()) {
+        return false;
+    }
+
+    double f = (x - lo->first) / (hi->first - lo->first);
+    const vector_fp& y0 = lo->second;
+    const vector_fp& y1 = hi->second;
+    fill(m_rkcn.begin(), m_rkcn.end(), 0.0);
+    for (size_t i = 0; i < m_revindex.size(); i++) {
+        m_rkcn[m_revindex[i]] = std::min(exp(y0[i] + f*(y1[i] - y0[i])),
+                                         BigNumber);
+    }
+    return true;
+}
+
+void GasKinetics::setKcInterpolationTolerance(double rtol)
+{
+    m_kc_rtol = rtol;
+    m_kc_table.clear();
+}
+
+void GasKinetics::setQuasiSteadySpecies(const std::vector<std::string>& species)
+{
+    std::vector<size_t> indices;
+    for (const auto& name : species) {
+        size_t k = kineticsSpeciesIndex(name);
+        if (k == npos) {
+            throw CanteraError("GasKinetics::setQuasiSteadySpecies",
+                "Species '{}' is not present in the mechanism.", name);
+        }
+        indices.push_back(k);
+    }
+    m_qss_species = std::move(indices);
+    m_ROP_ok = false;
+}
+
+void GasKinetics::setQssSolverOptions(double rtol, size_t maxIter)
+{
+    if (rtol <= 0.0 || maxIter == 0) {
+        throw CanteraError("GasKinetics::setQssSolverOptions",
+            "The tolerance and the iteration limit must be positive.");
+    }
+    m_qss_rtol = rtol;
+    m_qss_maxiter = maxIter;
+    m_ROP_ok = false;
+}
+
+void GasKinetics::applyQuasiSteadyState()
+{
+    m_qss_conc = m_act_conc;
+    m_qss_cdot.resize(m_kk);
+    m_qss_ddot.resize(m_kk);
+
+    for (size_t iter = 0; iter < m_qss_maxiter; iter++) {
+        // creation and destruction rates of each species at the current
+        // estimates of the QSS concentrations; the rates of progress in
+        // m_ropf and m_ropr already correspond to m_qss_conc
+        fill(m_qss_cdot.begin(), m_qss_cdot.end(), 0.0);
+        fill(m_qss_ddot.begin(), m_qss_ddot.end(), 0.0);
+        m_revProductStoich.incrementSpecies(m_ropf.data(), m_qss_cdot.data());
+        m_irrevProductStoich.incrementSpecies(m_ropf.data(), m_qss_cdot.data());
+        m_reactantStoich.incrementSpecies(m_ropr.data(), m_qss_cdot.data());
+        m_revProductStoich.incrementSpecies(m_ropr.data(), m_qss_ddot.data());
+        m_reactantStoich.incrementSpecies(m_ropf.data(), m_qss_ddot.data());
+
+        // fixed-point update: with destruction first order in the QSS
+        // species itself, the steady concentration satisfies
+        // c_k = cdot_k / (ddot_k / c_k)
+        double errmax = 0.0;
+        for (size_t k : m_qss_species) {
+            double c = m_qss_conc[k];
+            if (m_qss_ddot[k] > Tiny && c > Tiny) {
+                double cnew = m_qss_cdot[k] * c / m_qss_ddot[k];
+                errmax = std::max(errmax, fabs(cnew - c) / c);
+                m_qss_conc[k] = cnew;
+            }
+        }
+
+        // re-evaluate the rates of progress at the updated concentrations
+        m_ropf = m_qss_kf;
+        m_ropr = m_qss_kr;
+        m_reactantStoich.multiply(m_qss_conc.data(), m_ropf.data());
+        m_revProductStoich.multiply(m_qss_conc.data(), m_ropr.data());
+
+        if (errmax < m_qss_rtol) {
+            break;
+        }
+    }
+
+    for (size_t j = 0; j != nReactions(); ++j) {
+        m_ropnet[j] = m_ropf[j] - m_ropr[j];
+    }
+}
+
+AnyMap GasKinetics::statistics()
+{
+    AnyMap stats = BulkKinetics::statistics();
+    stats["species-thermo-updates"] = static_cast<long int>(
+        thermo().speciesThermo().nUpdateCalls());
+    if (m_timing_enabled) {
+        AnyMap timing;
+        const std::pair<const char*, TimingStats*> sections[] = {
+            {"updateROP", &m_timer_rop},
+            {"update_rates_T", &m_timer_rates_T},
+            {"update_rates_C", &m_timer_rates_C},
+        };
+        for (const auto& section : sections) {
+            AnyMap entry;
+            entry["calls"] = static_cast<long int>(section.second->calls);
+            entry["seconds"] = section.second->time;
+            timing[section.first] = std::move(entry);
+        }
+        stats["timing"] = std::move(timing);
+    }
+    return stats;
+}
+
+AnyMap GasKinetics::memoryReport() const
+{
+    AnyMap report = BulkKinetics::memoryReport();
+    report["concentration-scratch-bytes"] = static_cast<long int>(
+        vectorBytes(m_act_conc) + vectorBytes(m_grt) + vectorBytes(m_dn));
+    report["falloff-scratch-bytes"] = static_cast<long int>(
+        vectorBytes(m_rfn_low) + vectorBytes(m_rfn_high)
+        + vectorBytes(falloff_work) + vectorBytes(concm_3b_values)
+        + vectorBytes(concm_falloff_values));
+    size_t staged = vectorBytes(m_kf_stage);
+    if (staged) {
+        report["staged-rate-bytes"] = static_cast<long int>(staged);
+    }
+    size_t qss = vectorBytes(m_qss_conc) + vectorBytes(m_qss_kf)
+        + vectorBytes(m_qss_kr) + vectorBytes(m_qss_cdot)
+        + vectorBytes(m_qss_ddot);
+    if (!m_qss_species.empty()) {
+        report["qss-scratch-bytes"] = static_cast<long int>(qss);
+    }
+    if (!m_kc_table.empty()) {
+        size_t kc = 0;
+        for (const auto& entry : m_kc_table) {
+            kc += vectorBytes(entry.second);
+        }
+        report["kc-table-bytes"] = static_cast<long int>(kc);
+    }
+    return report;
+}
+
+void GasKinetics::setBatchNumThreads(size_t nThreads)
+{
+    if (nThreads == 0) {
+        nThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    m_batch_threads = nThreads;
+    m_batch_evaluators.clear();
+}
+
+void GasKinetics::buildBatchEvaluators()
+{
+    m_batch_evaluators.clear();
+    m_batch_evaluators.resize(m_batch_threads - 1);
+    for (auto& e : m_batch_evaluators) {
+        // Build a phase with the same elements and species as the one this
+        // kinetics manager is attached to. The Species objects are shared
+        // with the original phase; they are only read during evaluation.
+        std::unique_ptr<IdealGasPhase> gas(new IdealGasPhase());
+        gas->setName(thermo().name());
+        for (size_t m = 0; m < thermo().nElements(); m++) {
+            gas->addElement(thermo().elementName(m), thermo().atomicWeight(m));
+        }
+        for (size_t k = 0; k < m_kk; k++) {
+            gas->addSpecies(thermo().species(k));
+        }
+        gas->initThermo();
+        gas->setState_TPY(thermo().temperature(), thermo().pressure(),
+                          thermo().massFractions());
+        e.thermo = std::move(gas);
+        e.kin = threadClone({e.thermo.get()});
+    }
+}
+
+void GasKinetics::getNetProductionRatesBatch(size_t nStates,
+                                             const doublereal* T,
+                                             const doublereal* P,
+                                             const doublereal* Y,
+                                             doublereal* wdot)
+{
+    if (m_batch_threads <= 1 || nStates < 2 || nPhases() != 1
+        || thermo().type() != "IdealGas") {
+        Kinetics::getNetProductionRatesBatch(nStates, T, P, Y, wdot);
+        return;
+    }
+    if (m_batch_evaluators.size() != m_batch_threads - 1) {
+        buildBatchEvaluators();
+    }
+    size_t nThreads = std::min(m_batch_threads, nStates);
+
+    // Workers claim chunks of states from a shared counter, so a thread
+    // stuck on expensive states stops claiming new ones while the others
+    // keep going. The chunk size keeps the claiming overhead small while
+    // still balancing the load.
+    const size_t chunkSize = 32;
+    std::atomic<size_t> next(0);
+    std::exception_ptr firstError = nullptr;
+    std::mutex errorMutex;
+
+    auto worker = [&](size_t i) {
+        ThermoPhase& ph = (i == 0) ? thermo() : *m_batch_evaluators[i-1].thermo;
+        Kinetics* kin = (i == 0) ? this : m_batch_evaluators[i-1].kin.get();
+        try {
+            while (true) {
+                size_t begin = next.fetch_add(chunkSize);
+                if (begin >= nStates) {
+                    return;
+                }
+                size_t end = std::min(nStates, begin + chunkSize);
+                for (size_t n = begin; n < end; n++) {
+                    ph.setState_TPY(T[n], P[n], Y + n*m_kk);
+                    kin->getNetProductionRates(wdot + n*m_kk);
+                }
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!firstError) {
+                firstError = std::current_exception();
+            }
+        }
+    };
+
+    // the calling thread evaluates states too, using this object and its
+    // phase; their state is saved and restored as in the serial path
+    vector_fp state;
+    thermo().saveState(state);
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < nThreads; i++) {
+        threads.emplace_back(worker, i);
+    }
+    worker(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    thermo().restoreState(state);
+
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+}
+
 void GasKinetics::getEquilibriumConstants(doublereal* kc)
 {
     update_rates_T();
@@ -141,10 +499,50 @@ void GasKinetics::getEquilibriumConstants(doublereal* kc)
     m_temp = 0.0;
 }
 
+void GasKinetics::packScratch()
+{
+    m_scratch_packed = true;
+
+    // the scratch arrays, in the order they are visited by updateROP()
+    scratch_fp* vecs[] = {
+        &m_rfn, &m_rfn_low, &m_rfn_high, &falloff_work,
+        &concm_3b_values, &concm_falloff_values,
+        &m_act_conc, &m_grt,
+        &m_perturb, &m_rkcn, &m_kf_stage,
+        &m_ropf, &m_ropr, &m_ropnet,
+    };
+
+    // m_kf_stage is still empty here; it is filled by the first full update
+    size_t total = nReactions();
+    for (scratch_fp* v : vecs) {
+        total += v->size();
+    }
+    m_arena = std::make_shared<ScratchArena>(total);
+    ArenaAllocator<double> alloc(m_arena);
+    for (scratch_fp* v : vecs) {
+        scratch_fp packed(v->begin(), v->end(), alloc);
+        v->swap(packed);
+    }
+    m_kf_stage.reserve(nReactions());
+}
+
+#if CT_NO_FINITE_CHECKS
+//! Number of rate evaluations between batched finite-value scans when the
+//! per-reaction assertions are compiled out; set through the
+//! CANTERA_FINITE_CHECK_INTERVAL environment variable. Zero (the default)
+//! disables the scans.
+static int finiteCheckInterval()
+{
+    static const char* flag = getenv("CANTERA_FINITE_CHECK_INTERVAL");
+    static int interval = flag ? std::atoi(flag) : 0;
+    return interval;
+}
+#endif
+
 void GasKinetics::processFalloffReactions()
 {
     // use m_ropr for temporary storage of reduced pressure
-    vector_fp& pr = m_ropr;
+    scratch_fp& pr = m_ropr;
 
     for (size_t i = 0; i < m_falloff_low_rates.nReactions(); i++) {
         pr[i] = concm_falloff_values[i] * m_rfn_low[i] / (m_rfn_high[i] + SmallNumber);
@@ -166,6 +564,11 @@ void GasKinetics::processFalloffReactions()
 
 void GasKinetics::updateROP()
 {
+    CT_PROFILE_SCOPE("GasKinetics::updateROP");
+    ScopedTimer timer(m_timing_enabled, m_timer_rop);
+    if (!m_scratch_packed) {
+        packScratch();
+    }
     update_rates_C();
     update_rates_T();
     if (m_ROP_ok) {
@@ -184,24 +587,85 @@ void GasKinetics::updateROP()
         processFalloffReactions();
     }
 
-    for (size_t i = 0; i < nReactions(); i++) {
-        // Scale the forward rate coefficient by the perturbation factor
-        m_ropf[i] *= m_perturb[i];
-        // For reverse rates computed from thermochemistry, multiply the forward
-        // rate coefficients by the reciprocals of the equilibrium constants
-        m_ropr[i] = m_ropf[i] * m_rkcn[i];
-    }
+    // cache the coefficient stage for getRatesOfProgressSubset()
+    m_kf_stage = m_ropf;
+    m_stage_ok = true;
 
-    // multiply ropf by concentration products
-    m_reactantStoich.multiply(m_act_conc.data(), m_ropf.data());
+    bool qss = !m_qss_species.empty();
+    if (qss) {
+        m_qss_kf.resize(nReactions());
+        m_qss_kr.resize(nReactions());
+    }
 
-    // for reversible reactions, multiply ropr by concentration products
-    m_revProductStoich.multiply(m_act_conc.data(), m_ropr.data());
+    // Fused assembly: each reaction's forward, reverse and net rate of
+    // progress is computed in registers and written once, instead of
+    // sweeping the full rate arrays separately for the perturbation factors,
+    // the equilibrium constants, the two concentration products and the net
+    // rate. The reaction-major order tables provide the per-reaction view of
+    // the concentration products.
+    const auto& fOrders = m_reactantStoich.reactionOrders(nReactions());
+    const auto& rOrders = m_revProductStoich.reactionOrders(nReactions());
+    const doublereal* conc = m_act_conc.data();
+    for (size_t i = 0; i < nReactions(); i++) {
+        // Forward rate coefficient scaled by the perturbation factor; the
+        // reverse coefficient follows from the reciprocal of the
+        // equilibrium constant (m_rkcn is zero for irreversible reactions)
+        double kf = m_ropf[i] * m_perturb[i];
+        double kr = kf * m_rkcn[i];
+        if (qss) {
+            // save the coefficient stage so the concentration products can
+            // be re-evaluated during the quasi-steady-state iteration
+            m_qss_kf[i] = kf;
+            m_qss_kr[i] = kr;
+        }
+        double cf = 1.0;
+        for (size_t n = fOrders.start[i]; n < fOrders.start[i+1]; n++) {
+            double c = conc[fOrders.index[n]];
+            double o = fOrders.value[n];
+            if (o == 1.0) {
+                cf *= c;
+            } else if (o == 2.0) {
+                cf *= c * c;
+            } else {
+                cf *= std::pow(c, o);
+            }
+        }
+        double cr = 1.0;
+        for (size_t n = rOrders.start[i]; n < rOrders.start[i+1]; n++) {
+            double c = conc[rOrders.index[n]];
+            double o = rOrders.value[n];
+            if (o == 1.0) {
+                cr *= c;
+            } else if (o == 2.0) {
+                cr *= c * c;
+            } else {
+                cr *= std::pow(c, o);
+            }
+        }
+        double ropf = kf * cf;
+        double ropr = kr * cr;
+        m_ropf[i] = ropf;
+        m_ropr[i] = ropr;
+        m_ropnet[i] = ropf - ropr;
+    }
 
-    for (size_t j = 0; j != nReactions(); ++j) {
-        m_ropnet[j] = m_ropf[j] - m_ropr[j];
+    if (!m_qss_species.empty()) {
+        applyQuasiSteadyState();
     }
 
+#if CT_NO_FINITE_CHECKS
+    // The per-reaction assertions are compiled out (build option
+    // 'no_finite_checks'). If a scan interval is configured, validate the
+    // assembled arrays in one vectorizable pass every few evaluations, which
+    // catches the same failures at a fraction of the cost.
+    if (finiteCheckInterval() > 0
+        && ++m_finite_check_count >= finiteCheckInterval()) {
+        m_finite_check_count = 0;
+        checkFinite("m_rfn", m_rfn.data(), m_rfn.size());
+        checkFinite("m_ropf", m_ropf.data(), m_ropf.size());
+        checkFinite("m_ropr", m_ropr.data(), m_ropr.size());
+    }
+#else
     for (size_t i = 0; i < m_rfn.size(); i++) {
         AssertFinite(m_rfn[i], "GasKinetics::updateROP",
                      "m_rfn[{}] is not finite.", i);
@@ -210,6 +674,7 @@ void GasKinetics::updateROP()
         AssertFinite(m_ropr[i], "GasKinetics::updateROP",
                      "m_ropr[{}] is not finite.", i);
     }
+#endif
     m_ROP_ok = true;
 }
 
@@ -236,6 +701,161 @@ void GasKinetics::getFwdRateConstants(doublereal* kfwd)
     }
 }
 
+void GasKinetics::getRatesOfProgressSubset(const std::vector<size_t>& rxns,
+    doublereal* fwdROP, doublereal* revROP, doublereal* netROP)
+{
+    if (!m_qss_species.empty()) {
+        Kinetics::getRatesOfProgressSubset(rxns, fwdROP, revROP, netROP);
+        return;
+    }
+
+    update_rates_T();
+    update_rates_C();
+    if (!m_stage_ok) {
+        // one full pass caches the coefficient stage for this state
+        updateROP();
+    }
+    if (m_deriv_reac_orders.size() != nReactions()) {
+        updateDerivativeCache();
+    }
+
+    const scratch_fp& conc = m_act_conc;
+    for (size_t n = 0; n < rxns.size(); n++) {
+        size_t i = rxns[n];
+        checkReactionIndex(i);
+        double kf = m_kf_stage[i] * m_perturb[i];
+        double ropf = kf;
+        for (const auto& rk : m_deriv_reac_orders[i]) {
+            ropf *= std::pow(conc[rk.first], rk.second);
+        }
+        double ropr = 0.0;
+        if (m_rkcn[i] != 0.0) {
+            ropr = kf * m_rkcn[i];
+            for (const auto& pk : m_deriv_prod_orders[i]) {
+                ropr *= std::pow(conc[pk.first], pk.second);
+            }
+        }
+        if (fwdROP) {
+            fwdROP[n] = ropf;
+        }
+        if (revROP) {
+            revROP[n] = ropr;
+        }
+        if (netROP) {
+            netROP[n] = ropf - ropr;
+        }
+    }
+}
+
+void GasKinetics::updateDerivativeCache()
+{
+    m_deriv_reac_orders.assign(nReactions(), {});
+    m_deriv_prod_orders.assign(nReactions(), {});
+    m_deriv_net_stoich.assign(nReactions(), {});
+
+    for (size_t i = 0; i < nReactions(); i++) {
+        const Reaction& R = *reaction(i);
+        std::map<size_t, double> net;
+        for (const auto& sp : R.reactants) {
+            size_t k = kineticsSpeciesIndex(sp.first);
+            double order = sp.second;
+            if (R.orders.count(sp.first)) {
+                order = R.orders.at(sp.first);
+            }
+            m_deriv_reac_orders[i].emplace_back(k, order);
+            net[k] -= sp.second;
+        }
+        for (const auto& sp : R.products) {
+            size_t k = kineticsSpeciesIndex(sp.first);
+            if (R.reversible) {
+                m_deriv_prod_orders[i].emplace_back(k, sp.second);
+            }
+            net[k] += sp.second;
+        }
+        for (const auto& kv : net) {
+            if (kv.second != 0.0) {
+                m_deriv_net_stoich[i].emplace_back(kv.first, kv.second);
+            }
+        }
+    }
+}
+
+void GasKinetics::getNetProductionRateDerivatives(SparseRowMatrix& dwdotdC,
+                                                 doublereal* dwdotdT)
+{
+    if (m_deriv_net_stoich.size() != nReactions()) {
+        updateDerivativeCache();
+    }
+
+    // effective forward rate constants, including third-body concentrations,
+    // falloff functions and perturbation factors
+    vector_fp kf(nReactions());
+    getFwdRateConstants(kf.data());
+    m_ROP_ok = false;
+    updateROP();
+
+    const scratch_fp& conc = m_act_conc;
+    SparseTriplets trips;
+    for (size_t i = 0; i < nReactions(); i++) {
+        const auto& reac = m_deriv_reac_orders[i];
+        const auto& net = m_deriv_net_stoich[i];
+        for (const auto& rk : reac) {
+            // d(ropf)/dc_k = nu_k kf c_k^(nu_k - 1) prod_{j != k} c_j^nu_j
+            double d = kf[i] * rk.second * std::pow(conc[rk.first],
+                                                    rk.second - 1.0);
+            for (const auto& rj : reac) {
+                if (rj.first != rk.first) {
+                    d *= std::pow(conc[rj.first], rj.second);
+                }
+            }
+            for (const auto& nm : net) {
+                trips.emplace_back(static_cast<int>(nm.first),
+                                   static_cast<int>(rk.first),
+                                   nm.second * d);
+            }
+        }
+        if (m_rkcn[i] != 0.0) {
+            double kr = kf[i] * m_rkcn[i];
+            const auto& prod = m_deriv_prod_orders[i];
+            for (const auto& pk : prod) {
+                double d = kr * pk.second * std::pow(conc[pk.first],
+                                                     pk.second - 1.0);
+                for (const auto& pj : prod) {
+                    if (pj.first != pk.first) {
+                        d *= std::pow(conc[pj.first], pj.second);
+                    }
+                }
+                for (const auto& nm : net) {
+                    trips.emplace_back(static_cast<int>(nm.first),
+                                       static_cast<int>(pk.first),
+                                       -nm.second * d);
+                }
+            }
+        }
+    }
+    dwdotdC.resize(m_kk, m_kk);
+    dwdotdC.setFromTriplets(trips.begin(), trips.end());
+    dwdotdC.makeCompressed();
+
+    if (dwdotdT) {
+        // one-sided difference at constant concentrations; the perturbed
+        // state keeps the density and composition of the phase fixed
+        double T = thermo().temperature();
+        double dT = T * std::sqrt(std::numeric_limits<double>::epsilon());
+        vector_fp wdot0(m_kk), wdot1(m_kk);
+        getNetProductionRates(wdot0.data());
+        thermo().setTemperature(T + dT);
+        m_ROP_ok = false;
+        getNetProductionRates(wdot1.data());
+        thermo().setTemperature(T);
+        m_ROP_ok = false;
+        updateROP();
+        for (size_t k = 0; k < m_kk; k++) {
+            dwdotdT[k] = (wdot1[k] - wdot0[k]) / dT;
+        }
+    }
+}
+
 bool GasKinetics::addReaction(shared_ptr<Reaction> r)
 {
     // operations common to all reaction types
@@ -302,6 +922,7 @@ void GasKinetics::addFalloffReaction(FalloffReaction& r)
 void GasKinetics::addThreeBodyReaction(ThreeBodyReaction& r)
 {
     m_rates.install(nReactions()-1, r.rate);
+    m_rates_soa.install(nReactions()-1, r.rate);
     map<size_t, double> efficiencies;
     for (const auto& eff : r.third_body.efficiencies) {
         size_t k = kineticsSpeciesIndex(eff.first);
@@ -367,6 +988,7 @@ void GasKinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
 void GasKinetics::modifyThreeBodyReaction(size_t i, ThreeBodyReaction& r)
 {
     m_rates.replace(i, r.rate);
+    m_rates_soa.replace(i, r.rate);
 }
 
 void GasKinetics::modifyFalloffReaction(size_t i, FalloffReaction& r)
@@ -402,6 +1024,13 @@ void GasKinetics::invalidateCache()
 {
     BulkKinetics::invalidateCache();
     m_pres += 0.13579;
+    m_pres_C += 0.13579;
+    m_mf_stateNum_C = std::numeric_limits<int>::min();
+    m_densEpoch_C = std::numeric_limits<int>::min();
+    m_kc_table.clear();
+    m_batch_evaluators.clear();
+    m_deriv_net_stoich.clear();
+    m_stage_ok = false;
 }
 
 }
@@ -0,0 +1,207 @@
+/**
+ *  @file ISATCache.cpp In-situ adaptive tabulation cache for net production
+ *      rates.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/ISATCache.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/numerics/eigen_dense.h"
+
+namespace Cantera
+{
+
+ISATCache::ISATCache(Kinetics& kin, doublereal rtol, doublereal atol,
+                     size_t maxEntries) :
+    m_kin(kin),
+    m_thermo(kin.thermo()),
+    m_rtol(rtol),
+    m_atol(atol),
+    m_r0(1.0e-4),
+    m_maxEntries(maxEntries),
+    m_retrieved(0),
+    m_grown(0),
+    m_added(0)
+{
+    if (kin.nPhases() != 1) {
+        throw CanteraError("ISATCache::ISATCache",
+            "Only implemented for kinetics managers with a single phase.");
+    }
+    m_kk = m_thermo.nSpecies();
+    m_mw = m_thermo.molecularWeights();
+    m_phi.resize(m_kk + 1);
+    m_dphi.resize(m_kk);
+    m_wexact.resize(m_kk);
+    m_wapprox.resize(m_kk);
+}
+
+void ISATCache::clear()
+{
+    m_entries.clear();
+    m_nodes.clear();
+    m_retrieved = 0;
+    m_grown = 0;
+    m_added = 0;
+}
+
+void ISATCache::stateToPhi(doublereal T, doublereal rho, const doublereal* y,
+                           vector_fp& phi) const
+{
+    phi[0] = T;
+    for (size_t k = 0; k < m_kk; k++) {
+        phi[1 + k] = rho * y[k] / m_mw[k];
+    }
+}
+
+int ISATCache::findLeaf(const vector_fp& phi) const
+{
+    int n = 0;
+    while (m_nodes[n].entry < 0) {
+        const Node& nd = m_nodes[n];
+        doublereal s = 0.0;
+        for (size_t i = 0; i < m_kk + 1; i++) {
+            s += nd.cut[i] * phi[i];
+        }
+        n = (s <= nd.cutValue) ? nd.left : nd.right;
+    }
+    return n;
+}
+
+doublereal ISATCache::scaledDistance(const Entry& e,
+                                     const vector_fp& phi) const
+{
+    doublereal sum = 0.0;
+    for (size_t i = 0; i < m_kk + 1; i++) {
+        doublereal d = (phi[i] - e.phi[i]) / e.scale[i];
+        sum += d * d;
+    }
+    return sqrt(sum);
+}
+
+void ISATCache::approximate(const Entry& e, const vector_fp& phi,
+                            doublereal* wdot)
+{
+    doublereal dT = phi[0] - e.phi[0];
+    for (size_t k = 0; k < m_kk; k++) {
+        m_dphi[k] = phi[1 + k] - e.phi[1 + k];
+    }
+    Eigen::Map<const Eigen::VectorXd> w0(e.wdot.data(), m_kk);
+    Eigen::Map<const Eigen::VectorXd> dwdT(e.dwdT.data(), m_kk);
+    Eigen::Map<const Eigen::VectorXd> dc(m_dphi.data(), m_kk);
+    Eigen::Map<Eigen::VectorXd> w(wdot, m_kk);
+    w = w0 + e.dwdC * dc + dT * dwdT;
+}
+
+size_t ISATCache::addEntry(const vector_fp& phi)
+{
+    m_entries.push_back(Entry());
+    Entry& e = m_entries.back();
+    e.phi = phi;
+    e.wdot = m_wexact;
+    e.radius = m_r0;
+    e.dwdT.resize(m_kk);
+    m_kin.getNetProductionRateDerivatives(e.dwdC, e.dwdT.data());
+
+    // Scales defining the shape of the region of accuracy: relative in
+    // temperature and in each concentration, with a floor tied to the total
+    // concentration so that trace species do not collapse the region.
+    e.scale.resize(m_kk + 1);
+    e.scale[0] = std::max(phi[0], 1.0);
+    doublereal ctot = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        ctot += phi[1 + k];
+    }
+    doublereal cfloor = 1.0e-6 * ctot + Tiny;
+    for (size_t k = 0; k < m_kk; k++) {
+        e.scale[1 + k] = std::max(phi[1 + k], cfloor);
+    }
+    return m_entries.size() - 1;
+}
+
+void ISATCache::getNetProductionRates(doublereal T, doublereal rho,
+                                      const doublereal* y, doublereal* wdot)
+{
+    stateToPhi(T, rho, y, m_phi);
+
+    int leaf = -1;
+    if (!m_nodes.empty()) {
+        leaf = findLeaf(m_phi);
+        const Entry& e = m_entries[m_nodes[leaf].entry];
+        if (scaledDistance(e, m_phi) <= e.radius) {
+            approximate(e, m_phi, wdot);
+            m_retrieved++;
+            return;
+        }
+    }
+
+    // full evaluation
+    m_thermo.setMassFractions_NoNorm(y);
+    m_thermo.setTemperature(T);
+    m_thermo.setDensity(rho);
+    m_kin.getNetProductionRates(m_wexact.data());
+    std::copy(m_wexact.begin(), m_wexact.end(), wdot);
+
+    if (m_nodes.empty()) {
+        size_t ie = addEntry(m_phi);
+        Node root;
+        root.entry = static_cast<int>(ie);
+        m_nodes.push_back(root);
+        m_added++;
+        return;
+    }
+
+    // If the linear approximation of the nearest point is accurate here
+    // after all, grow its region of accuracy to cover the query.
+    int iold = m_nodes[leaf].entry;
+    approximate(m_entries[iold], m_phi, m_wapprox.data());
+    bool accurate = true;
+    for (size_t k = 0; k < m_kk; k++) {
+        if (fabs(m_wapprox[k] - m_wexact[k])
+                > m_atol + m_rtol * fabs(m_wexact[k])) {
+            accurate = false;
+            break;
+        }
+    }
+    if (accurate) {
+        Entry& e = m_entries[iold];
+        e.radius = std::max(e.radius, scaledDistance(e, m_phi));
+        m_grown++;
+        return;
+    }
+
+    if (m_entries.size() >= m_maxEntries) {
+        return;
+    }
+
+    // Add a new tabulation point and split the leaf with the hyperplane
+    // bisecting the two points, measured in the scaled coordinates of the
+    // existing point. The existing point always lies on the negative side.
+    size_t inew = addEntry(m_phi);
+    const Entry& eo = m_entries[iold];
+    const Entry& en = m_entries[inew];
+    vector_fp cut(m_kk + 1);
+    doublereal cutValue = 0.0;
+    for (size_t i = 0; i < m_kk + 1; i++) {
+        cut[i] = (en.phi[i] - eo.phi[i]) / (eo.scale[i] * eo.scale[i]);
+        cutValue += cut[i] * 0.5 * (en.phi[i] + eo.phi[i]);
+    }
+    int ileft = static_cast<int>(m_nodes.size());
+    Node lo;
+    lo.entry = iold;
+    m_nodes.push_back(lo);
+    Node rn;
+    rn.entry = static_cast<int>(inew);
+    m_nodes.push_back(rn);
+    Node& nd = m_nodes[leaf];
+    nd.entry = -1;
+    nd.left = ileft;
+    nd.right = ileft + 1;
+    nd.cut = std::move(cut);
+    nd.cutValue = cutValue;
+    m_added++;
+}
+
+}
@@ -161,6 +161,38 @@ void ImplicitSurfChem::integrate0(doublereal t0, doublereal t1)
     updateState(m_integ->solution());
 }
 
+void ImplicitSurfChem::integrateBatch(std::vector<ImplicitSurfChem*>& cells,
+                                      doublereal t0, doublereal t1)
+{
+    if (cells.empty()) {
+        return;
+    }
+    ImplicitSurfChem* lead = cells[0];
+    for (size_t n = 1; n < cells.size(); n++) {
+        if (cells[n]->m_nv != lead->m_nv) {
+            throw CanteraError("ImplicitSurfChem::integrateBatch",
+                "all problems in a batch must have the same number of "
+                "unknowns ({} != {})", cells[n]->m_nv, lead->m_nv);
+        }
+    }
+
+    // Initialize the shared integrator once, on the first problem; the
+    // other problems only ever reinitialize it in place.
+    lead->initialize(t0);
+    Integrator& integ = *lead->m_integ;
+    if (fabs(t1 - t0) < lead->m_maxstep || lead->m_maxstep == 0) {
+        // limit max step size on this run to t1 - t0
+        integ.setMaxStepSize(t1 - t0);
+    }
+    for (size_t n = 0; n < cells.size(); n++) {
+        if (n > 0) {
+            integ.reinitialize(t0, *cells[n]);
+        }
+        integ.integrate(t1);
+        cells[n]->updateState(integ.solution());
+    }
+}
+
 void ImplicitSurfChem::updateState(doublereal* c)
 {
     size_t loc = 0;
@@ -11,6 +11,7 @@
 #include "cantera/kinetics/Reaction.h"
 #include "cantera/thermo/SurfPhase.h"
 #include "cantera/base/utilities.h"
+#include "vec_exp.h"
 
 using namespace std;
 
@@ -19,6 +20,7 @@ namespace Cantera
 
 InterfaceKinetics::InterfaceKinetics(ThermoPhase* thermo) :
     m_redo_rates(false),
+    m_coverageTol(0.0),
     m_surf(0),
     m_integrator(0),
     m_ROP_ok(false),
@@ -53,9 +55,20 @@ void InterfaceKinetics::_update_rates_T()
     _update_rates_phi();
     if (m_has_coverage_dependence) {
         m_surf->getCoverages(m_actConc.data());
-        m_rates.update_C(m_actConc.data());
-        m_blowers_masel_rates.update_C(m_actConc.data());
-        m_redo_rates = true;
+        // Only re-evaluate the coverage dependency expressions when some
+        // coverage has moved by more than the configured tolerance since
+        // they were last evaluated
+        size_t nsurf = m_surf->nSpecies();
+        bool changed = (m_cov_last.size() != nsurf);
+        for (size_t k = 0; !changed && k < nsurf; k++) {
+            changed = fabs(m_actConc[k] - m_cov_last[k]) > m_coverageTol;
+        }
+        if (changed) {
+            m_cov_last.assign(m_actConc.begin(), m_actConc.begin() + nsurf);
+            m_rates.update_C(m_actConc.data());
+            m_blowers_masel_rates.update_C(m_actConc.data());
+            m_redo_rates = true;
+        }
     }
 
     // Go find the temperature from the surface
@@ -220,35 +233,60 @@ void InterfaceKinetics::updateExchangeCurrentQuantities()
 
 void InterfaceKinetics::applyVoltageKfwdCorrection(doublereal* const kf)
 {
-    // Compute the electrical potential energy of each species
-    size_t ik = 0;
-    for (size_t n = 0; n < nPhases(); n++) {
-        size_t nsp = thermo(n).nSpecies();
-        for (size_t k = 0; k < nsp; k++) {
-            m_pot[ik] = Faraday * thermo(n).charge(k) * m_phi[n];
-            ik++;
+    size_t nct = m_beta.size();
+    double rt = thermo(reactionPhaseIndex()).RT();
+
+    // The correction factors depend only on the phase potentials and the
+    // temperature, so they are recomputed only when either has changed
+    // since the last evaluation
+    bool changed = (m_ctFactors.size() != nct) || rt != m_ctRT_last
+                   || m_phi != m_ctPhi_last;
+    if (changed) {
+        // Compute the electrical potential energy of each species
+        size_t ik = 0;
+        for (size_t n = 0; n < nPhases(); n++) {
+            size_t nsp = thermo(n).nSpecies();
+            for (size_t k = 0; k < nsp; k++) {
+                m_pot[ik] = Faraday * thermo(n).charge(k) * m_phi[n];
+                ik++;
+            }
         }
-    }
 
-    // Compute the change in electrical potential energy for each reaction. This
-    // will only be non-zero if a potential difference is present.
-    getReactionDelta(m_pot.data(), deltaElectricEnergy_.data());
+        // Compute the change in electrical potential energy for each
+        // reaction. This will only be non-zero if a potential difference is
+        // present.
+        getReactionDelta(m_pot.data(), deltaElectricEnergy_.data());
 
-    // Modify the reaction rates. Only modify those with a non-zero activation
-    // energy. Below we decrease the activation energy below zero but in some
-    // debug modes we print out a warning message about this.
+        // The voltage correction lowers or raises the activation energy of
+        // each charge transfer reaction.
 
-    // NOTE, there is some discussion about this point. Should we decrease the
-    // activation energy below zero? I don't think this has been decided in any
-    // definitive way. The treatment below is numerically more stable, however.
-    for (size_t i = 0; i < m_beta.size(); i++) {
-        size_t irxn = m_ctrxn[i];
-
-        // Add the voltage correction to the forward reaction rate constants.
-        double eamod = m_beta[i] * deltaElectricEnergy_[irxn];
-        if (eamod != 0.0) {
-            kf[irxn] *= exp(-eamod/thermo(reactionPhaseIndex()).RT());
+        // NOTE, there is some discussion about this point. Should we
+        // decrease the activation energy below zero? I don't think this has
+        // been decided in any definitive way. The treatment below is
+        // numerically more stable, however.
+        m_ctArg.resize(nct);
+        m_ctFactors.resize(nct);
+        double rrt = 1.0 / rt;
+        for (size_t i = 0; i < nct; i++) {
+            m_ctArg[i] = -m_beta[i] * deltaElectricEnergy_[m_ctrxn[i]] * rrt;
+        }
+        size_t i = 0;
+#if CT_VECTORIZE_RATES && defined(__AVX2__)
+        for (; i + 4 <= nct; i += 4) {
+            _mm256_storeu_pd(&m_ctFactors[i],
+                             vec_exp(_mm256_loadu_pd(&m_ctArg[i])));
+        }
+#endif
+        for (; i < nct; i++) {
+            m_ctFactors[i] = exp(m_ctArg[i]);
         }
+        m_ctPhi_last = m_phi;
+        m_ctRT_last = rt;
+    }
+
+    // Apply the cached corrections to the forward reaction rate constants
+    for (size_t i = 0; i < nct; i++) {
+        kf[m_ctrxn[i]] *= m_ctFactors[i];
     }
 }
 
@@ -430,6 +468,22 @@ void InterfaceKinetics::getDeltaEntropy(doublereal* deltaS)
     getReactionDelta(m_grt.data(), deltaS);
 }
 
+void InterfaceKinetics::getDeltaProperties(doublereal* deltaG,
+                                           doublereal* deltaH,
+                                           doublereal* deltaS)
+{
+    // Gather the partial molar enthalpies and entropies once each; deltaG
+    // follows from deltaH - T * deltaS since the reaction delta is linear
+    // in the species properties and all phases share the interface
+    // temperature.
+    getDeltaEnthalpy(deltaH);
+    getDeltaEntropy(deltaS);
+    doublereal T = m_surf->temperature();
+    for (size_t j = 0; j < nReactions(); ++j) {
+        deltaG[j] = deltaH[j] - T * deltaS[j];
+    }
+}
+
 void InterfaceKinetics::getDeltaSSGibbs(doublereal* deltaGSS)
 {
     // Get the standard state chemical potentials of the species. This is the
@@ -584,6 +638,10 @@ bool InterfaceKinetics::addReaction(shared_ptr<Reaction> r_base)
     m_deltaG.push_back(0.0);
     m_ProdStanConcReac.push_back(0.0);
 
+    // Force the coverage-dependent corrections for the new reaction to be
+    // evaluated on the next update
+    m_cov_last.clear();
+
     return true;
 }
 
@@ -601,6 +659,7 @@ void InterfaceKinetics::modifyReaction(size_t i, shared_ptr<Reaction> r_base)
     }
     // Invalidate cached data
     m_redo_rates = true;
+    m_cov_last.clear();
     m_temp += 0.1;
 }
 
@@ -16,6 +16,7 @@
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/utilities.h"
 #include "cantera/base/global.h"
+#include <unordered_map>
 #include <unordered_set>
 #include <boost/algorithm/string/join.hpp>
 
@@ -80,10 +81,23 @@ void Kinetics::checkSpeciesArraySize(size_t kk) const
     }
 }
 
+namespace {
+//! Mix a species index into a well-distributed value, so that the
+//! order-independent sum over the participants of a reaction gives a
+//! collision-resistant bucket key in Kinetics::checkDuplicates()
+size_t participantHash(size_t k)
+{
+    uint64_t z = k + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return static_cast<size_t>(z ^ (z >> 31));
+}
+}
+
 std::pair<size_t, size_t> Kinetics::checkDuplicates(bool throw_err) const
 {
     //! Map of (key indicating participating species) to reaction numbers
-    std::map<size_t, std::vector<size_t> > participants;
+    std::unordered_map<size_t, std::vector<size_t> > participants;
     std::vector<std::map<int, double> > net_stoich;
     std::unordered_set<size_t> unmatched_duplicates;
     for (size_t i = 0; i < m_reactions.size(); i++) {
@@ -93,19 +107,22 @@ std::pair<size_t, size_t> Kinetics::checkDuplicates(bool throw_err) const
     }
 
     for (size_t i = 0; i < m_reactions.size(); i++) {
-        // Get data about this reaction
-        unsigned long int key = 0;
+        // Get data about this reaction. The key is invariant under both the
+        // direction of the reaction and scaling of its stoichiometric
+        // coefficients, so every possible duplicate of a reaction lands in
+        // the same bucket.
+        size_t key = 0;
         Reaction& R = *m_reactions[i];
         net_stoich.emplace_back();
         std::map<int, double>& net = net_stoich.back();
         for (const auto& sp : R.reactants) {
             int k = static_cast<int>(kineticsSpeciesIndex(sp.first));
-            key += k*(k+1);
+            key += participantHash(k);
             net[-1 -k] -= sp.second;
         }
         for (const auto& sp : R.products) {
             int k = static_cast<int>(kineticsSpeciesIndex(sp.first));
-            key += k*(k+1);
+            key += participantHash(k);
             net[1+k] += sp.second;
         }
 
@@ -130,33 +147,13 @@ std::pair<size_t, size_t> Kinetics::checkDuplicates(bool throw_err) const
                        R.type() == "chemically-activated") {
                 ThirdBody& tb1 = dynamic_cast<FalloffReaction&>(R).third_body;
                 ThirdBody& tb2 = dynamic_cast<FalloffReaction&>(other).third_body;
-                bool thirdBodyOk = true;
-                for (size_t k = 0; k < nTotalSpecies(); k++) {
-                    string s = kineticsSpeciesName(k);
-                    if (tb1.efficiency(s) * tb2.efficiency(s) != 0.0) {
-                        // non-zero third body efficiencies for species `s` in
-                        // both reactions
-                        thirdBodyOk = false;
-                        break;
-                    }
-                }
-                if (thirdBodyOk) {
+                if (!thirdBodiesOverlap(tb1, tb2)) {
                     continue; // No overlap in third body efficiencies
                 }
             } else if (R.type() == "three-body") {
                 ThirdBody& tb1 = dynamic_cast<ThreeBodyReaction&>(R).third_body;
                 ThirdBody& tb2 = dynamic_cast<ThreeBodyReaction&>(other).third_body;
-                bool thirdBodyOk = true;
-                for (size_t k = 0; k < nTotalSpecies(); k++) {
-                    string s = kineticsSpeciesName(k);
-                    if (tb1.efficiency(s) * tb2.efficiency(s) != 0.0) {
-                        // non-zero third body efficiencies for species `s` in
-                        // both reactions
-                        thirdBodyOk = false;
-                        break;
-                    }
-                }
-                if (thirdBodyOk) {
+                if (!thirdBodiesOverlap(tb1, tb2)) {
                     continue; // No overlap in third body efficiencies
                 }
             }
@@ -186,6 +183,41 @@ std::pair<size_t, size_t> Kinetics::checkDuplicates(bool throw_err) const
     return {npos, npos};
 }
 
+bool Kinetics::thirdBodiesOverlap(const ThirdBody& tb1,
+                                  const ThirdBody& tb2) const
+{
+    if (tb1.default_efficiency * tb2.default_efficiency != 0.0) {
+        // Only a species with an explicit zero efficiency in one of the two
+        // reactions can fail to overlap, so overlap is ruled out only if
+        // every species in the mechanism has one.
+        std::unordered_set<std::string> zeros;
+        for (const auto& eff : tb1.efficiencies) {
+            if (eff.second * tb2.efficiency(eff.first) == 0.0
+                && kineticsSpeciesIndex(eff.first) != npos) {
+                zeros.insert(eff.first);
+            }
+        }
+        for (const auto& eff : tb2.efficiencies) {
+            if (eff.second * tb1.efficiency(eff.first) == 0.0
+                && kineticsSpeciesIndex(eff.first) != npos) {
+                zeros.insert(eff.first);
+            }
+        }
+        return zeros.size() < nTotalSpecies();
+    }
+    // With a zero default efficiency on either side, overlap requires an
+    // explicit non-zero efficiency for the same species in both reactions
+    const ThirdBody& a = (tb1.default_efficiency == 0.0) ? tb1 : tb2;
+    const ThirdBody& b = (&a == &tb1) ? tb2 : tb1;
+    for (const auto& eff : a.efficiencies) {
+        if (eff.second != 0.0 && b.efficiency(eff.first) != 0.0
+            && kineticsSpeciesIndex(eff.first) != npos) {
+            return true;
+        }
+    }
+    return false;
+}
+
 double Kinetics::checkDuplicateStoich(std::map<int, double>& r1,
                                       std::map<int, double>& r2) const
 {
@@ -384,6 +416,25 @@ void Kinetics::getNetRatesOfProgress(doublereal* netROP)
     std::copy(m_ropnet.begin(), m_ropnet.end(), netROP);
 }
 
+void Kinetics::getRatesOfProgressSubset(const std::vector<size_t>& rxns,
+    doublereal* fwdROP, doublereal* revROP, doublereal* netROP)
+{
+    updateROP();
+    for (size_t n = 0; n < rxns.size(); n++) {
+        size_t i = rxns[n];
+        checkReactionIndex(i);
+        if (fwdROP) {
+            fwdROP[n] = m_ropf[i];
+        }
+        if (revROP) {
+            revROP[n] = m_ropr[i];
+        }
+        if (netROP) {
+            netROP[n] = m_ropnet[i];
+        }
+    }
+}
+
 void Kinetics::getReactionDelta(const double* prop, double* deltaProp)
 {
     fill(deltaProp, deltaProp + nReactions(), 0.0);
@@ -441,6 +492,193 @@ void Kinetics::getNetProductionRates(doublereal* net)
     m_reactantStoich.decrementSpecies(m_ropnet.data(), net);
 }
 
+void Kinetics::getProductionRates(doublereal* cdot, doublereal* ddot,
+                                  doublereal* wdot)
+{
+    updateROP();
+
+    fill(cdot, cdot + m_kk, 0.0);
+    fill(ddot, ddot + m_kk, 0.0);
+    // the forward direction creates product species and destroys reactants
+    m_revProductStoich.incrementSpecies(m_ropf.data(), cdot);
+    m_irrevProductStoich.incrementSpecies(m_ropf.data(), cdot);
+    m_reactantStoich.incrementSpecies(m_ropf.data(), ddot);
+    // the reverse direction creates reactant species and destroys products
+    m_reactantStoich.incrementSpecies(m_ropr.data(), cdot);
+    m_revProductStoich.incrementSpecies(m_ropr.data(), ddot);
+    // the net rates follow by linearity, saving a third set of passes over
+    // the stoichiometry lists
+    for (size_t k = 0; k < m_kk; k++) {
+        wdot[k] = cdot[k] - ddot[k];
+    }
+}
+
+std::unique_ptr<Kinetics> Kinetics::threadClone(
+    const std::vector<ThermoPhase*>& phases)
+{
+    if (phases.size() != nPhases()) {
+        throw CanteraError("Kinetics::threadClone",
+            "Expected {} phases, but got {}.", nPhases(), phases.size());
+    }
+    std::unique_ptr<Kinetics> kin(
+        KineticsFactory::factory()->newKinetics(kineticsType()));
+    kin->skipUndeclaredSpecies(m_skipUndeclaredSpecies);
+    kin->skipUndeclaredThirdBodies(m_skipUndeclaredThirdBodies);
+    for (size_t n = 0; n < phases.size(); n++) {
+        if (phases[n]->name() != thermo(n).name()
+            || phases[n]->nSpecies() != thermo(n).nSpecies()) {
+            throw CanteraError("Kinetics::threadClone",
+                "Phase '{}' is not a clone of phase '{}' of this object.",
+                phases[n]->name(), thermo(n).name());
+        }
+        kin->addPhase(*phases[n]);
+    }
+    kin->init();
+    // The Reaction objects hold only immutable setup data, and are shared
+    // between the clone and the original rather than deep-copied
+    for (const auto& r : m_reactions) {
+        kin->addReaction(r);
+    }
+    for (size_t i = 0; i < nReactions(); i++) {
+        if (m_perturb[i] != 1.0) {
+            kin->setMultiplier(i, m_perturb[i]);
+        }
+    }
+    return kin;
+}
+
+std::vector<bool> Kinetics::reachableSpecies(
+    const std::vector<std::string>& seeds) const
+{
+    std::vector<bool> active(m_kk, false);
+
+    // seed with the species present in the attached phases
+    for (size_t n = 0; n < nPhases(); n++) {
+        const ThermoPhase& ph = thermo(n);
+        for (size_t k = 0; k < ph.nSpecies(); k++) {
+            if (ph.moleFraction(k) > 0.0) {
+                active[m_start[n] + k] = true;
+            }
+        }
+    }
+    for (const auto& name : seeds) {
+        size_t k = kineticsSpeciesIndex(name);
+        if (k == npos) {
+            throw CanteraError("Kinetics::reachableSpecies",
+                "Unknown seed species '{}'", name);
+        }
+        active[k] = true;
+    }
+
+    // Walk the reaction network to a fixed point. A reaction produces its
+    // products once all of its reactants are reachable; a reversible
+    // reaction also produces its reactants once all products are reachable.
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (const auto& r : m_reactions) {
+            bool fwd = true;
+            for (const auto& sp : r->reactants) {
+                fwd = fwd && active[kineticsSpeciesIndex(sp.first)];
+            }
+            if (fwd) {
+                for (const auto& sp : r->products) {
+                    size_t k = kineticsSpeciesIndex(sp.first);
+                    if (!active[k]) {
+                        active[k] = true;
+                        changed = true;
+                    }
+                }
+            }
+            if (r->reversible) {
+                bool rev = true;
+                for (const auto& sp : r->products) {
+                    rev = rev && active[kineticsSpeciesIndex(sp.first)];
+                }
+                if (rev) {
+                    for (const auto& sp : r->reactants) {
+                        size_t k = kineticsSpeciesIndex(sp.first);
+                        if (!active[k]) {
+                            active[k] = true;
+                            changed = true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return active;
+}
+
+std::unique_ptr<Kinetics> Kinetics::reducedMechanism(
+    const std::vector<ThermoPhase*>& phases,
+    const std::vector<std::string>& seeds)
+{
+    if (phases.size() != nPhases()) {
+        throw CanteraError("Kinetics::reducedMechanism",
+            "Expected {} phases, but got {}.", nPhases(), phases.size());
+    }
+    std::vector<bool> active = reachableSpecies(seeds);
+
+    std::unique_ptr<Kinetics> kin(
+        KineticsFactory::factory()->newKinetics(kineticsType()));
+    kin->skipUndeclaredSpecies(m_skipUndeclaredSpecies);
+    kin->skipUndeclaredThirdBodies(m_skipUndeclaredThirdBodies);
+    for (size_t n = 0; n < phases.size(); n++) {
+        if (phases[n]->name() != thermo(n).name()
+            || phases[n]->nSpecies() != thermo(n).nSpecies()) {
+            throw CanteraError("Kinetics::reducedMechanism",
+                "Phase '{}' is not a clone of phase '{}' of this object.",
+                phases[n]->name(), thermo(n).name());
+        }
+        kin->addPhase(*phases[n]);
+    }
+    kin->init();
+
+    // Keep a reaction only if all of its participants are reachable; the
+    // rate of progress of any other reaction is identically zero. The
+    // Reaction objects are shared rather than copied, as in threadClone().
+    size_t kept = 0;
+    for (size_t i = 0; i < nReactions(); i++) {
+        const auto& r = m_reactions[i];
+        bool keep = true;
+        for (const auto& sp : r->reactants) {
+            keep = keep && active[kineticsSpeciesIndex(sp.first)];
+        }
+        for (const auto& sp : r->products) {
+            keep = keep && active[kineticsSpeciesIndex(sp.first)];
+        }
+        if (!keep) {
+            continue;
+        }
+        kin->addReaction(r);
+        if (m_perturb[i] != 1.0) {
+            kin->setMultiplier(kept, m_perturb[i]);
+        }
+        kept++;
+    }
+    return kin;
+}
+
+void Kinetics::getNetProductionRatesBatch(size_t nStates, const doublereal* T,
+                                          const doublereal* P,
+                                          const doublereal* Y,
+                                          doublereal* wdot)
+{
+    if (nPhases() != 1) {
+        throw CanteraError("Kinetics::getNetProductionRatesBatch",
+            "Not implemented for kinetics managers with multiple phases.");
+    }
+    ThermoPhase& ph = thermo();
+    vector_fp state;
+    ph.saveState(state);
+    for (size_t n = 0; n < nStates; n++) {
+        ph.setState_TPY(T[n], P[n], Y + n*m_kk);
+        getNetProductionRates(wdot + n*m_kk);
+    }
+    ph.restoreState(state);
+}
+
 void Kinetics::addPhase(ThermoPhase& thermo)
 {
     // the phase with lowest dimensionality is assumed to be the
@@ -473,6 +711,37 @@ AnyMap Kinetics::parameters()
     return out;
 }
 
+AnyMap Kinetics::statistics()
+{
+    AnyMap stats;
+    stats["type"] = kineticsType();
+    stats["reactions"] = static_cast<long int>(nReactions());
+    stats["species"] = static_cast<long int>(nTotalSpecies());
+    return stats;
+}
+
+AnyMap Kinetics::memoryReport() const
+{
+    AnyMap report;
+    report["type"] = kineticsType();
+    report["n-reactions"] = static_cast<long int>(nReactions());
+    report["rop-scratch-bytes"] = static_cast<long int>(
+        vectorBytes(m_perturb) + vectorBytes(m_rfn) + vectorBytes(m_rkcn)
+        + vectorBytes(m_ropf) + vectorBytes(m_ropr) + vectorBytes(m_ropnet)
+        + vectorBytes(m_dH));
+
+    // Reaction objects reached through more than one shared_ptr are shared
+    // with other kinetics managers and cost nothing extra per instance
+    size_t shared = 0;
+    for (const auto& rxn : m_reactions) {
+        if (rxn.use_count() > 1) {
+            shared++;
+        }
+    }
+    report["shared-reaction-objects"] = static_cast<long int>(shared);
+    return report;
+}
+
 void Kinetics::resizeSpecies()
 {
     m_kk = 0;
@@ -564,6 +833,62 @@ bool Kinetics::addReaction(shared_ptr<Reaction> r)
     return true;
 }
 
+void Kinetics::addReactions(const std::vector<shared_ptr<Reaction>>& rxns)
+{
+    std::vector<size_t> order(rxns.size());
+    for (size_t i = 0; i < rxns.size(); i++) {
+        order[i] = i;
+    }
+    if (m_groupByType) {
+        // Stable sort on (type, reversibility): reactions of the same kind
+        // land in one contiguous index range, and input order is preserved
+        // within each range
+        std::stable_sort(order.begin(), order.end(),
+            [&rxns](size_t a, size_t b) {
+                std::string ta = rxns[a]->type();
+                std::string tb = rxns[b]->type();
+                if (ta != tb) {
+                    return ta < tb;
+                }
+                return rxns[a]->reversible && !rxns[b]->reversible;
+            });
+    }
+
+    size_t offset = nReactions();
+    std::string errors;
+    for (size_t i : order) {
+        try {
+            if (addReaction(rxns[i]) && m_groupByType) {
+                m_inputOrder.push_back(offset + i);
+            }
+        } catch (CanteraError& err) {
+            errors += err.what();
+        }
+    }
+    if (!errors.empty()) {
+        throw CanteraError("Kinetics::addReactions", "{}", errors);
+    }
+}
+
+void Kinetics::setGroupReactionsByType(bool yes)
+{
+    if (nReactions() > 0) {
+        throw CanteraError("Kinetics::setGroupReactionsByType",
+            "Cannot change the reaction ordering after reactions have been "
+            "added.");
+    }
+    m_groupByType = yes;
+}
+
+size_t Kinetics::inputFileIndex(size_t i) const
+{
+    checkReactionIndex(i);
+    if (m_inputOrder.empty()) {
+        return i;
+    }
+    return m_inputOrder[i];
+}
+
 void Kinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
 {
     checkReactionIndex(i);
@@ -589,6 +914,21 @@ void Kinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
     invalidateCache();
 }
 
+void Kinetics::beginRateUpdate()
+{
+    throw NotImplementedError("Kinetics::beginRateUpdate");
+}
+
+void Kinetics::setRateParameters(size_t i, double A, double b, double Ta)
+{
+    throw NotImplementedError("Kinetics::setRateParameters");
+}
+
+void Kinetics::commitRateUpdate()
+{
+    throw NotImplementedError("Kinetics::commitRateUpdate");
+}
+
 shared_ptr<Reaction> Kinetics::reaction(size_t i)
 {
     checkReactionIndex(i);
@@ -0,0 +1,184 @@
+/**
+ *  @file KineticsCodegen.cpp Generation of mechanism-specialized kinetics
+ *      source code.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/KineticsCodegen.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/kinetics/Reaction.h"
+
+#include <ostream>
+
+namespace Cantera
+{
+
+namespace {
+
+//! Format a double as a C++ literal that round-trips exactly
+std::string lit(double x)
+{
+    return fmt::format("{:.17g}", x);
+}
+
+//! Emit the expression for one Arrhenius rate constant, simplified for
+//! vanishing temperature exponent or activation energy
+std::string arrheniusExpr(const Arrhenius& rate)
+{
+    double A = rate.preExponentialFactor();
+    double b = rate.temperatureExponent();
+    double E = rate.activationEnergy_R();
+    if (b == 0.0 && E == 0.0) {
+        return lit(A);
+    } else if (b == 0.0) {
+        return fmt::format("{} * exp(-{} * rT)", lit(A), lit(E));
+    } else if (E == 0.0) {
+        return fmt::format("{} * exp({} * logT)", lit(A), lit(b));
+    }
+    return fmt::format("{} * exp({} * logT - {} * rT)", lit(A), lit(b),
+                       lit(E));
+}
+
+}
+
+void writeSpecializedKinetics(GasKinetics& kin, const std::string& className,
+                              std::ostream& out)
+{
+    size_t nRxn = kin.nReactions();
+
+    // collect the reactions whose rate constants can be unrolled; these are
+    // exactly the ones the generic path evaluates through the plain
+    // Arrhenius rate-coefficient manager
+    std::vector<std::pair<size_t, const Arrhenius*>> unrolled;
+    for (size_t i = 0; i < nRxn; i++) {
+        shared_ptr<Reaction> r = kin.reaction(i);
+        if (r->type() != "elementary" && r->type() != "three-body") {
+            continue;
+        }
+        auto* er = dynamic_cast<ElementaryReaction*>(r.get());
+        if (!er) {
+            throw CanteraError("writeSpecializedKinetics",
+                "Reaction {} has type '{}' but is not an "
+                "ElementaryReaction", i, r->type());
+        }
+        unrolled.emplace_back(i, &er->rate);
+    }
+
+    out << "// " << className << ".cpp -- specialized kinetics generated by\n"
+        << "// Cantera::writeSpecializedKinetics() for a mechanism with "
+        << nRxn << " reactions.\n"
+        << "//\n"
+        << "// Build this file into a shared library linked against Cantera"
+           " and load it\n"
+        << "// into the application; the static registration at the end"
+           " makes the class\n"
+        << "// available as newKinetics(phases, \"" << className << "\")."
+           " The mechanism input\n"
+        << "// file is loaded as usual; only the rate-constant evaluation"
+           " is specialized.\n"
+        << "\n"
+        << "#include \"cantera/kinetics/GasKinetics.h\"\n"
+        << "#include \"cantera/kinetics/KineticsFactory.h\"\n"
+        << "#include \"cantera/thermo/ThermoPhase.h\"\n"
+        << "\n"
+        << "#include <cmath>\n"
+        << "\n"
+        << "namespace Cantera\n"
+        << "{\n"
+        << "\n"
+        << "class " << className << " : public GasKinetics\n"
+        << "{\n"
+        << "public:\n"
+        << "    " << className << "() {}\n"
+        << "\n"
+        << "    virtual std::string kineticsType() const {\n"
+        << "        return \"" << className << "\";\n"
+        << "    }\n"
+        << "\n"
+        << "    virtual void update_rates_T();\n"
+        << "};\n"
+        << "\n"
+        << "void " << className << "::update_rates_T()\n"
+        << "{\n"
+        << "    double T = thermo().temperature();\n"
+        << "    double P = thermo().pressure();\n"
+        << "    m_logStandConc = log(thermo().standardConcentration());\n"
+        << "    double logT = log(T);\n"
+        << "\n"
+        << "    if (T != m_temp) {\n"
+        << "        if (m_rfn.size() < " << nRxn << ") {\n"
+        << "            throw CanteraError(\"" << className
+        << "::update_rates_T\",\n"
+        << "                \"mechanism has {} reactions; this specialization"
+           " was generated\"\n"
+        << "                \" for " << nRxn << "\", m_rfn.size());\n"
+        << "        }\n"
+        << "        double rT = 1.0 / T;\n"
+        << "        (void) rT;\n"
+        << "\n"
+        << "        // unrolled elementary and three-body rate constants\n";
+    for (const auto& u : unrolled) {
+        out << "        m_rfn[" << u.first << "] = "
+            << arrheniusExpr(*u.second) << ";\n";
+    }
+    out << "\n"
+        << "        if (!m_rfn_low.empty()) {\n"
+        << "            m_falloff_low_rates.update(T, logT,"
+           " m_rfn_low.data());\n"
+        << "            m_falloff_high_rates.update(T, logT,"
+           " m_rfn_high.data());\n"
+        << "        }\n"
+        << "        if (!falloff_work.empty()) {\n"
+        << "            m_falloffn.updateTemp(T, falloff_work.data());\n"
+        << "        }\n"
+        << "        updateKc();\n"
+        << "        m_ROP_ok = false;\n"
+        << "        m_stage_ok = false;\n"
+        << "        if (m_blowersmasel_rates.nReactions()) {\n"
+        << "            thermo().getPartialMolarEnthalpies(m_grt.data());\n"
+        << "            getReactionDelta(m_grt.data(), m_dH.data());\n"
+        << "            m_blowersmasel_rates.updateBlowersMasel(T, logT,"
+           " m_rfn.data(), m_dH.data());\n"
+        << "        }\n"
+        << "    }\n"
+        << "\n"
+        << "    if (T != m_temp || P != m_pres) {\n"
+        << "        for (auto& rates : m_bulk_rates) {\n"
+        << "            rates->update(thermo());\n"
+        << "            rates->getRateConstants(thermo(), m_rfn.data());\n"
+        << "        }\n"
+        << "        if (m_plog_rates.nReactions()) {\n"
+        << "            m_plog_rates.update(T, logT, m_rfn.data());\n"
+        << "            m_ROP_ok = false;\n"
+        << "            m_stage_ok = false;\n"
+        << "        }\n"
+        << "        if (m_cheb_rates.nReactions()) {\n"
+        << "            m_cheb_rates.update(T, logT, m_rfn.data());\n"
+        << "            m_ROP_ok = false;\n"
+        << "            m_stage_ok = false;\n"
+        << "        }\n"
+        << "    }\n"
+        << "    m_pres = P;\n"
+        << "    m_temp = T;\n"
+        << "}\n"
+        << "\n"
+        << "namespace\n"
+        << "{\n"
+        << "// register the specialization when this library is loaded\n"
+        << "class " << className << "_Registration\n"
+        << "{\n"
+        << "public:\n"
+        << "    " << className << "_Registration() {\n"
+        << "        KineticsFactory::factory()->reg(\"" << className
+        << "\",\n"
+        << "            []() { return new " << className << "(); });\n"
+        << "    }\n"
+        << "} s_" << className << "_registration;\n"
+        << "}\n"
+        << "\n"
+        << "}\n";
+}
+
+}
@@ -82,9 +82,10 @@ unique_ptr<Kinetics> newKinetics(std::vector<ThermoPhase*>& phases,
     }
 
     if (extension == "yml" || extension == "yaml") {
-        AnyMap root = AnyMap::fromYamlFile(filename);
-        AnyMap& phaseNode = root["phases"].getMapWhere("name", phase_name);
-        return newKinetics(phases, phaseNode, root);
+        auto root = AnyMap::fromYamlFileShared(filename);
+        const AnyMap& phaseNode = root->at("phases").getMapWhere("name",
+                                                                 phase_name);
+        return newKinetics(phases, phaseNode, *root);
     } else {
         XML_Node* root = get_XML_File(filename);
         XML_Node* xphase = get_XML_NameID("phase", "#"+phase_name, root);
@@ -101,6 +102,8 @@ void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode
 {
     kin.skipUndeclaredThirdBodies(
         phaseNode.getBool("skip-undeclared-third-bodies", false));
+    kin.setGroupReactionsByType(
+        phaseNode.getBool("group-reactions-by-type", false));
 
     // Find sections containing reactions to add
     vector<string> sections, rules;
@@ -171,24 +174,36 @@ void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode
             // specified section is in a different file
             string fileName (sections[i].begin(), slash.begin());
             string node(slash.end(), sections[i].end());
-            AnyMap reactions = AnyMap::fromYamlFile(fileName,
+            auto reactions = AnyMap::fromYamlFileShared(fileName,
                 rootNode.getString("__file__", ""));
-            for (const auto& R : reactions[node].asVector<AnyMap>()) {
+            std::vector<shared_ptr<Reaction>> built;
+            for (const auto& R : reactions->at(node).asVector<AnyMap>()) {
                 try {
-                    kin.addReaction(newReaction(R, kin));
+                    built.push_back(newReaction(R, kin));
                 } catch (CanteraError& err) {
                     format_to(add_rxn_err, "{}", err.what());
                 }
             }
+            try {
+                kin.addReactions(built);
+            } catch (CanteraError& err) {
+                format_to(add_rxn_err, "{}", err.what());
+            }
         } else {
             // specified section is in the current file
+            std::vector<shared_ptr<Reaction>> built;
             for (const auto& R : rootNode.at(sections[i]).asVector<AnyMap>()) {
                 try {
-                    kin.addReaction(newReaction(R, kin));
+                    built.push_back(newReaction(R, kin));
                 } catch (CanteraError& err) {
                     format_to(add_rxn_err, "{}", err.what());
                 }
             }
+            try {
+                kin.addReactions(built);
+            } catch (CanteraError& err) {
+                format_to(add_rxn_err, "{}", err.what());
+            }
         }
     }
 
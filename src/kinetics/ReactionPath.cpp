@@ -27,6 +27,19 @@ void SpeciesNode::addPath(Path* path)
     }
 }
 
+void SpeciesNode::updateFlows()
+{
+    m_in = 0.0;
+    m_out = 0.0;
+    for (size_t i = 0; i < m_paths.size(); i++) {
+        if (m_paths[i]->begin() == this) {
+            m_out += m_paths[i]->flow();
+        } else {
+            m_in += m_paths[i]->flow();
+        }
+    }
+}
+
 void SpeciesNode::printPaths()
 {
     for (size_t i = 0; i < m_paths.size(); i++) {
@@ -398,6 +411,19 @@ void ReactionPathDiagram::linkNodes(size_t k1, size_t k2, size_t rxn,
     m_flxmax = std::max(ff->flow(), m_flxmax);
 }
 
+void ReactionPathDiagram::updateFlows()
+{
+    for (const auto& node : m_nodes) {
+        if (node.second) {
+            node.second->updateFlows();
+        }
+    }
+    m_flxmax = 0.0;
+    for (size_t n = 0; n < m_pathlist.size(); n++) {
+        m_flxmax = std::max(m_pathlist[n]->flow(), m_flxmax);
+    }
+}
+
 std::vector<size_t> ReactionPathDiagram::species()
 {
     return m_speciesNumber;
@@ -813,4 +839,116 @@ int ReactionPathBuilder::build(Kinetics& s, const string& element,
     return 1;
 }
 
+int ReactionPathBuilder::initIncremental(Kinetics& s, const string& element,
+                                         ReactionPathDiagram& r)
+{
+    size_t m = m_enamemap[element]-1;
+    r.element = element;
+    if (m == npos) {
+        return -1;
+    }
+    m_fluxTable.clear();
+    m_incrDiagram = &r;
+
+    // species explicitly excluded from the diagram
+    vector_int status(s.nTotalSpecies(), 0);
+    for (const auto& name : r.excluded()) {
+        status[s.kineticsSpeciesIndex(name)] = -1;
+    }
+
+    for (size_t i = 0; i < m_nr; i++) {
+        // loop over reactions involving element m
+        if (m_elatoms(m, i) <= 0) {
+            continue;
+        }
+        size_t nr = m_reac[i].size();
+        size_t np = m_prod[i].size();
+
+        for (size_t kr = 0; kr < nr; kr++) {
+            size_t kkr = m_reac[i][kr];
+            string fwdlabel = reactionLabel(i, kr, nr, m_reac[i], s);
+
+            for (size_t kp = 0; kp < np; kp++) {
+                size_t kkp = m_prod[i][kp];
+                string revlabel = "";
+                for (size_t j = 0; j < np; j++) {
+                    if (j != kp) {
+                        revlabel += " + "+ s.kineticsSpeciesName(m_prod[i][j]);
+                    }
+                }
+                if (s.reactionTypeStr(i) == "three-body") {
+                    revlabel += " + M ";
+                } else if (s.reactionTypeStr(i) == "falloff") {
+                    revlabel += " (+ M)";
+                }
+
+                // pairs are included on the same conditions as in build();
+                // the atom-transfer count f is determined exactly as there,
+                // except that reactions with an indeterminate partitioning
+                // are skipped silently
+                if (kkr == kkp || m_atoms(kkr,m) <= 0 || m_atoms(kkp,m) <= 0
+                        || status[kkr] < 0 || status[kkp] < 0) {
+                    continue;
+                }
+                double f;
+                if ((m_atoms(kkp,m) < m_elatoms(m, i)) &&
+                        (m_atoms(kkr,m) < m_elatoms(m, i))) {
+                    map<size_t, map<size_t, Group> >& g = m_transfer[i];
+                    if (g.empty() || !g[kr][kp]) {
+                        f = 0.0;
+                    } else {
+                        f = g[kr][kp].nAtoms(m);
+                    }
+                } else {
+                    f = m_atoms(kkp,m) * m_atoms(kkr,m) / m_elatoms(m, i);
+                }
+                if (f == 0.0) {
+                    // this pair never carries any flux
+                    continue;
+                }
+
+                if (!r.hasNode(kkr)) {
+                    r.addNode(kkr, s.kineticsSpeciesName(kkr), m_x[kkr]);
+                }
+                if (!r.hasNode(kkp)) {
+                    r.addNode(kkp, s.kineticsSpeciesName(kkp), m_x[kkp]);
+                }
+                r.linkNodes(kkr, kkp, int(i), 0.0, fwdlabel);
+                r.linkNodes(kkp, kkr, -int(i), 0.0, revlabel);
+
+                FluxContribution c;
+                c.rxn = i;
+                c.f = f;
+                c.fwd = r.path(kkr, kkp);
+                c.rev = r.path(kkp, kkr);
+                c.fwdlabel = fwdlabel; // shared by every kp of this reactant
+                c.revlabel = std::move(revlabel);
+                m_fluxTable.push_back(std::move(c));
+            }
+        }
+    }
+    return 1;
+}
+
+void ReactionPathBuilder::updateFluxes(Kinetics& s)
+{
+    if (!m_incrDiagram) {
+        throw CanteraError("ReactionPathBuilder::updateFluxes",
+                           "initIncremental has not been called");
+    }
+    s.getFwdRatesOfProgress(m_ropf.data());
+    s.getRevRatesOfProgress(m_ropr.data());
+
+    ReactionPathDiagram& r = *m_incrDiagram;
+    for (size_t n = 0; n < r.nPaths(); n++) {
+        r.path(n)->resetFlows();
+    }
+    for (const auto& c : m_fluxTable) {
+        c.fwd->addReaction(c.rxn, m_ropf[c.rxn] * c.f, c.fwdlabel);
+        c.rev->addReaction(size_t(-int(c.rxn)), m_ropr[c.rxn] * c.f,
+                           c.revlabel);
+    }
+    r.updateFlows();
+}
+
 }
@@ -166,6 +166,42 @@ Plog::Plog(const std::multimap<double, Arrhenius>& rates)
     // Duplicate the first and last groups to handle P < P_0 and P > P_N
     pressures_.insert({-1000.0, pressures_.begin()->second});
     pressures_.insert({1000.0, pressures_.rbegin()->second});
+
+    buildLookup();
+}
+
+void Plog::buildLookup()
+{
+    logPs_.clear();
+    groups_.clear();
+    for (const auto& p : pressures_) {
+        logPs_.push_back(p.first);
+        groups_.push_back(p.second);
+    }
+
+    // Index over the tabulated range only; pressures outside it are handled
+    // by the constant-extrapolation intervals next to the sentinels. A few
+    // buckets per interval keep the forward search in update_C() short even
+    // when the pressure groups are unevenly spaced.
+    lookupBase_ = logPs_[1];
+    double span = logPs_[logPs_.size() - 2] - lookupBase_;
+    if (logPs_.size() <= 3 || span <= 0.0) {
+        // single pressure group; every query hits an extrapolation interval
+        lookupScale_ = 0.0;
+        lookup_.assign(1, 1);
+        return;
+    }
+    size_t nBuckets = 4 * (logPs_.size() - 3);
+    lookupScale_ = nBuckets / span;
+    lookup_.resize(nBuckets);
+    size_t i = 1;
+    for (size_t j = 0; j < nBuckets; j++) {
+        double x = lookupBase_ + j / lookupScale_;
+        while (x >= logPs_[i+1]) {
+            i++;
+        }
+        lookup_[j] = i;
+    }
 }
 
 void Plog::validate(const std::string& equation)
@@ -220,6 +256,7 @@ ChebyshevRate::ChebyshevRate(double Tmin, double Tmax, double Pmin, double Pmax,
     , nT_(coeffs.nRows())
     , chebCoeffs_(coeffs.nColumns() * coeffs.nRows(), 0.0)
     , dotProd_(coeffs.nRows())
+    , logPlast_(-BigNumber)
 {
     double logPmin = std::log10(Pmin);
     double logPmax = std::log10(Pmax);
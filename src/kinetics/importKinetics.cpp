@@ -21,13 +21,78 @@
 #include "cantera/base/ctml.h"
 #include "cantera/base/yaml.h"
 
+#include <cstdlib>
 #include <cstring>
+#include <mutex>
+#include <thread>
 
 using namespace std;
 
 namespace Cantera
 {
 
+namespace {
+
+//! Number of worker threads to use for parsing reaction entries: the
+//! hardware concurrency by default, overridden by the
+//! CANTERA_IMPORT_THREADS environment variable, and never more than one
+//! thread per reaction.
+size_t importThreadCount(size_t nTasks)
+{
+    size_t nThreads = std::thread::hardware_concurrency();
+    const char* env = getenv("CANTERA_IMPORT_THREADS");
+    if (env != nullptr) {
+        nThreads = std::max(atoi(env), 1);
+    }
+    return std::min(std::max<size_t>(nThreads, 1), std::max<size_t>(nTasks, 1));
+}
+
+//! Build Reaction objects for the given reaction entries. Parsing an entry
+//! only reads its own XML subtree, so the entries are split into one
+//! contiguous chunk per worker thread; the first exception thrown by any
+//! worker is rethrown on the calling thread.
+void parseReactions(const std::vector<XML_Node*>& nodes,
+                    std::vector<shared_ptr<Reaction>>& built)
+{
+    built.resize(nodes.size());
+    size_t nThreads = importThreadCount(nodes.size());
+    if (nThreads < 2 || nodes.size() < 2) {
+        for (size_t i = 0; i < nodes.size(); i++) {
+            built[i] = newReaction(*nodes[i]);
+        }
+        return;
+    }
+    std::vector<std::thread> threads;
+    std::mutex errMutex;
+    std::exception_ptr firstError;
+    size_t chunkSize = (nodes.size() + nThreads - 1) / nThreads;
+    for (size_t n = 0; n < nThreads; n++) {
+        size_t begin = n * chunkSize;
+        size_t end = std::min(nodes.size(), begin + chunkSize);
+        threads.emplace_back([&nodes, &built, &errMutex, &firstError,
+                              begin, end]() {
+            try {
+                for (size_t i = begin; i < end; i++) {
+                    built[i] = newReaction(*nodes[i]);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errMutex);
+                if (!firstError) {
+                    firstError = std::current_exception();
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+}
+
+}
+
 bool installReactionArrays(const XML_Node& p, Kinetics& kin,
                            std::string default_phase, bool check_for_duplicates)
 {
@@ -82,9 +147,14 @@ bool installReactionArrays(const XML_Node& p, Kinetics& kin,
         if (incl.empty()) {
             for (size_t i = 0; i < allrxns.size(); i++) {
                 checkElectrochemReaction(p,kin,*allrxns[i]);
-                kin.addReaction(newReaction(*allrxns[i]));
-                ++itot;
             }
+            // Parsing the entries is independent work and is done on a
+            // thread pool; installation mutates the Kinetics object and
+            // stays serial, preserving the reaction order.
+            std::vector<shared_ptr<Reaction>> built;
+            parseReactions(allrxns, built);
+            kin.addReactions(built);
+            itot += built.size();
         } else {
             for (size_t nii = 0; nii < incl.size(); nii++) {
                 const XML_Node& ii = *incl[nii];
@@ -100,6 +170,7 @@ bool installReactionArrays(const XML_Node& p, Kinetics& kin,
                     }
                 }
 
+                std::vector<XML_Node*> selected;
                 for (size_t i = 0; i < allrxns.size(); i++) {
                     const XML_Node* r = allrxns[i];
                     string rxid;
@@ -114,11 +185,14 @@ bool installReactionArrays(const XML_Node& p, Kinetics& kin,
                         // has surprising results.
                         if ((rxid >= imin) && (rxid <= imax)) {
                             checkElectrochemReaction(p,kin,*r);
-                            kin.addReaction(newReaction(*r));
-                            ++itot;
+                            selected.push_back(allrxns[i]);
                         }
                     }
                 }
+                std::vector<shared_ptr<Reaction>> built;
+                parseReactions(selected, built);
+                kin.addReactions(built);
+                itot += built.size();
             }
         }
     }
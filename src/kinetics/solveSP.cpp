@@ -33,6 +33,9 @@ solveSP::solveSP(ImplicitSurfChem* surfChemPtr, int bulkFunc) :
     m_rtol(1.0E-4),
     m_maxstep(1000),
     m_maxTotSpecies(0),
+    m_jacAge(0),
+    m_jacMaxAge(5),
+    m_jacInvDt(0.0),
     m_ioflag(0)
 {
     m_numSurfPhases = 0;
@@ -108,6 +111,7 @@ solveSP::solveSP(ImplicitSurfChem* surfChemPtr, int bulkFunc) :
     m_wtSpecies.resize(dim1, 0.0);
     m_resid.resize(dim1, 0.0);
     m_Jac.resize(dim1, dim1, 0.0);
+    m_JacSave.resize(dim1, dim1, 0.0);
 }
 
 int solveSP::solveSurfProb(int ifunc, doublereal time_scale, doublereal TKelvin,
@@ -205,10 +209,44 @@ int solveSP::solveSurfProb(int ifunc, doublereal time_scale, doublereal TKelvin,
         }
         deltaT = 1.0/inv_t;
 
-        // Call the routine to numerically evaluation the Jacobian and residual
-        // for the current iteration.
-        resjac_eval(m_Jac, m_resid.data(), m_CSolnSP.data(),
-                    m_CSolnSPOld.data(), do_time, deltaT);
+        // Call the routine to numerically evaluate the Jacobian and residual
+        // for the current iteration. The Jacobian is lagged: the
+        // finite-difference evaluation costs m_neq extra residual
+        // evaluations, so the previous Jacobian is reused (with its
+        // pseudo-transient diagonal shifted to the current time step) until
+        // it ages out, the damping coefficient indicates slow convergence,
+        // or the largest-species rows are about to be reassigned.
+        bool fresh_jac = (iter == 1 || m_jacAge >= m_jacMaxAge ||
+                          damp < 1.0 || iter % 5 == 4 ||
+                          m_numBulkPhasesSS > 0);
+        if (fresh_jac) {
+            resjac_eval(m_Jac, m_resid.data(), m_CSolnSP.data(),
+                        m_CSolnSPOld.data(), do_time, deltaT);
+            m_JacSave = m_Jac;
+            m_jacInvDt = (do_time) ? inv_t : 0.0;
+            m_jacAge = 0;
+        } else {
+            fun_eval(m_resid.data(), m_CSolnSP.data(), m_CSolnSPOld.data(),
+                     do_time, deltaT);
+            // The linear solve factored m_Jac in place; restore the saved
+            // values and move the time-derivative contribution on the
+            // diagonal to the current value of 1/deltaT.
+            m_Jac = m_JacSave;
+            doublereal shift = ((do_time) ? inv_t : 0.0) - m_jacInvDt;
+            if (shift != 0.0) {
+                size_t kindexSP = 0;
+                for (size_t isp = 0; isp < m_numSurfPhases; isp++) {
+                    size_t kspecial = kindexSP + m_spSurfLarge[isp];
+                    for (size_t k = 0; k < m_nSpeciesSurfPhase[isp];
+                            k++, kindexSP++) {
+                        if (kindexSP != kspecial) {
+                            m_Jac(kindexSP, kindexSP) += shift;
+                        }
+                    }
+                }
+            }
+            m_jacAge++;
+        }
 
         // Calculate the weights. Make sure the calculation is carried out on
         // the first iteration.
@@ -0,0 +1,70 @@
+/**
+ *  @file vec_exp.h Vectorized exponential shared by the batched kinetics
+ *      evaluators. Internal header; not installed.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_VEC_EXP_H
+#define CT_VEC_EXP_H
+
+#include "cantera/base/config.h"
+
+#if CT_VECTORIZE_RATES && defined(__AVX2__)
+
+#include <immintrin.h>
+
+namespace Cantera
+{
+
+//! Vectorized double-precision exponential for four lanes, based on the
+//! rational approximation used in the Cephes math library: the argument is
+//! reduced to r in [-ln(2)/2, ln(2)/2] with exp(x) = 2^n exp(r), exp(r) is
+//! evaluated as 1 + 2r P(r^2) / (Q(r^2) - r P(r^2)), and the power of two is
+//! applied by adding n directly to the exponent bits.
+inline __m256d vec_exp(__m256d x)
+{
+    const __m256d log2e = _mm256_set1_pd(1.4426950408889634074);
+    const __m256d c1 = _mm256_set1_pd(6.93145751953125e-1);
+    const __m256d c2 = _mm256_set1_pd(1.42860682030941723212e-6);
+    const __m256d p0 = _mm256_set1_pd(1.26177193074810590878e-4);
+    const __m256d p1 = _mm256_set1_pd(3.02994407707441961300e-2);
+    const __m256d p2 = _mm256_set1_pd(9.99999999999999999910e-1);
+    const __m256d q0 = _mm256_set1_pd(3.00198505138664455042e-6);
+    const __m256d q1 = _mm256_set1_pd(2.52448340349684104192e-3);
+    const __m256d q2 = _mm256_set1_pd(2.27265548208155028766e-1);
+    const __m256d q3 = _mm256_set1_pd(2.00000000000000000005e0);
+    const __m256d one = _mm256_set1_pd(1.0);
+
+    // Clamp to the range where the result is finite and non-denormal; the
+    // limits match those used for scalar exp() overflow/underflow.
+    x = _mm256_min_pd(x, _mm256_set1_pd(708.0));
+    x = _mm256_max_pd(x, _mm256_set1_pd(-708.0));
+
+    __m256d n = _mm256_round_pd(_mm256_mul_pd(x, log2e),
+                                _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d r = _mm256_fnmadd_pd(n, c1, x);
+    r = _mm256_fnmadd_pd(n, c2, r);
+
+    __m256d r2 = _mm256_mul_pd(r, r);
+    __m256d P = _mm256_fmadd_pd(_mm256_fmadd_pd(p0, r2, p1), r2, p2);
+    P = _mm256_mul_pd(P, r);
+    __m256d Q = _mm256_fmadd_pd(
+        _mm256_fmadd_pd(_mm256_fmadd_pd(q0, r2, q1), r2, q2), r2, q3);
+    __m256d er = _mm256_div_pd(P, _mm256_sub_pd(Q, P));
+    er = _mm256_fmadd_pd(er, _mm256_set1_pd(2.0), one);
+
+    // multiply by 2^n by shifting n into the exponent field
+    __m128i ni = _mm256_cvtpd_epi32(n);
+    __m256i nl = _mm256_cvtepi32_epi64(ni);
+    nl = _mm256_slli_epi64(nl, 52);
+    return _mm256_castsi256_pd(
+        _mm256_add_epi64(_mm256_castpd_si256(er), nl));
+}
+
+}
+
+#endif
+
+#endif
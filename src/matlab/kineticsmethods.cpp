@@ -38,6 +38,29 @@ void kineticsmethods(int nlhs, mxArray* plhs[],
         double* h = mxGetPr(plhs[0]);
         *h = vv;
         return;
+    } else if (job == 25) {
+        // batched net production rates over an array of states; looping
+        // here avoids one mex crossing per state in parameter sweeps
+        checkNArgs(6, nrhs);
+        kin = getInt(prhs[1]);
+        size_t nsp = kin_nSpecies(kin);
+        mwSize nStates = mxGetNumberOfElements(prhs[3]);
+        if (mxGetNumberOfElements(prhs[4]) != nStates ||
+                mxGetM(prhs[5]) != (mwSize) nsp ||
+                mxGetN(prhs[5]) != nStates) {
+            mexErrMsgTxt("state arrays have inconsistent sizes.");
+        }
+        double* T = mxGetPr(prhs[3]);
+        double* P = mxGetPr(prhs[4]);
+        double* Y = mxGetPr(prhs[5]);
+        plhs[0] = mxCreateNumericMatrix((mwSize) nsp, nStates,
+                                        mxDOUBLE_CLASS, mxREAL);
+        double* wdot = mxGetPr(plhs[0]);
+        if (kin_getNetProductionRatesBatch(kin, (size_t) nStates,
+                                           T, P, Y, wdot) < 0) {
+            mexErrMsgTxt("error computing batched production rates");
+        }
+        return;
     } else if (job > 0) {
         // methods
         int isp = 1;
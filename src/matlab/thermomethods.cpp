@@ -260,6 +260,42 @@ static void thermoget(int nlhs, mxArray* plhs[],
             mexErrMsgTxt("unknown attribute");
             return;
         }
+    } else if (job == 52) {
+        // batched equilibrate over an array of states; looping here avoids
+        // one mex crossing per state in parameter sweeps
+        if (nrhs != 7) {
+            mexErrMsgTxt("Wrong number of arguments.");
+        }
+        size_t nsp = thermo_nSpecies(n);
+        char* xy = getString(prhs[3]);
+        mwSize nStates = mxGetNumberOfElements(prhs[4]);
+        if (mxGetNumberOfElements(prhs[5]) != nStates ||
+                mxGetM(prhs[6]) != (mwSize) nsp ||
+                mxGetN(prhs[6]) != nStates) {
+            mexErrMsgTxt("state arrays have inconsistent sizes.");
+        }
+        double* T = mxGetPr(prhs[4]);
+        double* P = mxGetPr(prhs[5]);
+        double* Y = mxGetPr(prhs[6]);
+        // one column per state: equilibrium temperature in the first row,
+        // equilibrium mass fractions below it
+        plhs[0] = mxCreateNumericMatrix((mwSize) (nsp + 1), nStates,
+                                        mxDOUBLE_CLASS, mxREAL);
+        double* h = mxGetPr(plhs[0]);
+        std::vector<double> Teq(nStates);
+        std::vector<double> Yeq(nsp*nStates);
+        int iok = thermo_equilibrateBatch(n, xy, (size_t) nStates, T, P, Y,
+                                          Teq.data(), Yeq.data());
+        if (iok < 0) {
+            reportError();
+        }
+        for (mwSize i = 0; i < nStates; i++) {
+            h[i*(nsp+1)] = Teq[i];
+            for (size_t k = 0; k < nsp; k++) {
+                h[i*(nsp+1) + k + 1] = Yeq[i*nsp + k];
+            }
+        }
+        return;
     } else {
         mexErrMsgTxt("unknown attribute");
     }
@@ -46,6 +46,7 @@ BandMatrix::BandMatrix() :
     m_ku(0),
     m_zero(0.0),
     m_ipiv{new PivData()},
+    m_factorEpoch(0),
     m_info(0)
 {
 }
@@ -61,6 +62,7 @@ BandMatrix::BandMatrix(size_t n, size_t kl, size_t ku, doublereal v)   :
     m_ku(ku),
     m_zero(0.0),
     m_ipiv{new PivData()},
+    m_factorEpoch(0),
     m_info(0)
 {
     data.resize(n*(2*kl + ku + 1));
@@ -84,6 +86,7 @@ BandMatrix::BandMatrix(const BandMatrix& y) :
     m_ku(0),
     m_zero(0.0),
     m_ipiv{new PivData()},
+    m_factorEpoch(y.m_factorEpoch),
     m_info(y.m_info)
 {
     m_n = y.m_n;
@@ -92,6 +95,7 @@ BandMatrix::BandMatrix(const BandMatrix& y) :
     data = y.data;
     ludata = y.ludata;
     m_ipiv->data = y.m_ipiv->data;
+    m_updates = y.m_updates;
     m_colPtrs.resize(m_n);
     m_lu_col_ptrs.resize(m_n);
     size_t ldab = (2 *m_kl + m_ku + 1);
@@ -111,6 +115,8 @@ BandMatrix& BandMatrix::operator=(const BandMatrix& y)
     m_kl = y.m_kl;
     m_ku = y.m_ku;
     m_ipiv->data = y.m_ipiv->data;
+    m_updates = y.m_updates;
+    m_factorEpoch = y.m_factorEpoch;
     data = y.data;
     ludata = y.ludata;
     m_colPtrs.resize(m_n);
@@ -245,6 +251,23 @@ void BandMatrix::leftMult(const doublereal* const b, doublereal* const prod) con
 
 int BandMatrix::factor()
 {
+#if CT_USE_LAPACK
+    if (m_mixed_precision) {
+        // Single-precision copy of the band data; the double data is kept
+        // as-is for the refinement residuals in solveMixed()
+        m_lu32.assign(data.begin(), data.end());
+        ct_sgbtrf(nRows(), nColumns(), nSubDiagonals(), nSuperDiagonals(),
+                  m_lu32.data(), ldim(), m_ipiv->data.data(), m_info);
+        if (m_info != 0) {
+            throw Cantera::CanteraError("BandMatrix::factor",
+                "Factorization failed with SGBTRF error code {}.", m_info);
+        }
+        m_updates.clear();
+        m_factorEpoch++;
+        m_factored = true;
+        return m_info;
+    }
+#endif
     ludata = data;
 #if CT_USE_LAPACK
     ct_dgbtrf(nRows(), nColumns(), nSubDiagonals(), nSuperDiagonals(),
@@ -260,14 +283,85 @@ int BandMatrix::factor()
         throw Cantera::CanteraError("BandMatrix::factor",
             "Factorization failed with DGBTRF error code {}.", m_info);
     }
+    // any rank-one corrections are already folded into the data that was
+    // just factored
+    m_updates.clear();
+    m_factorEpoch++;
     m_factored = true;
     return m_info;
 }
 
-int BandMatrix::solve(const doublereal* const b, doublereal* const x)
+int BandMatrix::rankOneUpdate(const doublereal* u, const doublereal* v)
 {
-    copy(b, b + m_n, x);
-    return solve(x);
+    if (!m_factored) {
+        factor();
+    }
+
+    // w solves the previously updated system for u, so that successive
+    // corrections compose. Solved before the update is folded into the band
+    // storage below, so that the mixed-precision refinement (which computes
+    // residuals against the stored data) still sees the matrix it was
+    // factored from.
+    vector_fp w(u, u + m_n);
+    solve(w.data());
+
+    // Fold the update into the band storage so that mult(), oneNorm() and a
+    // later full factor() see the updated matrix. Every nonzero product
+    // element must lie within the bandwidth.
+    for (size_t i = 0; i < m_n; i++) {
+        if (u[i] == 0.0) {
+            continue;
+        }
+        for (size_t j = 0; j < m_n; j++) {
+            if (v[j] == 0.0) {
+                continue;
+            }
+            if (i + m_ku < j || i > j + m_kl) {
+                throw CanteraError("BandMatrix::rankOneUpdate",
+                    "Update element ({},{}) lies outside the bandwidth.",
+                    i, j);
+            }
+            data[index(i,j)] += u[i] * v[j];
+        }
+    }
+    doublereal denom = 1.0;
+    for (size_t i = 0; i < m_n; i++) {
+        denom += v[i] * w[i];
+    }
+    m_factorEpoch++;
+    if (fabs(denom) < 1.0e-12) {
+        // singular capacitance; fall back to a full refactorization of the
+        // updated matrix on the next solve
+        m_updates.clear();
+        m_factored = false;
+        return 1;
+    }
+    m_updates.push_back(RankOneUpdate());
+    m_updates.back().w = std::move(w);
+    m_updates.back().v.assign(v, v + m_n);
+    m_updates.back().denom = denom;
+    return 0;
+}
+
+int BandMatrix::rankUpdate(size_t k, const doublereal* u, const doublereal* v)
+{
+    int info = 0;
+    for (size_t i = 0; i < k; i++) {
+        info = std::max(info, rankOneUpdate(u + i*m_n, v + i*m_n));
+    }
+    return info;
+}
+
+int BandMatrix::solve(const doublereal* const b, doublereal* const x,
+                      size_t nrhs, size_t ldb)
+{
+    if (ldb == 0) {
+        ldb = nColumns();
+    }
+    for (size_t r = 0; r < nrhs; r++) {
+        copy(b + r*ldb, b + r*ldb + m_n, x + r*ldb);
+    }
+    return solve(x, nrhs, ldb);
 }
 
 int BandMatrix::solve(doublereal* b, size_t nrhs, size_t ldb)
@@ -279,15 +373,22 @@ int BandMatrix::solve(doublereal* b, size_t nrhs, size_t ldb)
         ldb = nColumns();
     }
 #if CT_USE_LAPACK
-    ct_dgbtrs(ctlapack::NoTranspose, nColumns(), nSubDiagonals(),
-              nSuperDiagonals(), nrhs, ludata.data(), ldim(),
-              m_ipiv->data.data(), b, ldb, m_info);
+    if (m_mixed_precision) {
+        solveMixed(b, nrhs, ldb);
+    } else {
+        ct_dgbtrs(ctlapack::NoTranspose, nColumns(), nSubDiagonals(),
+                  nSuperDiagonals(), nrhs, ludata.data(), ldim(),
+                  m_ipiv->data.data(), b, ldb, m_info);
+    }
 #else
     long int nu = static_cast<long int>(nSuperDiagonals());
     long int nl = static_cast<long int>(nSubDiagonals());
     long int smu = nu + nl;
     double** a = m_lu_col_ptrs.data();
-    bandGBTRS(a, static_cast<long int>(nColumns()), smu, nl, m_ipiv->data.data(), b);
+    for (size_t r = 0; r < nrhs; r++) {
+        bandGBTRS(a, static_cast<long int>(nColumns()), smu, nl,
+                  m_ipiv->data.data(), b + r*ldb);
+    }
     m_info = 0;
 #endif
 
@@ -295,9 +396,86 @@ int BandMatrix::solve(doublereal* b, size_t nrhs, size_t ldb)
         throw Cantera::CanteraError("BandMatrix::solve",
             "Linear solve failed with DGBTRS error code {}.", m_info);
     }
+
+    // apply the Sherman-Morrison corrections from any rank-one updates
+    for (const auto& upd : m_updates) {
+        for (size_t r = 0; r < nrhs; r++) {
+            doublereal* x = b + r*ldb;
+            doublereal t = 0.0;
+            for (size_t i = 0; i < m_n; i++) {
+                t += upd.v[i] * x[i];
+            }
+            t /= upd.denom;
+            for (size_t i = 0; i < m_n; i++) {
+                x[i] -= upd.w[i] * t;
+            }
+        }
+    }
     return m_info;
 }
 
+void BandMatrix::solveMixed(doublereal* b, size_t nrhs, size_t ldb)
+{
+#if CT_USE_LAPACK
+    m_b32.resize(m_n);
+    m_refine_x.resize(m_n);
+    m_refine_r.resize(m_n);
+    for (size_t r = 0; r < nrhs; r++) {
+        doublereal* rhs = b + r*ldb;
+
+        // initial solution from the single-precision factors
+        for (size_t i = 0; i < m_n; i++) {
+            m_b32[i] = static_cast<float>(rhs[i]);
+        }
+        ct_sgbtrs(ctlapack::NoTranspose, nColumns(), nSubDiagonals(),
+                  nSuperDiagonals(), 1, m_lu32.data(), ldim(),
+                  m_ipiv->data.data(), m_b32.data(), m_n, m_info);
+        if (m_info != 0) {
+            throw Cantera::CanteraError("BandMatrix::solveMixed",
+                "Linear solve failed with SGBTRS error code {}.", m_info);
+        }
+        for (size_t i = 0; i < m_n; i++) {
+            m_refine_x[i] = m_b32[i];
+        }
+
+        // Iterative refinement: residuals are computed against the full
+        // double-precision matrix, and the single-precision factors are
+        // reused to solve for the corrections. Skipped when rank-one
+        // corrections are pending, since those are folded into the matrix
+        // data but applied to the solution only after this routine returns.
+        if (m_updates.empty()) {
+            for (int iter = 0; iter < 5; iter++) {
+                mult(m_refine_x.data(), m_refine_r.data());
+                doublereal rnorm = 0.0, bnorm = 0.0;
+                for (size_t i = 0; i < m_n; i++) {
+                    m_refine_r[i] = rhs[i] - m_refine_r[i];
+                    rnorm = std::max(rnorm, fabs(m_refine_r[i]));
+                    bnorm = std::max(bnorm, fabs(rhs[i]));
+                }
+                if (rnorm <= 1e-12 * bnorm) {
+                    break;
+                }
+                for (size_t i = 0; i < m_n; i++) {
+                    m_b32[i] = static_cast<float>(m_refine_r[i]);
+                }
+                ct_sgbtrs(ctlapack::NoTranspose, nColumns(), nSubDiagonals(),
+                          nSuperDiagonals(), 1, m_lu32.data(), ldim(),
+                          m_ipiv->data.data(), m_b32.data(), m_n, m_info);
+                if (m_info != 0) {
+                    throw Cantera::CanteraError("BandMatrix::solveMixed",
+                        "Refinement solve failed with SGBTRS error code {}.",
+                        m_info);
+                }
+                for (size_t i = 0; i < m_n; i++) {
+                    m_refine_x[i] += m_b32[i];
+                }
+            }
+        }
+        copy(m_refine_x.begin(), m_refine_x.end(), rhs);
+    }
+#endif
+}
+
 vector_fp::iterator BandMatrix::begin()
 {
     m_factored = false;
@@ -340,6 +518,10 @@ doublereal BandMatrix::rcond(doublereal a1norm)
     if (m_factored != 1) {
         throw CanteraError("BandMatrix::rcond", "matrix isn't factored correctly");
     }
+    if (m_mixed_precision) {
+        throw CanteraError("BandMatrix::rcond",
+            "not available with the mixed-precision factorization");
+    }
 
 #if CT_USE_LAPACK
     size_t ldab = (2 *m_kl + m_ku + 1);
@@ -0,0 +1,124 @@
+//! @file BlockTridiagSolver.cpp Block tridiagonal direct solver
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/numerics/BlockTridiagSolver.h"
+#include "cantera/numerics/BandMatrix.h"
+#include "cantera/base/ctexceptions.h"
+
+namespace Cantera
+{
+
+void BlockTridiagSolver::resize(const std::vector<size_t>& blockSizes)
+{
+    m_blockSizes = blockSizes;
+    m_offsets.assign(1, 0);
+    for (size_t nv : m_blockSizes) {
+        m_offsets.push_back(m_offsets.back() + nv);
+    }
+    m_size = m_offsets.back();
+    size_t nb = m_blockSizes.size();
+    m_Dinv.resize(nb);
+    m_W.resize(nb);
+    m_U.resize(nb);
+    m_work.resize(m_size);
+    m_factored = false;
+}
+
+void BlockTridiagSolver::factor(const BandMatrix& A)
+{
+    m_factored = false;
+    if (A.nRows() != m_size) {
+        throw CanteraError("BlockTridiagSolver::factor",
+            "Matrix has {} rows but the block sizes sum to {}",
+            A.nRows(), m_size);
+    }
+
+    Eigen::MatrixXd D;
+    size_t nb = m_blockSizes.size();
+    for (size_t p = 0; p < nb; p++) {
+        size_t nv = m_blockSizes[p];
+        size_t i0 = m_offsets[p];
+
+        // diagonal block
+        D.resize(nv, nv);
+        for (size_t j = 0; j < nv; j++) {
+            for (size_t i = 0; i < nv; i++) {
+                D(i, j) = A.value(i0 + i, i0 + j);
+            }
+        }
+
+        if (p > 0) {
+            size_t mv = m_blockSizes[p-1];
+            size_t j0 = m_offsets[p-1];
+
+            // subdiagonal block L, coupling block p to block p-1, and the
+            // superdiagonal block of the previous row
+            Eigen::MatrixXd L(nv, mv);
+            for (size_t j = 0; j < mv; j++) {
+                for (size_t i = 0; i < nv; i++) {
+                    L(i, j) = A.value(i0 + i, j0 + j);
+                }
+            }
+            m_U[p-1].resize(mv, nv);
+            for (size_t j = 0; j < nv; j++) {
+                for (size_t i = 0; i < mv; i++) {
+                    m_U[p-1](i, j) = A.value(j0 + i, i0 + j);
+                }
+            }
+
+            // eliminate the subdiagonal block: W = L * Dinv[p-1], and update
+            // the pivot block D -= W * U[p-1]
+            m_W[p] = L * m_Dinv[p-1];
+            D.noalias() -= m_W[p] * m_U[p-1];
+        }
+
+        m_Dinv[p] = D.partialPivLu().inverse();
+        if (nv && !m_Dinv[p].allFinite()) {
+            throw CanteraError("BlockTridiagSolver::factor",
+                "Singular pivot block {} (matrix rows {} to {})",
+                p, i0, i0 + nv - 1);
+        }
+    }
+    m_factored = true;
+}
+
+void BlockTridiagSolver::solve(const double* b, double* x)
+{
+    if (!m_factored) {
+        throw CanteraError("BlockTridiagSolver::solve",
+                           "Matrix has not been factored");
+    }
+    size_t nb = m_blockSizes.size();
+
+    // forward elimination: y = inv(L~) b, where L~ is the unit lower block
+    // bidiagonal factor with subdiagonal blocks W
+    Eigen::Map<const Eigen::VectorXd> bvec(b, m_size);
+    m_work = bvec;
+    for (size_t p = 1; p < nb; p++) {
+        size_t nv = m_blockSizes[p];
+        size_t mv = m_blockSizes[p-1];
+        if (nv && mv) {
+            m_work.segment(m_offsets[p], nv).noalias() -=
+                m_W[p] * m_work.segment(m_offsets[p-1], mv);
+        }
+    }
+
+    // back substitution through the upper block bidiagonal factor
+    Eigen::Map<Eigen::VectorXd> xvec(x, m_size);
+    for (size_t p = nb; p-- > 0; ) {
+        size_t nv = m_blockSizes[p];
+        if (!nv) {
+            continue;
+        }
+        if (p + 1 < nb && m_blockSizes[p+1]) {
+            m_work.segment(m_offsets[p], nv).noalias() -=
+                m_U[p] * xvec.segment(m_offsets[p+1], m_blockSizes[p+1]);
+        }
+        xvec.segment(m_offsets[p], nv).noalias() =
+            m_Dinv[p] * m_work.segment(m_offsets[p], nv);
+    }
+}
+
+}
@@ -6,6 +6,8 @@
 #include "cantera/numerics/CVodesIntegrator.h"
 #include "cantera/base/stringUtils.h"
 
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 using namespace std;
 
@@ -46,6 +48,53 @@ typedef int sd_size_t;
 typedef long int sd_size_t;
 #endif
 
+namespace
+{
+
+// Helpers for the binary checkpoint format written by
+// CVodesIntegrator::saveCheckpoint()
+
+const uint32_t CheckpointMagic = 0x43544350; // "CTCP"
+const uint32_t CheckpointVersion = 1;
+
+template <class T>
+void checkpointWrite(std::vector<char>& data, const T& value)
+{
+    const char* p = reinterpret_cast<const char*>(&value);
+    data.insert(data.end(), p, p + sizeof(T));
+}
+
+void checkpointWriteArray(std::vector<char>& data, const double* values,
+                          size_t n)
+{
+    const char* p = reinterpret_cast<const char*>(values);
+    data.insert(data.end(), p, p + n * sizeof(double));
+}
+
+template <class T>
+void checkpointRead(const std::vector<char>& data, size_t& pos, T& value)
+{
+    if (pos + sizeof(T) > data.size()) {
+        throw Cantera::CanteraError("CVodesIntegrator::loadCheckpoint",
+                                    "Unexpected end of checkpoint data");
+    }
+    std::memcpy(&value, data.data() + pos, sizeof(T));
+    pos += sizeof(T);
+}
+
+void checkpointReadArray(const std::vector<char>& data, size_t& pos,
+                         double* values, size_t n)
+{
+    if (pos + n * sizeof(double) > data.size()) {
+        throw Cantera::CanteraError("CVodesIntegrator::loadCheckpoint",
+                                    "Unexpected end of checkpoint data");
+    }
+    std::memcpy(values, data.data() + pos, n * sizeof(double));
+    pos += n * sizeof(double);
+}
+
+}
+
 namespace Cantera
 {
 
@@ -64,6 +113,140 @@ extern "C" {
         return f->eval_nothrow(t, NV_DATA_S(y), NV_DATA_S(ydot));
     }
 
+    /**
+     * Function called by CVodes to evaluate the right-hand sides of all
+     * sensitivity equations at once, forwarded to FuncEval::evalSensRhs().
+     * @ingroup odeGroup
+     */
+    static int cvodes_sens_rhs(int Ns, realtype t, N_Vector y, N_Vector ydot,
+                               N_Vector* yS, N_Vector* ySdot, void* f_data,
+                               N_Vector tmp1, N_Vector tmp2)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        std::vector<double*> s(Ns), sdot(Ns);
+        for (int i = 0; i < Ns; i++) {
+            s[i] = NV_DATA_S(yS[i]);
+            sdot[i] = NV_DATA_S(ySdot[i]);
+        }
+        return f->eval_sens_rhs_nothrow(t, NV_DATA_S(y), NV_DATA_S(ydot),
+                                        s.data(), sdot.data());
+    }
+
+    /**
+     * Function called by CVodes to evaluate the root (event) functions,
+     * forwarded to FuncEval::evalRoots().
+     * @ingroup odeGroup
+     */
+    static int cvodes_roots(realtype t, N_Vector y, realtype* gout,
+                            void* f_data)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->eval_roots_nothrow(t, NV_DATA_S(y), gout);
+    }
+
+    /**
+     * Function called by CVodes to evaluate the right-hand side of the
+     * backward (adjoint) problem, forwarded to FuncEval::evalAdjointRhs().
+     * @ingroup odeGroup
+     */
+    static int cvodes_rhs_adj(realtype t, N_Vector y, N_Vector yB,
+                              N_Vector yBdot, void* f_data)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->eval_adjoint_rhs_nothrow(t, NV_DATA_S(y), NV_DATA_S(yB),
+                                           NV_DATA_S(yBdot));
+    }
+
+    /**
+     * Function called by CVodes to evaluate the adjoint quadrature
+     * integrands, forwarded to FuncEval::evalAdjointQuad().
+     * @ingroup odeGroup
+     */
+    static int cvodes_quad_adj(realtype t, N_Vector y, N_Vector yB,
+                               N_Vector qBdot, void* f_data)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->eval_adjoint_quad_nothrow(t, NV_DATA_S(y), NV_DATA_S(yB),
+                                            NV_DATA_S(qBdot));
+    }
+
+    /**
+     * Function called by CVodes to evaluate the dense Jacobian, forwarded to
+     * FuncEval::evalDenseJacobian().
+     * @ingroup odeGroup
+     */
+    #if CT_SUNDIALS_VERSION >= 30
+    static int cvodes_jacobian(realtype t, N_Vector y, N_Vector fy,
+                               SUNMatrix Jac, void* f_data,
+                               N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        SUNMatZero(Jac);
+        return f->eval_dense_jacobian_nothrow(t, NV_DATA_S(y), NV_DATA_S(fy),
+                                              SM_DATA_D(Jac));
+    }
+    #else
+    static int cvodes_jacobian(long int N, realtype t, N_Vector y,
+                               N_Vector fy, DlsMat Jac, void* f_data,
+                               N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        SetToZero(Jac);
+        return f->eval_dense_jacobian_nothrow(t, NV_DATA_S(y), NV_DATA_S(fy),
+                                              Jac->data);
+    }
+    #endif
+
+    /**
+     * Function called by CVodes to update the preconditioner used by the
+     * Krylov linear solver, forwarded to FuncEval::preconditionerSetup().
+     * When CVodes indicates (via *jok*) that Jacobian data saved from an
+     * earlier step may be reused, the setup call is skipped entirely, which
+     * implements the Jacobian-reuse policy for preconditioned iterations.
+     * @ingroup odeGroup
+     */
+#if CT_SUNDIALS_VERSION >= 30
+    static int cvodes_prec_setup(realtype t, N_Vector y, N_Vector ydot,
+                                 booleantype jok, booleantype* jcurPtr,
+                                 realtype gamma, void* f_data)
+#else
+    static int cvodes_prec_setup(realtype t, N_Vector y, N_Vector ydot,
+                                 booleantype jok, booleantype* jcurPtr,
+                                 realtype gamma, void* f_data,
+                                 N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+#endif
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        if (jok) {
+            *jcurPtr = 0; // jacobian data was reused
+            return 0;
+        }
+        *jcurPtr = 1; // jacobian data was recomputed
+        return f->preconditioner_setup_nothrow(t, NV_DATA_S(y), gamma);
+    }
+
+    /**
+     * Function called by CVodes to solve the linear system Pz = r with the
+     * preconditioner matrix P formed by cvodes_prec_setup(), forwarded to
+     * FuncEval::preconditionerSolve().
+     * @ingroup odeGroup
+     */
+#if CT_SUNDIALS_VERSION >= 30
+    static int cvodes_prec_solve(realtype t, N_Vector y, N_Vector ydot,
+                                 N_Vector r, N_Vector z, realtype gamma,
+                                 realtype delta, int lr, void* f_data)
+#else
+    static int cvodes_prec_solve(realtype t, N_Vector y, N_Vector ydot,
+                                 N_Vector r, N_Vector z, realtype gamma,
+                                 realtype delta, int lr, void* f_data,
+                                 N_Vector tmp)
+#endif
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->preconditioner_solve_nothrow(t, NV_DATA_S(y),
+                                               NV_DATA_S(r), NV_DATA_S(z));
+    }
+
     //! Function called by CVodes when an error is encountered instead of
     //! writing to stdout. Here, save the error message provided by CVodes so
     //! that it can be included in the subsequently raised CanteraError.
@@ -81,8 +264,11 @@ CVodesIntegrator::CVodesIntegrator() :
     m_cvode_mem(0),
     m_linsol(0),
     m_linsol_matrix(0),
+    m_linsol_neq(0),
+    m_linsol_type(0),
     m_func(0),
     m_t0(0.0),
+    m_stoppedAtRoot(false),
     m_y(0),
     m_abstol(0),
     m_dky(0),
@@ -99,10 +285,18 @@ CVodesIntegrator::CVodesIntegrator() :
     m_hmin(0.0),
     m_maxsteps(20000),
     m_maxErrTestFails(0),
+    m_maxStepsBetweenJac(0),
     m_yS(nullptr),
     m_np(0),
     m_mupper(0), m_mlower(0),
-    m_sens_ok(false)
+    m_sens_ok(false),
+    m_adjoint(false),
+    m_whichB(0),
+    m_ncheck(0),
+    m_yB(0),
+    m_qB(0),
+    m_linsolB(0),
+    m_linsol_matrixB(0)
 {
 }
 
@@ -118,8 +312,16 @@ CVodesIntegrator::~CVodesIntegrator()
     #if CT_SUNDIALS_VERSION >= 30
         SUNLinSolFree((SUNLinearSolver) m_linsol);
         SUNMatDestroy((SUNMatrix) m_linsol_matrix);
+        SUNLinSolFree((SUNLinearSolver) m_linsolB);
+        SUNMatDestroy((SUNMatrix) m_linsol_matrixB);
     #endif
 
+    if (m_yB) {
+        N_VDestroy_Serial(m_yB);
+    }
+    if (m_qB) {
+        N_VDestroy_Serial(m_qB);
+    }
     if (m_y) {
         N_VDestroy_Serial(m_y);
     }
@@ -226,6 +428,23 @@ void CVodesIntegrator::setMaxErrTestFails(int n)
     }
 }
 
+void CVodesIntegrator::setMaxStepsBetweenJac(int nmax)
+{
+    #if CT_SUNDIALS_VERSION >= 40
+        m_maxStepsBetweenJac = nmax;
+        if (m_cvode_mem) {
+            #if CT_SUNDIALS_VERSION >= 51
+                CVodeSetJacEvalFrequency(m_cvode_mem, m_maxStepsBetweenJac);
+            #else
+                CVodeSetMaxStepsBetweenJac(m_cvode_mem, m_maxStepsBetweenJac);
+            #endif
+        }
+    #else
+        throw CanteraError("CVodesIntegrator::setMaxStepsBetweenJac",
+            "Limiting the Jacobian age requires Sundials >= 4.0");
+    #endif
+}
+
 void CVodesIntegrator::sensInit(double t0, FuncEval& func)
 {
     m_np = func.nparams();
@@ -238,8 +457,12 @@ void CVodesIntegrator::sensInit(double t0, FuncEval& func)
     }
     N_VDestroy_Serial(y);
 
+    // Use the evaluator's batched sensitivity right-hand side when it
+    // provides one; otherwise fall back to the CVODES internal difference
+    // quotients, which cost one full RHS evaluation per parameter per step.
+    CVSensRhsFn fS = func.sensRhsSupported() ? cvodes_sens_rhs : CVSensRhsFn(0);
     int flag = CVodeSensInit(m_cvode_mem, static_cast<sd_size_t>(m_np),
-                             CV_STAGGERED, CVSensRhsFn(0), m_yS);
+                             CV_STAGGERED, fS, m_yS);
 
     if (flag != CV_SUCCESS) {
         throw CanteraError("CVodesIntegrator::sensInit", "Error in CVodeSensInit");
@@ -281,6 +504,22 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
 
     if (m_cvode_mem) {
         CVodeFree(&m_cvode_mem);
+        // Any backward (adjoint) problem was owned by the freed memory;
+        // discard its workspace so integrateAdjoint() rebuilds it.
+        #if CT_SUNDIALS_VERSION >= 30
+            SUNLinSolFree((SUNLinearSolver) m_linsolB);
+            m_linsolB = nullptr;
+            SUNMatDestroy((SUNMatrix) m_linsol_matrixB);
+            m_linsol_matrixB = nullptr;
+        #endif
+        if (m_yB) {
+            N_VDestroy_Serial(m_yB);
+            m_yB = nullptr;
+        }
+        if (m_qB) {
+            N_VDestroy_Serial(m_qB);
+            m_qB = nullptr;
+        }
     }
 
     //! Specify the method and the iteration type. Cantera Defaults:
@@ -334,6 +573,14 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
         throw CanteraError("CVodesIntegrator::initialize",
                            "CVodeSetUserData failed.");
     }
+    if (func.nRoots() > 0) {
+        flag = CVodeRootInit(m_cvode_mem, static_cast<int>(func.nRoots()),
+                             cvodes_roots);
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::initialize",
+                               "CVodeRootInit failed.");
+        }
+    }
     if (func.nparams() > 0) {
         sensInit(t0, func);
         flag = CVodeSetSensParams(m_cvode_mem, func.m_sens_params.data(),
@@ -343,6 +590,16 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
                                "CVodeSetSensParams failed.");
         }
     }
+    if (m_adjoint) {
+        // Record the forward states (with checkpointing every 100 steps) so
+        // integrateAdjoint() can reconstruct them during the backward
+        // integration
+        flag = CVodeAdjInit(m_cvode_mem, 100, CV_HERMITE);
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::initialize",
+                               "CVodeAdjInit failed.");
+        }
+    }
     applyOptions();
 }
 
@@ -359,7 +616,248 @@ void CVodesIntegrator::reinitialize(double t0, FuncEval& func)
         throw CanteraError("CVodesIntegrator::reinitialize",
                            "CVodeReInit failed. result = {}", result);
     }
+    // the number of root functions may have changed since initialization
+    result = CVodeRootInit(m_cvode_mem, static_cast<int>(func.nRoots()),
+                           func.nRoots() ? cvodes_roots : nullptr);
+    if (result != CV_SUCCESS) {
+        throw CanteraError("CVodesIntegrator::reinitialize",
+                           "CVodeRootInit failed. result = {}", result);
+    }
+    // Distinguish value-only changes from structural ones: when the problem
+    // size and linear solver selection are unchanged, CVodeReInit has
+    // already reset the integrator history, and the linear solver workspace
+    // and Jacobian structure can be retained
+    if (m_neq == m_linsol_neq && m_type == m_linsol_type) {
+        applyScalarOptions();
+    } else {
+        applyOptions();
+    }
+}
+
+void CVodesIntegrator::setAdjointMode(bool yes)
+{
+    // takes effect when the integrator is next initialized
+    m_adjoint = yes;
+}
+
+void CVodesIntegrator::integrateAdjoint(double* lambda, double* grad)
+{
+    if (!m_adjoint || !m_cvode_mem) {
+        throw CanteraError("CVodesIntegrator::integrateAdjoint",
+            "Adjoint mode was not enabled before the forward integration.");
+    }
+    if (!m_func->adjointSupported()) {
+        throw CanteraError("CVodesIntegrator::integrateAdjoint",
+            "The FuncEval object does not implement the adjoint "
+            "right-hand sides.");
+    }
+    size_t np = m_func->nparams();
+    int flag;
+
+    if (m_yB == nullptr) {
+        sd_size_t N = static_cast<sd_size_t>(m_neq);
+        m_yB = N_VNew_Serial(N);
+        #if CT_SUNDIALS_VERSION >= 40
+            flag = CVodeCreateB(m_cvode_mem, CV_BDF, &m_whichB);
+        #else
+            flag = CVodeCreateB(m_cvode_mem, CV_BDF, CV_NEWTON, &m_whichB);
+        #endif
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::integrateAdjoint",
+                               "CVodeCreateB failed.");
+        }
+
+        // terminal condition: lambda(tf) = dg/dy at the current time
+        copy(lambda, lambda + m_neq, NV_DATA_S(m_yB));
+        flag = CVodeInitB(m_cvode_mem, m_whichB, cvodes_rhs_adj, m_time, m_yB);
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::integrateAdjoint",
+                               "CVodeInitB failed.");
+        }
+        CVodeSStolerancesB(m_cvode_mem, m_whichB, m_reltol, m_abstols);
+        CVodeSetUserDataB(m_cvode_mem, m_whichB, m_func);
+
+        // dense linear solver for the backward problem
+        #if CT_SUNDIALS_VERSION >= 30
+            m_linsol_matrixB = SUNDenseMatrix(N, N);
+            if (m_linsol_matrixB == nullptr) {
+                throw CanteraError("CVodesIntegrator::integrateAdjoint",
+                    "Unable to create SUNDenseMatrix of size {0} x {0}", N);
+            }
+            #if CT_SUNDIALS_USE_LAPACK
+                m_linsolB = SUNLapackDense(m_yB, (SUNMatrix) m_linsol_matrixB);
+            #else
+                m_linsolB = SUNDenseLinearSolver(m_yB,
+                                                 (SUNMatrix) m_linsol_matrixB);
+            #endif
+            CVDlsSetLinearSolverB(m_cvode_mem, m_whichB,
+                                  (SUNLinearSolver) m_linsolB,
+                                  (SUNMatrix) m_linsol_matrixB);
+        #else
+            CVDenseB(m_cvode_mem, m_whichB, N);
+        #endif
+
+        if (np > 0) {
+            m_qB = N_VNew_Serial(static_cast<sd_size_t>(np));
+            N_VConst(0.0, m_qB);
+            flag = CVodeQuadInitB(m_cvode_mem, m_whichB, cvodes_quad_adj,
+                                  m_qB);
+            if (flag != CV_SUCCESS) {
+                throw CanteraError("CVodesIntegrator::integrateAdjoint",
+                                   "CVodeQuadInitB failed.");
+            }
+        }
+    } else {
+        // subsequent adjoint solves reuse the backward problem
+        copy(lambda, lambda + m_neq, NV_DATA_S(m_yB));
+        flag = CVodeReInitB(m_cvode_mem, m_whichB, m_time, m_yB);
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::integrateAdjoint",
+                               "CVodeReInitB failed.");
+        }
+        if (np > 0) {
+            N_VConst(0.0, m_qB);
+            CVodeQuadReInitB(m_cvode_mem, m_whichB, m_qB);
+        }
+    }
+
+    flag = CVodeB(m_cvode_mem, m_t0, CV_NORMAL);
+    if (flag != CV_SUCCESS) {
+        string f_errs = m_func->getErrors();
+        if (!f_errs.empty()) {
+            f_errs = "Exceptions caught during adjoint evaluation:\n" + f_errs;
+        }
+        throw CanteraError("CVodesIntegrator::integrateAdjoint",
+            "CVodes error encountered. Error code: {}\n{}\n{}",
+            flag, m_error_message, f_errs);
+    }
+
+    realtype tret;
+    flag = CVodeGetB(m_cvode_mem, m_whichB, &tret, m_yB);
+    if (flag != CV_SUCCESS) {
+        throw CanteraError("CVodesIntegrator::integrateAdjoint",
+                           "CVodeGetB failed.");
+    }
+    copy(NV_DATA_S(m_yB), NV_DATA_S(m_yB) + m_neq, lambda);
+
+    if (np > 0) {
+        flag = CVodeGetQuadB(m_cvode_mem, m_whichB, &tret, m_qB);
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::integrateAdjoint",
+                               "CVodeGetQuadB failed.");
+        }
+        copy(NV_DATA_S(m_qB), NV_DATA_S(m_qB) + np, grad);
+    }
+}
+
+void CVodesIntegrator::saveCheckpoint(std::vector<char>& data)
+{
+    if (!m_cvode_mem) {
+        throw CanteraError("CVodesIntegrator::saveCheckpoint",
+                           "Integrator has not been initialized");
+    }
+    data.clear();
+    checkpointWrite(data, CheckpointMagic);
+    checkpointWrite(data, CheckpointVersion);
+    checkpointWrite(data, static_cast<uint64_t>(m_neq));
+    checkpointWrite(data, static_cast<uint64_t>(m_np));
+    checkpointWrite(data, m_t0);
+    checkpointWrite(data, m_time);
+
+    // Step size and order reached so far; used on restart to skip the
+    // initial step size selection. Both are only available after at least
+    // one successful step.
+    double hlast = 0.0;
+    int qlast = 0;
+    if (m_time != m_t0) {
+        CVodeGetLastStep(m_cvode_mem, &hlast);
+        CVodeGetLastOrder(m_cvode_mem, &qlast);
+    }
+    checkpointWrite(data, hlast);
+    checkpointWrite(data, static_cast<int32_t>(qlast));
+
+    checkpointWriteArray(data, NV_DATA_S(m_y), m_neq);
+
+    if (m_np) {
+        if (!m_sens_ok && m_time != m_t0) {
+            int flag = CVodeGetSens(m_cvode_mem, &m_time, m_yS);
+            if (flag != CV_SUCCESS) {
+                throw CanteraError("CVodesIntegrator::saveCheckpoint",
+                                   "CVodeGetSens failed. Error code: {}", flag);
+            }
+            m_sens_ok = true;
+        }
+        for (size_t n = 0; n < m_np; n++) {
+            checkpointWriteArray(data, NV_DATA_S(m_yS[n]), m_neq);
+        }
+    }
+}
+
+double CVodesIntegrator::loadCheckpoint(const std::vector<char>& data,
+                                        FuncEval& func)
+{
+    if (!m_cvode_mem) {
+        throw CanteraError("CVodesIntegrator::loadCheckpoint",
+                           "Integrator has not been initialized");
+    }
+    size_t pos = 0;
+    uint32_t magic, version;
+    checkpointRead(data, pos, magic);
+    checkpointRead(data, pos, version);
+    if (magic != CheckpointMagic) {
+        throw CanteraError("CVodesIntegrator::loadCheckpoint",
+                           "Data does not appear to be a CVODES checkpoint");
+    }
+    if (version != CheckpointVersion) {
+        throw CanteraError("CVodesIntegrator::loadCheckpoint",
+                           "Unsupported checkpoint format version ({})",
+                           version);
+    }
+
+    uint64_t neq, np;
+    checkpointRead(data, pos, neq);
+    checkpointRead(data, pos, np);
+    if (neq != m_neq || np != m_np) {
+        throw CanteraError("CVodesIntegrator::loadCheckpoint",
+            "Checkpoint was written for a system with {} equations and {} "
+            "sensitivity parameters; this integrator has {} equations and {} "
+            "sensitivity parameters", neq, np, m_neq, m_np);
+    }
+
+    double t0, time, hlast;
+    int32_t qlast;
+    checkpointRead(data, pos, t0);
+    checkpointRead(data, pos, time);
+    checkpointRead(data, pos, hlast);
+    checkpointRead(data, pos, qlast);
+    checkpointReadArray(data, pos, NV_DATA_S(m_y), m_neq);
+
+    m_func = &func;
+    func.clearErrors();
+    int flag = CVodeReInit(m_cvode_mem, time, m_y);
+    if (flag != CV_SUCCESS) {
+        throw CanteraError("CVodesIntegrator::loadCheckpoint",
+                           "CVodeReInit failed. result = {}", flag);
+    }
+    if (hlast != 0.0) {
+        CVodeSetInitStep(m_cvode_mem, hlast);
+    }
+
+    if (m_np) {
+        for (size_t n = 0; n < m_np; n++) {
+            checkpointReadArray(data, pos, NV_DATA_S(m_yS[n]), m_neq);
+        }
+        flag = CVodeSensReInit(m_cvode_mem, CV_STAGGERED, m_yS);
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::loadCheckpoint",
+                               "CVodeSensReInit failed. result = {}", flag);
+        }
+    }
     applyOptions();
+    m_t0 = t0;
+    m_time = time;
+    m_sens_ok = false;
+    return m_time;
 }
 
 void CVodesIntegrator::applyOptions()
@@ -381,26 +879,42 @@ void CVodesIntegrator::applyOptions()
             #endif
             CVDlsSetLinearSolver(m_cvode_mem, (SUNLinearSolver) m_linsol,
                                  (SUNMatrix) m_linsol_matrix);
+            if (m_func->denseJacobianSupported()) {
+                CVDlsSetJacFn(m_cvode_mem, cvodes_jacobian);
+            }
         #else
             #if CT_SUNDIALS_USE_LAPACK
                 CVLapackDense(m_cvode_mem, N);
             #else
                 CVDense(m_cvode_mem, N);
             #endif
+            if (m_func->denseJacobianSupported()) {
+                CVDlsSetDenseJacFn(m_cvode_mem, cvodes_jacobian);
+            }
         #endif
     } else if (m_type == DIAG) {
         CVDiag(m_cvode_mem);
     } else if (m_type == GMRES) {
+        // Use left preconditioning when the FuncEval supplies a
+        // preconditioner; otherwise run unpreconditioned GMRES.
+        int prectype = PREC_NONE;
+        if (m_func && m_func->preconditionerSupported()) {
+            prectype = PREC_LEFT;
+        }
         #if CT_SUNDIALS_VERSION >= 30
             # if CT_SUNDIALS_VERSION >= 40
-                m_linsol = SUNLinSol_SPGMR(m_y, PREC_NONE, 0);
+                m_linsol = SUNLinSol_SPGMR(m_y, prectype, 0);
             # else
-                m_linsol = SUNSPGMR(m_y, PREC_NONE, 0);
+                m_linsol = SUNSPGMR(m_y, prectype, 0);
             #endif
             CVSpilsSetLinearSolver(m_cvode_mem, (SUNLinearSolver) m_linsol);
         #else
-            CVSpgmr(m_cvode_mem, PREC_NONE, 0);
+            CVSpgmr(m_cvode_mem, prectype, 0);
         #endif
+        if (prectype == PREC_LEFT) {
+            CVSpilsSetPreconditioner(m_cvode_mem, cvodes_prec_setup,
+                                     cvodes_prec_solve);
+        }
     } else if (m_type == BAND + NOJAC) {
         sd_size_t N = static_cast<sd_size_t>(m_neq);
         long int nu = m_mupper;
@@ -436,7 +950,14 @@ void CVodesIntegrator::applyOptions()
         throw CanteraError("CVodesIntegrator::applyOptions",
                            "unsupported option");
     }
+    m_linsol_neq = m_neq;
+    m_linsol_type = m_type;
 
+    applyScalarOptions();
+}
+
+void CVodesIntegrator::applyScalarOptions()
+{
     if (m_maxord > 0) {
         CVodeSetMaxOrd(m_cvode_mem, m_maxord);
     }
@@ -452,6 +973,15 @@ void CVodesIntegrator::applyOptions()
     if (m_maxErrTestFails > 0) {
         CVodeSetMaxErrTestFails(m_cvode_mem, m_maxErrTestFails);
     }
+    #if CT_SUNDIALS_VERSION >= 40
+        if (m_maxStepsBetweenJac > 0) {
+            #if CT_SUNDIALS_VERSION >= 51
+                CVodeSetJacEvalFrequency(m_cvode_mem, m_maxStepsBetweenJac);
+            #else
+                CVodeSetMaxStepsBetweenJac(m_cvode_mem, m_maxStepsBetweenJac);
+            #endif
+        }
+    #endif
 }
 
 void CVodesIntegrator::integrate(double tout)
@@ -459,8 +989,16 @@ void CVodesIntegrator::integrate(double tout)
     if (tout == m_time) {
         return;
     }
-    int flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_NORMAL);
-    if (flag != CV_SUCCESS) {
+    m_stoppedAtRoot = false;
+    int flag;
+    if (m_adjoint) {
+        flag = CVodeF(m_cvode_mem, tout, m_y, &m_time, CV_NORMAL, &m_ncheck);
+    } else {
+        flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_NORMAL);
+    }
+    if (flag == CV_ROOT_RETURN) {
+        m_stoppedAtRoot = true;
+    } else if (flag != CV_SUCCESS) {
         string f_errs = m_func->getErrors();
         if (!f_errs.empty()) {
             f_errs = "Exceptions caught during RHS evaluation:\n" + f_errs;
@@ -476,8 +1014,16 @@ void CVodesIntegrator::integrate(double tout)
 
 double CVodesIntegrator::step(double tout)
 {
-    int flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_ONE_STEP);
-    if (flag != CV_SUCCESS) {
+    m_stoppedAtRoot = false;
+    int flag;
+    if (m_adjoint) {
+        flag = CVodeF(m_cvode_mem, tout, m_y, &m_time, CV_ONE_STEP, &m_ncheck);
+    } else {
+        flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_ONE_STEP);
+    }
+    if (flag == CV_ROOT_RETURN) {
+        m_stoppedAtRoot = true;
+    } else if (flag != CV_SUCCESS) {
         string f_errs = m_func->getErrors();
         if (!f_errs.empty()) {
             f_errs = "Exceptions caught during RHS evaluation:\n" + f_errs;
@@ -493,6 +1039,18 @@ double CVodesIntegrator::step(double tout)
     return m_time;
 }
 
+void CVodesIntegrator::getRootInfo(std::vector<int>& roots)
+{
+    roots.resize(m_func->nRoots());
+    if (!roots.empty()) {
+        int flag = CVodeGetRootInfo(m_cvode_mem, roots.data());
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::getRootInfo",
+                               "CVodeGetRootInfo failed. flag = {}", flag);
+        }
+    }
+}
+
 double* CVodesIntegrator::derivative(double tout, int n)
 {
     int flag = CVodeGetDky(m_cvode_mem, tout, n, m_dky);
@@ -523,6 +1081,67 @@ int CVodesIntegrator::nEvals() const
     return ne;
 }
 
+AnyMap CVodesIntegrator::memoryReport() const
+{
+    AnyMap report;
+    report["type"] = "CVODES";
+    if (m_cvode_mem) {
+        long int lenrw = 0, leniw = 0;
+        CVodeGetWorkSpace(m_cvode_mem, &lenrw, &leniw);
+        report["real-workspace-bytes"] =
+            static_cast<long int>(lenrw * sizeof(realtype));
+        report["integer-workspace-bytes"] =
+            static_cast<long int>(leniw * sizeof(long int));
+    }
+    return report;
+}
+
+AnyMap CVodesIntegrator::solverStats() const
+{
+    AnyMap stats;
+    stats["type"] = "CVODES";
+    if (!m_cvode_mem) {
+        return stats;
+    }
+    long int n = 0;
+    CVodeGetNumSteps(m_cvode_mem, &n);
+    stats["steps"] = n;
+    double hlast = 0.0;
+    if (n > 0) {
+        CVodeGetLastStep(m_cvode_mem, &hlast);
+        stats["average-step-size"] = (m_time - m_t0) / n;
+    } else {
+        stats["average-step-size"] = 0.0;
+    }
+    stats["last-step-size"] = hlast;
+    CVodeGetNumRhsEvals(m_cvode_mem, &n);
+    stats["rhs-evals"] = n;
+    CVodeGetNumLinSolvSetups(m_cvode_mem, &n);
+    stats["linear-solver-setups"] = n;
+    CVodeGetNumErrTestFails(m_cvode_mem, &n);
+    stats["error-test-failures"] = n;
+    CVodeGetNumNonlinSolvIters(m_cvode_mem, &n);
+    stats["nonlinear-iterations"] = n;
+    CVodeGetNumNonlinSolvConvFails(m_cvode_mem, &n);
+    stats["nonlinear-convergence-failures"] = n;
+    if (m_type == DENSE + NOJAC || m_type == BAND + NOJAC) {
+        // Jacobian counters are maintained by the direct linear solver
+        // interface; factorizations happen once per linear solver setup
+        CVDlsGetNumJacEvals(m_cvode_mem, &n);
+        stats["jac-evals"] = n;
+        CVDlsGetNumRhsEvals(m_cvode_mem, &n);
+        stats["jac-rhs-evals"] = n;
+    } else if (m_type == GMRES) {
+        CVSpilsGetNumLinIters(m_cvode_mem, &n);
+        stats["linear-iterations"] = n;
+        CVSpilsGetNumConvFails(m_cvode_mem, &n);
+        stats["linear-convergence-failures"] = n;
+        CVSpilsGetNumPrecSolves(m_cvode_mem, &n);
+        stats["preconditioner-solves"] = n;
+    }
+    return stats;
+}
+
 double CVodesIntegrator::sensitivity(size_t k, size_t p)
 {
     if (m_time == m_t0) {
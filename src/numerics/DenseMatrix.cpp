@@ -10,13 +10,53 @@
 #include "cantera/base/global.h"
 #if CT_USE_LAPACK
     #include "cantera/numerics/ctlapack.h"
-#else
-    #include "cantera/numerics/eigen_dense.h"
 #endif
+#include "cantera/numerics/eigen_dense.h"
 
 namespace Cantera
 {
 
+namespace {
+
+//! Solve A*x = b for a small square matrix with a fixed-size Eigen
+//! factorization, avoiding the call overhead of the LAPACK wrappers. The
+//! right-hand sides are overwritten with the solution; A is left unchanged.
+template <int N>
+int solveFixed(DenseMatrix& A, double* b, size_t nrhs, size_t ldb)
+{
+    Eigen::Map<Eigen::Matrix<double, N, N>> Am(&A(0,0));
+    Eigen::FullPivLU<Eigen::Matrix<double, N, N>> lu(Am);
+    if (!lu.isInvertible()) {
+        if (A.m_printLevel) {
+            writelogf("solve(DenseMatrix& A, double* b): %dx%d matrix is "
+                      "singular\n", N, N);
+        }
+        if (!A.m_useReturnErrorCode) {
+            throw CanteraError("solve(DenseMatrix& A, double* b)",
+                               "{}x{} matrix is singular", N, N);
+        }
+        return 1;
+    }
+    for (size_t i = 0; i < nrhs; i++) {
+        Eigen::Map<Eigen::Matrix<double, N, 1>> bm(b + ldb*i);
+        bm = lu.solve(bm);
+    }
+    return 0;
+}
+
+//! Matrix-vector product for a small square matrix with fixed-size Eigen
+//! kernels, writing directly into prod with no temporaries.
+template <int N>
+void multFixed(const DenseMatrix& A, const double* b, double* prod)
+{
+    Eigen::Map<const Eigen::Matrix<double, N, N>> Am(A.ptrColumn(0));
+    Eigen::Map<const Eigen::Matrix<double, N, 1>> bm(b);
+    Eigen::Map<Eigen::Matrix<double, N, 1>> pm(prod);
+    pm.noalias() = Am * bm;
+}
+
+}
+
 DenseMatrix::DenseMatrix() :
     m_useReturnErrorCode(0),
     m_printLevel(0)
@@ -51,6 +91,17 @@ DenseMatrix::DenseMatrix(const DenseMatrix& y) :
     }
 }
 
+DenseMatrix::DenseMatrix(DenseMatrix&& y) noexcept :
+    Array2D(std::move(y)),
+    m_ipiv(std::move(y.m_ipiv)),
+    m_colPts(std::move(y.m_colPts)),
+    m_useReturnErrorCode(y.m_useReturnErrorCode),
+    m_printLevel(y.m_printLevel)
+{
+    // The column pointers reference m_data, whose buffer moved with it, so
+    // they remain valid without being recomputed.
+}
+
 DenseMatrix& DenseMatrix::operator=(const DenseMatrix& y)
 {
     if (&y == this) {
@@ -67,9 +118,40 @@ DenseMatrix& DenseMatrix::operator=(const DenseMatrix& y)
     return *this;
 }
 
+DenseMatrix& DenseMatrix::operator=(DenseMatrix&& y) noexcept
+{
+    if (&y == this) {
+        return *this;
+    }
+    Array2D::operator=(std::move(y));
+    m_ipiv = std::move(y.m_ipiv);
+    m_colPts = std::move(y.m_colPts);
+    m_useReturnErrorCode = y.m_useReturnErrorCode;
+    m_printLevel = y.m_printLevel;
+    return *this;
+}
+
 void DenseMatrix::resize(size_t n, size_t m, doublereal v)
 {
     Array2D::resize(n,m,v);
+    if (std::max(n,m) > m_ipiv.capacity() || m > m_colPts.capacity()) {
+        incrementAllocationCount("DenseMatrix");
+    }
+    m_ipiv.resize(std::max(n,m));
+    m_colPts.resize(m_ncols);
+    if (!m_data.empty()) {
+        for (size_t j = 0; j < m_ncols; j++) {
+            m_colPts[j] = &m_data[m_nrows*j];
+        }
+    }
+}
+
+void DenseMatrix::resizeDiscard(size_t n, size_t m, doublereal v)
+{
+    Array2D::resizeDiscard(n,m,v);
+    if (std::max(n,m) > m_ipiv.capacity() || m > m_colPts.capacity()) {
+        incrementAllocationCount("DenseMatrix");
+    }
     m_ipiv.resize(std::max(n,m));
     m_colPts.resize(m_ncols);
     if (!m_data.empty()) {
@@ -91,6 +173,26 @@ const doublereal* const* DenseMatrix::const_colPts() const
 
 void DenseMatrix::mult(const double* b, double* prod) const
 {
+    // Fixed-size dispatch for the small square matrices that dominate
+    // surface and equilibrium solves
+    if (nRows() == nColumns()) {
+        switch (nRows()) {
+        case 1:
+            prod[0] = m_data[0] * b[0];
+            return;
+        case 2:
+            multFixed<2>(*this, b, prod);
+            return;
+        case 3:
+            multFixed<3>(*this, b, prod);
+            return;
+        case 4:
+            multFixed<4>(*this, b, prod);
+            return;
+        default:
+            break;
+        }
+    }
 #if CT_USE_LAPACK
     ct_dgemv(ctlapack::ColMajor, ctlapack::NoTranspose,
              static_cast<int>(nRows()),
@@ -126,13 +228,10 @@ void DenseMatrix::mult(const DenseMatrix& B, DenseMatrix& prod) const
 
 void DenseMatrix::leftMult(const double* const b, double* const prod) const
 {
-    for (size_t n = 0; n < nColumns(); n++) {
-        double sum = 0.0;
-        for (size_t i = 0; i < nRows(); i++) {
-            sum += value(i,n)*b[i];
-        }
-        prod[n] = sum;
-    }
+    MappedMatrix mat(const_cast<double*>(m_data.data()), nRows(), nColumns());
+    ConstMappedVector bm(b, nRows());
+    MappedVector pm(prod, nColumns());
+    pm.noalias() = mat.transpose() * bm;
 }
 
 vector_int& DenseMatrix::ipiv()
@@ -153,6 +252,36 @@ int solve(DenseMatrix& A, double* b, size_t nrhs, size_t ldb)
     if (ldb == 0) {
         ldb = A.nColumns();
     }
+    // Fixed-size dispatch for the small systems (components of equilibrium
+    // problems, surface-site solves) where the LAPACK call overhead exceeds
+    // the factorization cost. Unlike the LAPACK branch, these leave A
+    // unfactored, matching the Eigen branch below.
+    switch (A.nRows()) {
+    case 1:
+        if (A(0,0) == 0.0) {
+            if (A.m_printLevel) {
+                writelogf("solve(DenseMatrix& A, double* b): 1x1 matrix is "
+                          "singular\n");
+            }
+            if (!A.m_useReturnErrorCode) {
+                throw CanteraError("solve(DenseMatrix& A, double* b)",
+                                   "1x1 matrix is singular");
+            }
+            return 1;
+        }
+        for (size_t i = 0; i < nrhs; i++) {
+            b[ldb*i] /= A(0,0);
+        }
+        return 0;
+    case 2:
+        return solveFixed<2>(A, b, nrhs, ldb);
+    case 3:
+        return solveFixed<3>(A, b, nrhs, ldb);
+    case 4:
+        return solveFixed<4>(A, b, nrhs, ldb);
+    default:
+        break;
+    }
     #if CT_USE_LAPACK
         ct_dgetrf(A.nRows(), A.nColumns(), A.ptrColumn(0),
                   A.nRows(), &A.ipiv()[0], info);
@@ -201,10 +330,11 @@ int solve(DenseMatrix& A, double* b, size_t nrhs, size_t ldb)
                     lu.nonzeroPivots(), A.nColumns());
             }
         #endif
-        for (size_t i = 0; i < nrhs; i++) {
-            MappedVector bm(b + ldb*i, A.nColumns());
-            bm = lu.solve(bm);
-        }
+        // solve all right-hand sides against the factorization in one blocked
+        // triangular solve instead of one back-substitution per column
+        Eigen::Map<Eigen::MatrixXd, Eigen::Unaligned, Eigen::OuterStride<>> bm(
+            b, A.nColumns(), nrhs, Eigen::OuterStride<>(ldb));
+        bm = lu.solve(bm);
     #endif
     return info;
 }
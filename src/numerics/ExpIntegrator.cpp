@@ -0,0 +1,363 @@
+//! @file ExpIntegrator.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/numerics/ExpIntegrator.h"
+#include "cantera/base/utilities.h"
+
+#include <limits>
+
+namespace Cantera
+{
+
+ExpIntegrator::ExpIntegrator(size_t maxKrylov) :
+    m_krylovMax(maxKrylov)
+{
+    if (maxKrylov < 2) {
+        throw CanteraError("ExpIntegrator::ExpIntegrator",
+                           "maxKrylov must be at least 2");
+    }
+}
+
+void ExpIntegrator::setTolerances(double reltol, size_t n, double* abstol)
+{
+    m_reltol = reltol;
+    m_abstol.assign(abstol, abstol + n);
+}
+
+void ExpIntegrator::setTolerances(double reltol, double abstol)
+{
+    m_reltol = reltol;
+    m_abstols = abstol;
+    m_abstol.clear();
+}
+
+void ExpIntegrator::setMaxStepSize(double hmax)
+{
+    m_hmax = hmax;
+}
+
+void ExpIntegrator::setMinStepSize(double hmin)
+{
+    m_hmin = hmin;
+}
+
+void ExpIntegrator::setMaxSteps(int nmax)
+{
+    m_maxsteps = nmax;
+}
+
+int ExpIntegrator::maxSteps()
+{
+    return m_maxsteps;
+}
+
+void ExpIntegrator::initialize(double t0, FuncEval& func)
+{
+    m_func = &func;
+    m_neq = func.neq();
+    if (func.nRoots() > 0) {
+        throw CanteraError("ExpIntegrator::initialize",
+            "Root finding is not supported by the exponential integrator; "
+            "use the CVODES integrator instead.");
+    }
+    size_t m = std::min(m_krylovMax, m_neq);
+    m_y.resize(m_neq);
+    m_ynew.resize(m_neq);
+    m_err.resize(m_neq);
+    m_ytmp.resize(m_neq);
+    m_f.resize(m_neq);
+    m_V.resize(m + 1);
+    for (size_t i = 0; i <= m; i++) {
+        m_V[i].resize(m_neq);
+    }
+    m_H.resize(m + 1, m, 0.0);
+    m_phi.resize(m + 1);
+    func.getState(m_y.data());
+    m_time = t0;
+    m_h = 0.0;
+    m_hlast = 0.0;
+    m_nevals = 0;
+    m_nsteps = 0;
+    m_haveF = false;
+}
+
+void ExpIntegrator::reinitialize(double t0, FuncEval& func)
+{
+    initialize(t0, func);
+}
+
+void ExpIntegrator::evalRhs(double t, double* y, double* ydot)
+{
+    m_func->eval(t, y, ydot, m_func->m_sens_params.data());
+    m_nevals++;
+}
+
+double ExpIntegrator::errorNorm() const
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < m_neq; i++) {
+        double atol = m_abstol.empty() ? m_abstols : m_abstol[i];
+        double w = atol + m_reltol * std::max(fabs(m_y[i]), fabs(m_ynew[i]));
+        double r = m_err[i] / w;
+        sum += r * r;
+    }
+    return sqrt(sum / m_neq);
+}
+
+size_t ExpIntegrator::arnoldi(double t, double beta)
+{
+    // The Jacobian-vector products are formed matrix-free: with the basis
+    // vectors normalized, J*v is approximated by a forward difference of
+    // the right-hand side along v with an increment scaled to the size of
+    // the state.
+    const double sqrtu = sqrt(std::numeric_limits<double>::epsilon());
+    double ynorm = 0.0;
+    for (size_t i = 0; i < m_neq; i++) {
+        ynorm += m_y[i] * m_y[i];
+    }
+    double eps = sqrtu * (1.0 + sqrt(ynorm));
+
+    size_t mmax = std::min(m_krylovMax, m_neq);
+    for (size_t i = 0; i < m_neq; i++) {
+        m_V[0][i] = m_f[i] / beta;
+    }
+
+    size_t m = mmax;
+    for (size_t j = 0; j < mmax; j++) {
+        for (size_t i = 0; i < m_neq; i++) {
+            m_ytmp[i] = m_y[i] + eps * m_V[j][i];
+        }
+        vector_fp& w = m_V[j + 1];
+        evalRhs(t, m_ytmp.data(), w.data());
+        double reps = 1.0 / eps;
+        for (size_t i = 0; i < m_neq; i++) {
+            w[i] = (w[i] - m_f[i]) * reps;
+        }
+
+        // modified Gram-Schmidt
+        for (size_t i = 0; i <= j; i++) {
+            double hij = dot(m_neq, w.data(), m_V[i].data());
+            m_H(i, j) = hij;
+            for (size_t n = 0; n < m_neq; n++) {
+                w[n] -= hij * m_V[i][n];
+            }
+        }
+        double hnext = sqrt(dot(m_neq, w.data(), w.data()));
+        m_H(j + 1, j) = hnext;
+        if (hnext <= 1.0e-12 * beta) {
+            // happy breakdown: the subspace is invariant and the projected
+            // propagator is exact
+            m = j + 1;
+            break;
+        }
+        double rh = 1.0 / hnext;
+        for (size_t n = 0; n < m_neq; n++) {
+            w[n] *= rh;
+        }
+    }
+    return m;
+}
+
+void ExpIntegrator::phi1(double h, size_t m, vector_fp& phi)
+{
+    // phi_1(hH) e_1 is the top right column of exp([hH, e_1; 0, 0]). The
+    // augmented matrix is scaled by a power of two until its norm is small,
+    // its exponential summed from the Taylor series, and the result squared
+    // back up.
+    size_t n = m + 1;
+    m_expA.resize(n, n, 0.0);
+    std::fill(m_expA.ptrColumn(0), m_expA.ptrColumn(0) + n * n, 0.0);
+    for (size_t j = 0; j < m; j++) {
+        for (size_t i = 0; i < std::min(j + 2, m); i++) {
+            m_expA(i, j) = h * m_H(i, j);
+        }
+    }
+    m_expA(0, m) = 1.0;
+
+    double anorm = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        double rowsum = 0.0;
+        for (size_t j = 0; j < n; j++) {
+            rowsum += fabs(m_expA(i, j));
+        }
+        anorm = std::max(anorm, rowsum);
+    }
+    int s = 0;
+    while (anorm > 0.5) {
+        anorm *= 0.5;
+        s++;
+    }
+    double scale = std::pow(2.0, -s);
+    for (size_t i = 0; i < n * n; i++) {
+        m_expA.ptrColumn(0)[i] *= scale;
+    }
+
+    // Taylor series; with the scaled norm at most 1/2, twenty terms reach
+    // machine precision
+    m_expT.resize(n, n, 0.0);
+    m_expP.resize(n, n, 0.0);
+    DenseMatrix term(m_expA);
+    std::copy(term.ptrColumn(0), term.ptrColumn(0) + n * n,
+              m_expT.ptrColumn(0));
+    for (size_t i = 0; i < n; i++) {
+        m_expT(i, i) += 1.0;
+    }
+    for (int k = 2; k <= 20; k++) {
+        term.mult(m_expA, m_expP);
+        double rk = 1.0 / k;
+        for (size_t i = 0; i < n * n; i++) {
+            term.ptrColumn(0)[i] = m_expP.ptrColumn(0)[i] * rk;
+            m_expT.ptrColumn(0)[i] += term.ptrColumn(0)[i];
+        }
+    }
+    for (int k = 0; k < s; k++) {
+        m_expT.mult(m_expT, m_expP);
+        std::copy(m_expP.ptrColumn(0), m_expP.ptrColumn(0) + n * n,
+                  m_expT.ptrColumn(0));
+    }
+
+    phi.resize(n);
+    for (size_t i = 0; i < m; i++) {
+        phi[i] = m_expT(i, m);
+    }
+    phi[m] = 0.0;
+}
+
+void ExpIntegrator::oneStep(double tmax)
+{
+    if (!m_haveF) {
+        evalRhs(m_time, m_y.data(), m_f.data());
+        m_haveF = true;
+    }
+    double beta = sqrt(dot(m_neq, m_f.data(), m_f.data()));
+    if (beta == 0.0) {
+        // equilibrium: nothing moves over any step
+        m_time = tmax;
+        return;
+    }
+
+    if (m_h <= 0.0) {
+        // Initial step size from the scaled norms of the state and its
+        // derivative, then limited by the remaining integration interval
+        double d0 = 0.0, d1 = 0.0;
+        for (size_t i = 0; i < m_neq; i++) {
+            double atol = m_abstol.empty() ? m_abstols : m_abstol[i];
+            double w = atol + m_reltol * fabs(m_y[i]);
+            d0 += pow(m_y[i] / w, 2);
+            d1 += pow(m_f[i] / w, 2);
+        }
+        d0 = sqrt(d0 / m_neq);
+        d1 = sqrt(d1 / m_neq);
+        if (d0 < 1.0e-5 || d1 < 1.0e-5) {
+            m_h = 1.0e-6 * (tmax - m_time);
+        } else {
+            m_h = 0.01 * d0 / d1;
+        }
+    }
+
+    // The Krylov subspace depends only on the state, not on the step size,
+    // so rejected steps reuse it with a smaller h.
+    size_t m = arnoldi(m_time, beta);
+
+    while (true) {
+        double h = m_h;
+        if (m_hmax > 0.0) {
+            h = std::min(h, m_hmax);
+        }
+        h = std::min(h, tmax - m_time);
+
+        phi1(h, m, m_phi);
+
+        // trial solution y + h*beta*V*phi
+        for (size_t i = 0; i < m_neq; i++) {
+            m_ynew[i] = m_y[i];
+        }
+        for (size_t j = 0; j < m; j++) {
+            double c = h * beta * m_phi[j];
+            for (size_t i = 0; i < m_neq; i++) {
+                m_ynew[i] += c * m_V[j][i];
+            }
+        }
+
+        // The leading term of the difference between the projected and the
+        // true propagator lies along the next Krylov vector, scaled by the
+        // subdiagonal element left out of the projection.
+        double errc = h * beta * m_H(m, m - 1) * fabs(m_phi[m - 1]);
+        for (size_t i = 0; i < m_neq; i++) {
+            m_err[i] = errc * m_V[m][i];
+        }
+
+        double enorm = errorNorm();
+        if (enorm <= 1.0) {
+            m_time += h;
+            m_y = m_ynew;
+            m_haveF = false;
+            m_hlast = h;
+            m_nsteps++;
+            double grow = 0.9 * pow(std::max(enorm, 1.0e-10), -1.0 / 2.0);
+            m_h = h * clip(grow, 0.2, 5.0);
+            return;
+        }
+
+        // Reject: shrink and retry with the same Krylov subspace
+        m_h = h * std::max(0.1, 0.9 * pow(enorm, -1.0 / 2.0));
+        if (m_h < m_hmin || m_time + m_h == m_time) {
+            throw CanteraError("ExpIntegrator::oneStep",
+                "Could not pass the error test with a step of {} at t = {}. "
+                "The Krylov subspace may be too small for this problem; "
+                "use the CVODES integrator instead.", m_h, m_time);
+        }
+    }
+}
+
+void ExpIntegrator::integrate(double tout)
+{
+    if (tout <= m_time) {
+        return;
+    }
+    int nsteps = 0;
+    while (m_time < tout) {
+        if (nsteps++ >= m_maxsteps) {
+            throw CanteraError("ExpIntegrator::integrate",
+                "Maximum number of steps ({}) taken before reaching tout "
+                "({}); t = {}.", m_maxsteps, tout, m_time);
+        }
+        oneStep(tout);
+    }
+}
+
+doublereal ExpIntegrator::step(double tout)
+{
+    if (m_time < tout) {
+        oneStep(tout);
+    }
+    return m_time;
+}
+
+double& ExpIntegrator::solution(size_t k)
+{
+    return m_y[k];
+}
+
+double* ExpIntegrator::solution()
+{
+    return m_y.data();
+}
+
+AnyMap ExpIntegrator::memoryReport() const
+{
+    AnyMap report;
+    report["type"] = std::string("EXP");
+    size_t bytes = vectorBytes(m_y) + vectorBytes(m_ynew) + vectorBytes(m_err)
+                   + vectorBytes(m_ytmp) + vectorBytes(m_f)
+                   + vectorBytes(m_abstol) + vectorBytes(m_phi);
+    for (const auto& v : m_V) {
+        bytes += vectorBytes(v);
+    }
+    report["work-array-bytes"] = static_cast<long int>(bytes);
+    return report;
+}
+
+}
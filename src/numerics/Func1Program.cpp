@@ -0,0 +1,219 @@
+//! @file Func1Program.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/numerics/Func1Program.h"
+#include "cantera/numerics/Func1.h"
+
+namespace Cantera
+{
+
+void Func1Program::compile(const Func1& f)
+{
+    m_ops.clear();
+    emit(f);
+
+    // Determine the deepest value stack eval() will need. If the program
+    // would overflow the fixed evaluation stack, fall back to a single call
+    // into the original tree.
+    size_t depth = 0, maxDepth = 0;
+    for (const auto& op : m_ops) {
+        switch (op.code) {
+        case OP_CONST:
+        case OP_SIN:
+        case OP_COS:
+        case OP_EXP:
+        case OP_POW:
+        case OP_CALL:
+            depth++;
+            maxDepth = std::max(maxDepth, depth);
+            break;
+        case OP_ADD:
+        case OP_SUB:
+        case OP_MUL:
+        case OP_DIV:
+        case OP_RESTOREARG:
+            depth--;
+            break;
+        default:
+            break;
+        }
+    }
+    if (maxDepth > c_maxStack) {
+        m_ops.clear();
+        push(OP_CALL, 0.0, &f);
+    }
+}
+
+void Func1Program::emit(const Func1& f)
+{
+    switch (f.ID()) {
+    case ConstFuncType:
+        push(OP_CONST, f.c());
+        break;
+    case SinFuncType:
+        push(OP_SIN, f.c());
+        break;
+    case CosFuncType:
+        push(OP_COS, f.c());
+        break;
+    case ExpFuncType:
+        push(OP_EXP, f.c());
+        break;
+    case PowFuncType:
+        push(OP_POW, f.c());
+        break;
+    case SumFuncType:
+    case DiffFuncType:
+    case ProdFuncType:
+    case RatioFuncType:
+    {
+        size_t i1 = m_ops.size();
+        emit(f.func1());
+        bool const1 = isConstFrom(i1);
+        size_t i2 = m_ops.size();
+        emit(f.func2());
+        if (const1 && isConstFrom(i2)) {
+            double a = m_ops[i1].c;
+            double b = m_ops[i2].c;
+            m_ops.resize(i1);
+            switch (f.ID()) {
+            case SumFuncType:
+                push(OP_CONST, a + b);
+                break;
+            case DiffFuncType:
+                push(OP_CONST, a - b);
+                break;
+            case ProdFuncType:
+                push(OP_CONST, a * b);
+                break;
+            default:
+                push(OP_CONST, a / b);
+                break;
+            }
+        } else {
+            switch (f.ID()) {
+            case SumFuncType:
+                push(OP_ADD);
+                break;
+            case DiffFuncType:
+                push(OP_SUB);
+                break;
+            case ProdFuncType:
+                push(OP_MUL);
+                break;
+            default:
+                push(OP_DIV);
+                break;
+            }
+        }
+        break;
+    }
+    case TimesConstantFuncType:
+    {
+        size_t i1 = m_ops.size();
+        emit(f.func1());
+        if (isConstFrom(i1)) {
+            m_ops[i1].c *= f.c();
+        } else {
+            push(OP_TIMESC, f.c());
+        }
+        break;
+    }
+    case PlusConstantFuncType:
+    {
+        size_t i1 = m_ops.size();
+        emit(f.func1());
+        if (isConstFrom(i1)) {
+            m_ops[i1].c += f.c();
+        } else {
+            push(OP_PLUSC, f.c());
+        }
+        break;
+    }
+    case CompositeFuncType:
+    {
+        size_t i2 = m_ops.size();
+        emit(f.func2());
+        if (isConstFrom(i2)) {
+            // the inner function is argument-independent, and Func1 objects
+            // are pure functions, so the whole composite is a constant
+            double v = f.func1().eval(m_ops[i2].c);
+            m_ops.resize(i2);
+            push(OP_CONST, v);
+        } else {
+            push(OP_SWAPARG);
+            emit(f.func1());
+            push(OP_RESTOREARG);
+        }
+        break;
+    }
+    default:
+        // no dedicated opcode for this node type; call into the tree
+        push(OP_CALL, 0.0, &f);
+        break;
+    }
+}
+
+double Func1Program::eval(double t) const
+{
+    double stack[c_maxStack];
+    double* sp = stack;
+    double arg = t;
+    for (const auto& op : m_ops) {
+        switch (op.code) {
+        case OP_CONST:
+            *sp++ = op.c;
+            break;
+        case OP_SIN:
+            *sp++ = sin(op.c * arg);
+            break;
+        case OP_COS:
+            *sp++ = cos(op.c * arg);
+            break;
+        case OP_EXP:
+            *sp++ = exp(op.c * arg);
+            break;
+        case OP_POW:
+            *sp++ = pow(arg, op.c);
+            break;
+        case OP_CALL:
+            *sp++ = op.f->eval(arg);
+            break;
+        case OP_ADD:
+            sp[-2] += sp[-1];
+            sp--;
+            break;
+        case OP_SUB:
+            sp[-2] -= sp[-1];
+            sp--;
+            break;
+        case OP_MUL:
+            sp[-2] *= sp[-1];
+            sp--;
+            break;
+        case OP_DIV:
+            sp[-2] /= sp[-1];
+            sp--;
+            break;
+        case OP_TIMESC:
+            sp[-1] *= op.c;
+            break;
+        case OP_PLUSC:
+            sp[-1] += op.c;
+            break;
+        case OP_SWAPARG:
+            std::swap(sp[-1], arg);
+            break;
+        case OP_RESTOREARG:
+            arg = sp[-2];
+            sp[-2] = sp[-1];
+            sp--;
+            break;
+        }
+    }
+    return sp[-1];
+}
+
+}
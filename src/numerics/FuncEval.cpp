@@ -42,6 +42,175 @@ int FuncEval::eval_nothrow(double t, double* y, double* ydot)
     return 0; // successful evaluation
 }
 
+int FuncEval::preconditioner_setup_nothrow(double t, double* y, double gamma)
+{
+    try {
+        preconditionerSetup(t, y, gamma);
+    } catch (CanteraError& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog(err.what());
+        }
+        return 1; // possibly recoverable error
+    } catch (std::exception& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog("FuncEval::preconditioner_setup_nothrow:"
+                     " unhandled exception:\n");
+            writelog(err.what());
+            writelogendl();
+        }
+        return -1; // unrecoverable error
+    }
+    return 0; // successful evaluation
+}
+
+int FuncEval::preconditioner_solve_nothrow(double t, double* y, double* r,
+                                           double* z)
+{
+    try {
+        preconditionerSolve(t, y, r, z);
+    } catch (CanteraError& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog(err.what());
+        }
+        return 1; // possibly recoverable error
+    } catch (std::exception& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog("FuncEval::preconditioner_solve_nothrow:"
+                     " unhandled exception:\n");
+            writelog(err.what());
+            writelogendl();
+        }
+        return -1; // unrecoverable error
+    }
+    return 0; // successful evaluation
+}
+
+int FuncEval::eval_sens_rhs_nothrow(double t, double* y, double* ydot,
+                                    double* const* s, double* const* sdot)
+{
+    try {
+        evalSensRhs(t, y, ydot, s, sdot);
+    } catch (CanteraError& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog(err.what());
+        }
+        return 1; // possibly recoverable error
+    } catch (std::exception& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog("FuncEval::eval_sens_rhs_nothrow: unhandled exception:\n");
+            writelog(err.what());
+            writelogendl();
+        }
+        return -1; // unrecoverable error
+    }
+    return 0; // successful evaluation
+}
+
+int FuncEval::eval_dense_jacobian_nothrow(double t, double* y, double* ydot,
+                                          double* jac)
+{
+    try {
+        evalDenseJacobian(t, y, ydot, jac);
+    } catch (CanteraError& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog(err.what());
+        }
+        return 1; // possibly recoverable error
+    } catch (std::exception& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog("FuncEval::eval_dense_jacobian_nothrow: "
+                     "unhandled exception:\n");
+            writelog(err.what());
+            writelogendl();
+        }
+        return -1; // unrecoverable error
+    }
+    return 0; // successful evaluation
+}
+
+int FuncEval::eval_adjoint_rhs_nothrow(double t, double* y,
+                                       const double* lambda, double* lambdaDot)
+{
+    try {
+        evalAdjointRhs(t, y, lambda, lambdaDot);
+    } catch (CanteraError& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog(err.what());
+        }
+        return 1; // possibly recoverable error
+    } catch (std::exception& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog("FuncEval::eval_adjoint_rhs_nothrow: unhandled exception:\n");
+            writelog(err.what());
+            writelogendl();
+        }
+        return -1; // unrecoverable error
+    }
+    return 0; // successful evaluation
+}
+
+int FuncEval::eval_adjoint_quad_nothrow(double t, double* y,
+                                        const double* lambda, double* qdot)
+{
+    try {
+        evalAdjointQuad(t, y, lambda, qdot);
+    } catch (CanteraError& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog(err.what());
+        }
+        return 1; // possibly recoverable error
+    } catch (std::exception& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog("FuncEval::eval_adjoint_quad_nothrow: unhandled exception:\n");
+            writelog(err.what());
+            writelogendl();
+        }
+        return -1; // unrecoverable error
+    }
+    return 0; // successful evaluation
+}
+
+int FuncEval::eval_roots_nothrow(double t, double* y, double* gout)
+{
+    try {
+        evalRoots(t, y, gout);
+    } catch (std::exception& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog("FuncEval::eval_roots_nothrow: unhandled exception:\n");
+            writelog(err.what());
+            writelogendl();
+        }
+        return -1; // unrecoverable error
+    }
+    return 0; // successful evaluation
+}
+
 std::string FuncEval::getErrors() const {
     std::stringstream errs;
     for (const auto& err : m_errors) {
@@ -17,6 +17,10 @@
         #include "sunlinsol/sunlinsol_dense.h"
         #include "sunlinsol/sunlinsol_band.h"
     #endif
+    #if CT_SUNDIALS_USE_KLU
+        #include "sunlinsol/sunlinsol_klu.h"
+        #include "sunmatrix/sunmatrix_sparse.h"
+    #endif
     #include "sunlinsol/sunlinsol_spgmr.h"
     #include "ida/ida_direct.h"
     #include "ida/ida_spils.h"
@@ -128,6 +132,44 @@ extern "C" {
                           cols, NV_DATA_S(r));
         return 0;
     }
+
+    #if CT_SUNDIALS_USE_KLU
+    //! Function called by IDA to evaluate the Jacobian in compressed sparse
+    //! column form, for use with the KLU linear solver.
+    static int ida_sparse_jacobian(realtype t, realtype c_j, N_Vector y,
+                                   N_Vector yp, N_Vector r, SUNMatrix Jac,
+                                   void *f_data, N_Vector tmp1, N_Vector tmp2,
+                                   N_Vector tmp3)
+    {
+        Cantera::ResidData* d = (Cantera::ResidData*) f_data;
+        Cantera::ResidJacEval* f = d->m_func;
+        Cantera::IDA_Solver* s = d->m_solver;
+        double delta_t = s->getCurrentStepFromIDA();
+        if (SUNMatGetID(Jac) != SUNMATRIX_SPARSE) {
+            return 1; // Unknown SUNMatrix type
+        }
+        // Rewrite the pattern on every call, since IDA may hand over a
+        // matrix whose storage has been reset
+        int neq = f->nEquations();
+        int nnz = f->nJacNonzeros();
+        std::vector<int> colPtrs(neq + 1);
+        std::vector<int> rowVals(nnz);
+        f->getJacobianPattern(colPtrs.data(), rowVals.data());
+        sunindextype* jacColPtrs = SUNSparseMatrix_IndexPointers(Jac);
+        sunindextype* jacRowVals = SUNSparseMatrix_IndexValues(Jac);
+        for (int j = 0; j <= neq; j++) {
+            jacColPtrs[j] = colPtrs[j];
+        }
+        for (int i = 0; i < nnz; i++) {
+            jacRowVals[i] = rowVals[i];
+        }
+        int retn = f->evalJacobianSparse(t, delta_t, c_j, NV_DATA_S(y),
+                                         NV_DATA_S(yp),
+                                         SUNSparseMatrix_Data(Jac),
+                                         NV_DATA_S(r));
+        return (retn < 0) ? retn : 0;
+    }
+    #endif
 #else
     static int ida_jacobian(sd_size_t nrows, realtype t, realtype c_j, N_Vector y, N_Vector ydot, N_Vector r,
                             DlsMat Jac, void* f_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
@@ -271,6 +313,14 @@ void IDA_Solver::setBandedLinearSolver(int m_upper, int m_lower)
     m_mlower = m_lower;
 }
 
+void IDA_Solver::setSparseLinearSolver()
+{
+    m_type = 3;
+    // KLU has no difference quotient fallback; the Jacobian must come from
+    // ResidJacEval::evalJacobianSparse()
+    m_formJac = 1;
+}
+
 void IDA_Solver::setMaxOrder(int n)
 {
     m_maxord = n;
@@ -466,6 +516,39 @@ void IDA_Solver::init(doublereal t0)
         #else
             IDABand(m_ida_mem, N, nu, nl);
         #endif
+    } else if (m_type == 3) {
+        #if CT_SUNDIALS_VERSION >= 30 && CT_SUNDIALS_USE_KLU
+            long int N = m_neq;
+            int nnz = m_resid.nJacNonzeros();
+            if (nnz <= 0) {
+                throw CanteraError("IDA_Solver::init",
+                    "The ResidJacEval object does not supply a Jacobian "
+                    "sparsity pattern (nJacNonzeros() returned {}), which "
+                    "the sparse (KLU) linear solver requires.", nnz);
+            }
+            SUNLinSolFree((SUNLinearSolver) m_linsol);
+            SUNMatDestroy((SUNMatrix) m_linsol_matrix);
+            m_linsol_matrix = SUNSparseMatrix(N, N, nnz, CSC_MAT);
+            if (m_linsol_matrix == nullptr) {
+                throw CanteraError("IDA_Solver::init",
+                    "Unable to create SUNSparseMatrix of size {0} x {0} "
+                    "with {1} nonzeros", N, nnz);
+            }
+            m_linsol = SUNKLU(m_y, (SUNMatrix) m_linsol_matrix);
+            int flag = IDADlsSetLinearSolver(m_ida_mem,
+                                             (SUNLinearSolver) m_linsol,
+                                             (SUNMatrix) m_linsol_matrix);
+            if (flag) {
+                throw CanteraError("IDA_Solver::init",
+                                   "IDADlsSetLinearSolver failed for the "
+                                   "KLU solver");
+            }
+        #else
+            throw CanteraError("IDA_Solver::init",
+                "The sparse (KLU) linear solver requires SUNDIALS 3.0 or "
+                "newer built with KLU support, and Cantera compiled with "
+                "the 'sundials_klu' option enabled.");
+        #endif
     } else {
         throw CanteraError("IDA_Solver::init",
                            "unsupported linear solver type");
@@ -473,7 +556,15 @@ void IDA_Solver::init(doublereal t0)
 
     if (m_formJac == 1) {
         #if CT_SUNDIALS_VERSION >= 30
-            flag = IDADlsSetJacFn(m_ida_mem, ida_jacobian);
+            #if CT_SUNDIALS_USE_KLU
+                if (m_type == 3) {
+                    flag = IDADlsSetJacFn(m_ida_mem, ida_sparse_jacobian);
+                } else {
+                    flag = IDADlsSetJacFn(m_ida_mem, ida_jacobian);
+                }
+            #else
+                flag = IDADlsSetJacFn(m_ida_mem, ida_jacobian);
+            #endif
         #else
             flag = IDADlsSetDenseJacFn(m_ida_mem, ida_jacobian);
         #endif
@@ -0,0 +1,138 @@
+/**
+ *  @file JacobianColoring.cpp
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/numerics/JacobianColoring.h"
+#include "cantera/numerics/DenseMatrix.h"
+#include "cantera/numerics/FuncEval.h"
+
+#include <algorithm>
+
+namespace Cantera
+{
+
+JacobianColoring::JacobianColoring(size_t nRows, size_t nCols) :
+    m_nRows(nRows),
+    m_nCols(nCols),
+    m_rowsOfColumn(nCols),
+    m_colored(false)
+{
+}
+
+void JacobianColoring::addEntry(size_t i, size_t j)
+{
+    if (i >= m_nRows || j >= m_nCols) {
+        throw CanteraError("JacobianColoring::addEntry",
+            "Entry ({}, {}) is outside the {} x {} pattern",
+            i, j, m_nRows, m_nCols);
+    }
+    m_rowsOfColumn[j].push_back(i);
+    m_colored = false;
+}
+
+void JacobianColoring::addBanded(size_t kl, size_t ku)
+{
+    for (size_t j = 0; j < m_nCols; j++) {
+        size_t ibot = (j >= ku) ? j - ku : 0;
+        size_t itop = std::min(j + kl, m_nRows - 1);
+        for (size_t i = ibot; i <= itop; i++) {
+            m_rowsOfColumn[j].push_back(i);
+        }
+    }
+    m_colored = false;
+}
+
+void JacobianColoring::addPattern(
+    const std::vector<std::pair<size_t, size_t>>& pattern)
+{
+    for (const auto& entry : pattern) {
+        addEntry(entry.first, entry.second);
+    }
+}
+
+void JacobianColoring::color()
+{
+    // Remove duplicate entries so the row response attribution in eval() is
+    // done once per structural nonzero.
+    for (size_t j = 0; j < m_nCols; j++) {
+        std::vector<size_t>& rows = m_rowsOfColumn[j];
+        std::sort(rows.begin(), rows.end());
+        rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+    }
+
+    std::vector<std::vector<size_t>> colsOfRow(m_nRows);
+    for (size_t j = 0; j < m_nCols; j++) {
+        for (size_t i : m_rowsOfColumn[j]) {
+            colsOfRow[i].push_back(j);
+        }
+    }
+
+    // Greedy distance-2 coloring: columns sharing any row must differ.
+    // For each column, mark the colors of all columns it conflicts with,
+    // then take the smallest unmarked color.
+    m_colorOfColumn.assign(m_nCols, npos);
+    m_columnsOfColor.clear();
+    std::vector<size_t> lastMarked;
+    for (size_t j = 0; j < m_nCols; j++) {
+        for (size_t i : m_rowsOfColumn[j]) {
+            for (size_t j2 : colsOfRow[i]) {
+                if (m_colorOfColumn[j2] != npos) {
+                    lastMarked[m_colorOfColumn[j2]] = j;
+                }
+            }
+        }
+        size_t c = 0;
+        while (c < m_columnsOfColor.size() && lastMarked[c] == j) {
+            c++;
+        }
+        if (c == m_columnsOfColor.size()) {
+            m_columnsOfColor.emplace_back();
+            lastMarked.push_back(npos);
+        }
+        m_colorOfColumn[j] = c;
+        m_columnsOfColor[c].push_back(j);
+    }
+    m_colored = true;
+}
+
+void JacobianColoring::eval(FuncEval& func, double t, double* y,
+                            const double* ydot, DenseMatrix& jac,
+                            double rtol, double atol)
+{
+    if (func.neq() != m_nRows) {
+        throw CanteraError("JacobianColoring::eval",
+            "Evaluator has {} equations; pattern has {} rows",
+            func.neq(), m_nRows);
+    }
+    if (!m_colored) {
+        color();
+    }
+    jac.resize(m_nRows, m_nCols, 0.0);
+    m_ydotPerturbed.resize(m_nRows);
+    double* p = func.m_sens_params.empty() ? nullptr
+                                           : func.m_sens_params.data();
+    vector_fp ysave(m_nCols);
+    vector_fp dy(m_nCols);
+    for (const std::vector<size_t>& group : m_columnsOfColor) {
+        // Perturb every column of the group at once; since no row touches
+        // two of them, one evaluation yields all of their columns.
+        for (size_t j : group) {
+            ysave[j] = y[j];
+            dy[j] = atol + fabs(y[j]) * rtol;
+            y[j] += dy[j];
+        }
+        func.eval(t, y, m_ydotPerturbed.data(), p);
+        for (size_t j : group) {
+            double rdy = 1.0 / dy[j];
+            for (size_t i : m_rowsOfColumn[j]) {
+                jac(i,j) = (m_ydotPerturbed[i] - ydot[i]) * rdy;
+            }
+            y[j] = ysave[j];
+        }
+    }
+}
+
+}
@@ -6,6 +6,8 @@
 #include "cantera/base/ct_defs.h"
 #include "cantera/numerics/Integrator.h"
 #include "cantera/numerics/CVodesIntegrator.h"
+#include "cantera/numerics/RK45Integrator.h"
+#include "cantera/numerics/ExpIntegrator.h"
 
 namespace Cantera
 {
@@ -14,6 +16,12 @@ Integrator* newIntegrator(const std::string& itype)
 {
     if (itype == "CVODE") {
         return new CVodesIntegrator();
+    } else if (itype == "RK45") {
+        return new RK45Integrator(5);
+    } else if (itype == "RK23") {
+        return new RK45Integrator(3);
+    } else if (itype == "EXP") {
+        return new ExpIntegrator();
     } else {
         throw CanteraError("newIntegrator",
                            "unknown ODE integrator: "+itype);
@@ -0,0 +1,280 @@
+//! @file RK45Integrator.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/numerics/RK45Integrator.h"
+#include "cantera/base/utilities.h"
+
+namespace
+{
+
+// Dormand-Prince 5(4) pair. The seventh stage coefficients equal the fifth
+// order solution weights, so the pair is first-same-as-last and an accepted
+// step costs six fresh right-hand-side evaluations.
+const double dp_a[] = {
+    1.0/5.0,
+    3.0/40.0, 9.0/40.0,
+    44.0/45.0, -56.0/15.0, 32.0/9.0,
+    19372.0/6561.0, -25360.0/2187.0, 64448.0/6561.0, -212.0/729.0,
+    9017.0/3168.0, -355.0/33.0, 46732.0/5247.0, 49.0/176.0, -5103.0/18656.0,
+    35.0/384.0, 0.0, 500.0/1113.0, 125.0/192.0, -2187.0/6784.0, 11.0/84.0
+};
+const double dp_c[] = {0.0, 1.0/5.0, 3.0/10.0, 4.0/5.0, 8.0/9.0, 1.0, 1.0};
+const double dp_e[] = {
+    71.0/57600.0, 0.0, -71.0/16695.0, 71.0/1920.0,
+    -17253.0/339200.0, 22.0/525.0, -1.0/40.0
+};
+
+// Bogacki-Shampine 3(2) pair, also first-same-as-last; an accepted step
+// costs three fresh right-hand-side evaluations.
+const double bs_a[] = {
+    1.0/2.0,
+    0.0, 3.0/4.0,
+    2.0/9.0, 1.0/3.0, 4.0/9.0
+};
+const double bs_c[] = {0.0, 1.0/2.0, 3.0/4.0, 1.0};
+const double bs_e[] = {-5.0/72.0, 1.0/12.0, 1.0/9.0, -1.0/8.0};
+
+} // anonymous namespace
+
+namespace Cantera
+{
+
+RK45Integrator::RK45Integrator(int order) :
+    m_order(order)
+{
+    if (order == 5) {
+        m_stages = 7;
+        m_a = dp_a;
+        m_c = dp_c;
+        m_e = dp_e;
+    } else if (order == 3) {
+        m_stages = 4;
+        m_a = bs_a;
+        m_c = bs_c;
+        m_e = bs_e;
+    } else {
+        throw CanteraError("RK45Integrator::RK45Integrator",
+                           "unsupported order: {}", order);
+    }
+}
+
+void RK45Integrator::setTolerances(double reltol, size_t n, double* abstol)
+{
+    m_reltol = reltol;
+    m_abstol.assign(abstol, abstol + n);
+}
+
+void RK45Integrator::setTolerances(double reltol, double abstol)
+{
+    m_reltol = reltol;
+    m_abstols = abstol;
+    m_abstol.clear();
+}
+
+void RK45Integrator::setMaxStepSize(double hmax)
+{
+    m_hmax = hmax;
+}
+
+void RK45Integrator::setMinStepSize(double hmin)
+{
+    m_hmin = hmin;
+}
+
+void RK45Integrator::setMaxSteps(int nmax)
+{
+    m_maxsteps = nmax;
+}
+
+int RK45Integrator::maxSteps()
+{
+    return m_maxsteps;
+}
+
+void RK45Integrator::initialize(double t0, FuncEval& func)
+{
+    m_func = &func;
+    m_neq = func.neq();
+    if (func.nRoots() > 0) {
+        throw CanteraError("RK45Integrator::initialize",
+            "Root finding is not supported by the explicit Runge-Kutta "
+            "integrator; use the CVODES integrator instead.");
+    }
+    m_y.resize(m_neq);
+    m_ynew.resize(m_neq);
+    m_err.resize(m_neq);
+    m_ytmp.resize(m_neq);
+    m_k.resize(m_stages);
+    for (size_t i = 0; i < m_stages; i++) {
+        m_k[i].resize(m_neq);
+    }
+    func.getState(m_y.data());
+    m_time = t0;
+    m_h = 0.0;
+    m_hlast = 0.0;
+    m_nevals = 0;
+    m_nsteps = 0;
+    m_haveFsal = false;
+}
+
+void RK45Integrator::reinitialize(double t0, FuncEval& func)
+{
+    initialize(t0, func);
+}
+
+void RK45Integrator::evalRhs(double t, double* y, double* ydot)
+{
+    m_func->eval(t, y, ydot, m_func->m_sens_params.data());
+    m_nevals++;
+}
+
+double RK45Integrator::errorNorm() const
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < m_neq; i++) {
+        double atol = m_abstol.empty() ? m_abstols : m_abstol[i];
+        double w = atol + m_reltol * std::max(fabs(m_y[i]), fabs(m_ynew[i]));
+        double r = m_err[i] / w;
+        sum += r * r;
+    }
+    return sqrt(sum / m_neq);
+}
+
+void RK45Integrator::oneStep(double tmax)
+{
+    // First stage: reuse the last stage of the previous accepted step when
+    // possible (both pairs are first-same-as-last)
+    if (!m_haveFsal) {
+        evalRhs(m_time, m_y.data(), m_k[0].data());
+        m_haveFsal = true;
+    }
+
+    if (m_h <= 0.0) {
+        // Initial step size from the scaled norms of the state and its
+        // derivative, then limited by the remaining integration interval
+        double d0 = 0.0, d1 = 0.0;
+        for (size_t i = 0; i < m_neq; i++) {
+            double atol = m_abstol.empty() ? m_abstols : m_abstol[i];
+            double w = atol + m_reltol * fabs(m_y[i]);
+            d0 += pow(m_y[i] / w, 2);
+            d1 += pow(m_k[0][i] / w, 2);
+        }
+        d0 = sqrt(d0 / m_neq);
+        d1 = sqrt(d1 / m_neq);
+        if (d0 < 1.0e-5 || d1 < 1.0e-5) {
+            m_h = 1.0e-6 * (tmax - m_time);
+        } else {
+            m_h = 0.01 * d0 / d1;
+        }
+    }
+
+    while (true) {
+        double h = m_h;
+        if (m_hmax > 0.0) {
+            h = std::min(h, m_hmax);
+        }
+        h = std::min(h, tmax - m_time);
+
+        // Remaining stages. For these first-same-as-last pairs, the final
+        // stage is evaluated at the advanced solution, so the last m_ytmp
+        // is the trial solution itself.
+        const double* a = m_a;
+        for (size_t i = 1; i < m_stages; i++) {
+            for (size_t n = 0; n < m_neq; n++) {
+                double sum = 0.0;
+                for (size_t j = 0; j < i; j++) {
+                    sum += a[j] * m_k[j][n];
+                }
+                m_ytmp[n] = m_y[n] + h * sum;
+            }
+            evalRhs(m_time + m_c[i] * h, m_ytmp.data(), m_k[i].data());
+            a += i;
+        }
+        m_ynew = m_ytmp;
+
+        for (size_t n = 0; n < m_neq; n++) {
+            double sum = 0.0;
+            for (size_t j = 0; j < m_stages; j++) {
+                sum += m_e[j] * m_k[j][n];
+            }
+            m_err[n] = h * sum;
+        }
+
+        double enorm = errorNorm();
+        if (enorm <= 1.0) {
+            // Accept the step; the last stage becomes the first stage of
+            // the next one
+            m_time += h;
+            m_y = m_ynew;
+            m_k[0] = m_k[m_stages - 1];
+            m_hlast = h;
+            m_nsteps++;
+            double grow = 0.9 * pow(std::max(enorm, 1.0e-10),
+                                    -1.0 / m_order);
+            m_h = h * clip(grow, 0.2, 5.0);
+            return;
+        }
+
+        // Reject: shrink and retry from the same state
+        m_h = h * std::max(0.1, 0.9 * pow(enorm, -1.0 / m_order));
+        if (m_h < m_hmin || m_time + m_h == m_time) {
+            throw CanteraError("RK45Integrator::oneStep",
+                "Could not pass the error test with a step of {} at t = {}. "
+                "The problem may be stiff; use the CVODES integrator or "
+                "enable automatic integrator switching.", m_h, m_time);
+        }
+    }
+}
+
+void RK45Integrator::integrate(double tout)
+{
+    if (tout <= m_time) {
+        return;
+    }
+    int nsteps = 0;
+    while (m_time < tout) {
+        if (nsteps++ >= m_maxsteps) {
+            throw CanteraError("RK45Integrator::integrate",
+                "Maximum number of steps ({}) taken before reaching tout "
+                "({}); t = {}. The problem may be stiff; use the CVODES "
+                "integrator or enable automatic integrator switching.",
+                m_maxsteps, tout, m_time);
+        }
+        oneStep(tout);
+    }
+}
+
+doublereal RK45Integrator::step(double tout)
+{
+    if (m_time < tout) {
+        oneStep(tout);
+    }
+    return m_time;
+}
+
+double& RK45Integrator::solution(size_t k)
+{
+    return m_y[k];
+}
+
+double* RK45Integrator::solution()
+{
+    return m_y.data();
+}
+
+AnyMap RK45Integrator::memoryReport() const
+{
+    AnyMap report;
+    report["type"] = std::string("RK45");
+    size_t bytes = vectorBytes(m_y) + vectorBytes(m_ynew) + vectorBytes(m_err)
+                   + vectorBytes(m_ytmp) + vectorBytes(m_abstol);
+    for (const auto& k : m_k) {
+        bytes += vectorBytes(k);
+    }
+    report["work-array-bytes"] = static_cast<long int>(bytes);
+    return report;
+}
+
+}
@@ -152,4 +152,25 @@ int ResidJacEval::evalJacobianDP(const doublereal t, const doublereal delta_t,
     throw NotImplementedError("ResidJacEval::evalJacobianDP");
 }
 
+int ResidJacEval::nJacNonzeros() const
+{
+    return 0;
+}
+
+void ResidJacEval::getJacobianPattern(int* const jacColPtrs,
+                                      int* const jacRowVals) const
+{
+    throw NotImplementedError("ResidJacEval::getJacobianPattern");
+}
+
+int ResidJacEval::evalJacobianSparse(const doublereal t, const doublereal delta_t,
+                                     const doublereal c_j,
+                                     const doublereal* const y,
+                                     const doublereal* const ydot,
+                                     doublereal* const jacValues,
+                                     doublereal* const resid)
+{
+    throw NotImplementedError("ResidJacEval::evalJacobianSparse");
+}
+
 }
@@ -0,0 +1,132 @@
+/**
+ * @file ctlapack.cpp Runtime-selectable BLAS/LAPACK backend. See
+ *     \link Cantera::loadLapackLibrary loadLapackLibrary\endlink.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/ct_defs.h"
+
+#if CT_USE_LAPACK
+
+#include "cantera/numerics/ctlapack.h"
+#include "cantera/base/ctexceptions.h"
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#endif
+
+namespace Cantera
+{
+
+namespace {
+
+std::string backend_name = "built-in";
+
+#ifndef _WIN32
+//! Look up one entry point in the freshly opened backend library, appending
+//! a trailing underscore when the build was configured for that convention.
+template <typename F>
+void bindSymbol(void* handle, const std::string& libName, const char* name,
+                F& slot)
+{
+    std::string sym = name;
+#ifdef LAPACK_FTN_TRAILING_UNDERSCORE
+    sym += "_";
+#endif
+    void* p = dlsym(handle, sym.c_str());
+    if (!p) {
+        throw CanteraError("loadLapackLibrary",
+            "Library '{}' does not export the symbol '{}'.", libName, sym);
+    }
+    slot = reinterpret_cast<F>(p);
+}
+#endif
+
+} // anonymous namespace
+
+LapackFuncs& lapackFuncs()
+{
+    static LapackFuncs funcs = {
+        &_DGEMV_,
+        &_DGETRF_,
+        &_DGETRS_,
+        &_DGETRI_,
+        &_DGELSS_,
+        &_DGBCON_,
+        &_DGBSV_,
+        &_DGBTRF_,
+        &_DGBTRS_,
+        &_SGBTRF_,
+        &_SGBTRS_,
+        &_DGECON_,
+        &_DLANGE_,
+        &_DSCAL_,
+        &_DGEQRF_,
+        &_DORMQR_,
+        &_DTRTRS_,
+        &_DTRCON_,
+        &_DPOTRF_,
+        &_DPOTRS_,
+    };
+    return funcs;
+}
+
+void loadLapackLibrary(const std::string& libName)
+{
+#ifdef _WIN32
+    throw CanteraError("loadLapackLibrary",
+        "Runtime LAPACK backend selection is not supported on Windows; "
+        "link against the desired library at build time instead.");
+#else
+    void* handle = dlopen(libName.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!handle) {
+        throw CanteraError("loadLapackLibrary",
+            "Could not load '{}': {}", libName, dlerror());
+    }
+
+    // Resolve every entry point into a local table first, so that a missing
+    // symbol leaves the active backend unchanged.
+    LapackFuncs funcs;
+    try {
+        bindSymbol(handle, libName, "dgemv", funcs.dgemv);
+        bindSymbol(handle, libName, "dgetrf", funcs.dgetrf);
+        bindSymbol(handle, libName, "dgetrs", funcs.dgetrs);
+        bindSymbol(handle, libName, "dgetri", funcs.dgetri);
+        bindSymbol(handle, libName, "dgelss", funcs.dgelss);
+        bindSymbol(handle, libName, "dgbcon", funcs.dgbcon);
+        bindSymbol(handle, libName, "dgbsv", funcs.dgbsv);
+        bindSymbol(handle, libName, "dgbtrf", funcs.dgbtrf);
+        bindSymbol(handle, libName, "dgbtrs", funcs.dgbtrs);
+        bindSymbol(handle, libName, "sgbtrf", funcs.sgbtrf);
+        bindSymbol(handle, libName, "sgbtrs", funcs.sgbtrs);
+        bindSymbol(handle, libName, "dgecon", funcs.dgecon);
+        bindSymbol(handle, libName, "dlange", funcs.dlange);
+        bindSymbol(handle, libName, "dscal", funcs.dscal);
+        bindSymbol(handle, libName, "dgeqrf", funcs.dgeqrf);
+        bindSymbol(handle, libName, "dormqr", funcs.dormqr);
+        bindSymbol(handle, libName, "dtrtrs", funcs.dtrtrs);
+        bindSymbol(handle, libName, "dtrcon", funcs.dtrcon);
+        bindSymbol(handle, libName, "dpotrf", funcs.dpotrf);
+        bindSymbol(handle, libName, "dpotrs", funcs.dpotrs);
+    } catch (CanteraError&) {
+        dlclose(handle);
+        throw;
+    }
+
+    lapackFuncs() = funcs;
+    backend_name = libName;
+    // The handle is deliberately kept open for the remainder of the process,
+    // since the dispatch table now points into the library.
+#endif
+}
+
+std::string lapackBackendName()
+{
+    return backend_name;
+}
+
+} // namespace Cantera
+
+#endif // CT_USE_LAPACK
@@ -53,4 +53,60 @@ double polyfit(size_t n, size_t deg, const double* xp, const double* yp,
     return (A*p - y).eval().norm() / sqrt(n);
 }
 
+double polyfitShared(size_t n, size_t deg, size_t nfits, const double* xp,
+                     const double* yp, double* pp)
+{
+    if (deg >= n) {
+        throw CanteraError("polyfitShared", "Polynomial degree ({}) must be "
+            "less than number of input data points ({})", deg, n);
+    }
+    if (nfits == 0) {
+        return 0.0;
+    }
+    ConstMappedVector x(xp, n);
+    ConstMappedMatrix Y(yp, n, nfits);
+    MappedMatrix P(pp, deg+1, nfits);
+
+    // Construct A such that each row i of A has the elements
+    // 1, x[i], x[i]^2, x[i]^3 ... + x[i]^deg
+    Eigen::MatrixXd A(n, deg+1);
+    A.col(0).setConstant(1.0);
+    if (deg > 0) {
+        A.col(1) = x;
+    }
+    for (size_t i = 1; i < deg; i++) {
+        A.col(i+1) = A.col(i).array() * x.array();
+    }
+
+    // One factorization serves every right-hand side
+    Eigen::ColPivHouseholderQR<Eigen::MatrixXd> qr(A);
+    P = qr.solve(Y);
+    return (A*P - Y).colwise().norm().maxCoeff() / sqrt(n);
+}
+
+void polyeval(size_t deg, const double* p, size_t n, const double* x,
+              double* y)
+{
+    for (size_t i = 0; i < n; i++) {
+        double r = p[deg];
+        for (size_t d = deg; d-- > 0; ) {
+            r = r * x[i] + p[d];
+        }
+        y[i] = r;
+    }
+}
+
+void polyevalBatch(size_t deg, size_t npoly, const double* p, double x,
+                   double* y)
+{
+    const double* c = p + deg*npoly;
+    std::copy(c, c + npoly, y);
+    for (size_t d = deg; d-- > 0; ) {
+        c -= npoly;
+        for (size_t i = 0; i < npoly; i++) {
+            y[i] = y[i] * x + c[i];
+        }
+    }
+}
+
 }
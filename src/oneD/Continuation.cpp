@@ -0,0 +1,137 @@
+/**
+ * @file Continuation.cpp
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/oneD/Continuation.h"
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/base/global.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+Continuation::Continuation(Sim1D& sim, std::function<void(double)> setParameter)
+    : m_sim(sim)
+    , m_setParameter(setParameter)
+    , m_dpMin(1e-10)
+    , m_dpMax(Undef)
+    , m_refineThreshold(0.05)
+{
+    if (!m_setParameter) {
+        throw CanteraError("Continuation::Continuation",
+                           "A parameter-setting function is required");
+    }
+}
+
+void Continuation::setStepLimits(double dpMin, double dpMax)
+{
+    if (dpMin <= 0.0 || dpMax < dpMin) {
+        throw CanteraError("Continuation::setStepLimits",
+            "Limits must satisfy 0 < dpMin <= dpMax; got {} and {}",
+            dpMin, dpMax);
+    }
+    m_dpMin = dpMin;
+    m_dpMax = dpMax;
+}
+
+bool Continuation::solvePoint(double p, int loglevel)
+{
+    // Keep the pre-step solution so a failed step can be retried with a
+    // smaller parameter increment from the same starting point
+    vector_fp xSave(m_sim.solution(), m_sim.solution() + m_sim.size());
+    m_setParameter(p);
+    try {
+        m_sim.solve(loglevel, false);
+    } catch (CanteraError&) {
+        m_sim.setSolution(xSave.data());
+        return false;
+    }
+
+    // Refine only when the solution has moved appreciably since the grid
+    // was last adapted. While it has not, successive curve points reuse
+    // the existing grid and skip the refinement cost.
+    bool moved = (m_xRefined.size() != m_sim.size());
+    for (size_t i = 0; !moved && i < m_xRefined.size(); i++) {
+        double scale = 1e-9 + m_refineThreshold * fabs(m_xRefined[i]);
+        moved = (fabs(m_sim.solution()[i] - m_xRefined[i]) > scale);
+    }
+    if (moved) {
+        try {
+            m_sim.solve(loglevel, true);
+        } catch (CanteraError&) {
+            m_sim.setSolution(xSave.data());
+            return false;
+        }
+        m_xRefined.assign(m_sim.solution(), m_sim.solution() + m_sim.size());
+    }
+    return true;
+}
+
+size_t Continuation::solve(double pStart, double pEnd, double dp0, int loglevel)
+{
+    if (dp0 == 0.0 || (pEnd - pStart) * dp0 < 0.0) {
+        throw CanteraError("Continuation::solve",
+            "Initial step {} does not advance the parameter from {} to {}",
+            dp0, pStart, pEnd);
+    }
+    double dpMax = (m_dpMax == Undef ? fabs(pEnd - pStart) : m_dpMax);
+    double direction = (dp0 > 0.0 ? 1.0 : -1.0);
+
+    m_params.clear();
+    m_solutions.clear();
+    m_xRefined.clear();
+
+    // Establish the starting point of the curve, including an initial
+    // refinement, from whatever solution estimate the simulation holds
+    if (!solvePoint(pStart, loglevel)) {
+        return 0;
+    }
+    m_params.push_back(pStart);
+    m_solutions.emplace_back(m_sim.solution(),
+                             m_sim.solution() + m_sim.size());
+
+    double p = pStart;
+    double dp = fabs(dp0);
+    while (direction * (pEnd - p) > 0.0) {
+        double pNext = p + direction * dp;
+        if (direction * (pNext - pEnd) > 0.0) {
+            pNext = pEnd;
+        }
+        if (solvePoint(pNext, loglevel)) {
+            p = pNext;
+            m_params.push_back(p);
+            m_solutions.emplace_back(m_sim.solution(),
+                                     m_sim.solution() + m_sim.size());
+            dp = std::min(1.5 * dp, dpMax);
+            if (loglevel > 0) {
+                writelog("Continuation: converged at parameter {:14.6g} "
+                         "({} points)\n", p, m_params.size());
+            }
+        } else {
+            dp *= 0.5;
+            if (loglevel > 0) {
+                writelog("Continuation: step to {:14.6g} failed; "
+                         "reducing step to {:14.6g}\n", pNext, dp);
+            }
+            if (dp < m_dpMin) {
+                // Most likely a turning point of the response curve; the
+                // points computed so far are kept
+                if (loglevel > 0) {
+                    writelog("Continuation: stopping at parameter {:14.6g}; "
+                             "step size underflow\n", p);
+                }
+                break;
+            }
+        }
+    }
+    // Leave the simulation holding the last converged point
+    m_setParameter(p);
+    m_sim.setSolution(m_solutions.back().data());
+    return m_params.size();
+}
+
+}
@@ -53,6 +53,15 @@ void Domain1D::resize(size_t nv, size_t np)
     m_rtol_ts.resize(m_nv, 1.0e-4);
     m_atol_ts.resize(m_nv, 1.0e-11);
     m_points = np;
+    // Grid refinement grows the domain a few points at a time; growing the
+    // reserved capacity geometrically (with headroom) lets the repeated
+    // point insertions reuse the existing allocations, so a typical
+    // refinement cycle never reallocates the per-point arrays.
+    if (m_z.capacity() < np) {
+        size_t cap = std::max(np + np/4 + 8, 2*m_z.capacity());
+        m_z.reserve(cap);
+        m_slast.reserve(m_nv * cap);
+    }
     m_z.resize(np, 0.0);
     m_slast.resize(m_nv * m_points, 0.0);
     locate();
@@ -5,6 +5,7 @@
 
 #include "cantera/oneD/IonFlow.h"
 #include "cantera/oneD/StFlow.h"
+#include "cantera/oneD/OneDim.h"
 #include "cantera/oneD/refine.h"
 #include "cantera/base/ctml.h"
 #include "cantera/transport/TransportBase.h"
@@ -56,6 +57,7 @@ IonFlow::IonFlow(IdealGasPhase* ph, size_t nsp, size_t points) :
     m_refiner->setActive(c_offset_E, false);
     m_mobility.resize(m_nsp*m_points);
     m_do_electric_field.resize(m_points,false);
+    m_Efield.resize(m_points, 0.0);
 }
 
 void IonFlow::resize(size_t components, size_t points){
@@ -63,20 +65,18 @@ void IonFlow::resize(size_t components, size_t points){
     m_mobility.resize(m_nsp*m_points);
     m_do_species.resize(m_nsp,true);
     m_do_electric_field.resize(m_points,false);
+    m_Efield.resize(m_points, 0.0);
 }
 
-void IonFlow::updateTransport(double* x, size_t j0, size_t j1)
+void IonFlow::updateTransportPoint(ThermoPhase& gas, Transport& trans,
+                                   size_t j)
 {
-    StFlow::updateTransport(x,j0,j1);
-    for (size_t j = j0; j < j1; j++) {
-        setGasAtMidpoint(x,j);
-        m_trans->getMobilities(&m_mobility[j*m_nsp]);
-        if (m_import_electron_transport) {
-            size_t k = m_kElectron;
-            double tlog = log(m_thermo->temperature());
-            m_mobility[k+m_nsp*j] = poly5(tlog, m_mobi_e_fix.data());
-            m_diff[k+m_nsp*j] = poly5(tlog, m_diff_e_fix.data());
-        }
+    trans.getMobilities(&m_mobility[j*m_nsp]);
+    if (m_import_electron_transport) {
+        size_t k = m_kElectron;
+        double tlog = log(gas.temperature());
+        m_mobility[k+m_nsp*j] = poly5(tlog, m_mobi_e_fix.data());
+        m_diff[k+m_nsp*j] = poly5(tlog, m_diff_e_fix.data());
     }
 }
 
@@ -119,6 +119,14 @@ void IonFlow::frozenIonMethod(const double* x, size_t j0, size_t j1)
 
 void IonFlow::electricFieldMethod(const double* x, size_t j0, size_t j1)
 {
+    // Refresh the segregated field solution, unless properties are being
+    // held fixed for a Jacobian evaluation (in which case the field from
+    // the last full residual evaluation is reused, so that the
+    // charge-density coupling stays out of the Jacobian band).
+    if (!m_container || !m_container->jacobianBeingEvaluated()) {
+        solveEfield(x);
+    }
+
     for (size_t j = j0; j < j1; j++) {
         double wtm = m_wtm[j];
         double rho = density(j);
@@ -133,7 +141,7 @@ void IonFlow::electricFieldMethod(const double* x, size_t j0, size_t j1)
         }
 
         // ambipolar diffusion
-        double E_ambi = E(x,j);
+        double E_ambi = m_Efield[j];
         for (size_t k : m_kCharge) {
             double Yav = 0.5 * (Y(x,k,j) + Y(x,k,j+1));
             double drift = rho * Yav * E_ambi
@@ -185,22 +193,32 @@ void IonFlow::evalResidual(double* x, double* rsd, int* diag,
             for (size_t k : m_kCharge) {
                 rsd[index(c_offset_Y + k, 0)] = Y(x,k,0) - Y(x,k,1);
             }
-            rsd[index(c_offset_E, j)] = E(x,0);
-            diag[index(c_offset_E, j)] = 0;
-        } else if (j == m_points - 1) {
-            rsd[index(c_offset_E, j)] = dEdz(x,j) - rho_e(x,j) / epsilon_0;
-            diag[index(c_offset_E, j)] = 0;
-        } else {
-            //-----------------------------------------------
-            //    Electric field by Gauss's law
-            //
-            //    dE/dz = e/eps_0 * sum(q_k*n_k)
-            //
-            //    E = -dV/dz
-            //-----------------------------------------------
-            rsd[index(c_offset_E, j)] = dEdz(x,j) - rho_e(x,j) / epsilon_0;
-            diag[index(c_offset_E, j)] = 0;
         }
+        // The electric field component tracks the segregated solution of
+        // Gauss's law computed by solveEfield(), which leaves only a
+        // diagonal entry in the Jacobian for this equation.
+        rsd[index(c_offset_E, j)] = E(x,j) - m_Efield[j];
+        diag[index(c_offset_E, j)] = 0;
+    }
+}
+
+void IonFlow::solveEfield(const double* x)
+{
+    //-----------------------------------------------
+    //    Electric field by Gauss's law
+    //
+    //    dE/dz = e/eps_0 * sum(q_k*n_k)
+    //
+    //    E = -dV/dz
+    //-----------------------------------------------
+    // With the backward-difference discretization of dE/dz and the E = 0
+    // condition at the left boundary, the discrete field equations form a
+    // lower-bidiagonal system, for which the Thomas elimination reduces to
+    // this forward-substitution sweep.
+    m_Efield[0] = 0.0;
+    for (size_t j = 1; j < m_points; j++) {
+        m_Efield[j] = m_Efield[j-1]
+                      + (z(j) - z(j-1)) * rho_e(x,j) / epsilon_0;
     }
 }
 
@@ -4,6 +4,7 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/oneD/MultiJac.h"
+#include "cantera/base/Profiler.h"
 #include <ctime>
 
 using namespace std;
@@ -23,12 +24,17 @@ MultiJac::MultiJac(OneDim& r)
     m_elapsed = 0.0;
     m_nevals = 0;
     m_age = 100000;
+    m_changeCount = 0;
     m_atol = sqrt(std::numeric_limits<double>::epsilon());
     m_rtol = 1.0e-5;
+    m_partialRefresh = false;
+    m_refreshTol = 1.0e-3;
+    m_rdtlast = -1.0;
 }
 
 void MultiJac::updateTransient(doublereal rdt, integer* mask)
 {
+    m_changeCount++;
     for (size_t n = 0; n < m_size; n++) {
         value(n,n) = m_ssdiag[n] - mask[n]*rdt;
     }
@@ -36,53 +42,201 @@ void MultiJac::updateTransient(doublereal rdt, integer* mask)
 
 void MultiJac::incrementDiagonal(int j, doublereal d)
 {
+    m_changeCount++;
     m_ssdiag[j] += d;
     value(j,j) = m_ssdiag[j];
 }
 
 void MultiJac::eval(doublereal* x0, doublereal* resid0, doublereal rdt)
 {
+    CT_PROFILE_SCOPE("MultiJac::eval");
     m_nevals++;
+    m_changeCount++;
     clock_t t0 = clock();
+
+    // When partial refresh is enabled and a full Jacobian at this time-step
+    // size already exists, only recompute the columns of points whose state
+    // has moved since their columns were last evaluated.
+    if (m_partialRefresh && m_xlast.size() == m_size && rdt == m_rdtlast) {
+        // flag points whose state moved beyond the refresh tolerance
+        vector_int changed(m_points, 0);
+        for (size_t j = 0; j < m_points; j++) {
+            size_t iloc = m_resid->loc(j);
+            for (size_t n = 0; n < m_resid->nVars(j); n++) {
+                if (fabs(x0[iloc+n] - m_xlast[iloc+n]) >
+                        m_refreshTol*fabs(m_xlast[iloc+n]) + m_atol) {
+                    changed[j] = 1;
+                    break;
+                }
+            }
+        }
+
+        // The entries of the columns at point j depend on the base solution
+        // over the residual stencils of points j-1 through j+1, so a change
+        // at one point stales the columns of all points within two of it.
+        vector_int stale(m_points, 0);
+        size_t nstale = 0;
+        for (size_t j = 0; j < m_points; j++) {
+            if (changed[j]) {
+                size_t first = (j >= 2) ? j - 2 : 0;
+                size_t last = std::min(j + 2, m_points - 1);
+                for (size_t i = first; i <= last; i++) {
+                    stale[i] = 1;
+                }
+            }
+        }
+        for (size_t j = 0; j < m_points; j++) {
+            nstale += stale[j];
+        }
+
+        // A stale column costs one single-point residual evaluation per
+        // component, while the grouped evaluation below costs three full
+        // residual evaluations per component, so partial refresh only wins
+        // while the stale region is a small fraction of the grid.
+        if (3*nstale < m_points) {
+            m_resid->setJacobianBeingEvaluated(true);
+            try {
+                for (size_t j = 0; j < m_points; j++) {
+                    if (!stale[j]) {
+                        continue;
+                    }
+                    size_t iloc = m_resid->loc(j);
+                    for (size_t n = 0; n < m_resid->nVars(j); n++) {
+                        size_t ipt = iloc + n;
+                        double xsave = x0[ipt];
+                        double dx;
+                        if (xsave >= 0) {
+                            dx = xsave*m_rtol + m_atol;
+                        } else {
+                            dx = xsave*m_rtol - m_atol;
+                        }
+                        x0[ipt] = xsave + dx;
+                        double rdx = 1.0/(x0[ipt] - xsave);
+
+                        // single-point residual evaluation; only the entries
+                        // at points j-1 through j+1 of m_r1 are meaningful
+                        m_resid->eval(j, x0, m_r1.data(), rdt, 0);
+                        for (size_t i = j - 1; i != j+2; i++) {
+                            if (i != npos && i < m_points) {
+                                size_t mv = m_resid->nVars(i);
+                                size_t il = m_resid->loc(i);
+                                for (size_t m = 0; m < mv; m++) {
+                                    value(m+il,ipt) =
+                                        (m_r1[m+il] - resid0[m+il])*rdx;
+                                }
+                            }
+                        }
+                        x0[ipt] = xsave;
+                    }
+                }
+            } catch (...) {
+                m_resid->setJacobianBeingEvaluated(false);
+                throw;
+            }
+            m_resid->setJacobianBeingEvaluated(false);
+
+            // record the base state of the refreshed columns; untouched
+            // points keep the state at their last refresh, so that slow
+            // drifts still trigger a recomputation eventually
+            for (size_t j = 0; j < m_points; j++) {
+                if (stale[j]) {
+                    size_t iloc = m_resid->loc(j);
+                    for (size_t n = 0; n < m_resid->nVars(j); n++) {
+                        m_ssdiag[iloc+n] = value(iloc+n,iloc+n);
+                        m_xlast[iloc+n] = x0[iloc+n];
+                    }
+                }
+            }
+            m_elapsed += double(clock() - t0)/CLOCKS_PER_SEC;
+            m_age = 0;
+            return;
+        }
+    }
+
     bfill(0.0);
-    size_t ipt=0;
 
+    // The columns of the Jacobian are evaluated in groups, chosen so that one
+    // residual evaluation determines all of the columns in a group at once.
+    // The residual at a grid point depends only on the solution at that point
+    // and its two neighbors, so perturbations of the same solution component
+    // at grid points j and j' influence disjoint sets of residual equations
+    // whenever |j - j'| >= 3. Perturbing one component at every third grid
+    // point and evaluating the full residual once per group therefore
+    // replaces the one (partial) residual evaluation per column of the
+    // previous implementation, reducing the number of evaluations from the
+    // number of unknowns to three times the number of solution components.
+    size_t nv_max = 0;
     for (size_t j = 0; j < m_points; j++) {
-        size_t nv = m_resid->nVars(j);
-        for (size_t n = 0; n < nv; n++) {
-            // perturb x(n); preserve sign(x(n))
-            double xsave = x0[ipt];
-            double dx;
-            if (xsave >= 0) {
-                dx = xsave*m_rtol + m_atol;
-            } else {
-                dx = xsave*m_rtol - m_atol;
-            }
-            x0[ipt] = xsave + dx;
-            dx = x0[ipt] - xsave;
-            double rdx = 1.0/dx;
-
-            // calculate perturbed residual
-            m_resid->eval(j, x0, m_r1.data(), rdt, 0);
-
-            // compute nth column of Jacobian
-            for (size_t i = j - 1; i != j+2; i++) {
-                if (i != npos && i < m_points) {
-                    size_t mv = m_resid->nVars(i);
-                    size_t iloc = m_resid->loc(i);
-                    for (size_t m = 0; m < mv; m++) {
-                        value(m+iloc,ipt) = (m_r1[m+iloc] - resid0[m+iloc])*rdx;
+        nv_max = std::max(nv_max, m_resid->nVars(j));
+    }
+
+    vector_fp xsave(m_points); // unperturbed components, by grid point
+    vector_fp rdx(m_points); // reciprocal perturbations, by grid point
+    // Let the domains know that the full residual evaluations below are part
+    // of a Jacobian evaluation, so that properties normally held fixed while
+    // the Jacobian is computed (such as transport coefficients) stay frozen.
+    m_resid->setJacobianBeingEvaluated(true);
+    try {
+        for (size_t n = 0; n < nv_max; n++) {
+            for (size_t c = 0; c < 3; c++) {
+                // perturb component n at grid points j = c, c+3, c+6, ...;
+                // preserve sign(x(n))
+                bool anyPerturbed = false;
+                for (size_t j = c; j < m_points; j += 3) {
+                    if (n >= m_resid->nVars(j)) {
+                        continue;
+                    }
+                    size_t ipt = m_resid->loc(j) + n;
+                    xsave[j] = x0[ipt];
+                    double dx;
+                    if (xsave[j] >= 0) {
+                        dx = xsave[j]*m_rtol + m_atol;
+                    } else {
+                        dx = xsave[j]*m_rtol - m_atol;
+                    }
+                    x0[ipt] = xsave[j] + dx;
+                    rdx[j] = 1.0/(x0[ipt] - xsave[j]);
+                    anyPerturbed = true;
+                }
+                if (!anyPerturbed) {
+                    continue;
+                }
+
+                // calculate perturbed residual
+                m_resid->eval(npos, x0, m_r1.data(), rdt, 0);
+
+                // compute the columns of the Jacobian determined by this group,
+                // and restore the perturbed components
+                for (size_t j = c; j < m_points; j += 3) {
+                    if (n >= m_resid->nVars(j)) {
+                        continue;
+                    }
+                    size_t ipt = m_resid->loc(j) + n;
+                    for (size_t i = j - 1; i != j+2; i++) {
+                        if (i != npos && i < m_points) {
+                            size_t mv = m_resid->nVars(i);
+                            size_t iloc = m_resid->loc(i);
+                            for (size_t m = 0; m < mv; m++) {
+                                value(m+iloc,ipt) =
+                                    (m_r1[m+iloc] - resid0[m+iloc])*rdx[j];
+                            }
+                        }
                     }
+                    x0[ipt] = xsave[j];
                 }
             }
-            x0[ipt] = xsave;
-            ipt++;
         }
+    } catch (...) {
+        m_resid->setJacobianBeingEvaluated(false);
+        throw;
     }
+    m_resid->setJacobianBeingEvaluated(false);
 
     for (size_t n = 0; n < m_size; n++) {
         m_ssdiag[n] = value(n,n);
     }
+    m_xlast.assign(x0, x0 + m_size);
+    m_rdtlast = rdt;
 
     m_elapsed += double(clock() - t0)/CLOCKS_PER_SEC;
     m_age = 0;
@@ -5,8 +5,11 @@
 
 #include "cantera/oneD/MultiNewton.h"
 #include "cantera/base/utilities.h"
+#include "cantera/base/Profiler.h"
+#include "cantera/base/ThreadPool.h"
 
 #include <ctime>
+#include <thread>
 
 using namespace std;
 
@@ -27,17 +30,80 @@ public:
     }
 };
 
+//! Minimum number of entries in a single-domain reduction before it is worth
+//! dispatching to the thread pool; below this, scheduling the tasks costs
+//! more than the loop.
+const size_t minParallelWork = 50000;
+
+//! Resolve the thread count configured with OneDim::setEvalThreads(), with 0
+//! meaning all available hardware threads, matching OneDim::eval().
+size_t reduction_threads(const OneDim& r)
+{
+    size_t n = r.evalThreads();
+    if (n == 0) {
+        n = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return n;
+}
+
+//! Run *f(t, first, last)* over the component range [0, nv), split into
+//! *nThreads* tasks on the shared thread pool; *t* is the task index, for
+//! writing per-task partial results. The first exception thrown by any task
+//! is rethrown on the calling thread.
+template <class Func>
+void run_over_components(size_t nv, size_t nThreads, Func f)
+{
+    size_t chunk = nv/nThreads + 1;
+    ThreadPool::shared().run(nThreads, [&](size_t t) {
+        size_t first = t*chunk;
+        size_t last = std::min(first + chunk, nv);
+        if (first < last) {
+            f(t, first, last);
+        }
+    });
+}
+
 /**
  * Return a damping coefficient that keeps the solution after taking one
  * Newton step between specified lower and upper bounds. This function only
  * considers one domain.
  */
 doublereal bound_step(const doublereal* x, const doublereal* step,
-                      Domain1D& r, int loglevel)
+                      Domain1D& r, int loglevel, size_t nThreads)
 {
     size_t np = r.nPoints();
     size_t nv = r.nComponents();
     Indx index(nv, np);
+
+    // Each component's bound search is independent, so the search for the
+    // most restrictive damping coefficient can be split across threads. The
+    // threaded path is only taken when no diagnostic output was requested, so
+    // that the log messages below keep their sequential ordering.
+    nThreads = std::min(nThreads, nv);
+    if (loglevel == 0 && nThreads > 1 && nv*np >= minParallelWork) {
+        vector_fp partial(nThreads, 1.0);
+        run_over_components(nv, nThreads,
+                            [&](size_t t, size_t first, size_t last) {
+            double fb = 1.0;
+            for (size_t m = first; m < last; m++) {
+                double above = r.upperBound(m);
+                double below = r.lowerBound(m);
+                for (size_t j = 0; j < np; j++) {
+                    double val = x[index(m,j)];
+                    double newval = val + step[index(m,j)];
+                    if (newval > above) {
+                        fb = std::max(0.0, std::min(fb,
+                                                    (above - val)/(newval - val)));
+                    } else if (newval < below) {
+                        fb = std::min(fb, (val - below)/(val - newval));
+                    }
+                }
+            }
+            partial[t] = fb;
+        });
+        return *min_element(partial.begin(), partial.end());
+    }
+
     doublereal fbound = 1.0;
     bool wroteTitle = false;
     for (size_t m = 0; m < nv; m++) {
@@ -100,26 +166,41 @@ doublereal bound_step(const doublereal* x, const doublereal* step,
  * component n.
  */
 doublereal norm_square(const doublereal* x,
-                       const doublereal* step, Domain1D& r)
+                       const doublereal* step, Domain1D& r, size_t nThreads)
 {
-    double sum = 0.0;
-    doublereal f2max = 0.0;
     size_t nv = r.nComponents();
     size_t np = r.nPoints();
 
-    for (size_t n = 0; n < nv; n++) {
-        double esum = 0.0;
-        for (size_t j = 0; j < np; j++) {
-            esum += fabs(x[nv*j + n]);
-        }
-        double ewt = r.rtol(n)*esum/np + r.atol(n);
-        for (size_t j = 0; j < np; j++) {
-            double f = step[nv*j + n]/ewt;
-            sum += f*f;
-            f2max = std::max(f*f, f2max);
+    // The error weight and partial sum for each component are independent of
+    // the other components, so the reduction can be split across threads;
+    // each worker accumulates its own partial sum, which are added together
+    // after the join so the result does not depend on thread scheduling.
+    auto componentSum = [&](size_t first, size_t last) {
+        double sum = 0.0;
+        for (size_t n = first; n < last; n++) {
+            double esum = 0.0;
+            for (size_t j = 0; j < np; j++) {
+                esum += fabs(x[nv*j + n]);
+            }
+            double ewt = r.rtol(n)*esum/np + r.atol(n);
+            for (size_t j = 0; j < np; j++) {
+                double f = step[nv*j + n]/ewt;
+                sum += f*f;
+            }
         }
+        return sum;
+    };
+
+    nThreads = std::min(nThreads, nv);
+    if (nThreads > 1 && nv*np >= minParallelWork) {
+        vector_fp partial(nThreads, 0.0);
+        run_over_components(nv, nThreads,
+                            [&](size_t t, size_t first, size_t last) {
+            partial[t] = componentSum(first, last);
+        });
+        return accumulate(partial.begin(), partial.end(), 0.0);
     }
-    return sum;
+    return componentSum(0, nv);
 }
 
 } // end unnamed-namespace
@@ -146,13 +227,40 @@ void MultiNewton::resize(size_t sz)
     m_stp1.resize(m_n);
 }
 
+void MultiNewton::autoSelectLinearSolver(OneDim& r)
+{
+    if (m_solverExplicit || r.size() == 0) {
+        return;
+    }
+
+    // Approximate flop counts for the two factorizations. The banded LU
+    // costs about 2*bw^2 per row, with every row paying for the global
+    // maximum bandwidth. The block Thomas algorithm factors each grid-point
+    // block as a dense matrix and forms two block products per point, about
+    // (7/3)*nv^3 per point, so points in small domains are not penalized for
+    // the bandwidth set by a large one.
+    doublereal bandCost = 2.0 * r.size() * r.bandwidth() * r.bandwidth();
+    doublereal blockCost = 0.0;
+    for (size_t j = 0; j < r.points(); j++) {
+        doublereal nv = static_cast<doublereal>(r.nVars(j));
+        blockCost += (7.0/3.0) * nv * nv * nv;
+    }
+
+    // For uniform domains the estimates are within a small factor of each
+    // other; require a clear advantage before giving up the banded solver,
+    // which pivots across the whole band.
+    m_blockSolve = (bandCost > 4.0 * blockCost);
+}
+
 doublereal MultiNewton::norm2(const doublereal* x,
                               const doublereal* step, OneDim& r) const
 {
     double sum = 0.0;
     size_t nd = r.nDomains();
+    size_t nThreads = reduction_threads(r);
     for (size_t n = 0; n < nd; n++) {
-        double f = norm_square(x + r.start(n), step + r.start(n), r.domain(n));
+        double f = norm_square(x + r.start(n), step + r.start(n), r.domain(n),
+                               nThreads);
         sum += f;
     }
     sum /= r.size();
@@ -166,8 +274,35 @@ void MultiNewton::step(doublereal* x, doublereal* step,
     for (size_t n = 0; n < r.size(); n++) {
         step[n] = -step[n];
     }
+    jac.setMixedPrecision(m_mixedPrecision);
+
+    if (m_krylovSolve) {
+        stepKrylov(x, step, r, jac);
+        return;
+    }
+
+    if (m_blockSolve) {
+        // Refactor only when the Jacobian has changed since the last block
+        // factorization, so that the factors are reused over the damped
+        // Newton iterations in the same way as the banded factorization.
+        if (m_jacChangeCount != jac.changeCount()
+            || m_blockSolver.size() != r.size()) {
+            std::vector<size_t> blockSizes(r.points());
+            for (size_t j = 0; j < r.points(); j++) {
+                blockSizes[j] = r.nVars(j);
+            }
+            m_blockSolver.resize(blockSizes);
+            CT_PROFILE_SCOPE("MultiNewton::factor");
+            m_blockSolver.factor(jac);
+            m_jacChangeCount = jac.changeCount();
+        }
+        CT_PROFILE_SCOPE("MultiNewton::solve");
+        m_blockSolver.solve(step, step);
+        return;
+    }
 
     try {
+        CT_PROFILE_SCOPE("MultiNewton::solve");
         jac.solve(step, step);
     } catch (CanteraError&) {
         int iok = jac.info() - 1;
@@ -193,14 +328,158 @@ void MultiNewton::step(doublereal* x, doublereal* step,
     }
 }
 
+void MultiNewton::stepKrylov(doublereal* x, doublereal* step,
+                             OneDim& r, MultiJac& jac)
+{
+    // On entry, step holds the right-hand side b = -F(x) of the Newton
+    // system J*step = b. The system is solved with right-preconditioned
+    // GMRES: products with J come from finite differences of the residual,
+    // and the banded factorization held by jac (which may be several
+    // iterations old) serves only as the preconditioner.
+    size_t n = m_n;
+    size_t mmax = std::min(m_krylovMax, n);
+    m_kryB.assign(step, step + n);
+
+    double beta = 0.0;
+    double xnorm = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        beta += m_kryB[i]*m_kryB[i];
+        xnorm += x[i]*x[i];
+    }
+    beta = sqrt(beta);
+    xnorm = sqrt(xnorm);
+    if (beta == 0.0) {
+        // The residual is already zero, and so is the step
+        return;
+    }
+
+    m_kryV.resize(mmax + 1);
+    m_kryZ.resize(n);
+    m_xPert.resize(n);
+    m_fPert.resize(n);
+    for (auto& v : m_kryV) {
+        v.resize(n);
+    }
+    // Hessenberg matrix (column-major, mmax+1 rows) and the Givens
+    // rotations that keep it triangular
+    vector_fp H((mmax + 1) * mmax, 0.0);
+    vector_fp cs(mmax), sn(mmax), g(mmax + 1, 0.0);
+    g[0] = beta;
+    for (size_t i = 0; i < n; i++) {
+        m_kryV[0][i] = m_kryB[i] / beta;
+    }
+
+    size_t m = 0;
+    for (size_t j = 0; j < mmax; j++) {
+        // w = J * M^{-1} * v_j, with the matrix-vector product formed by a
+        // forward difference of the residual about the current solution
+        jac.solve(m_kryV[j].data(), m_kryZ.data());
+        double znorm = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            znorm += m_kryZ[i]*m_kryZ[i];
+        }
+        znorm = sqrt(znorm);
+        vector_fp& w = m_kryV[j+1];
+        if (znorm == 0.0) {
+            fill(w.begin(), w.end(), 0.0);
+        } else {
+            double eps = sqrt(std::numeric_limits<double>::epsilon())
+                         * (1.0 + xnorm) / znorm;
+            for (size_t i = 0; i < n; i++) {
+                m_xPert[i] = x[i] + eps*m_kryZ[i];
+            }
+            r.eval(npos, m_xPert.data(), m_fPert.data());
+            for (size_t i = 0; i < n; i++) {
+                // F(x) = -b
+                w[i] = (m_fPert[i] + m_kryB[i]) / eps;
+            }
+        }
+
+        // Modified Gram-Schmidt orthogonalization
+        double* h = &H[j*(mmax + 1)];
+        for (size_t i = 0; i <= j; i++) {
+            double hij = 0.0;
+            for (size_t l = 0; l < n; l++) {
+                hij += w[l]*m_kryV[i][l];
+            }
+            h[i] = hij;
+            for (size_t l = 0; l < n; l++) {
+                w[l] -= hij*m_kryV[i][l];
+            }
+        }
+        double wnorm = 0.0;
+        for (size_t l = 0; l < n; l++) {
+            wnorm += w[l]*w[l];
+        }
+        wnorm = sqrt(wnorm);
+        h[j+1] = wnorm;
+
+        // Apply the previous Givens rotations to the new column, then
+        // compute the rotation that eliminates the subdiagonal entry
+        for (size_t i = 0; i < j; i++) {
+            double t = cs[i]*h[i] + sn[i]*h[i+1];
+            h[i+1] = -sn[i]*h[i] + cs[i]*h[i+1];
+            h[i] = t;
+        }
+        double denom = sqrt(h[j]*h[j] + h[j+1]*h[j+1]);
+        if (denom == 0.0) {
+            m = j;
+            break;
+        }
+        cs[j] = h[j] / denom;
+        sn[j] = h[j+1] / denom;
+        h[j] = denom;
+        h[j+1] = 0.0;
+        g[j+1] = -sn[j]*g[j];
+        g[j] = cs[j]*g[j];
+        m = j + 1;
+
+        if (fabs(g[j+1]) < m_krylovTol * beta) {
+            break;
+        }
+        if (wnorm == 0.0) {
+            // happy breakdown; the solution lies in the current subspace
+            break;
+        }
+        for (size_t l = 0; l < n; l++) {
+            w[l] /= wnorm;
+        }
+    }
+
+    if (m == 0) {
+        // No progress was possible; fall back to the preconditioner alone
+        jac.solve(m_kryB.data(), step);
+        return;
+    }
+
+    // Solve the triangular least-squares system for the expansion
+    // coefficients, assemble u = V*y, and undo the right preconditioning
+    vector_fp y(m);
+    for (size_t i = m; i-- > 0; ) {
+        double sum = g[i];
+        for (size_t k = i + 1; k < m; k++) {
+            sum -= H[k*(mmax + 1) + i] * y[k];
+        }
+        y[i] = sum / H[i*(mmax + 1) + i];
+    }
+    fill(m_kryZ.begin(), m_kryZ.end(), 0.0);
+    for (size_t k = 0; k < m; k++) {
+        for (size_t l = 0; l < n; l++) {
+            m_kryZ[l] += y[k]*m_kryV[k][l];
+        }
+    }
+    jac.solve(m_kryZ.data(), step);
+}
+
 doublereal MultiNewton::boundStep(const doublereal* x0,
                                   const doublereal* step0, const OneDim& r, int loglevel)
 {
     doublereal fbound = 1.0;
+    size_t nThreads = reduction_threads(r);
     for (size_t i = 0; i < r.nDomains(); i++) {
         fbound = std::min(fbound,
                           bound_step(x0 + r.start(i), step0 + r.start(i),
-                                     r.domain(i), loglevel));
+                                     r.domain(i), loglevel, nThreads));
     }
     return fbound;
 }
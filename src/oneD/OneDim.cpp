@@ -7,9 +7,12 @@
 #include "cantera/numerics/Func1.h"
 #include "cantera/base/ctml.h"
 #include "cantera/oneD/MultiNewton.h"
+#include "cantera/base/ThreadPool.h"
 
+#include <atomic>
 #include <fstream>
 #include <ctime>
+#include <thread>
 
 using namespace std;
 
@@ -18,12 +21,13 @@ namespace Cantera
 
 OneDim::OneDim()
     : m_tmin(1.0e-16), m_tmax(1e8), m_tfactor(0.5),
-      m_rdt(0.0), m_jac_ok(false),
+      m_rdt(0.0), m_jac_ok(false), m_jacEval(false),
       m_bw(0), m_size(0),
       m_init(false), m_pts(0), m_solve_time(0.0),
       m_ss_jac_age(20), m_ts_jac_age(20),
       m_interrupt(0), m_time_step_callback(0),
-      m_nsteps(0), m_nsteps_max(500),
+      m_nsteps(0), m_nsteps_max(500), m_evalThreads(1),
+      m_ser(false), m_serMaxGrowth(3.0),
       m_nevals(0), m_evaltime(0.0)
 {
     m_newt.reset(new MultiNewton(1));
@@ -31,12 +35,13 @@ OneDim::OneDim()
 
 OneDim::OneDim(vector<Domain1D*> domains) :
     m_tmin(1.0e-16), m_tmax(1e8), m_tfactor(0.5),
-    m_rdt(0.0), m_jac_ok(false),
+    m_rdt(0.0), m_jac_ok(false), m_jacEval(false),
     m_bw(0), m_size(0),
     m_init(false), m_solve_time(0.0),
     m_ss_jac_age(20), m_ts_jac_age(20),
     m_interrupt(0), m_time_step_callback(0),
-    m_nsteps(0), m_nsteps_max(500),
+    m_nsteps(0), m_nsteps_max(500), m_evalThreads(1),
+    m_ser(false), m_serMaxGrowth(3.0),
     m_nevals(0), m_evaltime(0.0)
 {
     // create a Newton iterator, and add each domain.
@@ -174,6 +179,7 @@ void OneDim::resize()
 
     // save the statistics for the last grid
     saveStats();
+    size_t oldPts = m_pts;
     m_pts = 0;
     for (size_t i = 0; i < nDomains(); i++) {
         Domain1D* d = m_dom[i];
@@ -210,15 +216,21 @@ void OneDim::resize()
     }
 
     m_newt->resize(size());
+    m_newt->autoSelectLinearSolver(*this);
     m_mask.resize(size());
 
-    // delete the current Jacobian evaluator and create a new one
-    m_jac.reset(new MultiJac(*this));
-    m_jac_ok = false;
-
-    for (size_t i = 0; i < nDomains(); i++) {
-        m_dom[i]->setJac(m_jac.get());
+    // Delete the current Jacobian evaluator and create a new one, unless the
+    // problem dimensions are unchanged, in which case the existing storage
+    // can be reused. The Jacobian entries still need to be recomputed before
+    // the next solve.
+    if (!m_jac || m_jac->nRows() != m_size || m_jac->nSubDiagonals() != m_bw
+        || oldPts != m_pts) {
+        m_jac.reset(new MultiJac(*this));
+        for (size_t i = 0; i < nDomains(); i++) {
+            m_dom[i]->setJac(m_jac.get());
+        }
     }
+    m_jac_ok = false;
 }
 
 int OneDim::solve(doublereal* x, doublereal* xnew, int loglevel)
@@ -269,9 +281,30 @@ void OneDim::eval(size_t j, double* x, double* r, doublereal rdt, int count)
         rdt = m_rdt;
     }
 
-    // iterate over the bulk domains first
-    for (const auto& d : m_bulk) {
-        d->eval(j, x, r, m_mask.data(), rdt);
+    // iterate over the bulk domains first. Each bulk domain writes only its
+    // own portion of the residual and mask vectors, so for a full residual
+    // evaluation the domains can be computed concurrently when enabled via
+    // setEvalThreads().
+    size_t nThreads = m_evalThreads;
+    if (nThreads == 0) {
+        nThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    nThreads = std::min(nThreads, m_bulk.size());
+    if (nThreads > 1 && j == npos) {
+        std::atomic<size_t> next(0);
+        ThreadPool::shared().run(nThreads, [&](size_t i) {
+            while (true) {
+                size_t n = next.fetch_add(1);
+                if (n >= m_bulk.size()) {
+                    return;
+                }
+                m_bulk[n]->eval(j, x, r, m_mask.data(), rdt);
+            }
+        });
+    } else {
+        for (const auto& d : m_bulk) {
+            d->eval(j, x, r, m_mask.data(), rdt);
+        }
     }
 
     // then over the connector domains
@@ -290,6 +323,26 @@ void OneDim::eval(size_t j, double* x, double* r, doublereal rdt, int count)
 doublereal OneDim::ssnorm(doublereal* x, doublereal* r)
 {
     eval(npos, x, r, 0.0, 0);
+    size_t nThreads = m_evalThreads;
+    if (nThreads == 0) {
+        nThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    // chunked max-reduction over the residual; the serial loop is cheaper
+    // for small systems
+    if (nThreads > 1 && m_size >= 100000) {
+        vector_fp partial(nThreads, 0.0);
+        size_t chunk = m_size/nThreads + 1;
+        ThreadPool::shared().run(nThreads, [this, r, &partial, chunk](size_t t) {
+            size_t first = t*chunk;
+            size_t last = std::min(first + chunk, m_size);
+            double ss = 0.0;
+            for (size_t i = first; i < last; i++) {
+                ss = std::max(fabs(r[i]), ss);
+            }
+            partial[t] = ss;
+        });
+        return *max_element(partial.begin(), partial.end());
+    }
     doublereal ss = 0.0;
     for (size_t i = 0; i < m_size; i++) {
         ss = std::max(fabs(r[i]),ss);
@@ -357,9 +410,25 @@ doublereal OneDim::timeStep(int nsteps, doublereal dt, doublereal* x,
     int n = 0;
     int successiveFailures = 0;
 
+    // residual norm at the last accepted solution, used by the
+    // switched-evolution-relaxation controller
+    doublereal ssLast = -1.0;
+
     while (n < nsteps) {
+        doublereal ss = -1.0;
+        if (loglevel > 0 || m_ser) {
+            ss = ssnorm(x, r);
+        }
+        if (m_ser && ss > 0.0 && ssLast > 0.0) {
+            // Grow the step size in proportion to the residual reduction
+            // achieved by the previous accepted step. Reductions are handled
+            // by the failure path below, so the ratio only ever increases dt.
+            doublereal ratio = std::min(ssLast / ss, m_serMaxGrowth);
+            if (ratio > 1.0) {
+                dt = std::min(dt * ratio, m_tmax);
+            }
+        }
         if (loglevel > 0) {
-            doublereal ss = ssnorm(x, r);
             writelog(" {:>4d}  {:10.4g}  {:10.4g}", n, dt, log10(ss));
         }
 
@@ -377,7 +446,10 @@ doublereal OneDim::timeStep(int nsteps, doublereal dt, doublereal* x,
             n += 1;
             debuglog("\n", loglevel);
             copy(r, r + m_size, x);
-            if (m == 100) {
+            ssLast = ss;
+            if (m == 100 && !m_ser) {
+                // fixed growth heuristic; with the adaptive controller the
+                // step size is set from the residual-norm history instead
                 dt *= 1.5;
             }
             if (m_time_step_callback) {
@@ -15,6 +15,9 @@
 #include "cantera/base/stringUtils.h"
 #include "cantera/numerics/Func1.h"
 #include <limits>
+#include <fstream>
+#include <sstream>
+#include <cstdint>
 
 using namespace std;
 
@@ -35,6 +38,19 @@ Sim1D::Sim1D(vector<Domain1D*>& domains) :
     // set some defaults
     m_tstep = 1.0e-5;
     m_steps = { 10 };
+    m_coarse_to_fine = false;
+    m_coarse_stride = 4;
+}
+
+void Sim1D::setCoarseToFine(bool enable, size_t stride)
+{
+    if (stride < 2) {
+        throw CanteraError("Sim1D::setCoarseToFine",
+                           "Coarsening stride must be at least 2; got {}",
+                           stride);
+    }
+    m_coarse_to_fine = enable;
+    m_coarse_stride = stride;
 }
 
 void Sim1D::setInitialGuess(const std::string& component, vector_fp& locs, vector_fp& vals)
@@ -190,6 +206,219 @@ void Sim1D::restoreSteadySolution()
     }
 }
 
+namespace { // unnamed
+
+//! Magic number identifying solution library entry files ("CT1D")
+const uint32_t libraryMagic = 0x43543144;
+
+void writeU64(std::ofstream& s, uint64_t v)
+{
+    s.write(reinterpret_cast<const char*>(&v), sizeof(v));
+}
+
+uint64_t readU64(std::ifstream& s)
+{
+    uint64_t v = 0;
+    s.read(reinterpret_cast<char*>(&v), sizeof(v));
+    return v;
+}
+
+void writeDoubles(std::ofstream& s, const double* v, size_t n)
+{
+    s.write(reinterpret_cast<const char*>(v), n*sizeof(double));
+}
+
+void readDoubles(std::ifstream& s, double* v, size_t n)
+{
+    s.read(reinterpret_cast<char*>(v), n*sizeof(double));
+}
+
+//! Distance between two (pressure, phi, strain) lookup points. Pressure is
+//! compared on a logarithmic scale and the strain rate is shifted by one
+//! so that unstrained (zero strain) entries remain comparable.
+double libraryDistance(double p0, double phi0, double a0,
+                       double p1, double phi1, double a1)
+{
+    double dp = log(p1/p0);
+    double dphi = phi1 - phi0;
+    double da = log((a1 + 1.0)/(a0 + 1.0));
+    return dp*dp + dphi*dphi + da*da;
+}
+
+} // unnamed namespace
+
+size_t Sim1D::structureHash() const
+{
+    // FNV-1a over the number of domains and the component names of each
+    // domain, which identifies the mechanism and configuration
+    uint64_t h = 14695981039346656037ULL;
+    auto mix = [&h](const std::string& s) {
+        for (char c : s) {
+            h = (h ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+        }
+        h = (h ^ '\0') * 1099511628211ULL;
+    };
+    for (size_t n = 0; n < nDomains(); n++) {
+        const Domain1D& d = domain(n);
+        for (size_t m = 0; m < d.nComponents(); m++) {
+            mix(d.componentName(m));
+        }
+        mix(";");
+    }
+    return static_cast<size_t>(h);
+}
+
+void Sim1D::saveToLibrary(const std::string& dir, double pressure, double phi,
+                          double strain, int loglevel)
+{
+    size_t hash = structureHash();
+
+    // count existing index entries to generate a unique file name
+    string indexName = dir + "/index.txt";
+    size_t nEntries = 0;
+    {
+        ifstream index(indexName);
+        string line;
+        while (std::getline(index, line)) {
+            if (!line.empty()) {
+                nEntries++;
+            }
+        }
+    }
+    string entryName = fmt::format("entry_{}_{}.bin", hash, nEntries);
+
+    ofstream entry(dir + "/" + entryName, ios::binary);
+    if (!entry) {
+        throw CanteraError("Sim1D::saveToLibrary",
+                           "Unable to create library entry in '{}'", dir);
+    }
+    writeU64(entry, libraryMagic);
+    writeU64(entry, hash);
+    writeDoubles(entry, &pressure, 1);
+    writeDoubles(entry, &phi, 1);
+    writeDoubles(entry, &strain, 1);
+    writeU64(entry, nDomains());
+    for (size_t n = 0; n < nDomains(); n++) {
+        Domain1D& d = domain(n);
+        size_t np = d.nPoints();
+        size_t nc = d.nComponents();
+        writeU64(entry, np);
+        writeU64(entry, nc);
+        writeDoubles(entry, d.grid().data(), np);
+        vector_fp vals(np);
+        for (size_t m = 0; m < nc; m++) {
+            for (size_t j = 0; j < np; j++) {
+                vals[j] = value(n, m, j);
+            }
+            writeDoubles(entry, vals.data(), np);
+        }
+    }
+    entry.close();
+
+    ofstream index(indexName, ios::app);
+    if (!index) {
+        throw CanteraError("Sim1D::saveToLibrary",
+                           "Unable to update library index in '{}'", dir);
+    }
+    index << entryName << " " << hash << " "
+          << fmt::format("{:.14g} {:.14g} {:.14g}", pressure, phi, strain)
+          << "\n";
+    if (loglevel > 0) {
+        writelog("Solution saved to library entry {}/{}.\n", dir, entryName);
+    }
+}
+
+bool Sim1D::restoreNearest(const std::string& dir, double pressure,
+                           double phi, double strain, int loglevel)
+{
+    size_t hash = structureHash();
+    ifstream index(dir + "/index.txt");
+    if (!index) {
+        return false;
+    }
+
+    // scan the index for the nearest entry with a matching structure
+    string bestName;
+    double bestDist = Undef;
+    string line;
+    while (std::getline(index, line)) {
+        istringstream fields(line);
+        string name;
+        size_t entryHash;
+        double p, f, a;
+        if (!(fields >> name >> entryHash >> p >> f >> a)
+                || entryHash != hash) {
+            continue;
+        }
+        double dist = libraryDistance(pressure, phi, strain, p, f, a);
+        if (bestName.empty() || dist < bestDist) {
+            bestName = name;
+            bestDist = dist;
+        }
+    }
+    if (bestName.empty()) {
+        return false;
+    }
+
+    ifstream entry(dir + "/" + bestName, ios::binary);
+    if (!entry || readU64(entry) != libraryMagic || readU64(entry) != hash) {
+        throw CanteraError("Sim1D::restoreNearest",
+                           "Library entry '{}/{}' is missing or corrupted",
+                           dir, bestName);
+    }
+    double dummy[3];
+    readDoubles(entry, dummy, 3);
+    if (readU64(entry) != nDomains()) {
+        throw CanteraError("Sim1D::restoreNearest",
+                           "Library entry '{}/{}' is missing or corrupted",
+                           dir, bestName);
+    }
+
+    for (size_t n = 0; n < nDomains(); n++) {
+        Domain1D& d = domain(n);
+        size_t np = readU64(entry);
+        size_t nc = readU64(entry);
+        if (nc != d.nComponents() || !entry) {
+            throw CanteraError("Sim1D::restoreNearest",
+                               "Library entry '{}/{}' is missing or corrupted",
+                               dir, bestName);
+        }
+        vector_fp zin(np);
+        readDoubles(entry, zin.data(), np);
+
+        // convert the stored grid to the relative coordinates expected by
+        // setProfile(); degenerate (single-point) domains are copied directly
+        vector_fp pos(np);
+        double z0 = zin.front();
+        double width = zin.back() - z0;
+        bool interp = (np > 1 && width > 0.0);
+        if (interp) {
+            for (size_t j = 0; j < np; j++) {
+                pos[j] = (zin[j] - z0)/width;
+            }
+            pos.front() = 0.0;
+            pos.back() = 1.0;
+        }
+        vector_fp vals(np);
+        for (size_t m = 0; m < nc; m++) {
+            readDoubles(entry, vals.data(), np);
+            if (interp) {
+                setProfile(n, m, pos, vals);
+            } else {
+                for (size_t j = 0; j < d.nPoints(); j++) {
+                    setValue(n, m, j, vals[0]);
+                }
+            }
+        }
+    }
+    finalize();
+    if (loglevel > 0) {
+        writelog("Initialized solution from library entry {}/{} "
+                 "(distance {:.4g}).\n", dir, bestName, sqrt(bestDist));
+    }
+    return true;
+}
+
 void Sim1D::getInitialSoln()
 {
     for (size_t n = 0; n < nDomains(); n++) {
@@ -235,6 +464,17 @@ void Sim1D::solve(int loglevel, bool refine_grid)
     int soln_number = -1;
     finalize();
 
+    if (m_coarse_to_fine && refine_grid) {
+        // Nested iteration: converge on a deliberately coarse grid first and
+        // let the refinement loop below rebuild the resolution, re-converging
+        // at each level with the interpolated solution as the initial guess.
+        int removed = coarsen(loglevel);
+        if (removed > 0 && loglevel > 0) {
+            writelog("Coarse-to-fine startup: removed {} grid points.\n",
+                     removed);
+        }
+    }
+
     while (new_points > 0) {
         size_t istep = 0;
         int nsteps = m_steps[istep];
@@ -341,11 +581,82 @@ void Sim1D::solve(int loglevel, bool refine_grid)
     }
 }
 
+int Sim1D::coarsen(int loglevel)
+{
+    int np = 0;
+    vector_fp znew, xnew;
+    std::vector<size_t> dsize;
+    std::vector<bool> dchanged; // whether each domain's grid was modified
+
+    for (size_t n = 0; n < nDomains(); n++) {
+        Domain1D& d = domain(n);
+        size_t comp = d.nComponents();
+        size_t npnow = d.nPoints();
+        size_t nstart = znew.size();
+
+        // Leave domains alone that are already at or below the coarse
+        // resolution, such as boundary domains
+        bool skip = (npnow <= 2*m_coarse_stride);
+
+        // The fixed-temperature point of a freely propagating flame anchors
+        // the flame location and must survive on every level
+        double zfixed = Undef;
+        StFlow* d_free = dynamic_cast<StFlow*>(&d);
+        if (d_free && d_free->domainType() == cFreeFlow
+                && d_free->m_tfixed > 0) {
+            zfixed = d_free->m_zfixed;
+        }
+
+        bool changed = false;
+        for (size_t m = 0; m < npnow; m++) {
+            if (!skip && m > 0 && m + 1 < npnow && m % m_coarse_stride != 0
+                    && d.grid(m) != zfixed) {
+                // drop this point from the coarse level
+                changed = true;
+                np++;
+                continue;
+            }
+            znew.push_back(d.grid(m));
+            for (size_t i = 0; i < comp; i++) {
+                xnew.push_back(value(n, i, m));
+            }
+        }
+        dsize.push_back(znew.size() - nstart);
+        dchanged.push_back(changed);
+        if (changed && loglevel > 1) {
+            writelog("coarsen: domain {} reduced from {} to {} points\n",
+                     d.id(), npnow, dsize.back());
+        }
+    }
+
+    if (std::none_of(dchanged.begin(), dchanged.end(),
+                     [](bool c) { return c; })) {
+        return 0;
+    }
+
+    // Update each domain with its coarsened grid and replace the current
+    // solution vector with the subsampled one, as in refine()
+    size_t gridstart = 0;
+    for (size_t n = 0; n < nDomains(); n++) {
+        Domain1D& d = domain(n);
+        size_t gridsize = dsize[n];
+        if (dchanged[n]) {
+            d.setupGrid(gridsize, &znew[gridstart]);
+        }
+        gridstart += gridsize;
+    }
+    m_x = xnew;
+    resize();
+    finalize();
+    return np;
+}
+
 int Sim1D::refine(int loglevel)
 {
     int ianalyze, np = 0;
     vector_fp znew, xnew;
     std::vector<size_t> dsize;
+    std::vector<bool> dchanged; // whether each domain's grid was modified
 
     m_xlast_ss = m_x;
     m_grid_last_ss.clear();
@@ -369,6 +680,7 @@ int Sim1D::refine(int loglevel)
 
         np += r.nNewPoints();
         size_t comp = d.nComponents();
+        bool changed = false;
 
         // loop over points in the current grid
         size_t npnow = d.nPoints();
@@ -391,6 +703,7 @@ int Sim1D::refine(int loglevel)
                     double zmid = 0.5*(d.grid(m) + d.grid(m+1));
                     znew.push_back(zmid);
                     np++;
+                    changed = true;
 
                     // for each component, linearly interpolate
                     // the solution to this point
@@ -400,12 +713,23 @@ int Sim1D::refine(int loglevel)
                     }
                 }
             } else {
+                changed = true;
                 if (loglevel > 0) {
                     writelog("refine: discarding point at {}\n", d.grid(m));
                 }
             }
         }
         dsize.push_back(znew.size() - nstart);
+        dchanged.push_back(changed);
+    }
+
+    // If no points were added or removed on any domain, keep the current
+    // solution vector, Jacobian and factorization intact instead of
+    // rebuilding the problem, so that a subsequent solve warm-starts from
+    // the existing state.
+    if (std::none_of(dchanged.begin(), dchanged.end(),
+                     [](bool c) { return c; })) {
+        return 0;
     }
 
     // At this point, the new grid znew and the new solution vector xnew have
@@ -416,7 +740,9 @@ int Sim1D::refine(int loglevel)
     for (size_t n = 0; n < nDomains(); n++) {
         Domain1D& d = domain(n);
         gridsize = dsize[n];
-        d.setupGrid(gridsize, &znew[gridstart]);
+        if (dchanged[n]) {
+            d.setupGrid(gridsize, &znew[gridstart]);
+        }
         gridstart += gridsize;
     }
 
@@ -634,6 +960,67 @@ void Sim1D::solveAdjoint(const double* b, double* lambda)
     Jt.solve(b, lambda);
 }
 
+vector_fp Sim1D::adjointSensitivities(const double* dgdx,
+                                      const std::vector<size_t>& reactions,
+                                      int loglevel)
+{
+    // one adjoint solve against the current Jacobian gives the adjoint
+    // variables for all parameters
+    vector_fp lambda(size(), 0.0);
+    solveAdjoint(dgdx, lambda.data());
+
+    // collect the distinct kinetics managers attached to the flow domains
+    std::vector<Kinetics*> kin;
+    for (size_t n = 0; n < nDomains(); n++) {
+        StFlow* d = dynamic_cast<StFlow*>(&domain(n));
+        if (d && std::find(kin.begin(), kin.end(), &d->kinetics())
+                == kin.end()) {
+            kin.push_back(&d->kinetics());
+        }
+    }
+    if (kin.empty()) {
+        throw CanteraError("Sim1D::adjointSensitivities",
+            "Simulation contains no flow domain with a kinetics manager");
+    }
+
+    // unperturbed steady-state residual
+    vector_fp f0(size(), 0.0);
+    OneDim::eval(npos, m_x.data(), f0.data(), 0.0, 0);
+
+    const doublereal delta = 1.0e-5;
+    vector_fp fpert(size(), 0.0);
+    vector_fp mult0(kin.size());
+    vector_fp sens(reactions.size(), 0.0);
+    for (size_t j = 0; j < reactions.size(); j++) {
+        size_t i = reactions[j];
+        for (size_t m = 0; m < kin.size(); m++) {
+            if (i >= kin[m]->nReactions()) {
+                throw CanteraError("Sim1D::adjointSensitivities",
+                    "Reaction index {} out of range; mechanism contains "
+                    "{} reactions", i, kin[m]->nReactions());
+            }
+            mult0[m] = kin[m]->multiplier(i);
+            kin[m]->setMultiplier(i, mult0[m]*(1.0 + delta));
+        }
+        OneDim::eval(npos, m_x.data(), fpert.data(), 0.0, 0);
+        for (size_t m = 0; m < kin.size(); m++) {
+            kin[m]->setMultiplier(i, mult0[m]);
+        }
+
+        // s_i = -lambda^T df/d(ln k_i)
+        doublereal s = 0.0;
+        for (size_t k = 0; k < size(); k++) {
+            s += lambda[k]*(fpert[k] - f0[k]);
+        }
+        sens[j] = -s/delta;
+        if (loglevel > 1) {
+            writelog("adjointSensitivities: reaction {:5d}  s = {:12.4e}\n",
+                     i, sens[j]);
+        }
+    }
+    return sens;
+}
+
 void Sim1D::resize()
 {
     OneDim::resize();
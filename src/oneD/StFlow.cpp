@@ -4,17 +4,50 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/oneD/StFlow.h"
+#include "cantera/oneD/OneDim.h"
 #include "cantera/oneD/refine.h"
 #include "cantera/base/ctml.h"
 #include "cantera/transport/TransportBase.h"
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/transport/MultiTransport.h"
 #include "cantera/numerics/funcs.h"
 #include "cantera/base/global.h"
+#include "cantera/base/Profiler.h"
+#include "cantera/base/ThreadPool.h"
+
+#include <thread>
 
 using namespace std;
 
 namespace Cantera
 {
 
+namespace { // unnamed
+
+// Polynomial fits for the Planck mean absorption coefficients of H2O and
+// CO2 in terms of 1000/T, from the RADCAL program [Grosshandler, W. L.,
+// RADCAL: A Narrow-Band Model for Radiation Calculations in a Combustion
+// Environment, NIST technical note 1402, 1993]. The coefficients are taken
+// from [http://www.sandia.gov/TNF/radiation.html].
+const double c_Planck_H2O[6] = {-0.23093, -1.12390, 9.41530, -2.99880,
+                                0.51382, -1.86840e-5};
+const double c_Planck_CO2[6] = {18.741, -121.310, 273.500, -194.050,
+                                56.310, -5.8169};
+
+//! Evaluate a Planck absorption coefficient fit at temperature t,
+//! normalized by the reference pressure of the fit (1 atm)
+double planckFit(const double* c, double t)
+{
+    double zr = 1000.0 / t;
+    double k_P = c[5];
+    for (int n = 4; n >= 0; n--) {
+        k_P = k_P * zr + c[n];
+    }
+    return k_P / OneAtm;
+}
+
+} // unnamed namespace
+
 StFlow::StFlow(ThermoPhase* ph, size_t nsp, size_t points) :
     Domain1D(nsp+c_offset_Y, points),
     m_press(-1.0),
@@ -30,7 +63,10 @@ StFlow::StFlow(ThermoPhase* ph, size_t nsp, size_t points) :
     m_kExcessLeft(0),
     m_kExcessRight(0),
     m_zfixed(Undef),
-    m_tfixed(-1.)
+    m_tfixed(-1.),
+    m_nThreads(1),
+    m_wdotUpdated(false),
+    m_traceThreshold(0.0)
 {
     if (ph->type() == "IdealGas") {
         m_thermo = static_cast<IdealGasPhase*>(ph);
@@ -99,11 +135,104 @@ StFlow::StFlow(ThermoPhase* ph, size_t nsp, size_t points) :
     m_kRadiating.resize(2, npos);
     m_kRadiating[0] = m_thermo->speciesIndex("CO2");
     m_kRadiating[1] = m_thermo->speciesIndex("H2O");
+    buildRadiationTable();
+}
+
+StFlow::~StFlow()
+{
+}
+
+void StFlow::setNumThreads(size_t nThreads)
+{
+    if (nThreads == 0) {
+        nThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    m_nThreads = nThreads;
+    // the evaluators are rebuilt on demand from the current phase objects
+    m_evaluators.clear();
+    if (m_refiner) {
+        m_refiner->setNumThreads(nThreads);
+    }
+}
+
+void StFlow::buildPropertyEvaluators()
+{
+    m_evaluators.clear();
+    m_evaluators.resize(m_nThreads - 1);
+    for (auto& e : m_evaluators) {
+        // Build a phase with the same elements and species as the one this
+        // domain was constructed with. The Species objects (including their
+        // thermo parameterizations) are shared with the original phase; they
+        // are only read during property evaluation.
+        std::unique_ptr<IdealGasPhase> gas(new IdealGasPhase());
+        gas->setName(m_thermo->name());
+        for (size_t m = 0; m < m_thermo->nElements(); m++) {
+            gas->addElement(m_thermo->elementName(m),
+                            m_thermo->atomicWeight(m));
+        }
+        for (size_t k = 0; k < m_nsp; k++) {
+            gas->addSpecies(m_thermo->species(k));
+        }
+        gas->initThermo();
+        gas->setState_TPY(m_thermo->temperature(), m_thermo->pressure(),
+                          m_thermo->massFractions());
+        e.thermo = std::move(gas);
+        if (m_kin) {
+            e.kin = m_kin->threadClone({e.thermo.get()});
+        }
+        if (m_trans) {
+            e.trans.reset(newTransportMgr(m_trans->transportType(),
+                                          e.thermo.get()));
+        }
+        e.ybar.resize(m_nsp);
+    }
+}
+
+void StFlow::forPointsParallel(size_t j0, size_t j1,
+    const std::function<void(size_t, size_t, size_t)>& func)
+{
+    size_t nPoints = j1 - j0 + 1;
+    size_t nThreads = std::min(m_evaluators.size() + 1, nPoints);
+    if (nThreads <= 1) {
+        func(0, j0, j1);
+        return;
+    }
+
+    size_t chunk = nPoints / nThreads;
+    size_t remainder = nPoints % nThreads;
+    ThreadPool::shared().run(nThreads, [&](size_t i) {
+        size_t jFirst = j0 + i*chunk + std::min(i, remainder);
+        size_t jLast = jFirst + chunk - 1 + (i < remainder ? 1 : 0);
+        func(i, jFirst, jLast);
+    });
 }
 
 void StFlow::resize(size_t ncomponents, size_t points)
 {
     Domain1D::resize(ncomponents, points);
+    // Reserve capacity for all per-point work arrays together whenever the
+    // grid outgrows the current allocation, doubling with headroom so that
+    // a typical refinement cycle never reallocates any of them.
+    if (m_rho.capacity() < m_points) {
+        size_t cap = std::max(m_points + m_points/4 + 8,
+                              2*m_rho.capacity());
+        m_rho.reserve(cap);
+        m_wtm.reserve(cap);
+        m_cp.reserve(cap);
+        m_visc.reserve(cap);
+        m_tcon.reserve(cap);
+        m_diff.reserve(m_nsp*cap);
+        if (m_do_multicomponent) {
+            m_multidiff.reserve(m_nsp*m_nsp*cap);
+            m_dthermal.reserve(m_nsp, cap);
+        }
+        m_flux.reserve(m_nsp, cap);
+        m_wdot.reserve(m_nsp, cap);
+        m_qdotRadiation.reserve(cap);
+        m_fixedtemp.reserve(cap);
+        m_dz.reserve(cap);
+        m_z.reserve(cap);
+    }
     m_rho.resize(m_points, 0.0);
     m_wtm.resize(m_points, 0.0);
     m_cp.resize(m_points, 0.0);
@@ -150,10 +279,18 @@ void StFlow::resetBadValues(double* xg)
     }
 }
 
+void StFlow::setKinetics(Kinetics& kin)
+{
+    m_kin = &kin;
+    m_evaluators.clear();
+}
+
 void StFlow::setTransport(Transport& trans)
 {
     m_trans = &trans;
     m_do_multicomponent = (m_trans->transportType() == "Multi");
+    m_evaluators.clear();
+    invalidateTransportCache();
 
     m_diff.resize(m_nsp*m_points);
     if (m_do_multicomponent) {
@@ -172,22 +309,33 @@ void StFlow::_getInitialSoln(double* x)
 
 void StFlow::setGas(const doublereal* x, size_t j)
 {
-    m_thermo->setTemperature(T(x,j));
+    setGas(*m_thermo, x, j);
+}
+
+void StFlow::setGas(ThermoPhase& gas, const doublereal* x, size_t j)
+{
+    gas.setTemperature(T(x,j));
     const doublereal* yy = x + m_nv*j + c_offset_Y;
-    m_thermo->setMassFractions_NoNorm(yy);
-    m_thermo->setPressure(m_press);
+    gas.setMassFractions_NoNorm(yy);
+    gas.setPressure(m_press);
 }
 
 void StFlow::setGasAtMidpoint(const doublereal* x, size_t j)
 {
-    m_thermo->setTemperature(0.5*(T(x,j)+T(x,j+1)));
+    setGasAtMidpoint(*m_thermo, m_ybar, x, j);
+}
+
+void StFlow::setGasAtMidpoint(ThermoPhase& gas, vector_fp& ybar,
+                              const doublereal* x, size_t j)
+{
+    gas.setTemperature(0.5*(T(x,j)+T(x,j+1)));
     const doublereal* yyj = x + m_nv*j + c_offset_Y;
     const doublereal* yyjp = x + m_nv*(j+1) + c_offset_Y;
     for (size_t k = 0; k < m_nsp; k++) {
-        m_ybar[k] = 0.5*(yyj[k] + yyjp[k]);
+        ybar[k] = 0.5*(yyj[k] + yyjp[k]);
     }
-    m_thermo->setMassFractions_NoNorm(m_ybar.data());
-    m_thermo->setPressure(m_press);
+    gas.setMassFractions_NoNorm(ybar.data());
+    gas.setPressure(m_press);
 }
 
 void StFlow::_finalize(const doublereal* x)
@@ -271,13 +419,57 @@ void StFlow::updateProperties(size_t jg, double* x, size_t jmin, size_t jmax)
     size_t j0 = std::max<size_t>(jmin, 1) - 1;
     size_t j1 = std::min(jmax+1,m_points-1);
 
-    updateThermo(x, j0, j1);
-    if (jg == npos || m_force_full_update) {
+    // Grouped Jacobian evaluations perturb the solution at many grid points
+    // and evaluate the full residual, so the Jacobian flag of the container
+    // (rather than jg != npos) indicates that properties held fixed during
+    // Jacobian evaluation should not be updated.
+    bool jacEval = m_container && m_container->jacobianBeingEvaluated();
+
+    m_wdotUpdated = false;
+    if (m_nThreads > 1 && m_evaluators.size() != m_nThreads - 1) {
+        buildPropertyEvaluators();
+    }
+
+    if (!m_evaluators.empty()) {
+        forPointsParallel(j0, j1, [&](size_t i, size_t jFirst, size_t jLast) {
+            ThermoPhase& gas = (i == 0) ? *m_thermo : *m_evaluators[i-1].thermo;
+            for (size_t j = jFirst; j <= jLast; j++) {
+                setGas(gas, x, j);
+                m_rho[j] = gas.density();
+                m_wtm[j] = gas.meanMolecularWeight();
+                m_cp[j] = gas.cp_mass();
+            }
+        });
+    } else {
+        updateThermo(x, j0, j1);
+    }
+
+    // net production rates at the interior points, which would otherwise be
+    // evaluated one point at a time by evalResidual()
+    if (!m_evaluators.empty() && m_points >= 3) {
+        size_t jb = std::max<size_t>(jmin, 1);
+        size_t je = std::min(jmax, m_points - 2);
+        if (jb <= je) {
+            forPointsParallel(jb, je,
+                              [&](size_t i, size_t jFirst, size_t jLast) {
+                ThermoPhase& gas = (i == 0) ? *m_thermo
+                                            : *m_evaluators[i-1].thermo;
+                Kinetics& kin = (i == 0) ? *m_kin : *m_evaluators[i-1].kin;
+                for (size_t j = jFirst; j <= jLast; j++) {
+                    setGas(gas, x, j);
+                    kin.getNetProductionRates(&m_wdot(0,j));
+                }
+            });
+            m_wdotUpdated = true;
+        }
+    }
+
+    if ((jg == npos && !jacEval) || m_force_full_update) {
         // update transport properties only if a Jacobian is not being
         // evaluated, or if specifically requested
         updateTransport(x, j0, j1);
     }
-    if (jg == npos) {
+    if (jg == npos && !jacEval) {
         double* Yleft = x + index(c_offset_Y, jmin);
         m_kExcessLeft = distance(Yleft, max_element(Yleft, Yleft + m_nsp));
         double* Yright = x + index(c_offset_Y, jmax);
@@ -287,6 +479,84 @@ void StFlow::updateProperties(size_t jg, double* x, size_t jmin, size_t jmax)
     // update the species diffusive mass fluxes whether or not a
     // Jacobian is being evaluated
     updateDiffFluxes(x, j0, j1);
+
+    // evaluate the radiative heat loss at all required points in one pass
+    if (m_do_radiation) {
+        computeRadiation(x, jmin, jmax);
+    }
+}
+
+void StFlow::buildRadiationTable()
+{
+    // Tabulate the RADCAL polynomial fits for the Planck mean absorption
+    // coefficients on a uniform temperature grid, so that evaluating the
+    // radiation term during residual evaluations reduces to one linear
+    // interpolation per species and grid point. The 1 K spacing keeps the
+    // interpolation error far below the accuracy of the underlying fits.
+    m_radTmin = 200.0;
+    m_radTmax = 5000.0;
+    m_radInvDT = 1.0;
+    size_t n = static_cast<size_t>((m_radTmax - m_radTmin)*m_radInvDT) + 1;
+    m_kPlanckH2O.resize(n);
+    m_kPlanckCO2.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        double t = m_radTmin + i / m_radInvDT;
+        m_kPlanckH2O[i] = planckFit(c_Planck_H2O, t);
+        m_kPlanckCO2[i] = planckFit(c_Planck_CO2, t);
+    }
+}
+
+void StFlow::computeRadiation(double* x, size_t jmin, size_t jmax)
+{
+    // The simple radiation model used was established by Y. Liu and B. Rogg
+    // [Y. Liu and B. Rogg, Modelling of thermally radiating diffusion flames
+    // with detailed chemistry and transport, EUROTHERM Seminars, 17:114-127,
+    // 1991]. This model uses the optically thin limit and the gray-gas
+    // approximation to simply calculate a volume specified heat flux out of
+    // the Planck absorption coefficients, the boundary emissivities and the
+    // temperature. The model considers only CO2 and H2O as radiating species,
+    // whose Planck coefficients are interpolated from the temperature table
+    // built by buildRadiationTable().
+
+    // calculation of the two boundary values
+    double boundary_Rad_left = m_epsilon_left * StefanBoltz * pow(T(x, 0), 4);
+    double boundary_Rad_right = m_epsilon_right * StefanBoltz
+                                * pow(T(x, m_points - 1), 4);
+
+    // loop over all grid points
+    for (size_t j = jmin; j < jmax; j++) {
+        double t = T(x, j);
+
+        // interpolation of the mean Planck absorption coefficients; outside
+        // the tabulated range, fall back to the polynomial fits
+        double k_P_H2O, k_P_CO2;
+        if (t >= m_radTmin && t <= m_radTmax) {
+            double pos = (t - m_radTmin) * m_radInvDT;
+            size_t i = std::min(static_cast<size_t>(pos),
+                                m_kPlanckH2O.size() - 2);
+            double frac = pos - i;
+            k_P_H2O = m_kPlanckH2O[i]
+                      + frac * (m_kPlanckH2O[i+1] - m_kPlanckH2O[i]);
+            k_P_CO2 = m_kPlanckCO2[i]
+                      + frac * (m_kPlanckCO2[i+1] - m_kPlanckCO2[i]);
+        } else {
+            k_P_H2O = planckFit(c_Planck_H2O, t);
+            k_P_CO2 = planckFit(c_Planck_CO2, t);
+        }
+
+        // mean Planck absorption coefficient of the mixture
+        double k_P = 0;
+        if (m_kRadiating[1] != npos) {
+            k_P += m_press * X(x, m_kRadiating[1], j) * k_P_H2O;
+        }
+        if (m_kRadiating[0] != npos) {
+            k_P += m_press * X(x, m_kRadiating[0], j) * k_P_CO2;
+        }
+
+        // set the radiative heat loss vector
+        m_qdotRadiation[j] = 2 * k_P * (2 * StefanBoltz * pow(t, 4)
+                                        - boundary_Rad_left - boundary_Rad_right);
+    }
 }
 
 void StFlow::evalResidual(double* x, double* rsd, int* diag,
@@ -297,70 +567,7 @@ void StFlow::evalResidual(double* x, double* rsd, int* diag,
     // grid points
     //----------------------------------------------------
 
-    // calculation of qdotRadiation
-
-    // The simple radiation model used was established by Y. Liu and B. Rogg [Y.
-    // Liu and B. Rogg, Modelling of thermally radiating diffusion flames with
-    // detailed chemistry and transport, EUROTHERM Seminars, 17:114-127, 1991].
-    // This model uses the optically thin limit and the gray-gas approximation
-    // to simply calculate a volume specified heat flux out of the Planck
-    // absorption coefficients, the boundary emissivities and the temperature.
-    // The model considers only CO2 and H2O as radiating species. Polynomial
-    // lines calculate the species Planck coefficients for H2O and CO2. The data
-    // for the lines is taken from the RADCAL program [Grosshandler, W. L.,
-    // RADCAL: A Narrow-Band Model for Radiation Calculations in a Combustion
-    // Environment, NIST technical note 1402, 1993]. The coefficients for the
-    // polynomials are taken from [http://www.sandia.gov/TNF/radiation.html].
-
-    if (m_do_radiation) {
-        // variable definitions for the Planck absorption coefficient and the
-        // radiation calculation:
-        doublereal k_P_ref = 1.0*OneAtm;
-
-        // polynomial coefficients:
-        const doublereal c_H2O[6] = {-0.23093, -1.12390, 9.41530, -2.99880,
-                                     0.51382, -1.86840e-5};
-        const doublereal c_CO2[6] = {18.741, -121.310, 273.500, -194.050,
-                                     56.310, -5.8169};
-
-        // calculation of the two boundary values
-        double boundary_Rad_left = m_epsilon_left * StefanBoltz * pow(T(x, 0), 4);
-        double boundary_Rad_right = m_epsilon_right * StefanBoltz * pow(T(x, m_points - 1), 4);
-
-        // loop over all grid points
-        for (size_t j = jmin; j < jmax; j++) {
-            // helping variable for the calculation
-            double radiative_heat_loss = 0;
-
-            // calculation of the mean Planck absorption coefficient
-            double k_P = 0;
-            // absorption coefficient for H2O
-            if (m_kRadiating[1] != npos) {
-                double k_P_H2O = 0;
-                for (size_t n = 0; n <= 5; n++) {
-                    k_P_H2O += c_H2O[n] * pow(1000 / T(x, j), (double) n);
-                }
-                k_P_H2O /= k_P_ref;
-                k_P += m_press * X(x, m_kRadiating[1], j) * k_P_H2O;
-            }
-            // absorption coefficient for CO2
-            if (m_kRadiating[0] != npos) {
-                double k_P_CO2 = 0;
-                for (size_t n = 0; n <= 5; n++) {
-                    k_P_CO2 += c_CO2[n] * pow(1000 / T(x, j), (double) n);
-                }
-                k_P_CO2 /= k_P_ref;
-                k_P += m_press * X(x, m_kRadiating[0], j) * k_P_CO2;
-            }
-
-            // calculation of the radiative heat loss term
-            radiative_heat_loss = 2 * k_P *(2 * StefanBoltz * pow(T(x, j), 4)
-            - boundary_Rad_left - boundary_Rad_right);
-
-            // set the radiative heat loss vector
-            m_qdotRadiation[j] = radiative_heat_loss;
-        }
-    }
+    // m_qdotRadiation was evaluated for this point range by updateProperties()
 
     for (size_t j = jmin; j <= jmax; j++) {
         //----------------------------------------------
@@ -428,7 +635,9 @@ void StFlow::evalResidual(double* x, double* rsd, int* diag,
             //   \rho dY_k/dt + \rho u dY_k/dz + dJ_k/dz
             //   = M_k\omega_k
             //-------------------------------------------------
-            getWdot(x,j);
+            if (!m_wdotUpdated) {
+                getWdot(x,j);
+            }
             for (size_t k = 0; k < m_nsp; k++) {
                 double convec = rho_u(x,j)*dYdz(x,k,j);
                 double diffus = 2.0*(m_flux(k,j) - m_flux(k,j-1))
@@ -485,32 +694,121 @@ void StFlow::evalResidual(double* x, double* rsd, int* diag,
 
 void StFlow::updateTransport(doublereal* x, size_t j0, size_t j1)
 {
-     if (m_do_multicomponent) {
-        for (size_t j = j0; j < j1; j++) {
-            setGasAtMidpoint(x,j);
-            doublereal wtm = m_thermo->meanMolecularWeight();
-            doublereal rho = m_thermo->density();
-            m_visc[j] = (m_dovisc ? m_trans->viscosity() : 0.0);
-            m_trans->getMultiDiffCoeffs(m_nsp, &m_multidiff[mindex(0,0,j)]);
-
-            // Use m_diff as storage for the factor outside the summation
+    if (j1 <= j0) {
+        return;
+    }
+    CT_PROFILE_SCOPE("StFlow::updateTransport");
+
+    // The transport properties at midpoint j depend only on the temperature
+    // and composition at grid points j and j+1 (the pressure and the model
+    // configuration invalidate the whole cache when they change). Compare
+    // the current solution against the values used for the last update, and
+    // recompute only the midpoints adjacent to a point whose state changed.
+    // (Re)classify trace species from the current solution on full-range
+    // updates; single-point updates during Jacobian evaluation reuse the
+    // existing classification. Changing the classification invalidates the
+    // cached properties.
+    if (m_traceThreshold > 0.0 && (j0 == 0 || m_isTrace.size() != m_nsp)) {
+        vector_int isTrace(m_nsp, 1);
+        for (size_t j = 0; j < m_points; j++) {
             for (size_t k = 0; k < m_nsp; k++) {
-                m_diff[k+j*m_nsp] = m_wt[k] * rho / (wtm*wtm);
+                if (std::abs(Y(x,k,j)) >= m_traceThreshold) {
+                    isTrace[k] = 0;
+                }
             }
+        }
+        if (isTrace != m_isTrace) {
+            m_isTrace.swap(isTrace);
+            m_transKeys.clear();
+        }
+    }
+    bool ignoreTrace = (m_traceThreshold > 0.0 && m_isTrace.size() == m_nsp);
 
-            m_tcon[j] = m_trans->thermalConductivity();
-            if (m_do_soret) {
-                m_trans->getThermalDiffCoeffs(m_dthermal.ptrColumn(0) + j*m_nsp);
+    size_t nKey = m_nsp + 1;
+    if (m_transKeys.size() != nKey*m_points) {
+        m_transKeys.assign(nKey*m_points, Undef);
+        m_transStale.assign(m_points, 1);
+    }
+    for (size_t j = j0; j <= j1; j++) {
+        double* key = &m_transKeys[nKey*j];
+        const double* xj = x + m_nv*j;
+        bool same = (key[0] == xj[c_offset_T]);
+        for (size_t k = 0; same && k < m_nsp; k++) {
+            if (ignoreTrace && m_isTrace[k]) {
+                // perturbing a trace species does not invalidate the cached
+                // transport properties
+                continue;
             }
+            same = (key[k+1] == xj[c_offset_Y + k]);
         }
-    } else { // mixture averaged transport
-        for (size_t j = j0; j < j1; j++) {
-            setGasAtMidpoint(x,j);
-            m_visc[j] = (m_dovisc ? m_trans->viscosity() : 0.0);
-            m_trans->getMixDiffCoeffs(&m_diff[j*m_nsp]);
-            m_tcon[j] = m_trans->thermalConductivity();
+        if (!same) {
+            key[0] = xj[c_offset_T];
+            std::copy(xj + c_offset_Y, xj + c_offset_Y + m_nsp, key + 1);
+            if (j > 0) {
+                m_transStale[j-1] = 1;
+            }
+            m_transStale[j] = 1;
         }
     }
+
+    if (m_do_multicomponent) {
+        forPointsParallel(j0, j1 - 1,
+                          [&](size_t i, size_t jFirst, size_t jLast) {
+            ThermoPhase& gas = (i == 0) ? *m_thermo : *m_evaluators[i-1].thermo;
+            Transport& trans = (i == 0) ? *m_trans : *m_evaluators[i-1].trans;
+            vector_fp& ybar = (i == 0) ? m_ybar : m_evaluators[i-1].ybar;
+            // Let the transport manager warm-start its L-matrix solve from
+            // the solution computed at the same point on the previous visit
+            MultiTransport* mtran = dynamic_cast<MultiTransport*>(&trans);
+            for (size_t j = jFirst; j <= jLast; j++) {
+                if (!m_transStale[j]) {
+                    continue;
+                }
+                setGasAtMidpoint(gas, ybar, x, j);
+                if (mtran) {
+                    mtran->setGridPoint(j);
+                }
+                doublereal wtm = gas.meanMolecularWeight();
+                doublereal rho = gas.density();
+                m_visc[j] = (m_dovisc ? trans.viscosity() : 0.0);
+                trans.getMultiDiffCoeffs(m_nsp, &m_multidiff[mindex(0,0,j)]);
+
+                // Use m_diff as storage for the factor outside the summation
+                for (size_t k = 0; k < m_nsp; k++) {
+                    m_diff[k+j*m_nsp] = m_wt[k] * rho / (wtm*wtm);
+                }
+
+                m_tcon[j] = trans.thermalConductivity();
+                if (m_do_soret) {
+                    trans.getThermalDiffCoeffs(m_dthermal.ptrColumn(0)
+                                               + j*m_nsp);
+                }
+                updateTransportPoint(gas, trans, j);
+                m_transStale[j] = 0;
+            }
+            if (mtran) {
+                mtran->setGridPoint(npos);
+            }
+        });
+    } else { // mixture averaged transport
+        forPointsParallel(j0, j1 - 1,
+                          [&](size_t i, size_t jFirst, size_t jLast) {
+            ThermoPhase& gas = (i == 0) ? *m_thermo : *m_evaluators[i-1].thermo;
+            Transport& trans = (i == 0) ? *m_trans : *m_evaluators[i-1].trans;
+            vector_fp& ybar = (i == 0) ? m_ybar : m_evaluators[i-1].ybar;
+            for (size_t j = jFirst; j <= jLast; j++) {
+                if (!m_transStale[j]) {
+                    continue;
+                }
+                setGasAtMidpoint(gas, ybar, x, j);
+                m_visc[j] = (m_dovisc ? trans.viscosity() : 0.0);
+                trans.getMixDiffCoeffs(&m_diff[j*m_nsp]);
+                m_tcon[j] = trans.thermalConductivity();
+                updateTransportPoint(gas, trans, j);
+                m_transStale[j] = 0;
+            }
+        });
+    }
 }
 
 void StFlow::showSolution(const doublereal* x)
@@ -532,31 +830,79 @@ void StFlow::showSolution(const doublereal* x)
 
 void StFlow::updateDiffFluxes(const doublereal* x, size_t j0, size_t j1)
 {
+    // Gather the mole fractions of the affected points into contiguous
+    // columns, so the flux loops below read unit-stride scratch instead of
+    // converting from the mass fractions in the solution vector on every
+    // access
+    if (m_xMole.nRows() != m_nsp || m_xMole.nColumns() != m_points) {
+        m_xMole.resize(m_nsp, m_points);
+    }
+    for (size_t j = j0; j <= j1; j++) {
+        double* xcol = m_xMole.ptrColumn(j);
+        for (size_t k = 0; k < m_nsp; k++) {
+            xcol[k] = m_wtm[j]*Y(x,k,j)/m_wt[k];
+        }
+    }
+
     if (m_do_multicomponent) {
+        m_fluxAcc.resize(m_nsp);
         for (size_t j = j0; j < j1; j++) {
             double dz = z(j+1) - z(j);
-            for (size_t k = 0; k < m_nsp; k++) {
-                doublereal sum = 0.0;
-                for (size_t m = 0; m < m_nsp; m++) {
-                    sum += m_wt[m] * m_multidiff[mindex(k,m,j)] * (X(x,m,j+1)-X(x,m,j));
+            const double* xmj = m_xMole.ptrColumn(j);
+            const double* xmjp = m_xMole.ptrColumn(j+1);
+            // Accumulate over the driving species in the outer loop; for
+            // each m the multidiffusion coefficients D(k,m) are contiguous
+            // in k, so the inner loop is unit-stride
+            fill(m_fluxAcc.begin(), m_fluxAcc.end(), 0.0);
+            for (size_t m = 0; m < m_nsp; m++) {
+                double wdx = m_wt[m] * (xmjp[m] - xmj[m]);
+                const double* dcol = &m_multidiff[mindex(0,m,j)];
+                for (size_t k = 0; k < m_nsp; k++) {
+                    m_fluxAcc[k] += dcol[k] * wdx;
                 }
-                m_flux(k,j) = sum * m_diff[k+j*m_nsp] / dz;
+            }
+            for (size_t k = 0; k < m_nsp; k++) {
+                m_flux(k,j) = m_fluxAcc[k] * m_diff[k+j*m_nsp] / dz;
             }
         }
     } else {
+        bool bundleTrace = (m_traceThreshold > 0.0 && m_isTrace.size() == m_nsp);
         for (size_t j = j0; j < j1; j++) {
             double sum = 0.0;
             double wtm = m_wtm[j];
             double rho = density(j);
             double dz = z(j+1) - z(j);
+            double dbundle = 0.0;
+            if (bundleTrace) {
+                // trace species share one bundled diffusivity, the average
+                // of their mixture-averaged values at this midpoint
+                size_t ntrace = 0;
+                for (size_t k = 0; k < m_nsp; k++) {
+                    if (m_isTrace[k]) {
+                        dbundle += m_diff[k+m_nsp*j];
+                        ntrace++;
+                    }
+                }
+                if (ntrace) {
+                    dbundle /= ntrace;
+                }
+            }
+            const double* xmj = m_xMole.ptrColumn(j);
+            const double* xmjp = m_xMole.ptrColumn(j+1);
             for (size_t k = 0; k < m_nsp; k++) {
-                m_flux(k,j) = m_wt[k]*(rho*m_diff[k+m_nsp*j]/wtm);
-                m_flux(k,j) *= (X(x,k,j) - X(x,k,j+1))/dz;
+                double dk = (bundleTrace && m_isTrace[k]) ? dbundle
+                                                          : m_diff[k+m_nsp*j];
+                m_flux(k,j) = m_wt[k]*(rho*dk/wtm);
+                m_flux(k,j) *= (xmj[k] - xmjp[k])/dz;
                 sum -= m_flux(k,j);
             }
-            // correction flux to insure that \sum_k Y_k V_k = 0.
+            // correction flux to insure that \sum_k Y_k V_k = 0. Trace
+            // species are skipped; the flux they would carry is below the
+            // classification threshold.
             for (size_t k = 0; k < m_nsp; k++) {
-                m_flux(k,j) += sum*Y(x,k,j);
+                if (!bundleTrace || !m_isTrace[k]) {
+                    m_flux(k,j) += sum*Y(x,k,j);
+                }
             }
         }
     }
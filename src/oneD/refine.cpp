@@ -6,6 +6,9 @@
 #include "cantera/oneD/refine.h"
 #include "cantera/oneD/StFlow.h"
 #include "cantera/base/global.h"
+#include "cantera/base/ThreadPool.h"
+
+#include <thread>
 
 using namespace std;
 
@@ -14,7 +17,7 @@ namespace Cantera
 Refiner::Refiner(Domain1D& domain) :
     m_ratio(10.0), m_slope(0.8), m_curve(0.8), m_prune(-0.001),
     m_min_range(0.01), m_domain(&domain), m_npmax(1000),
-    m_gridmin(1e-10)
+    m_gridmin(1e-10), m_nThreads(1)
 {
     m_nv = m_domain->nComponents();
     m_active.resize(m_nv, true);
@@ -44,6 +47,14 @@ void Refiner::setCriteria(doublereal ratio, doublereal slope,
     m_prune = prune;
 }
 
+void Refiner::setNumThreads(size_t n)
+{
+    if (n == 0) {
+        n = std::max(1u, std::thread::hardware_concurrency());
+    }
+    m_nThreads = n;
+}
+
 int Refiner::analyze(size_t n, const doublereal* z,
                      const doublereal* x)
 {
@@ -69,17 +80,34 @@ int Refiner::analyze(size_t n, const doublereal* z,
         throw CanteraError("Refiner::analyze", "inconsistent");
     }
 
-    // find locations where cell size ratio is too large.
-    vector_fp v(n), s(n-1);
-
     vector_fp dz(n-1);
     for (size_t j = 0; j < n-1; j++) {
         dz[j] = z[j+1] - z[j];
     }
 
+    // The slope and curvature criteria of different components are
+    // independent, so the components are distributed over the configured
+    // number of threads. Each thread accumulates its verdicts in private
+    // flag arrays, which are merged below; for the keep flags, a vote to
+    // keep a point (1) always beats a vote to remove it (-1).
+    vector<size_t> comps;
     for (size_t i = 0; i < m_nv; i++) {
         if (m_active[i]) {
-            string name = m_domain->componentName(i);
+            comps.push_back(i);
+        }
+    }
+    size_t nThreads = std::min(std::max<size_t>(m_nThreads, 1), comps.size());
+
+    // find locations where the value or slope of any component changes too
+    // rapidly, and points that no component needs
+    auto analyzeComponents = [&](size_t icFirst, size_t icLast,
+                                 vector<int>& locF, vector<int>& keepF,
+                                 vector<string>& names) {
+        vector_fp v(n), s(n-1);
+        for (size_t ic = icFirst; ic < icLast; ic++) {
+            size_t i = comps[ic];
+            bool flagged = false;
+
             // get component i at all points
             for (size_t j = 0; j < n; j++) {
                 v[j] = value(x, i, j);
@@ -111,14 +139,14 @@ int Refiner::analyze(size_t n, const doublereal* z,
                 for (size_t j = 0; j < n-1; j++) {
                     doublereal r = fabs(v[j+1] - v[j])/dmax;
                     if (r > 1.0 && dz[j] >= 2 * m_gridmin) {
-                        m_loc[j] = 1;
-                        m_c[name] = 1;
+                        locF[j] = 1;
+                        flagged = true;
                     }
                     if (r >= m_prune) {
-                        m_keep[j] = 1;
-                        m_keep[j+1] = 1;
-                    } else if (m_keep[j] == 0) {
-                        m_keep[j] = -1;
+                        keepF[j] = 1;
+                        keepF[j+1] = 1;
+                    } else if (keepF[j] == 0) {
+                        keepF[j] = -1;
                     }
                 }
             }
@@ -135,17 +163,52 @@ int Refiner::analyze(size_t n, const doublereal* z,
                     doublereal r = fabs(s[j+1] - s[j]) / (dmax + m_thresh/dz[j]);
                     if (r > 1.0 && dz[j] >= 2 * m_gridmin &&
                             dz[j+1] >= 2 * m_gridmin) {
-                        m_c[name] = 1;
-                        m_loc[j] = 1;
-                        m_loc[j+1] = 1;
+                        locF[j] = 1;
+                        locF[j+1] = 1;
+                        flagged = true;
                     }
                     if (r >= m_prune) {
-                        m_keep[j+1] = 1;
-                    } else if (m_keep[j+1] == 0) {
-                        m_keep[j+1] = -1;
+                        keepF[j+1] = 1;
+                    } else if (keepF[j+1] == 0) {
+                        keepF[j+1] = -1;
                     }
                 }
             }
+
+            if (flagged) {
+                names.push_back(m_domain->componentName(i));
+            }
+        }
+    };
+
+    vector<vector<int>> locF(nThreads, vector<int>(n, 0));
+    vector<vector<int>> keepF(nThreads, vector<int>(n, 0));
+    vector<vector<string>> names(nThreads);
+    if (nThreads > 1) {
+        size_t chunk = (comps.size() + nThreads - 1) / nThreads;
+        ThreadPool::shared().run(nThreads, [&](size_t t) {
+            size_t icFirst = t*chunk;
+            size_t icLast = std::min(icFirst + chunk, comps.size());
+            analyzeComponents(icFirst, icLast, locF[t], keepF[t], names[t]);
+        });
+    } else if (nThreads == 1) {
+        analyzeComponents(0, comps.size(), locF[0], keepF[0], names[0]);
+    }
+
+    // merge the per-thread verdicts
+    for (size_t t = 0; t < nThreads; t++) {
+        for (size_t j = 0; j < n; j++) {
+            if (locF[t][j]) {
+                m_loc[j] = 1;
+            }
+            if (keepF[t][j] == 1) {
+                m_keep[j] = 1;
+            } else if (keepF[t][j] == -1 && m_keep[j] == 0) {
+                m_keep[j] = -1;
+            }
+        }
+        for (const auto& name : names[t]) {
+            m_c[name] = 1;
         }
     }
 
@@ -23,6 +23,9 @@ BinarySolutionTabulatedThermo::BinarySolutionTabulatedThermo(const std::string&
                                                              const std::string& id_)
     : m_kk_tab(npos)
     , m_xlast(-1)
+    , m_lookupXlo(0.0)
+    , m_lookupInvDx(0.0)
+    , m_interval(npos)
 
 {
     initThermoFile(inputFile, id_);
@@ -32,6 +35,9 @@ BinarySolutionTabulatedThermo::BinarySolutionTabulatedThermo(XML_Node& root,
                                                              const std::string& id_)
     : m_kk_tab(npos)
     , m_xlast(-1)
+    , m_lookupXlo(0.0)
+    , m_lookupInvDx(0.0)
+    , m_interval(npos)
 {
     importPhase(root, this);
 }
@@ -109,6 +115,7 @@ void BinarySolutionTabulatedThermo::initThermo()
             m_enthalpy_tab[i] = x_h[i].second;
             m_entropy_tab[i] = x_s[i].second;
         }
+        buildInterpolationIndex();
     }
     IdealSolidSolnPhase::initThermo();
 }
@@ -183,6 +190,7 @@ void BinarySolutionTabulatedThermo::initThermoXML(XML_Node& phaseNode, const std
                 m_enthalpy_tab[i] = x_h_temp[i].second;
                 m_entropy_tab[i] = x_s_temp[i].second;
             }
+            buildInterpolationIndex();
         } else {
             throw CanteraError("BinarySolutionTabulatedThermo::initThermoXML",
                     "Unspecified tabulated species or thermo");
@@ -211,6 +219,35 @@ void BinarySolutionTabulatedThermo::initThermoXML(XML_Node& phaseNode, const std
     ThermoPhase::initThermoXML(phaseNode, id_);
 }
 
+void BinarySolutionTabulatedThermo::buildInterpolationIndex()
+{
+    size_t N = m_molefrac_tab.size();
+    m_interval = npos;
+    m_lookup.clear();
+    m_lookupInvDx = 0.0;
+    if (N < 2) {
+        return;
+    }
+    m_lookupXlo = m_molefrac_tab.front();
+    double range = m_molefrac_tab.back() - m_lookupXlo;
+    if (range <= 0.0) {
+        return;
+    }
+    // A few cells per table interval keeps the forward scan in
+    // interpolate() to at most a step or two even for uneven tables.
+    size_t M = 4 * (N - 1);
+    m_lookupInvDx = M / range;
+    m_lookup.resize(M);
+    size_t i = 1;
+    for (size_t j = 0; j < M; j++) {
+        double edge = m_lookupXlo + j / m_lookupInvDx;
+        while (i < N - 1 && m_molefrac_tab[i] < edge) {
+            i++;
+        }
+        m_lookup[j] = i;
+    }
+}
+
 std::pair<double, double> BinarySolutionTabulatedThermo::interpolate(double x) const
 {
     std::pair<double, double> c;
@@ -225,12 +262,35 @@ std::pair<double, double> BinarySolutionTabulatedThermo::interpolate(double x) c
         c.second = m_entropy_tab[0];
         return c;
     }
-    size_t i = std::distance(m_molefrac_tab.begin(),
-      std::lower_bound(m_molefrac_tab.begin(), m_molefrac_tab.end(), x));
-    c.first = m_enthalpy_tab[i-1] + (m_enthalpy_tab[i] - m_enthalpy_tab[i-1])
-      * (x - m_molefrac_tab[i-1])/(m_molefrac_tab[i]- m_molefrac_tab[i-1]);
-    c.second = m_entropy_tab[i-1] + (m_entropy_tab[i] - m_entropy_tab[i-1])
-      * (x - m_molefrac_tab[i-1])/(m_molefrac_tab[i]- m_molefrac_tab[i-1]);
+    // Reuse the cached coefficients while the composition stays inside the
+    // interval it was last found in.
+    if (m_interval == npos || x < m_molefrac_tab[m_interval-1]
+            || x > m_molefrac_tab[m_interval]) {
+        size_t i;
+        if (!m_lookup.empty()) {
+            // O(1) bracketing via the uniform acceleration index
+            size_t j = static_cast<size_t>((x - m_lookupXlo) * m_lookupInvDx);
+            j = std::min(j, m_lookup.size() - 1);
+            i = m_lookup[j];
+            while (m_molefrac_tab[i] < x && i < m_molefrac_tab.size() - 1) {
+                i++;
+            }
+        } else {
+            i = std::distance(m_molefrac_tab.begin(),
+              std::lower_bound(m_molefrac_tab.begin(), m_molefrac_tab.end(), x));
+            // a query exactly at the first table point brackets upward
+            i = std::max<size_t>(i, 1);
+        }
+        double invDx = 1.0 / (m_molefrac_tab[i] - m_molefrac_tab[i-1]);
+        m_interval = i;
+        m_hIntercept = m_enthalpy_tab[i-1];
+        m_dhdx = (m_enthalpy_tab[i] - m_enthalpy_tab[i-1]) * invDx;
+        m_sIntercept = m_entropy_tab[i-1];
+        m_dsdx = (m_entropy_tab[i] - m_entropy_tab[i-1]) * invDx;
+    }
+    double dx = x - m_molefrac_tab[m_interval-1];
+    c.first = m_hIntercept + m_dhdx * dx;
+    c.second = m_sIntercept + m_dsdx * dx;
     return c;
 }
 
@@ -187,6 +187,55 @@ static struct atomicWeightData atomicWeightTable[] = {
     {"Og", "oganesson",      -1.0},
 };
 
+/*! Database for standard entropies of the elements
+ * Values are the standard entropies of the elements in their most stable
+ * standard state at 298.15 K and 1 bar, taken from the NIST-JANAF
+ * Thermochemical Tables: Chase (1998), Journal of Physical and Chemical
+ * Reference Data, Monograph 9. For gaseous reference states of diatomic
+ * elements, the tabulated value is half the entropy of the diatomic molecule.
+ * Elements with no tabulated reference-state data are not included here and
+ * report #ENTROPY298_UNKNOWN.
+ *
+ * units = J / kmol / K
+ */
+struct entropyData {
+    string symbol; //!< Element or isotope symbol, first letter capitalized
+    double entropy298; //!< Standard entropy at 298.15 K in J/kmol/K
+};
+
+/*!
+ * @var static struct entropyData entropyTable[]
+ * \brief entropyTable is a vector containing the element entropy database.
+ *
+ * entropyTable[] is a static variable with scope limited to this file. It can
+ * only be referenced via the functions in this file.
+ *
+ * The size of the table is given by the initial instantiation.
+ */
+static struct entropyData entropyTable[] = {
+    {"H",   65.340e3}, {"D",   72.480e3}, {"He", 126.152e3}, {"Li",  29.085e3},
+    {"Be",   9.440e3}, {"B",    5.834e3}, {"C",    5.740e3}, {"N",   95.8045e3},
+    {"O",  102.5735e3},{"F",  101.3945e3},{"Ne", 146.327e3}, {"Na",  51.455e3},
+    {"Mg",  32.671e3}, {"Al",  28.275e3}, {"Si",  18.820e3}, {"P",   41.077e3},
+    {"S",   32.056e3}, {"Cl", 111.535e3}, {"Ar", 154.845e3}, {"K",   64.670e3},
+    {"Ca",  41.588e3}, {"Ti",  30.759e3}, {"V",   28.936e3}, {"Cr",  23.618e3},
+    {"Mn",  32.010e3}, {"Fe",  27.321e3}, {"Co",  30.067e3}, {"Ni",  29.870e3},
+    {"Cu",  33.164e3}, {"Zn",  41.717e3}, {"Ga",  40.838e3}, {"Ge",  31.09e3},
+    {"As",  35.69e3},  {"Se",  42.27e3},  {"Br",  76.103e3}, {"Kr", 164.084e3},
+    {"Rb",  76.778e3}, {"Sr",  55.694e3}, {"Zr",  38.869e3}, {"Nb",  36.464e3},
+    {"Mo",  28.605e3}, {"Ru",  28.53e3},  {"Rh",  31.54e3},  {"Pd",  37.82e3},
+    {"Ag",  42.55e3},  {"Cd",  51.80e3},  {"In",  57.84e3},  {"Sn",  51.18e3},
+    {"Sb",  45.52e3},  {"Te",  49.71e3},  {"I",   58.071e3}, {"Xe", 169.684e3},
+    {"Cs",  85.147e3}, {"Ba",  62.475e3}, {"La",  56.90e3},  {"Ce",  72.00e3},
+    {"Pr",  73.93e3},  {"Nd",  71.09e3},  {"Sm",  69.50e3},  {"Eu",  80.79e3},
+    {"Gd",  40.83e3},  {"Tb",  73.30e3},  {"Dy",  74.89e3},  {"Ho",  75.02e3},
+    {"Er",  73.18e3},  {"Tm",  74.01e3},  {"Yb",  59.83e3},  {"Lu",  50.96e3},
+    {"Hf",  43.560e3}, {"Ta",  41.471e3}, {"W",   32.660e3}, {"Re",  36.53e3},
+    {"Os",  32.64e3},  {"Ir",  35.48e3},  {"Pt",  41.63e3},  {"Au",  47.49e3},
+    {"Hg",  76.028e3}, {"Tl",  64.18e3},  {"Pb",  64.785e3}, {"Bi",  56.74e3},
+    {"Th",  51.080e3}, {"U",   50.20e3},  {"E",    0.0},
+};
+
 /*!
  * @var static struct isotopeWeightData isotopeWeightTable[]
  * \brief isotopeWeightTable is a vector containing the atomic weights database.
@@ -250,6 +299,18 @@ double getElementWeight(int atomicNumber)
     return elementWeight;
 }
 
+double getElementEntropy298(const std::string& ename)
+{
+    int numEntries = sizeof(entropyTable) / sizeof(struct entropyData);
+    string symbol = trimCopy(ename);
+    for (int i = 0; i < numEntries; i++) {
+        if (symbol == entropyTable[i].symbol) {
+            return entropyTable[i].entropy298;
+        }
+    }
+    return ENTROPY298_UNKNOWN;
+}
+
 string getElementSymbol(const std::string& ename)
 {
     int numElements = numElementsDefined();
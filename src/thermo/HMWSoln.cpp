@@ -1420,8 +1420,14 @@ void HMWSoln::s_update_lnMolalityActCoeff() const
     calcMolalitiesCropped();
 
     // Update the temperature dependence of the Pitzer coefficients and their
-    // derivatives
-    s_updatePitzer_CoeffWRTemp();
+    // derivatives. The coefficients only depend on T and P, so composition-
+    // only state changes (for example, operator-split transport updating a
+    // few molalities per cell) skip this O(K^2) rebuild entirely.
+    static const int coeffCacheId = m_cache.getId();
+    CachedScalar coeffCached = m_cache.getScalar(coeffCacheId);
+    if (!coeffCached.validate(temperature(), pressure())) {
+        s_updatePitzer_CoeffWRTemp();
+    }
 
     // Calculate the IMS cutoff factors
     s_updateIMS_lnMolalityActCoeff();
@@ -270,6 +270,15 @@ void IdealGasPhase::setToEquilState(const doublereal* mu_RT)
     setState_PX(pres, &m_pp[0]);
 }
 
+AnyMap IdealGasPhase::memoryReport() const
+{
+    AnyMap report = ThermoPhase::memoryReport();
+    report["reference-state-cache-bytes"] = static_cast<long int>(
+        vectorBytes(m_h0_RT) + vectorBytes(m_cp0_R) + vectorBytes(m_g0_RT)
+        + vectorBytes(m_s0_R) + vectorBytes(m_expg0_RT) + vectorBytes(m_pp));
+    return report;
+}
+
 void IdealGasPhase::_updateThermo() const
 {
     static const int cacheId = m_cache.getId();
@@ -31,7 +31,10 @@ IonsFromNeutralVPSSTP::IonsFromNeutralVPSSTP(const std::string& inputFile,
         const std::string& id_) :
     ionSolnType_(cIonSolnType_SINGLEANION),
     numNeutralMoleculeSpecies_(0),
-    indexSpecialSpecies_(npos)
+    indexSpecialSpecies_(npos),
+    neutralStateNum_(-1),
+    lnActCoeffStateNum_(-1),
+    lnActCoeffTemp_(-1.0)
 {
     initThermoFile(inputFile, id_);
 }
@@ -40,7 +43,10 @@ IonsFromNeutralVPSSTP::IonsFromNeutralVPSSTP(XML_Node& phaseRoot,
         const std::string& id_) :
     ionSolnType_(cIonSolnType_SINGLEANION),
     numNeutralMoleculeSpecies_(0),
-    indexSpecialSpecies_(npos)
+    indexSpecialSpecies_(npos),
+    neutralStateNum_(-1),
+    lnActCoeffStateNum_(-1),
+    lnActCoeffTemp_(-1.0)
 {
     importPhase(phaseRoot, this);
 }
@@ -430,8 +436,19 @@ void IonsFromNeutralVPSSTP::getNeutralMoleculeMoleGrads(const doublereal* const
 void IonsFromNeutralVPSSTP::compositionChanged()
 {
     GibbsExcessVPSSTP::compositionChanged();
+
+    // Skip the mapping, and in particular the push into the neutral molecule
+    // phase that invalidates all of its cached properties, when the ionic
+    // composition is unchanged since the last mapping and the neutral phase
+    // still holds what we pushed then.
+    if (moleFractions_ == moleFractionsLast_
+            && neutralMoleculePhase_->stateMFNumber() == neutralStateNum_) {
+        return;
+    }
     calcNeutralMoleculeMoleFractions();
     neutralMoleculePhase_->setMoleFractions(NeutralMolecMoleFractions_.data());
+    moleFractionsLast_ = moleFractions_;
+    neutralStateNum_ = neutralMoleculePhase_->stateMFNumber();
 }
 
 // ------------ Partial Molar Properties of the Solution ------------
@@ -484,10 +501,11 @@ void IonsFromNeutralVPSSTP::initThermo()
         if (slash) {
             string fileName(neutralName.begin(), slash.begin());
             neutralName = string(slash.end(), neutralName.end());
-            AnyMap infile = AnyMap::fromYamlFile(fileName,
+            auto infile = AnyMap::fromYamlFileShared(fileName,
                         m_input.getString("__file__", ""));
-            AnyMap& phaseNode = infile["phases"].getMapWhere("name", neutralName);
-            setNeutralMoleculePhase(newPhase(phaseNode, infile));
+            AnyMap phaseNode = infile->at("phases").getMapWhere("name",
+                                                                neutralName);
+            setNeutralMoleculePhase(newPhase(phaseNode, *infile));
         } else {
             AnyMap& phaseNode = m_rootNode["phases"].getMapWhere("name", neutralName);
             setNeutralMoleculePhase(newPhase(phaseNode, m_rootNode));
@@ -666,6 +684,16 @@ void IonsFromNeutralVPSSTP::setParametersFromXML(const XML_Node& thermoNode)
 void IonsFromNeutralVPSSTP::s_update_lnActCoeff() const
 {
     size_t icat, jNeut;
+    // The mapping from the neutral molecule activity coefficients is
+    // repeated here on every property evaluation; skip it when neither the
+    // composition nor the temperature has changed since the last update.
+    if (lnActCoeffStateNum_ == stateMFNumber()
+            && lnActCoeffTemp_ == temperature()) {
+        return;
+    }
+    lnActCoeffStateNum_ = stateMFNumber();
+    lnActCoeffTemp_ = temperature();
+
     // Get the activity coefficients of the neutral molecules
     neutralMoleculePhase_->getLnActivityCoefficients(lnActCoeff_NeutralMolecule_.data());
 
@@ -26,7 +26,12 @@ namespace Cantera
 {
 LatticeSolidPhase::LatticeSolidPhase() :
     m_press(-1.0),
-    m_molar_density(0.0)
+    m_molar_density(0.0),
+    m_mflast(-1),
+    m_h_mole(0.0),
+    m_s_mole(0.0),
+    m_cp_mole(0.0),
+    m_propsValid(false)
 {
 }
 
@@ -72,11 +77,10 @@ doublereal LatticeSolidPhase::refPressure() const
 doublereal LatticeSolidPhase::enthalpy_mole() const
 {
     _updateThermo();
-    doublereal sum = 0.0;
-    for (size_t n = 0; n < m_lattice.size(); n++) {
-        sum += theta_[n] * m_lattice[n]->enthalpy_mole();
+    if (!m_propsValid) {
+        _aggregateThermo();
     }
-    return sum;
+    return m_h_mole;
 }
 
 doublereal LatticeSolidPhase::intEnergy_mole() const
@@ -92,31 +96,31 @@ doublereal LatticeSolidPhase::intEnergy_mole() const
 doublereal LatticeSolidPhase::entropy_mole() const
 {
     _updateThermo();
-    doublereal sum = 0.0;
-    for (size_t n = 0; n < m_lattice.size(); n++) {
-        sum += theta_[n] * m_lattice[n]->entropy_mole();
+    if (!m_propsValid) {
+        _aggregateThermo();
     }
-    return sum;
+    return m_s_mole;
 }
 
 doublereal LatticeSolidPhase::gibbs_mole() const
 {
+    // Each sublattice is held at the common temperature, so the weighted sum
+    // of the sublattice Gibbs energies reduces to h - T*s of the cached
+    // aggregates.
     _updateThermo();
-    doublereal sum = 0.0;
-    for (size_t n = 0; n < m_lattice.size(); n++) {
-        sum += theta_[n] * m_lattice[n]->gibbs_mole();
+    if (!m_propsValid) {
+        _aggregateThermo();
     }
-    return sum;
+    return m_h_mole - temperature() * m_s_mole;
 }
 
 doublereal LatticeSolidPhase::cp_mole() const
 {
     _updateThermo();
-    doublereal sum = 0.0;
-    for (size_t n = 0; n < m_lattice.size(); n++) {
-        sum += theta_[n] * m_lattice[n]->cp_mole();
+    if (!m_propsValid) {
+        _aggregateThermo();
     }
-    return sum;
+    return m_cp_mole;
 }
 
 Units LatticeSolidPhase::standardConcentrationUnits() const
@@ -380,6 +384,7 @@ void LatticeSolidPhase::addLattice(shared_ptr<ThermoPhase> lattice)
         m_x.push_back(lattice->moleFraction(k));
         tmpV_.push_back(0.0);
     }
+    m_latticeEpoch.push_back(-1);
 }
 
 void LatticeSolidPhase::setLatticeStoichiometry(const compositionMap& comp)
@@ -405,17 +410,53 @@ void LatticeSolidPhase::setLatticeStoichiometry(const compositionMap& comp)
 void LatticeSolidPhase::_updateThermo() const
 {
     doublereal tnow = temperature();
-    if (m_tlast != tnow) {
+    bool x_changed = (m_mflast != stateMFNumber());
+    if (x_changed) {
         getMoleFractions(m_x.data());
-        size_t strt = 0;
-        for (size_t n = 0; n < m_lattice.size(); n++) {
+        m_mflast = stateMFNumber();
+    }
+    size_t strt = 0;
+    for (size_t n = 0; n < m_lattice.size(); n++) {
+        // Re-sync a sublattice only when its state is actually out of date:
+        // the overall composition moved, or the lattice object was modified
+        // directly since the last push. A temperature change alone does not
+        // require pushing the unchanged composition and pressure back down.
+        bool modified = (m_latticeEpoch[n] != m_lattice[n]->stateEpoch());
+        if (x_changed || modified) {
             m_lattice[n]->setTemperature(tnow);
             m_lattice[n]->setMoleFractions(&m_x[strt]);
             m_lattice[n]->setPressure(m_press);
-            strt += m_lattice[n]->nSpecies();
+        } else if (m_tlast != tnow) {
+            m_lattice[n]->setTemperature(tnow);
+        }
+        if (x_changed || modified || m_tlast != tnow) {
+            m_latticeEpoch[n] = m_lattice[n]->stateEpoch();
+            m_propsValid = false;
         }
-        m_tlast = tnow;
+        strt += m_lattice[n]->nSpecies();
     }
+    m_tlast = tnow;
+}
+
+void LatticeSolidPhase::_aggregateThermo() const
+{
+    m_h_mole = 0.0;
+    m_s_mole = 0.0;
+    m_cp_mole = 0.0;
+    for (size_t n = 0; n < m_lattice.size(); n++) {
+        m_h_mole += theta_[n] * m_lattice[n]->enthalpy_mole();
+        m_s_mole += theta_[n] * m_lattice[n]->entropy_mole();
+        m_cp_mole += theta_[n] * m_lattice[n]->cp_mole();
+    }
+    m_propsValid = true;
+}
+
+void LatticeSolidPhase::invalidateCache()
+{
+    ThermoPhase::invalidateCache();
+    m_mflast = -1;
+    m_propsValid = false;
+    m_latticeEpoch.assign(m_latticeEpoch.size(), -1);
 }
 
 void LatticeSolidPhase::setLatticeMoleFractionsByName(int nn, const std::string& x)
@@ -20,6 +20,10 @@ namespace Cantera
 MixtureFugacityTP::MixtureFugacityTP() :
     iState_(FLUID_GAS),
     forcedState_(FLUID_UNDEFINED),
+    m_lastSolnTemp(-1.0),
+    m_lastSolnPres(0.0),
+    m_lastSolnRho(0.0),
+    m_lastSolnStateNum(-1),
     m_Tlast_ref(-1.0)
 {
 }
@@ -265,10 +269,28 @@ void MixtureFugacityTP::setState_TP(doublereal t, doublereal pres)
 
     if (forcedState_ == FLUID_UNDEFINED) {
         double rhoNow = Phase::density();
+        // If this state is a small step away from the last converged root
+        // at the same composition, seed the density solve from that root.
+        // When the new root stays close to the cached one, the phase
+        // identity cannot have changed either, so the phase-stability test
+        // is skipped; smooth isotherm traversals then avoid the multi-root
+        // search entirely. Crossing the critical temperature always forces
+        // the full check.
+        double tcrit = critTemperature();
+        bool nearLast = (m_lastSolnRho > 0.0
+                         && stateMFNumber() == m_lastSolnStateNum
+                         && (t >= tcrit) == (m_lastSolnTemp >= tcrit)
+                         && fabs(t - m_lastSolnTemp) < 0.01 * m_lastSolnTemp
+                         && fabs(pres - m_lastSolnPres) < 0.05 * m_lastSolnPres);
+        if (nearLast) {
+            rhoNow = m_lastSolnRho;
+        }
         double rho = densityCalc(t, pres, iState_, rhoNow);
         if (rho > 0.0) {
             Phase::setDensity(rho);
-            iState_ = phaseState(true);
+            if (!nearLast || fabs(rho - m_lastSolnRho) > 0.1 * m_lastSolnRho) {
+                iState_ = phaseState(true);
+            }
         } else {
             if (rho < -1.5) {
                 rho = densityCalc(t, pres, FLUID_UNDEFINED , rhoNow);
@@ -282,6 +304,10 @@ void MixtureFugacityTP::setState_TP(doublereal t, doublereal pres)
                 throw CanteraError("MixtureFugacityTP::setState_TP", "neg rho");
             }
         }
+        m_lastSolnTemp = t;
+        m_lastSolnPres = pres;
+        m_lastSolnRho = rho;
+        m_lastSolnStateNum = stateMFNumber();
     } else if (forcedState_ == FLUID_GAS) {
         // Normal density calculation
         if (iState_ < FLUID_LIQUID_0) {
@@ -331,6 +357,19 @@ void MixtureFugacityTP::setState_TPX(doublereal t, doublereal p, const doublerea
     setState_TP(t,p);
 }
 
+void MixtureFugacityTP::solveIsotherm(doublereal T, size_t nPoints,
+                                      const doublereal* presPa,
+                                      doublereal* rho, int* phase)
+{
+    for (size_t n = 0; n < nPoints; n++) {
+        setState_TP(T, presPa[n]);
+        rho[n] = density();
+        if (phase) {
+            phase[n] = iState_;
+        }
+    }
+}
+
 doublereal MixtureFugacityTP::z() const
 {
     return pressure() * meanMolecularWeight() / (density() * RT());
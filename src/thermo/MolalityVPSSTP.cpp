@@ -221,6 +221,22 @@ void MolalityVPSSTP::getMolalityActivityCoefficients(doublereal* acMolality) con
     applyphScale(acMolality);
 }
 
+void MolalityVPSSTP::getMolalityActivityCoefficientsBatch(size_t nPts,
+        const doublereal* X, doublereal* acMolality)
+{
+    // Bring the (T,P)-dependent quantities up to date once; the composition
+    // updates below leave them cached.
+    updateStandardStateThermo();
+
+    vector_fp xsave(m_kk);
+    getMoleFractions(xsave.data());
+    for (size_t n = 0; n < nPts; n++) {
+        setMoleFractions(X + n * m_kk);
+        getMolalityActivityCoefficients(acMolality + n * m_kk);
+    }
+    setMoleFractions(xsave.data());
+}
+
 doublereal MolalityVPSSTP::osmoticCoefficient() const
 {
     // First, we calculate the activities all over again
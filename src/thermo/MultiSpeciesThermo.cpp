@@ -13,13 +13,18 @@
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/utilities.h"
 #include "cantera/base/ctexceptions.h"
+#include "cantera/base/fastmath.h"
+#include "cantera/thermo/speciesThermoTypes.h"
 
 namespace Cantera
 {
 MultiSpeciesThermo::MultiSpeciesThermo() :
     m_tlow_max(0.0),
     m_thigh_min(1.0E30),
-    m_p0(OneAtm)
+    m_p0(OneAtm),
+    m_allNasa2(false),
+    m_nasa2_ok(false),
+    m_nUpdates(0)
 {
 }
 
@@ -44,6 +49,8 @@ void MultiSpeciesThermo::install_STIT(size_t index,
     m_tlow_max = std::max(stit_ptr->minTemp(), m_tlow_max);
     m_thigh_min = std::min(stit_ptr->maxTemp(), m_thigh_min);
     markInstalled(index);
+    m_nasa2_ok = false;
+    m_allNasa2 = (m_sp.size() == 1 && m_sp.begin()->first == NASA2);
 }
 
 void MultiSpeciesThermo::modifySpecies(size_t index,
@@ -76,11 +83,13 @@ void MultiSpeciesThermo::modifySpecies(size_t index,
     }
 
     m_sp[type][m_speciesLoc[index].second] = {index, spthermo};
+    m_nasa2_ok = false;
 }
 
 void MultiSpeciesThermo::update_single(size_t k, double t, double* cp_R,
                                        double* h_RT, double* s_R) const
 {
+    m_nUpdates++;
     const SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
     if (sp_ptr) {
         sp_ptr->updatePropertiesTemp(t, cp_R, h_RT, s_R);
@@ -90,9 +99,21 @@ void MultiSpeciesThermo::update_single(size_t k, double t, double* cp_R,
 void MultiSpeciesThermo::update(doublereal t, doublereal* cp_R,
                                   doublereal* h_RT, doublereal* s_R) const
 {
+    m_nUpdates++;
+    if (m_allNasa2) {
+        // Detected at install time: every species is NASA2, so the whole
+        // evaluation is the monomorphic packed-table kernel
+        updateNasa2(t, cp_R, h_RT, s_R);
+        return;
+    }
     auto iter = m_sp.begin();
     auto jter = m_tpoly.begin();
     for (; iter != m_sp.end(); iter++, jter++) {
+        if (iter->first == NASA2) {
+            // evaluated in one pass from the packed coefficient table
+            updateNasa2(t, cp_R, h_RT, s_R);
+            continue;
+        }
         const std::vector<index_STIT>& species = iter->second;
         double* tpoly = &jter->second[0];
         species[0].second->updateTemperaturePoly(t, tpoly);
@@ -103,6 +124,86 @@ void MultiSpeciesThermo::update(doublereal t, doublereal* cp_R,
     }
 }
 
+void MultiSpeciesThermo::buildNasa2Table() const
+{
+    const std::vector<index_STIT>& species = m_sp.at(NASA2);
+    size_t n = species.size();
+    m_nasa2_index.resize(n);
+    m_nasa2_tmid.resize(n);
+    m_nasa2_clow.resize(7*n);
+    m_nasa2_chigh.resize(7*n);
+    for (size_t k = 0; k < n; k++) {
+        // layout written by NasaPoly2::reportParameters:
+        // [Tmid, 7 high-T coefficients, 7 low-T coefficients]
+        double c[15];
+        size_t index;
+        int type;
+        double tlow, thigh, pref;
+        species[k].second->reportParameters(index, type, tlow, thigh,
+                                            pref, c);
+        m_nasa2_index[k] = species[k].first;
+        m_nasa2_tmid[k] = c[0];
+        std::copy(c + 1, c + 8, m_nasa2_chigh.begin() + 7*k);
+        std::copy(c + 8, c + 15, m_nasa2_clow.begin() + 7*k);
+    }
+    m_nasa2_csel.resize(7*n);
+    // empty interval, so the next update re-selects the branches
+    m_nasa2_tsel_low = 1.0;
+    m_nasa2_tsel_high = 0.0;
+    m_nasa2_ok = true;
+}
+
+void MultiSpeciesThermo::selectNasa2Branches(doublereal t) const
+{
+    // The selection stays valid until the temperature crosses the nearest
+    // midpoint temperature on either side of t
+    m_nasa2_tsel_low = 0.0;
+    m_nasa2_tsel_high = BigNumber;
+    for (size_t k = 0; k < m_nasa2_index.size(); k++) {
+        double tmid = m_nasa2_tmid[k];
+        if (t <= tmid) {
+            std::copy(m_nasa2_clow.begin() + 7*k, m_nasa2_clow.begin() + 7*k+7,
+                      m_nasa2_csel.begin() + 7*k);
+            m_nasa2_tsel_high = std::min(m_nasa2_tsel_high, tmid);
+        } else {
+            std::copy(m_nasa2_chigh.begin() + 7*k,
+                      m_nasa2_chigh.begin() + 7*k+7,
+                      m_nasa2_csel.begin() + 7*k);
+            m_nasa2_tsel_low = std::max(m_nasa2_tsel_low, tmid);
+        }
+    }
+}
+
+void MultiSpeciesThermo::updateNasa2(doublereal t, doublereal* cp_R,
+                                     doublereal* h_RT, doublereal* s_R) const
+{
+    if (!m_nasa2_ok) {
+        buildNasa2Table();
+    }
+    if (t <= m_nasa2_tsel_low || t > m_nasa2_tsel_high) {
+        selectNasa2Branches(t);
+    }
+    double tt1 = t;
+    double tt2 = t*t;
+    double tt3 = tt2*t;
+    double tt4 = tt3*t;
+    double rt = 1.0/t;
+    double logt = fast_log(t);
+    for (size_t k = 0; k < m_nasa2_index.size(); k++) {
+        const double* c = m_nasa2_csel.data() + 7*k;
+        double ct0 = c[0];
+        double ct1 = c[1]*tt1;
+        double ct2 = c[2]*tt2;
+        double ct3 = c[3]*tt3;
+        double ct4 = c[4]*tt4;
+        size_t i = m_nasa2_index[k];
+        cp_R[i] = ct0 + ct1 + ct2 + ct3 + ct4;
+        h_RT[i] = ct0 + 0.5*ct1 + 1.0/3.0*ct2 + 0.25*ct3 + 0.2*ct4
+                  + c[5]*rt;
+        s_R[i] = ct0*logt + ct1 + 0.5*ct2 + 1.0/3.0*ct3 + 0.25*ct4 + c[6];
+    }
+}
+
 int MultiSpeciesThermo::reportType(size_t index) const
 {
     const SpeciesThermoInterpType* sp = provideSTIT(index);
@@ -191,18 +292,54 @@ doublereal MultiSpeciesThermo::reportOneHf298(const size_t k) const
 
 void MultiSpeciesThermo::modifyOneHf298(const size_t k, const doublereal Hf298New)
 {
-    SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
+    SpeciesThermoInterpType* sp_ptr = detachSTIT(k);
     if (sp_ptr) {
         sp_ptr->modifyOneHf298(k, Hf298New);
+        m_nasa2_ok = false;
     }
 }
 
 void MultiSpeciesThermo::resetHf298(const size_t k)
 {
-    SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
+    SpeciesThermoInterpType* sp_ptr = detachSTIT(k);
     if (sp_ptr) {
         sp_ptr->resetHf298();
+        m_nasa2_ok = false;
+    }
+}
+
+SpeciesThermoInterpType* MultiSpeciesThermo::detachSTIT(size_t k)
+{
+    auto iter = m_speciesLoc.find(k);
+    if (iter == m_speciesLoc.end()) {
+        return 0;
+    }
+    shared_ptr<SpeciesThermoInterpType>& stit =
+        m_sp[iter->second.first][iter->second.second].second;
+    if (stit.use_count() > 1) {
+        try {
+            // The parameterization is shared with other phases (see
+            // newSpeciesThermoShared), so modifications are applied to a
+            // private copy. The copy adopts the current coefficients as its
+            // baseline; resetHf298() undoes only modifications made through
+            // this manager.
+            size_t index;
+            int type;
+            double tlow, thigh, pref;
+            vector_fp coeffs(stit->nCoeffs());
+            stit->reportParameters(index, type, tlow, thigh, pref,
+                                   coeffs.data());
+            shared_ptr<SpeciesThermoInterpType> fresh(
+                newSpeciesThermoInterpType(type, tlow, thigh, pref,
+                                           coeffs.data()));
+            fresh->input() = stit->input();
+            stit = fresh;
+        } catch (NotImplementedError&) {
+            // Parameterizations that cannot report their coefficients are
+            // never pooled, and are modified in place as before
+        }
     }
+    return stit.get();
 }
 
 bool MultiSpeciesThermo::ready(size_t nSpecies) {
@@ -26,6 +26,8 @@ int PDSS_HKFT::s_InputInconsistencyErrorExit = 1;
 PDSS_HKFT::PDSS_HKFT()
     : m_waterSS(0)
     , m_densWaterSS(-1.0)
+    , m_solvCacheTemp(-1.0)
+    , m_solvCachePres(-1.0)
     , m_deltaG_formation_tr_pr(NAN)
     , m_deltaH_formation_tr_pr(NAN)
     , m_Mu0_tr_pr(0.0)
@@ -46,6 +48,12 @@ PDSS_HKFT::PDSS_HKFT()
     m_pres = OneAtm;
     m_presR_bar = OneAtm * 1.0E-5;
     m_presR_bar = 1.0;
+    for (int i = 0; i < 4; i++) {
+        m_gstarCache[i] = 0.0;
+        m_gstarValid[i] = false;
+        m_relEpsCache[i] = 0.0;
+        m_relEpsValid[i] = false;
+    }
 }
 
 doublereal PDSS_HKFT::enthalpy_mole() const
@@ -114,10 +122,10 @@ doublereal PDSS_HKFT::cp_mole() const
                              -2.0*m_charge_j*dgvaldT*dgvaldT/(r_e_H2*r_e_H) + m_charge_j*d2gvaldT2 /r_e_H2);
     }
 
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
-    doublereal drelepsilondT = m_waterProps->relEpsilon(m_temp, m_pres, 1);
+    doublereal relepsilon = relEpsilon(m_temp, m_pres, 0);
+    doublereal drelepsilondT = relEpsilon(m_temp, m_pres, 1);
     doublereal Y = drelepsilondT / (relepsilon * relepsilon);
-    doublereal d2relepsilondT2 = m_waterProps->relEpsilon(m_temp, m_pres, 2);
+    doublereal d2relepsilondT2 = relEpsilon(m_temp, m_pres, 2);
 
     doublereal X = d2relepsilondT2 / (relepsilon* relepsilon) - 2.0 * relepsilon * Y * Y;
     doublereal Z = -1.0 / relepsilon;
@@ -166,8 +174,8 @@ doublereal PDSS_HKFT::molarVolume() const
                      + nu * m_charge_j / (r_e_H * r_e_H) * dgvaldP;
     }
 
-    doublereal drelepsilondP = m_waterProps->relEpsilon(m_temp, m_pres, 3);
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
+    doublereal drelepsilondP = relEpsilon(m_temp, m_pres, 3);
+    doublereal relepsilon = relEpsilon(m_temp, m_pres, 0);
     doublereal Q = drelepsilondP / (relepsilon * relepsilon);
     doublereal Z = -1.0 / relepsilon;
     doublereal wterm = - domega_jdP * (Z + 1.0);
@@ -290,11 +298,11 @@ void PDSS_HKFT::initThermo()
     // Section to initialize m_Z_pr_tr and m_Y_pr_tr
     m_temp = 273.15 + 25.;
     m_pres = OneAtm;
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
+    doublereal relepsilon = relEpsilon(m_temp, m_pres, 0);
     m_waterSS->setState_TP(m_temp, m_pres);
     m_densWaterSS = m_waterSS->density();
     m_Z_pr_tr = -1.0 / relepsilon;
-    doublereal drelepsilondT = m_waterProps->relEpsilon(m_temp, m_pres, 1);
+    doublereal drelepsilondT = relEpsilon(m_temp, m_pres, 1);
     m_Y_pr_tr = drelepsilondT / (relepsilon * relepsilon);
     m_waterProps.reset(new WaterProps(m_waterSS));
     m_presR_bar = OneAtm / 1.0E5;
@@ -503,8 +511,8 @@ doublereal PDSS_HKFT::deltaH() const
                      + nu * m_charge_j / (3.082 + gval) / (3.082 + gval) * dgvaldT;
     }
 
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
-    doublereal drelepsilondT = m_waterProps->relEpsilon(m_temp, m_pres, 1);
+    doublereal relepsilon = relEpsilon(m_temp, m_pres, 0);
+    doublereal drelepsilondT = relEpsilon(m_temp, m_pres, 1);
 
     doublereal Y = drelepsilondT / (relepsilon * relepsilon);
     doublereal Z = -1.0 / relepsilon;
@@ -548,7 +556,7 @@ doublereal PDSS_HKFT::deltaG() const
         omega_j = nu * (m_charge_j * m_charge_j / r_e_j - m_charge_j / (3.082 + gval));
     }
 
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
+    doublereal relepsilon = relEpsilon(m_temp, m_pres, 0);
     doublereal Z = -1.0 / relepsilon;
     doublereal wterm = - omega_j * (Z + 1.0);
     doublereal wrterm = m_omega_pr_tr * (m_Z_pr_tr + 1.0);
@@ -586,8 +594,8 @@ doublereal PDSS_HKFT::deltaS() const
                      + nu * m_charge_j / (3.082 + gval) / (3.082 + gval) * dgvaldT;
     }
 
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
-    doublereal drelepsilondT = m_waterProps->relEpsilon(m_temp, m_pres, 1);
+    doublereal relepsilon = relEpsilon(m_temp, m_pres, 0);
+    doublereal drelepsilondT = relEpsilon(m_temp, m_pres, 1);
     doublereal Y = drelepsilondT / (relepsilon * relepsilon);
     doublereal Z = -1.0 / relepsilon;
     doublereal wterm = omega_j * Y;
@@ -717,9 +725,39 @@ doublereal PDSS_HKFT::g(const doublereal temp, const doublereal pres, const int
 
 doublereal PDSS_HKFT::gstar(const doublereal temp, const doublereal pres, const int ifunc) const
 {
+    if (temp != m_solvCacheTemp || pres != m_solvCachePres) {
+        m_solvCacheTemp = temp;
+        m_solvCachePres = pres;
+        for (int i = 0; i < 4; i++) {
+            m_gstarValid[i] = false;
+            m_relEpsValid[i] = false;
+        }
+    } else if (m_gstarValid[ifunc]) {
+        return m_gstarCache[ifunc];
+    }
     doublereal gval = g(temp, pres, ifunc);
     doublereal fval = f(temp, pres, ifunc);
     double res = gval - fval;
+    m_gstarCache[ifunc] = res;
+    m_gstarValid[ifunc] = true;
+    return res;
+}
+
+doublereal PDSS_HKFT::relEpsilon(const doublereal temp, const doublereal pres, const int ifunc) const
+{
+    if (temp != m_solvCacheTemp || pres != m_solvCachePres) {
+        m_solvCacheTemp = temp;
+        m_solvCachePres = pres;
+        for (int i = 0; i < 4; i++) {
+            m_gstarValid[i] = false;
+            m_relEpsValid[i] = false;
+        }
+    } else if (m_relEpsValid[ifunc]) {
+        return m_relEpsCache[ifunc];
+    }
+    doublereal res = m_waterProps->relEpsilon(temp, pres, ifunc);
+    m_relEpsCache[ifunc] = res;
+    m_relEpsValid[ifunc] = true;
     return res;
 }
 
@@ -51,6 +51,7 @@ doublereal PDSS_IdealGas::pressure() const
 
 void PDSS_IdealGas::setPressure(doublereal p)
 {
+    m_pres = p;
     m_sss_R = m_s0_R - log(m_pres/m_p0);
     m_gss_RT = m_hss_RT - m_sss_R;
     m_Vss = GasConstant * m_temp / m_pres;
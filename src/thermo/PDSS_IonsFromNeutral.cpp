@@ -241,4 +241,10 @@ void PDSS_IonsFromNeutral::setState_TP(doublereal temp, doublereal pres)
     m_temp = temp;
 }
 
+void PDSS_IonsFromNeutral::setPressure(doublereal pres)
+{
+    neutralMoleculePhase_->setPressure(pres);
+    m_pres = pres;
+}
+
 }
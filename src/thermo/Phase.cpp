@@ -7,9 +7,11 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/thermo/Phase.h"
+#include "cantera/base/global.h"
 #include "cantera/base/utilities.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/ctml.h"
+#include "cantera/base/AnyMap.h"
 #include "cantera/thermo/Species.h"
 #include "cantera/thermo/ThermoFactory.h"
 
@@ -23,12 +25,20 @@ Phase::Phase() :
     m_ndim(3),
     m_undefinedElementBehavior(UndefElement::add),
     m_caseSensitiveSpecies(false),
-    m_xml(new XML_Node("phase")),
+    m_xml(0),
     m_id("<phase>"),
     m_temp(0.001),
     m_dens(0.001),
     m_mmw(0.0),
     m_stateNum(-1),
+    m_tempEpoch(0),
+    m_densEpoch(0),
+    m_x_cacheNum(-2),
+    m_conc_cacheNum(-2),
+    m_conc_cacheDens(-1),
+    m_rawPeer(0),
+    m_rawPeerKK(0),
+    m_rawSelfKK(0),
     m_mm(0),
     m_elem_type(0)
 {
@@ -45,9 +55,19 @@ Phase::~Phase()
 
 XML_Node& Phase::xml() const
 {
+    // The XML tree is created on the first request so that phases built from
+    // YAML (or programmatically) never allocate XML_Node objects.
+    if (!m_xml) {
+        m_xml = new XML_Node("phase");
+    }
     return *m_xml;
 }
 
+bool Phase::hasXMLdata() const
+{
+    return m_xml != 0;
+}
+
 void Phase::setXMLdata(XML_Node& xmlPhase)
 {
     XML_Node* xroot = &xmlPhase.root();
@@ -283,15 +303,27 @@ size_t Phase::stateSize() const {
     }
 }
 
+const std::map<std::string, size_t>& Phase::nativeStateCache() const
+{
+    if (m_nativeState.empty()) {
+        incrementHotPathAllocationCount();
+        m_nativeState = nativeState();
+    }
+    return m_nativeState;
+}
+
 void Phase::saveState(vector_fp& state) const
 {
-    state.resize(stateSize());
+    if (state.size() != stateSize()) {
+        incrementHotPathAllocationCount();
+        state.resize(stateSize());
+    }
     saveState(state.size(), &state[0]);
 }
 
 void Phase::saveState(size_t lenstate, doublereal* state) const
 {
-    auto native = nativeState();
+    const auto& native = nativeStateCache();
 
     // function assumes default definition of nativeState
     state[native.at("T")] = temperature();
@@ -301,9 +333,9 @@ void Phase::saveState(size_t lenstate, doublereal* state) const
         state[native.at("P")] = pressure();
     }
     if (native.count("X")) {
-        getMoleFractions(state + native["X"]);
+        getMoleFractions(state + native.at("X"));
     } else if (native.count("Y")) {
-        getMassFractions(state + native["Y"]);
+        getMassFractions(state + native.at("Y"));
     }
 }
 
@@ -320,7 +352,7 @@ void Phase::restoreState(size_t lenstate, const double* state)
                              lenstate, ls);
     }
 
-    auto native = nativeState();
+    const auto& native = nativeStateCache();
     setTemperature(state[native.at("T")]);
     if (isCompressible()) {
         setDensity(state[native.at("D")]);
@@ -329,13 +361,79 @@ void Phase::restoreState(size_t lenstate, const double* state)
     }
 
     if (native.count("X")) {
-        setMoleFractions_NoNorm(state + native["X"]);
+        setMoleFractions_NoNorm(state + native.at("X"));
     } else if (native.count("Y")) {
-        setMassFractions_NoNorm(state + native["Y"]);
+        setMassFractions_NoNorm(state + native.at("Y"));
+    }
+    compositionChanged();
+}
+
+void Phase::saveStateRaw(doublereal* state) const
+{
+    state[0] = m_temp;
+    state[1] = m_dens;
+    state[2] = m_mmw;
+    copy(m_y.begin(), m_y.end(), state + 3);
+    copy(m_ym.begin(), m_ym.end(), state + 3 + m_kk);
+}
+
+void Phase::restoreStateRaw(const doublereal* state)
+{
+    if (state[0] != m_temp) {
+        m_tempEpoch++;
+    }
+    m_temp = state[0];
+    if (state[1] != m_dens) {
+        m_densEpoch++;
     }
+    m_dens = state[1];
+    m_mmw = state[2];
+    copy(state + 3, state + 3 + m_kk, m_y.begin());
+    copy(state + 3 + m_kk, state + 3 + 2 * m_kk, m_ym.begin());
     compositionChanged();
 }
 
+void Phase::checkRawStateCompatibility(const Phase& other) const
+{
+    if (&other == m_rawPeer && other.m_kk == m_rawPeerKK
+            && m_kk == m_rawSelfKK) {
+        return;
+    }
+    if (other.m_kk != m_kk) {
+        throw CanteraError("Phase::checkRawStateCompatibility",
+            "Phase '{}' has {} species but phase '{}' has {}.",
+            name(), m_kk, other.name(), other.m_kk);
+    }
+    for (size_t k = 0; k < m_kk; k++) {
+        if (other.m_speciesNames[k] != m_speciesNames[k]) {
+            throw CanteraError("Phase::checkRawStateCompatibility",
+                "Species {} is named '{}' in phase '{}' but '{}' in "
+                "phase '{}'.", k, m_speciesNames[k], name(),
+                other.m_speciesNames[k], other.name());
+        }
+    }
+    m_rawPeer = &other;
+    m_rawPeerKK = other.m_kk;
+    m_rawSelfKK = m_kk;
+}
+
+void Phase::copyStateTo(Phase& dest) const
+{
+    checkRawStateCompatibility(dest);
+    if (m_temp != dest.m_temp) {
+        dest.m_tempEpoch++;
+    }
+    dest.m_temp = m_temp;
+    if (m_dens != dest.m_dens) {
+        dest.m_densEpoch++;
+    }
+    dest.m_dens = m_dens;
+    dest.m_mmw = m_mmw;
+    copy(m_y.begin(), m_y.end(), dest.m_y.begin());
+    copy(m_ym.begin(), m_ym.end(), dest.m_ym.begin());
+    dest.compositionChanged();
+}
+
 void Phase::setMoleFractions(const double* const x)
 {
     // Use m_y as a temporary work vector for the non-negative mole fractions
@@ -370,8 +468,8 @@ void Phase::setMoleFractions(const double* const x)
 
 void Phase::setMoleFractions_NoNorm(const double* const x)
 {
-    m_mmw = dot(x, x + m_kk, m_molwts.begin());
-    scale(x, x + m_kk, m_ym.begin(), 1.0/m_mmw);
+    m_mmw = dot(m_kk, x, m_molwts.data());
+    scale(m_kk, x, m_ym.data(), 1.0/m_mmw);
     transform(m_ym.begin(), m_ym.begin() + m_kk, m_molwts.begin(),
               m_y.begin(), multiplies<double>());
     compositionChanged();
@@ -424,6 +522,16 @@ void Phase::setMassFractionsByName(const std::string& y)
     setMassFractionsByName(parseCompString(y));
 }
 
+void Phase::setMassFractionsByIndex(size_t n, const size_t* ks, const double* ys)
+{
+    vector_fp mf(m_kk, 0.0);
+    for (size_t i = 0; i < n; i++) {
+        checkSpeciesIndex(ks[i]);
+        mf[ks[i]] = ys[i];
+    }
+    setMassFractions(mf.data());
+}
+
 void Phase::setState_TRX(doublereal t, doublereal dens, const doublereal* x)
 {
     setMoleFractions(x);
@@ -452,6 +560,45 @@ void Phase::setState_TRY(doublereal t, doublereal dens, const doublereal* y)
     setDensity(dens);
 }
 
+void Phase::setState_TRY_raw(doublereal t, doublereal dens, const doublereal* y)
+{
+    AssertThrowMsg(t > 0.0 && dens > 0.0, "Phase::setState_TRY_raw",
+                   "temperature and density must be positive");
+#ifndef NDEBUG
+    // The tolerances allow the small excursions produced by error-controlled
+    // integrators, which the normal setters tolerate as well.
+    double norm = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        AssertThrowMsg(y[k] >= -1e-5, "Phase::setState_TRY_raw",
+                       "negative mass fraction for species {}: {}",
+                       speciesName(k), y[k]);
+        norm += y[k];
+    }
+    AssertThrowMsg(std::abs(norm - 1.0) < 1e-3, "Phase::setState_TRY_raw",
+                   "mass fractions are not normalized: sum = {}", norm);
+#endif
+
+    // single fused pass: copy the mass fractions and rebuild the cached
+    // Y_k/M_k vector and mean molecular weight
+    double sum = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        m_y[k] = y[k];
+        m_ym[k] = y[k] * m_rmolwts[k];
+        sum += m_ym[k];
+    }
+    m_mmw = 1.0 / sum;
+
+    if (t != m_temp) {
+        m_tempEpoch++;
+        m_temp = t;
+    }
+    if (dens != m_dens) {
+        m_densEpoch++;
+        m_dens = dens;
+    }
+    compositionChanged();
+}
+
 void Phase::setState_TRY(doublereal t, doublereal dens, const compositionMap& y)
 {
     setMassFractionsByName(y);
@@ -542,7 +689,17 @@ compositionMap Phase::getMassFractionsByName(double threshold) const
 
 void Phase::getMoleFractions(double* const x) const
 {
-    scale(m_ym.begin(), m_ym.end(), x, m_mmw);
+    scale(m_kk, m_ym.data(), x, m_mmw);
+}
+
+const vector_fp& Phase::moleFractions() const
+{
+    if (m_x_cacheNum != m_stateNum || m_x_cache.size() != m_kk) {
+        m_x_cache.resize(m_kk);
+        scale(m_kk, m_ym.data(), m_x_cache.data(), m_mmw);
+        m_x_cacheNum = m_stateNum;
+    }
+    return m_x_cache;
 }
 
 double Phase::moleFraction(size_t k) const
@@ -595,7 +752,19 @@ double Phase::concentration(const size_t k) const
 
 void Phase::getConcentrations(double* const c) const
 {
-    scale(m_ym.begin(), m_ym.end(), c, m_dens);
+    scale(m_kk, m_ym.data(), c, m_dens);
+}
+
+const vector_fp& Phase::concentrations() const
+{
+    if (m_conc_cacheNum != m_stateNum || m_conc_cacheDens != m_densEpoch
+        || m_conc_cache.size() != m_kk) {
+        m_conc_cache.resize(m_kk);
+        scale(m_kk, m_ym.data(), m_conc_cache.data(), m_dens);
+        m_conc_cacheNum = m_stateNum;
+        m_conc_cacheDens = m_densEpoch;
+    }
+    return m_conc_cache;
 }
 
 void Phase::setConcentrations(const double* const conc)
@@ -676,7 +845,11 @@ double Phase::molarDensity() const
 void Phase::setMolarDensity(const double molar_density)
 {
     assertCompressible("setMolarDensity");
-    m_dens = molar_density*meanMolecularWeight();
+    double dens = molar_density*meanMolecularWeight();
+    if (dens != m_dens) {
+        m_densEpoch++;
+    }
+    m_dens = dens;
 }
 
 double Phase::molarVolume() const
@@ -688,6 +861,9 @@ void Phase::setDensity(const double density_)
 {
     assertCompressible("setDensity");
     if (density_ > 0.0) {
+        if (density_ != m_dens) {
+            m_densEpoch++;
+        }
         m_dens = density_;
     } else {
         throw CanteraError("Phase::setDensity",
@@ -698,6 +874,9 @@ void Phase::setDensity(const double density_)
 void Phase::assignDensity(const double density_)
 {
     if (density_ > 0.0) {
+        if (density_ != m_dens) {
+            m_densEpoch++;
+        }
         m_dens = density_;
     } else {
         throw CanteraError("Phase::assignDensity",
@@ -748,16 +927,10 @@ size_t Phase::addElement(const std::string& symbol, doublereal weight,
         weight = getElementWeight(symbol);
     }
 
-    // Try to look up the standard entropy if not given. Fail silently.
+    // Try to look up the standard entropy if not given. Elements without a
+    // tabulated value keep ENTROPY298_UNKNOWN.
     if (entropy298 == ENTROPY298_UNKNOWN) {
-        try {
-            XML_Node* db = get_XML_File("elements.xml");
-            XML_Node* elnode = db->findByAttr("name", symbol);
-            if (elnode && elnode->hasChild("entropy298")) {
-                entropy298 = fpValueCheck(elnode->child("entropy298")["value"]);
-            }
-        } catch (CanteraError&) {
-        }
+        entropy298 = getElementEntropy298(symbol);
     }
 
     // Check for duplicates
@@ -897,6 +1070,44 @@ bool Phase::addSpecies(shared_ptr<Species> spec) {
     return true;
 }
 
+size_t Phase::addSpeciesBulk(const std::vector<shared_ptr<Species>>& species)
+{
+    // Add the elements that addSpecies() would otherwise add one at a time
+    // from the species compositions, so the composition table below is laid
+    // out just once
+    if (m_undefinedElementBehavior == UndefElement::add) {
+        for (const auto& spec : species) {
+            for (const auto& elem : spec->composition) {
+                if (elementIndex(elem.first) == npos) {
+                    addElement(elem.first);
+                }
+            }
+            if (spec->charge != 0.0 && elementIndex("E") == npos) {
+                addElement("E", 0.000545, 0, 0.0,
+                           CT_ELEM_TYPE_ELECTRONCHARGE);
+            }
+        }
+    }
+
+    size_t nTotal = m_kk + species.size();
+    m_speciesNames.reserve(nTotal);
+    m_speciesCharge.reserve(nTotal);
+    m_speciesComp.reserve(nTotal * nElements());
+    m_molwts.reserve(nTotal);
+    m_rmolwts.reserve(nTotal);
+    m_y.reserve(nTotal);
+    m_ym.reserve(nTotal);
+
+    size_t added = 0;
+    for (const auto& spec : species) {
+        // the virtual call keeps the bookkeeping of derived phases intact
+        if (addSpecies(spec)) {
+            added++;
+        }
+    }
+    return added;
+}
+
 void Phase::modifySpecies(size_t k, shared_ptr<Species> spec)
 {
     if (speciesName(k) != spec->name) {
@@ -984,6 +1195,42 @@ bool Phase::ready() const
 
 void Phase::invalidateCache() {
     m_cache.clear();
+    // Bump the epoch counters so that caches held by dependent objects
+    // (kinetics, transport) that are keyed on them are also invalidated
+    m_tempEpoch++;
+    m_densEpoch++;
+    m_stateNum++;
+}
+
+AnyMap Phase::memoryReport() const
+{
+    AnyMap report;
+    report["name"] = name();
+    report["n-species"] = static_cast<long int>(nSpecies());
+    report["n-elements"] = static_cast<long int>(nElements());
+
+    size_t tables = vectorBytes(m_speciesComp) + vectorBytes(m_speciesCharge)
+        + vectorBytes(m_molwts) + vectorBytes(m_rmolwts)
+        + vectorBytes(m_atomicWeights) + vectorBytes(m_atomicNumbers)
+        + vectorBytes(m_elem_type) + vectorBytes(m_entropy298)
+        + vectorBytes(m_speciesNames) + vectorBytes(m_elementNames);
+    for (const auto& nm : m_speciesNames) {
+        tables += nm.capacity();
+    }
+    report["species-tables-bytes"] = static_cast<long int>(tables);
+    report["state-bytes"] = static_cast<long int>(
+        vectorBytes(m_y) + vectorBytes(m_ym));
+
+    // Species definition objects reached through more than one shared_ptr
+    // are shared with other phases and cost nothing extra per instance
+    size_t shared = 0;
+    for (const auto& sp : m_species) {
+        if (sp.second.use_count() > 1) {
+            shared++;
+        }
+    }
+    report["shared-species-objects"] = static_cast<long int>(shared);
+    return report;
 }
 
 void Phase::setMolecularWeight(const int k, const double mw)
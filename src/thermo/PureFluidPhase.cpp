@@ -62,6 +62,17 @@ void PureFluidPhase::initThermo()
              +name()+"\n", m_verbose);
 }
 
+void PureFluidPhase::useTabulatedEOS(size_t np)
+{
+    if (!m_sub) {
+        throw CanteraError("PureFluidPhase::useTabulatedEOS",
+                           "call initThermo() first");
+    }
+    // wrapping after initThermo() bakes the standard-state offsets set
+    // there into the tables
+    m_sub.reset(tpx::newTabulatedSubstance(m_sub.release(), np));
+}
+
 void PureFluidPhase::getParameters(AnyMap& phaseNode) const
 {
     ThermoPhase::getParameters(phaseNode);
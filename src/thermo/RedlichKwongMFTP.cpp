@@ -975,6 +975,52 @@ doublereal RedlichKwongMFTP::densityCalc(doublereal TKelvin, doublereal presPa,
     return mmw / molarVolLast;
 }
 
+void RedlichKwongMFTP::getMolarVolumesAndFugacities(size_t n,
+        const doublereal* TKelvin, const doublereal* presPa, int phase,
+        doublereal* molarVols, doublereal* fugCoeffs) const
+{
+    // Aggregate the mixing rules once. For the linear-in-T parameterization
+    // the mixture 'a' parameter is itself linear in T, so the per-point work
+    // below does not depend on the number of species.
+    doublereal a0 = 0.0;
+    doublereal a1 = 0.0;
+    doublereal b = 0.0;
+    for (size_t i = 0; i < m_kk; i++) {
+        b += moleFractions_[i] * b_vec_Curr_[i];
+        for (size_t j = 0; j < m_kk; j++) {
+            size_t counter = i * m_kk + j;
+            doublereal xij = moleFractions_[i] * moleFractions_[j];
+            a0 += xij * a_coeff_vec(0, counter);
+            if (m_formTempParam == 1) {
+                a1 += xij * a_coeff_vec(1, counter);
+            }
+        }
+    }
+
+    for (size_t m = 0; m < n; m++) {
+        doublereal T = TKelvin[m];
+        doublereal pres = presPa[m];
+        doublereal a = a0 + a1 * T;
+        doublereal Vroot[3];
+        int nsol = NicholsSolve(T, pres, a, b, Vroot);
+        doublereal mv;
+        if (nsol == 3) {
+            // Both branches exist; select the one that was requested
+            mv = (phase >= FLUID_LIQUID_0) ? Vroot[0] : Vroot[2];
+        } else {
+            mv = Vroot[0];
+        }
+        molarVols[m] = mv;
+        if (fugCoeffs) {
+            // ln phi = Z - 1 - ln(Z (v-b)/v) - a/(b R T^1.5) ln((v+b)/v)
+            doublereal zz = pres * mv / (GasConstant * T);
+            fugCoeffs[m] = exp(zz - 1.0 - log(zz * (mv - b) / mv)
+                               - a / (b * GasConstant * T * sqrt(T))
+                                 * log((mv + b) / mv));
+        }
+    }
+}
+
 doublereal RedlichKwongMFTP::densSpinodalLiquid() const
 {
     double Vroot[3];
@@ -133,7 +133,10 @@ unique_ptr<Species> newSpecies(const AnyMap& node)
                                       node["composition"].asMap<double>()));
 
     if (node.hasKey("thermo")) {
-        s->thermo = newSpeciesThermo(node["thermo"].as<AnyMap>());
+        // Identical parameterizations resolve to one shared object, so the
+        // coefficient tables are not duplicated when the same species
+        // definitions are imported repeatedly
+        s->thermo = newSpeciesThermoShared(node["thermo"].as<AnyMap>());
     } else {
         s->thermo.reset(new SpeciesThermoInterpType());
     }
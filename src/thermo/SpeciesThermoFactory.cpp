@@ -22,6 +22,10 @@
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/Units.h"
 
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
 using namespace std;
 
 namespace Cantera
@@ -481,4 +485,65 @@ unique_ptr<SpeciesThermoInterpType> newSpeciesThermo(const AnyMap& node)
     }
 }
 
+namespace {
+
+//! Pool of reference-state parameterizations shared among all species with
+//! identical definitions; see newSpeciesThermoShared(). Entries are kept for
+//! the lifetime of the process, which is bounded by the number of distinct
+//! parameterizations that have been imported.
+std::mutex thermoPoolMutex;
+std::unordered_multimap<size_t, shared_ptr<SpeciesThermoInterpType>> thermoPool;
+
+//! Report the defining parameters of *stit* and return a hash over them
+size_t speciesThermoFingerprint(const SpeciesThermoInterpType& stit, int& type,
+                                double& tlow, double& thigh, double& pref,
+                                vector_fp& coeffs)
+{
+    size_t index;
+    coeffs.resize(stit.nCoeffs());
+    stit.reportParameters(index, type, tlow, thigh, pref, coeffs.data());
+    size_t h = static_cast<size_t>(type);
+    auto mix = [&h](double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        h ^= bits + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+    };
+    mix(tlow);
+    mix(thigh);
+    mix(pref);
+    for (double c : coeffs) {
+        mix(c);
+    }
+    return h;
+}
+
+} // end unnamed namespace
+
+shared_ptr<SpeciesThermoInterpType> newSpeciesThermoShared(const AnyMap& thermo_node)
+{
+    shared_ptr<SpeciesThermoInterpType> stit(newSpeciesThermo(thermo_node));
+    int type;
+    double tlow, thigh, pref;
+    vector_fp coeffs;
+    size_t h = speciesThermoFingerprint(*stit, type, tlow, thigh, pref, coeffs);
+
+    std::unique_lock<std::mutex> lock(thermoPoolMutex);
+    auto range = thermoPool.equal_range(h);
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        const SpeciesThermoInterpType& cand = *iter->second;
+        int candType;
+        double candTlow, candThigh, candPref;
+        vector_fp candCoeffs;
+        speciesThermoFingerprint(cand, candType, candTlow, candThigh,
+                                 candPref, candCoeffs);
+        if (candType == type && candTlow == tlow && candThigh == thigh
+            && candPref == pref && candCoeffs == coeffs
+            && cand.input() == stit->input()) {
+            return iter->second;
+        }
+    }
+    thermoPool.emplace(h, stit);
+    return stit;
+}
+
 }
@@ -136,6 +136,36 @@ void SurfPhase::getChemPotentials(doublereal* mu) const
     }
 }
 
+void SurfPhase::getChemPotentialsBatch(size_t nStates, const doublereal* T,
+                                       const doublereal* theta,
+                                       doublereal* mu)
+{
+    doublereal T_save = temperature();
+    for (size_t i = 0; i < nStates; i++) {
+        const doublereal* th = theta + i*m_kk;
+        doublereal* mui = mu + i*m_kk;
+        // _updateThermo() re-evaluates the thermo polynomials only when the
+        // temperature differs from the previous state
+        setTemperature(T[i]);
+        _updateThermo();
+        double sum = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            sum += th[k];
+        }
+        if (sum <= 0.0) {
+            throw CanteraError("SurfPhase::getChemPotentialsBatch",
+                "Sum of coverage fractions for state {} is zero or negative",
+                i);
+        }
+        double rt = GasConstant * T[i];
+        for (size_t k = 0; k < m_kk; k++) {
+            double conc = m_n0*th[k]/(sum*size(k));
+            mui[k] = m_mu0[k] + rt * (log(conc) - logStandardConc(k));
+        }
+    }
+    setTemperature(T_save);
+}
+
 void SurfPhase::getActivityConcentrations(doublereal* c) const
 {
     getConcentrations(c);
@@ -266,10 +296,19 @@ void SurfPhase::setCoverages(const doublereal* theta)
 
 void SurfPhase::setCoveragesNoNorm(const doublereal* theta)
 {
+    // Skip the update entirely if the coverages match the ones applied by
+    // the previous call and nothing else has touched the state since, so
+    // that caches downstream of the phase stay valid
+    if (m_covEpoch == stateEpoch() && m_covLast.size() == m_kk
+        && std::equal(theta, theta + m_kk, m_covLast.begin())) {
+        return;
+    }
     for (size_t k = 0; k < m_kk; k++) {
         m_work[k] = m_n0*theta[k]/size(k);
     }
     setConcentrationsNoNorm(m_work.data());
+    m_covLast.assign(theta, theta + m_kk);
+    m_covEpoch = stateEpoch();
 }
 
 void SurfPhase::getCoverages(doublereal* theta) const
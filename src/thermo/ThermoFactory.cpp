@@ -131,11 +131,41 @@ ThermoPhase* newPhase(const std::string& infile, std::string id)
     }
 
     if (extension == "yml" || extension == "yaml") {
-        AnyMap root = AnyMap::fromYamlFile(infile);
-        AnyMap& phase = root["phases"].getMapWhere("name", id);
+        // Prototype registry: the first construction of each phase is cached,
+        // and later requests for the same phase are served by cloning the
+        // cached prototype, which shares the immutable species data instead of
+        // re-importing it. The key holds the document pointer returned by
+        // fromYamlFileShared(), which changes when the file on disk changes,
+        // so stale prototypes are never returned.
+        static std::mutex protoMutex;
+        static std::map<std::pair<const AnyMap*, std::string>,
+                        std::pair<shared_ptr<const AnyMap>,
+                                  shared_ptr<ThermoPhase>>> protos;
+
+        // Only the phase entry needs to be mutable; share the rest of the
+        // (potentially large) document instead of copying it.
+        auto root = AnyMap::fromYamlFileShared(infile);
+        auto key = std::make_pair(root.get(), id);
+        {
+            std::unique_lock<std::mutex> lock(protoMutex);
+            auto iter = protos.find(key);
+            if (iter != protos.end()) {
+                return iter->second.second->clone().release();
+            }
+        }
+        AnyMap phase = root->at("phases").getMapWhere("name", id);
         unique_ptr<ThermoPhase> t(newThermoPhase(phase["thermo"].asString()));
-        setupPhase(*t, phase, root);
-        return t.release();
+        setupPhase(*t, phase, *root);
+        try {
+            unique_ptr<ThermoPhase> copy = t->clone();
+            std::unique_lock<std::mutex> lock(protoMutex);
+            protos[key] = {root, shared_ptr<ThermoPhase>(t.release())};
+            return copy.release();
+        } catch (CanteraError&) {
+            // Phase models that cannot be cloned keep the previous behavior
+            // of re-importing on every call
+            return t.release();
+        }
     } else {
         XML_Node* root = get_XML_File(infile);
         XML_Node* xphase = get_XML_NameID("phase", "#"+id, root);
@@ -425,12 +455,14 @@ void addElements(ThermoPhase& thermo, const vector<string>& element_names,
 
 void addSpecies(ThermoPhase& thermo, const AnyValue& names, const AnyValue& species)
 {
+    std::vector<shared_ptr<Species>> specs;
     if (names.is<vector<string>>()) {
         // 'names' is a list of species names which should be found in 'species'
         const auto& species_nodes = species.asMap("name");
+        specs.reserve(names.asVector<string>().size());
         for (const auto& name : names.asVector<string>()) {
             if (species_nodes.count(name)) {
-                thermo.addSpecies(newSpecies(*species_nodes.at(name)));
+                specs.push_back(newSpecies(*species_nodes.at(name)));
             } else {
                 throw InputFileError("addSpecies", names, species,
                     "Could not find a species named '{}'.", name);
@@ -438,13 +470,15 @@ void addSpecies(ThermoPhase& thermo, const AnyValue& names, const AnyValue& spec
         }
     } else if (names == "all") {
         // The keyword 'all' means to add all species from this source
+        specs.reserve(species.asVector<AnyMap>().size());
         for (const auto& item : species.asVector<AnyMap>()) {
-            thermo.addSpecies(newSpecies(item));
+            specs.push_back(newSpecies(item));
         }
     } else {
         throw InputFileError("addSpecies", names,
             "Could not parse species declaration of type '{}'", names.type_str());
     }
+    thermo.addSpeciesBulk(specs);
 }
 
 void setupPhase(ThermoPhase& thermo, AnyMap& phaseNode, const AnyMap& rootNode)
@@ -488,9 +522,9 @@ void setupPhase(ThermoPhase& thermo, AnyMap& phaseNode, const AnyMap& rootNode)
                 if (slash) {
                     std::string fileName(source.begin(), slash.begin());
                     std::string node(slash.end(), source.end());
-                    const AnyMap elements = AnyMap::fromYamlFile(fileName,
+                    auto elements = AnyMap::fromYamlFileShared(fileName,
                         rootNode.getString("__file__", ""));
-                    addElements(thermo, names, elements.at(node), false);
+                    addElements(thermo, names, elements->at(node), false);
                 } else if (rootNode.hasKey(source)) {
                     addElements(thermo, names, rootNode.at(source), false);
                 } else if (source == "default") {
@@ -533,9 +567,9 @@ void setupPhase(ThermoPhase& thermo, AnyMap& phaseNode, const AnyMap& rootNode)
                     // source is a different input file
                     std::string fileName(source.begin(), slash.begin());
                     std::string node(slash.end(), source.end());
-                    AnyMap species = AnyMap::fromYamlFile(fileName,
+                    auto species = AnyMap::fromYamlFileShared(fileName,
                         rootNode.getString("__file__", ""));
-                    addSpecies(thermo, names, species[node]);
+                    addSpecies(thermo, names, species->at(node));
                 } else if (rootNode.hasKey(source)) {
                     // source is in the current file
                     addSpecies(thermo, names, rootNode[source]);
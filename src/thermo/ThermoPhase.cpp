@@ -13,6 +13,8 @@
 #include "cantera/thermo/ThermoFactory.h"
 #include "cantera/thermo/Species.h"
 #include "cantera/thermo/SpeciesThermoInterpType.h"
+#include "cantera/thermo/VPStandardStateTP.h"
+#include "cantera/thermo/PDSSFactory.h"
 #include "cantera/equil/ChemEquil.h"
 #include "cantera/equil/MultiPhase.h"
 #include "cantera/base/ctml.h"
@@ -20,6 +22,7 @@
 #include <iomanip>
 #include <fstream>
 #include <numeric>
+#include <mutex>
 
 using namespace std;
 
@@ -1077,9 +1080,9 @@ void ThermoPhase::initThermoFile(const std::string& inputFile,
     }
 
     if (extension == "yml" || extension == "yaml") {
-        AnyMap root = AnyMap::fromYamlFile(inputFile);
-        auto& phase = root["phases"].getMapWhere("name", id);
-        setupPhase(*this, phase, root);
+        auto root = AnyMap::fromYamlFileShared(inputFile);
+        AnyMap phase = root->at("phases").getMapWhere("name", id);
+        setupPhase(*this, phase, *root);
     } else {
         XML_Node* fxml = get_XML_File(inputFile);
         XML_Node* fxml_phase = findXMLPhase(fxml, id);
@@ -1108,6 +1111,57 @@ void ThermoPhase::initThermo()
     }
 }
 
+std::unique_ptr<ThermoPhase> ThermoPhase::clone() const
+{
+    std::unique_ptr<ThermoPhase> fresh(newThermoPhase(type()));
+    fresh->setName(name());
+    for (size_t m = 0; m < nElements(); m++) {
+        fresh->addElement(elementName(m), atomicWeight(m), atomicNumber(m),
+                          entropyElement298(m), elementType(m));
+    }
+    // The Species objects and their thermo parameterizations are not
+    // modified after installation, so the clone shares them instead of
+    // re-parsing the species definitions
+    for (size_t k = 0; k < nSpecies(); k++) {
+        fresh->addSpecies(species(k));
+    }
+    auto* vpssFresh = dynamic_cast<VPStandardStateTP*>(fresh.get());
+    if (vpssFresh) {
+        // standard-state models are selected from the (shared) species input
+        // data, as in setupPhase()
+        for (size_t k = 0; k < nSpecies(); k++) {
+            std::unique_ptr<PDSS> pdss;
+            if (species(k)->input.hasKey("equation-of-state")) {
+                auto& eos = species(k)->input["equation-of-state"];
+                for (auto& node : eos.asVector<AnyMap>()) {
+                    string model = node["model"].asString();
+                    if (PDSSFactory::factory()->exists(model)) {
+                        pdss.reset(newPDSS(model));
+                        pdss->setParameters(node);
+                        break;
+                    }
+                }
+            } else {
+                pdss.reset(newPDSS("ideal-gas"));
+            }
+            if (!pdss) {
+                throw CanteraError("ThermoPhase::clone",
+                    "Could not find an equation-of-state specification for "
+                    "species '{}' which defines a known PDSS model.",
+                    speciesName(k));
+            }
+            vpssFresh->installPDSS(k, std::move(pdss));
+        }
+    }
+    // replay any model-specific configuration held in the input data
+    fresh->m_input = m_input;
+    fresh->initThermo();
+    vector_fp state(stateSize());
+    saveState(state.size(), state.data());
+    fresh->restoreState(state);
+    return fresh;
+}
+
 void ThermoPhase::setState_TPQ(double T, double P, double Q)
 {
     if (T > critTemperature()) {
@@ -1151,6 +1205,18 @@ bool ThermoPhase::addSpecies(shared_ptr<Species> spec)
     return added;
 }
 
+size_t ThermoPhase::addSpeciesBulk(const std::vector<shared_ptr<Species>>& species)
+{
+    // fail before any species is installed rather than partway through
+    for (const auto& spec : species) {
+        if (!spec->thermo) {
+            throw CanteraError("ThermoPhase::addSpeciesBulk",
+                "Species {} has no thermo data", spec->name);
+        }
+    }
+    return Phase::addSpeciesBulk(species);
+}
+
 void ThermoPhase::modifySpecies(size_t k, shared_ptr<Species> spec)
 {
     if (!spec->thermo) {
@@ -1199,6 +1265,13 @@ AnyMap ThermoPhase::parameters(bool withInput) const
     return out;
 }
 
+AnyMap ThermoPhase::memoryReport() const
+{
+    AnyMap report = Phase::memoryReport();
+    report["type"] = type();
+    return report;
+}
+
 void ThermoPhase::getParameters(AnyMap& phaseNode) const
 {
     phaseNode["name"] = name();
@@ -1292,11 +1365,52 @@ void ThermoPhase::invalidateCache() {
     m_tlast += 0.1234;
 }
 
+namespace {
+
+//! Record of past 'auto' equilibrate outcomes for one mechanism/property
+//! pair, used to steer later solves for the same problem class.
+struct EquilOutcome
+{
+    int chemEquilSuccesses = 0;
+    int chemEquilFailures = 0;
+};
+
+//! Process-local cache of equilibrate outcomes, keyed by phase name,
+//! problem size and the held property pair. Sweep workloads that solve
+//! the same mechanism repeatedly converge onto the fastest solver that
+//! has actually proven reliable for it, instead of re-paying for failed
+//! ChemEquil attempts on every state. Guarded by a mutex so sweeps over
+//! thread-cloned phases can share the record.
+std::mutex equilOutcomeMutex;
+std::map<std::string, EquilOutcome> equilOutcomes;
+
+}
+
 void ThermoPhase::equilibrate(const std::string& XY, const std::string& solver,
                               double rtol, int max_steps, int max_iter,
                               int estimate_equil, int log_level)
 {
-    if (solver == "auto" || solver == "element_potential") {
+    std::string outcomeKey;
+    bool tryChemEquil = (solver == "auto" || solver == "element_potential");
+    if (tryChemEquil) {
+        outcomeKey = name() + "/" + XY + "/" + std::to_string(nSpecies())
+                     + "/" + std::to_string(nElements());
+    }
+    if (solver == "auto") {
+        std::lock_guard<std::mutex> lock(equilOutcomeMutex);
+        auto iter = equilOutcomes.find(outcomeKey);
+        if (iter != equilOutcomes.end()
+                && iter->second.chemEquilFailures
+                   > iter->second.chemEquilSuccesses) {
+            // ChemEquil has mostly failed for this problem; go straight to
+            // the Gibbs minimization solver rather than paying for another
+            // doomed attempt. A later success (from the element_potential
+            // path) re-enables it.
+            tryChemEquil = false;
+        }
+    }
+
+    if (tryChemEquil) {
         vector_fp initial_state;
         saveState(initial_state);
         debuglog("Trying ChemEquil solver\n", log_level);
@@ -1310,13 +1424,20 @@ void ThermoPhase::equilibrate(const std::string& XY, const std::string& solver,
                     "ChemEquil solver failed. Return code: {}", ret);
             }
             debuglog("ChemEquil solver succeeded\n", log_level);
+            {
+                std::lock_guard<std::mutex> lock(equilOutcomeMutex);
+                equilOutcomes[outcomeKey].chemEquilSuccesses++;
+            }
             return;
         } catch (std::exception& err) {
             debuglog("ChemEquil solver failed.\n", log_level);
             debuglog(err.what(), log_level);
             restoreState(initial_state);
-            if (solver == "auto") {
-            } else {
+            {
+                std::lock_guard<std::mutex> lock(equilOutcomeMutex);
+                equilOutcomes[outcomeKey].chemEquilFailures++;
+            }
+            if (solver != "auto") {
                 throw;
             }
         }
@@ -294,11 +294,29 @@ void VPStandardStateTP::_updateStandardStateThermo() const
     m_tlast = Tnow;
 }
 
+void VPStandardStateTP::_updateStandardStatePressure() const
+{
+    for (size_t k = 0; k < m_kk; k++) {
+        PDSS* kPDSS = m_PDSS_storage[k].get();
+        kPDSS->setPressure(m_Pcurrent);
+        m_hss_RT[k] = kPDSS->enthalpy_RT();
+        m_sss_R[k] = kPDSS->entropy_R();
+        m_gss_RT[k] = m_hss_RT[k] - m_sss_R[k];
+        m_cpss_R[k] = kPDSS->cp_R();
+        m_Vss[k] = kPDSS->molarVolume();
+    }
+    m_Plast_ss = m_Pcurrent;
+}
+
 void VPStandardStateTP::updateStandardStateThermo() const
 {
     double Tnow = temperature();
-    if (Tnow != m_Tlast_ss || Tnow != m_tlast || m_Pcurrent != m_Plast_ss) {
+    if (Tnow != m_Tlast_ss || Tnow != m_tlast) {
         _updateStandardStateThermo();
+    } else if (m_Pcurrent != m_Plast_ss) {
+        // Isothermal pressure change: the reference-state properties are
+        // still valid, so skip the species thermo polynomial evaluation
+        _updateStandardStatePressure();
     }
 }
 
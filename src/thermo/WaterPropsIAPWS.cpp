@@ -36,6 +36,12 @@ static const doublereal Rgas = 8.314371E3; // Joules kmol-1 K-1
 
 // Base constructor
 WaterPropsIAPWS::WaterPropsIAPWS() :
+    m_nTab_T(0),
+    m_nTab_P(0),
+    m_tabTmin(0.0),
+    m_tabTmax(0.0),
+    m_tabPmin(0.0),
+    m_tabPmax(0.0),
     tau(-1.0),
     delta(-1.0),
     iState(-30000)
@@ -85,6 +91,11 @@ doublereal WaterPropsIAPWS::density(doublereal temperature, doublereal pressure,
         return Rho_c;
     }
     doublereal deltaGuess = 0.0;
+    if (rhoguess == -1.0 && (phase == WATER_LIQUID || phase == WATER_SUPERCRIT)) {
+        // Within the window covered by setupDensityTable(), start from the
+        // interpolated density; dfind() then converges almost immediately.
+        rhoguess = tableDensityGuess(temperature, pressure);
+    }
     if (rhoguess == -1.0) {
         if (phase != -1) {
             if (temperature > T_c) {
@@ -141,6 +152,9 @@ doublereal WaterPropsIAPWS::density_const(doublereal pressure,
     doublereal temperature = T_c / tau;
     doublereal deltaGuess = 0.0;
     doublereal deltaSave = delta;
+    if (rhoguess == -1.0 && (phase == WATER_LIQUID || phase == WATER_SUPERCRIT)) {
+        rhoguess = tableDensityGuess(temperature, pressure);
+    }
     if (rhoguess == -1.0) {
         if (phase != -1) {
             if (temperature > T_c) {
@@ -189,6 +203,93 @@ doublereal WaterPropsIAPWS::density_const(doublereal pressure,
     return density_retn;
 }
 
+//! Catmull-Rom cubic through four equally spaced points, evaluated at
+//! x in [0,1] between p[1] and p[2]
+static doublereal interp_cubic(const doublereal p[4], doublereal x)
+{
+    return p[1] + 0.5 * x * (p[2] - p[0]
+        + x * (2.0 * p[0] - 5.0 * p[1] + 4.0 * p[2] - p[3]
+        + x * (3.0 * (p[1] - p[2]) + p[3] - p[0])));
+}
+
+void WaterPropsIAPWS::setupDensityTable(doublereal Tmin, doublereal Tmax,
+                                        doublereal Pmin, doublereal Pmax,
+                                        size_t nT, size_t nP)
+{
+    if (nT < 4 || nP < 4 || Tmin <= 0.0 || Tmax <= Tmin
+        || Pmin <= 0.0 || Pmax <= Pmin) {
+        throw CanteraError("WaterPropsIAPWS::setupDensityTable",
+                           "invalid table specification");
+    }
+    // remember the incoming state so it can be restored after the grid fill
+    doublereal T_save = T_c / tau;
+    doublereal rho_save = delta * Rho_c;
+
+    m_nTab_T = nT;
+    m_nTab_P = nP;
+    m_tabTmin = Tmin;
+    m_tabTmax = Tmax;
+    m_tabPmin = Pmin;
+    m_tabPmax = Pmax;
+    m_rhoTable.assign(nT * nP, -1.0);
+    for (size_t i = 0; i < nT; i++) {
+        doublereal T = Tmin + (Tmax - Tmin) * i / (nT - 1);
+        int phase = (T > T_c) ? WATER_SUPERCRIT : WATER_LIQUID;
+        for (size_t j = 0; j < nP; j++) {
+            doublereal p = Pmin + (Pmax - Pmin) * j / (nP - 1);
+            // Entries where the solve fails stay at -1.0 and are rejected
+            // by tableDensityGuess()
+            m_rhoTable[i * nP + j] = density(T, p, phase);
+        }
+    }
+    if (T_save > 0.0 && rho_save > 0.0) {
+        setState_TR(T_save, rho_save);
+    }
+}
+
+void WaterPropsIAPWS::clearDensityTable()
+{
+    m_rhoTable.clear();
+    m_nTab_T = 0;
+    m_nTab_P = 0;
+}
+
+doublereal WaterPropsIAPWS::tableDensityGuess(doublereal temperature,
+                                              doublereal pressure) const
+{
+    if (m_rhoTable.empty() || temperature < m_tabTmin || temperature > m_tabTmax
+        || pressure < m_tabPmin || pressure > m_tabPmax) {
+        return -1.0;
+    }
+    doublereal ft = (temperature - m_tabTmin) / (m_tabTmax - m_tabTmin)
+                    * (m_nTab_T - 1);
+    doublereal fp = (pressure - m_tabPmin) / (m_tabPmax - m_tabPmin)
+                    * (m_nTab_P - 1);
+    size_t i = std::min((size_t) ft, m_nTab_T - 2);
+    size_t j = std::min((size_t) fp, m_nTab_P - 2);
+    doublereal xt = ft - i;
+    doublereal xp = fp - j;
+
+    // interpolate the 4x4 stencil around the cell, clamping at the edges
+    doublereal rows[4];
+    for (long di = -1; di <= 2; di++) {
+        long ii = std::min(std::max((long) i + di, (long) 0),
+                           (long) m_nTab_T - 1);
+        doublereal vals[4];
+        for (long dj = -1; dj <= 2; dj++) {
+            long jj = std::min(std::max((long) j + dj, (long) 0),
+                               (long) m_nTab_P - 1);
+            doublereal v = m_rhoTable[ii * m_nTab_P + jj];
+            if (v <= 0.0) {
+                return -1.0;
+            }
+            vals[dj + 1] = v;
+        }
+        rows[di + 1] = interp_cubic(vals, xp);
+    }
+    return interp_cubic(rows, xt);
+}
+
 doublereal WaterPropsIAPWS::density() const
 {
     return delta * Rho_c;
@@ -30,6 +30,8 @@ Substance::Substance() :
     Pst(Undef),
     m_energy_offset(0.0),
     m_entropy_offset(0.0),
+    m_lastTsatP(Undef),
+    m_lastTsatT(Undef),
     kbr(0)
 {
 }
@@ -150,49 +152,10 @@ double Substance::thermalExpansionCoeff()
         return std::numeric_limits<double>::infinity();
     }
 
-    double Tsave = T, dt = 1.e-4 * T;
-    double RhoSave = Rho;
-    double T1, T2, v1, v2;
-    double p0 = P();
-
-    if (Rho >= Rhf) {
-        // initial state is pure liquid
-        T1 = std::max(Tmin(), Tsave - dt);
-        Set(PropertyPair::TP, T1, p0);
-        v1 = v();
-        try {
-            T2 = std::min(Tsat(p0), Tsave + dt);
-        } catch (CanteraError&) {
-            // Tsat does not exist beyond two-phase region
-            T2 = Tsave + dt;
-        }
-        if (T2 < Tsave + dt) {
-            Set(PropertyPair::TX, T2, 0.);
-        } else {
-            Set(PropertyPair::TP, T2, p0);
-        }
-        v2 = v();
-    } else {
-        // initial state is pure vapor
-        try {
-            T1 = std::max(Tsat(p0), Tsave - dt);
-        } catch (CanteraError&) {
-            // Tsat does not exist beyond two-phase region
-            T1 = Tsave - dt;
-        }
-        if (T1 > Tsave - dt) {
-            Set(PropertyPair::TX, T1, 1.);
-        } else {
-            Set(PropertyPair::TP, T1, p0);
-        }
-        v1 = v();
-        T2 = std::min(Tmax(), Tsave + dt);
-        Set(PropertyPair::TP, T2, p0);
-        v2 = v();
-    }
-
-    Set(PropertyPair::TV, Tsave, 1.0 / RhoSave);
-    return 2.0 * (v2 - v1) / ((v2 + v1) * (T2 - T1));
+    // (1/v)(dv/dT) at constant P, expressed through the partial derivatives
+    // of the equation of state; this stays on the current single-phase
+    // branch and requires no nonlinear re-solves
+    return dPdT() / (Rho * dPdrho());
 }
 
 double Substance::isothermalCompressibility()
@@ -202,45 +165,32 @@ double Substance::isothermalCompressibility()
         return std::numeric_limits<double>::infinity();
     }
 
-    double Psave = P(), dp = 1.e-4 * Psave;
-    double RhoSave = Rho;
-    double P1, P2, v1, v2;
-    double v0 = v();
+    // -(1/v)(dv/dP) at constant T; see thermalExpansionCoeff()
+    return 1.0 / (Rho * dPdrho());
+}
 
-    if (Rho >= Rhf) {
-        // initial state is pure liquid
-        P1 = Psave - dp;
-        if (T > Tmin() && T <= Tcrit()) {
-            P1 = std::max(Ps(), P1);
-        }
-        if (P1 > Psave - dp) {
-            Set(PropertyPair::PX, P1, 0.);
-        } else {
-            Set(PropertyPair::TP, T, P1);
-        }
-        v1 = v();
-        P2 = Psave + dp;
-        Set(PropertyPair::TP, T, P2);
-        v2 = v();
-    } else {
-        // initial state is pure vapor
-        P1 = std::max(1.e-7, Psave - dp);
-        Set(PropertyPair::TP, T, P1);
-        v1 = v();
-        P2 = Psave + dp;
-        if (T > Tmin() && T <= Tcrit()) {
-            P2 = std::min(Ps(), P2);
-        }
-        if (P2 < Psave + dp) {
-            Set(PropertyPair::PX, P2, 1.);
-        } else {
-            Set(PropertyPair::TP, T, P2);
-        }
-        v2 = v();
-    }
+double Substance::dPdT()
+{
+    double Tsave = T, dt = 1.e-6 * T;
+    double T1 = std::max(Tmin(), Tsave - dt);
+    double T2 = std::min(Tmax(), Tsave + dt);
+    T = T1;
+    double P1 = Pp();
+    T = T2;
+    double P2 = Pp();
+    T = Tsave;
+    return (P2 - P1) / (T2 - T1);
+}
 
-    Set(PropertyPair::TV, T, 1.0 / RhoSave);
-    return -(v2 - v1) / (v0 * (P2 - P1));
+double Substance::dPdrho()
+{
+    double RhoSave = Rho, drho = 1.e-6 * Rho;
+    Rho = RhoSave - drho;
+    double P1 = Pp();
+    Rho = RhoSave + drho;
+    double P2 = Pp();
+    Rho = RhoSave;
+    return (P2 - P1) / (2.0 * drho);
 }
 
 double Substance::dPsdT()
@@ -308,6 +258,11 @@ double Substance::Tsat(double p)
 
     int LoopCount = 0;
     double tol = 1.e-6*p;
+    if (m_lastTsatT != Undef && fabs(p - m_lastTsatP) < 0.25*m_lastTsatP) {
+        // warm start from the last converged saturation point; for
+        // sequential nearby pressures this converges in 1-2 iterations
+        T = m_lastTsatT;
+    }
     if (T < Tmin() || T > Tcrit()) {
         T = 0.5*(Tcrit() - Tmin());
     }
@@ -330,6 +285,8 @@ double Substance::Tsat(double p)
         }
     }
     double tsat = T;
+    m_lastTsatP = p;
+    m_lastTsatT = tsat;
     T = Tsave;
     return tsat;
 }
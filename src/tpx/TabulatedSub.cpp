@@ -0,0 +1,248 @@
+//! @file TabulatedSub.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "TabulatedSub.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <cmath>
+
+namespace tpx
+{
+
+TabulatedSubstance::TabulatedSubstance(Substance* sub, size_t np) :
+    m_exact(sub),
+    m_np(np),
+    m_nr(4 * np)
+{
+    if (np < 4) {
+        throw Cantera::CanteraError("TabulatedSubstance::TabulatedSubstance",
+                                    "at least 4 grid nodes are required");
+    }
+    m_name = m_exact->m_name;
+    m_formula = m_exact->m_formula;
+    buildTables();
+}
+
+void TabulatedSubstance::buildTables()
+{
+    double tmin = m_exact->Tmin();
+    double tmax = m_exact->Tmax();
+    m_T0 = tmin;
+    m_dT = (tmax - tmin) / (m_np - 1);
+
+    // density grid, logarithmic between a dilute-gas lower bound and the
+    // saturated liquid density at the lowest temperature
+    m_exact->T = tmin;
+    double rhoMax = 1.05 * m_exact->ldens();
+    double rhoMin = 1e-6 * rhoMax;
+    m_lr0 = std::log(rhoMin);
+    m_dlr = (std::log(rhoMax) - m_lr0) / (m_nr - 1);
+
+    m_tabP.resize(m_np * m_nr);
+    m_tabU.resize(m_np * m_nr);
+    m_tabS.resize(m_np * m_nr);
+
+    double ht = 0.1 * m_dT;
+    for (size_t i = 0; i < m_np; i++) {
+        double t = m_T0 + i * m_dT;
+        for (size_t j = 0; j < m_nr; j++) {
+            double rho = std::exp(m_lr0 + j * m_dlr);
+            double hr = 0.1 * rho * m_dlr;
+
+            // sample the exact surfaces on a 3x3 stencil about the node
+            double P[3][3], u[3][3], s[3][3];
+            for (int a = -1; a < 2; a++) {
+                for (int b = -1; b < 2; b++) {
+                    m_exact->T = t + a * ht;
+                    m_exact->Rho = rho + b * hr;
+                    P[a+1][b+1] = m_exact->Pp();
+                    u[a+1][b+1] = m_exact->up();
+                    s[a+1][b+1] = m_exact->sp();
+                }
+            }
+            const double (*surf[3])[3] = {P, u, s};
+            std::vector<Node>* tabs[3] = {&m_tabP, &m_tabU, &m_tabS};
+            for (int q = 0; q < 3; q++) {
+                const double (*f)[3] = surf[q];
+                Node& node = (*tabs[q])[i * m_nr + j];
+                node.f = f[1][1];
+                node.fT = (f[2][1] - f[0][1]) / (2 * ht);
+                node.fr = (f[1][2] - f[1][0]) / (2 * hr);
+                node.fTT = (f[2][1] - 2 * f[1][1] + f[0][1]) / (ht * ht);
+                node.frr = (f[1][2] - 2 * f[1][1] + f[1][0]) / (hr * hr);
+                node.fTr = (f[2][2] - f[2][0] - f[0][2] + f[0][0])
+                           / (4 * ht * hr);
+            }
+        }
+    }
+
+    // saturation-line tables, stopping short of the critical point where the
+    // derivatives of the saturation properties diverge. The grid is inset by
+    // the stencil width so the sampling never leaves [Tmin, Tcrit].
+    double hs = 1e-4 * tmin;
+    m_Ts0 = tmin + hs;
+    m_TsMax = 0.995 * m_exact->Tcrit();
+    m_dTs = (m_TsMax - m_Ts0) / (m_np - 1);
+    m_satLogP.resize(m_np);
+    m_satRhof.resize(m_np);
+    m_satRhov.resize(m_np);
+    for (size_t i = 0; i < m_np; i++) {
+        double t = m_Ts0 + i * m_dTs;
+        double lp[3], rf[3], rv[3];
+        for (int a = -1; a < 2; a++) {
+            // solve the exact liquid/vapor equilibrium once per stencil
+            // point; at run time the converged values are interpolated
+            m_exact->T = t + a * hs;
+            m_exact->Tslast = Undef;
+            m_exact->update_sat();
+            lp[a+1] = std::log(m_exact->Pst);
+            rf[a+1] = m_exact->Rhf;
+            rv[a+1] = m_exact->Rhv;
+        }
+        const double* vals[3] = {lp, rf, rv};
+        std::vector<Node>* tabs[3] = {&m_satLogP, &m_satRhof, &m_satRhov};
+        for (int q = 0; q < 3; q++) {
+            const double* f = vals[q];
+            Node& n = (*tabs[q])[i];
+            n.f = f[1];
+            n.fT = (f[2] - f[0]) / (2 * hs);
+            n.fTT = (f[2] - 2 * f[1] + f[0]) / (hs * hs);
+            n.fr = n.frr = n.fTr = 0.0;
+        }
+    }
+    m_exact->T = Undef;
+    m_exact->Rho = Undef;
+    m_exact->Tslast = Undef;
+}
+
+bool TabulatedSubstance::eval2D(const std::vector<Node>& tab, double t,
+                                double rho, double& value) const
+{
+    if (!(t >= m_T0 && t <= m_T0 + (m_np - 1) * m_dT) || !(rho > 0.0)) {
+        return false;
+    }
+    double lr = std::log(rho);
+    if (lr < m_lr0 || lr > m_lr0 + (m_nr - 1) * m_dlr) {
+        return false;
+    }
+    // blend the Taylor expansions about the four corners of the enclosing
+    // cell with bilinear weights; the blend is continuous across cell
+    // boundaries and considerably more accurate than a single expansion
+    size_t i = std::min(static_cast<size_t>((t - m_T0) / m_dT), m_np - 2);
+    size_t j = std::min(static_cast<size_t>((lr - m_lr0) / m_dlr), m_nr - 2);
+    double wt = (t - (m_T0 + i * m_dT)) / m_dT;
+    double wr = (lr - (m_lr0 + j * m_dlr)) / m_dlr;
+    value = 0.0;
+    for (int a = 0; a < 2; a++) {
+        for (int b = 0; b < 2; b++) {
+            double w = (a ? wt : 1.0 - wt) * (b ? wr : 1.0 - wr);
+            if (w == 0.0) {
+                continue;
+            }
+            const Node& n = tab[(i + a) * m_nr + (j + b)];
+            double dt = t - (m_T0 + (i + a) * m_dT);
+            double dr = rho - std::exp(m_lr0 + (j + b) * m_dlr);
+            value += w * (n.f + n.fT * dt + n.fr * dr + 0.5 * n.fTT * dt * dt
+                          + 0.5 * n.frr * dr * dr + n.fTr * dt * dr);
+        }
+    }
+    return true;
+}
+
+bool TabulatedSubstance::evalSat(const std::vector<Node>& tab, double t,
+                                 double& value) const
+{
+    if (!(t >= m_Ts0 && t <= m_TsMax)) {
+        return false;
+    }
+    size_t i = std::min(static_cast<size_t>((t - m_Ts0) / m_dTs), m_np - 2);
+    double wt = (t - (m_Ts0 + i * m_dTs)) / m_dTs;
+    value = 0.0;
+    for (int a = 0; a < 2; a++) {
+        double w = a ? wt : 1.0 - wt;
+        if (w == 0.0) {
+            continue;
+        }
+        const Node& n = tab[i + a];
+        double dt = t - (m_Ts0 + (i + a) * m_dTs);
+        value += w * (n.f + n.fT * dt + 0.5 * n.fTT * dt * dt);
+    }
+    return true;
+}
+
+void TabulatedSubstance::syncExact()
+{
+    m_exact->T = T;
+    m_exact->Rho = Rho;
+}
+
+double TabulatedSubstance::Pp()
+{
+    double value;
+    if (eval2D(m_tabP, T, Rho, value)) {
+        return value;
+    }
+    syncExact();
+    return m_exact->Pp();
+}
+
+double TabulatedSubstance::up()
+{
+    double value;
+    if (eval2D(m_tabU, T, Rho, value)) {
+        return value + m_energy_offset;
+    }
+    syncExact();
+    return m_exact->up() + m_energy_offset;
+}
+
+double TabulatedSubstance::sp()
+{
+    double value;
+    if (eval2D(m_tabS, T, Rho, value)) {
+        return value + m_entropy_offset;
+    }
+    syncExact();
+    return m_exact->sp() + m_entropy_offset;
+}
+
+double TabulatedSubstance::Psat()
+{
+    double value;
+    if (evalSat(m_satLogP, T, value)) {
+        return std::exp(value);
+    }
+    syncExact();
+    return m_exact->Psat();
+}
+
+double TabulatedSubstance::ldens()
+{
+    double value;
+    if (evalSat(m_satRhof, T, value)) {
+        return value;
+    }
+    syncExact();
+    return m_exact->ldens();
+}
+
+void TabulatedSubstance::update_sat()
+{
+    if (T == Tslast) {
+        return;
+    }
+    double lp, rf, rv;
+    if (evalSat(m_satLogP, T, lp) && evalSat(m_satRhof, T, rf)
+        && evalSat(m_satRhov, T, rv)) {
+        Pst = std::exp(lp);
+        Rhf = rf;
+        Rhv = rv;
+        Tslast = T;
+    } else {
+        Substance::update_sat();
+    }
+}
+
+}
@@ -0,0 +1,104 @@
+//! @file TabulatedSub.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef TPX_TABULATEDSUB_H
+#define TPX_TABULATEDSUB_H
+
+#include "cantera/tpx/Sub.h"
+#include <memory>
+#include <vector>
+
+namespace tpx
+{
+
+//! Tabulated wrapper around an exact Substance.
+/*!
+ * The wrapped equation of state is sampled once on a rectangular (T, rho)
+ * grid, storing the value and first and second derivatives of the pressure,
+ * internal energy, and entropy surfaces at every node; subsequent property
+ * evaluations are second-order Taylor expansions about the nearest node
+ * (the "TTSE" scheme). The saturation pressure and saturated liquid density
+ * are tabulated the same way on a one-dimensional temperature grid, so the
+ * nonlinear saturation and density solves in the Substance base class
+ * iterate on table lookups instead of full equation-of-state evaluations.
+ * States outside the tabulated window (including the immediate neighborhood
+ * of the critical point) fall back to the exact substance.
+ */
+class TabulatedSubstance : public Substance
+{
+public:
+    //! Construct the tables for *sub*, taking ownership of it.
+    //! @param sub  exact substance to be wrapped. Any standard-state offsets
+    //!     already applied to it are baked into the tables.
+    //! @param np  number of grid nodes per dimension
+    explicit TabulatedSubstance(Substance* sub, size_t np = 120);
+
+    double MolWt() {
+        return m_exact->MolWt();
+    }
+    double Tcrit() {
+        return m_exact->Tcrit();
+    }
+    double Pcrit() {
+        return m_exact->Pcrit();
+    }
+    double Vcrit() {
+        return m_exact->Vcrit();
+    }
+    double Tmin() {
+        return m_exact->Tmin();
+    }
+    double Tmax() {
+        return m_exact->Tmax();
+    }
+
+    double Pp();
+
+protected:
+    double ldens();
+    double Psat();
+    double up();
+    double sp();
+
+    //! Read the saturation state from the tables instead of iterating the
+    //! liquid/vapor Gibbs function equality on every temperature change
+    void update_sat();
+
+private:
+    //! Per-node Taylor coefficients for one property surface
+    struct Node {
+        double f, fT, fr, fTT, frr, fTr;
+    };
+
+    //! Sample the exact substance and fill the 2-D and saturation tables
+    void buildTables();
+
+    //! Second-order Taylor evaluation about the node nearest to (t, rho);
+    //! returns false if (t, rho) is outside the tabulated window
+    bool eval2D(const std::vector<Node>& tab, double t, double rho,
+                double& value) const;
+
+    //! Evaluate a saturation-line table at temperature *t*
+    bool evalSat(const std::vector<Node>& tab, double t, double& value) const;
+
+    //! Point the exact substance at the current (T, Rho) before a fallback
+    void syncExact();
+
+    std::unique_ptr<Substance> m_exact;
+
+    size_t m_np; //!< temperature nodes
+    size_t m_nr; //!< density nodes; finer than m_np because the liquid
+                 //!< branch is much stiffer in density than in temperature
+    double m_T0, m_dT; //!< temperature grid origin and spacing
+    double m_lr0, m_dlr; //!< log(rho) grid origin and spacing
+    double m_Ts0, m_dTs, m_TsMax; //!< saturation-line grid
+
+    std::vector<Node> m_tabP, m_tabU, m_tabS;
+    std::vector<Node> m_satLogP, m_satRhof, m_satRhov;
+};
+
+}
+
+#endif
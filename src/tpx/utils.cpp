@@ -13,6 +13,7 @@
 #include "Methane.h"
 #include "Nitrogen.h"
 #include "Oxygen.h"
+#include "TabulatedSub.h"
 #include "Water.h"
 
 namespace tpx
@@ -66,4 +67,9 @@ Substance* GetSub(int isub)
     }
 }
 
+Substance* newTabulatedSubstance(Substance* sub, size_t np)
+{
+    return new TabulatedSubstance(sub, np);
+}
+
 }
@@ -172,6 +172,80 @@ void DustyGasTransport::getMolarFluxes(const doublereal* const state1,
     scale(fluxes, fluxes + m_nsp, fluxes, -1.0);
 }
 
+void DustyGasTransport::getMolarFluxesBatch(size_t nFaces,
+        const doublereal* const states1, const doublereal* const states2,
+        const doublereal* const deltas, doublereal* const fluxes,
+        doublereal rtol)
+{
+    doublereal* const cbar = m_spwork.data();
+    doublereal* const gradc = m_spwork2.data();
+    const size_t ldstate = m_nsp + 2;
+
+    // The permeability is independent of the face states; if none has been
+    // specified, use the result for close-packed spheres
+    doublereal kappa = m_perm;
+    if (kappa < 0.0) {
+        double p = m_porosity;
+        kappa = p*p*p*m_diam*m_diam/(72.0*m_tortuosity*(1.0-p)*(1.0-p));
+    }
+
+    // mean state of the last face for which the H matrix was inverted
+    doublereal tlast = -1.0, plast = -1.0, visc = 0.0;
+    vector_fp xbar(m_nsp);
+    vector_fp xlast(m_nsp, -1.0);
+
+    for (size_t n = 0; n < nFaces; n++) {
+        const doublereal* const state1 = states1 + n*ldstate;
+        const doublereal* const state2 = states2 + n*ldstate;
+        doublereal* const flux = fluxes + n*m_nsp;
+
+        const doublereal* const y1 = state1 + 2;
+        const doublereal* const y2 = state2 + 2;
+        doublereal c1sum = 0.0, c2sum = 0.0, cbarsum = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            double conc1 = state1[1] * y1[k] / m_mw[k];
+            double conc2 = state2[1] * y2[k] / m_mw[k];
+            cbar[k] = 0.5*(conc1 + conc2);
+            gradc[k] = (conc2 - conc1) / deltas[n];
+            c1sum += conc1;
+            c2sum += conc2;
+            cbarsum += cbar[k];
+        }
+        doublereal p1 = c1sum * GasConstant * state1[0];
+        doublereal p2 = c2sum * GasConstant * state2[0];
+        doublereal pbar = 0.5*(p1 + p2);
+        doublereal gradp = (p2 - p1)/deltas[n];
+        doublereal tbar = 0.5*(state1[0] + state2[0]);
+        for (size_t k = 0; k < m_nsp; k++) {
+            xbar[k] = cbar[k] / cbarsum;
+        }
+
+        // Reuse the inverted H matrix from the previous face when the mean
+        // state agrees with it to within rtol
+        bool reuse = (tlast > 0.0 && fabs(tbar - tlast) <= rtol*tlast
+                      && fabs(pbar - plast) <= rtol*plast);
+        for (size_t k = 0; reuse && k < m_nsp; k++) {
+            reuse = (fabs(xbar[k] - xlast[k]) <= rtol);
+        }
+        if (!reuse) {
+            m_thermo->setState_TPX(tbar, pbar, cbar);
+            updateMultiDiffCoeffs();
+            visc = m_gastran->viscosity();
+            tlast = tbar;
+            plast = pbar;
+            xlast = xbar;
+        }
+
+        multiply(m_multidiff, gradc, flux);
+        for (size_t k = 0; k < m_nsp; k++) {
+            cbar[k] /= m_dk[k];
+        }
+        scale(cbar, cbar + m_nsp, cbar, kappa * gradp / visc);
+        increment(m_multidiff, cbar, flux);
+        scale(flux, flux + m_nsp, flux, -1.0);
+    }
+}
+
 void DustyGasTransport::updateMultiDiffCoeffs()
 {
     // see if temperature has changed
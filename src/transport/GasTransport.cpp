@@ -11,11 +11,126 @@
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/thermo/Species.h"
 #include "cantera/base/utilities.h"
+#include "cantera/base/AnyMap.h"
 #include "cantera/base/global.h"
+#include "cantera/base/ThreadPool.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
 
 namespace Cantera
 {
 
+namespace { // helpers for parallel fit generation and the on-disk fit cache
+
+//! Number of worker threads to use for generating property fits: the hardware
+//! concurrency by default, overridden by the CANTERA_TRANSPORT_FIT_THREADS
+//! environment variable, and never more than one thread per task.
+size_t fitThreadCount(size_t nTasks)
+{
+    size_t nThreads = std::thread::hardware_concurrency();
+    const char* env = getenv("CANTERA_TRANSPORT_FIT_THREADS");
+    if (env != nullptr) {
+        nThreads = std::max(atoi(env), 1);
+    }
+    return std::min(std::max<size_t>(nThreads, 1), std::max<size_t>(nTasks, 1));
+}
+
+//! Evaluate f(begin, end) over the task range [0, nTasks), split into one
+//! contiguous chunk per task on the shared thread pool. The first exception
+//! thrown by any task is rethrown on the calling thread.
+void runFitChunks(size_t nTasks, size_t nThreads,
+                  const std::function<void(size_t, size_t)>& f)
+{
+    if (nThreads < 2 || nTasks < 2) {
+        f(0, nTasks);
+        return;
+    }
+    size_t chunkSize = (nTasks + nThreads - 1) / nThreads;
+    ThreadPool::shared().run(nThreads, [&f, nTasks, chunkSize](size_t i) {
+        size_t begin = i * chunkSize;
+        size_t end = std::min(nTasks, begin + chunkSize);
+        f(begin, end);
+    });
+}
+
+//! Identifies the fit cache file format; bumped whenever the layout of the
+//! serialized data changes.
+const uint32_t FitCacheMagic = 0x43544654; // "CTFT"
+const int32_t FitCacheVersion = 1;
+
+//! Process-wide registry of property fits, keyed by
+//! GasTransport::fitInputHash(). Entries are held weakly, so the tables are
+//! freed when the last transport manager referencing them is destroyed.
+std::mutex fit_registry_mutex;
+std::map<uint64_t, std::weak_ptr<const GasTransportFits>> fit_registry;
+
+//! Fold a block of bytes into a 64-bit FNV-1a hash
+void fitHashBytes(uint64_t& h, const void* data, size_t nbytes)
+{
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < nbytes; i++) {
+        h = (h ^ p[i]) * 1099511628211ULL;
+    }
+}
+
+void fitHashDouble(uint64_t& h, double x)
+{
+    fitHashBytes(h, &x, sizeof(x));
+}
+
+void fitHashString(uint64_t& h, const std::string& s)
+{
+    fitHashBytes(h, s.data(), s.size());
+    char sep = '\0';
+    fitHashBytes(h, &sep, 1);
+}
+
+void fitCacheWriteArray(std::ostream& out, const std::vector<vector_fp>& arr)
+{
+    uint64_t nrows = arr.size();
+    out.write(reinterpret_cast<const char*>(&nrows), sizeof(nrows));
+    for (const vector_fp& row : arr) {
+        uint64_t ncols = row.size();
+        out.write(reinterpret_cast<const char*>(&ncols), sizeof(ncols));
+        out.write(reinterpret_cast<const char*>(row.data()),
+                  ncols * sizeof(double));
+    }
+}
+
+bool fitCacheReadArray(std::istream& in, std::vector<vector_fp>& arr)
+{
+    uint64_t nrows;
+    in.read(reinterpret_cast<char*>(&nrows), sizeof(nrows));
+    if (!in.good() || nrows > 1e9) {
+        return false;
+    }
+    arr.resize(static_cast<size_t>(nrows));
+    for (vector_fp& row : arr) {
+        uint64_t ncols;
+        in.read(reinterpret_cast<char*>(&ncols), sizeof(ncols));
+        if (!in.good() || ncols > 1e6) {
+            return false;
+        }
+        row.resize(static_cast<size_t>(ncols));
+        in.read(reinterpret_cast<char*>(row.data()), ncols * sizeof(double));
+        if (!in.good()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // end anonymous namespace
+
 //! polynomial degree used for fitting collision integrals
 //! except in CK mode, where the degree is 6.
 #define COLL_INT_POLY_DEGREE 8
@@ -36,6 +151,12 @@ GasTransport::GasTransport(ThermoPhase* thermo) :
     m_logt(0.0),
     m_t14(0.0),
     m_t32(0.0),
+    m_bdiff_temp(0.0),
+    m_bdiff_rtol(0.0),
+    m_shmDiffcoeffs(0),
+    m_shmNpairs(0),
+    m_shmNp(0),
+    m_mf_stateNum(std::numeric_limits<int>::min()),
     m_log_level(0)
 {
 }
@@ -104,16 +225,27 @@ void GasTransport::updateViscosity_T()
         updateSpeciesViscosities();
     }
 
-    // see Eq. (9-5.15) of Reid, Prausnitz, and Poling
+    // Per-species reciprocals, so that the pair loops below contain no
+    // square roots or divisions
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_rvisc[k] = 1.0/m_visc[k];
+        m_rsqvisc[k] = 1.0/m_sqvisc[k];
+    }
+
+    // see Eq. (9-5.15) of Reid, Prausnitz, and Poling. The loop over k runs
+    // stride-one through the columns of m_phi, m_wratjk, and the packed pair
+    // factors in m_viscwtfac, so it can be vectorized.
     for (size_t j = 0; j < m_nsp; j++) {
+        double rsqvisc_j = m_rsqvisc[j];
         for (size_t k = j; k < m_nsp; k++) {
-            double vratiokj = m_visc[k]/m_visc[j];
-            double wratiojk = m_mw[j]/m_mw[k];
-
             // Note that m_wratjk(k,j) holds the square root of m_wratjk(j,k)!
-            double factor1 = 1.0 + (m_sqvisc[k]/m_sqvisc[j]) * m_wratjk(k,j);
-            m_phi(k,j) = factor1*factor1 / (sqrt(8.0) * m_wratkj1(j,k));
-            m_phi(j,k) = m_phi(k,j)/(vratiokj * wratiojk);
+            double factor1 = 1.0 + m_sqvisc[k]*rsqvisc_j * m_wratjk(k,j);
+            m_phi(k,j) = factor1*factor1 * m_viscwtfac(k,j);
+        }
+        // phi(j,k) = phi(k,j) / ((visc[k]/visc[j]) * (mw[j]/mw[k]))
+        double visc_j = m_visc[j];
+        for (size_t k = j + 1; k < m_nsp; k++) {
+            m_phi(j,k) = m_phi(k,j) * visc_j*m_rvisc[k] * m_viscwtfac(j,k);
         }
     }
     m_viscwt_ok = true;
@@ -140,12 +272,55 @@ void GasTransport::updateSpeciesViscosities()
 void GasTransport::updateDiff_T()
 {
     update_T();
-    // evaluate binary diffusion coefficients at unit pressure
+
+    // optionally reuse the coefficients evaluated at a nearby temperature
+    // (see setBinDiffTemperatureTolerance)
+    if (m_bdiff_rtol > 0.0 && m_bdiff_temp > 0.0
+        && fabs(m_temp - m_bdiff_temp) <= m_bdiff_rtol * m_bdiff_temp) {
+        m_bindiff_ok = true;
+        return;
+    }
+
+    size_t npairs, np;
+    const double* dcoeffs;
+    if (m_shmDiffcoeffs) {
+        // fits attached from shared memory are already in the flat layout
+        npairs = m_shmNpairs;
+        np = m_shmNp;
+        dcoeffs = m_shmDiffcoeffs;
+        if (m_diffwork.size() != npairs) {
+            m_diffwork.resize(npairs);
+        }
+    } else {
+        npairs = m_diffcoeffs.size();
+        np = npairs ? m_diffcoeffs[0].size() : 0;
+        if (m_diffcoeffs_flat.size() != np * npairs) {
+            // repack the fits with one contiguous plane per polynomial degree
+            m_diffcoeffs_flat.resize(np * npairs);
+            for (size_t ic = 0; ic < npairs; ic++) {
+                for (size_t d = 0; d < np; d++) {
+                    m_diffcoeffs_flat[d*npairs + ic] = m_diffcoeffs[ic][d];
+                }
+            }
+            m_diffwork.resize(npairs);
+        }
+        dcoeffs = m_diffcoeffs_flat.data();
+    }
+
+    // Evaluate the polynomial fits for all pairs in one pass; the Horner
+    // recurrence runs stride-one through the coefficient planes.
+    double* w = m_diffwork.data();
+    if (npairs) {
+        polyevalBatch(np - 1, npairs, dcoeffs, m_logt, w);
+    }
+
+    // scatter into the symmetric matrix of binary diffusion coefficients at
+    // unit pressure
     size_t ic = 0;
     if (m_mode == CK_Mode) {
         for (size_t i = 0; i < m_nsp; i++) {
             for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = exp(dot4(m_polytempvec, m_diffcoeffs[ic]));
+                m_bdiff(i,j) = exp(w[ic]);
                 m_bdiff(j,i) = m_bdiff(i,j);
                 ic++;
             }
@@ -153,13 +328,13 @@ void GasTransport::updateDiff_T()
     } else {
         for (size_t i = 0; i < m_nsp; i++) {
             for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = m_temp * m_sqrt_t*dot5(m_polytempvec,
-                                                      m_diffcoeffs[ic]);
+                m_bdiff(i,j) = m_temp * m_sqrt_t * w[ic];
                 m_bdiff(j,i) = m_bdiff(i,j);
                 ic++;
             }
         }
     }
+    m_bdiff_temp = m_temp;
     m_bindiff_ok = true;
 }
 
@@ -281,6 +456,7 @@ void GasTransport::init(ThermoPhase* thermo, int mode, int log_level)
     m_nsp = m_thermo->nSpecies();
     m_mode = mode;
     m_log_level = log_level;
+    m_mf_stateNum = std::numeric_limits<int>::min();
 
     // set up Monchick and Mason collision integrals
     setupCollisionParameters();
@@ -305,6 +481,22 @@ void GasTransport::init(ThermoPhase* thermo, int mode, int log_level)
             m_wratkj1(j,k) = sqrt(1.0 + m_mw[k]/m_mw[j]);
         }
     }
+
+    // Pack the composition- and temperature-independent pair factors of the
+    // Wilke mixing rule so that updateViscosity_T() needs no square roots or
+    // divisions: the lower triangle holds 1/(sqrt(8)*sqrt(1 + mw[k]/mw[j])),
+    // the strict upper triangle the molecular weight ratio mw[k]/mw[j].
+    m_viscwtfac.resize(m_nsp, m_nsp, 0.0);
+    for (size_t j = 0; j < m_nsp; j++) {
+        for (size_t k = j; k < m_nsp; k++) {
+            m_viscwtfac(k,j) = 1.0 / (sqrt(8.0) * m_wratkj1(j,k));
+            if (k != j) {
+                m_viscwtfac(j,k) = m_mw[k]/m_mw[j];
+            }
+        }
+    }
+    m_rvisc.resize(m_nsp);
+    m_rsqvisc.resize(m_nsp);
 }
 
 void GasTransport::setupCollisionParameters()
@@ -390,12 +582,73 @@ void GasTransport::setupCollisionIntegral()
     integrals.init(tstar_min, tstar_max, m_log_level);
     fitCollisionIntegrals(integrals);
     debuglog("*** end of collision_integrals ***\n", m_log_level);
-    // make polynomial fits
+    // make polynomial fits, unless another transport manager in this
+    // process has already generated them, they can be attached from shared
+    // memory, or they can be loaded from a cache file generated from
+    // identical input data
     debuglog("*** property fits ***\n", m_log_level);
-    fitProperties(integrals);
+    const char* shmSeg = getenv("CANTERA_TRANSPORT_SHM");
+    if (adoptSharedFits()) {
+        debuglog("*** property fits shared with an existing transport "
+                 "manager ***\n", m_log_level);
+    } else if (shmSeg != nullptr && shmSeg[0] != '\0'
+        && SharedMemTables::exists(shmSeg)) {
+        attachFitTables(shmSeg);
+        debuglog("*** property fits attached from shared memory ***\n",
+                 m_log_level);
+    } else if (loadFitCache()) {
+        debuglog("*** property fits loaded from cache ***\n", m_log_level);
+        publishSharedFits();
+    } else {
+        fitProperties(integrals);
+        saveFitCache();
+        if (shmSeg != nullptr && shmSeg[0] != '\0') {
+            publishFitTables(shmSeg);
+        }
+        publishSharedFits();
+    }
     debuglog("*** end of property fits ***\n", m_log_level);
 }
 
+AnyMap GasTransport::memoryReport() const
+{
+    AnyMap report = Transport::memoryReport();
+
+    auto nestedBytes = [](const std::vector<vector_fp>& v) {
+        size_t n = vectorBytes(v);
+        for (const auto& inner : v) {
+            n += vectorBytes(inner);
+        }
+        return n;
+    };
+    size_t fits = nestedBytes(m_visccoeffs) + nestedBytes(m_condcoeffs)
+        + nestedBytes(m_diffcoeffs) + nestedBytes(m_omega22_poly)
+        + nestedBytes(m_astar_poly) + nestedBytes(m_bstar_poly)
+        + nestedBytes(m_cstar_poly) + vectorBytes(m_diffcoeffs_flat)
+        + vectorBytes(m_poly);
+    for (const auto& inner : m_poly) {
+        fits += vectorBytes(inner);
+    }
+    report["fit-coefficient-bytes"] = static_cast<long int>(fits);
+
+    report["collision-parameter-bytes"] = static_cast<long int>(
+        vectorBytes(m_reducedMass.data()) + vectorBytes(m_diam.data())
+        + vectorBytes(m_epsilon.data()) + vectorBytes(m_dipole.data())
+        + vectorBytes(m_delta.data()) + vectorBytes(m_wratjk.data())
+        + vectorBytes(m_wratkj1.data()) + vectorBytes(m_zrot)
+        + vectorBytes(m_crot) + vectorBytes(m_alpha) + vectorBytes(m_eps)
+        + vectorBytes(m_sigma) + vectorBytes(m_w_ac) + vectorBytes(m_disp)
+        + vectorBytes(m_quad_polar));
+
+    report["work-array-bytes"] = static_cast<long int>(
+        vectorBytes(m_molefracs) + vectorBytes(m_spwork)
+        + vectorBytes(m_visc) + vectorBytes(m_sqvisc) + vectorBytes(m_rvisc)
+        + vectorBytes(m_rsqvisc) + vectorBytes(m_polytempvec)
+        + vectorBytes(m_diffwork) + vectorBytes(m_phi.data())
+        + vectorBytes(m_viscwtfac.data()) + vectorBytes(m_bdiff.data()));
+    return report;
+}
+
 void GasTransport::getTransportData()
 {
     for (size_t k = 0; k < m_thermo->nSpecies(); k++) {
@@ -506,11 +759,7 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
     const size_t np = 50;
     int degree = (m_mode == CK_Mode ? 3 : 4);
     double dt = (m_thermo->maxTemp() - m_thermo->minTemp())/(np-1);
-    vector_fp tlog(np), spvisc(np), spcond(np);
-    vector_fp w(np), w2(np);
-
-    m_visccoeffs.clear();
-    m_condcoeffs.clear();
+    vector_fp tlog(np);
 
     // generate array of log(t) values
     for (size_t n = 0; n < np; n++) {
@@ -518,15 +767,11 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
         tlog[n] = log(t);
     }
 
-    // vector of polynomial coefficients
-    vector_fp c(degree + 1), c2(degree + 1);
-
     // fit the pure-species viscosity and thermal conductivity for each species
     if (m_log_level && m_log_level < 2) {
         writelog("*** polynomial coefficients not printed (log_level < 2) ***\n");
     }
-    double visc, err, relerr,
-               mxerr = 0.0, mxrelerr = 0.0, mxerr_cond = 0.0, mxrelerr_cond = 0.0;
+    double mxerr = 0.0, mxrelerr = 0.0, mxerr_cond = 0.0, mxrelerr_cond = 0.0;
 
     if (m_log_level) {
         writelog("Polynomial fits for viscosity:\n");
@@ -538,115 +783,143 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
         }
     }
 
+    // Sample the reference-state heat capacities on the fit grid in advance.
+    // Evaluating them requires setting the state of the thermo object, which
+    // must not happen from the (possibly multi-threaded) fitting loop below.
     double T_save = m_thermo->temperature();
+    vector_fp cp_R_table(np * m_nsp);
+    for (size_t n = 0; n < np; n++) {
+        m_thermo->setTemperature(m_thermo->minTemp() + dt*n);
+        m_thermo->getCp_R_ref(&cp_R_table[n * m_nsp]);
+    }
+    m_thermo->setTemperature(T_save);
+
     const vector_fp& mw = m_thermo->molecularWeights();
-    for (size_t k = 0; k < m_nsp; k++) {
-        double tstar = Boltzmann * 298.0 / m_eps[k];
-        // Scaling factor for temperature dependence of z_rot. [Kee2003] Eq.
-        // 12.112 or [Kee2017] Eq. 11.115
-        double fz_298 = 1.0 + pow(Pi, 1.5) / sqrt(tstar) * (0.5 + 1.0 / tstar) +
-            (0.25 * Pi * Pi + 2) / tstar;
-
-        for (size_t n = 0; n < np; n++) {
-            double t = m_thermo->minTemp() + dt*n;
-            m_thermo->setTemperature(t);
-            vector_fp cp_R_all(m_thermo->nSpecies());
-            m_thermo->getCp_R_ref(&cp_R_all[0]);
-            double cp_R = cp_R_all[k];
-            tstar = Boltzmann * t / m_eps[k];
-            double sqrt_T = sqrt(t);
-            double om22 = integrals.omega22(tstar, m_delta(k,k));
-            double om11 = integrals.omega11(tstar, m_delta(k,k));
-
-            // self-diffusion coefficient, without polar corrections
-            double diffcoeff = 3.0/16.0 * sqrt(2.0 * Pi/m_reducedMass(k,k)) *
-                               pow((Boltzmann * t), 1.5)/
-                               (Pi * m_sigma[k] * m_sigma[k] * om11);
-
-            // viscosity
-            visc = 5.0/16.0 * sqrt(Pi * mw[k] * Boltzmann * t / Avogadro) /
-                   (om22 * Pi * m_sigma[k]*m_sigma[k]);
-
-            // thermal conductivity
-            double f_int = mw[k]/(GasConstant * t) * diffcoeff/visc;
-            double cv_rot = m_crot[k];
-            double A_factor = 2.5 - f_int;
-            double fz_tstar = 1.0 + pow(Pi, 1.5) / sqrt(tstar) * (0.5 + 1.0 / tstar) +
+    m_visccoeffs.assign(m_nsp, vector_fp(degree + 1));
+    m_condcoeffs.assign(m_nsp, vector_fp(degree + 1));
+
+    // The fits for the individual species are independent, so they can be
+    // generated in parallel. Fitting stays serial whenever log output is
+    // enabled, to keep the output ordered by species.
+    size_t nThreads = (m_log_level ? 1 : fitThreadCount(m_nsp));
+    std::mutex statsMutex;
+    runFitChunks(m_nsp, nThreads, [&](size_t kBegin, size_t kEnd) {
+        vector_fp spvisc(np), spcond(np), w(np), w2(np), fitval(np);
+        vector_fp c(degree + 1), c2(degree + 1);
+        double visc, err, relerr,
+               mxerr_l = 0.0, mxrelerr_l = 0.0,
+               mxerr_cond_l = 0.0, mxrelerr_cond_l = 0.0;
+        for (size_t k = kBegin; k < kEnd; k++) {
+            double tstar = Boltzmann * 298.0 / m_eps[k];
+            // Scaling factor for temperature dependence of z_rot. [Kee2003] Eq.
+            // 12.112 or [Kee2017] Eq. 11.115
+            double fz_298 = 1.0 + pow(Pi, 1.5) / sqrt(tstar) * (0.5 + 1.0 / tstar) +
                 (0.25 * Pi * Pi + 2) / tstar;
-            double B_factor = m_zrot[k] * fz_298 / fz_tstar + 2.0/Pi * (5.0/3.0 * cv_rot + f_int);
-            double c1 = 2.0/Pi * A_factor/B_factor;
-            double cv_int = cp_R - 2.5 - cv_rot;
-            double f_rot = f_int * (1.0 + c1);
-            double f_trans = 2.5 * (1.0 - c1 * cv_rot/1.5);
-            double cond = (visc/mw[k])*GasConstant*(f_trans * 1.5
-                                                + f_rot * cv_rot + f_int * cv_int);
-
-            if (m_mode == CK_Mode) {
-                spvisc[n] = log(visc);
-                spcond[n] = log(cond);
-                w[n] = -1.0;
-                w2[n] = -1.0;
-            } else {
-                // the viscosity should be proportional approximately to
-                // sqrt(T); therefore, visc/sqrt(T) should have only a weak
-                // temperature dependence. And since the mixture rule requires
-                // the square root of the pure-species viscosity, fit the square
-                // root of (visc/sqrt(T)) to avoid having to compute square
-                // roots in the mixture rule.
-                spvisc[n] = sqrt(visc/sqrt_T);
-
-                // the pure-species conductivity scales approximately with
-                // sqrt(T). Unlike the viscosity, there is no reason here to fit
-                // the square root, since a different mixture rule is used.
-                spcond[n] = cond/sqrt_T;
-                w[n] = 1.0/(spvisc[n]*spvisc[n]);
-                w2[n] = 1.0/(spcond[n]*spcond[n]);
+
+            for (size_t n = 0; n < np; n++) {
+                double t = m_thermo->minTemp() + dt*n;
+                double cp_R = cp_R_table[n * m_nsp + k];
+                tstar = Boltzmann * t / m_eps[k];
+                double sqrt_T = sqrt(t);
+                double om22 = integrals.omega22(tstar, m_delta(k,k));
+                double om11 = integrals.omega11(tstar, m_delta(k,k));
+
+                // self-diffusion coefficient, without polar corrections
+                double diffcoeff = 3.0/16.0 * sqrt(2.0 * Pi/m_reducedMass(k,k)) *
+                                   pow((Boltzmann * t), 1.5)/
+                                   (Pi * m_sigma[k] * m_sigma[k] * om11);
+
+                // viscosity
+                visc = 5.0/16.0 * sqrt(Pi * mw[k] * Boltzmann * t / Avogadro) /
+                       (om22 * Pi * m_sigma[k]*m_sigma[k]);
+
+                // thermal conductivity
+                double f_int = mw[k]/(GasConstant * t) * diffcoeff/visc;
+                double cv_rot = m_crot[k];
+                double A_factor = 2.5 - f_int;
+                double fz_tstar = 1.0 + pow(Pi, 1.5) / sqrt(tstar) * (0.5 + 1.0 / tstar) +
+                    (0.25 * Pi * Pi + 2) / tstar;
+                double B_factor = m_zrot[k] * fz_298 / fz_tstar + 2.0/Pi * (5.0/3.0 * cv_rot + f_int);
+                double c1 = 2.0/Pi * A_factor/B_factor;
+                double cv_int = cp_R - 2.5 - cv_rot;
+                double f_rot = f_int * (1.0 + c1);
+                double f_trans = 2.5 * (1.0 - c1 * cv_rot/1.5);
+                double cond = (visc/mw[k])*GasConstant*(f_trans * 1.5
+                                                    + f_rot * cv_rot + f_int * cv_int);
+
+                if (m_mode == CK_Mode) {
+                    spvisc[n] = log(visc);
+                    spcond[n] = log(cond);
+                    w[n] = -1.0;
+                    w2[n] = -1.0;
+                } else {
+                    // the viscosity should be proportional approximately to
+                    // sqrt(T); therefore, visc/sqrt(T) should have only a weak
+                    // temperature dependence. And since the mixture rule requires
+                    // the square root of the pure-species viscosity, fit the square
+                    // root of (visc/sqrt(T)) to avoid having to compute square
+                    // roots in the mixture rule.
+                    spvisc[n] = sqrt(visc/sqrt_T);
+
+                    // the pure-species conductivity scales approximately with
+                    // sqrt(T). Unlike the viscosity, there is no reason here to fit
+                    // the square root, since a different mixture rule is used.
+                    spcond[n] = cond/sqrt_T;
+                    w[n] = 1.0/(spvisc[n]*spvisc[n]);
+                    w2[n] = 1.0/(spcond[n]*spcond[n]);
+                }
             }
-        }
-        polyfit(np, degree, tlog.data(), spvisc.data(), w.data(), c.data());
-        polyfit(np, degree, tlog.data(), spcond.data(), w2.data(), c2.data());
+            polyfit(np, degree, tlog.data(), spvisc.data(), w.data(), c.data());
+            polyfit(np, degree, tlog.data(), spcond.data(), w2.data(), c2.data());
 
-        // evaluate max fit errors for viscosity
-        for (size_t n = 0; n < np; n++) {
-            double val, fit;
-            if (m_mode == CK_Mode) {
-                val = exp(spvisc[n]);
-                fit = exp(poly3(tlog[n], c.data()));
-            } else {
-                double sqrt_T = exp(0.5*tlog[n]);
-                val = sqrt_T * pow(spvisc[n],2);
-                fit = sqrt_T * pow(poly4(tlog[n], c.data()),2);
+            // evaluate max fit errors for viscosity
+            polyeval(degree, c.data(), np, tlog.data(), fitval.data());
+            for (size_t n = 0; n < np; n++) {
+                double val, fit;
+                if (m_mode == CK_Mode) {
+                    val = exp(spvisc[n]);
+                    fit = exp(fitval[n]);
+                } else {
+                    double sqrt_T = exp(0.5*tlog[n]);
+                    val = sqrt_T * pow(spvisc[n],2);
+                    fit = sqrt_T * pow(fitval[n],2);
+                }
+                err = fit - val;
+                relerr = err/val;
+                mxerr_l = std::max(mxerr_l, fabs(err));
+                mxrelerr_l = std::max(mxrelerr_l, fabs(relerr));
             }
-            err = fit - val;
-            relerr = err/val;
-            mxerr = std::max(mxerr, fabs(err));
-            mxrelerr = std::max(mxrelerr, fabs(relerr));
-        }
-
-        // evaluate max fit errors for conductivity
-        for (size_t n = 0; n < np; n++) {
-            double val, fit;
-            if (m_mode == CK_Mode) {
-                val = exp(spcond[n]);
-                fit = exp(poly3(tlog[n], c2.data()));
-            } else {
-                double sqrt_T = exp(0.5*tlog[n]);
-                val = sqrt_T * spcond[n];
-                fit = sqrt_T * poly4(tlog[n], c2.data());
+
+            // evaluate max fit errors for conductivity
+            polyeval(degree, c2.data(), np, tlog.data(), fitval.data());
+            for (size_t n = 0; n < np; n++) {
+                double val, fit;
+                if (m_mode == CK_Mode) {
+                    val = exp(spcond[n]);
+                    fit = exp(fitval[n]);
+                } else {
+                    double sqrt_T = exp(0.5*tlog[n]);
+                    val = sqrt_T * spcond[n];
+                    fit = sqrt_T * fitval[n];
+                }
+                err = fit - val;
+                relerr = err/val;
+                mxerr_cond_l = std::max(mxerr_cond_l, fabs(err));
+                mxrelerr_cond_l = std::max(mxrelerr_cond_l, fabs(relerr));
             }
-            err = fit - val;
-            relerr = err/val;
-            mxerr_cond = std::max(mxerr_cond, fabs(err));
-            mxrelerr_cond = std::max(mxrelerr_cond, fabs(relerr));
-        }
-        m_visccoeffs.push_back(c);
-        m_condcoeffs.push_back(c2);
+            m_visccoeffs[k] = c;
+            m_condcoeffs[k] = c2;
 
-        if (m_log_level >= 2) {
-            writelog(m_thermo->speciesName(k) + ": [" + vec2str(c) + "]\n");
+            if (m_log_level >= 2) {
+                writelog(m_thermo->speciesName(k) + ": [" + vec2str(c) + "]\n");
+            }
         }
-    }
-    m_thermo->setTemperature(T_save);
+        std::lock_guard<std::mutex> lock(statsMutex);
+        mxerr = std::max(mxerr, mxerr_l);
+        mxrelerr = std::max(mxrelerr, mxrelerr_l);
+        mxerr_cond = std::max(mxerr_cond, mxerr_cond_l);
+        mxrelerr_cond = std::max(mxrelerr_cond, mxrelerr_cond_l);
+    });
 
     if (m_log_level) {
         writelogf("Maximum viscosity absolute error:  %12.6g\n", mxerr);
@@ -686,7 +959,6 @@ void GasTransport::fitDiffCoeffs(MMCollisionInt& integrals)
     int degree = (m_mode == CK_Mode ? 3 : 4);
     double dt = (m_thermo->maxTemp() - m_thermo->minTemp())/(np-1);
     vector_fp tlog(np);
-    vector_fp w(np), w2(np);
 
     // generate array of log(t) values
     for (size_t n = 0; n < np; n++) {
@@ -694,15 +966,31 @@ void GasTransport::fitDiffCoeffs(MMCollisionInt& integrals)
         tlog[n] = log(t);
     }
 
-    // vector of polynomial coefficients
-    vector_fp c(degree + 1), c2(degree + 1);
-    double err, relerr,
-               mxerr = 0.0, mxrelerr = 0.0;
-
-    vector_fp diff(np + 1);
-    m_diffcoeffs.clear();
-    for (size_t k = 0; k < m_nsp; k++) {
-        for (size_t j = k; j < m_nsp; j++) {
+    double mxerr = 0.0, mxrelerr = 0.0;
+
+    size_t npairs = m_nsp * (m_nsp + 1) / 2;
+    m_diffcoeffs.assign(npairs, vector_fp(degree + 1));
+    m_diffcoeffs_flat.clear();
+    m_bdiff_temp = 0.0;
+
+    // The fit for each pair is independent, so the pairs can be fit in
+    // parallel. The work is chunked over the flattened pair index rather than
+    // the first species index so that the chunks are of equal size. Fitting
+    // stays serial whenever log output is enabled, to keep the output ordered.
+    size_t nThreads = (m_log_level ? 1 : fitThreadCount(npairs));
+    std::mutex statsMutex;
+    runFitChunks(npairs, nThreads, [&](size_t icBegin, size_t icEnd) {
+        vector_fp c(degree + 1), w(np), diff(np + 1), fitval(np);
+        double err, relerr, mxerr_l = 0.0, mxrelerr_l = 0.0;
+        // locate the species pair (k,j) of the first flat index in this chunk
+        size_t k = 0;
+        size_t rowStart = 0; // flat index of the pair (k,k)
+        while (icBegin >= rowStart + m_nsp - k) {
+            rowStart += m_nsp - k;
+            k++;
+        }
+        size_t j = k + (icBegin - rowStart);
+        for (size_t ic = icBegin; ic < icEnd; ic++) {
             for (size_t n = 0; n < np; n++) {
                 double t = m_thermo->minTemp() + dt*n;
                 double eps = m_epsilon(j,k);
@@ -727,29 +1015,37 @@ void GasTransport::fitDiffCoeffs(MMCollisionInt& integrals)
             }
             polyfit(np, degree, tlog.data(), diff.data(), w.data(), c.data());
 
+            polyeval(degree, c.data(), np, tlog.data(), fitval.data());
             for (size_t n = 0; n < np; n++) {
                 double val, fit;
                 if (m_mode == CK_Mode) {
                     val = exp(diff[n]);
-                    fit = exp(poly3(tlog[n], c.data()));
+                    fit = exp(fitval[n]);
                 } else {
                     double t = exp(tlog[n]);
                     double pre = pow(t, 1.5);
                     val = pre * diff[n];
-                    fit = pre * poly4(tlog[n], c.data());
+                    fit = pre * fitval[n];
                 }
                 err = fit - val;
                 relerr = err/val;
-                mxerr = std::max(mxerr, fabs(err));
-                mxrelerr = std::max(mxrelerr, fabs(relerr));
+                mxerr_l = std::max(mxerr_l, fabs(err));
+                mxrelerr_l = std::max(mxrelerr_l, fabs(relerr));
             }
-            m_diffcoeffs.push_back(c);
+            m_diffcoeffs[ic] = c;
             if (m_log_level >= 2) {
                 writelog(m_thermo->speciesName(k) + "__" +
                          m_thermo->speciesName(j) + ": [" + vec2str(c) + "]\n");
             }
+            if (++j == m_nsp) {
+                k++;
+                j = k;
+            }
         }
-    }
+        std::lock_guard<std::mutex> lock(statsMutex);
+        mxerr = std::max(mxerr, mxerr_l);
+        mxrelerr = std::max(mxrelerr, mxrelerr_l);
+    });
     if (m_log_level) {
         writelogf("Maximum binary diffusion coefficient absolute error:"
                  "  %12.6g\n", mxerr);
@@ -758,6 +1054,283 @@ void GasTransport::fitDiffCoeffs(MMCollisionInt& integrals)
     }
 }
 
+uint64_t GasTransport::fitInputHash()
+{
+    // Hash everything the fits depend on, so that the cache file name is
+    // unique to this mechanism. The reference heat capacities sampled over
+    // the fit temperature range capture the thermo parameterization that
+    // enters the conductivity fits.
+    const size_t np = 50;
+    double tmin = m_thermo->minTemp();
+    double tmax = m_thermo->maxTemp();
+    double dt = (tmax - tmin)/(np-1);
+
+    uint64_t h = 14695981039346656037ULL; // FNV-1a offset basis
+    fitHashString(h, CANTERA_VERSION);
+    int32_t mode = m_mode;
+    fitHashBytes(h, &mode, sizeof(mode));
+    fitHashDouble(h, static_cast<double>(m_nsp));
+    fitHashDouble(h, tmin);
+    fitHashDouble(h, tmax);
+    for (size_t k = 0; k < m_nsp; k++) {
+        fitHashString(h, m_thermo->speciesName(k));
+        fitHashDouble(h, m_thermo->molecularWeight(k));
+        fitHashDouble(h, m_thermo->charge(k));
+        fitHashDouble(h, m_eps[k]);
+        fitHashDouble(h, m_sigma[k]);
+        fitHashDouble(h, m_dipole(k,k));
+        fitHashDouble(h, m_alpha[k]);
+        fitHashDouble(h, m_zrot[k]);
+        fitHashDouble(h, m_crot[k]);
+        fitHashDouble(h, m_polar[k] ? 1.0 : 0.0);
+    }
+
+    double T_save = m_thermo->temperature();
+    vector_fp cp_R(m_nsp);
+    for (size_t n = 0; n < np; n++) {
+        m_thermo->setTemperature(tmin + dt*n);
+        m_thermo->getCp_R_ref(cp_R.data());
+        fitHashBytes(h, cp_R.data(), m_nsp * sizeof(double));
+    }
+    m_thermo->setTemperature(T_save);
+    return h;
+}
+
+std::string GasTransport::fitCacheFile()
+{
+    const char* dir = getenv("CANTERA_TRANSPORT_FIT_CACHE");
+    if (dir == nullptr || dir[0] == '\0') {
+        return "";
+    }
+    std::ostringstream name;
+    name << dir << "/tranfit-" << std::hex << std::setw(16)
+         << std::setfill('0') << fitInputHash() << ".ctcache";
+    return name.str();
+}
+
+bool GasTransport::loadFitCache()
+{
+    std::string path = fitCacheFile();
+    if (path.empty()) {
+        return false;
+    }
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    uint32_t magic = 0;
+    int32_t version = 0;
+    in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (!in.good() || magic != FitCacheMagic || version != FitCacheVersion) {
+        return false;
+    }
+    std::vector<vector_fp> visc, cond, diff;
+    if (!fitCacheReadArray(in, visc) || !fitCacheReadArray(in, cond)
+        || !fitCacheReadArray(in, diff)) {
+        return false;
+    }
+    if (visc.size() != m_nsp || cond.size() != m_nsp
+        || diff.size() != m_nsp * (m_nsp + 1) / 2) {
+        return false;
+    }
+    m_visccoeffs = std::move(visc);
+    m_condcoeffs = std::move(cond);
+    m_diffcoeffs = std::move(diff);
+    m_diffcoeffs_flat.clear();
+    m_bdiff_temp = 0.0;
+    return true;
+}
+
+void GasTransport::saveFitCache()
+{
+    std::string path = fitCacheFile();
+    if (path.empty()) {
+        return;
+    }
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        return;
+    }
+    out.write(reinterpret_cast<const char*>(&FitCacheMagic),
+              sizeof(FitCacheMagic));
+    out.write(reinterpret_cast<const char*>(&FitCacheVersion),
+              sizeof(FitCacheVersion));
+    fitCacheWriteArray(out, m_visccoeffs);
+    fitCacheWriteArray(out, m_condcoeffs);
+    fitCacheWriteArray(out, m_diffcoeffs);
+}
+
+void GasTransport::publishFitTables(const std::string& segment)
+{
+    if (m_shmDiffcoeffs) {
+        throw CanteraError("GasTransport::publishFitTables",
+            "The fits of this transport manager are themselves attached "
+            "from shared memory.");
+    }
+    size_t np = m_visccoeffs.empty() ? 0 : m_visccoeffs[0].size();
+    size_t npairs = m_diffcoeffs.size();
+    if (np == 0 || npairs != m_nsp * (m_nsp + 1) / 2) {
+        throw CanteraError("GasTransport::publishFitTables",
+            "The property fits have not been generated, or this transport "
+            "model stores them in a nonstandard layout.");
+    }
+
+    // the hash of the fit inputs lets attachFitTables() reject segments
+    // published for a different mechanism; its bits are carried in a double
+    uint64_t h = fitInputHash();
+    vector_fp meta(4);
+    meta[0] = static_cast<double>(m_nsp);
+    meta[1] = static_cast<double>(np);
+    meta[2] = static_cast<double>(m_mode);
+    memcpy(&meta[3], &h, sizeof(h));
+
+    vector_fp visc(m_nsp * np), cond(m_nsp * np), diff(npairs * np);
+    for (size_t k = 0; k < m_nsp; k++) {
+        for (size_t d = 0; d < np; d++) {
+            visc[k*np + d] = m_visccoeffs[k][d];
+            cond[k*np + d] = m_condcoeffs[k][d];
+        }
+    }
+    // the pair fits use the degree-plane layout of m_diffcoeffs_flat, so
+    // updateDiff_T() can evaluate them in place
+    for (size_t ic = 0; ic < npairs; ic++) {
+        for (size_t d = 0; d < np; d++) {
+            diff[d*npairs + ic] = m_diffcoeffs[ic][d];
+        }
+    }
+    SharedMemTables::publish(segment, {{"meta", &meta}, {"visc", &visc},
+                                       {"cond", &cond}, {"bindiff", &diff}});
+}
+
+void GasTransport::attachFitTables(const std::string& segment)
+{
+    std::unique_ptr<SharedMemTables> shm(new SharedMemTables(segment));
+    size_t len;
+    const double* meta = shm->table("meta", len);
+    uint64_t h = fitInputHash();
+    if (len != 4 || meta[0] != static_cast<double>(m_nsp)
+        || meta[2] != static_cast<double>(m_mode)
+        || memcmp(&meta[3], &h, sizeof(h)) != 0) {
+        throw CanteraError("GasTransport::attachFitTables",
+            "Segment '{}' holds fits for a different mechanism, transport "
+            "model or fit configuration.", segment);
+    }
+    size_t np = static_cast<size_t>(meta[1]);
+    size_t npairs = m_nsp * (m_nsp + 1) / 2;
+    const double* visc = shm->table("visc", len);
+    if (len != m_nsp * np) {
+        throw CanteraError("GasTransport::attachFitTables",
+            "Viscosity table has length {} instead of {}.", len, m_nsp * np);
+    }
+    const double* cond = shm->table("cond", len);
+    if (len != m_nsp * np) {
+        throw CanteraError("GasTransport::attachFitTables",
+            "Conductivity table has length {} instead of {}.",
+            len, m_nsp * np);
+    }
+    const double* diff = shm->table("bindiff", len);
+    if (len != npairs * np) {
+        throw CanteraError("GasTransport::attachFitTables",
+            "Binary diffusivity table has length {} instead of {}.",
+            len, npairs * np);
+    }
+
+    // the per-species fits are small enough to copy; the per-pair fits are
+    // evaluated directly from the read-only mapping
+    m_visccoeffs.assign(m_nsp, vector_fp(np));
+    m_condcoeffs.assign(m_nsp, vector_fp(np));
+    for (size_t k = 0; k < m_nsp; k++) {
+        for (size_t d = 0; d < np; d++) {
+            m_visccoeffs[k][d] = visc[k*np + d];
+            m_condcoeffs[k][d] = cond[k*np + d];
+        }
+    }
+    m_shmFits = std::move(shm);
+    m_shmDiffcoeffs = diff;
+    m_shmNpairs = npairs;
+    m_shmNp = np;
+    std::vector<vector_fp>().swap(m_diffcoeffs);
+    vector_fp().swap(m_diffcoeffs_flat);
+    m_bdiff_temp = 0.0;
+    m_bindiff_ok = false;
+}
+
+bool GasTransport::adoptSharedFits()
+{
+    uint64_t h = fitInputHash();
+    shared_ptr<const GasTransportFits> fits;
+    {
+        std::lock_guard<std::mutex> lock(fit_registry_mutex);
+        auto iter = fit_registry.find(h);
+        if (iter == fit_registry.end()) {
+            return false;
+        }
+        fits = iter->second.lock();
+        if (!fits) {
+            // the last manager referencing these tables has been destroyed
+            fit_registry.erase(iter);
+            return false;
+        }
+    }
+
+    // the per-species fits are small enough to copy; the per-pair fits are
+    // evaluated directly from the shared table
+    m_visccoeffs = fits->visccoeffs;
+    m_condcoeffs = fits->condcoeffs;
+    m_shmDiffcoeffs = fits->diffcoeffs_flat.data();
+    m_shmNpairs = fits->npairs;
+    m_shmNp = fits->np;
+    m_procFits = std::move(fits);
+    std::vector<vector_fp>().swap(m_diffcoeffs);
+    vector_fp().swap(m_diffcoeffs_flat);
+    m_bdiff_temp = 0.0;
+    m_bindiff_ok = false;
+    return true;
+}
+
+void GasTransport::publishSharedFits()
+{
+    size_t npairs = m_diffcoeffs.size();
+    size_t np = npairs ? m_diffcoeffs[0].size() : 0;
+    if (np == 0 || npairs != m_nsp * (m_nsp + 1) / 2) {
+        // the fits of a derived model with a nonstandard layout cannot be
+        // shared; it keeps its private copy
+        return;
+    }
+
+    auto fits = std::make_shared<GasTransportFits>();
+    fits->visccoeffs = m_visccoeffs;
+    fits->condcoeffs = m_condcoeffs;
+    fits->npairs = npairs;
+    fits->np = np;
+    // the pair fits use the degree-plane layout of m_diffcoeffs_flat, so
+    // updateDiff_T() can evaluate them in place
+    fits->diffcoeffs_flat.resize(np * npairs);
+    for (size_t ic = 0; ic < npairs; ic++) {
+        for (size_t d = 0; d < np; d++) {
+            fits->diffcoeffs_flat[d*npairs + ic] = m_diffcoeffs[ic][d];
+        }
+    }
+
+    uint64_t h = fitInputHash();
+    {
+        std::lock_guard<std::mutex> lock(fit_registry_mutex);
+        fit_registry[h] = fits;
+    }
+
+    // this manager also switches over to the shared pair table, so that its
+    // private copy can be released
+    m_shmDiffcoeffs = fits->diffcoeffs_flat.data();
+    m_shmNpairs = npairs;
+    m_shmNp = np;
+    m_procFits = std::move(fits);
+    std::vector<vector_fp>().swap(m_diffcoeffs);
+    vector_fp().swap(m_diffcoeffs_flat);
+    m_bdiff_temp = 0.0;
+    m_bindiff_ok = false;
+}
+
 void GasTransport::getBinDiffCorrection(double t, MMCollisionInt& integrals,
         size_t k, size_t j, double xk, double xj, double& fkj, double& fjk)
 {
@@ -834,8 +1407,14 @@ void GasTransport::getBinDiffusivityPolynomials(size_t i, size_t j, double* coef
     }
     ic += mj - mi;
 
-    for (size_t k = 0; k < (m_mode == CK_Mode ? 4 : 5); k++) {
-        coeffs[k] = m_diffcoeffs[ic][k];
+    if (m_shmDiffcoeffs) {
+        for (size_t k = 0; k < (m_mode == CK_Mode ? 4 : 5); k++) {
+            coeffs[k] = m_shmDiffcoeffs[k*m_shmNpairs + ic];
+        }
+    } else {
+        for (size_t k = 0; k < (m_mode == CK_Mode ? 4 : 5); k++) {
+            coeffs[k] = m_diffcoeffs[ic][k];
+        }
     }
 }
 
@@ -27,10 +27,52 @@ namespace Cantera
 {
 
 HighPressureGasTransport::HighPressureGasTransport(ThermoPhase* thermo)
-: MultiTransport(thermo)
+: MultiTransport(thermo),
+  m_crit_ok(false)
 {
 }
 
+void HighPressureGasTransport::updateCritProperties()
+{
+    if (m_crit_ok) {
+        return;
+    }
+    size_t nsp = m_thermo->nSpecies();
+    m_Tcrit.resize(nsp);
+    m_Pcrit.resize(nsp);
+    m_Vcrit.resize(nsp);
+    m_Zcrit.resize(nsp);
+    m_FQ_param.assign(nsp, 0.0);
+
+    // Store the current composition, then visit each pure species once and
+    // evaluate all four critical properties before restoring it.
+    vector_fp molefracs(nsp);
+    m_thermo->getMoleFractions(&molefracs[0]);
+    vector_fp mf_temp(nsp);
+    for (size_t i = 0; i < nsp; i++) {
+        mf_temp.assign(nsp, 0.0);
+        mf_temp[i] = 1.0;
+        m_thermo->setMoleFractions(&mf_temp[0]);
+        m_Tcrit[i] = m_thermo->critTemperature();
+        m_Pcrit[i] = m_thermo->critPressure();
+        m_Vcrit[i] = m_thermo->critVolume();
+        m_Zcrit[i] = m_thermo->critCompressibility();
+
+        // SCD Note:  This assumes the species of interest (He, H2, and D2)
+        //   have been named in this specific way.
+        const std::string& spname = m_thermo->speciesName(i);
+        if (spname == "He") {
+            m_FQ_param[i] = 1.38;
+        } else if (spname == "H2") {
+            m_FQ_param[i] = 0.76;
+        } else if (spname == "D2") {
+            m_FQ_param[i] = 0.52;
+        }
+    }
+    m_thermo->setMoleFractions(&molefracs[0]);
+    m_crit_ok = true;
+}
+
 double HighPressureGasTransport::thermalConductivity()
 {
     //  Method of Ely and Hanley:
@@ -50,10 +92,11 @@ double HighPressureGasTransport::thermalConductivity()
 
     m_thermo -> getPartialMolarVolumes(&V_k[0]);
     doublereal L_i_min = BigNumber;
+    updateCritProperties();
 
     for (size_t i = 0; i < m_nsp; i++) {
-        doublereal Tc_i = Tcrit_i(i);
-        doublereal Vc_i = Vcrit_i(i);
+        doublereal Tc_i = m_Tcrit[i];
+        doublereal Vc_i = m_Vcrit[i];
         doublereal T_r = m_thermo->temperature()/Tc_i;
         doublereal V_r = V_k[i]/Vc_i;
         doublereal T_p = std::min(T_r,2.0);
@@ -63,7 +106,7 @@ double HighPressureGasTransport::thermalConductivity()
         doublereal theta_p = 1.0 + (m_w_ac[i] - 0.011)*(0.56553
             - 0.86276*log(T_p) - 0.69852/T_p);
         doublereal phi_p = (1.0 + (m_w_ac[i] - 0.011)*(0.38560
-            - 1.1617*log(T_p)))*0.288/Zcrit_i(i);
+            - 1.1617*log(T_p)))*0.288/m_Zcrit[i];
         doublereal f_fac = Tc_i*theta_p/190.4;
         doublereal h_fac = 1000*Vc_i*phi_p/99.2;
         doublereal T_0 = m_temp/f_fac;
@@ -79,7 +122,7 @@ double HighPressureGasTransport::thermalConductivity()
         doublereal theta_s = 1 + (m_w_ac[i] - 0.011)*(0.09057 - 0.86276*log(T_p)
             + (0.31664 - 0.46568/T_p)*(V_p - 0.5));
         doublereal phi_s = (1 + (m_w_ac[i] - 0.011)*(0.39490*(V_p - 1.02355)
-            - 0.93281*(V_p - 0.75464)*log(T_p)))*0.288/Zcrit_i(i);
+            - 0.93281*(V_p - 0.75464)*log(T_p)))*0.288/m_Zcrit[i];
         f_i[i] = Tc_i*theta_s/190.4;
         h_i[i] = 1000*Vc_i*phi_s/99.2;
     }
@@ -150,7 +193,9 @@ void HighPressureGasTransport::getBinaryDiffCoeffs(const size_t ld, doublereal*
         throw CanteraError("HighPressureGasTransport::getBinaryDiffCoeffs",
                            "ld is too small");
     }
-    doublereal rp = 1.0/m_thermo->pressure();
+    updateCritProperties();
+    doublereal pres = m_thermo->pressure();
+    doublereal rp = 1.0/pres;
     for (size_t i = 0; i < nsp; i++) {
         for (size_t j = 0; j < nsp; j++) {
             // Add an offset to avoid a condition where x_i and x_j both equal
@@ -163,8 +208,8 @@ void HighPressureGasTransport::getBinaryDiffCoeffs(const size_t ld, doublereal*
             x_j = x_j/(x_i + x_j);
 
             //Calculate Tr and Pr based on mole-fraction-weighted crit constants:
-            double Tr_ij = m_temp/(x_i*Tcrit_i(i) + x_j*Tcrit_i(j));
-            double Pr_ij = m_thermo->pressure()/(x_i*Pcrit_i(i) + x_j*Pcrit_i(j));
+            double Tr_ij = m_temp/(x_i*m_Tcrit[i] + x_j*m_Tcrit[j]);
+            double Pr_ij = pres/(x_i*m_Pcrit[i] + x_j*m_Pcrit[j]);
 
             double P_corr_ij;
             if (Pr_ij < 0.1) {
@@ -213,6 +258,7 @@ void HighPressureGasTransport::getMultiDiffCoeffs(const size_t ld, doublereal* c
     // Evaluate the binary diffusion coefficients from the polynomial fits -
     // this should perhaps be preceded by a check for changes in T, P, or C.
     updateDiff_T();
+    updateCritProperties();
 
     if (ld < m_nsp) {
         throw CanteraError("HighPressureGasTransport::getMultiDiffCoeffs",
@@ -226,8 +272,8 @@ void HighPressureGasTransport::getMultiDiffCoeffs(const size_t ld, doublereal* c
             doublereal x_j = std::max(Tiny, molefracs[j]);
             x_i = x_i/(x_i+x_j);
             x_j = x_j/(x_i+x_j);
-            double Tr_ij = m_temp/(x_i*Tcrit_i(i) + x_j*Tcrit_i(j));
-            double Pr_ij = m_thermo->pressure()/(x_i*Pcrit_i(i) + x_j*Pcrit_i(j));
+            double Tr_ij = m_temp/(x_i*m_Tcrit[i] + x_j*m_Tcrit[j]);
+            double Pr_ij = m_thermo->pressure()/(x_i*m_Pcrit[i] + x_j*m_Pcrit[j]);
 
             double P_corr_ij;
             if (Pr_ij < 0.1) {
@@ -289,17 +335,18 @@ doublereal HighPressureGasTransport::viscosity()
     size_t nsp = m_thermo->nSpecies();
     vector_fp molefracs(nsp);
     m_thermo->getMoleFractions(&molefracs[0]);
+    updateCritProperties();
 
     double x_H = molefracs[0];
     for (size_t i = 0; i < m_nsp; i++) {
-        // Calculate pure-species critical constants and add their contribution
+        // Look up pure-species critical constants and add their contribution
         // to the mole-fraction-weighted mixture averages:
-        double Tc = Tcrit_i(i);
+        double Tc = m_Tcrit[i];
         double Tr = tKelvin/Tc;
-        double Zc = Zcrit_i(i);
+        double Zc = m_Zcrit[i];
         Tc_mix += Tc*molefracs[i];
         Pc_mix_n += molefracs[i]*Zc; //numerator
-        Pc_mix_d += molefracs[i]*Vcrit_i(i); //denominator
+        Pc_mix_d += molefracs[i]*m_Vcrit[i]; //denominator
 
         // Need to calculate ratio of heaviest to lightest species:
         if (m_mw[i] > MW_H) {
@@ -310,7 +357,7 @@ doublereal HighPressureGasTransport::viscosity()
 
         // Calculate reduced dipole moment for polar correction term:
         doublereal mu_ri = 52.46*100000*m_dipole(i,i)*m_dipole(i,i)
-            *Pcrit_i(i)/(Tc*Tc);
+            *m_Pcrit[i]/(Tc*Tc);
         if (mu_ri < 0.022) {
             FP_mix_o += molefracs[i];
         } else if (mu_ri < 0.075) {
@@ -319,18 +366,10 @@ doublereal HighPressureGasTransport::viscosity()
                                     *fabs(0.96 + 0.1*(Tr - 0.7)));
         }
 
-        // Calculate contribution to quantum correction term.
-        // SCD Note:  This assumes the species of interest (He, H2, and D2) have
-        //   been named in this specific way.  They are perhaps the most obvious
-        //   names, but it would of course be preferred to have a more general
-        //   approach, here.
-        std::vector<std::string> spnames = m_thermo->speciesNames();
-        if (spnames[i] == "He") {
-            FQ_mix_o += molefracs[i]*FQ_i(1.38,Tr,m_mw[i]);
-        } else if (spnames[i] == "H2") {
-            FQ_mix_o += molefracs[i]*(FQ_i(0.76,Tr,m_mw[i]));
-        } else if (spnames[i] == "D2") {
-            FQ_mix_o += molefracs[i]*(FQ_i(0.52,Tr,m_mw[i]));
+        // Calculate contribution to quantum correction term, using the Q
+        // parameters identified by species name in updateCritProperties():
+        if (m_FQ_param[i] > 0.0) {
+            FQ_mix_o += molefracs[i]*FQ_i(m_FQ_param[i],Tr,m_mw[i]);
         } else {
             FQ_mix_o += molefracs[i];
         }
@@ -393,46 +432,26 @@ doublereal HighPressureGasTransport::viscosity()
 // Pure species critical properties - Tc, Pc, Vc, Zc:
 doublereal HighPressureGasTransport::Tcrit_i(size_t i)
 {
-    // Store current molefracs and set temp molefrac of species i to 1.0:
-    vector_fp molefracs = store(i, m_thermo->nSpecies());
-
-    double tc = m_thermo->critTemperature();
-    // Restore actual molefracs:
-    m_thermo->setMoleFractions(&molefracs[0]);
-    return tc;
+    updateCritProperties();
+    return m_Tcrit[i];
 }
 
 doublereal HighPressureGasTransport::Pcrit_i(size_t i)
 {
-    // Store current molefracs and set temp molefrac of species i to 1.0:
-    vector_fp molefracs = store(i, m_thermo->nSpecies());
-
-    double pc = m_thermo->critPressure();
-    // Restore actual molefracs:
-    m_thermo->setMoleFractions(&molefracs[0]);
-    return pc;
+    updateCritProperties();
+    return m_Pcrit[i];
 }
 
 doublereal HighPressureGasTransport::Vcrit_i(size_t i)
 {
-    // Store current molefracs and set temp molefrac of species i to 1.0:
-    vector_fp molefracs = store(i, m_thermo->nSpecies());
-
-    double vc = m_thermo->critVolume();
-    // Restore actual molefracs:
-    m_thermo->setMoleFractions(&molefracs[0]);
-    return vc;
+    updateCritProperties();
+    return m_Vcrit[i];
 }
 
 doublereal HighPressureGasTransport::Zcrit_i(size_t i)
 {
-    // Store current molefracs and set temp molefrac of species i to 1.0:
-    vector_fp molefracs = store(i, m_thermo->nSpecies());
-
-    double zc = m_thermo->critCompressibility();
-    // Restore actual molefracs:
-    m_thermo->setMoleFractions(&molefracs[0]);
-    return zc;
+    updateCritProperties();
+    return m_Zcrit[i];
 }
 
 vector_fp HighPressureGasTransport::store(size_t i, size_t nsp)
@@ -14,7 +14,8 @@
 namespace Cantera
 {
 IonGasTransport::IonGasTransport() :
-    m_kElectron(npos)
+    m_kElectron(npos),
+    m_invBmobi_temp(Undef)
 {
 }
 
@@ -382,6 +383,20 @@ void IonGasTransport::getMobilities(double* const mobi)
     if (!m_bindiff_ok) {
         updateDiff_T();
     }
+    // refresh the composition-independent reciprocal binary mobilities only
+    // when the cached temperature has changed; for repeated queries at the
+    // same temperature (Jacobian perturbations of the composition) the
+    // remaining work per ion is a single dot product
+    if (m_invBmobi_temp != m_temp) {
+        m_invBmobi.resize(m_kIon.size() * m_kNeutral.size());
+        size_t idx = 0;
+        for (size_t k : m_kIon) {
+            for (size_t j : m_kNeutral) {
+                m_invBmobi[idx++] = m_kbt / (m_bdiff(k,j) * ElectronCharge);
+            }
+        }
+        m_invBmobi_temp = m_temp;
+    }
     double p = m_thermo->pressure();
     for (size_t k = 0; k < m_nsp; k++) {
         if (k == m_kElectron) {
@@ -390,11 +405,11 @@ void IonGasTransport::getMobilities(double* const mobi)
             mobi[k] = 0.0;
         }
     }
+    size_t idx = 0;
     for (size_t k : m_kIon) {
         double sum = 0.0;
         for (size_t j : m_kNeutral) {
-            double bmobi = m_bdiff(k,j) * ElectronCharge / m_kbt;
-            sum += m_molefracs[j] / bmobi;
+            sum += m_molefracs[j] * m_invBmobi[idx++];
         }
         mobi[k] = 1.0 / sum / p;
     }
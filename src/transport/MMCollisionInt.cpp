@@ -21,7 +21,7 @@ double MMCollisionInt::delta[8] = {0.0, 0.25, 0.50, 0.75, 1.0,
                                    1.5, 2.0, 2.5
                                   };
 
-doublereal quadInterp(doublereal x0, doublereal* x, doublereal* y)
+doublereal quadInterp(doublereal x0, const doublereal* x, const doublereal* y)
 {
     double dx21 = x[1] - x[0];
     double dx32 = x[2] - x[1];
@@ -215,6 +215,30 @@ double MMCollisionInt::cstar_table[39*8] = {
     0.94444, 0.94444,0.94444,0.94444,0.94444,0.94444,0.94444,0.94444
 };
 
+MMCollisionInt::DeltaFits::DeltaFits()
+{
+    double e22 = 0.0, ea = 0.0, eb = 0.0, ec = 0.0;
+    for (int i = 0; i < 37; i++) {
+        logTemp[i] = log(tstar[i+1]);
+        e22 = std::max(e22, fitDelta(0, i, DeltaDegree, o22poly[i]));
+        ea = std::max(ea, fitDelta(1, i, DeltaDegree, apoly[i]));
+        eb = std::max(eb, fitDelta(2, i, DeltaDegree, bpoly[i]));
+        ec = std::max(ec, fitDelta(3, i, DeltaDegree, cpoly[i]));
+    }
+    rmserr[0] = e22;
+    rmserr[1] = ea;
+    rmserr[2] = eb;
+    rmserr[3] = ec;
+}
+
+const MMCollisionInt::DeltaFits& MMCollisionInt::deltaFits()
+{
+    // The fits involve only the static tables above, so they are computed
+    // once for the lifetime of the process and shared by all instances.
+    static DeltaFits fits;
+    return fits;
+}
+
 void MMCollisionInt::init(doublereal tsmin, doublereal tsmax, int log_level)
 {
     m_loglevel = log_level;
@@ -238,59 +262,34 @@ void MMCollisionInt::init(doublereal tsmin, doublereal tsmax, int log_level)
         writelogf("T*_min = %g\n", tstar[m_nmin + 1]);
         writelogf("T*_max = %g\n", tstar[m_nmax + 1]);
     }
-    m_logTemp.resize(37);
-    doublereal e22 = 0.0, ea = 0.0, eb = 0.0, ec = 0.0;
 
     if (m_loglevel > 0) {
+        const DeltaFits& fits = deltaFits();
         writelog("Collision integral fits at each tabulated T* vs. delta*.\n"
                  "These polynomial fits are used to interpolate between "
                  "columns (delta*)\n in the Monchick and Mason tables."
                  " They are only used for nonzero delta*.\n");
         if (log_level < 4) {
             writelog("polynomial coefficients not printed (log_level < 4)\n");
+        } else {
+            for (int i = 0; i < 37; i++) {
+                writelogf("\ndelta* fit at T* = %.6g\n", tstar[i+1]);
+                writelog("omega22 = [" + vec2str(vector_fp(fits.o22poly[i],
+                    fits.o22poly[i] + DeltaDegree + 1)) + "]\n");
+                writelog("A* = [" + vec2str(vector_fp(fits.apoly[i],
+                    fits.apoly[i] + DeltaDegree + 1)) + "]\n");
+                writelog("B* = [" + vec2str(vector_fp(fits.bpoly[i],
+                    fits.bpoly[i] + DeltaDegree + 1)) + "]\n");
+                writelog("C* = [" + vec2str(vector_fp(fits.cpoly[i],
+                    fits.cpoly[i] + DeltaDegree + 1)) + "]\n");
+            }
         }
-    }
-
-    for (int i = 0; i < 37; i++) {
-        m_logTemp[i] = log(tstar[i+1]);
-        vector_fp c(DeltaDegree+1);
-
-        double rmserr = fitDelta(0, i, DeltaDegree, c.data());
-        if (log_level > 3) {
-            writelogf("\ndelta* fit at T* = %.6g\n", tstar[i+1]);
-            writelog("omega22 = [" + vec2str(c) + "]\n");
-        }
-        m_o22poly.push_back(c);
-        e22 = std::max(e22, rmserr);
-
-        rmserr = fitDelta(1, i, DeltaDegree, c.data());
-        m_apoly.push_back(c);
-        if (log_level > 3) {
-            writelog("A* = [" + vec2str(c) + "]\n");
-        }
-        ea = std::max(ea, rmserr);
-
-        rmserr = fitDelta(2, i, DeltaDegree, c.data());
-        m_bpoly.push_back(c);
-        if (log_level > 3) {
-            writelog("B* = [" + vec2str(c) + "]\n");
-        }
-        eb = std::max(eb, rmserr);
-
-        rmserr = fitDelta(3, i, DeltaDegree, c.data());
-        m_cpoly.push_back(c);
-        if (log_level > 3) {
-            writelog("C* = [" + vec2str(c) + "]\n");
-        }
-        ec = std::max(ec, rmserr);
-
-        if (log_level > 0) {
-            writelogf("max RMS errors in fits vs. delta*:\n"
-                      "      omega_22 =     %12.6g \n"
-                      "      A*       =     %12.6g \n"
-                      "      B*       =     %12.6g \n"
-                      "      C*       =     %12.6g \n", e22, ea, eb, ec);
-        }
+        writelogf("max RMS errors in fits vs. delta*:\n"
+                  "      omega_22 =     %12.6g \n"
+                  "      A*       =     %12.6g \n"
+                  "      B*       =     %12.6g \n"
+                  "      C*       =     %12.6g \n", fits.rmserr[0],
+                  fits.rmserr[1], fits.rmserr[2], fits.rmserr[3]);
     }
 }
 
@@ -332,15 +331,16 @@ doublereal MMCollisionInt::omega22(double ts, double deltastar)
         i2 = 36;
         i1 = i2 - 3;
     }
-    vector_fp values(3);
+    const DeltaFits& fits = deltaFits();
+    double values[3];
     for (i = i1; i < i2; i++) {
         if (deltastar == 0.0) {
             values[i-i1] = omega22_table[8*i];
         } else {
-            values[i-i1] = poly5(deltastar, m_o22poly[i].data());
+            values[i-i1] = poly5(deltastar, fits.o22poly[i]);
         }
     }
-    return quadInterp(log(ts), &m_logTemp[i1], values.data());
+    return quadInterp(log(ts), &fits.logTemp[i1], values);
 }
 
 doublereal MMCollisionInt::astar(double ts, double deltastar)
@@ -355,15 +355,16 @@ doublereal MMCollisionInt::astar(double ts, double deltastar)
         i2 = 36;
         i1 = i2 - 3;
     }
-    vector_fp values(3);
+    const DeltaFits& fits = deltaFits();
+    double values[3];
     for (i = i1; i < i2; i++) {
         if (deltastar == 0.0) {
             values[i-i1] = astar_table[8*(i + 1)];
         } else {
-            values[i-i1] = poly5(deltastar, m_apoly[i].data());
+            values[i-i1] = poly5(deltastar, fits.apoly[i]);
         }
     }
-    return quadInterp(log(ts), &m_logTemp[i1], values.data());
+    return quadInterp(log(ts), &fits.logTemp[i1], values);
 }
 
 doublereal MMCollisionInt::bstar(double ts, double deltastar)
@@ -378,15 +379,16 @@ doublereal MMCollisionInt::bstar(double ts, double deltastar)
         i2 = 36;
         i1 = i2 - 3;
     }
-    vector_fp values(3);
+    const DeltaFits& fits = deltaFits();
+    double values[3];
     for (i = i1; i < i2; i++) {
         if (deltastar == 0.0) {
             values[i-i1] = bstar_table[8*(i + 1)];
         } else {
-            values[i-i1] = poly5(deltastar, m_bpoly[i].data());
+            values[i-i1] = poly5(deltastar, fits.bpoly[i]);
         }
     }
-    return quadInterp(log(ts), &m_logTemp[i1], values.data());
+    return quadInterp(log(ts), &fits.logTemp[i1], values);
 }
 
 doublereal MMCollisionInt::cstar(double ts, double deltastar)
@@ -401,29 +403,31 @@ doublereal MMCollisionInt::cstar(double ts, double deltastar)
         i2 = 36;
         i1 = i2 - 3;
     }
-    vector_fp values(3);
+    const DeltaFits& fits = deltaFits();
+    double values[3];
     for (i = i1; i < i2; i++) {
         if (deltastar == 0.0) {
             values[i-i1] = cstar_table[8*(i + 1)];
         } else {
-            values[i-i1] = poly5(deltastar, m_cpoly[i].data());
+            values[i-i1] = poly5(deltastar, fits.cpoly[i]);
         }
     }
-    return quadInterp(log(ts), &m_logTemp[i1], values.data());
+    return quadInterp(log(ts), &fits.logTemp[i1], values);
 }
 
 void MMCollisionInt::fit_omega22(int degree, doublereal deltastar,
                                  doublereal* o22)
 {
+    const DeltaFits& fits = deltaFits();
     int n = m_nmax - m_nmin + 1;
     vector_fp values(n);
     vector_fp w(n);
-    doublereal* logT = &m_logTemp[m_nmin];
+    const doublereal* logT = &fits.logTemp[m_nmin];
     for (int i = 0; i < n; i++) {
         if (deltastar == 0.0) {
             values[i] = omega22_table[8*(i + m_nmin)];
         } else {
-            values[i] = poly5(deltastar, m_o22poly[i+m_nmin].data());
+            values[i] = poly5(deltastar, fits.o22poly[i+m_nmin]);
         }
     }
     w[0]= -1.0;
@@ -438,39 +442,30 @@ void MMCollisionInt::fit_omega22(int degree, doublereal deltastar,
 void MMCollisionInt::fit(int degree, doublereal deltastar,
                          doublereal* a, doublereal* b, doublereal* c)
 {
+    const DeltaFits& fits = deltaFits();
     int n = m_nmax - m_nmin + 1;
-    vector_fp values(n);
-    vector_fp w(n);
-    doublereal* logT = &m_logTemp[m_nmin];
+    vector_fp values(3*n);
+    const doublereal* logT = &fits.logTemp[m_nmin];
     for (int i = 0; i < n; i++) {
         if (deltastar == 0.0) {
             values[i] = astar_table[8*(i + m_nmin + 1)];
+            values[n + i] = bstar_table[8*(i + m_nmin + 1)];
+            values[2*n + i] = cstar_table[8*(i + m_nmin + 1)];
         } else {
-            values[i] = poly5(deltastar, m_apoly[i+m_nmin].data());
+            values[i] = poly5(deltastar, fits.apoly[i+m_nmin]);
+            values[n + i] = poly5(deltastar, fits.bpoly[i+m_nmin]);
+            values[2*n + i] = poly5(deltastar, fits.cpoly[i+m_nmin]);
         }
     }
-    w[0]= -1.0;
-    double rmserr = polyfit(n, degree, logT, values.data(), w.data(), a);
 
-    for (int i = 0; i < n; i++) {
-        if (deltastar == 0.0) {
-            values[i] = bstar_table[8*(i + m_nmin + 1)];
-        } else {
-            values[i] = poly5(deltastar, m_bpoly[i+m_nmin].data());
-        }
-    }
-    w[0]= -1.0;
-    rmserr = polyfit(n, degree, logT, values.data(), w.data(), b);
-
-    for (int i = 0; i < n; i++) {
-        if (deltastar == 0.0) {
-            values[i] = cstar_table[8*(i + m_nmin + 1)];
-        } else {
-            values[i] = poly5(deltastar, m_cpoly[i+m_nmin].data());
-        }
-    }
-    w[0]= -1.0;
-    rmserr = polyfit(n, degree, logT, values.data(), w.data(), c);
+    // the three fits share the same abscissas, so the Vandermonde matrix is
+    // assembled and factored only once
+    vector_fp coeffs(3*(degree + 1));
+    double rmserr = polyfitShared(n, degree, 3, logT, values.data(),
+                                  coeffs.data());
+    std::copy(coeffs.begin(), coeffs.begin() + degree + 1, a);
+    std::copy(coeffs.begin() + degree + 1, coeffs.begin() + 2*(degree + 1), b);
+    std::copy(coeffs.begin() + 2*(degree + 1), coeffs.end(), c);
     if (m_loglevel > 2) {
         writelogf("\nT* fit at delta* = %.6g\n", deltastar);
 
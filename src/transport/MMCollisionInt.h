@@ -49,12 +49,27 @@ public:
     }
 
 private:
-    doublereal fitDelta(int table, int ntstar, int degree, doublereal* c);
+    static doublereal fitDelta(int table, int ntstar, int degree, doublereal* c);
 
-    std::vector<vector_fp> m_o22poly;
-    std::vector<vector_fp> m_apoly;
-    std::vector<vector_fp> m_bpoly;
-    std::vector<vector_fp> m_cpoly;
+    //! Fit coefficients interpolating each table row in the delta* direction.
+    /*!
+     * The fits depend only on the static Monchick and Mason tables, so they
+     * are computed once per process and shared by all MMCollisionInt
+     * instances, rather than being regenerated each time a transport manager
+     * is set up.
+     */
+    struct DeltaFits {
+        DeltaFits();
+        double o22poly[37][7];
+        double apoly[37][7];
+        double bpoly[37][7];
+        double cpoly[37][7];
+        double logTemp[37]; //!< log(tstar) at each interior table row
+        double rmserr[4]; //!< max RMS fit errors for omega22, A*, B*, C*
+    };
+
+    //! Return the shared delta* fit coefficients, computing them on first use
+    static const DeltaFits& deltaFits();
 
     static doublereal delta[8];
     static doublereal tstar22[37];
@@ -74,9 +89,6 @@ private:
     //! cstar table from MM
     static doublereal cstar_table[39*8];
 
-    //! Log temp
-    vector_fp m_logTemp;
-
     int m_nmin;
     int m_nmax;
 
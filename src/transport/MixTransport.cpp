@@ -107,15 +107,23 @@ void MixTransport::update_T()
 
 void MixTransport::update_C()
 {
+    // The quantities invalidated here depend on the composition but not on
+    // the temperature, so there is nothing to do unless the composition has
+    // changed since the last call.
+    if (m_mf_stateNum == m_thermo->stateMFNumber()) {
+        return;
+    }
+    m_mf_stateNum = m_thermo->stateMFNumber();
+
     // signal that concentration-dependent quantities will need to be recomputed
     // before use, and update the local mole fractions.
     m_visc_ok = false;
     m_condmix_ok = false;
-    m_thermo->getMoleFractions(m_molefracs.data());
+    const vector_fp& x = m_thermo->moleFractions();
 
     // add an offset to avoid a pure species condition
     for (size_t k = 0; k < m_nsp; k++) {
-        m_molefracs[k] = std::max(Tiny, m_molefracs[k]);
+        m_molefracs[k] = std::max(Tiny, x[k]);
     }
 }
 
@@ -10,6 +10,7 @@
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/utilities.h"
+#include "cantera/numerics/eigen_dense.h"
 
 using namespace std;
 
@@ -34,8 +35,30 @@ doublereal Frot(doublereal tr, doublereal sqtr)
 
 //////////////////// class MultiTransport methods //////////////
 
+//! LU factorization of the L matrix retained between calls to
+//! solveLMatrixEquation(). Kept behind an opaque pointer so that the Eigen
+//! types do not appear in MultiTransport.h.
+struct MultiTransport::LFactorization
+{
+    LFactorization() : valid(false) {}
+
+    //! Factorization of the L matrix from a previous state, used as the
+    //! preconditioner for iterative refinement
+    Eigen::PartialPivLU<Eigen::MatrixXd> lu;
+
+    //! True once a factorization has been stored
+    bool valid;
+};
+
 MultiTransport::MultiTransport(ThermoPhase* thermo)
     : GasTransport(thermo)
+    , m_iterative_solve(false)
+    , m_gridPoint(npos)
+    , m_soret_rtol(0.0)
+{
+}
+
+MultiTransport::~MultiTransport()
 {
 }
 
@@ -56,6 +79,10 @@ void MultiTransport::init(ThermoPhase* thermo, int mode, int log_level)
     m_astar.resize(m_nsp, m_nsp);
     m_bstar.resize(m_nsp, m_nsp);
     m_cstar.resize(m_nsp, m_nsp);
+    m_invbdiff.resize(m_nsp, m_nsp);
+    m_fac0010.resize(m_nsp, m_nsp);
+    m_fac1010.resize(m_nsp, m_nsp);
+    m_Lfact.reset(new LFactorization());
 
     // set flags all false
     m_abc_ok = false;
@@ -121,6 +148,24 @@ void MultiTransport::solveLMatrixEquation()
         return;
     }
 
+    GridPointCache* cache = 0;
+    if (m_gridPoint != npos) {
+        cache = &m_pointCache[m_gridPoint];
+        if (m_soret_rtol > 0.0 && cache->a.size() == 3*m_nsp
+            && fabs(m_temp - cache->temp) <= m_soret_rtol * cache->temp) {
+            doublereal dx = 0.0;
+            for (size_t k = 0; k < m_nsp; k++) {
+                dx = std::max(dx, fabs(m_molefracs[k] - cache->molefracs[k]));
+            }
+            if (dx <= m_soret_rtol) {
+                // The state at this point has not moved appreciably since it
+                // was last solved; reuse the stored solution.
+                m_a = cache->a;
+                return;
+            }
+        }
+    }
+
     // Copy the mole fractions twice into the last two blocks of the right-hand-
     // side vector m_b. The first block of m_b was set to zero when it was
     // created, and is not modified so doesn't need to be reset to zero.
@@ -159,10 +204,50 @@ void MultiTransport::solveLMatrixEquation()
     eval_L0110();
     eval_L0101(m_molefracs.data());
 
-    // Solve it using GMRES or LU decomposition. The last solution in m_a should
-    // provide a good starting guess, so convergence should be fast.
-    m_a = m_b;
-    solve(m_Lmatrix, m_a.data());
+    if (cache && cache->a.size() == 3*m_nsp) {
+        // Warm-start from the solution computed at this grid point on the
+        // previous visit, which is usually closer than the solution carried
+        // over from a neighboring point.
+        m_a = cache->a;
+    }
+
+    if (m_iterative_solve) {
+        // Since the L matrix varies slowly along a solution profile, the
+        // factorization from a previous state remains an effective
+        // preconditioner. Refine the previous solution with it, and only
+        // refactor when the refinement stalls.
+        size_t n = 3*m_nsp;
+        Eigen::Map<Eigen::MatrixXd> L(m_Lmatrix.ptrColumn(0), n, n);
+        Eigen::Map<Eigen::VectorXd> b(m_b.data(), n);
+        Eigen::Map<Eigen::VectorXd> a(m_a.data(), n);
+        bool converged = false;
+        if (m_Lfact->valid) {
+            double btol = 1e-12 * b.lpNorm<Eigen::Infinity>() + Tiny;
+            for (int it = 0; it < 5; it++) {
+                Eigen::VectorXd r = b - L * a;
+                if (r.lpNorm<Eigen::Infinity>() <= btol) {
+                    converged = true;
+                    break;
+                }
+                a += m_Lfact->lu.solve(r);
+            }
+        }
+        if (!converged) {
+            m_Lfact->lu.compute(L);
+            a = m_Lfact->lu.solve(b);
+            m_Lfact->valid = true;
+        }
+    } else {
+        // Solve it using GMRES or LU decomposition. The last solution in m_a
+        // should provide a good starting guess, so convergence should be fast.
+        m_a = m_b;
+        solve(m_Lmatrix, m_a.data());
+    }
+    if (cache) {
+        cache->temp = m_temp;
+        cache->molefracs = m_molefracs;
+        cache->a = m_a;
+    }
     m_lmatrix_soln_ok = true;
     m_molefracs_last = m_molefracs;
     // L matrix is overwritten with LU decomposition
@@ -406,12 +491,20 @@ void MultiTransport::update_T()
 
 void MultiTransport::update_C()
 {
+    // The quantities invalidated here depend on the composition but not on
+    // the temperature, so there is nothing to do unless the composition has
+    // changed since the last call.
+    if (m_mf_stateNum == m_thermo->stateMFNumber()) {
+        return;
+    }
+    m_mf_stateNum = m_thermo->stateMFNumber();
+
     // Update the local mole fraction array
-    m_thermo->getMoleFractions(m_molefracs.data());
+    const vector_fp& x = m_thermo->moleFractions();
 
     for (size_t k = 0; k < m_nsp; k++) {
         // add an offset to avoid a pure species condition
-        m_molefracs[k] = std::max(Tiny, m_molefracs[k]);
+        m_molefracs[k] = std::max(Tiny, x[k]);
         if (m_molefracs[k] != m_molefracs_last[k]) {
             // If any mole fractions have changed, signal that concentration-
             // dependent quantities will need to be recomputed before use.
@@ -480,6 +573,19 @@ void MultiTransport::updateThermal_T()
     for (size_t k = 0; k < m_nsp; k++) {
         m_cinternal[k] = cp[k] - 2.5;
     }
+
+    // Precompute the composition-independent pair tables used by the eval_L
+    // kernels, so that the inner loops of the L-matrix assembly contain only
+    // multiplications and additions.
+    for (size_t i = 0; i < m_nsp; i++) {
+        for (size_t j = 0; j < m_nsp; j++) {
+            double sumwij = m_mw[i] + m_mw[j];
+            m_invbdiff(i,j) = 1.0 / m_bdiff(i,j);
+            m_fac0010(i,j) = m_mw[i] * (1.2 * m_cstar(j,i) - 1.0) /
+                             (sumwij * m_bdiff(j,i));
+            m_fac1010(i,j) = 1.0 / (m_bdiff(i,j) * sumwij * sumwij);
+        }
+    }
     m_thermal_tlast = m_thermo->temperature();
 }
 
@@ -498,15 +604,15 @@ void MultiTransport::eval_L0000(const doublereal* const x)
     for (size_t i = 0; i < m_nsp; i++) {
         // subtract-off the k=i term to account for the first delta
         // function in Eq. (12.121)
-        sum = -x[i]/m_bdiff(i,i);
+        sum = -x[i]*m_invbdiff(i,i);
         for (size_t k = 0; k < m_nsp; k++) {
-            sum += x[k]/m_bdiff(i,k);
+            sum += x[k]*m_invbdiff(i,k);
         }
 
         sum /= m_mw[i];
         for (size_t j = 0; j != m_nsp; ++j) {
             m_Lmatrix(i,j) = prefactor * x[j]
-                             * (m_mw[j] * sum + x[i]/m_bdiff(i,j));
+                             * (m_mw[j] * sum + x[i]*m_invbdiff(i,j));
         }
         // diagonal term is zero
         m_Lmatrix(i,i) = 0.0;
@@ -518,12 +624,9 @@ void MultiTransport::eval_L0010(const doublereal* const x)
     doublereal prefactor = 1.6*m_temp;
     for (size_t j = 0; j < m_nsp; j++) {
         double xj = x[j];
-        double wj = m_mw[j];
         double sum = 0.0;
         for (size_t i = 0; i < m_nsp; i++) {
-            m_Lmatrix(i,j + m_nsp) = - prefactor * x[i] * xj * m_mw[i] *
-                                     (1.2 * m_cstar(j,i) - 1.0) /
-                                     ((wj + m_mw[i]) * m_bdiff(j,i));
+            m_Lmatrix(i,j + m_nsp) = - prefactor * x[i] * xj * m_fac0010(i,j);
 
             // the next term is independent of "j";
             // need to do it for the "j,j" term
@@ -558,16 +661,15 @@ void MultiTransport::eval_L1010(const doublereal* x)
         double threemjsq = 3.0*m_mw[j]*m_mw[j];
         double sum = 0.0;
         for (size_t i = 0; i < m_nsp; i++) {
-            double sumwij = m_mw[i] + m_mw[j];
-            double term1 = m_bdiff(i,j) * sumwij*sumwij;
+            double term1 = m_fac1010(i,j);
             double term2 = fourmj*m_astar(i,j)*(1.0 + fiveover3pi*
                 (constant3 + (m_crot[i]/m_rotrelax[i]))); //  see Eq. (12.125)
 
-            m_Lmatrix(i+m_nsp,j+m_nsp) = constant1*x[i]*m_mw[i] /(m_mw[j]*term1) *
+            m_Lmatrix(i+m_nsp,j+m_nsp) = constant1*x[i]*m_mw[i]*term1/m_mw[j] *
                                          (constant2 - threemjsq*m_bstar(i,j)
                                           - term2*m_mw[j]);
 
-            sum += x[i] /(term1) *
+            sum += x[i] * term1 *
                    (constant4 + m_mw[i]*m_mw[i]*
                     (6.25 - 3.0*m_bstar(i,j)) + term2*m_mw[i]);
         }
@@ -586,8 +688,8 @@ void MultiTransport::eval_L1001(const doublereal* x)
             double sum = 0.0;
             for (size_t i = 0; i < m_nsp; i++) {
                 // see Eq. (12.127)
-                m_Lmatrix(i+m_nsp,j+2*m_nsp) = constant * m_astar(j,i) * x[i] /
-                                          ((m_mw[j] + m_mw[i]) * m_bdiff(j,i));
+                m_Lmatrix(i+m_nsp,j+2*m_nsp) = constant * m_astar(j,i) * x[i] *
+                                          m_invbdiff(j,i) / (m_mw[j] + m_mw[i]);
                 sum += m_Lmatrix(i+m_nsp,j+2*m_nsp);
             }
             m_Lmatrix(j+m_nsp,j+2*m_nsp) += sum;
@@ -637,11 +739,11 @@ void MultiTransport::eval_L0101(const doublereal* x)
             double sum = 0.0;
             for (size_t k = 0; k < m_nsp; k++) {
                 // see Eq. (12.131)
-                double diff_int = m_bdiff(i,k);
+                double inv_diff_int = m_invbdiff(i,k);
                 m_Lmatrix(k+2*m_nsp,i+2*m_nsp) = 0.0;
-                sum += x[k]/diff_int;
+                sum += x[k]*inv_diff_int;
                 if (k != i) {
-                    sum += x[k]*m_astar(i,k)*constant2 / (m_mw[k]*diff_int);
+                    sum += x[k]*m_astar(i,k)*constant2*inv_diff_int / m_mw[k];
                 }
             }
             // see Eq. (12.130)
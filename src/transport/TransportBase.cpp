@@ -63,6 +63,13 @@ AnyMap Transport::parameters() const
     return out;
 }
 
+AnyMap Transport::memoryReport() const
+{
+    AnyMap report;
+    report["type"] = transportType();
+    return report;
+}
+
 void Transport::setThermo(ThermoPhase& thermo)
 {
     if (!ready()) {
@@ -84,12 +84,11 @@ Transport* TransportFactory::newTransport(const std::string& transportModel,
 Transport* TransportFactory::newTransport(ThermoPhase* phase, int log_level)
 {
     std::string transportModel = "None";
-    XML_Node& phaseNode = phase->xml();
     AnyMap& input = phase->input();
     if (input.hasKey("transport")) {
         transportModel = input["transport"].asString();
-    } else if (phaseNode.hasChild("transport")) {
-        transportModel = phaseNode.child("transport").attrib("model");
+    } else if (phase->hasXMLdata() && phase->xml().hasChild("transport")) {
+        transportModel = phase->xml().child("transport").attrib("model");
     }
     return newTransport(transportModel, phase,log_level);
 }
@@ -17,6 +17,26 @@ const double rhoStar = 317.763; // kg / m3
 const double presStar = 22.115E6; // Pa
 const double muStar = 55.071E-6; //Pa s
 
+//! The near-critical region, where the critical enhancements of the
+//! transport properties vary too sharply for the property tables built by
+//! WaterTransport::setupPropertyTable(); interpolated values are rejected
+//! here in favor of the full correlations. The bounds are those of the
+//! viscosity critical correction of Sengers & Watson.
+bool nearCritical(double tbar, double rhobar)
+{
+    return tbar >= 0.9970 && tbar <= 1.0082
+        && rhobar >= 0.755 && rhobar <= 1.290;
+}
+
+//! Catmull-Rom cubic through four equally spaced points, evaluated at
+//! x in [0,1] between p[1] and p[2]
+double interp_cubic(const double p[4], double x)
+{
+    return p[1] + 0.5 * x * (p[2] - p[0]
+        + x * (2.0 * p[0] - 5.0 * p[1] + 4.0 * p[2] - p[3]
+        + x * (3.0 * (p[1] - p[2]) + p[3] - p[0])));
+}
+
 const double H[4] = {1., 0.978197, 0.579829, -0.202354};
 const double Hij[6][7] = {
     { 0.5132047, 0.2151778, -0.2818107,  0.1778064, -0.04176610,          0.,           0.},
@@ -33,7 +53,13 @@ namespace Cantera
 {
 
 WaterTransport::WaterTransport(ThermoPhase* thermo, int ndim) :
-    Transport(thermo, ndim)
+    Transport(thermo, ndim),
+    m_nTab_T(0),
+    m_nTab_rho(0),
+    m_tabTmin(0.0),
+    m_tabTmax(0.0),
+    m_tabRhoMin(0.0),
+    m_tabRhoMax(0.0)
 {
     if (thermo) {
         init(thermo);
@@ -46,6 +72,18 @@ void WaterTransport::init(ThermoPhase* thermo, int mode, int log_level)
 }
 
 double WaterTransport::viscosity()
+{
+    if (!m_viscTable.empty()) {
+        double visc = tablePropertyValue(m_viscTable, m_thermo->temperature(),
+                                         m_thermo->density());
+        if (visc > 0.0) {
+            return visc;
+        }
+    }
+    return viscosityCorrelation();
+}
+
+double WaterTransport::viscosityCorrelation()
 {
     static const double TStar = 647.27; // Kelvin
     double temp = m_thermo->temperature();
@@ -94,6 +132,18 @@ double WaterTransport::viscosity()
 }
 
 double WaterTransport::thermalConductivity()
+{
+    if (!m_condTable.empty()) {
+        double cond = tablePropertyValue(m_condTable, m_thermo->temperature(),
+                                         m_thermo->density());
+        if (cond > 0.0) {
+            return cond;
+        }
+    }
+    return thermalConductivityCorrelation();
+}
+
+double WaterTransport::thermalConductivityCorrelation()
 {
     static const double lambdastar = 0.4945;
     static const double L[4] = {
@@ -163,4 +213,83 @@ double WaterTransport::thermalConductivity()
     return (lambda0bar * lambda1bar + lambda2bar) * lambdastar;
 }
 
+void WaterTransport::setupPropertyTable(doublereal Tmin, doublereal Tmax,
+                                        doublereal rhoMin, doublereal rhoMax,
+                                        size_t nT, size_t nRho)
+{
+    if (nT < 4 || nRho < 4 || Tmin <= 0.0 || Tmax <= Tmin
+        || rhoMin <= 0.0 || rhoMax <= rhoMin) {
+        throw CanteraError("WaterTransport::setupPropertyTable",
+                           "invalid table specification");
+    }
+    // remember the incoming state so it can be restored after the grid fill
+    double T_save = m_thermo->temperature();
+    double rho_save = m_thermo->density();
+
+    m_nTab_T = nT;
+    m_nTab_rho = nRho;
+    m_tabTmin = Tmin;
+    m_tabTmax = Tmax;
+    m_tabRhoMin = rhoMin;
+    m_tabRhoMax = rhoMax;
+    m_viscTable.assign(nT * nRho, -1.0);
+    m_condTable.assign(nT * nRho, -1.0);
+    for (size_t i = 0; i < nT; i++) {
+        double T = Tmin + (Tmax - Tmin) * i / (nT - 1);
+        for (size_t j = 0; j < nRho; j++) {
+            double rho = rhoMin + (rhoMax - rhoMin) * j / (nRho - 1);
+            m_thermo->setState_TR(T, rho);
+            m_viscTable[i * nRho + j] = viscosityCorrelation();
+            m_condTable[i * nRho + j] = thermalConductivityCorrelation();
+        }
+    }
+    m_thermo->setState_TR(T_save, rho_save);
+}
+
+void WaterTransport::clearPropertyTable()
+{
+    m_viscTable.clear();
+    m_condTable.clear();
+    m_nTab_T = 0;
+    m_nTab_rho = 0;
+}
+
+doublereal WaterTransport::tablePropertyValue(const vector_fp& table,
+                                              doublereal temperature,
+                                              doublereal dens) const
+{
+    if (table.empty() || temperature < m_tabTmin || temperature > m_tabTmax
+        || dens < m_tabRhoMin || dens > m_tabRhoMax
+        || nearCritical(temperature / Tstar, dens / rhoStar)) {
+        return -1.0;
+    }
+    doublereal ft = (temperature - m_tabTmin) / (m_tabTmax - m_tabTmin)
+                    * (m_nTab_T - 1);
+    doublereal fr = (dens - m_tabRhoMin) / (m_tabRhoMax - m_tabRhoMin)
+                    * (m_nTab_rho - 1);
+    size_t i = std::min((size_t) ft, m_nTab_T - 2);
+    size_t j = std::min((size_t) fr, m_nTab_rho - 2);
+    doublereal xt = ft - i;
+    doublereal xr = fr - j;
+
+    // interpolate the 4x4 stencil around the cell, clamping at the edges
+    doublereal rows[4];
+    for (long di = -1; di <= 2; di++) {
+        long ii = std::min(std::max((long) i + di, (long) 0),
+                           (long) m_nTab_T - 1);
+        doublereal vals[4];
+        for (long dj = -1; dj <= 2; dj++) {
+            long jj = std::min(std::max((long) j + dj, (long) 0),
+                               (long) m_nTab_rho - 1);
+            doublereal v = table[ii * m_nTab_rho + jj];
+            if (v <= 0.0) {
+                return -1.0;
+            }
+            vals[dj + 1] = v;
+        }
+        rows[di + 1] = interp_cubic(vals, xr);
+    }
+    return interp_cubic(rows, xt);
+}
+
 }
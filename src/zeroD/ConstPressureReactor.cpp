@@ -119,6 +119,13 @@ void ConstPressureReactor::evalEqs(doublereal time, doublereal* y,
     resetSensitivity(params);
 }
 
+void ConstPressureReactor::addSensParamDerivs(double* const* dfdp, size_t offset)
+{
+    // State is [mass, enthalpy, Y_1, ..., Y_K]; the enthalpy equation has no
+    // direct dependence on the production rates
+    addSpeciesSensDerivs(dfdp, offset, 2);
+}
+
 size_t ConstPressureReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
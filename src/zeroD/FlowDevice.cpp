@@ -49,11 +49,17 @@ bool FlowDevice::install(ReactorBase& in, ReactorBase& out)
 void FlowDevice::setPressureFunction(Func1* f)
 {
     m_pfunc = f;
+    if (f) {
+        m_pprog.compile(*f);
+    }
 }
 
 void FlowDevice::setTimeFunction(Func1* g)
 {
     m_tfunc = g;
+    if (g) {
+        m_tprog.compile(*g);
+    }
 }
 
 double FlowDevice::outletSpeciesMassFlowRate(size_t k)
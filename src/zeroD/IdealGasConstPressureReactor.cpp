@@ -8,6 +8,8 @@
 #include "cantera/zeroD/ReactorNet.h"
 #include "cantera/kinetics/Kinetics.h"
 #include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/Array.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 using namespace std;
 
@@ -129,6 +131,133 @@ void IdealGasConstPressureReactor::evalEqs(doublereal time, doublereal* y,
     resetSensitivity(params);
 }
 
+bool IdealGasConstPressureReactor::jacEqsSupported() const
+{
+    // Surface chemistry couples the coverage equations to the gas state in
+    // ways the analytic assembly does not cover
+    return m_thermo && m_surfaces.empty()
+        && (!m_chem || (m_kin && m_kin->netProductionRateDerivativesImplemented()));
+}
+
+void IdealGasConstPressureReactor::evalJacEqs(doublereal t, doublereal* y,
+                                              doublereal* ydot,
+                                              doublereal* params, Array2D& jac)
+{
+    // State layout: [0] mass, [1] temperature, [2...] mass fractions. The
+    // mass row is zero, since the flow rates are treated as externally
+    // imposed.
+    applySensitivity(params);
+    m_thermo->restoreState(m_state);
+    const vector_fp& mw = m_thermo->molecularWeights();
+    const doublereal* Y = m_thermo->massFractions();
+    double T = m_thermo->temperature();
+    double rho = m_thermo->density();
+    // sigma = sum_k Y_k / W_k, so that rho = p / (R T sigma)
+    double sigma = 1.0 / m_thermo->meanMolecularWeight();
+    m_thermo->getPartialMolarEnthalpies(&m_hk[0]);
+
+    vector_fp conc(m_nsp), cpk(m_nsp), dwdT(m_nsp, 0.0);
+    m_thermo->getConcentrations(conc.data());
+    m_thermo->getPartialMolarCp(cpk.data());
+
+    vector_fp S(m_nsp, 0.0); // S_n = sum_j dwdot_n/dc_j * c_j
+    vector_fp Hcol(m_nsp, 0.0); // Hcol_j = sum_n h_n * dwdot_n/dc_j
+    if (m_chem) {
+        SparseRowMatrix dwdC;
+        m_kin->getNetProductionRateDerivatives(dwdC, dwdT.data());
+        m_kin->getNetProductionRates(&m_wdot[0]);
+        for (int n = 0; n < dwdC.outerSize(); n++) {
+            for (SparseRowMatrix::InnerIterator it(dwdC, n); it; ++it) {
+                size_t j = it.col();
+                double v = it.value();
+                jac(2 + n, 2 + j) += v * mw[n] / mw[j];
+                S[n] += v * conc[j];
+                Hcol[j] += m_hk[n] * v;
+            }
+        }
+        for (size_t n = 0; n < m_nsp; n++) {
+            // at constant pressure the density varies with composition and
+            // temperature, so every concentration responds to a mass
+            // fraction or temperature perturbation
+            double a = mw[n] * (m_wdot[n] - S[n]) / (rho * sigma);
+            for (size_t j = 0; j < m_nsp; j++) {
+                jac(2 + n, 2 + j) += a / mw[j];
+            }
+            jac(2 + n, 1) += mw[n] / rho
+                             * (dwdT[n] + (m_wdot[n] - S[n]) / T);
+        }
+    }
+
+    // dilution of the species equations by inlet flows
+    double mdot_in = 0.0;
+    for (auto inlet : m_inlet) {
+        double mdot = inlet->massFlowRate();
+        mdot_in += mdot;
+        for (size_t n = 0; n < m_nsp; n++) {
+            double mdot_spec = inlet->outletSpeciesMassFlowRate(n);
+            jac(2 + n, 0) -= (mdot_spec - mdot * Y[n]) / (m_mass * m_mass);
+        }
+    }
+    for (size_t n = 0; n < m_nsp; n++) {
+        jac(2 + n, 2 + n) -= mdot_in / m_mass;
+    }
+
+    if (m_energy) {
+        // dT/dt = N / D with N the energy source terms and D = m * cp;
+        // d(cp)/dT is neglected in the quotient rule
+        double cp = m_thermo->cp_mass();
+        double D = m_mass * cp;
+        double fT = ydot[1];
+        double E = 0.0; // sum_n h_n * S_n
+        double H = 0.0; // sum_n h_n * wdot_n
+        double cpwdot = 0.0;
+        double hdwdT = 0.0;
+        for (size_t n = 0; n < m_nsp; n++) {
+            E += m_hk[n] * S[n];
+            H += m_hk[n] * m_wdot[n];
+            cpwdot += cpk[n] * m_wdot[n];
+            hdwdT += m_hk[n] * dwdT[n];
+        }
+        double dNdT = -m_vol * (hdwdT - E / T) - m_vol * H / T
+                      - m_vol * cpwdot;
+        for (auto inlet : m_inlet) {
+            for (size_t n = 0; n < m_nsp; n++) {
+                dNdT -= cpk[n] / mw[n] * inlet->outletSpeciesMassFlowRate(n);
+            }
+        }
+        jac(1, 1) = dNdT / D;
+        jac(1, 0) = (-H / rho - fT * cp) / D;
+        for (size_t i = 0; i < m_nsp; i++) {
+            double dNdY = -m_mass * Hcol[i] / mw[i]
+                          + m_vol * (E - H) / (sigma * mw[i]);
+            double dDdY = m_mass * cpk[i] / mw[i];
+            jac(1, 2 + i) = (dNdY - fT * dDdY) / D;
+        }
+    }
+
+    resetSensitivity(params);
+}
+
+void IdealGasConstPressureReactor::addSensParamDerivs(double* const* dfdp, size_t offset)
+{
+    addSpeciesSensDerivs(dfdp, offset, 2);
+    if (m_sensParams.empty() || !m_chem || !m_energy) {
+        return;
+    }
+    // Perturbing a reaction rate also perturbs the temperature equation
+    // through the chemical source term -sum(wdot*h)*V
+    m_thermo->restoreState(m_state);
+    m_thermo->getPartialMolarEnthalpies(&m_hk[0]);
+    double mcp = m_mass * m_thermo->cp_mass();
+    for (auto& p : m_sensParams) {
+        double rop = m_ropnet[p.local];
+        double* g = dfdp[p.global] + offset;
+        for (auto& kv : stoichRow(p.local)) {
+            g[1] -= kv.second * rop * m_vol * m_hk[kv.first] / mcp;
+        }
+    }
+}
+
 size_t IdealGasConstPressureReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
@@ -8,6 +8,8 @@
 #include "cantera/zeroD/Wall.h"
 #include "cantera/kinetics/Kinetics.h"
 #include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/Array.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 using namespace std;
 
@@ -64,8 +66,9 @@ void IdealGasReactor::updateState(doublereal* y)
     // and [K+3...] are the coverages of surface species on each wall.
     m_mass = y[0];
     m_vol = y[1];
-    m_thermo->setMassFractions_NoNorm(y+3);
-    m_thermo->setState_TR(y[2], m_mass / m_vol);
+    // trusted fast path: the state vector was produced by getState() and
+    // the integrator, so skip normalization and bounds checks
+    m_thermo->setState_TRY_raw(y[2], m_mass / m_vol, y+3);
     updateSurfaceState(y + m_nsp + 3);
     updateConnected(true);
 }
@@ -138,6 +141,139 @@ void IdealGasReactor::evalEqs(doublereal time, doublereal* y,
     resetSensitivity(params);
 }
 
+bool IdealGasReactor::jacEqsSupported() const
+{
+    // Surface chemistry couples the coverage equations to the gas state in
+    // ways the analytic assembly does not cover
+    return m_thermo && m_surfaces.empty()
+        && (!m_chem || (m_kin && m_kin->netProductionRateDerivativesImplemented()));
+}
+
+void IdealGasReactor::evalJacEqs(doublereal t, doublereal* y, doublereal* ydot,
+                                 doublereal* params, Array2D& jac)
+{
+    // State layout: [0] mass, [1] volume, [2] temperature, [3...] mass
+    // fractions. The mass and volume rows are zero, since the flow rates and
+    // the wall velocity are treated as externally imposed.
+    evalWalls(t);
+    applySensitivity(params);
+    m_thermo->restoreState(m_state);
+    const vector_fp& mw = m_thermo->molecularWeights();
+    const doublereal* Y = m_thermo->massFractions();
+    double T = m_thermo->temperature();
+    m_thermo->getPartialMolarIntEnergies(&m_uk[0]);
+
+    vector_fp conc(m_nsp), cvk(m_nsp), dwdT(m_nsp, 0.0);
+    m_thermo->getConcentrations(conc.data());
+    m_thermo->getPartialMolarCp(cvk.data());
+    for (size_t k = 0; k < m_nsp; k++) {
+        cvk[k] -= GasConstant; // molar heat capacity cv of an ideal gas
+    }
+
+    vector_fp S(m_nsp, 0.0); // S_n = sum_j dwdot_n/dc_j * c_j
+    vector_fp Ucol(m_nsp, 0.0); // Ucol_j = sum_n u_n * dwdot_n/dc_j
+    if (m_chem) {
+        SparseRowMatrix dwdC;
+        m_kin->getNetProductionRateDerivatives(dwdC, dwdT.data());
+        m_kin->getNetProductionRates(&m_wdot[0]);
+        // at constant mass and volume, c_j = (m/V) Y_j / W_j, so a mass
+        // fraction perturbation changes only its own concentration
+        for (int n = 0; n < dwdC.outerSize(); n++) {
+            for (SparseRowMatrix::InnerIterator it(dwdC, n); it; ++it) {
+                size_t j = it.col();
+                double v = it.value();
+                jac(3 + n, 3 + j) += v * mw[n] / mw[j];
+                S[n] += v * conc[j];
+                Ucol[j] += m_uk[n] * v;
+            }
+        }
+        for (size_t n = 0; n < m_nsp; n++) {
+            jac(3 + n, 2) += dwdT[n] * m_vol * mw[n] / m_mass;
+            jac(3 + n, 0) += m_vol * mw[n] * (S[n] - m_wdot[n])
+                             / (m_mass * m_mass);
+            jac(3 + n, 1) += mw[n] * (m_wdot[n] - S[n]) / m_mass;
+        }
+    }
+
+    // dilution of the species equations by inlet flows
+    double mdot_in = 0.0;
+    double mdot_out = 0.0;
+    for (auto outlet : m_outlet) {
+        mdot_out += outlet->massFlowRate();
+    }
+    for (auto inlet : m_inlet) {
+        double mdot = inlet->massFlowRate();
+        mdot_in += mdot;
+        for (size_t n = 0; n < m_nsp; n++) {
+            double mdot_spec = inlet->outletSpeciesMassFlowRate(n);
+            jac(3 + n, 0) -= (mdot_spec - mdot * Y[n]) / (m_mass * m_mass);
+        }
+    }
+    for (size_t n = 0; n < m_nsp; n++) {
+        jac(3 + n, 3 + n) -= mdot_in / m_mass;
+    }
+
+    if (m_energy) {
+        // dT/dt = N / D with N the energy source terms and D = m * cv;
+        // d(cv)/dT is neglected in the quotient rule
+        double cv = m_thermo->cv_mass();
+        double D = m_mass * cv;
+        double fT = ydot[2];
+        double E = 0.0; // sum_n u_n * S_n
+        double Hu = 0.0; // sum_n u_n * wdot_n
+        double cvwdot = 0.0;
+        double udwdT = 0.0;
+        for (size_t n = 0; n < m_nsp; n++) {
+            E += m_uk[n] * S[n];
+            Hu += m_uk[n] * m_wdot[n];
+            cvwdot += cvk[n] * m_wdot[n];
+            udwdT += m_uk[n] * dwdT[n];
+        }
+        // compression work and outlet flow work enter through the ideal gas
+        // pressure, p = (m/V) R T sum_k Y_k / W_k
+        double dNdT = -m_vdot * m_pressure / T - m_vol * (udwdT + cvwdot)
+                      - mdot_out * m_pressure * m_vol / (m_mass * T);
+        for (auto inlet : m_inlet) {
+            for (size_t n = 0; n < m_nsp; n++) {
+                dNdT -= cvk[n] / mw[n] * inlet->outletSpeciesMassFlowRate(n);
+            }
+        }
+        jac(2, 2) = dNdT / D;
+        jac(2, 0) = (-m_vol * E / m_mass - m_vdot * m_pressure / m_mass
+                     - fT * cv) / D;
+        jac(2, 1) = (E - Hu + m_vdot * m_pressure / m_vol) / D;
+        for (size_t i = 0; i < m_nsp; i++) {
+            double dNdY = -m_mass * Ucol[i] / mw[i]
+                          - m_vdot * m_mass * GasConstant * T / (m_vol * mw[i])
+                          - mdot_out * GasConstant * T / mw[i];
+            double dDdY = m_mass * cvk[i] / mw[i];
+            jac(2, 3 + i) = (dNdY - fT * dDdY) / D;
+        }
+    }
+
+    resetSensitivity(params);
+}
+
+void IdealGasReactor::addSensParamDerivs(double* const* dfdp, size_t offset)
+{
+    Reactor::addSensParamDerivs(dfdp, offset);
+    if (m_sensParams.empty() || !m_chem || !m_energy) {
+        return;
+    }
+    // Perturbing a reaction rate also perturbs the temperature equation
+    // through the chemical source term -sum(wdot*u)*V
+    m_thermo->restoreState(m_state);
+    m_thermo->getPartialMolarIntEnergies(&m_uk[0]);
+    double mcv = m_mass * m_thermo->cv_mass();
+    for (auto& p : m_sensParams) {
+        double rop = m_ropnet[p.local];
+        double* g = dfdp[p.global] + offset;
+        for (auto& kv : stoichRow(p.local)) {
+            g[2] -= kv.second * rop * m_vol * m_uk[kv.first] / mcv;
+        }
+    }
+}
+
 size_t IdealGasReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
@@ -0,0 +1,83 @@
+//! @file PartitionedReactorNet.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/PartitionedReactorNet.h"
+
+namespace Cantera
+{
+
+PartitionedReactorNet::PartitionedReactorNet() :
+    m_time(0.0),
+    m_dtCouple(1.0e-4)
+{
+}
+
+void PartitionedReactorNet::addReactor(Reactor& r, size_t part)
+{
+    while (m_nets.size() <= part) {
+        m_nets.emplace_back(new ReactorNet());
+    }
+    m_nets[part]->addReactor(r);
+}
+
+ReactorNet& PartitionedReactorNet::partition(size_t n)
+{
+    if (n >= m_nets.size()) {
+        throw IndexError("PartitionedReactorNet::partition", "m_nets", n,
+                         m_nets.size() - 1);
+    }
+    return *m_nets[n];
+}
+
+void PartitionedReactorNet::setCouplingInterval(double dt)
+{
+    if (dt <= 0.0) {
+        throw CanteraError("PartitionedReactorNet::setCouplingInterval",
+                           "Coupling interval must be positive.");
+    }
+    m_dtCouple = dt;
+}
+
+void PartitionedReactorNet::setTolerances(double rtol, double atol)
+{
+    for (auto& net : m_nets) {
+        net->setTolerances(rtol, atol);
+    }
+}
+
+void PartitionedReactorNet::setInitialTime(double time)
+{
+    for (auto& net : m_nets) {
+        net->setInitialTime(time);
+    }
+    m_time = time;
+}
+
+void PartitionedReactorNet::advance(double t)
+{
+    if (m_nets.empty()) {
+        throw CanteraError("PartitionedReactorNet::advance",
+                           "No reactors have been added.");
+    }
+    if (t < m_time) {
+        throw CanteraError("PartitionedReactorNet::advance",
+            "Cannot advance backwards in time: t = {} < current time = {}",
+            t, m_time);
+    }
+    while (m_time < t) {
+        double tnext = std::min(t, m_time + m_dtCouple);
+        // Each partition integrates over the coupling interval with the
+        // reactors of the other partitions frozen; devices and walls
+        // bridging partitions read those frozen states directly. Advancing
+        // the partitions in order makes later partitions see the updated
+        // states of earlier ones within the same interval.
+        for (auto& net : m_nets) {
+            net->advance(tnext);
+        }
+        m_time = tnext;
+    }
+}
+
+}
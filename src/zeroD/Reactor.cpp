@@ -97,10 +97,17 @@ void Reactor::initialize(doublereal t0)
 
     m_nv = m_nsp + 3;
     size_t maxnt = 0;
+    m_surfloc.clear();
+    m_bulkloc.clear();
     for (auto& S : m_surfaces) {
         m_nv += S->thermo()->nSpecies();
-        size_t nt = S->kinetics()->nTotalSpecies();
+        Kinetics* kin = S->kinetics();
+        size_t nt = kin->nTotalSpecies();
         maxnt = std::max(maxnt, nt);
+        // Cache the species index offsets needed by evalSurfaces(), so that
+        // the name-based lookup is not repeated on every evaluation
+        m_surfloc.push_back(kin->kineticsSpeciesIndex(0, kin->surfacePhaseIndex()));
+        m_bulkloc.push_back(kin->kineticsSpeciesIndex(m_thermo->speciesName(0)));
     }
     m_work.resize(maxnt);
 }
@@ -186,16 +193,26 @@ void Reactor::updateConnected(bool updatePressure) {
     m_intEnergy = m_thermo->intEnergy_mass();
     m_thermo->saveState(m_state);
 
-    // Update the mass flow rate of connected flow devices
-    double time = m_net->time();
-    for (size_t i = 0; i < m_outlet.size(); i++) {
-        m_outlet[i]->updateMassFlowRate(time);
-    }
-    for (size_t i = 0; i < m_inlet.size(); i++) {
-        m_inlet[i]->updateMassFlowRate(time);
+    // Update the mass flow rate of connected flow devices, unless the
+    // network evaluates all devices in a single batched pass after every
+    // reactor state is current (see ReactorNet::updateDevices())
+    if (!m_net->batchedDevicesActive()) {
+        double time = m_net->time();
+        for (size_t i = 0; i < m_outlet.size(); i++) {
+            m_outlet[i]->updateMassFlowRate(time);
+        }
+        for (size_t i = 0; i < m_inlet.size(); i++) {
+            m_inlet[i]->updateMassFlowRate(time);
+        }
     }
 }
 
+void Reactor::evalJacEqs(doublereal t, doublereal* y, doublereal* ydot,
+                         doublereal* params, Array2D& jac)
+{
+    throw NotImplementedError("Reactor::evalJacEqs");
+}
+
 void Reactor::evalEqs(doublereal time, doublereal* y,
                       doublereal* ydot, doublereal* params)
 {
@@ -266,10 +283,20 @@ void Reactor::evalWalls(double t)
 {
     m_vdot = 0.0;
     m_Q = 0.0;
-    for (size_t i = 0; i < m_wall.size(); i++) {
-        int lr = 1 - 2*m_lr[i];
-        m_vdot += lr*m_wall[i]->vdot(t);
-        m_Q += lr*m_wall[i]->Q(t);
+    if (m_net && m_net->batchedDevicesActive()) {
+        // the network has evaluated every wall once for this residual
+        // evaluation; read the cached rates
+        for (size_t i = 0; i < m_wall.size(); i++) {
+            int lr = 1 - 2*m_lr[i];
+            m_vdot += lr*m_wall[i]->cachedVdot();
+            m_Q += lr*m_wall[i]->cachedQ();
+        }
+    } else {
+        for (size_t i = 0; i < m_wall.size(); i++) {
+            int lr = 1 - 2*m_lr[i];
+            m_vdot += lr*m_wall[i]->vdot(t);
+            m_Q += lr*m_wall[i]->Q(t);
+        }
     }
 }
 
@@ -280,7 +307,8 @@ double Reactor::evalSurfaces(double t, double* ydot)
     size_t loc = 0; // offset into ydot
     double mdot_surf = 0.0; // net mass flux from surface
 
-    for (auto S : m_surfaces) {
+    for (size_t n = 0; n < m_surfaces.size(); n++) {
+        ReactorSurface* S = m_surfaces[n];
         Kinetics* kin = S->kinetics();
         SurfPhase* surf = S->thermo();
 
@@ -290,8 +318,7 @@ double Reactor::evalSurfaces(double t, double* ydot)
         surf->setTemperature(m_state[0]);
         S->syncCoverages();
         kin->getNetProductionRates(&m_work[0]);
-        size_t ns = kin->surfacePhaseIndex();
-        size_t surfloc = kin->kineticsSpeciesIndex(0,ns);
+        size_t surfloc = m_surfloc[n];
         for (size_t k = 1; k < nk; k++) {
             ydot[loc + k] = m_work[surfloc+k]*rs0*surf->size(k);
             sum -= ydot[loc + k];
@@ -299,7 +326,7 @@ double Reactor::evalSurfaces(double t, double* ydot)
         ydot[loc] = sum;
         loc += nk;
 
-        size_t bulkloc = kin->kineticsSpeciesIndex(m_thermo->speciesName(0));
+        size_t bulkloc = m_bulkloc[n];
         double wallarea = S->area();
         for (size_t k = 0; k < m_nsp; k++) {
             m_sdot[k] += m_work[bulkloc + k] * wallarea;
@@ -337,6 +364,70 @@ void Reactor::addSensitivitySpeciesEnthalpy(size_t k)
                              SensParameterType::enthalpy});
 }
 
+bool Reactor::sensParamDerivSupported() const
+{
+    for (auto& S : m_surfaces) {
+        if (S->nSensParams() > 0) {
+            return false;
+        }
+    }
+    for (auto& p : m_sensParams) {
+        if (p.type != SensParameterType::reaction) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const std::vector<std::pair<size_t, double>>& Reactor::stoichRow(size_t rxn)
+{
+    auto iter = m_stoichRows.find(rxn);
+    if (iter == m_stoichRows.end()) {
+        map<size_t, double> nu;
+        auto R = m_kin->reaction(rxn);
+        for (const auto& sp : R->reactants) {
+            nu[m_thermo->speciesIndex(sp.first)] -= sp.second;
+        }
+        for (const auto& sp : R->products) {
+            nu[m_thermo->speciesIndex(sp.first)] += sp.second;
+        }
+        std::vector<std::pair<size_t, double>> row;
+        for (const auto& kv : nu) {
+            if (kv.second != 0.0) {
+                row.emplace_back(kv.first, kv.second);
+            }
+        }
+        iter = m_stoichRows.emplace(rxn, std::move(row)).first;
+    }
+    return iter->second;
+}
+
+void Reactor::addSpeciesSensDerivs(double* const* dfdp, size_t offset,
+                                   size_t speciesStart)
+{
+    if (m_sensParams.empty() || !m_chem) {
+        return;
+    }
+    m_thermo->restoreState(m_state);
+    m_ropnet.resize(m_kin->nReactions());
+    m_kin->getNetRatesOfProgress(m_ropnet.data());
+    const vector_fp& mw = m_thermo->molecularWeights();
+    for (auto& p : m_sensParams) {
+        // the parameter scales the rate of reaction p.local, so only the
+        // terms of that reaction contribute to the derivative
+        double rop = m_ropnet[p.local];
+        double* g = dfdp[p.global] + offset + speciesStart;
+        for (auto& kv : stoichRow(p.local)) {
+            g[kv.first] += kv.second * rop * m_vol * mw[kv.first] / m_mass;
+        }
+    }
+}
+
+void Reactor::addSensParamDerivs(double* const* dfdp, size_t offset)
+{
+    addSpeciesSensDerivs(dfdp, offset, 3);
+}
+
 size_t Reactor::speciesIndex(const string& nm) const
 {
     // check for a gas species name
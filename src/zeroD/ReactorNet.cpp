@@ -5,10 +5,20 @@
 
 #include "cantera/zeroD/ReactorNet.h"
 #include "cantera/zeroD/FlowDevice.h"
+#include "cantera/zeroD/flowControllers.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/thermo/SurfPhase.h"
+#include "cantera/zeroD/ReactorSurface.h"
 #include "cantera/zeroD/Wall.h"
 #include "cantera/base/utilities.h"
 #include "cantera/base/Array.h"
 #include "cantera/numerics/Integrator.h"
+#include "cantera/base/Profiler.h"
+#include "cantera/base/ThreadPool.h"
+
+#include <functional>
+#include <set>
+#include <thread>
 
 using namespace std;
 
@@ -64,6 +74,18 @@ void ReactorNet::setTolerances(double rtol, double atol)
     m_init = false;
 }
 
+void ReactorNet::setAbsoluteTolerances(const vector_fp& abstol)
+{
+    m_userAtol = abstol;
+    m_init = false;
+}
+
+void ReactorNet::scaleAtolByMolecularWeight(bool yes)
+{
+    m_atolByMolWt = yes;
+    m_init = false;
+}
+
 void ReactorNet::setSensitivityTolerances(double rtol, double atol)
 {
     if (rtol >= 0.0) {
@@ -103,9 +125,136 @@ void ReactorNet::initialize()
 
     m_ydot.resize(m_nv,0.0);
     m_yest.resize(m_nv,0.0);
+    m_jacBlocks.clear();
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        m_jacBlocks.emplace_back(m_reactors[n]->neq(), m_reactors[n]->neq());
+    }
+
+    // Build the type-segregated device lists for updateDevices(). A device
+    // connects two reactors, so each one is collected only once.
+    m_mfcs.clear();
+    m_pressureControllers.clear();
+    m_valves.clear();
+    m_otherFlowDevices.clear();
+    m_walls.clear();
+    set<FlowDevice*> devices;
+    set<WallBase*> walls;
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        Reactor& r = *m_reactors[n];
+        for (size_t i = 0; i < r.nInlets(); i++) {
+            devices.insert(&r.inlet(i));
+        }
+        for (size_t i = 0; i < r.nOutlets(); i++) {
+            devices.insert(&r.outlet(i));
+        }
+        for (size_t i = 0; i < r.nWalls(); i++) {
+            walls.insert(&r.wall(i));
+        }
+    }
+    for (auto* d : devices) {
+        if (auto* mfc = dynamic_cast<MassFlowController*>(d)) {
+            m_mfcs.push_back(mfc);
+        } else if (auto* pc = dynamic_cast<PressureController*>(d)) {
+            m_pressureControllers.push_back(pc);
+        } else if (auto* v = dynamic_cast<Valve*>(d)) {
+            m_valves.push_back(v);
+        } else {
+            m_otherFlowDevices.push_back(d);
+        }
+    }
+    m_walls.assign(walls.begin(), walls.end());
+    m_batchedDevices = true;
+
+    // The threaded state scatter in updateState() is only safe when every
+    // reactor updates its own contents object
+    set<ThermoPhase*> phases;
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        phases.insert(&m_reactors[n]->contents());
+    }
+    m_distinctContents = (phases.size() == m_reactors.size());
+
+    // Partition the reactors into independent groups. Two reactors belong to
+    // the same group if they hold the same contents or surface object, or if
+    // a flow device joins them, since the inlet terms of Reactor::evalEqs()
+    // read the upstream contents directly. Distinct groups touch disjoint
+    // objects once updateDevices() has cached the wall and device rates, so
+    // eval() can process them concurrently.
+    size_t nr = m_reactors.size();
+    vector<size_t> parent(nr);
+    for (size_t n = 0; n < nr; n++) {
+        parent[n] = n;
+    }
+    std::function<size_t(size_t)> findRoot = [&](size_t n) {
+        while (parent[n] != n) {
+            parent[n] = parent[parent[n]];
+            n = parent[n];
+        }
+        return n;
+    };
+    auto merge = [&](size_t a, size_t b) {
+        parent[findRoot(a)] = findRoot(b);
+    };
+    map<ThermoPhase*, size_t> phaseOwner;
+    map<ReactorBase*, size_t> reactorIndex;
+    for (size_t n = 0; n < nr; n++) {
+        reactorIndex[m_reactors[n]] = n;
+    }
+    for (size_t n = 0; n < nr; n++) {
+        Reactor& r = *m_reactors[n];
+        auto claim = [&](ThermoPhase* ph) {
+            auto ins = phaseOwner.insert(std::make_pair(ph, n));
+            if (!ins.second) {
+                merge(n, ins.first->second);
+            }
+        };
+        claim(&r.contents());
+        for (size_t i = 0; i < r.nSurfaces(); i++) {
+            claim(r.surface(i)->thermo());
+        }
+        for (size_t i = 0; i < r.nInlets(); i++) {
+            auto found = reactorIndex.find(&r.inlet(i).in());
+            if (found != reactorIndex.end()) {
+                merge(n, found->second);
+            }
+        }
+    }
+    map<size_t, size_t> groupOf;
+    m_evalGroups.clear();
+    for (size_t n = 0; n < nr; n++) {
+        size_t root = findRoot(n);
+        auto ins = groupOf.insert(std::make_pair(root, m_evalGroups.size()));
+        if (ins.second) {
+            m_evalGroups.push_back(std::vector<size_t>());
+        }
+        m_evalGroups[ins.first->second].push_back(n);
+    }
+
     m_advancelimits.resize(m_nv,-1.0);
     m_atol.resize(neq());
     fill(m_atol.begin(), m_atol.end(), m_atols);
+    if (!m_userAtol.empty()) {
+        if (m_userAtol.size() != neq()) {
+            throw CanteraError("ReactorNet::initialize",
+                "Absolute tolerance vector has length {}, but the global "
+                "state vector has length {}", m_userAtol.size(), neq());
+        }
+        m_atol = m_userAtol;
+    } else if (m_atolByMolWt) {
+        // Weight the species error tests toward equal mole-number
+        // precision (see scaleAtolByMolecularWeight())
+        for (size_t n = 0; n < m_reactors.size(); n++) {
+            Reactor& r = *m_reactors[n];
+            ThermoPhase& thermo = r.contents();
+            const vector_fp& mw = thermo.molecularWeights();
+            double wmean = accumulate(mw.begin(), mw.end(), 0.0) / mw.size();
+            for (size_t k = 0; k < thermo.nSpecies(); k++) {
+                size_t i = r.componentIndex(thermo.speciesName(k));
+                if (i != npos) {
+                    m_atol[m_start[n] + i] = m_atols * mw[k] / wmean;
+                }
+            }
+        }
+    }
     m_integ->setTolerances(m_rtol, neq(), m_atol.data());
     m_integ->setSensitivityTolerances(m_rtolsens, m_atolsens);
     m_integ->setMaxStepSize(m_maxstep);
@@ -114,6 +263,9 @@ void ReactorNet::initialize()
         writelog("Number of equations: {:d}\n", neq());
         writelog("Maximum time step:   {:14.6g}\n", m_maxstep);
     }
+    if (m_adjoint) {
+        m_integ->setAdjointMode(true);
+    }
     m_integ->initialize(m_time, *this);
     m_integrator_init = true;
     m_init = true;
@@ -140,6 +292,97 @@ int ReactorNet::maxSteps()
     return m_integ->maxSteps();
 }
 
+void ReactorNet::setAutomaticIntegratorSwitching(bool yes, int probeInterval)
+{
+    if (yes && (!m_events.empty() || !m_sens_params.empty())) {
+        throw CanteraError("ReactorNet::setAutomaticIntegratorSwitching",
+            "Automatic integrator switching cannot be combined with event "
+            "functions or sensitivity analysis, which require CVODES.");
+    }
+    m_autoSwitch = yes;
+    m_probeInterval = probeInterval;
+    if (yes && !m_explicitMode) {
+        // Start out explicit; the first stiffness check moves the network
+        // back to BDF if the problem does not cooperate
+        switchIntegrator(true);
+    } else if (!yes && m_explicitMode) {
+        switchIntegrator(false);
+    }
+}
+
+void ReactorNet::setGasSurfacePreconditioner(bool enable)
+{
+    if (enable && m_autoSwitch) {
+        throw CanteraError("ReactorNet::setGasSurfacePreconditioner",
+            "The gas-surface preconditioner requires CVODES and cannot be "
+            "combined with automatic integrator switching.");
+    }
+    m_gsPrecon = enable;
+    m_integ->setProblemType(enable ? GMRES : DENSE + NOJAC);
+    m_init = false;
+    m_integrator_init = false;
+}
+
+void ReactorNet::setExplicitIntegratorType(const std::string& itype)
+{
+    if (itype != "RK45" && itype != "RK23" && itype != "EXP") {
+        throw CanteraError("ReactorNet::setExplicitIntegratorType",
+            "unknown non-stiff integrator type: " + itype);
+    }
+    m_explicitType = itype;
+    if (m_explicitMode) {
+        switchIntegrator(true);
+    }
+}
+
+void ReactorNet::switchIntegrator(bool toExplicit)
+{
+    if (toExplicit) {
+        m_integ.reset(newIntegrator(m_explicitType));
+    } else {
+        m_integ.reset(newIntegrator("CVODE"));
+        m_integ->setMethod(BDF_Method);
+        m_integ->setProblemType(DENSE + NOJAC);
+    }
+    m_explicitMode = toExplicit;
+    m_advancesSinceSwitch = 0;
+    // tolerances and step limits are applied to the new integrator when the
+    // network is re-initialized from the current reactor states
+    m_init = false;
+    m_integrator_init = false;
+    if (m_verbose) {
+        writelog("Switching to {} integration at t = {:14.6g}\n",
+                 toExplicit ? "explicit (" + m_explicitType + ")"
+                            : std::string("implicit (BDF)"), m_time);
+    }
+}
+
+void ReactorNet::checkStiffnessSwitch(double t0, double t1, int evals0)
+{
+    int evals = m_integ->nEvals() - evals0;
+    double rate = evals / (t1 - t0);
+    if (m_explicitMode) {
+        // Stability-limited explicit steps show up as a right-hand-side
+        // evaluation rate well above what BDF needed over a comparable
+        // interval; fall back once the cheap steps stop paying for
+        // themselves. Before any BDF interval has been measured, compare
+        // against a flat per-interval budget instead.
+        if (m_bdfEvalRate > 0.0) {
+            if (rate > 2.0 * m_bdfEvalRate) {
+                switchIntegrator(false);
+            }
+        } else if (evals > 3000) {
+            switchIntegrator(false);
+        }
+    } else {
+        m_bdfEvalRate = rate;
+        if (++m_advancesSinceSwitch >= m_probeInterval) {
+            // Probe whether the problem has left its stiff transient
+            switchIntegrator(true);
+        }
+    }
+}
+
 void ReactorNet::advance(doublereal time)
 {
     if (!m_init) {
@@ -147,9 +390,238 @@ void ReactorNet::advance(doublereal time)
     } else if (!m_integrator_init) {
         reinitialize();
     }
-    m_integ->integrate(time);
+    double t0 = m_time;
+    int evals0 = m_integ->nEvals();
+    if (m_autoSwitch && m_explicitMode) {
+        try {
+            m_integ->integrate(time);
+        } catch (CanteraError&) {
+            // The explicit integrator hit its step-size or step-count
+            // limit, which is how hard stiffness manifests. Resume from
+            // the last completed explicit step with BDF.
+            m_time = m_integ->time();
+            updateState(m_integ->solution());
+            switchIntegrator(false);
+            initialize();
+            m_integ->integrate(time);
+        }
+    } else {
+        m_integ->integrate(time);
+    }
+    while (m_integ->stoppedAtRoot() && m_integ->time() < time) {
+        recordEvents();
+        m_integ->integrate(time);
+    }
+    if (m_integ->stoppedAtRoot()) {
+        recordEvents();
+    }
     m_time = time;
     updateState(m_integ->solution());
+    if (m_autoSwitch && time > t0) {
+        checkStiffnessSwitch(t0, time, evals0);
+    }
+}
+
+size_t ReactorNet::addEvent(std::function<double(double)> g)
+{
+    if (!g) {
+        throw CanteraError("ReactorNet::addEvent",
+                           "An event function is required");
+    }
+    m_events.push_back(g);
+    m_eventTimes.emplace_back();
+    // the integrator needs to register the new root function
+    m_integrator_init = false;
+    return m_events.size() - 1;
+}
+
+void ReactorNet::clearEventTimes()
+{
+    for (auto& times : m_eventTimes) {
+        times.clear();
+    }
+}
+
+void ReactorNet::evalRoots(double t, double* y, double* gout)
+{
+    updateState(y);
+    for (size_t i = 0; i < m_events.size(); i++) {
+        gout[i] = m_events[i](t);
+    }
+}
+
+void ReactorNet::recordEvents()
+{
+    m_integ->getRootInfo(m_rootsFound);
+    for (size_t i = 0; i < m_rootsFound.size(); i++) {
+        if (m_rootsFound[i]) {
+            m_eventTimes[i].push_back(m_integ->time());
+        }
+    }
+}
+
+void ReactorNet::buildSensJacobian(double t, double* y, const double* ydot)
+{
+    m_sensJac.resize(m_nv * m_nv);
+    m_ytmp.assign(y, y + m_nv);
+    m_ftmp.resize(m_nv);
+    double* p = m_sens_params.data();
+    for (size_t n = 0; n < m_nv; n++) {
+        double ysave = m_ytmp[n];
+        double dy = m_atol[n] + fabs(ysave)*m_rtol;
+        m_ytmp[n] = ysave + dy;
+        dy = m_ytmp[n] - ysave;
+        eval(t, m_ytmp.data(), m_ftmp.data(), p);
+        double* col = &m_sensJac[n*m_nv];
+        for (size_t m = 0; m < m_nv; m++) {
+            col[m] = (m_ftmp[m] - ydot[m])/dy;
+        }
+        m_ytmp[n] = ysave;
+    }
+}
+
+bool ReactorNet::adjointSupported() const
+{
+    // the quadrature integrands need the same analytic parameter
+    // derivatives as the batched forward sensitivity RHS
+    return sensRhsSupported();
+}
+
+void ReactorNet::evalAdjointRhs(double t, double* y, const double* lambda,
+                                double* lambdaDot)
+{
+    m_fadj.resize(m_nv);
+    eval(t, y, m_fadj.data(), m_sens_params.data());
+    buildSensJacobian(t, y, m_fadj.data());
+    for (size_t n = 0; n < m_nv; n++) {
+        const double* col = &m_sensJac[n*m_nv];
+        double sum = 0.0;
+        for (size_t m = 0; m < m_nv; m++) {
+            sum += col[m] * lambda[m];
+        }
+        lambdaDot[n] = -sum;
+    }
+}
+
+void ReactorNet::evalAdjointQuad(double t, double* y, const double* lambda,
+                                 double* qdot)
+{
+    size_t Ns = m_sens_params.size();
+    m_fp.assign(Ns * m_nv, 0.0);
+    m_fpPtrs.resize(Ns);
+    for (size_t i = 0; i < Ns; i++) {
+        m_fpPtrs[i] = &m_fp[i*m_nv];
+    }
+    updateState(y);
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        m_reactors[n]->addSensParamDerivs(m_fpPtrs.data(), m_start[n]);
+    }
+    for (size_t i = 0; i < Ns; i++) {
+        const double* fp = m_fpPtrs[i];
+        double sum = 0.0;
+        for (size_t m = 0; m < m_nv; m++) {
+            sum += lambda[m] * fp[m];
+        }
+        qdot[i] = sum;
+    }
+}
+
+void ReactorNet::enableAdjoint(bool yes)
+{
+    m_adjoint = yes;
+    m_init = false;
+}
+
+vector_fp ReactorNet::solveAdjoint(const double* dgdy)
+{
+    if (!m_adjoint) {
+        throw CanteraError("ReactorNet::solveAdjoint",
+            "enableAdjoint() must be called before the forward integration.");
+    }
+    if (!m_init || !m_integrator_init) {
+        throw CanteraError("ReactorNet::solveAdjoint",
+                           "Integration has not been started.");
+    }
+    vector_fp lambda(dgdy, dgdy + m_nv);
+    vector_fp grad(m_sens_params.size(), 0.0);
+    m_integ->integrateAdjoint(lambda.data(), grad.data());
+    return grad;
+}
+
+bool ReactorNet::denseJacobianSupported() const
+{
+    for (auto r : m_reactors) {
+        if (!r->jacEqsSupported()) {
+            return false;
+        }
+    }
+    return !m_reactors.empty();
+}
+
+void ReactorNet::evalDenseJacobian(double t, double* y, double* ydot,
+                                   double* jac)
+{
+    updateState(y, t);
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        Reactor& r = *m_reactors[n];
+        size_t nv = r.neq();
+        Array2D& block = m_jacBlocks[n];
+        block.zero();
+        r.evalJacEqs(t, y + m_start[n], ydot + m_start[n],
+                     m_sens_params.data(), block);
+        // copy the reactor's block onto the diagonal of the global matrix;
+        // inter-reactor coupling terms are not included
+        for (size_t j = 0; j < nv; j++) {
+            copy(block.ptrColumn(j), block.ptrColumn(j) + nv,
+                 jac + (m_start[n] + j) * m_nv + m_start[n]);
+        }
+    }
+}
+
+bool ReactorNet::sensRhsSupported() const
+{
+    for (auto r : m_reactors) {
+        if (!r->sensParamDerivSupported()) {
+            return false;
+        }
+    }
+    return !m_reactors.empty();
+}
+
+void ReactorNet::evalSensRhs(double t, double* y, double* ydot,
+                             double* const* s, double* const* sdot)
+{
+    size_t Ns = m_sens_params.size();
+
+    // A single finite-difference Jacobian is shared by all parameters,
+    // replacing the one RHS evaluation per parameter per step needed by the
+    // integrator's internal difference quotients
+    buildSensJacobian(t, y, ydot);
+
+    // sdot_i = J*s_i, skipping zero entries of each sensitivity vector
+    for (size_t i = 0; i < Ns; i++) {
+        double* si = s[i];
+        double* sdi = sdot[i];
+        for (size_t m = 0; m < m_nv; m++) {
+            sdi[m] = 0.0;
+        }
+        for (size_t n = 0; n < m_nv; n++) {
+            double sn = si[n];
+            if (sn == 0.0) {
+                continue;
+            }
+            const double* col = &m_sensJac[n*m_nv];
+            for (size_t m = 0; m < m_nv; m++) {
+                sdi[m] += col[m] * sn;
+            }
+        }
+    }
+
+    // add the analytic partial derivatives with respect to the parameters
+    updateState(y);
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        m_reactors[n]->addSensParamDerivs(sdot, m_start[n]);
+    }
 }
 
 double ReactorNet::advance(double time, bool applylimit)
@@ -207,6 +679,62 @@ double ReactorNet::advance(double time, bool applylimit)
     return t;
 }
 
+void ReactorNet::sample(double t, double* state)
+{
+    if (!m_init || !m_integrator_init) {
+        throw CanteraError("ReactorNet::sample",
+                           "Integration has not been started.");
+    }
+    double* dky = m_integ->derivative(t, 0);
+    if (!dky) {
+        throw CanteraError("ReactorNet::sample",
+            "The current integrator does not support dense output.");
+    }
+    copy(dky, dky + m_nv, state);
+}
+
+void ReactorNet::sampleHistory(const vector_fp& times, Array2D& states)
+{
+    if (!m_init) {
+        initialize();
+    } else if (!m_integrator_init) {
+        reinitialize();
+    }
+    for (size_t j = 1; j < times.size(); j++) {
+        if (times[j] <= times[j-1]) {
+            throw CanteraError("ReactorNet::sampleHistory",
+                               "Sample times must be increasing.");
+        }
+    }
+    states.resize(m_nv, times.size());
+
+    // Grid times already reached are still within reach of the dense
+    // output if they fall inside the last step taken
+    size_t j = 0;
+    while (j < times.size() && times[j] <= m_time) {
+        sample(times[j], &states(0, j));
+        j++;
+    }
+
+    // Take internal steps and interpolate each grid time as soon as it is
+    // passed, so the output grid never constrains the step size
+    while (j < times.size()) {
+        m_time = m_integ->step(times.back());
+        while (m_integ->stoppedAtRoot() && m_time < times.back()) {
+            recordEvents();
+            m_time = m_integ->step(times.back());
+        }
+        if (m_integ->stoppedAtRoot()) {
+            recordEvents();
+        }
+        while (j < times.size() && times[j] <= m_time) {
+            sample(times[j], &states(0, j));
+            j++;
+        }
+    }
+    updateState(m_integ->solution());
+}
+
 double ReactorNet::step()
 {
     if (!m_init) {
@@ -215,10 +743,31 @@ double ReactorNet::step()
         reinitialize();
     }
     m_time = m_integ->step(m_time + 1.0);
+    if (m_integ->stoppedAtRoot()) {
+        recordEvents();
+    }
     updateState(m_integ->solution());
     return m_time;
 }
 
+void ReactorNet::saveCheckpoint(std::vector<char>& data)
+{
+    if (!m_init) {
+        initialize();
+    }
+    m_integ->saveCheckpoint(data);
+}
+
+void ReactorNet::loadCheckpoint(const std::vector<char>& data)
+{
+    if (!m_init) {
+        initialize();
+    }
+    m_time = m_integ->loadCheckpoint(data, *this);
+    m_integrator_init = true;
+    updateState(m_integ->solution());
+}
+
 void ReactorNet::getEstimate(double time, int k, double* yest)
 {
     // initialize
@@ -253,14 +802,66 @@ void ReactorNet::addReactor(Reactor& r)
 void ReactorNet::eval(doublereal t, doublereal* y,
                       doublereal* ydot, doublereal* p)
 {
+    // This is the right-hand-side callback invoked by CVODES on every
+    // internal step, so one profiled scope here covers the integrator's
+    // calls back into Cantera
+    CT_PROFILE_SCOPE("ReactorNet::eval");
     m_time = t; // This will be replaced at the end of the timestep
     updateState(y);
-    for (size_t n = 0; n < m_reactors.size(); n++) {
-        m_reactors[n]->evalEqs(t, y + m_start[n], ydot + m_start[n], p);
+    size_t nThreads = m_updateThreads;
+    if (nThreads == 0) {
+        nThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    nThreads = std::min(nThreads, m_evalGroups.size());
+    if (nThreads > 1 && m_batchedDevices) {
+        // The groups built by initialize() touch disjoint objects now that
+        // updateDevices() has cached the wall and flow-device rates, so
+        // each task evaluates a contiguous range of groups.
+        size_t ng = m_evalGroups.size();
+        ThreadPool::shared().run(nThreads, [&](size_t i) {
+            size_t first = i * ng / nThreads;
+            size_t last = (i + 1) * ng / nThreads;
+            for (size_t g = first; g < last; g++) {
+                for (size_t n : m_evalGroups[g]) {
+                    m_reactors[n]->evalEqs(t, y + m_start[n],
+                                           ydot + m_start[n], p);
+                }
+            }
+        });
+    } else {
+        for (size_t n = 0; n < m_reactors.size(); n++) {
+            m_reactors[n]->evalEqs(t, y + m_start[n], ydot + m_start[n], p);
+        }
     }
     checkFinite("ydot", ydot, m_nv);
 }
 
+AnyMap ReactorNet::memoryReport() const
+{
+    AnyMap report;
+    report["n-reactors"] = static_cast<long int>(m_reactors.size());
+    report["n-vars"] = static_cast<long int>(m_nv);
+    report["scratch-bytes"] = static_cast<long int>(
+        vectorBytes(m_atol) + vectorBytes(m_ydot) + vectorBytes(m_yest)
+        + vectorBytes(m_advancelimits) + vectorBytes(m_sensJac)
+        + vectorBytes(m_ytmp) + vectorBytes(m_ftmp));
+    if (m_integ) {
+        report["integrator"] = m_integ->memoryReport();
+    }
+    return report;
+}
+
+AnyMap ReactorNet::solverStats() const
+{
+    AnyMap stats;
+    if (m_integ) {
+        stats = m_integ->solverStats();
+    }
+    stats["time"] = m_time;
+    stats["explicit-mode"] = m_explicitMode;
+    return stats;
+}
+
 double ReactorNet::sensitivity(size_t k, size_t p)
 {
     if (!m_init) {
@@ -300,11 +901,199 @@ void ReactorNet::evalJacobian(doublereal t, doublereal* y,
     }
 }
 
+void ReactorNet::preconditionerSetup(double t, double* y, double gamma)
+{
+    if (!m_gsPrecon) {
+        FuncEval::preconditionerSetup(t, y, gamma); // throws
+    }
+    m_gsBlocks.resize(m_reactors.size());
+
+    // unperturbed derivative at the current state
+    eval(t, y, m_ydot.data(), m_sens_params.data());
+    vector_fp fpert(m_nv);
+
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        Reactor& r = *m_reactors[n];
+        size_t nv = r.neq();
+        size_t ns = 0;
+        for (size_t i = 0; i < r.nSurfaces(); i++) {
+            ns += r.surface(i)->thermo()->nSpecies();
+        }
+        size_t ng = nv - ns;
+        GasSurfBlock& blk = m_gsBlocks[n];
+        blk.ng = ng;
+        blk.ns = ns;
+
+        // this reactor's diagonal Jacobian block: analytic when the reactor
+        // supports it, difference quotients restricted to the block otherwise
+        Array2D J(nv, nv, 0.0);
+        if (r.jacEqsSupported()) {
+            r.evalJacEqs(t, y + m_start[n], m_ydot.data() + m_start[n],
+                         m_sens_params.data(), J);
+        } else {
+            for (size_t j = 0; j < nv; j++) {
+                size_t col = m_start[n] + j;
+                double ysave = y[col];
+                double dy = m_atol[col] + fabs(ysave)*m_rtol;
+                y[col] = ysave + dy;
+                dy = y[col] - ysave;
+                eval(t, y, fpert.data(), m_sens_params.data());
+                for (size_t i = 0; i < nv; i++) {
+                    J(i, j) = (fpert[m_start[n] + i]
+                               - m_ydot[m_start[n] + i])/dy;
+                }
+                y[col] = ysave;
+            }
+        }
+
+        // partition M = I - gamma*J; factor the (small, stiff) coverage
+        // block D independently by inverting it in place
+        if (ns > 0) {
+            DenseMatrix D(ns, ns);
+            blk.Dinv.resize(ns, ns, 0.0);
+            blk.B.resize(ng, ns);
+            blk.C.resize(ns, ng);
+            for (size_t i = 0; i < ns; i++) {
+                for (size_t j = 0; j < ns; j++) {
+                    D(i,j) = (i == j ? 1.0 : 0.0) - gamma*J(ng + i, ng + j);
+                }
+                blk.Dinv(i,i) = 1.0;
+            }
+            for (size_t i = 0; i < ng; i++) {
+                for (size_t j = 0; j < ns; j++) {
+                    blk.B(i,j) = -gamma*J(i, ng + j);
+                }
+            }
+            for (size_t i = 0; i < ns; i++) {
+                for (size_t j = 0; j < ng; j++) {
+                    blk.C(i,j) = -gamma*J(ng + i, j);
+                }
+            }
+            solve(D, blk.Dinv);
+            blk.ts.resize(ns);
+            blk.tg.resize(ng);
+        }
+
+        // couple the gas block through its Schur complement
+        // S = A - B D^{-1} C, and invert it
+        DenseMatrix S(ng, ng);
+        for (size_t i = 0; i < ng; i++) {
+            for (size_t j = 0; j < ng; j++) {
+                S(i,j) = (i == j ? 1.0 : 0.0) - gamma*J(i, j);
+            }
+        }
+        if (ns > 0) {
+            vector_fp dc(ns), bdc(ng);
+            for (size_t j = 0; j < ng; j++) {
+                // column j of D^{-1} C, then of B D^{-1} C
+                blk.Dinv.mult(blk.C.ptrColumn(j), dc.data());
+                blk.B.mult(dc.data(), bdc.data());
+                for (size_t i = 0; i < ng; i++) {
+                    S(i,j) -= bdc[i];
+                }
+            }
+        }
+        blk.Sinv.resize(ng, ng, 0.0);
+        for (size_t i = 0; i < ng; i++) {
+            blk.Sinv(i,i) = 1.0;
+        }
+        solve(S, blk.Sinv);
+    }
+}
+
+void ReactorNet::preconditionerSolve(double t, double* y, double* r,
+                                     double* z)
+{
+    if (m_gsBlocks.size() != m_reactors.size()) {
+        throw CanteraError("ReactorNet::preconditionerSolve",
+                           "preconditionerSetup() has not been called");
+    }
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        GasSurfBlock& blk = m_gsBlocks[n];
+        double* rg = r + m_start[n];
+        double* zg = z + m_start[n];
+        if (blk.ns == 0) {
+            blk.Sinv.mult(rg, zg);
+            continue;
+        }
+        double* rs = rg + blk.ng;
+        double* zs = zg + blk.ng;
+
+        // gas part: zg = S^{-1} (rg - B D^{-1} rs)
+        blk.Dinv.mult(rs, blk.ts.data());
+        blk.B.mult(blk.ts.data(), blk.tg.data());
+        for (size_t i = 0; i < blk.ng; i++) {
+            blk.tg[i] = rg[i] - blk.tg[i];
+        }
+        blk.Sinv.mult(blk.tg.data(), zg);
+
+        // coverage part: zs = D^{-1} (rs - C zg)
+        blk.C.mult(zg, blk.ts.data());
+        for (size_t i = 0; i < blk.ns; i++) {
+            blk.ts[i] = rs[i] - blk.ts[i];
+        }
+        blk.Dinv.mult(blk.ts.data(), zs);
+    }
+}
+
 void ReactorNet::updateState(doublereal* y)
+{
+    updateState(y, m_time);
+}
+
+void ReactorNet::updateState(doublereal* y, double t)
 {
     checkFinite("y", y, m_nv);
-    for (size_t n = 0; n < m_reactors.size(); n++) {
-        m_reactors[n]->updateState(y + m_start[n]);
+    size_t nThreads = m_updateThreads;
+    if (nThreads == 0) {
+        nThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    nThreads = std::min(nThreads, m_reactors.size());
+    if (nThreads > 1 && m_distinctContents && m_batchedDevices) {
+        // Each reactor's slice of the state is applied to its own contents
+        // object, so the scatter (including the temperature solve from the
+        // energy balance) can run concurrently. Device updates need every
+        // reactor state to be current and stay in the serial pass below.
+        size_t nr = m_reactors.size();
+        ThreadPool::shared().run(nThreads, [&](size_t i) {
+            size_t first = i * nr / nThreads;
+            size_t last = (i + 1) * nr / nThreads;
+            for (size_t n = first; n < last; n++) {
+                m_reactors[n]->updateState(y + m_start[n]);
+            }
+        });
+    } else {
+        for (size_t n = 0; n < m_reactors.size(); n++) {
+            m_reactors[n]->updateState(y + m_start[n]);
+        }
+    }
+    updateDevices(t);
+}
+
+void ReactorNet::updateDevices(double t)
+{
+    if (!m_batchedDevices) {
+        return;
+    }
+    // One loop per concrete class; the qualified calls are dispatched
+    // directly. All reactor states are current at this point, so the
+    // pressure-driven devices see consistent upstream and downstream
+    // pressures.
+    for (auto* mfc : m_mfcs) {
+        mfc->MassFlowController::updateMassFlowRate(t);
+    }
+    for (auto* v : m_valves) {
+        v->Valve::updateMassFlowRate(t);
+    }
+    // pressure controllers read the updated flow rate of their master
+    for (auto* pc : m_pressureControllers) {
+        pc->PressureController::updateMassFlowRate(t);
+    }
+    for (auto* d : m_otherFlowDevices) {
+        d->updateMassFlowRate(t);
+    }
+    for (auto* w : m_walls) {
+        w->updateRates(t);
     }
 }
 
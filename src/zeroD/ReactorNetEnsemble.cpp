@@ -0,0 +1,83 @@
+//! @file ReactorNetEnsemble.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/ReactorNetEnsemble.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+namespace Cantera
+{
+
+ReactorNetEnsemble::ReactorNetEnsemble() :
+    m_nThreads(0)
+{
+}
+
+void ReactorNetEnsemble::addNet(ReactorNet& net)
+{
+    m_nets.push_back(&net);
+}
+
+ReactorNet& ReactorNetEnsemble::net(size_t n)
+{
+    if (n >= m_nets.size()) {
+        throw IndexError("ReactorNetEnsemble::net", "m_nets", n,
+                         m_nets.size() - 1);
+    }
+    return *m_nets[n];
+}
+
+void ReactorNetEnsemble::advanceAll(double t)
+{
+    size_t nThreads = m_nThreads;
+    if (nThreads == 0) {
+        nThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    nThreads = std::min(nThreads, m_nets.size());
+
+    // Shared counter from which each worker claims the next unprocessed
+    // network; this balances the load dynamically, since a worker stuck on
+    // one stiff network stops claiming new ones while the others keep going.
+    std::atomic<size_t> next(0);
+    std::exception_ptr firstError = nullptr;
+    std::mutex errorMutex;
+
+    auto worker = [&]() {
+        while (true) {
+            size_t n = next.fetch_add(1);
+            if (n >= m_nets.size()) {
+                return;
+            }
+            try {
+                m_nets[n]->advance(t);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!firstError) {
+                    firstError = std::current_exception();
+                }
+            }
+        }
+    };
+
+    if (nThreads <= 1) {
+        worker();
+    } else {
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < nThreads; i++) {
+            threads.emplace_back(worker);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+}
+
+}
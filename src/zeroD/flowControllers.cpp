@@ -29,7 +29,7 @@ void MassFlowController::updateMassFlowRate(double time)
     }
     double mdot = m_coeff;
     if (m_tfunc) {
-        mdot *= m_tfunc->eval(time);
+        mdot *= m_tprog.eval(time);
     }
     m_mdot = std::max(mdot, 0.0);
 }
@@ -46,7 +46,7 @@ void PressureController::updateMassFlowRate(double time)
     double mdot = m_coeff;
     double delta_P = in().pressure() - out().pressure();
     if (m_pfunc) {
-        mdot *= m_pfunc->eval(delta_P);
+        mdot *= m_pprog.eval(delta_P);
     } else {
         mdot *= delta_P;
     }
@@ -66,11 +66,11 @@ void Valve::updateMassFlowRate(double time)
     }
     double mdot = m_coeff;
     if (m_tfunc) {
-        mdot *= m_tfunc->eval(time);
+        mdot *= m_tprog.eval(time);
     }
     double delta_P = in().pressure() - out().pressure();
     if (m_pfunc) {
-        mdot *= m_pfunc->eval(delta_P);
+        mdot *= m_pprog.eval(delta_P);
     } else {
         mdot *= delta_P;
     }
@@ -0,0 +1,108 @@
+//! @file kinetics_bench.cpp Benchmark of gas kinetics rate evaluations
+/*!
+ * Sweeps a set of canonical mechanisms of increasing size and reports the
+ * sustained rate of getNetProductionRates() evaluations, along with the
+ * diagnostic counters from Kinetics::statistics(). Build with
+ * 'scons build-benchmarks' and run the resulting program manually; results
+ * are for tracking the performance of the kinetics evaluation path across
+ * changes, and are not part of the test suite.
+ *
+ * Usage: kinetics_bench [seconds-per-mechanism]
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/Solution.h"
+#include "cantera/base/AnyMap.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/GasKinetics.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace Cantera;
+
+namespace {
+
+//! Time repeated net production rate evaluations for roughly *duration*
+//! seconds and return the number of evaluations performed. The temperature
+//! is perturbed on every evaluation so that the rate update caches cannot
+//! short-circuit the work being measured.
+size_t benchRates(ThermoPhase& gas, Kinetics& kin, double duration,
+                  double& elapsed)
+{
+    vector_fp wdot(kin.nTotalSpecies());
+    double T0 = gas.temperature();
+
+    // warm up so that one-time table construction is excluded
+    for (size_t n = 0; n < 10; n++) {
+        gas.setTemperature(T0 + 0.01 * n);
+        kin.getNetProductionRates(wdot.data());
+    }
+
+    size_t nEvals = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    do {
+        for (size_t n = 0; n < 100; n++) {
+            gas.setTemperature(T0 + 0.01 * (nEvals % 100));
+            kin.getNetProductionRates(wdot.data());
+            nEvals++;
+        }
+        elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - t0).count();
+    } while (elapsed < duration);
+    return nEvals;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    double duration = 2.0;
+    if (argc > 1) {
+        duration = atof(argv[1]);
+    }
+
+    // canonical mechanisms, smallest first
+    struct Mech {
+        const char* file;
+        const char* phase;
+    };
+    Mech mechs[] = {
+        {"h2o2.yaml", ""},
+        {"gri30.yaml", "gri30"},
+        {"nDodecane_Reitz.yaml", "nDodecane_IG"},
+    };
+
+    printf("%-22s %9s %9s %10s %12s\n",
+           "mechanism", "species", "reactions", "evals", "evals/sec");
+    try {
+        for (const auto& mech : mechs) {
+            auto sol = newSolution(mech.file, mech.phase, "None");
+            auto& gas = *sol->thermo();
+            auto& kin = *sol->kinetics();
+            gas.setState_TP(1300.0, OneAtm);
+            gas.setMassFractions_NoNorm(vector_fp(gas.nSpecies(),
+                1.0 / gas.nSpecies()).data());
+
+            auto* gasKin = dynamic_cast<GasKinetics*>(&kin);
+            if (gasKin) {
+                gasKin->enableTimingStats(true);
+            }
+
+            double elapsed = 0.0;
+            size_t nEvals = benchRates(gas, kin, duration, elapsed);
+            printf("%-22s %9lu %9lu %10lu %12.0f\n", mech.file,
+                   (unsigned long) kin.nTotalSpecies(),
+                   (unsigned long) kin.nReactions(),
+                   (unsigned long) nEvals, nEvals / elapsed);
+            printf("%s\n", kin.statistics().toYamlString().c_str());
+        }
+    } catch (std::exception& err) {
+        printf("%s\n", err.what());
+        return 1;
+    }
+    return 0;
+}
@@ -5,6 +5,9 @@
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/thermo/Species.h"
 #include "cantera/equil/MultiPhase.h"
+#include "cantera/equil/ChemEquil.h"
+#include "cantera/equil/EquilTableGenerator.h"
+#include "cantera/equil/vcs_MultiPhaseEquil.h"
 #include "cantera/base/global.h"
 #include "cantera/base/utilities.h"
 
@@ -310,6 +313,116 @@ TEST_F(PropertyPairs, ChemEquil_UV) { check_UV("element_potential"); }
 // TEST_F(PropertyPairs, MultiPhase_UV) { check_UV("gibbs"); } // not implemented
 TEST_F(PropertyPairs, VcsNonideal_UV) { check_UV("vcs"); }
 
+// Warm-started solves over a temperature sweep should give the same answer as
+// independent cold-started solves.
+TEST_F(GriEquilibriumTest, ChemEquil_WarmStartSweep)
+{
+    ChemEquil warm(gas);
+    warm.enableWarmStart(true);
+    vector_fp Xwarm(gas.nSpecies());
+    for (double T = 1500; T <= 2500; T += 250) {
+        gas.setState_TPX(T, OneAtm, "CH4:0.3, O2:0.3, N2:0.4");
+        save_elemental_mole_fractions();
+        ASSERT_EQ(0, warm.equilibrate(gas, "TP"));
+        EXPECT_NEAR(T, gas.temperature(), 1e-5);
+        check();
+        gas.getMoleFractions(&Xwarm[0]);
+
+        // Cold-started reference solve from the same initial state
+        gas.setState_TPX(T, OneAtm, "CH4:0.3, O2:0.3, N2:0.4");
+        ChemEquil cold(gas);
+        ASSERT_EQ(0, cold.equilibrate(gas, "TP"));
+        for (size_t k = 0; k < gas.nSpecies(); k++) {
+            EXPECT_NEAR(Xwarm[k], gas.moleFraction(k),
+                        1e-10 + 1e-6*fabs(Xwarm[k]));
+        }
+    }
+}
+
+// Raising the trace-species cutoff shrinks the active set of the VCS
+// iteration but should not change the converged composition of species that
+// stay above the cutoff.
+TEST(VcsTraceSpeciesCutoff, MatchesDefaultSolve)
+{
+    IdealGasPhase gas("gri30.yaml");
+    MultiPhase mix;
+    mix.addPhase(&gas, 1.0);
+    mix.init();
+
+    gas.setState_TPX(1800, OneAtm, "CH4:0.3, O2:0.3, N2:0.4");
+    mix.setState_TP(1800, OneAtm);
+    vcs_MultiPhaseEquil eqRef(&mix, 0);
+    ASSERT_EQ(0, eqRef.equilibrate_TP(-1, 0));
+    vector_fp Xref(mix.nSpecies());
+    mix.getMoleFractions(&Xref[0]);
+
+    gas.setState_TPX(1800, OneAtm, "CH4:0.3, O2:0.3, N2:0.4");
+    mix.setState_TP(1800, OneAtm);
+    vcs_MultiPhaseEquil eqTrace(&mix, 0);
+    eqTrace.setTraceSpeciesCutoff(1e-32);
+    ASSERT_EQ(0, eqTrace.equilibrate_TP(-1, 0));
+    for (size_t k = 0; k < mix.nSpecies(); k++) {
+        if (Xref[k] > 1e-20) {
+            EXPECT_NEAR(Xref[k], mix.moleFraction(k), 1e-9 + 1e-4 * Xref[k]);
+        }
+    }
+
+    EXPECT_THROW(eqTrace.setTraceSpeciesCutoff(1e-5), CanteraError);
+    EXPECT_THROW(eqTrace.setTraceSpeciesCutoff(0.0), CanteraError);
+}
+
+// Every cell of the generated table should match an independent VCS solve at
+// the same (Z, T, P) point.
+TEST(EquilTableGenerator, MatchesPointwiseSolves)
+{
+    IdealGasPhase gas1("h2o2.yaml");
+    IdealGasPhase gas2("h2o2.yaml");
+    MultiPhase mix1, mix2;
+    mix1.addPhase(&gas1, 1.0);
+    mix1.init();
+    mix2.addPhase(&gas2, 1.0);
+    mix2.init();
+
+    vector_fp fuel(mix1.nSpecies(), 0.0);
+    vector_fp oxid(mix1.nSpecies(), 0.0);
+    fuel[gas1.speciesIndex("H2")] = 1.0;
+    oxid[gas1.speciesIndex("O2")] = 1.0;
+    oxid[gas1.speciesIndex("AR")] = 2.0;
+
+    vector_fp Z{0.3, 0.6};
+    vector_fp T{1500.0, 2000.0};
+    vector_fp P{OneAtm};
+
+    EquilTableGenerator gen;
+    gen.addMixture(mix1);
+    gen.addMixture(mix2);
+    gen.setGrid(Z, T, P);
+    gen.setEndpointMoles(fuel, oxid);
+    gen.generate("");
+
+    IdealGasPhase gasRef("h2o2.yaml");
+    MultiPhase ref;
+    ref.addPhase(&gasRef, 1.0);
+    ref.init();
+    size_t nsp = ref.nSpecies();
+    vector_fp moles(nsp);
+    for (size_t iz = 0; iz < Z.size(); iz++) {
+        for (size_t k = 0; k < nsp; k++) {
+            moles[k] = Z[iz] * fuel[k] + (1.0 - Z[iz]) * oxid[k];
+        }
+        for (size_t it = 0; it < T.size(); it++) {
+            ref.setState_TPMoles(T[it], P[0], moles.data());
+            vcs_MultiPhaseEquil eq(&ref, 0);
+            ASSERT_EQ(0, eq.equilibrate_TP(-1, 0));
+            const double* cell = &gen.table()[(iz * T.size() + it) * nsp];
+            for (size_t k = 0; k < nsp; k++) {
+                EXPECT_NEAR(ref.moleFraction(k), cell[k],
+                            1e-9 + 1e-5 * ref.moleFraction(k));
+            }
+        }
+    }
+}
+
 int main(int argc, char** argv)
 {
     printf("Running main() from equil_gas.cpp\n");
@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+#include "cantera/base/BinaryTable.h"
+#include "cantera/base/Array.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <cstdio>
+
+using namespace Cantera;
+
+namespace {
+
+// data(j,i) = 10*j + i, matching the writePlotFile arrangement where each
+// row is a variable and each column is a point
+Array2D sampleData(size_t nvars, size_t npoints)
+{
+    Array2D data(nvars, npoints);
+    for (size_t j = 0; j < nvars; j++) {
+        for (size_t i = 0; i < npoints; i++) {
+            data(j, i) = 10.0 * j + i;
+        }
+    }
+    return data;
+}
+
+}
+
+TEST(BinaryTable, round_trip)
+{
+    std::vector<std::string> names{"z", "T", "X_H2", "X_O2"};
+    Array2D data = sampleData(names.size(), 7);
+    writeBinaryTable("table-roundtrip.bin", names, data);
+
+    std::vector<std::string> namesIn;
+    Array2D dataIn;
+    readBinaryTable("table-roundtrip.bin", namesIn, dataIn);
+    EXPECT_EQ(names, namesIn);
+    ASSERT_EQ(data.nRows(), dataIn.nRows());
+    ASSERT_EQ(data.nColumns(), dataIn.nColumns());
+    for (size_t j = 0; j < data.nRows(); j++) {
+        for (size_t i = 0; i < data.nColumns(); i++) {
+            EXPECT_DOUBLE_EQ(data(j, i), dataIn(j, i));
+        }
+    }
+    std::remove("table-roundtrip.bin");
+}
+
+TEST(BinaryTable, selected_columns)
+{
+    std::vector<std::string> names{"z", "T", "X_H2", "X_O2"};
+    Array2D data = sampleData(names.size(), 9);
+    writeBinaryTable("table-select.bin", names, data);
+
+    // Requested order need not match the order of the columns in the file
+    std::vector<std::string> subset{"X_O2", "z"};
+    Array2D dataIn;
+    readBinaryTable("table-select.bin", subset, dataIn);
+    ASSERT_EQ(dataIn.nRows(), (size_t) 2);
+    ASSERT_EQ(dataIn.nColumns(), (size_t) 9);
+    for (size_t i = 0; i < 9; i++) {
+        EXPECT_DOUBLE_EQ(dataIn(0, i), data(3, i));
+        EXPECT_DOUBLE_EQ(dataIn(1, i), data(0, i));
+    }
+
+    std::vector<std::string> missing{"X_OH"};
+    EXPECT_THROW(readBinaryTable("table-select.bin", missing, dataIn),
+                 CanteraError);
+    std::remove("table-select.bin");
+}
+
+TEST(BinaryTable, append_time_series)
+{
+    std::vector<std::string> names{"t", "T", "X_H2"};
+    std::remove("table-append.bin");
+    {
+        // Use a small chunk size so multiple chunks are written
+        BinaryTableWriter writer("table-append.bin", names, true, 3);
+        for (size_t i = 0; i < 5; i++) {
+            writer.append({0.1 * i, 300.0 + i, 1.0 / (i + 1)});
+        }
+    }
+    {
+        // Reopening with the same columns appends after the existing rows
+        BinaryTableWriter writer("table-append.bin", names, true, 3);
+        for (size_t i = 5; i < 7; i++) {
+            writer.append({0.1 * i, 300.0 + i, 1.0 / (i + 1)});
+        }
+        EXPECT_THROW(writer.append({1.0, 2.0}), CanteraError);
+    }
+    std::vector<std::string> mismatched{"t", "T", "X_O2"};
+    EXPECT_THROW(BinaryTableWriter("table-append.bin", mismatched),
+                 CanteraError);
+
+    std::vector<std::string> namesIn;
+    Array2D dataIn;
+    readBinaryTable("table-append.bin", namesIn, dataIn);
+    EXPECT_EQ(names, namesIn);
+    ASSERT_EQ(dataIn.nColumns(), (size_t) 7);
+    for (size_t i = 0; i < 7; i++) {
+        EXPECT_DOUBLE_EQ(dataIn(0, i), 0.1 * i);
+        EXPECT_DOUBLE_EQ(dataIn(1, i), 300.0 + i);
+        EXPECT_DOUBLE_EQ(dataIn(2, i), 1.0 / (i + 1));
+    }
+    std::remove("table-append.bin");
+}
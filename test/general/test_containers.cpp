@@ -373,6 +373,24 @@ TEST(AnyMap, missingKeyAt)
     }
 }
 
+TEST(AnyMap, fromYamlFileShared)
+{
+    auto shared1 = AnyMap::fromYamlFileShared("h2o2.yaml");
+    auto shared2 = AnyMap::fromYamlFileShared("h2o2.yaml");
+    // Repeated loads share the cached document instead of copying it
+    EXPECT_EQ(shared1.get(), shared2.get());
+
+    // The shared view matches the copying API
+    AnyMap copy = AnyMap::fromYamlFile("h2o2.yaml");
+    EXPECT_EQ(copy["phases"].getMapWhere("name", "ohmech")["thermo"].asString(),
+        shared1->at("phases").getMapWhere("name", "ohmech")["thermo"].asString());
+
+    // Mutating a copy does not affect the shared document
+    copy["phases"].getMapWhere("name", "ohmech")["thermo"] = "spam";
+    EXPECT_EQ("ideal-gas",
+        shared1->at("phases").getMapWhere("name", "ohmech")["thermo"].asString());
+}
+
 TEST(AnyMap, dumpYamlString)
 {
     AnyMap original = AnyMap::fromYamlFile("h2o2.yaml");
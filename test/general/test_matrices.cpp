@@ -82,6 +82,24 @@ TEST_F(BandMatrixTest, solve_linear_system)
     }
 }
 
+TEST_F(BandMatrixTest, solve_mixed_precision)
+{
+    A1.setMixedPrecision(true);
+    EXPECT_TRUE(A1.mixedPrecision());
+    vector_fp c(6, 0.0);
+    // The iterative refinement recovers double accuracy from the
+    // single-precision factors
+    A1.solve(b1.data(), c.data());
+    for (size_t i = 0; i < 6; i++) {
+        EXPECT_NEAR(x[i], c[i], 1e-10);
+    }
+    A1.setMixedPrecision(false);
+    A1.solve(b1.data(), c.data());
+    for (size_t i = 0; i < 6; i++) {
+        EXPECT_NEAR(x[i], c[i], 1e-10);
+    }
+}
+
 TEST_F(BandMatrixTest, oneNorm) {
 
     EXPECT_DOUBLE_EQ(28, A1.oneNorm());
@@ -205,6 +223,55 @@ TEST_F(DenseMatrixTest, solve_multi_rhs)
     }
 }
 
+TEST_F(DenseMatrixTest, solve_small_sizes)
+{
+    // exercises the fixed-size dispatch for n <= 4
+    for (size_t n = 1; n <= 3; n++) {
+        DenseMatrix A(n, n);
+        vector_fp xs(n), c(n, 0.0);
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < n; j++) {
+                A(i,j) = (i == j) ? 2.0 + i : 0.5 / (1.0 + i + j);
+            }
+            xs[i] = 1.0 + 2.0*i;
+        }
+        A.mult(xs.data(), c.data());
+        solve(A, c.data());
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_NEAR(xs[i], c[i], 1e-12);
+        }
+    }
+
+    DenseMatrix S(2, 2); // singular
+    S(0,0) = 1; S(0,1) = 2;
+    S(1,0) = 2; S(1,1) = 4;
+    vector_fp c{1.0, 1.0};
+    EXPECT_THROW(solve(S, c.data()), CanteraError);
+}
+
+TEST_F(DenseMatrixTest, left_mult)
+{
+    vector_fp c(4, 0.0);
+    A1.leftMult(x4.data(), c.data());
+    for (size_t j = 0; j < 4; j++) {
+        double sum = 0.0;
+        for (size_t i = 0; i < 4; i++) {
+            sum += A1(i,j) * x4[i];
+        }
+        EXPECT_DOUBLE_EQ(sum, c[j]);
+    }
+
+    c.assign(4, 0.0);
+    A3.leftMult(x3.data(), c.data());
+    for (size_t j = 0; j < 4; j++) {
+        double sum = 0.0;
+        for (size_t i = 0; i < 3; i++) {
+            sum += A3(i,j) * x3[i];
+        }
+        EXPECT_DOUBLE_EQ(sum, c[j]);
+    }
+}
+
 TEST_F(DenseMatrixTest, increment)
 {
     vector_fp c(b1.size(), 3.0);
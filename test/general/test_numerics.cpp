@@ -1,5 +1,10 @@
 #include "gtest/gtest.h"
 #include "cantera/numerics/polyfit.h"
+#include "cantera/numerics/DenseMatrix.h"
+#include "cantera/numerics/FuncEval.h"
+#include "cantera/numerics/Func1.h"
+#include "cantera/numerics/Func1Program.h"
+#include "cantera/numerics/JacobianColoring.h"
 
 using namespace Cantera;
 
@@ -91,3 +96,185 @@ TEST(Polyfit, weighted)
         }
     }
 }
+
+TEST(Polyfit, shared_matches_polyfit)
+{
+    vector_fp x{-1.0, 0.0, 0.5, 1.0, 1.5, 2.0, 3.0};
+    std::vector<vector_fp> Y{
+        {0.6, 1.0, 0.8, 0.4, -0.1, -0.5, -1},
+        {1.2, 0.3, -0.4, 0.9, 2.1, -0.7, 0.5},
+        {-0.3, 0.1, 0.6, 1.4, 1.1, 0.8, 0.2}
+    };
+    size_t deg = 3;
+
+    vector_fp yflat;
+    for (auto& y : Y) {
+        yflat.insert(yflat.end(), y.begin(), y.end());
+    }
+    vector_fp pflat(Y.size()*(deg + 1));
+    double rmsMax = polyfitShared(7, deg, Y.size(), x.data(), yflat.data(),
+                                  pflat.data());
+
+    double rmsMaxSingle = 0.0;
+    for (size_t i = 0; i < Y.size(); i++) {
+        vector_fp p(deg + 1);
+        double rms = polyfit(7, deg, x.data(), Y[i].data(), nullptr, p.data());
+        rmsMaxSingle = std::max(rmsMaxSingle, rms);
+        for (size_t j = 0; j <= deg; j++) {
+            EXPECT_NEAR(p[j], pflat[i*(deg + 1) + j], 1e-13);
+        }
+    }
+    EXPECT_NEAR(rmsMax, rmsMaxSingle, 1e-13);
+}
+
+TEST(Polyfit, batched_evaluation)
+{
+    std::vector<vector_fp> P{
+        {1.0, -2.0, 0.5, 0.25},
+        {0.3, 1.1, -0.7, 2.0},
+        {-1.5, 0.0, 3.0, -0.4}
+    };
+    vector_fp x{-2.0, -0.5, 0.0, 0.7, 1.9};
+    size_t deg = 3;
+
+    // one polynomial, many points
+    vector_fp y(x.size());
+    polyeval(deg, P[0].data(), x.size(), x.data(), y.data());
+    for (size_t n = 0; n < x.size(); n++) {
+        EXPECT_NEAR(y[n], polyval(P[0], x[n]), 1e-14);
+    }
+
+    // many polynomials, one point, coefficients packed by degree
+    vector_fp planes(P.size()*(deg + 1));
+    for (size_t i = 0; i < P.size(); i++) {
+        for (size_t d = 0; d <= deg; d++) {
+            planes[d*P.size() + i] = P[i][d];
+        }
+    }
+    vector_fp yp(P.size());
+    polyevalBatch(deg, P.size(), planes.data(), 0.7, yp.data());
+    for (size_t i = 0; i < P.size(); i++) {
+        EXPECT_NEAR(yp[i], polyval(P[i], 0.7), 1e-14);
+    }
+}
+
+TEST(Func1Program, matches_tree)
+{
+    // (3 * (sin(2t) + exp(0.5t)))(t^2) + 1.5
+    Func1& sum = newSumFunction(*(new Sin1(2.0)), *(new Exp1(0.5)));
+    Func1& scaled = newTimesConstFunction(sum, 3.0);
+    Func1& comp = newCompositeFunction(scaled, *(new Pow1(2.0)));
+    Func1& full = newPlusConstFunction(comp, 1.5);
+
+    Func1Program prog(full);
+    ASSERT_TRUE(prog.compiled());
+    for (double t : {0.0, 0.3, 1.7, 2.2}) {
+        EXPECT_NEAR(prog.eval(t), full.eval(t),
+                    1e-12 * (1.0 + fabs(full.eval(t))));
+    }
+}
+
+TEST(Func1Program, constant_folding_and_fallback)
+{
+    // a tree without any dependence on the argument folds to a constant
+    Func1& cprod = newProdFunction(*(new Const1(2.0)), *(new Const1(3.0)));
+    Func1Program prog(cprod);
+    EXPECT_DOUBLE_EQ(prog.eval(17.0), 6.0);
+    EXPECT_DOUBLE_EQ(prog.eval(-4.0), 6.0);
+
+    // node types without a dedicated opcode are called through the tree
+    vector_fp pc{0.5, -2.0, 1.0};
+    Func1& poly = *(new Poly1(2, pc.data()));
+    Func1& denom = newPlusConstFunction(*(new Cos1(1.0)), 2.0);
+    Func1& mix = newRatioFunction(poly, denom);
+    Func1Program prog2(mix);
+    for (double t : {0.1, 2.5}) {
+        EXPECT_NEAR(prog2.eval(t), mix.eval(t), 1e-12);
+    }
+}
+
+namespace {
+
+// Tridiagonal test system: ydot_i = -2*y_i + y_{i-1} + 0.5*y_{i+1}
+class TridiagFunc : public FuncEval
+{
+public:
+    explicit TridiagFunc(size_t n) : m_n(n) {}
+    virtual size_t neq() {
+        return m_n;
+    }
+    virtual void eval(double t, double* y, double* ydot, double* p) {
+        for (size_t i = 0; i < m_n; i++) {
+            ydot[i] = -2.0 * y[i];
+            if (i > 0) {
+                ydot[i] += y[i-1];
+            }
+            if (i + 1 < m_n) {
+                ydot[i] += 0.5 * y[i+1];
+            }
+        }
+    }
+    virtual bool jacobianSparsitySupported() const {
+        return true;
+    }
+    virtual void getJacobianSparsity(
+        std::vector<std::pair<size_t, size_t>>& pattern) {
+        for (size_t i = 0; i < m_n; i++) {
+            pattern.emplace_back(i, i);
+            if (i > 0) {
+                pattern.emplace_back(i, i-1);
+            }
+            if (i + 1 < m_n) {
+                pattern.emplace_back(i, i+1);
+            }
+        }
+    }
+private:
+    size_t m_n;
+};
+
+}
+
+TEST(JacobianColoring, banded_color_count)
+{
+    JacobianColoring coloring(10, 10);
+    coloring.addBanded(2, 1);
+    coloring.color();
+    EXPECT_EQ((size_t) 4, coloring.nColors()); // kl + ku + 1
+}
+
+TEST(JacobianColoring, tridiagonal_jacobian)
+{
+    size_t n = 8;
+    TridiagFunc func(n);
+    std::vector<std::pair<size_t, size_t>> pattern;
+    func.getJacobianSparsity(pattern);
+    JacobianColoring coloring(n, n);
+    coloring.addPattern(pattern);
+    coloring.color();
+    EXPECT_EQ((size_t) 3, coloring.nColors());
+
+    vector_fp y(n), ydot(n);
+    for (size_t i = 0; i < n; i++) {
+        y[i] = 0.3 + 0.1 * i;
+    }
+    func.eval(0.0, y.data(), ydot.data(), 0);
+    vector_fp ysave(y);
+
+    DenseMatrix jac;
+    coloring.eval(func, 0.0, y.data(), ydot.data(), jac);
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_DOUBLE_EQ(ysave[i], y[i]); // state restored
+        for (size_t j = 0; j < n; j++) {
+            double exact = 0.0;
+            if (i == j) {
+                exact = -2.0;
+            } else if (j + 1 == i) {
+                exact = 1.0;
+            } else if (j == i + 1) {
+                exact = 0.5;
+            }
+            EXPECT_NEAR(exact, jac(i,j), 1e-6);
+        }
+    }
+}
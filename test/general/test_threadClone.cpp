@@ -0,0 +1,77 @@
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "gtest/gtest.h"
+#include "cantera/base/Solution.h"
+#include "cantera/thermo.h"
+#include "cantera/kinetics.h"
+#include "cantera/transport/TransportBase.h"
+#include "cantera/base/AnyMap.h"
+
+using namespace Cantera;
+
+TEST(SolutionThreadClone, matches_original)
+{
+    auto original = newSolution("h2o2.yaml", "ohmech", "Mix");
+    original->thermo()->setState_TPX(1100.0, 2*OneAtm, "H2:1.0, O2:0.6, N2:2");
+    auto clone = original->threadClone();
+
+    auto thermo1 = original->thermo();
+    auto thermo2 = clone->thermo();
+    EXPECT_EQ(thermo1->type(), thermo2->type());
+    EXPECT_EQ(thermo1->speciesNames(), thermo2->speciesNames());
+    EXPECT_DOUBLE_EQ(thermo1->pressure(), thermo2->pressure());
+    EXPECT_DOUBLE_EQ(thermo1->enthalpy_mole(), thermo2->enthalpy_mole());
+
+    // Species thermo data is shared, not copied
+    EXPECT_EQ(thermo1->species(0).get(), thermo2->species(0).get());
+
+    vector_fp wdot1(original->kinetics()->nReactions());
+    vector_fp wdot2(wdot1.size());
+    original->kinetics()->getNetRatesOfProgress(wdot1.data());
+    clone->kinetics()->getNetRatesOfProgress(wdot2.data());
+    for (size_t i = 0; i < wdot1.size(); i++) {
+        EXPECT_DOUBLE_EQ(wdot1[i], wdot2[i]);
+    }
+
+    EXPECT_EQ(original->transport()->transportType(),
+              clone->transport()->transportType());
+    EXPECT_DOUBLE_EQ(original->transport()->viscosity(),
+                     clone->transport()->viscosity());
+}
+
+TEST(SolutionThreadClone, independent_state)
+{
+    auto original = newSolution("h2o2.yaml", "ohmech", "None");
+    original->thermo()->setState_TPX(900.0, OneAtm, "H2:1.0, O2:0.5");
+    auto clone = original->threadClone();
+
+    clone->thermo()->setState_TPX(1500.0, 5*OneAtm, "H2O:1.0");
+    EXPECT_DOUBLE_EQ(original->thermo()->temperature(), 900.0);
+    EXPECT_DOUBLE_EQ(original->thermo()->pressure(), OneAtm);
+    EXPECT_DOUBLE_EQ(clone->thermo()->temperature(), 1500.0);
+}
+
+TEST(SolutionMemoryReport, reports_sharing)
+{
+    auto original = newSolution("h2o2.yaml", "ohmech", "Mix");
+    auto clone = original->threadClone();
+
+    AnyMap report = clone->memoryReport();
+    const auto& thermo = report["thermo"].as<AnyMap>();
+    EXPECT_EQ(thermo["n-species"].asInt(),
+              (long int) original->thermo()->nSpecies());
+    EXPECT_GT(thermo["species-tables-bytes"].asInt(), 0);
+    EXPECT_GT(thermo["reference-state-cache-bytes"].asInt(), 0);
+    // All species definitions of the clone are shared with the original
+    EXPECT_EQ(thermo["shared-species-objects"].asInt(),
+              (long int) original->thermo()->nSpecies());
+
+    const auto& kin = report["kinetics"].as<AnyMap>();
+    EXPECT_GT(kin["rop-scratch-bytes"].asInt(), 0);
+    EXPECT_EQ(kin["shared-reaction-objects"].asInt(),
+              (long int) original->kinetics()->nReactions());
+
+    const auto& tran = report["transport"].as<AnyMap>();
+    EXPECT_GT(tran["fit-coefficient-bytes"].asInt(), 0);
+}
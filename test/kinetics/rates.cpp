@@ -4,6 +4,7 @@
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/thermo/SurfPhase.h"
 #include "cantera/kinetics/GasKinetics.h"
+#include "cantera/kinetics/InterfaceKinetics.h"
 #include "cantera/base/Solution.h"
 
 namespace Cantera
@@ -194,6 +195,72 @@ TEST_F(NegativePreexponentialFactor, fromYaml)
     testNetProductionRates();
 }
 
+TEST(QuasiSteadySpecies, NetProductionRatesVanish)
+{
+    auto sol = newSolution("h2o2.yaml", "", "None");
+    auto& gas = *sol->thermo();
+    auto* kin = dynamic_cast<GasKinetics*>(sol->kinetics().get());
+    ASSERT_TRUE(kin != nullptr);
+    gas.setState_TPX(1100, OneAtm, "H2:2, O2:1, OH:1e-4, H:1e-5, O:1e-5");
+
+    vector_fp wdot0(kin->nTotalSpecies());
+    kin->getNetProductionRates(wdot0.data());
+
+    kin->setQuasiSteadySpecies({"OH", "H", "O"});
+    vector_fp wdot(kin->nTotalSpecies());
+    vector_fp cdot(kin->nTotalSpecies());
+    kin->getNetProductionRates(wdot.data());
+    kin->getCreationRates(cdot.data());
+
+    // the net production rates of the QSS species vanish relative to their
+    // creation rates, while the other species still react
+    for (auto name : {"OH", "H", "O"}) {
+        size_t k = gas.speciesIndex(name);
+        EXPECT_LT(fabs(wdot[k]), 1e-4 * cdot[k]) << name;
+    }
+    EXPECT_GT(fabs(wdot[gas.speciesIndex("H2")]), 0.0);
+
+    // disabling the approximation restores the exact rates
+    kin->setQuasiSteadySpecies({});
+    kin->getNetProductionRates(wdot.data());
+    for (size_t k = 0; k < kin->nTotalSpecies(); k++) {
+        EXPECT_DOUBLE_EQ(wdot[k], wdot0[k]);
+    }
+
+    EXPECT_THROW(kin->setQuasiSteadySpecies({"XYZ"}), CanteraError);
+}
+
+TEST(RatesOfProgressSubset, MatchesFullEvaluation)
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "None");
+    auto& gas = *sol->thermo();
+    auto& kin = *sol->kinetics();
+    gas.setState_TPX(1500, 2*OneAtm, "CH4:1, O2:2, OH:1e-3, H:1e-4, N2:7.52");
+
+    std::vector<size_t> rxns{0, 3, 37, 200, kin.nReactions() - 1};
+    vector_fp fwd(rxns.size()), rev(rxns.size()), net(rxns.size());
+    vector_fp fwdFull(kin.nReactions());
+    vector_fp revFull(kin.nReactions());
+    vector_fp netFull(kin.nReactions());
+
+    // subset rates match the full evaluation, also after changing a
+    // multiplier of one of the requested reactions
+    kin.setMultiplier(37, 1.05);
+    kin.getRatesOfProgressSubset(rxns, fwd.data(), rev.data(), net.data());
+    kin.getFwdRatesOfProgress(fwdFull.data());
+    kin.getRevRatesOfProgress(revFull.data());
+    kin.getNetRatesOfProgress(netFull.data());
+    for (size_t n = 0; n < rxns.size(); n++) {
+        size_t i = rxns[n];
+        EXPECT_NEAR(fwd[n], fwdFull[i], 1e-10 * fabs(fwdFull[i])) << i;
+        EXPECT_NEAR(rev[n], revFull[i], 1e-10 * fabs(revFull[i])) << i;
+        EXPECT_NEAR(net[n], netFull[i], 1e-10 * fabs(netFull[i]) + 1e-300) << i;
+    }
+
+    EXPECT_THROW(kin.getRatesOfProgressSubset({kin.nReactions()}, fwd.data()),
+                 CanteraError);
+}
+
 TEST(InterfaceReaction, CoverageDependency) {
     IdealGasPhase gas("ptcombust.yaml", "gas");
     SurfPhase surf("ptcombust.yaml", "Pt_surf");
@@ -211,4 +278,32 @@ TEST(InterfaceReaction, CoverageDependency) {
     EXPECT_NEAR(kf[1], 3.7e20 * exp(-(67.4e6-6e6*0.3)/(GasConstant*T)), 1e-14*kf[1]);
 }
 
+TEST(InterfaceReaction, CoverageChangeTolerance) {
+    IdealGasPhase gas("ptcombust.yaml", "gas");
+    SurfPhase surf("ptcombust.yaml", "Pt_surf");
+    std::vector<ThermoPhase*> phases { &surf, &gas };
+    shared_ptr<Kinetics> kin(newKinetics(phases, "ptcombust.yaml", "Pt_surf"));
+    auto ik = dynamic_cast<InterfaceKinetics*>(kin.get());
+
+    double T = 500;
+    surf.setState_TP(T, 101325);
+    surf.setCoveragesByName("PT(S):0.7, H(S):0.3");
+    vector_fp kf0(kin->nReactions());
+    kin->getFwdRateConstants(&kf0[0]);
+
+    // Within the tolerance the stored coverage corrections are reused
+    ik->setCoverageChangeTolerance(1e-3);
+    kin->getFwdRateConstants(&kf0[0]);
+    surf.setCoveragesByName("PT(S):0.7005, H(S):0.2995");
+    vector_fp kf1(kin->nReactions());
+    kin->getFwdRateConstants(&kf1[0]);
+    EXPECT_DOUBLE_EQ(kf1[1], kf0[1]);
+
+    // A change above the tolerance triggers a re-evaluation
+    surf.setCoveragesByName("PT(S):0.8, H(S):0.2");
+    kin->getFwdRateConstants(&kf1[0]);
+    EXPECT_NEAR(kf1[1], 3.7e20 * exp(-(67.4e6-6e6*0.2)/(GasConstant*T)),
+                1e-14*kf1[1]);
+}
+
 }
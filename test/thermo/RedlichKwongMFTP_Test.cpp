@@ -166,6 +166,31 @@ TEST_F(RedlichKwongMFTP_Test, setTP)
     }
 }
 
+TEST_F(RedlichKwongMFTP_Test, batchMolarVolumes)
+{
+    set_r(0.7);
+    RedlichKwongMFTP* rk = dynamic_cast<RedlichKwongMFTP*>(test_phase.get());
+
+    // Supercritical states, so the cubic has a single root and the batch
+    // solve must agree with the iterative density solve in setState_TP
+    const double T[3] = {340., 400., 500.};
+    const double P[3] = {1.e4, 1.e6, 2.e7};
+    double vm[3];
+    double phi[3];
+    rk->getMolarVolumesAndFugacities(3, T, P, FLUID_GAS, vm, phi);
+
+    for (int i = 0; i < 3; i++) {
+        test_phase->setState_TP(T[i], P[i]);
+        double mv = test_phase->meanMolecularWeight() / test_phase->density();
+        EXPECT_NEAR(vm[i], mv, 1.e-8 * mv);
+    }
+
+    // In the low-pressure limit the mixture approaches ideality
+    EXPECT_NEAR(phi[0], 1.0, 1.e-3);
+    // At high pressure the fugacity coefficient departs from unity
+    EXPECT_LT(phi[2], 0.99);
+}
+
 TEST_F(RedlichKwongMFTP_Test, critPropLookup)
 {
     // Check to make sure that RedlichKwongMFTP is able to properly calculate a and b
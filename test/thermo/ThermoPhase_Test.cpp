@@ -47,6 +47,21 @@ TEST_F(TestThermoMethods, getMassFractionsByName)
     EXPECT_EQ(Y.size(), (size_t) 3);
 }
 
+TEST_F(TestThermoMethods, setMassFractionsByIndex)
+{
+    size_t ks[3] = {thermo->speciesIndex("O2"), thermo->speciesIndex("H2"),
+                    thermo->speciesIndex("AR")};
+    double ys[3] = {0.4, 0.6, 1.0};
+    thermo->setMassFractionsByIndex(3, ks, ys);
+    EXPECT_DOUBLE_EQ(thermo->massFraction("O2"), 0.2);
+    EXPECT_DOUBLE_EQ(thermo->massFraction("H2"), 0.3);
+    EXPECT_DOUBLE_EQ(thermo->massFraction("AR"), 0.5);
+    EXPECT_DOUBLE_EQ(thermo->massFraction("OH"), 0.0);
+
+    size_t bad = thermo->nSpecies();
+    EXPECT_THROW(thermo->setMassFractionsByIndex(1, &bad, ys), CanteraError);
+}
+
 TEST_F(TestThermoMethods, setState_nan)
 {
     double nan = std::numeric_limits<double>::quiet_NaN();
@@ -58,6 +73,23 @@ TEST_F(TestThermoMethods, setState_nan)
     EXPECT_THROW(thermo->setState_TR(555, nan), CanteraError);
 }
 
+TEST_F(TestThermoMethods, setState_TRY_raw)
+{
+    thermo->setMassFractionsByName("O2:0.2, H2:0.3, AR:0.5");
+    thermo->setState_TR(450, 1.7);
+    vector_fp y(thermo->nSpecies());
+    thermo->getMassFractions(y.data());
+    double mmw = thermo->meanMolecularWeight();
+
+    // perturb the state, then restore it through the raw fast path
+    thermo->setState_TP(900, 2 * OneAtm);
+    thermo->setState_TRY_raw(450, 1.7, y.data());
+    EXPECT_DOUBLE_EQ(thermo->temperature(), 450);
+    EXPECT_DOUBLE_EQ(thermo->density(), 1.7);
+    EXPECT_DOUBLE_EQ(thermo->meanMolecularWeight(), mmw);
+    EXPECT_DOUBLE_EQ(thermo->massFraction("H2"), 0.3);
+}
+
 TEST_F(TestThermoMethods, setState_AnyMap)
 {
     AnyMap state;
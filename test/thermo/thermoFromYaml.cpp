@@ -297,6 +297,38 @@ TEST(ThermoFromYaml, HMWSoln)
     EXPECT_EQ("liquid", HMW->phaseOfMatter());
 }
 
+TEST(ThermoFromYaml, HMWSoln_batchActivityCoefficients)
+{
+    auto thermo = newThermo("thermo-models.yaml", "HMW-NaCl-electrolyte");
+    size_t N = thermo->nSpecies();
+    auto HMW = dynamic_cast<MolalityVPSSTP*>(thermo.get());
+
+    // Three compositions: two perturbed states bracketing the initial one
+    vector_fp X(3 * N);
+    thermo->getMoleFractions(X.data() + N);
+    for (size_t k = 0; k < N; k++) {
+        X[k] = 0.9 * X[N + k];
+        X[2 * N + k] = 1.1 * X[N + k];
+    }
+    vector_fp acBatch(3 * N);
+    HMW->getMolalityActivityCoefficientsBatch(3, X.data(), acBatch.data());
+
+    // Each batch entry must match a conventional point evaluation, and the
+    // phase composition must be restored afterwards
+    vector_fp mf(N), ac(N);
+    thermo->getMoleFractions(mf.data());
+    for (size_t k = 0; k < N; k++) {
+        EXPECT_NEAR(mf[k], X[N + k], 1e-14);
+    }
+    for (size_t n = 0; n < 3; n++) {
+        thermo->setMoleFractions(X.data() + n * N);
+        HMW->getMolalityActivityCoefficients(ac.data());
+        for (size_t k = 0; k < N; k++) {
+            EXPECT_DOUBLE_EQ(acBatch[n * N + k], ac[k]);
+        }
+    }
+}
+
 TEST(ThermoFromYaml, HMWSoln_HKFT)
 {
     auto thermo = newThermo("thermo-models.yaml", "HMW-NaCl-HKFT");
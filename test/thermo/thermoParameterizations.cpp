@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include "cantera/thermo/speciesThermoTypes.h"
 #include "cantera/thermo/SpeciesThermoFactory.h"
+#include "cantera/thermo/MultiSpeciesThermo.h"
 #include "cantera/thermo/Species.h"
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/thermo/ConstCpPoly.h"
@@ -165,6 +166,34 @@ TEST(SpeciesThermo, NasaPoly2FromYaml2) {
     EXPECT_DOUBLE_EQ(s_R, 28.913447733267262);
 }
 
+TEST(SpeciesThermo, SharedParameterizationPool) {
+    std::string yaml =
+        "model: NASA7\n"
+        "reference-pressure: 1 atm\n"
+        "temperature-ranges: [200, 1000, 6000]\n"
+        "data:\n"
+        "- [3.944031200E+00, -1.585429000E-03, 1.665781200E-05, -2.047542600E-08,\n"
+        "   7.835056400E-12, 2.896617900E+03, 6.311991700E+00]\n"
+        "- [4.884754200E+00, 2.172395600E-03, -8.280690600E-07, 1.574751000E-10,\n"
+        "   -1.051089500E-14, 2.316498300E+03, -1.174169500E-01]\n";
+    auto st1 = newSpeciesThermoShared(AnyMap::fromYamlString(yaml));
+    auto st2 = newSpeciesThermoShared(AnyMap::fromYamlString(yaml));
+    EXPECT_EQ(st1.get(), st2.get());
+
+    // Modifications through one manager do not leak into another manager
+    // holding the shared parameterization
+    MultiSpeciesThermo mgr1;
+    MultiSpeciesThermo mgr2;
+    mgr1.install_STIT(0, st1);
+    mgr2.install_STIT(0, st2);
+    double hf = mgr1.reportOneHf298(0);
+    mgr1.modifyOneHf298(0, hf + 1e6);
+    EXPECT_DOUBLE_EQ(hf + 1e6, mgr1.reportOneHf298(0));
+    EXPECT_DOUBLE_EQ(hf, mgr2.reportOneHf298(0));
+    mgr1.resetHf298(0);
+    EXPECT_DOUBLE_EQ(hf, mgr1.reportOneHf298(0));
+}
+
 TEST(SpeciesThermo, Shomate2FromYaml1) {
     AnyMap data = AnyMap::fromYamlString(
         "model: Shomate\n"
@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include "cantera/base/ct_defs.h"
+#include "cantera/base/ctexceptions.h"
 #include "cantera/thermo/WaterPropsIAPWSphi.h"
 #include "cantera/thermo/WaterPropsIAPWS.h"
 
@@ -125,6 +126,34 @@ TEST_F(WaterPropsIAPWS_Test, saturation_pressure_estimate)
     }
 }
 
+TEST_F(WaterPropsIAPWS_Test, density_table)
+{
+    vector_fp TT{280.0, 350.0, 413.7, 500.0};
+    vector_fp PP{2.0e5, 1.1e6, 5.0e6, 2.0e7};
+
+    // Reference solves with the exact formulation only
+    vector_fp rho_exact(TT.size());
+    for (size_t i = 0; i < TT.size(); i++) {
+        rho_exact[i] = water.density(TT[i], PP[i], WATER_LIQUID);
+    }
+
+    // The table only supplies the initial guess, so the converged densities
+    // must agree with the exact formulation essentially to roundoff
+    water.setupDensityTable(275.0, 550.0, 1.0e5, 3.0e7);
+    for (size_t i = 0; i < TT.size(); i++) {
+        double rho = water.density(TT[i], PP[i], WATER_LIQUID);
+        EXPECT_NEAR(rho, rho_exact[i], 1e-8 * rho_exact[i]);
+    }
+
+    // Outside the tabulated window the original path is used
+    double rho = water.density(650.0, 4.0e7, WATER_SUPERCRIT);
+    water.clearDensityTable();
+    EXPECT_NEAR(rho, water.density(650.0, 4.0e7, WATER_SUPERCRIT), 1e-12 * rho);
+
+    EXPECT_THROW(water.setupDensityTable(400.0, 300.0, 1.0e5, 1.0e7),
+                 CanteraError);
+}
+
 TEST_F(WaterPropsIAPWS_Test, expansion_coeffs)
 {
     vector_fp TT{300.0, 300.0, 700.0};
@@ -0,0 +1,205 @@
+/**
+ * @file perf_bench.cpp
+ *
+ * Performance regression harness over representative solver scenarios.
+ * Run through 'scons perf-bench'. Each scenario is timed with the
+ * high-resolution profiler clock and its hot-path allocation count is
+ * recorded; a Chrome trace of the instrumented phases is saved alongside
+ * the metrics for drill-down. On the first run the results are written to
+ * a machine-readable baseline file; later runs compare against the
+ * baseline and report per-scenario deltas, exiting with a nonzero status
+ * if a scenario slowed down beyond the tolerance or started allocating in
+ * its hot loop.
+ *
+ * Usage: perf_bench <baseline-file> [tolerance]
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/Solution.h"
+#include "cantera/base/AnyMap.h"
+#include "cantera/base/Profiler.h"
+#include "cantera/base/global.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/zerodim.h"
+
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <sstream>
+
+using namespace Cantera;
+
+namespace {
+
+struct BenchResult
+{
+    double wall_ms;
+    size_t allocations;
+};
+
+//! Run *fn* once and record its wall time and hot-path allocation delta
+BenchResult timeScenario(const std::function<void()>& fn)
+{
+    size_t alloc0 = hotPathAllocationCount();
+    int64_t t0 = Profiler::now();
+    fn();
+    int64_t t1 = Profiler::now();
+    BenchResult r;
+    r.wall_ms = (t1 - t0) / 1.0e6;
+    r.allocations = hotPathAllocationCount() - alloc0;
+    return r;
+}
+
+// Mechanism construction (parse is warmed up, so this times the phase,
+// species, and reaction setup)
+void mechanismLoad()
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "None");
+    sol->thermo()->nSpecies();
+}
+
+// Net production rate evaluation over a temperature sweep; dominated by
+// updateROP
+void productionRates()
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "None");
+    auto gas = sol->thermo();
+    auto kin = sol->kinetics();
+    size_t nsp = gas->nSpecies();
+    vector_fp wdot(nsp);
+    vector_fp y(nsp);
+    gas->setState_TPX(300.0, OneAtm, "CH4:1.0, O2:2.0, N2:7.52");
+    gas->getMassFractions(y.data());
+    for (int i = 0; i < 2000; i++) {
+        double T = 500.0 + 1.0*i;
+        gas->setState_TPY(T, OneAtm, y.data());
+        kin->getNetProductionRates(wdot.data());
+    }
+}
+
+// Constant-pressure autoignition with CVODES, as in the cxx_ex kinetics
+// example
+void reactorIgnition()
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "None");
+    auto gas = sol->thermo();
+    gas->setState_TPX(1001.0, OneAtm, "H2:2.0, O2:1.0, N2:4.0");
+    IdealGasConstPressureReactor r;
+    r.insert(sol);
+    ReactorNet sim;
+    sim.addReactor(r);
+    double t = 0.0;
+    for (int n = 0; n < 100; n++) {
+        t += 1.0e-5;
+        sim.advance(t);
+    }
+}
+
+// Repeated chemical equilibrium solves over a composition sweep
+void equilibrium()
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "None");
+    auto gas = sol->thermo();
+    for (int i = 0; i < 20; i++) {
+        double phi = 0.5 + 0.05*i;
+        gas->setEquivalenceRatio(phi, "CH4", "O2:0.21,N2:0.79");
+        gas->setState_TP(300.0, OneAtm);
+        gas->equilibrate("HP");
+    }
+}
+
+void writeResults(const std::string& filename,
+                  const std::vector<std::pair<std::string, BenchResult>>& results)
+{
+    std::ofstream out(filename, std::ios::trunc);
+    out << "{\n";
+    out << fmt::format("  \"cantera-commit\": \"{}\",\n", gitCommit());
+    out << "  \"metrics\": {\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        out << fmt::format(
+            "    \"{}\": {{\"wall_ms\": {:.3f}, \"allocations\": {}}}{}\n",
+            results[i].first, results[i].second.wall_ms,
+            results[i].second.allocations,
+            (i + 1 < results.size()) ? "," : "");
+    }
+    out << "  }\n}\n";
+}
+
+} // unnamed namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        printf("usage: perf_bench <baseline-file> [tolerance]\n");
+        return 2;
+    }
+    std::string baselineFile = argv[1];
+    double tol = (argc > 2) ? atof(argv[2]) : 0.10;
+
+    try {
+        // warm up the input-file cache so that mechanism_load times the
+        // mechanism setup rather than the disk parse
+        newSolution("gri30.yaml", "gri30", "None");
+
+        std::vector<std::pair<std::string, std::function<void()>>> scenarios {
+            {"mechanism_load", mechanismLoad},
+            {"production_rates", productionRates},
+            {"reactor_ignition", reactorIgnition},
+            {"equilibrium", equilibrium},
+        };
+
+        Profiler::enable();
+        std::vector<std::pair<std::string, BenchResult>> results;
+        for (auto& s : scenarios) {
+            results.emplace_back(s.first, timeScenario(s.second));
+        }
+        Profiler::disable();
+        Profiler::saveTrace("perf_bench.trace.json");
+        writeResults("perf_bench_results.json", results);
+
+        std::ifstream base(baselineFile);
+        if (!base) {
+            writeResults(baselineFile, results);
+            printf("No baseline found; recorded new baseline '%s'.\n",
+                   baselineFile.c_str());
+            appdelete();
+            return 0;
+        }
+        std::stringstream buf;
+        buf << base.rdbuf();
+        AnyMap baseline = AnyMap::fromYamlString(buf.str());
+        auto& metrics = baseline["metrics"].as<AnyMap>();
+
+        printf("%-18s %12s %12s %9s %8s\n",
+               "scenario", "base (ms)", "now (ms)", "delta", "allocs");
+        bool regression = false;
+        for (auto& r : results) {
+            if (!metrics.hasKey(r.first)) {
+                printf("%-18s %12s %12.3f %9s %8zu (no baseline entry)\n",
+                       r.first.c_str(), "-", r.second.wall_ms, "-",
+                       r.second.allocations);
+                continue;
+            }
+            auto& m = metrics[r.first].as<AnyMap>();
+            double baseMs = m["wall_ms"].asDouble();
+            size_t baseAlloc = m.getInt("allocations", 0);
+            double delta = (r.second.wall_ms - baseMs) / baseMs;
+            const char* flag = "";
+            if (delta > tol || r.second.allocations > baseAlloc) {
+                regression = true;
+                flag = "  <-- regression";
+            }
+            printf("%-18s %12.3f %12.3f %+8.1f%% %8zu%s\n",
+                   r.first.c_str(), baseMs, r.second.wall_ms, 100.0*delta,
+                   r.second.allocations, flag);
+        }
+        appdelete();
+        return regression ? 1 : 0;
+    } catch (CanteraError& err) {
+        printf("%s\n", err.what());
+        return 2;
+    }
+}
@@ -0,0 +1,164 @@
+/**
+ * @file pgo_workloads.cpp
+ *
+ * Training workloads for profile-guided optimization builds. Run by
+ * 'scons pgo-train' against an instrumented library (see the 'pgo' build
+ * option) so that the collected execution profiles cover the kernels that
+ * dominate typical applications: mechanism loading, kinetics and transport
+ * property evaluation, a ReactorNet ignition, and a one-dimensional flame.
+ * This is not a regression test; the output is not compared against a
+ * blessed file.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/Solution.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/zerodim.h"
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/oneD/Boundary1D.h"
+#include "cantera/oneD/StFlow.h"
+#include "cantera/transport.h"
+
+#include <cstdio>
+
+using namespace Cantera;
+
+// Mechanism loading plus kinetics and transport property evaluation over a
+// temperature sweep
+static void propertyWorkload()
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "Mix");
+    auto gas = sol->thermo();
+    auto kin = sol->kinetics();
+    auto trans = sol->transport();
+    size_t nsp = gas->nSpecies();
+    vector_fp wdot(nsp);
+    vector_fp diff(nsp);
+    vector_fp y(nsp);
+    gas->setState_TPX(300.0, OneAtm, "CH4:1.0, O2:2.0, N2:7.52");
+    gas->getMassFractions(y.data());
+    for (int i = 0; i < 200; i++) {
+        double T = 500.0 + 10.0*i;
+        gas->setState_TPY(T, OneAtm, y.data());
+        kin->getNetProductionRates(wdot.data());
+        trans->getMixDiffCoeffs(diff.data());
+        trans->viscosity();
+        trans->thermalConductivity();
+    }
+}
+
+// Constant-pressure autoignition with CVODES, as in the kinetics1 sample
+static void ignitionWorkload()
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "None");
+    auto gas = sol->thermo();
+    gas->setState_TPX(1001.0, OneAtm, "H2:2.0, O2:1.0, N2:4.0");
+    IdealGasConstPressureReactor r;
+    r.insert(sol);
+    ReactorNet sim;
+    sim.addReactor(r);
+    double t = 0.0;
+    for (int n = 0; n < 100; n++) {
+        t += 1.0e-5;
+        sim.advance(t);
+    }
+}
+
+// Freely-propagating methane flame with grid refinement, as in the
+// flamespeed sample
+static void flameWorkload()
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "None");
+    auto gas = sol->thermo();
+    double temp = 300.0;
+    double pressure = OneAtm;
+    double uin = 0.3;
+
+    size_t nsp = gas->nSpecies();
+    vector_fp x(nsp);
+    gas->setEquivalenceRatio(0.9, "CH4", "O2:0.21,N2:0.79");
+    gas->setState_TP(temp, pressure);
+    gas->getMoleFractions(x.data());
+    double rho_in = gas->density();
+
+    vector_fp yin(nsp);
+    gas->getMassFractions(&yin[0]);
+
+    gas->equilibrate("HP");
+    vector_fp yout(nsp);
+    gas->getMassFractions(&yout[0]);
+    double rho_out = gas->density();
+    double Tad = gas->temperature();
+
+    StFlow flow(gas);
+    flow.setFreeFlow();
+
+    int nz = 6;
+    double lz = 0.1;
+    vector_fp z(nz);
+    double dz = lz/((double)(nz-1));
+    for (int iz = 0; iz < nz; iz++) {
+        z[iz] = ((double)iz)*dz;
+    }
+    flow.setupGrid(nz, &z[0]);
+
+    std::unique_ptr<Transport> trmix(newTransportMgr("Mix", sol->thermo().get()));
+    flow.setTransport(*trmix);
+    flow.setKinetics(*sol->kinetics());
+    flow.setPressure(pressure);
+
+    Inlet1D inlet;
+    inlet.setMoleFractions(x.data());
+    double mdot = uin*rho_in;
+    inlet.setMdot(mdot);
+    inlet.setTemperature(temp);
+
+    Outlet1D outlet;
+
+    std::vector<Domain1D*> domains { &inlet, &flow, &outlet };
+    Sim1D flame(domains);
+
+    vector_fp locs{0.0, 0.3, 0.7, 1.0};
+    vector_fp value;
+    double uout = inlet.mdot()/rho_out;
+    value = {uin, uin, uout, uout};
+    flame.setInitialGuess("velocity", locs, value);
+    value = {temp, temp, Tad, Tad};
+    flame.setInitialGuess("T", locs, value);
+    for (size_t i = 0; i < nsp; i++) {
+        value = {yin[i], yin[i], yout[i], yout[i]};
+        flame.setInitialGuess(gas->speciesName(i), locs, value);
+    }
+
+    inlet.setMoleFractions(x.data());
+    inlet.setMdot(mdot);
+    inlet.setTemperature(temp);
+
+    int flowdomain = 1;
+    flame.setRefineCriteria(flowdomain, 10.0, 0.15, 0.3);
+    flame.setFixedTemperature(0.5 * (temp + Tad));
+    flow.solveEnergyEqn();
+
+    flame.solve(0, true);
+}
+
+int main()
+{
+    try {
+        printf("running property workload...\n");
+        propertyWorkload();
+        printf("running ignition workload...\n");
+        ignitionWorkload();
+        printf("running flame workload...\n");
+        flameWorkload();
+        printf("training workloads complete\n");
+        appdelete();
+        return 0;
+    } catch (CanteraError& err) {
+        printf("%s\n", err.what());
+        return -1;
+    }
+}